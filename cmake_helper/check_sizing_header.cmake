@@ -0,0 +1,22 @@
+# Check a sizing generator
+#
+# Script Usage:
+# cmake -DGENERATOR=<generator> -DSIZING_HEADER=<output file> -DEXPECTED_DEFINITIONS=<definitions> -P check_sizing_header.cmake
+# Parameters:
+# GENERATOR - Sizing generator executable
+# SIZING_HEADER - Sizing header written by the generator
+# EXPECTED_DEFINITIONS - Definitions, which must be in the sizing header, separated by |
+# -> example: "RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS (5000U)|RADEF_CONNECTION_INDEX_SIZE (16384U)"
+execute_process(COMMAND ${GENERATOR} ${SIZING_HEADER} RESULT_VARIABLE _result)
+if(NOT _result EQUAL 0)
+  message(FATAL_ERROR "${GENERATOR} failed with ${_result}")
+endif()
+
+file(READ ${SIZING_HEADER} _sizing_header)
+string(REPLACE "|" ";" _expected_definitions "${EXPECTED_DEFINITIONS}")
+foreach(_definition IN LISTS _expected_definitions)
+  string(FIND "${_sizing_header}" "#define ${_definition}\n" _position)
+  if(_position EQUAL -1)
+    message(FATAL_ERROR "${SIZING_HEADER} does not define ${_definition}")
+  endif()
+endforeach()
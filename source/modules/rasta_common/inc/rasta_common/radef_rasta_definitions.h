@@ -28,6 +28,13 @@
 // -----------------------------------------------------------------------------
 #include <stdint.h>
 
+// If the stack is built with the sizing of the configuration (CMake option RASTA_CONFIGURATION_SIZING), the headers generated from the SafRetL and RedL
+// configuration define the limits below, which can be defined at build time.
+#ifdef RADEF_CONFIGURATION_SIZING
+#include "rasta_redundancy_config/redcfg_red_sizing.h"
+#include "rasta_safety_retransmission_config/srcfg_sr_sizing.h"
+#endif
+
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
 // -----------------------------------------------------------------------------
@@ -37,11 +44,53 @@
  */
 #define PRIVATE static
 
+/**
+ * @brief Storage class of the instance selection of the modules.
+ *
+ * If the stack is built for multi-threaded use (CMake option RASTA_MULTI_THREADED), every thread selects its instances independently, so that different
+ * instances can be serviced concurrently by different threads (see rarun_rasta_runtime.h). Otherwise the selection applies to the whole process.
+ */
+#if defined(RADEF_MULTI_THREADED) && defined(__cplusplus)
+#define RADEF_THREAD_LOCAL thread_local  ///< Same storage class for the declarations of the C++ unit tests
+#elif defined(RADEF_MULTI_THREADED)
+#define RADEF_THREAD_LOCAL _Thread_local
+#else
+#define RADEF_THREAD_LOCAL
+#endif
+
 // -------------------- Safety and retransmission layer ------------------------
 /**
  * @brief Maximum number of RaSTA connections per RaSTA network.
+ *
+ * Bounds the number of connections of a configuration. The per connection data is allocated from the connection memory of the application, so that only the
+ * configuration and the connection index grow with this value. A gateway with thousands of connections defines it at build time together with
+ * ::RADEF_CONNECTION_INDEX_SIZE, or generates both from its configuration with RASTA_CONFIGURATION_SIZING. Such a build must also define
+ * ::RADEF_SLAB_NUMBER_OF_LARGE_CHUNKS, since the chunk handles can not address the full buffers of all connections. Otherwise raslb_rasta_slab.h stops
+ * the build with an error.
  */
+#ifndef RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS
 #define RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS (2U)
+#endif
+
+/**
+ * @brief Maximum number of SafRetL instances in one process [instances].
+ *
+ * Every instance owns the state of an independent SafRetL with its own configuration and connection memory. Can be defined at build time. More than one
+ * instance is only allowed, if the stack is built with ::RADEF_MULTI_THREADED.
+ */
+#ifndef RADEF_MAX_NUMBER_OF_SR_INSTANCES
+#define RADEF_MAX_NUMBER_OF_SR_INSTANCES (1U)
+#endif
+
+/**
+ * @brief Number of positions of the connection index, which finds a connection by its sender and receiver id [positions].
+ *
+ * Must be a power of two and at least twice ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, so that at least half of the positions stay unused. Can be defined at
+ * build time together with ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
+ */
+#ifndef RADEF_CONNECTION_INDEX_SIZE
+#define RADEF_CONNECTION_INDEX_SIZE (4U)
+#endif
 
 /**
  * @brief Maximum payload size of a SafRetL PDU message [Bytes].
@@ -85,24 +134,126 @@
 
 /**
  * @brief Maximum number of entires in the received buffer [messages].
+ *
+ * Can be defined at build time to allow larger windows on links with a high round trip time. Valid range: 2 <= value <= 4096.
  */
+#ifndef RADEF_MAX_N_SEND_MAX
 #define RADEF_MAX_N_SEND_MAX (20U)
+#endif
 
 /**
  * @brief Defines the number of send buffer entries [messages]
  */
 #define RADEF_SEND_BUFFER_SIZE (RADEF_MAX_N_SEND_MAX)
 
+/**
+ * @brief Defines the number of send buffer positions, which are addressed by the sequence number of the messages [positions].
+ *
+ * A position only refers to one of the ::RADEF_SEND_BUFFER_SIZE send buffer entries. Must be a power of two and at least twice ::RADEF_SEND_BUFFER_SIZE, so that
+ * a retransmission can be prepared behind the stored messages. Can be defined at build time together with ::RADEF_MAX_N_SEND_MAX.
+ */
+#ifndef RADEF_SEND_BUFFER_INDEX_SIZE
+#define RADEF_SEND_BUFFER_INDEX_SIZE (64U)
+#endif
+
+/**
+ * @brief Defines the number of received buffer entries [messages].
+ *
+ * Must be a power of two and at least ::RADEF_MAX_N_SEND_MAX. Can be defined at build time together with ::RADEF_MAX_N_SEND_MAX.
+ */
+#ifndef RADEF_RECEIVED_BUFFER_SIZE
+#define RADEF_RECEIVED_BUFFER_SIZE (32U)
+#endif
+
+/**
+ * @brief Chunk size of the small size class of the message slab [bytes].
+ *
+ * Big enough for all SafRetL messages without payload. Can be defined at build time.
+ */
+#ifndef RADEF_SLAB_SMALL_CHUNK_SIZE
+#define RADEF_SLAB_SMALL_CHUNK_SIZE (64U)
+#endif
+
+/**
+ * @brief Chunk size of the medium size class of the message slab [bytes].
+ *
+ * Big enough for data messages with the typical payload of an application. Can be defined at build time.
+ */
+#ifndef RADEF_SLAB_MEDIUM_CHUNK_SIZE
+#define RADEF_SLAB_MEDIUM_CHUNK_SIZE (256U)
+#endif
+
+/**
+ * @brief Chunk size of the large size class of the message slab [bytes].
+ */
+#define RADEF_SLAB_LARGE_CHUNK_SIZE (RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE)
+
+/**
+ * @brief Number of chunks in the small size class of the message slab [chunks]. Can be defined at build time.
+ */
+#ifndef RADEF_SLAB_NUMBER_OF_SMALL_CHUNKS
+#define RADEF_SLAB_NUMBER_OF_SMALL_CHUNKS (0U)
+#endif
+
+/**
+ * @brief Number of chunks in the medium size class of the message slab [chunks]. Can be defined at build time.
+ */
+#ifndef RADEF_SLAB_NUMBER_OF_MEDIUM_CHUNKS
+#define RADEF_SLAB_NUMBER_OF_MEDIUM_CHUNKS (0U)
+#endif
+
+/**
+ * @brief Number of chunks in the large size class of the message slab [chunks].
+ *
+ * The chunks are shared by all connections. The default value allows to fill the send and the received buffers of all connections with messages of maximum
+ * size. Can be defined at build time to reduce the memory usage, if most of the messages fit into the smaller size classes, or to limit the chunks of a
+ * build with thousands of connections, whose full buffers can not be addressed by the chunk handles.
+ */
+#ifndef RADEF_SLAB_NUMBER_OF_LARGE_CHUNKS
+#define RADEF_SLAB_NUMBER_OF_LARGE_CHUNKS (RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS * (RADEF_SEND_BUFFER_SIZE + RADEF_MAX_N_SEND_MAX))
+#endif
+
+/**
+ * @brief Maximum number of size classes of the message slab.
+ */
+#define RADEF_SLAB_MAX_NUMBER_OF_SIZE_CLASSES (3U)
+
+/**
+ * @brief Maximum number of chunks of the message slab [chunks].
+ */
+#define RADEF_SLAB_MAX_NUMBER_OF_CHUNKS (RADEF_SLAB_NUMBER_OF_SMALL_CHUNKS + RADEF_SLAB_NUMBER_OF_MEDIUM_CHUNKS + RADEF_SLAB_NUMBER_OF_LARGE_CHUNKS)
+
+/**
+ * @brief Memory size of the message slab [bytes].
+ */
+#define RADEF_SLAB_POOL_SIZE                                                                                                                              \
+  ((RADEF_SLAB_NUMBER_OF_SMALL_CHUNKS * RADEF_SLAB_SMALL_CHUNK_SIZE) + (RADEF_SLAB_NUMBER_OF_MEDIUM_CHUNKS * RADEF_SLAB_MEDIUM_CHUNK_SIZE) + \
+   (RADEF_SLAB_NUMBER_OF_LARGE_CHUNKS * RADEF_SLAB_LARGE_CHUNK_SIZE))
+
 // -------------------- Redundancy layer ---------------------------------------
 /**
- * @brief Maximum number of redundancy channels.
+ * @brief Maximum number of redundancy channels. Can be defined at build time.
  */
+#ifndef RADEF_MAX_NUMBER_OF_RED_CHANNELS
 #define RADEF_MAX_NUMBER_OF_RED_CHANNELS (RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)
+#endif
+
+/**
+ * @brief Maximum number of RedL instances in one process [instances].
+ *
+ * Every instance owns the state of an independent RedL with its own configuration. Can be defined at build time. More than one instance is only allowed, if
+ * the stack is built with ::RADEF_MULTI_THREADED.
+ */
+#ifndef RADEF_MAX_NUMBER_OF_RED_INSTANCES
+#define RADEF_MAX_NUMBER_OF_RED_INSTANCES (RADEF_MAX_NUMBER_OF_SR_INSTANCES)
+#endif
 
 /**
- * @brief Maximum number of transport channels per redundancy channel.
+ * @brief Maximum number of transport channels per redundancy channel. Can be defined at build time.
  */
+#ifndef RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS
 #define RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS (2U)
+#endif
 
 /**
  * @brief Header size of a RedL PDU message [Bytes].
@@ -125,14 +276,48 @@
 #define RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE (RADEF_RED_LAYER_MESSAGE_HEADER_SIZE + RADEF_SR_LAYER_MESSAGE_HEADER_SIZE)
 
 /**
- * @brief Maximum size of a redundancy channel defer queue [messages].
+ * @brief Maximum size of a redundancy channel defer queue [messages]. Can be defined at build time.
  */
-#define RADEF_MAX_DEFER_QUEUE_SIZE (10U)
+#ifndef RADEF_MAX_DEFER_QUEUE_SIZE
+#define RADEF_MAX_DEFER_QUEUE_SIZE (64U)
+#endif
 
 /**
- * @brief Maximum RedL diagnosis window size (Ndiagnosis) [messages].
+ * @brief Defines the number of defer queue index positions, which are addressed by the sequence number of the messages [positions].
+ *
+ * Must be a power of two and at least ::RADEF_MAX_DEFER_QUEUE_SIZE. If it is at least ten times ::RADEF_MAX_DEFER_QUEUE_SIZE, the messages in the sequence
+ * number range accepted for the defer queue never share an index position. Can be defined at build time together with ::RADEF_MAX_DEFER_QUEUE_SIZE.
  */
+#ifndef RADEF_DEFER_QUEUE_INDEX_SIZE
+#define RADEF_DEFER_QUEUE_INDEX_SIZE (1024U)
+#endif
+
+/**
+ * @brief Maximum RedL diagnosis window size (Ndiagnosis) [messages]. Can be defined at build time to a smaller value.
+ */
+#ifndef RADEF_MAX_RED_LAYER_N_DIAGNOSIS
 #define RADEF_MAX_RED_LAYER_N_DIAGNOSIS (1000U)
+#endif
+
+/**
+ * @brief Number of messages of the ingress ring of every transport channel [messages].
+ *
+ * Only used, if the stack is built with transport ingress rings (CMake option RASTA_TRANSPORT_INGRESS_RINGS). Must be a power of two. Can be defined at build
+ * time.
+ */
+#ifndef RADEF_TRANSPORT_INGRESS_RING_SIZE
+#define RADEF_TRANSPORT_INGRESS_RING_SIZE (8U)
+#endif
+
+// -------------------- Runtime ------------------------------------------------
+/**
+ * @brief Maximum number of worker threads of the runtime [workers].
+ *
+ * More than one worker is only allowed, if the stack is built with ::RADEF_MULTI_THREADED. Can be defined at build time.
+ */
+#ifndef RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS
+#define RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS (1U)
+#endif
 
 // -----------------------------------------------------------------------------
 // Global Type Definitions
@@ -205,6 +390,12 @@ typedef struct {
    * @implementsReq{RASW-467} T drift2
    */
   uint32_t t_drift2;
+
+  /**
+   * @brief Ndropped [messages]. Number of messages which are dropped on this transport channel because its ingress ring was full. Only counted, if the stack
+   * is built with transport ingress rings (CMake option RASTA_TRANSPORT_INGRESS_RINGS), otherwise always 0. Full value range is valid and usable.
+   */
+  uint32_t n_dropped;
 } radef_TransportChannelDiagnosticData;
 
 // -----------------------------------------------------------------------------
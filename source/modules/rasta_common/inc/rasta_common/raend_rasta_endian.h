@@ -0,0 +1,143 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file raend_rasta_endian.h
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @addtogroup common_endian
+ * @{
+ *
+ * @brief Interface of the RaSTA endian codec.
+ *
+ * This module loads and stores the words of the RaSTA messages, which are transmitted in little endian byte order. A word is loaded or stored at once and
+ * only byte-swapped on big endian hosts. The byte order of the host is taken from the predefined macros of the compiler; if the compiler does not define the
+ * byte order, it must be defined with RAEND_HOST_BIG_ENDIAN (1 for big endian, 0 for little endian hosts).
+ *
+ * The codec functions are defined inline in this header, so that the encoding and decoding of a message header field compiles to a few instructions in the
+ * message modules. They do not check the data pointer, the callers pass the checked message buffers.
+ */
+#ifndef RAEND_RASTA_ENDIAN_H_
+#define RAEND_RASTA_ENDIAN_H_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <stdint.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// Global Macro Definitions
+// -----------------------------------------------------------------------------
+
+#ifndef RAEND_HOST_BIG_ENDIAN
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define RAEND_HOST_BIG_ENDIAN 1  ///< The host stores words in big endian byte order, the message words must be byte-swapped
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define RAEND_HOST_BIG_ENDIAN 0  ///< The host stores words in little endian byte order like the messages
+#else
+#error "The byte order of the host is unknown, define RAEND_HOST_BIG_ENDIAN as 1 for big endian or 0 for little endian hosts"
+#endif
+#endif
+
+// -----------------------------------------------------------------------------
+// Global Type Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Const Declarations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Load a little endian Uint16 word from a data buffer.
+ *
+ * The caller must check that the word is inside the buffer.
+ *
+ * @implementsReq{RASW-157} Endian Definition
+ *
+ * @param [in] data Pointer to the first byte of the word. The pointer must not be NULL.
+ * @return uint16_t Loaded word.
+ */
+static inline uint16_t raend_LoadUint16(const uint8_t* const data) {
+  uint16_t value = 0U;
+  (void)memcpy(&value, data, sizeof(value));
+#if RAEND_HOST_BIG_ENDIAN
+  value = (uint16_t)((value << 8U) | (value >> 8U));
+#endif
+  return value;
+}
+
+/**
+ * @brief Load a little endian Uint32 word from a data buffer.
+ *
+ * The caller must check that the word is inside the buffer.
+ *
+ * @implementsReq{RASW-157} Endian Definition
+ *
+ * @param [in] data Pointer to the first byte of the word. The pointer must not be NULL.
+ * @return uint32_t Loaded word.
+ */
+static inline uint32_t raend_LoadUint32(const uint8_t* const data) {
+  uint32_t value = 0U;
+  (void)memcpy(&value, data, sizeof(value));
+#if RAEND_HOST_BIG_ENDIAN
+  value = (value << 24U) | ((value << 8U) & 0x00FF0000U) | ((value >> 8U) & 0x0000FF00U) | (value >> 24U);
+#endif
+  return value;
+}
+
+/**
+ * @brief Store a Uint16 word in little endian byte order in a data buffer.
+ *
+ * The caller must check that the word is inside the buffer.
+ *
+ * @implementsReq{RASW-157} Endian Definition
+ *
+ * @param [in] data Pointer to the first byte of the word. The pointer must not be NULL.
+ * @param [in] value Word to store. The full value range is valid and usable.
+ */
+static inline void raend_StoreUint16(uint8_t* const data, const uint16_t value) {
+#if RAEND_HOST_BIG_ENDIAN
+  const uint16_t kLittleEndianValue = (uint16_t)((value << 8U) | (value >> 8U));
+#else
+  const uint16_t kLittleEndianValue = value;
+#endif
+  (void)memcpy(data, &kLittleEndianValue, sizeof(kLittleEndianValue));
+}
+
+/**
+ * @brief Store a Uint32 word in little endian byte order in a data buffer.
+ *
+ * The caller must check that the word is inside the buffer.
+ *
+ * @implementsReq{RASW-157} Endian Definition
+ *
+ * @param [in] data Pointer to the first byte of the word. The pointer must not be NULL.
+ * @param [in] value Word to store. The full value range is valid and usable.
+ */
+static inline void raend_StoreUint32(uint8_t* const data, const uint32_t value) {
+#if RAEND_HOST_BIG_ENDIAN
+  const uint32_t kLittleEndianValue = (value << 24U) | ((value << 8U) & 0x00FF0000U) | ((value >> 8U) & 0x0000FF00U) | (value >> 24U);
+#else
+  const uint32_t kLittleEndianValue = value;
+#endif
+  (void)memcpy(data, &kLittleEndianValue, sizeof(kLittleEndianValue));
+}
+
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+#endif  // RAEND_RASTA_ENDIAN_H_
@@ -0,0 +1,191 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file raslb_rasta_slab.h
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @addtogroup common_slab
+ * @{
+ *
+ * @brief Interface of the RaSTA message slab.
+ *
+ * This module provides a fixed-capacity memory pool for messages and message payloads, which is shared by all RaSTA connections. The pool is split into size
+ * classes at the initialization. Every size class consists of a number of chunks with the same size. A chunk is allocated from the smallest size class which
+ * can hold the requested size and is referenced by a chunk handle. Allocating and freeing a chunk has a constant execution time.
+ */
+#ifndef RASLB_RASTA_SLAB_H_
+#define RASLB_RASTA_SLAB_H_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rasta_common/radef_rasta_definitions.h"
+
+// -----------------------------------------------------------------------------
+// Global Macro Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Chunk handle, which does not reference a chunk.
+ */
+#define RASLB_INVALID_CHUNK_HANDLE (0xFFFFU)
+
+// The chunk handles are uint16_t values, so that every chunk must have a handle below RASLB_INVALID_CHUNK_HANDLE. The check is done in the header, so that
+// every module which sizes its storage with the slab definitions fails to compile, and not only the slab itself.
+#if (RADEF_SLAB_MAX_NUMBER_OF_CHUNKS == 0U) || (RADEF_SLAB_MAX_NUMBER_OF_CHUNKS >= RASLB_INVALID_CHUNK_HANDLE)
+#error "RADEF_SLAB_MAX_NUMBER_OF_CHUNKS must be greater than 0 and smaller than RASLB_INVALID_CHUNK_HANDLE, define RADEF_SLAB_NUMBER_OF_LARGE_CHUNKS to limit it"
+#endif
+
+// -----------------------------------------------------------------------------
+// Global Type Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Struct for the configuration of a size class of the slab.
+ */
+typedef struct {
+  uint16_t chunk_size;        ///< Size of the chunks of this size class [bytes]. Valid range: 1 <= value <= ::RADEF_SLAB_LARGE_CHUNK_SIZE.
+  uint16_t number_of_chunks;  ///< Number of chunks of this size class [chunks]. Valid range: 0 <= value <= ::RADEF_SLAB_MAX_NUMBER_OF_CHUNKS.
+} raslb_SizeClassConfiguration;
+
+/**
+ * @brief Struct for the configuration of the slab.
+ *
+ * The sum of the chunks of all size classes must not exceed ::RADEF_SLAB_MAX_NUMBER_OF_CHUNKS and the sum of their memory must not exceed
+ * ::RADEF_SLAB_POOL_SIZE.
+ */
+typedef struct {
+  uint16_t number_of_size_classes;  ///< Number of used size classes. Valid range: 1 <= value <= ::RADEF_SLAB_MAX_NUMBER_OF_SIZE_CLASSES.
+  raslb_SizeClassConfiguration
+      size_classes[RADEF_SLAB_MAX_NUMBER_OF_SIZE_CLASSES];  ///< Configuration of the size classes, sorted by strictly ascending chunk size.
+} raslb_SlabConfiguration;
+
+/**
+ * @brief Struct for a size class of the slab.
+ *
+ * The chunks of a size class have consecutive chunk handles starting from first_chunk. The free chunk stack of a size class uses the same range of entries in
+ * ::raslb_InstanceData::free_chunk_stack.
+ */
+typedef struct {
+  uint16_t chunk_size;        ///< Size of the chunks [bytes]
+  uint16_t first_chunk;       ///< Handle of the first chunk of this size class
+  uint16_t number_of_chunks;  ///< Number of chunks of this size class
+  uint16_t free_chunks;       ///< Number of free chunks of this size class
+  uint32_t pool_offset;       ///< Offset of the first chunk in the memory pool [bytes]
+} raslb_SizeClass;
+
+/**
+ * @brief Struct for the data of a message slab instance.
+ */
+typedef struct {
+  bool initialized;                                                     ///< Initialization state of the module. true, if the module is initialized.
+  uint16_t number_of_size_classes;                                      ///< Number of configured size classes.
+  raslb_SizeClass size_classes[RADEF_SLAB_MAX_NUMBER_OF_SIZE_CLASSES];  ///< Size classes of the slab.
+  uint16_t free_chunk_stack[RADEF_SLAB_MAX_NUMBER_OF_CHUNKS];           ///< Free chunk stacks of all size classes.
+  bool chunk_allocated[RADEF_SLAB_MAX_NUMBER_OF_CHUNKS];                ///< Allocation state of all chunks. true, if the chunk is allocated.
+  uint8_t pool[RADEF_SLAB_POOL_SIZE];                                   ///< Memory pool with the chunks of all size classes.
+} raslb_InstanceData;
+
+// -----------------------------------------------------------------------------
+// Global Const Declarations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Prototypes
+// -----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Initialize the slab.
+ *
+ * This function splits the memory pool into the configured size classes and frees all chunks.
+ *
+ * @pre The slab must not be initialized, otherwise a ::radef_kAlreadyInitialized fatal error is thrown.
+ *
+ * @param [in] slab_configuration Pointer to the slab configuration. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown. If the
+ * configuration is not valid, a ::radef_kInvalidConfiguration fatal error is thrown.
+ */
+void raslb_Init(const raslb_SlabConfiguration* const slab_configuration);
+
+/**
+ * @brief Select the message slab instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the message slab functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_SR_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void raslb_SelectInstance(const uint32_t instance_index);
+
+/**
+ * @brief Allocate a chunk.
+ *
+ * This function allocates a free chunk of the smallest size class, which can hold the requested size. If all chunks which can hold the requested size are
+ * allocated, no chunk is allocated.
+ *
+ * @pre The slab must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [in] size Requested size [bytes]. Valid range: 1 <= value <= ::RADEF_SLAB_LARGE_CHUNK_SIZE.
+ * @param [out] chunk_handle Pointer to the handle of the allocated chunk. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return true -> chunk allocated
+ * @return false -> no free chunk for the requested size
+ */
+bool raslb_AllocateChunk(const uint16_t size, uint16_t* const chunk_handle);
+
+/**
+ * @brief Free an allocated chunk.
+ *
+ * @pre The slab must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [in] chunk_handle Handle of an allocated chunk. For any other value a ::radef_kInvalidParameter fatal error is thrown.
+ */
+void raslb_FreeChunk(const uint16_t chunk_handle);
+
+/**
+ * @brief Get the memory of an allocated chunk.
+ *
+ * @pre The slab must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [in] chunk_handle Handle of an allocated chunk. For any other value a ::radef_kInvalidParameter fatal error is thrown.
+ * @return Pointer to the memory of the chunk. The memory has the size returned by ::raslb_GetChunkSize.
+ */
+uint8_t* raslb_GetChunkData(const uint16_t chunk_handle);
+
+/**
+ * @brief Get the size of an allocated chunk.
+ *
+ * @pre The slab must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [in] chunk_handle Handle of an allocated chunk. For any other value a ::radef_kInvalidParameter fatal error is thrown.
+ * @return Size of the chunk [bytes]
+ */
+uint16_t raslb_GetChunkSize(const uint16_t chunk_handle);
+
+/**
+ * @brief Get the number of free chunks for a requested size.
+ *
+ * This function returns the number of free chunks of all size classes, which can hold the requested size.
+ *
+ * @pre The slab must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [in] size Requested size [bytes]. Valid range: 1 <= value <= ::RADEF_SLAB_LARGE_CHUNK_SIZE.
+ * @return Number of free chunks [chunks]
+ */
+uint16_t raslb_GetNumberOfFreeChunks(const uint16_t size);
+
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+#endif  // RASLB_RASTA_SLAB_H_
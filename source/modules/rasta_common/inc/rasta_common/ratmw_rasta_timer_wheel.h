@@ -0,0 +1,170 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file ratmw_rasta_timer_wheel.h
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @addtogroup common_timerWheel
+ * @{
+ *
+ * @brief Interface of the RaSTA timer wheel.
+ *
+ * This module provides a hierarchical timer wheel for the protocol timers of the RaSTA layers. A timer wheel manages a fixed number of timers, which are
+ * identified by their timer id and stored in a timer array provided by the user of the timer wheel. The wheel has ::RATMW_NUMBER_OF_LEVELS levels with
+ * ::RATMW_SLOTS_PER_LEVEL slots each, so that every level covers one byte of the 32 bit timer value. A running timer is kept in the slot of the highest byte in
+ * which its deadline differs from the time of the wheel and is moved to a lower level, when the time of the wheel reaches this slot.
+ *
+ * Starting and stopping a timer has a constant execution time. Advancing the time of the wheel only visits the slots of expiring timers, so that the
+ * execution time depends on the number of expiring timers and not on the number of running timers. The time of the wheel is advanced with the current time
+ * passed to the functions of this module. The current time must be passed at least every 2^31 - 1 ms, a current time which lies before the time of the wheel
+ * is ignored.
+ */
+#ifndef RATMW_RASTA_TIMER_WHEEL_H_
+#define RATMW_RASTA_TIMER_WHEEL_H_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Global Macro Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Number of levels of a timer wheel.
+ */
+#define RATMW_NUMBER_OF_LEVELS (4U)
+
+/**
+ * @brief Number of slots per level of a timer wheel.
+ */
+#define RATMW_SLOTS_PER_LEVEL (256U)
+
+/**
+ * @brief Maximum delay of a timer [ms].
+ */
+#define RATMW_MAX_DELAY (0x7FFFFFFFU)
+
+/**
+ * @brief Timer id, which does not reference a timer.
+ */
+#define RATMW_NO_TIMER (0xFFFFU)
+
+// -----------------------------------------------------------------------------
+// Global Type Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Struct for a timer of a timer wheel.
+ *
+ * The members of this struct are managed by the timer wheel and must not be accessed by the user of the timer wheel.
+ */
+typedef struct {
+  uint32_t deadline;  ///< Time at which the timer expires [ms]
+  uint16_t list;      ///< List of the timer wheel, which holds the timer. Slot index, expired list or no list if the timer is not running.
+  uint16_t next;      ///< Id of the next timer in the same list. ::RATMW_NO_TIMER for the last timer of the list.
+  uint16_t previous;  ///< Id of the previous timer in the same list. ::RATMW_NO_TIMER for the first timer of the list.
+} ratmw_Timer;
+
+/**
+ * @brief Struct for a timer wheel.
+ *
+ * The members of this struct are managed by the timer wheel and must not be accessed by the user of the timer wheel.
+ */
+typedef struct {
+  ratmw_Timer* timers;        ///< Pointer to the timer array of the timer wheel
+  uint16_t number_of_timers;  ///< Number of timers in the timer array
+  uint32_t current_time;      ///< Time of the timer wheel [ms]
+  uint16_t slots[RATMW_NUMBER_OF_LEVELS * RATMW_SLOTS_PER_LEVEL];  ///< Id of the first timer of every slot. ::RATMW_NO_TIMER for an empty slot.
+  uint16_t level_timers[RATMW_NUMBER_OF_LEVELS];                   ///< Number of timers in the slots of every level
+  uint16_t expired_timers;                                         ///< Id of the first expired timer. ::RATMW_NO_TIMER if no timer is expired.
+} ratmw_TimerWheel;
+
+// -----------------------------------------------------------------------------
+// Global Const Declarations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Prototypes
+// -----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Initialize a timer wheel.
+ *
+ * This function assigns the timer array to the timer wheel and stops all timers. The time of the wheel is set to the current time passed with the next call,
+ * which starts a timer.
+ *
+ * @param [in] timer_wheel Pointer to the timer wheel. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] timers Pointer to the timer array with number_of_timers entries. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] number_of_timers Number of timers in the timer array. Valid range: 1 <= value < ::RATMW_NO_TIMER.
+ */
+void ratmw_Init(ratmw_TimerWheel* const timer_wheel, ratmw_Timer* const timers, const uint16_t number_of_timers);
+
+/**
+ * @brief Start a timer.
+ *
+ * This function advances the time of the wheel to the current time and starts the timer with a deadline of current time + delay. A running timer is
+ * restarted. A timer started with a delay of 0 is expired immediately.
+ *
+ * @param [in] timer_wheel Pointer to an initialized timer wheel. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] timer_id Id of the timer. Valid range: 0 <= value < number of timers of the timer wheel.
+ * @param [in] current_time Current time [ms]. Full value range is valid and usable.
+ * @param [in] delay Delay until the timer expires [ms]. Valid range: 0 <= value <= ::RATMW_MAX_DELAY.
+ */
+void ratmw_StartTimer(ratmw_TimerWheel* const timer_wheel, const uint16_t timer_id, const uint32_t current_time, const uint32_t delay);
+
+/**
+ * @brief Stop a timer.
+ *
+ * This function stops a running or expired timer. Stopping a timer, which is not running, has no effect.
+ *
+ * @param [in] timer_wheel Pointer to an initialized timer wheel. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] timer_id Id of the timer. Valid range: 0 <= value < number of timers of the timer wheel.
+ */
+void ratmw_StopTimer(ratmw_TimerWheel* const timer_wheel, const uint16_t timer_id);
+
+/**
+ * @brief Get an expired timer.
+ *
+ * This function advances the time of the wheel to the current time and returns the id of an expired timer. The returned timer is stopped, so that every
+ * expiry of a timer is returned only once.
+ *
+ * @param [in] timer_wheel Pointer to an initialized timer wheel. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] current_time Current time [ms]. Full value range is valid and usable.
+ * @param [out] timer_id Pointer to the id of the expired timer. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return true -> an expired timer is returned
+ * @return false -> no timer is expired
+ */
+bool ratmw_GetExpiredTimer(ratmw_TimerWheel* const timer_wheel, const uint32_t current_time, uint16_t* const timer_id);
+
+/**
+ * @brief Get the time until the next deadline of a timer.
+ *
+ * This function advances the time of the wheel to the current time and returns the time until the earliest deadline of all running timers. If a timer is
+ * expired, the time until the next deadline is 0.
+ *
+ * @param [in] timer_wheel Pointer to an initialized timer wheel. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] current_time Current time [ms]. Full value range is valid and usable.
+ * @param [out] time_to_next_deadline Pointer to the time until the next deadline [ms]. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is
+ * thrown.
+ * @return true -> a timer is running or expired and the time until its deadline is returned
+ * @return false -> no timer is running
+ */
+bool ratmw_GetTimeToNextDeadline(ratmw_TimerWheel* const timer_wheel, const uint32_t current_time, uint32_t* const time_to_next_deadline);
+
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+#endif  // RATMW_RASTA_TIMER_WHEEL_H_
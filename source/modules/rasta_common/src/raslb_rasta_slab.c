@@ -0,0 +1,219 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file raslb_rasta_slab.c
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Implementation of the RaSTA message slab.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "rasta_common/raslb_rasta_slab.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rasta_common/raas_rasta_assert.h"
+#include "rasta_common/radef_rasta_definitions.h"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Data of all message slab instances.
+ */
+PRIVATE raslb_InstanceData raslb_instances[RADEF_MAX_NUMBER_OF_SR_INSTANCES];
+
+/**
+ * @brief Data of the selected message slab instance.
+ */
+PRIVATE RADEF_THREAD_LOCAL raslb_InstanceData* raslb_instance = &raslb_instances[0];
+
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+/** @addtogroup common_slab
+ * @{
+ */
+
+/**
+ * @brief Get the size class of an allocated chunk.
+ *
+ * This internal function checks the chunk handle and returns the index of the size class the chunk belongs to. If the chunk handle does not reference an
+ * allocated chunk, a ::radef_kInvalidParameter fatal error is thrown.
+ *
+ * @param [in] chunk_handle Handle of an allocated chunk.
+ * @return Index of the size class of the chunk.
+ */
+static uint16_t GetSizeClassOfAllocatedChunk(const uint16_t chunk_handle);
+
+/** @}*/
+
+// -----------------------------------------------------------------------------
+// Local Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+
+void raslb_Init(const raslb_SlabConfiguration* const slab_configuration) {
+  // Input parameter check
+  raas_AssertTrue(!raslb_instance->initialized, radef_kAlreadyInitialized);
+  raas_AssertNotNull(slab_configuration, radef_kInvalidParameter);
+  raas_AssertU16InRange(slab_configuration->number_of_size_classes, 1U, RADEF_SLAB_MAX_NUMBER_OF_SIZE_CLASSES, radef_kInvalidConfiguration);
+
+  uint32_t number_of_chunks = 0U;
+  uint32_t pool_offset = 0U;
+  uint16_t min_chunk_size = 1U;
+
+  for (uint16_t class_index = 0U; class_index < slab_configuration->number_of_size_classes; ++class_index) {
+    const raslb_SizeClassConfiguration* const kClassConfiguration = &slab_configuration->size_classes[class_index];
+
+    // The chunk sizes must be strictly ascending, so that the smallest size class for a requested size is found first
+    raas_AssertU16InRange(kClassConfiguration->chunk_size, min_chunk_size, RADEF_SLAB_LARGE_CHUNK_SIZE, radef_kInvalidConfiguration);
+    min_chunk_size = (uint16_t)(kClassConfiguration->chunk_size + 1U);
+
+    raslb_instance->size_classes[class_index].chunk_size = kClassConfiguration->chunk_size;
+    raslb_instance->size_classes[class_index].first_chunk = (uint16_t)number_of_chunks;
+    raslb_instance->size_classes[class_index].number_of_chunks = kClassConfiguration->number_of_chunks;
+    raslb_instance->size_classes[class_index].free_chunks = kClassConfiguration->number_of_chunks;
+    raslb_instance->size_classes[class_index].pool_offset = pool_offset;
+
+    number_of_chunks += kClassConfiguration->number_of_chunks;
+    pool_offset += (uint32_t)kClassConfiguration->number_of_chunks * kClassConfiguration->chunk_size;
+
+    raas_AssertTrue(number_of_chunks <= RADEF_SLAB_MAX_NUMBER_OF_CHUNKS, radef_kInvalidConfiguration);
+    raas_AssertTrue(pool_offset <= RADEF_SLAB_POOL_SIZE, radef_kInvalidConfiguration);
+
+    // Fill the free chunk stack of this size class
+    for (uint16_t index = 0U; index < kClassConfiguration->number_of_chunks; ++index) {
+      const uint16_t kChunkHandle = (uint16_t)(raslb_instance->size_classes[class_index].first_chunk + index);
+      raslb_instance->free_chunk_stack[kChunkHandle] = kChunkHandle;
+      raslb_instance->chunk_allocated[kChunkHandle] = false;
+    }
+  }
+
+  raslb_instance->number_of_size_classes = slab_configuration->number_of_size_classes;
+  raslb_instance->initialized = true;
+}
+
+void raslb_SelectInstance(const uint32_t instance_index) {
+  // Input parameter check
+  raas_AssertU32InRange(instance_index, 0U, RADEF_MAX_NUMBER_OF_SR_INSTANCES - 1U, radef_kInvalidParameter);
+
+  raslb_instance = &raslb_instances[instance_index];
+}
+
+bool raslb_AllocateChunk(const uint16_t size, uint16_t* const chunk_handle) {
+  // Input parameter check
+  raas_AssertTrue(raslb_instance->initialized, radef_kNotInitialized);
+  raas_AssertU16InRange(size, 1U, RADEF_SLAB_LARGE_CHUNK_SIZE, radef_kInvalidParameter);
+  raas_AssertNotNull(chunk_handle, radef_kInvalidParameter);
+
+  bool chunk_allocated = false;
+
+  for (uint16_t class_index = 0U; class_index < raslb_instance->number_of_size_classes; ++class_index) {
+    raslb_SizeClass* const size_class = &raslb_instance->size_classes[class_index];
+
+    if ((size_class->chunk_size >= size) && (size_class->free_chunks > 0U)) {
+      // Take the chunk from the top of the free chunk stack of this size class
+      --size_class->free_chunks;
+      *chunk_handle = raslb_instance->free_chunk_stack[size_class->first_chunk + size_class->free_chunks];
+      raslb_instance->chunk_allocated[*chunk_handle] = true;
+
+      chunk_allocated = true;
+      break;  // End for-loop when a chunk is allocated
+    }
+  }
+
+  return chunk_allocated;
+}
+
+void raslb_FreeChunk(const uint16_t chunk_handle) {
+  // Input parameter check
+  raas_AssertTrue(raslb_instance->initialized, radef_kNotInitialized);
+
+  raslb_SizeClass* const size_class = &raslb_instance->size_classes[GetSizeClassOfAllocatedChunk(chunk_handle)];
+  raas_AssertTrue(size_class->free_chunks < size_class->number_of_chunks, radef_kInternalError);
+
+  // Put the chunk back on the free chunk stack of its size class
+  raslb_instance->free_chunk_stack[size_class->first_chunk + size_class->free_chunks] = chunk_handle;
+  ++size_class->free_chunks;
+  raslb_instance->chunk_allocated[chunk_handle] = false;
+}
+
+uint8_t* raslb_GetChunkData(const uint16_t chunk_handle) {
+  // Input parameter check
+  raas_AssertTrue(raslb_instance->initialized, radef_kNotInitialized);
+
+  const raslb_SizeClass* const kSizeClass = &raslb_instance->size_classes[GetSizeClassOfAllocatedChunk(chunk_handle)];
+
+  return &raslb_instance->pool[kSizeClass->pool_offset + ((uint32_t)(chunk_handle - kSizeClass->first_chunk) * kSizeClass->chunk_size)];
+}
+
+uint16_t raslb_GetChunkSize(const uint16_t chunk_handle) {
+  // Input parameter check
+  raas_AssertTrue(raslb_instance->initialized, radef_kNotInitialized);
+
+  return raslb_instance->size_classes[GetSizeClassOfAllocatedChunk(chunk_handle)].chunk_size;
+}
+
+uint16_t raslb_GetNumberOfFreeChunks(const uint16_t size) {
+  // Input parameter check
+  raas_AssertTrue(raslb_instance->initialized, radef_kNotInitialized);
+  raas_AssertU16InRange(size, 1U, RADEF_SLAB_LARGE_CHUNK_SIZE, radef_kInvalidParameter);
+
+  uint16_t free_chunks = 0U;
+
+  for (uint16_t class_index = 0U; class_index < raslb_instance->number_of_size_classes; ++class_index) {
+    if (raslb_instance->size_classes[class_index].chunk_size >= size) {
+      free_chunks += raslb_instance->size_classes[class_index].free_chunks;
+    }
+  }
+
+  return free_chunks;
+}
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
+
+static uint16_t GetSizeClassOfAllocatedChunk(const uint16_t chunk_handle) {
+  uint16_t size_class_index = raslb_instance->number_of_size_classes;
+
+  for (uint16_t class_index = 0U; class_index < raslb_instance->number_of_size_classes; ++class_index) {
+    const uint16_t kFirstChunk = raslb_instance->size_classes[class_index].first_chunk;
+
+    if ((chunk_handle >= kFirstChunk) && ((uint32_t)(chunk_handle - kFirstChunk) < raslb_instance->size_classes[class_index].number_of_chunks)) {
+      size_class_index = class_index;
+      break;  // End for-loop when the size class is found
+    }
+  }
+
+  raas_AssertTrue(size_class_index < raslb_instance->number_of_size_classes, radef_kInvalidParameter);
+  raas_AssertTrue(raslb_instance->chunk_allocated[chunk_handle], radef_kInvalidParameter);
+
+  return size_class_index;
+}
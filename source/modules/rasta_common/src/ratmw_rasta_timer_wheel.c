@@ -0,0 +1,355 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file ratmw_rasta_timer_wheel.c
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Implementation of the RaSTA timer wheel.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "rasta_common/ratmw_rasta_timer_wheel.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rasta_common/raas_rasta_assert.h"
+#include "rasta_common/radef_rasta_definitions.h"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+#if (RATMW_NUMBER_OF_LEVELS != 4U) || (RATMW_SLOTS_PER_LEVEL != 256U)
+#error "The levels of the timer wheel must cover the 32 bit timer value with one byte per level"
+#endif
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+/** @addtogroup common_timerWheel
+ * @{
+ */
+
+/**
+ * @brief Add a timer to a list of the timer wheel.
+ *
+ * This internal function adds the timer at the head of a slot list or of the expired list.
+ *
+ * @param [in] timer_wheel Pointer to the timer wheel.
+ * @param [in] timer_id Id of a timer, which is not in a list.
+ * @param [in] list Slot index or ::kExpiredList.
+ */
+static void AddTimerToList(ratmw_TimerWheel* const timer_wheel, const uint16_t timer_id, const uint16_t list);
+
+/**
+ * @brief Remove a timer from its list of the timer wheel.
+ *
+ * This internal function removes the timer from its slot list or from the expired list. A timer, which is not in a list, is not changed.
+ *
+ * @param [in] timer_wheel Pointer to the timer wheel.
+ * @param [in] timer_id Id of the timer.
+ */
+static void RemoveTimerFromList(ratmw_TimerWheel* const timer_wheel, const uint16_t timer_id);
+
+/**
+ * @brief Place a timer according to its deadline.
+ *
+ * This internal function adds the timer to the slot of the highest byte in which its deadline differs from the time of the wheel. If the deadline is reached,
+ * the timer is added to the expired list.
+ *
+ * @param [in] timer_wheel Pointer to the timer wheel.
+ * @param [in] timer_id Id of a timer, which is not in a list.
+ */
+static void PlaceTimer(ratmw_TimerWheel* const timer_wheel, const uint16_t timer_id);
+
+/**
+ * @brief Get the next slot, which the time of the wheel reaches.
+ *
+ * This internal function searches the first non-empty slot after the time of the wheel on the lowest level with running timers. The timers of lower levels
+ * always reach their slot before the timers of higher levels.
+ *
+ * @param [in] timer_wheel Pointer to the timer wheel.
+ * @param [out] slot Index of the next slot.
+ * @param [out] slot_time Time at which the time of the wheel reaches the next slot [ms].
+ * @return true -> a timer is running and the next slot is returned
+ * @return false -> no timer is running
+ */
+static bool GetNextSlot(const ratmw_TimerWheel* const timer_wheel, uint16_t* const slot, uint32_t* const slot_time);
+
+/**
+ * @brief Advance the time of the wheel.
+ *
+ * This internal function advances the time of the wheel slot by slot to the current time. The timers of every reached slot are placed again, so that they move
+ * to a lower level or to the expired list. If no timer is running, the time of the wheel is set to the current time. Otherwise a current time, which lies
+ * before the time of the wheel, is ignored.
+ *
+ * @param [in] timer_wheel Pointer to the timer wheel.
+ * @param [in] current_time Current time [ms].
+ */
+static void AdvanceTime(ratmw_TimerWheel* const timer_wheel, const uint32_t current_time);
+
+/** @}*/
+
+// -----------------------------------------------------------------------------
+// Local Constant Definitions
+// -----------------------------------------------------------------------------
+
+static const uint16_t kExpiredList = (uint16_t)(RATMW_NUMBER_OF_LEVELS * RATMW_SLOTS_PER_LEVEL);  ///< List of the expired timers
+static const uint16_t kNoList = (uint16_t)((RATMW_NUMBER_OF_LEVELS * RATMW_SLOTS_PER_LEVEL) + 1U);  ///< List of a timer, which is not running
+static const uint32_t kBitsPerLevel = 8U;                                                           ///< Number of timer value bits covered by a level
+static const uint32_t kSlotMask = RATMW_SLOTS_PER_LEVEL - 1U;                                       ///< Mask for the slot of a level
+
+// -----------------------------------------------------------------------------
+// Global Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+
+void ratmw_Init(ratmw_TimerWheel* const timer_wheel, ratmw_Timer* const timers, const uint16_t number_of_timers) {
+  // Input parameter check
+  raas_AssertNotNull(timer_wheel, radef_kInvalidParameter);
+  raas_AssertNotNull(timers, radef_kInvalidParameter);
+  raas_AssertU16InRange(number_of_timers, 1U, RATMW_NO_TIMER - 1U, radef_kInvalidParameter);
+
+  timer_wheel->timers = timers;
+  timer_wheel->number_of_timers = number_of_timers;
+  timer_wheel->current_time = 0U;
+
+  for (uint16_t slot = 0U; slot < kExpiredList; ++slot) {
+    timer_wheel->slots[slot] = RATMW_NO_TIMER;
+  }
+  for (uint16_t level = 0U; level < RATMW_NUMBER_OF_LEVELS; ++level) {
+    timer_wheel->level_timers[level] = 0U;
+  }
+  timer_wheel->expired_timers = RATMW_NO_TIMER;
+
+  for (uint16_t timer_id = 0U; timer_id < number_of_timers; ++timer_id) {
+    timers[timer_id].deadline = 0U;
+    timers[timer_id].list = kNoList;
+    timers[timer_id].next = RATMW_NO_TIMER;
+    timers[timer_id].previous = RATMW_NO_TIMER;
+  }
+}
+
+void ratmw_StartTimer(ratmw_TimerWheel* const timer_wheel, const uint16_t timer_id, const uint32_t current_time, const uint32_t delay) {
+  // Input parameter check
+  raas_AssertNotNull(timer_wheel, radef_kInvalidParameter);
+  raas_AssertTrue(timer_id < timer_wheel->number_of_timers, radef_kInvalidParameter);
+  raas_AssertU32InRange(delay, 0U, RATMW_MAX_DELAY, radef_kInvalidParameter);
+
+  // Stop the timer before advancing the time, so that a restarted timer does not expire with its old deadline
+  RemoveTimerFromList(timer_wheel, timer_id);
+  AdvanceTime(timer_wheel, current_time);
+
+  timer_wheel->timers[timer_id].deadline = current_time + delay;  // Unsigned integer wrap around allowed here
+  if (delay == 0U) {
+    AddTimerToList(timer_wheel, timer_id, kExpiredList);
+  } else {
+    PlaceTimer(timer_wheel, timer_id);
+  }
+}
+
+void ratmw_StopTimer(ratmw_TimerWheel* const timer_wheel, const uint16_t timer_id) {
+  // Input parameter check
+  raas_AssertNotNull(timer_wheel, radef_kInvalidParameter);
+  raas_AssertTrue(timer_id < timer_wheel->number_of_timers, radef_kInvalidParameter);
+
+  RemoveTimerFromList(timer_wheel, timer_id);
+}
+
+bool ratmw_GetExpiredTimer(ratmw_TimerWheel* const timer_wheel, const uint32_t current_time, uint16_t* const timer_id) {
+  // Input parameter check
+  raas_AssertNotNull(timer_wheel, radef_kInvalidParameter);
+  raas_AssertNotNull(timer_id, radef_kInvalidParameter);
+
+  bool timer_expired = false;
+
+  AdvanceTime(timer_wheel, current_time);
+
+  if (timer_wheel->expired_timers != RATMW_NO_TIMER) {
+    *timer_id = timer_wheel->expired_timers;
+    RemoveTimerFromList(timer_wheel, *timer_id);
+    timer_expired = true;
+  }
+
+  return timer_expired;
+}
+
+bool ratmw_GetTimeToNextDeadline(ratmw_TimerWheel* const timer_wheel, const uint32_t current_time, uint32_t* const time_to_next_deadline) {
+  // Input parameter check
+  raas_AssertNotNull(timer_wheel, radef_kInvalidParameter);
+  raas_AssertNotNull(time_to_next_deadline, radef_kInvalidParameter);
+
+  bool timer_running = true;
+  uint16_t slot = 0U;
+  uint32_t slot_time = 0U;
+
+  AdvanceTime(timer_wheel, current_time);
+
+  if (timer_wheel->expired_timers != RATMW_NO_TIMER) {
+    *time_to_next_deadline = 0U;
+  } else if (GetNextSlot(timer_wheel, &slot, &slot_time)) {
+    // The timers of the next slot have the earliest deadlines, on level 0 all of them expire at the time of the slot
+    uint32_t next_deadline = slot_time;
+    if (slot >= RATMW_SLOTS_PER_LEVEL) {
+      uint32_t min_time_to_deadline = UINT32_MAX;
+      for (uint16_t timer_id = timer_wheel->slots[slot]; timer_id != RATMW_NO_TIMER; timer_id = timer_wheel->timers[timer_id].next) {
+        const uint32_t kTimeToDeadline = timer_wheel->timers[timer_id].deadline - timer_wheel->current_time;  // Unsigned integer wrap around allowed here
+        if (kTimeToDeadline < min_time_to_deadline) {
+          min_time_to_deadline = kTimeToDeadline;
+        }
+      }
+      next_deadline = timer_wheel->current_time + min_time_to_deadline;  // Unsigned integer wrap around allowed here
+    }
+    *time_to_next_deadline = next_deadline - current_time;  // Unsigned integer wrap around allowed here
+  } else {
+    timer_running = false;
+  }
+
+  return timer_running;
+}
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
+
+static void AddTimerToList(ratmw_TimerWheel* const timer_wheel, const uint16_t timer_id, const uint16_t list) {
+  ratmw_Timer* const timer = &timer_wheel->timers[timer_id];
+  uint16_t* list_head = &timer_wheel->expired_timers;
+
+  if (list < kExpiredList) {
+    list_head = &timer_wheel->slots[list];
+    ++timer_wheel->level_timers[list / RATMW_SLOTS_PER_LEVEL];
+  }
+
+  timer->list = list;
+  timer->previous = RATMW_NO_TIMER;
+  timer->next = *list_head;
+  if (*list_head != RATMW_NO_TIMER) {
+    timer_wheel->timers[*list_head].previous = timer_id;
+  }
+  *list_head = timer_id;
+}
+
+static void RemoveTimerFromList(ratmw_TimerWheel* const timer_wheel, const uint16_t timer_id) {
+  ratmw_Timer* const timer = &timer_wheel->timers[timer_id];
+
+  if (timer->list != kNoList) {
+    uint16_t* list_head = &timer_wheel->expired_timers;
+    if (timer->list < kExpiredList) {
+      list_head = &timer_wheel->slots[timer->list];
+      --timer_wheel->level_timers[timer->list / RATMW_SLOTS_PER_LEVEL];
+    }
+
+    if (timer->previous == RATMW_NO_TIMER) {
+      *list_head = timer->next;
+    } else {
+      timer_wheel->timers[timer->previous].next = timer->next;
+    }
+    if (timer->next != RATMW_NO_TIMER) {
+      timer_wheel->timers[timer->next].previous = timer->previous;
+    }
+
+    timer->list = kNoList;
+    timer->next = RATMW_NO_TIMER;
+    timer->previous = RATMW_NO_TIMER;
+  }
+}
+
+static void PlaceTimer(ratmw_TimerWheel* const timer_wheel, const uint16_t timer_id) {
+  const uint32_t kDeadline = timer_wheel->timers[timer_id].deadline;
+  const uint32_t kTimeToDeadline = kDeadline - timer_wheel->current_time;  // Unsigned integer wrap around allowed here
+
+  if ((kTimeToDeadline == 0U) || (kTimeToDeadline > RATMW_MAX_DELAY)) {
+    // Deadline reached or passed
+    AddTimerToList(timer_wheel, timer_id, kExpiredList);
+  } else {
+    // Level of the highest byte in which the deadline differs from the time of the wheel
+    const uint32_t kDifferentBits = kDeadline ^ timer_wheel->current_time;
+    uint32_t level = RATMW_NUMBER_OF_LEVELS - 1U;
+    while ((level > 0U) && ((kDifferentBits >> (level * kBitsPerLevel)) == 0U)) {
+      --level;
+    }
+
+    AddTimerToList(timer_wheel, timer_id, (uint16_t)((level * RATMW_SLOTS_PER_LEVEL) + ((kDeadline >> (level * kBitsPerLevel)) & kSlotMask)));
+  }
+}
+
+static bool GetNextSlot(const ratmw_TimerWheel* const timer_wheel, uint16_t* const slot, uint32_t* const slot_time) {
+  bool slot_found = false;
+
+  for (uint32_t level = 0U; (level < RATMW_NUMBER_OF_LEVELS) && !slot_found; ++level) {
+    if (timer_wheel->level_timers[level] > 0U) {
+      const uint32_t kShift = level * kBitsPerLevel;
+      const uint32_t kCurrentSlot = (timer_wheel->current_time >> kShift) & kSlotMask;
+      const uint32_t kLevelStartTime = (timer_wheel->current_time >> kShift) << kShift;
+
+      // The slot of the current time is always empty, the slots of the highest level wrap around with the timer value
+      for (uint32_t offset = 1U; offset < RATMW_SLOTS_PER_LEVEL; ++offset) {
+        const uint32_t kSlot = (level * RATMW_SLOTS_PER_LEVEL) + ((kCurrentSlot + offset) & kSlotMask);
+        if (timer_wheel->slots[kSlot] != RATMW_NO_TIMER) {
+          *slot = (uint16_t)kSlot;
+          *slot_time = kLevelStartTime + (offset << kShift);  // Unsigned integer wrap around allowed here
+          slot_found = true;
+          break;  // End for-loop when the next slot is found
+        }
+      }
+
+      raas_AssertTrue(slot_found, radef_kInternalError);
+    }
+  }
+
+  return slot_found;
+}
+
+static void AdvanceTime(ratmw_TimerWheel* const timer_wheel, const uint32_t current_time) {
+  uint16_t slot = 0U;
+  uint32_t slot_time = 0U;
+
+  if (!GetNextSlot(timer_wheel, &slot, &slot_time)) {
+    timer_wheel->current_time = current_time;
+  } else if ((current_time - timer_wheel->current_time) <= RATMW_MAX_DELAY) {  // Unsigned integer wrap around allowed here
+    const uint32_t kTimeToAdvance = current_time - timer_wheel->current_time;
+    const uint32_t kStartTime = timer_wheel->current_time;
+
+    bool slot_available = true;
+    while (slot_available && ((slot_time - kStartTime) <= kTimeToAdvance)) {
+      timer_wheel->current_time = slot_time;
+
+      // Take all timers out of the reached slot and place them again relative to the new time of the wheel
+      uint16_t timer_id = timer_wheel->slots[slot];
+      while (timer_id != RATMW_NO_TIMER) {
+        const uint16_t kNextTimerId = timer_wheel->timers[timer_id].next;
+        RemoveTimerFromList(timer_wheel, timer_id);
+        PlaceTimer(timer_wheel, timer_id);
+        timer_id = kNextTimerId;
+      }
+
+      slot_available = GetNextSlot(timer_wheel, &slot, &slot_time);
+    }
+
+    timer_wheel->current_time = current_time;
+  } else {
+    // Current time lies before the time of the wheel
+  }
+}
@@ -0,0 +1,78 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file raslb_mock.cc
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version bfa7bcef58ee9ac7504a4ae227294d26848e4b9f
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock source file for the raslb module
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "raslb_mock.hh"
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+raslbMock * raslbMock::instance = NULL;
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+raslbMock::raslbMock() {
+  instance = this;
+}
+
+raslbMock::~raslbMock() {
+  instance = NULL;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+extern "C" {
+
+  void raslb_Init(const raslb_SlabConfiguration * const slab_configuration){
+    ASSERT_NE(raslbMock::getInstance(), nullptr) << "Mock object not initialized!";
+    raslbMock::getInstance()->raslb_Init(slab_configuration);
+  }
+  bool raslb_AllocateChunk(const uint16_t size, uint16_t * const chunk_handle){
+    if(raslbMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return raslbMock::getInstance()->raslb_AllocateChunk(size, chunk_handle);
+  }
+  void raslb_FreeChunk(const uint16_t chunk_handle){
+    ASSERT_NE(raslbMock::getInstance(), nullptr) << "Mock object not initialized!";
+    raslbMock::getInstance()->raslb_FreeChunk(chunk_handle);
+  }
+  uint8_t * raslb_GetChunkData(const uint16_t chunk_handle){
+    if(raslbMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return raslbMock::getInstance()->raslb_GetChunkData(chunk_handle);
+  }
+  uint16_t raslb_GetChunkSize(const uint16_t chunk_handle){
+    if(raslbMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return raslbMock::getInstance()->raslb_GetChunkSize(chunk_handle);
+  }
+  uint16_t raslb_GetNumberOfFreeChunks(const uint16_t size){
+    if(raslbMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return raslbMock::getInstance()->raslb_GetNumberOfFreeChunks(size);
+  }
+  void raslb_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(raslbMock::getInstance(), nullptr) << "Mock object not initialized!";
+    raslbMock::getInstance()->raslb_SelectInstance(instance_index);
+  }
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
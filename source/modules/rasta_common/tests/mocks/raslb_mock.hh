@@ -0,0 +1,89 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file raslb_mock.hh
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version bfa7bcef58ee9ac7504a4ae227294d26848e4b9f
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock header file for the raslb module
+ */
+
+#ifndef SOURCE_MODULES_RASTA_COMMON_TESTS_MOCKS_RASLB_MOCK_HH_
+#define SOURCE_MODULES_RASTA_COMMON_TESTS_MOCKS_RASLB_MOCK_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "gmock/gmock.h"
+#include "rasta_common/raslb_rasta_slab.h"
+
+// -----------------------------------------------------------------------------
+// Mock class
+// -----------------------------------------------------------------------------
+/**
+ * @brief Mock class for the rasta raslb class
+ */
+class raslbMock {
+private:
+  static raslbMock *instance;  ///< raslbMock instance
+
+public:
+  /**
+  * @brief raslbMock constructor
+  */
+  raslbMock();
+  /**
+  * @brief raslbMock destructor
+  */
+  virtual ~raslbMock();
+
+  /**
+  * @brief Mock Method object for the raslb_Init function
+  */
+  MOCK_METHOD(void, raslb_Init, (const raslb_SlabConfiguration * const slab_configuration));
+
+  /**
+  * @brief Mock Method object for the raslb_AllocateChunk function
+  */
+  MOCK_METHOD(bool, raslb_AllocateChunk, (const uint16_t size, uint16_t * const chunk_handle));
+
+  /**
+  * @brief Mock Method object for the raslb_FreeChunk function
+  */
+  MOCK_METHOD(void, raslb_FreeChunk, (const uint16_t chunk_handle));
+
+  /**
+  * @brief Mock Method object for the raslb_GetChunkData function
+  */
+  MOCK_METHOD(uint8_t *, raslb_GetChunkData, (const uint16_t chunk_handle));
+
+  /**
+  * @brief Mock Method object for the raslb_GetChunkSize function
+  */
+  MOCK_METHOD(uint16_t, raslb_GetChunkSize, (const uint16_t chunk_handle));
+
+  /**
+  * @brief Mock Method object for the raslb_GetNumberOfFreeChunks function
+  */
+  MOCK_METHOD(uint16_t, raslb_GetNumberOfFreeChunks, (const uint16_t size));
+
+  /**
+  * @brief Mock Method object for the raslb_SelectInstance function
+  */
+  MOCK_METHOD(void, raslb_SelectInstance, (const uint32_t instance_index));
+
+  /**
+  * @brief Get the Instance object
+  *
+  * @return raslbMock*
+  */
+  static raslbMock *getInstance() {
+    return instance;
+  }
+};
+
+#endif // SOURCE_MODULES_RASTA_COMMON_TESTS_MOCKS_RASLB_MOCK_HH_
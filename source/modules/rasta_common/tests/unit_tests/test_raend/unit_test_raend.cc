@@ -0,0 +1,189 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_raend.cc
+ *
+ * @author Martin Kuhn, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version bfa7bcef58ee9ac7504a4ae227294d26848e4b9f
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Unit test file for the endian codec module of the common package.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "unit_test_raend.hh"
+
+// -----------------------------------------------------------------------------
+// Test class definitons
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test class for value-parametrized codec test
+ *
+ * Parameter order:
+ * - offset of the word in the buffer (uint32_t)
+ * - value of the word (uint32_t)
+ * .
+ */
+class CodecWithParam :  public raendTest,
+                        public testing::WithParamInterface<std::tuple<uint32_t, uint32_t>>
+{
+    public:
+    uint32_t offset =   std::get<0>(GetParam());        ///< offset of the word in the buffer
+    uint32_t value =    std::get<1>(GetParam());        ///< value of the word
+};
+
+// -----------------------------------------------------------------------------
+// Test cases
+// -----------------------------------------------------------------------------
+
+/** @addtogroup common_endian
+ * @{
+ */
+
+/**
+ * @test        @ID{raendTest002} Verify the Uint16 codec.
+ *
+ * @details     This test verifies that a Uint16 word is stored and loaded in little endian byte order at aligned and unaligned offsets.
+ *
+ * Test steps:
+ * - store the lower half of the value at the offset of the buffer
+ * - verify that the low byte is stored first and that the bytes around the word are not changed
+ * - load the word and verify that it equals the stored value
+ * .
+ *
+ * @testParameter
+ * - Offset: Offset of the word in the buffer [bytes]
+ * - Value: Value of the word (only the lower 16 bits are used)
+ * .
+ * | Test Run | Input parameter          || Test Result                  |
+ * |----------|------------|-------------|------------------------------|
+ * |          | Offset     | Value       |                              |
+ * | 0        | 0          | 0x00000000  | Minimum value, aligned       |
+ * | 1        | 1          | 0x12345678  | Unaligned word               |
+ * | 2        | 2          | 0xFF00FF00  | High byte only               |
+ * | 3        | 3          | 0x00FF00FF  | Low byte only, unaligned     |
+ * | 4        | 4          | 0xFFFFFFFF  | Maximum value                |
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No postconditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-157} Endian Definition
+ */
+TEST_P(CodecWithParam, raendTest002VerifyUint16Codec)
+{
+    const uint16_t kValue = (uint16_t)value;
+    std::fill(std::begin(buffer), std::end(buffer), 0xA5U);
+
+    raend_StoreUint16(&buffer[offset], kValue);
+    for (uint32_t index = 0U; index < UT_RAEND_BUFFER_SIZE; ++index) {
+        if (index == offset) {
+            EXPECT_EQ(buffer[index], (uint8_t)(kValue & 0xFFU));
+        } else if (index == (offset + 1U)) {
+            EXPECT_EQ(buffer[index], (uint8_t)(kValue >> 8U));
+        } else {
+            EXPECT_EQ(buffer[index], 0xA5U);
+        }
+    }
+    EXPECT_EQ(raend_LoadUint16(&buffer[offset]), kValue);
+}
+
+/**
+ * @test        @ID{raendTest003} Verify the Uint32 codec.
+ *
+ * @details     This test verifies that a Uint32 word is stored and loaded in little endian byte order at aligned and unaligned offsets.
+ *
+ * Test steps:
+ * - store the value at the offset of the buffer
+ * - verify that the bytes are stored from the lowest to the highest byte and that the bytes around the word are not changed
+ * - load the word and verify that it equals the stored value
+ * .
+ *
+ * @testParameter
+ * - Offset: Offset of the word in the buffer [bytes]
+ * - Value: Value of the word
+ * .
+ * | Test Run | Input parameter          || Test Result                  |
+ * |----------|------------|-------------|------------------------------|
+ * |          | Offset     | Value       |                              |
+ * | 0        | 0          | 0x00000000  | Minimum value, aligned       |
+ * | 1        | 1          | 0x12345678  | Unaligned word               |
+ * | 2        | 2          | 0xFF00FF00  | Odd bytes only               |
+ * | 3        | 3          | 0x00FF00FF  | Even bytes only, unaligned   |
+ * | 4        | 4          | 0xFFFFFFFF  | Maximum value                |
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No postconditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-157} Endian Definition
+ */
+TEST_P(CodecWithParam, raendTest003VerifyUint32Codec)
+{
+    std::fill(std::begin(buffer), std::end(buffer), 0xA5U);
+
+    raend_StoreUint32(&buffer[offset], value);
+    for (uint32_t index = 0U; index < UT_RAEND_BUFFER_SIZE; ++index) {
+        if ((index >= offset) && (index < (offset + 4U))) {
+            EXPECT_EQ(buffer[index], (uint8_t)((value >> (8U * (index - offset))) & 0xFFU));
+        } else {
+            EXPECT_EQ(buffer[index], 0xA5U);
+        }
+    }
+    EXPECT_EQ(raend_LoadUint32(&buffer[offset]), value);
+}
+
+/**
+ * @test        @ID{raendTest004} Verify the load of a known byte pattern.
+ *
+ * @details     This test verifies that the load functions interpret a byte pattern of a message in little endian byte order.
+ *
+ * Test steps:
+ * - set the buffer to the byte pattern 0x01 ... 0x08
+ * - load Uint16 and Uint32 words at aligned and unaligned offsets and verify the expected values
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No postconditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-157} Endian Definition
+ */
+TEST_F(raendTest, raendTest004VerifyLoadOfBytePattern)
+{
+    const uint8_t kPattern[UT_RAEND_BUFFER_SIZE] = {0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x06U, 0x07U, 0x08U};
+    std::copy(std::begin(kPattern), std::end(kPattern), std::begin(buffer));
+
+    EXPECT_EQ(raend_LoadUint16(&buffer[0]), 0x0201U);
+    EXPECT_EQ(raend_LoadUint16(&buffer[3]), 0x0504U);
+    EXPECT_EQ(raend_LoadUint32(&buffer[0]), 0x04030201U);
+    EXPECT_EQ(raend_LoadUint32(&buffer[3]), 0x07060504U);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    verifyCodec,
+    CodecWithParam,
+    ::testing::Values(
+        std::make_tuple(0U, 0x00000000U),
+        std::make_tuple(1U, 0x12345678U),
+        std::make_tuple(2U, 0xFF00FF00U),
+        std::make_tuple(3U, 0x00FF00FFU),
+        std::make_tuple(4U, 0xFFFFFFFFU)
+    ));
+
+/** @}*/
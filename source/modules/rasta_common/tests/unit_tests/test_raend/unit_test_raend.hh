@@ -0,0 +1,73 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_raend.hh
+ *
+ * @author Martin Kuhn, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version bfa7bcef58ee9ac7504a4ae227294d26848e4b9f
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Header file for unit tests of the endian codec module of the common package.
+ */
+
+#ifndef SOURCE_MODULES_RASTA_COMMON_TESTS_UNIT_TESTS_TEST_RAEND_UNIT_TEST_RAEND_HH_
+#define SOURCE_MODULES_RASTA_COMMON_TESTS_UNIT_TESTS_TEST_RAEND_UNIT_TEST_RAEND_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+// clang-format off
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "rasta_common/raend_rasta_endian.h"
+#include "rasys_mock.hh"
+// clang-format on
+
+using testing::_;
+using testing::Invoke;
+using testing::StrictMock;
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+#define UT_RAEND_BUFFER_SIZE 8U             ///< size of the test data buffer [bytes]
+
+// -----------------------------------------------------------------------------
+// Test class definiton
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test fixture class for the endian codec module
+ *
+ */
+class raendTest : public ::testing::Test
+{
+public:
+    raendTest()
+    {
+
+    }
+    ~raendTest()
+    {
+
+    }
+
+    /**
+    * @brief Throw invalid argument exception
+    * This function is used to throw an invalid argument exception mocked function call action.
+    */
+    void invalidArgumentException(){
+        throw std::invalid_argument("Invalid argument!");
+    }
+
+    uint8_t buffer[UT_RAEND_BUFFER_SIZE] = {};  ///< data buffer under test
+
+    StrictMock<rasysMock>   rasys_mock;        ///< mock for the rasta system adapter class
+};
+
+#endif  // SOURCE_MODULES_RASTA_COMMON_TESTS_UNIT_TESTS_TEST_RAEND_UNIT_TEST_RAEND_HH_
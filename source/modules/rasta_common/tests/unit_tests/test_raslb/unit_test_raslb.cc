@@ -0,0 +1,292 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_raslb.cc
+ *
+ * @author Martin Kuhn, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version bfa7bcef58ee9ac7504a4ae227294d26848e4b9f
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Unit test file for the message slab module of the common package.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "unit_test_raslb.hh"
+
+// -----------------------------------------------------------------------------
+// Test class definitons
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test class for value-parametrized init test with an invalid configuration
+ *
+ * Parameter order:
+ * - number of size classes (uint16_t)
+ * - chunk size of the first size class (uint16_t)
+ * - chunk size of the second size class (uint16_t)
+ * - number of chunks of the second size class (uint16_t)
+ * .
+ */
+class InitInvalidConfigurationWithParam :   public raslbTest,
+                                            public testing::WithParamInterface<std::tuple<uint16_t, uint16_t, uint16_t, uint16_t>>
+{
+    public:
+    uint16_t number_of_size_classes =   std::get<0>(GetParam());        ///< number of size classes
+    uint16_t first_chunk_size =         std::get<1>(GetParam());        ///< chunk size of the first size class
+    uint16_t second_chunk_size =        std::get<2>(GetParam());        ///< chunk size of the second size class
+    uint16_t second_number_of_chunks =  std::get<3>(GetParam());        ///< number of chunks of the second size class
+};
+
+// -----------------------------------------------------------------------------
+// Test cases
+// -----------------------------------------------------------------------------
+
+/** @addtogroup common_slab
+ * @{
+ */
+
+/**
+ * @test        @ID{raslbTest001} Verify the init function.
+ *
+ * @details     This test verifies that the init function sets up the configured size classes.
+ *
+ * Test steps:
+ * - call the init function with a NULL pointer and verify that a fatal error is thrown
+ * - call the init function with a valid configuration
+ * - verify the number of free chunks for the chunk size of every size class
+ * - call the init function again and verify that a fatal error is thrown
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        The slab is initialized with the test configuration.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(raslbTest, raslbTest001VerifyInitFunction)
+{
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &raslbTest::invalidArgumentException));
+    EXPECT_THROW(raslb_Init(nullptr), std::invalid_argument);
+
+    raslb_Init(&test_configuration);
+    EXPECT_TRUE(raslb_instance->initialized);
+
+    EXPECT_EQ(raslb_GetNumberOfFreeChunks(1U), UT_RASLB_NUMBER_OF_SMALL_CHUNKS + UT_RASLB_NUMBER_OF_MEDIUM_CHUNKS + UT_RASLB_NUMBER_OF_LARGE_CHUNKS);
+    EXPECT_EQ(raslb_GetNumberOfFreeChunks(UT_RASLB_SMALL_CHUNK_SIZE), UT_RASLB_NUMBER_OF_SMALL_CHUNKS + UT_RASLB_NUMBER_OF_MEDIUM_CHUNKS + UT_RASLB_NUMBER_OF_LARGE_CHUNKS);
+    EXPECT_EQ(raslb_GetNumberOfFreeChunks(UT_RASLB_SMALL_CHUNK_SIZE + 1U), UT_RASLB_NUMBER_OF_MEDIUM_CHUNKS + UT_RASLB_NUMBER_OF_LARGE_CHUNKS);
+    EXPECT_EQ(raslb_GetNumberOfFreeChunks(UT_RASLB_MEDIUM_CHUNK_SIZE + 1U), UT_RASLB_NUMBER_OF_LARGE_CHUNKS);
+    EXPECT_EQ(raslb_GetNumberOfFreeChunks(UT_RASLB_LARGE_CHUNK_SIZE), UT_RASLB_NUMBER_OF_LARGE_CHUNKS);
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kAlreadyInitialized)).WillOnce(Invoke(this, &raslbTest::invalidArgumentException));
+    EXPECT_THROW(raslb_Init(&test_configuration), std::invalid_argument);
+}
+
+/**
+ * @test        @ID{raslbTest002} Verify the init function with an invalid configuration.
+ *
+ * @details     This test verifies that the init function rejects invalid slab configurations.
+ *
+ * Test steps:
+ * - set up a slab configuration with the given test parameter
+ * - call the init function and verify that a ::radef_kInvalidConfiguration fatal error is thrown
+ * .
+ *
+ * @testParameter
+ * - Classes: Number of size classes
+ * - Size 1: Chunk size of the first size class (with 1 chunk)
+ * - Size 2: Chunk size of the second size class
+ * - Chunks 2: Number of chunks of the second size class (Pool: ::RADEF_SLAB_POOL_SIZE / ::RADEF_SLAB_LARGE_CHUNK_SIZE)
+ * .
+ * | Test Run | Input parameter                           |||| Test Result                      |
+ * |----------|---------|--------|--------|----------|----------------------------------|
+ * |          | Classes | Size 1 | Size 2 | Chunks 2 |                                  |
+ * | 0        | 0       | 64     | 256    | 1        | Too few size classes             |
+ * | 1        | 4       | 64     | 256    | 1        | Too many size classes            |
+ * | 2        | 2       | 0      | 256    | 1        | Chunk size too small             |
+ * | 3        | 2       | 64     | 1102   | 1        | Chunk size too large             |
+ * | 4        | 2       | 256    | 256    | 1        | Chunk sizes not ascending        |
+ * | 5        | 2       | 256    | 64     | 1        | Chunk sizes not ascending        |
+ * | 6        | 2       | 64     | 1101   | Pool + 1 | Pool too small                   |
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         This is a value-parametrized test case which needs instantiation with defined values.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_P(InitInvalidConfigurationWithParam, raslbTest002VerifyInitFunctionInvalidConfiguration)
+{
+    const raslb_SlabConfiguration kConfiguration = {number_of_size_classes, {{first_chunk_size, 1U}, {second_chunk_size, second_number_of_chunks}, {0U, 0U}}};
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidConfiguration)).WillOnce(Invoke(this, &raslbTest::invalidArgumentException));
+    EXPECT_THROW(raslb_Init(&kConfiguration), std::invalid_argument);
+    EXPECT_FALSE(raslb_instance->initialized);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    verifyInitFunctionInvalidConfiguration,
+    InitInvalidConfigurationWithParam,
+    ::testing::Values(
+        std::make_tuple(0U, 64U, 256U, 1U),
+        std::make_tuple(4U, 64U, 256U, 1U),
+        std::make_tuple(2U, 0U, 256U, 1U),
+        std::make_tuple(2U, 64U, 1102U, 1U),
+        std::make_tuple(2U, 256U, 256U, 1U),
+        std::make_tuple(2U, 256U, 64U, 1U),
+        std::make_tuple(2U, 64U, 1101U, (RADEF_SLAB_POOL_SIZE / RADEF_SLAB_LARGE_CHUNK_SIZE) + 1U)
+    ));
+
+/**
+ * @test        @ID{raslbTest003} Verify the allocation and the freeing of chunks.
+ *
+ * @details     This test verifies that chunks are allocated from the smallest size class which can hold the requested size, that larger size classes are
+ *              used when a size class is exhausted and that freed chunks can be allocated again.
+ *
+ * Test steps:
+ * - initialize the slab with the test configuration
+ * - allocate all small chunks and verify their size and that their memory does not overlap
+ * - allocate further small sizes and verify that they are taken from the medium size class
+ * - allocate a large chunk and verify that the allocation of the remaining chunks fails, when all chunks are allocated
+ * - free a small chunk and verify that it is allocated again for a small size
+ * - free all chunks and verify the number of free chunks
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        All chunks are free.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(raslbTest, raslbTest003VerifyAllocateAndFreeChunk)
+{
+    std::vector<uint16_t> chunk_handles;
+    uint16_t chunk_handle = RASLB_INVALID_CHUNK_HANDLE;
+
+    raslb_Init(&test_configuration);
+
+    // allocate all small chunks and write a pattern to every chunk
+    for (uint16_t index = 0U; index < UT_RASLB_NUMBER_OF_SMALL_CHUNKS; ++index) {
+        EXPECT_TRUE(raslb_AllocateChunk(UT_RASLB_SMALL_CHUNK_SIZE, &chunk_handle));
+        EXPECT_EQ(raslb_GetChunkSize(chunk_handle), UT_RASLB_SMALL_CHUNK_SIZE);
+        memset(raslb_GetChunkData(chunk_handle), index, UT_RASLB_SMALL_CHUNK_SIZE);
+        chunk_handles.push_back(chunk_handle);
+    }
+
+    // verify that the chunks do not overlap
+    for (uint16_t index = 0U; index < UT_RASLB_NUMBER_OF_SMALL_CHUNKS; ++index) {
+        const uint8_t * const chunk_data = raslb_GetChunkData(chunk_handles[index]);
+        EXPECT_EQ(chunk_data[0], index);
+        EXPECT_EQ(chunk_data[UT_RASLB_SMALL_CHUNK_SIZE - 1U], index);
+    }
+
+    // small sizes are taken from the medium size class, when all small chunks are allocated
+    for (uint16_t index = 0U; index < UT_RASLB_NUMBER_OF_MEDIUM_CHUNKS; ++index) {
+        EXPECT_TRUE(raslb_AllocateChunk(1U, &chunk_handle));
+        EXPECT_EQ(raslb_GetChunkSize(chunk_handle), UT_RASLB_MEDIUM_CHUNK_SIZE);
+        chunk_handles.push_back(chunk_handle);
+    }
+    EXPECT_EQ(raslb_GetNumberOfFreeChunks(1U), UT_RASLB_NUMBER_OF_LARGE_CHUNKS);
+
+    // allocate the large chunks
+    for (uint16_t index = 0U; index < UT_RASLB_NUMBER_OF_LARGE_CHUNKS; ++index) {
+        EXPECT_TRUE(raslb_AllocateChunk(UT_RASLB_LARGE_CHUNK_SIZE, &chunk_handle));
+        EXPECT_EQ(raslb_GetChunkSize(chunk_handle), UT_RASLB_LARGE_CHUNK_SIZE);
+        chunk_handles.push_back(chunk_handle);
+    }
+
+    // all chunks are allocated
+    EXPECT_EQ(raslb_GetNumberOfFreeChunks(1U), 0U);
+    EXPECT_FALSE(raslb_AllocateChunk(1U, &chunk_handle));
+    EXPECT_FALSE(raslb_AllocateChunk(UT_RASLB_LARGE_CHUNK_SIZE, &chunk_handle));
+
+    // a freed small chunk is allocated again
+    raslb_FreeChunk(chunk_handles[1]);
+    EXPECT_EQ(raslb_GetNumberOfFreeChunks(1U), 1U);
+    EXPECT_EQ(raslb_GetNumberOfFreeChunks(UT_RASLB_SMALL_CHUNK_SIZE + 1U), 0U);
+    EXPECT_TRUE(raslb_AllocateChunk(UT_RASLB_SMALL_CHUNK_SIZE, &chunk_handle));
+    EXPECT_EQ(chunk_handle, chunk_handles[1]);
+
+    // free all chunks
+    for (const uint16_t handle : chunk_handles) {
+        raslb_FreeChunk(handle);
+    }
+    EXPECT_EQ(raslb_GetNumberOfFreeChunks(1U), UT_RASLB_NUMBER_OF_SMALL_CHUNKS + UT_RASLB_NUMBER_OF_MEDIUM_CHUNKS + UT_RASLB_NUMBER_OF_LARGE_CHUNKS);
+}
+
+/**
+ * @test        @ID{raslbTest004} Verify the input parameter checks.
+ *
+ * @details     This test verifies that the functions of the slab check their input parameters and the initialization state.
+ *
+ * Test steps:
+ * - call all functions without initialization and verify that a ::radef_kNotInitialized fatal error is thrown
+ * - initialize the slab with the test configuration
+ * - call the allocate function with invalid sizes and a NULL pointer and verify that a ::radef_kInvalidParameter fatal error is thrown
+ * - call the free, get data and get size functions with a not allocated and an invalid chunk handle and verify that a ::radef_kInvalidParameter fatal error
+ *   is thrown
+ * - free a chunk twice and verify that a ::radef_kInvalidParameter fatal error is thrown
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(raslbTest, raslbTest004VerifyInputParameterCheck)
+{
+    uint16_t chunk_handle = RASLB_INVALID_CHUNK_HANDLE;
+
+    // not initialized
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kNotInitialized)).Times(5).WillRepeatedly(Invoke(this, &raslbTest::invalidArgumentException));
+    EXPECT_THROW(raslb_AllocateChunk(1U, &chunk_handle), std::invalid_argument);
+    EXPECT_THROW(raslb_FreeChunk(0U), std::invalid_argument);
+    EXPECT_THROW(raslb_GetChunkData(0U), std::invalid_argument);
+    EXPECT_THROW(raslb_GetChunkSize(0U), std::invalid_argument);
+    EXPECT_THROW(raslb_GetNumberOfFreeChunks(1U), std::invalid_argument);
+
+    raslb_Init(&test_configuration);
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(12).WillRepeatedly(Invoke(this, &raslbTest::invalidArgumentException));
+
+    // invalid size and NULL pointer
+    EXPECT_THROW(raslb_AllocateChunk(0U, &chunk_handle), std::invalid_argument);
+    EXPECT_THROW(raslb_AllocateChunk(RADEF_SLAB_LARGE_CHUNK_SIZE + 1U, &chunk_handle), std::invalid_argument);
+    EXPECT_THROW(raslb_AllocateChunk(1U, nullptr), std::invalid_argument);
+    EXPECT_THROW(raslb_GetNumberOfFreeChunks(0U), std::invalid_argument);
+    EXPECT_THROW(raslb_GetNumberOfFreeChunks(RADEF_SLAB_LARGE_CHUNK_SIZE + 1U), std::invalid_argument);
+
+    // not allocated chunk
+    EXPECT_THROW(raslb_FreeChunk(0U), std::invalid_argument);
+    EXPECT_THROW(raslb_GetChunkData(0U), std::invalid_argument);
+    EXPECT_THROW(raslb_GetChunkSize(0U), std::invalid_argument);
+
+    // invalid chunk handle
+    EXPECT_THROW(raslb_FreeChunk(RASLB_INVALID_CHUNK_HANDLE), std::invalid_argument);
+    EXPECT_THROW(raslb_GetChunkData(RASLB_INVALID_CHUNK_HANDLE), std::invalid_argument);
+    EXPECT_THROW(raslb_GetChunkSize(RASLB_INVALID_CHUNK_HANDLE), std::invalid_argument);
+
+    // free a chunk twice
+    EXPECT_TRUE(raslb_AllocateChunk(1U, &chunk_handle));
+    raslb_FreeChunk(chunk_handle);
+    EXPECT_THROW(raslb_FreeChunk(chunk_handle), std::invalid_argument);
+}
+
+/** @}*/
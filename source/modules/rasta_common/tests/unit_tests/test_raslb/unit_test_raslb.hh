@@ -0,0 +1,93 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_raslb.hh
+ *
+ * @author Martin Kuhn, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version bfa7bcef58ee9ac7504a4ae227294d26848e4b9f
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Header file for unit tests of the message slab module of the common package.
+ */
+
+#ifndef SOURCE_MODULES_RASTA_COMMON_TESTS_UNIT_TESTS_TEST_RASLB_UNIT_TEST_RASLB_HH_
+#define SOURCE_MODULES_RASTA_COMMON_TESTS_UNIT_TESTS_TEST_RASLB_UNIT_TEST_RASLB_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+// clang-format off
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "rasta_common/raslb_rasta_slab.h"
+#include "rasys_mock.hh"
+// clang-format on
+
+using testing::_;
+using testing::Invoke;
+using testing::StrictMock;
+using testing::NaggyMock;
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+#define UT_RASLB_SMALL_CHUNK_SIZE 64            ///< chunk size of the small size class of the test configuration
+#define UT_RASLB_MEDIUM_CHUNK_SIZE 256          ///< chunk size of the medium size class of the test configuration
+#define UT_RASLB_LARGE_CHUNK_SIZE 1101          ///< chunk size of the large size class of the test configuration (maximum SafRetL message size)
+#define UT_RASLB_NUMBER_OF_SMALL_CHUNKS 4       ///< number of chunks of the small size class of the test configuration
+#define UT_RASLB_NUMBER_OF_MEDIUM_CHUNKS 3      ///< number of chunks of the medium size class of the test configuration
+#define UT_RASLB_NUMBER_OF_LARGE_CHUNKS 2       ///< number of chunks of the large size class of the test configuration
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+extern raslb_InstanceData *raslb_instance;      ///< data of the selected message slab module instance
+
+// -----------------------------------------------------------------------------
+// Test class definiton
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test fixture class for the message slab module
+ *
+ */
+class raslbTest : public ::testing::Test
+{
+public:
+    raslbTest()
+    {
+        // reset initialization state
+        raslb_instance->initialized = false;
+    }
+    ~raslbTest()
+    {
+
+    }
+
+    /**
+    * @brief Throw invalid argument exception
+    * This function is used to throw an invalid argument exception mocked function call action.
+    */
+    void invalidArgumentException(){
+        throw std::invalid_argument("Invalid argument!");
+    }
+
+    const raslb_SlabConfiguration test_configuration = {
+        3U,
+        {{UT_RASLB_SMALL_CHUNK_SIZE, UT_RASLB_NUMBER_OF_SMALL_CHUNKS},
+         {UT_RASLB_MEDIUM_CHUNK_SIZE, UT_RASLB_NUMBER_OF_MEDIUM_CHUNKS},
+         {UT_RASLB_LARGE_CHUNK_SIZE, UT_RASLB_NUMBER_OF_LARGE_CHUNKS}}};  ///< slab configuration with three size classes
+
+    StrictMock<rasysMock>   rasys_mock;        ///< mock for the rasta system adapter class
+};
+
+#endif  // SOURCE_MODULES_RASTA_COMMON_TESTS_UNIT_TESTS_TEST_RASLB_UNIT_TEST_RASLB_HH_
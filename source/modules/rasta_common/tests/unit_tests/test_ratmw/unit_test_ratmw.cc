@@ -0,0 +1,364 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_ratmw.cc
+ *
+ * @author Martin Kuhn, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version bfa7bcef58ee9ac7504a4ae227294d26848e4b9f
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Unit test file for the timer wheel module of the common package.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "unit_test_ratmw.hh"
+
+// -----------------------------------------------------------------------------
+// Test class definitons
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test class for value-parametrized timer expiry test
+ *
+ * Parameter order:
+ * - start time (uint32_t)
+ * - delay (uint32_t)
+ * - time step used to advance the time of the wheel (uint32_t)
+ * .
+ */
+class TimerExpiryWithParam :    public ratmwTest,
+                                public testing::WithParamInterface<std::tuple<uint32_t, uint32_t, uint32_t>>
+{
+    public:
+    uint32_t start_time =   std::get<0>(GetParam());        ///< start time
+    uint32_t delay =        std::get<1>(GetParam());        ///< delay
+    uint32_t time_step =    std::get<2>(GetParam());        ///< time step
+};
+
+// -----------------------------------------------------------------------------
+// Test cases
+// -----------------------------------------------------------------------------
+
+/** @addtogroup common_timerWheel
+ * @{
+ */
+
+/**
+ * @test        @ID{ratmwTest001} Verify the init function.
+ *
+ * @details     This test verifies that the init function checks its parameters and stops all timers.
+ *
+ * Test steps:
+ * - call the init function with NULL pointers and an invalid number of timers and verify that a ::radef_kInvalidParameter fatal error is thrown
+ * - start a timer and initialize the timer wheel again
+ * - verify that no timer is running and no timer is expired
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        The timer wheel is initialized.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(ratmwTest, ratmwTest001VerifyInitFunction)
+{
+    uint16_t timer_id = RATMW_NO_TIMER;
+    uint32_t time_to_next_deadline = 0U;
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(4).WillRepeatedly(Invoke(this, &ratmwTest::invalidArgumentException));
+    EXPECT_THROW(ratmw_Init(nullptr, timers, UT_RATMW_NUMBER_OF_TIMERS), std::invalid_argument);
+    EXPECT_THROW(ratmw_Init(&timer_wheel, nullptr, UT_RATMW_NUMBER_OF_TIMERS), std::invalid_argument);
+    EXPECT_THROW(ratmw_Init(&timer_wheel, timers, 0U), std::invalid_argument);
+    EXPECT_THROW(ratmw_Init(&timer_wheel, timers, RATMW_NO_TIMER), std::invalid_argument);
+
+    ratmw_Init(&timer_wheel, timers, UT_RATMW_NUMBER_OF_TIMERS);
+    ratmw_StartTimer(&timer_wheel, 0U, 1000U, 0U);
+    ratmw_StartTimer(&timer_wheel, 1U, 1000U, 10U);
+
+    ratmw_Init(&timer_wheel, timers, UT_RATMW_NUMBER_OF_TIMERS);
+    EXPECT_FALSE(ratmw_GetTimeToNextDeadline(&timer_wheel, 2000U, &time_to_next_deadline));
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, 2000U, &timer_id));
+}
+
+/**
+ * @test        @ID{ratmwTest002} Verify the expiry of a timer.
+ *
+ * @details     This test verifies that a timer expires exactly at its deadline on all levels of the timer wheel, also if the timer value wraps around.
+ *
+ * Test steps:
+ * - initialize the timer wheel and start a timer at the start time with the delay
+ * - verify the time until the next deadline
+ * - advance the time of the wheel with the time step until one step before the deadline and verify that the timer is not expired
+ * - verify that the timer is not expired one millisecond before the deadline
+ * - verify that the timer is expired at the deadline and that the expiry is returned only once
+ * .
+ *
+ * @testParameter
+ * - Start time: Time at which the timer is started [ms]
+ * - Delay: Delay of the timer [ms]
+ * - Step: Time step used to advance the time of the wheel [ms]
+ * .
+ * | Test Run | Input parameter                      ||| Test Result                  |
+ * |----------|------------|------------|------------|------------------------------|
+ * |          | Start time | Delay      | Step       |                              |
+ * | 0        | 0          | 1          | 1          | Expiry on level 0            |
+ * | 1        | 100        | 300        | 7          | Expiry after level 1         |
+ * | 2        | 0x000000FF | 0x100      | 1          | Level 1 slot of next byte    |
+ * | 3        | 12345      | 70000      | 1000       | Expiry after level 2         |
+ * | 4        | 0xFFFFFF00 | 0x200      | 3          | Wrap around of timer value   |
+ * | 5        | 0x00FFFFFF | 0x1000001  | 0x10000    | Expiry after level 3         |
+ * | 6        | 0xF0000000 | 0x7FFFFFFF | 0x1000000  | Maximum delay with wrap      |
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         This is a value-parametrized test case which needs instantiation with defined values.
+ * @post        No timer is running.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_P(TimerExpiryWithParam, ratmwTest002VerifyTimerExpiry)
+{
+    uint16_t timer_id = RATMW_NO_TIMER;
+    uint32_t time_to_next_deadline = 0U;
+    const uint32_t kDeadline = start_time + delay;
+
+    ratmw_Init(&timer_wheel, timers, UT_RATMW_NUMBER_OF_TIMERS);
+    ratmw_StartTimer(&timer_wheel, 2U, start_time, delay);
+
+    EXPECT_TRUE(ratmw_GetTimeToNextDeadline(&timer_wheel, start_time, &time_to_next_deadline));
+    EXPECT_EQ(time_to_next_deadline, delay);
+
+    for (uint32_t elapsed_time = time_step; elapsed_time < delay; elapsed_time += time_step) {
+        EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, start_time + elapsed_time, &timer_id));
+        EXPECT_TRUE(ratmw_GetTimeToNextDeadline(&timer_wheel, start_time + elapsed_time, &time_to_next_deadline));
+        EXPECT_EQ(time_to_next_deadline, delay - elapsed_time);
+    }
+
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, kDeadline - 1U, &timer_id));
+    EXPECT_TRUE(ratmw_GetTimeToNextDeadline(&timer_wheel, kDeadline - 1U, &time_to_next_deadline));
+    EXPECT_EQ(time_to_next_deadline, 1U);
+
+    EXPECT_TRUE(ratmw_GetTimeToNextDeadline(&timer_wheel, kDeadline, &time_to_next_deadline));
+    EXPECT_EQ(time_to_next_deadline, 0U);
+    EXPECT_TRUE(ratmw_GetExpiredTimer(&timer_wheel, kDeadline, &timer_id));
+    EXPECT_EQ(timer_id, 2U);
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, kDeadline + 1U, &timer_id));
+    EXPECT_FALSE(ratmw_GetTimeToNextDeadline(&timer_wheel, kDeadline + 1U, &time_to_next_deadline));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    verifyTimerExpiry,
+    TimerExpiryWithParam,
+    ::testing::Values(
+        std::make_tuple(0U, 1U, 1U),
+        std::make_tuple(100U, 300U, 7U),
+        std::make_tuple(0x000000FFU, 0x100U, 1U),
+        std::make_tuple(12345U, 70000U, 1000U),
+        std::make_tuple(0xFFFFFF00U, 0x200U, 3U),
+        std::make_tuple(0x00FFFFFFU, 0x1000001U, 0x10000U),
+        std::make_tuple(0xF0000000U, RATMW_MAX_DELAY, 0x1000000U)
+    ));
+
+/**
+ * @test        @ID{ratmwTest003} Verify the order of expiry and the next deadline of multiple timers.
+ *
+ * @details     This test verifies that timers on different levels expire in the order of their deadlines and that the time until the next deadline is the
+ *              time until the earliest deadline.
+ *
+ * Test steps:
+ * - initialize the timer wheel and start four timers with deadlines on different levels
+ * - advance the time of the wheel in one step beyond the first two deadlines and verify that both timers are expired
+ * - verify that the time until the next deadline is the time until the third deadline
+ * - advance the time of the wheel to the third and the fourth deadline and verify that the timers expire one after another
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No timer is running.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(ratmwTest, ratmwTest003VerifyMultipleTimers)
+{
+    uint16_t timer_id = RATMW_NO_TIMER;
+    uint16_t first_timer_id = RATMW_NO_TIMER;
+    uint32_t time_to_next_deadline = 0U;
+
+    ratmw_Init(&timer_wheel, timers, UT_RATMW_NUMBER_OF_TIMERS);
+    ratmw_StartTimer(&timer_wheel, 0U, 1000U, 100000U);
+    ratmw_StartTimer(&timer_wheel, 1U, 1000U, 50U);
+    ratmw_StartTimer(&timer_wheel, 2U, 1000U, 20U);
+    ratmw_StartTimer(&timer_wheel, 3U, 1000U, 600U);
+
+    EXPECT_TRUE(ratmw_GetTimeToNextDeadline(&timer_wheel, 1000U, &time_to_next_deadline));
+    EXPECT_EQ(time_to_next_deadline, 20U);
+
+    // Timers 1 & 2 expire in the same step
+    EXPECT_TRUE(ratmw_GetExpiredTimer(&timer_wheel, 1060U, &first_timer_id));
+    EXPECT_TRUE(ratmw_GetExpiredTimer(&timer_wheel, 1060U, &timer_id));
+    EXPECT_EQ(first_timer_id + timer_id, 3U);
+    EXPECT_NE(first_timer_id, timer_id);
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, 1060U, &timer_id));
+
+    // Timer 3 on a higher level than timer 0 determines the next deadline
+    EXPECT_TRUE(ratmw_GetTimeToNextDeadline(&timer_wheel, 1060U, &time_to_next_deadline));
+    EXPECT_EQ(time_to_next_deadline, 540U);
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, 1599U, &timer_id));
+    EXPECT_TRUE(ratmw_GetExpiredTimer(&timer_wheel, 1600U, &timer_id));
+    EXPECT_EQ(timer_id, 3U);
+
+    EXPECT_TRUE(ratmw_GetTimeToNextDeadline(&timer_wheel, 1600U, &time_to_next_deadline));
+    EXPECT_EQ(time_to_next_deadline, 99400U);
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, 100999U, &timer_id));
+    EXPECT_TRUE(ratmw_GetExpiredTimer(&timer_wheel, 101000U, &timer_id));
+    EXPECT_EQ(timer_id, 0U);
+    EXPECT_FALSE(ratmw_GetTimeToNextDeadline(&timer_wheel, 101000U, &time_to_next_deadline));
+}
+
+/**
+ * @test        @ID{ratmwTest004} Verify the stop and the restart of timers.
+ *
+ * @details     This test verifies that a stopped timer does not expire, that a restarted timer expires only with its new deadline and that a timer started
+ *              with a delay of 0 is expired immediately.
+ *
+ * Test steps:
+ * - initialize the timer wheel and start two timers
+ * - stop the first timer and verify that it does not expire
+ * - restart the second timer before its deadline and verify that it expires at the new deadline
+ * - start a timer with a delay of 0 and verify that it is expired immediately
+ * - stop an expired timer and a stopped timer and verify that no timer is expired
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No timer is running.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(ratmwTest, ratmwTest004VerifyStopAndRestartTimer)
+{
+    uint16_t timer_id = RATMW_NO_TIMER;
+    uint32_t time_to_next_deadline = 0U;
+
+    ratmw_Init(&timer_wheel, timers, UT_RATMW_NUMBER_OF_TIMERS);
+    ratmw_StartTimer(&timer_wheel, 0U, 5000U, 100U);
+    ratmw_StartTimer(&timer_wheel, 1U, 5000U, 200U);
+
+    // Stopped timer does not expire
+    ratmw_StopTimer(&timer_wheel, 0U);
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, 5150U, &timer_id));
+
+    // Restarted timer expires with its new deadline
+    ratmw_StartTimer(&timer_wheel, 1U, 5150U, 200U);
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, 5349U, &timer_id));
+    EXPECT_TRUE(ratmw_GetExpiredTimer(&timer_wheel, 5350U, &timer_id));
+    EXPECT_EQ(timer_id, 1U);
+
+    // Timer with a delay of 0 is expired immediately
+    ratmw_StartTimer(&timer_wheel, 3U, 6000U, 0U);
+    EXPECT_TRUE(ratmw_GetTimeToNextDeadline(&timer_wheel, 6000U, &time_to_next_deadline));
+    EXPECT_EQ(time_to_next_deadline, 0U);
+
+    // Stop an expired and a stopped timer
+    ratmw_StopTimer(&timer_wheel, 3U);
+    ratmw_StopTimer(&timer_wheel, 0U);
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, 6000U, &timer_id));
+    EXPECT_FALSE(ratmw_GetTimeToNextDeadline(&timer_wheel, 6000U, &time_to_next_deadline));
+}
+
+/**
+ * @test        @ID{ratmwTest005} Verify a current time before the time of the wheel.
+ *
+ * @details     This test verifies that a current time, which lies before the time of the wheel, does not advance the time of a wheel with running timers.
+ *
+ * Test steps:
+ * - initialize the timer wheel and start a timer
+ * - advance the time of the wheel close to the deadline
+ * - call the functions with an earlier current time and verify that the timer is not expired and the time until the deadline is calculated from the earlier
+ *   current time
+ * - start a second timer with the earlier current time and a deadline which is already reached by the time of the wheel and verify that it is expired
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(ratmwTest, ratmwTest005VerifyCurrentTimeBeforeWheelTime)
+{
+    uint16_t timer_id = RATMW_NO_TIMER;
+    uint32_t time_to_next_deadline = 0U;
+
+    ratmw_Init(&timer_wheel, timers, UT_RATMW_NUMBER_OF_TIMERS);
+    ratmw_StartTimer(&timer_wheel, 0U, 100U, 100U);
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, 190U, &timer_id));
+
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, 180U, &timer_id));
+    EXPECT_TRUE(ratmw_GetTimeToNextDeadline(&timer_wheel, 180U, &time_to_next_deadline));
+    EXPECT_EQ(time_to_next_deadline, 20U);
+
+    ratmw_StartTimer(&timer_wheel, 1U, 180U, 5U);
+    EXPECT_TRUE(ratmw_GetExpiredTimer(&timer_wheel, 180U, &timer_id));
+    EXPECT_EQ(timer_id, 1U);
+    EXPECT_FALSE(ratmw_GetExpiredTimer(&timer_wheel, 199U, &timer_id));
+    EXPECT_TRUE(ratmw_GetExpiredTimer(&timer_wheel, 200U, &timer_id));
+    EXPECT_EQ(timer_id, 0U);
+}
+
+/**
+ * @test        @ID{ratmwTest006} Verify the input parameter checks.
+ *
+ * @details     This test verifies that the functions of the timer wheel check their input parameters.
+ *
+ * Test steps:
+ * - initialize the timer wheel
+ * - call all functions with NULL pointers and verify that a ::radef_kInvalidParameter fatal error is thrown
+ * - call the start and stop functions with an invalid timer id and verify that a ::radef_kInvalidParameter fatal error is thrown
+ * - call the start function with a delay greater than ::RATMW_MAX_DELAY and verify that a ::radef_kInvalidParameter fatal error is thrown
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(ratmwTest, ratmwTest006VerifyInputParameterCheck)
+{
+    uint16_t timer_id = RATMW_NO_TIMER;
+    uint32_t time_to_next_deadline = 0U;
+
+    ratmw_Init(&timer_wheel, timers, UT_RATMW_NUMBER_OF_TIMERS);
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(9).WillRepeatedly(Invoke(this, &ratmwTest::invalidArgumentException));
+
+    // NULL pointers
+    EXPECT_THROW(ratmw_StartTimer(nullptr, 0U, 0U, 1U), std::invalid_argument);
+    EXPECT_THROW(ratmw_StopTimer(nullptr, 0U), std::invalid_argument);
+    EXPECT_THROW(ratmw_GetExpiredTimer(nullptr, 0U, &timer_id), std::invalid_argument);
+    EXPECT_THROW(ratmw_GetExpiredTimer(&timer_wheel, 0U, nullptr), std::invalid_argument);
+    EXPECT_THROW(ratmw_GetTimeToNextDeadline(nullptr, 0U, &time_to_next_deadline), std::invalid_argument);
+    EXPECT_THROW(ratmw_GetTimeToNextDeadline(&timer_wheel, 0U, nullptr), std::invalid_argument);
+
+    // invalid timer id and delay
+    EXPECT_THROW(ratmw_StartTimer(&timer_wheel, UT_RATMW_NUMBER_OF_TIMERS, 0U, 1U), std::invalid_argument);
+    EXPECT_THROW(ratmw_StopTimer(&timer_wheel, UT_RATMW_NUMBER_OF_TIMERS), std::invalid_argument);
+    EXPECT_THROW(ratmw_StartTimer(&timer_wheel, 0U, 0U, RATMW_MAX_DELAY + 1U), std::invalid_argument);
+}
+
+/** @}*/
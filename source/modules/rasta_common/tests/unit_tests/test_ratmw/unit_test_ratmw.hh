@@ -0,0 +1,76 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_ratmw.hh
+ *
+ * @author Martin Kuhn, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version bfa7bcef58ee9ac7504a4ae227294d26848e4b9f
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Header file for unit tests of the timer wheel module of the common package.
+ */
+
+#ifndef SOURCE_MODULES_RASTA_COMMON_TESTS_UNIT_TESTS_TEST_RATMW_UNIT_TEST_RATMW_HH_
+#define SOURCE_MODULES_RASTA_COMMON_TESTS_UNIT_TESTS_TEST_RATMW_UNIT_TEST_RATMW_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+// clang-format off
+#include <cmath>
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "rasta_common/ratmw_rasta_timer_wheel.h"
+#include "rasys_mock.hh"
+// clang-format on
+
+using testing::_;
+using testing::Invoke;
+using testing::StrictMock;
+using testing::NaggyMock;
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+#define UT_RATMW_NUMBER_OF_TIMERS 4             ///< number of timers of the test timer wheel
+
+// -----------------------------------------------------------------------------
+// Test class definiton
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test fixture class for the timer wheel module
+ *
+ */
+class ratmwTest : public ::testing::Test
+{
+public:
+    ratmwTest()
+    {
+
+    }
+    ~ratmwTest()
+    {
+
+    }
+
+    /**
+    * @brief Throw invalid argument exception
+    * This function is used to throw an invalid argument exception mocked function call action.
+    */
+    void invalidArgumentException(){
+        throw std::invalid_argument("Invalid argument!");
+    }
+
+    ratmw_TimerWheel timer_wheel = {};                      ///< timer wheel under test
+    ratmw_Timer timers[UT_RATMW_NUMBER_OF_TIMERS] = {};     ///< timers of the timer wheel under test
+
+    StrictMock<rasysMock>   rasys_mock;        ///< mock for the rasta system adapter class
+};
+
+#endif  // SOURCE_MODULES_RASTA_COMMON_TESTS_UNIT_TESTS_TEST_RATMW_UNIT_TEST_RATMW_HH_
@@ -0,0 +1,244 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redcrc_benchmark.cc
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Microbenchmark of the check code calculation of the redundancy layer.
+ *
+ * For every check code type with a CRC and several message sizes up to the maximum message size, the benchmark measures the time per message byte of:
+ * - table: the byte-wise table lookup algorithm with the first lookup table, which is the reference of the other algorithms
+ * - slicing: ::redcrc_CalculateCrc with the slicing-by-8 algorithm
+ * - batch: ::redcrc_CalculateCrcBatch with the slicing-by-8 algorithm in parallel lanes for a group of messages
+ * - hardware: ::redcrc_CalculateCrc with the CPU instructions selected by ::redcrc_Init, i.e. the SSE4.2 (or ARMv8) CRC32C instructions for check code
+ *   type C and the PCLMULQDQ carry-less multiplication folding for check code types B, D and E. "n/a", if the CPU does not support the instructions.
+ * .
+ * The speedup of the hardware algorithm (or of the slicing algorithm without hardware support) against the byte-wise table algorithm is reported. The results
+ * of all algorithms are compared, before the measurement starts. For meaningful results, the benchmark must be built with CMAKE_BUILD_TYPE=Release.
+ *
+ * Usage: redcrc_benchmark [duration_in_ms]
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/rasys_rasta_system_adapter.h"
+#include "rasta_redundancy/redcty_red_config_types.h"
+#include "redcrc_red_crc.h"
+#include "redcrc_red_crc_tables.h"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Maximum size of a message without check code [bytes].
+ */
+#define MAX_DATA_SIZE (RADEF_RED_LAYER_MESSAGE_HEADER_SIZE + RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE)
+
+/**
+ * @brief Number of messages, whose check code is calculated together.
+ */
+#define NUMBER_OF_MESSAGES (8U)
+
+/**
+ * @brief Number of calculations between two reads of the clock.
+ */
+#define CALCULATIONS_PER_CLOCK_READ (64U)
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+namespace {
+
+/**
+ * @brief Parameters of the byte-wise table algorithm of a check code type.
+ */
+struct TableParameters {
+  redcty_CheckCodeType check_code_type;  ///< Check code type
+  const char *name;                      ///< Name of the check code type
+  bool reflected;                        ///< True, if the input and the output are reflected
+  uint32_t initial_value;                ///< Initial value of the CRC register (reflected, if the input is reflected)
+  uint32_t final_xor;                    ///< Value for the final xor operation
+  uint32_t width;                        ///< Length of the CRC [bits]
+};
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+const std::array<TableParameters, REDCRC_TABLE_TYPES> kCheckCodes = {{
+    {redcty_kCheckCodeB, "B", false, 0x00000000U, 0x00000000U, 32U},
+    {redcty_kCheckCodeC, "C", true, 0xFFFFFFFFU, 0xFFFFFFFFU, 32U},
+    {redcty_kCheckCodeD, "D", true, 0x00000000U, 0x00000000U, 16U},
+    {redcty_kCheckCodeE, "E", true, 0x00000000U, 0x00000000U, 16U},
+}};  ///< Check code types with a CRC
+const std::array<uint16_t, 6U> kDataSizes = {RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE, 64U, 256U, 512U, 1100U, MAX_DATA_SIZE};  ///< Message sizes [bytes]
+
+std::array<std::array<uint8_t, MAX_DATA_SIZE>, NUMBER_OF_MESSAGES> messages;  ///< Message data
+std::array<uint32_t, NUMBER_OF_MESSAGES> crcs;                                ///< Calculated check code of every message
+std::array<redcrc_CrcBatchEntry, NUMBER_OF_MESSAGES> batch_entries;           ///< Batch entries of all messages
+volatile uint32_t crc_sink = 0U;                                              ///< Keeps the calculated check codes alive
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Calculate the check code of a message with the byte-wise table algorithm.
+ */
+uint32_t CalculateCrcTable(const TableParameters &parameters, const uint16_t data_size, const uint8_t *const data) {
+  const uint32_t(*const kTable) = redcrc_kCrcTables[parameters.check_code_type - redcty_kCheckCodeB][0U];
+  uint32_t crc_register = parameters.initial_value;
+  if (parameters.reflected) {
+    for (uint16_t index = 0U; index < data_size; ++index) {
+      crc_register = (crc_register >> 8U) ^ kTable[(crc_register ^ data[index]) & 0x000000FFU];
+    }
+  } else {
+    // The lookup table values are aligned to the most significant bit
+    crc_register <<= (32U - parameters.width);
+    for (uint16_t index = 0U; index < data_size; ++index) {
+      crc_register = (crc_register << 8U) ^ kTable[(crc_register >> 24U) ^ data[index]];
+    }
+    crc_register >>= (32U - parameters.width);
+  }
+  const uint32_t kMask = (parameters.width == 32U) ? 0xFFFFFFFFU : ((1U << parameters.width) - 1U);
+  return (crc_register ^ parameters.final_xor) & kMask;
+}
+
+/**
+ * @brief Repeat a calculation of the check codes of all messages for a duration and measure the time per message byte [ns].
+ */
+template <typename Calculation>
+double Measure(const Calculation &calculation, const uint16_t data_size, const uint32_t duration) {
+  // Warm up the caches and the branch predictors
+  for (uint32_t calculation_index = 0U; calculation_index < CALCULATIONS_PER_CLOCK_READ; ++calculation_index) {
+    calculation();
+  }
+
+  uint64_t number_of_calculations = 0U;
+  const std::chrono::steady_clock::time_point kBegin = std::chrono::steady_clock::now();
+  const std::chrono::steady_clock::time_point kEnd = kBegin + std::chrono::milliseconds(duration);
+  std::chrono::steady_clock::time_point now = kBegin;
+  while (now < kEnd) {
+    for (uint32_t calculation_index = 0U; calculation_index < CALCULATIONS_PER_CLOCK_READ; ++calculation_index) {
+      calculation();
+      crc_sink = crc_sink ^ crcs[0U];
+    }
+    number_of_calculations += CALCULATIONS_PER_CLOCK_READ;
+    now = std::chrono::steady_clock::now();
+  }
+  return std::chrono::duration<double, std::nano>(now - kBegin).count() / (static_cast<double>(number_of_calculations) * NUMBER_OF_MESSAGES * data_size);
+}
+
+/**
+ * @brief Verify the calculated check codes against the byte-wise table algorithm.
+ */
+void VerifyCrcs(const TableParameters &parameters, const uint16_t data_size, const char *const algorithm) {
+  for (uint32_t message = 0U; message < NUMBER_OF_MESSAGES; ++message) {
+    if (crcs[message] != CalculateCrcTable(parameters, data_size, messages[message].data())) {
+      std::fprintf(stderr, "Check code %s of the %s algorithm differs for data size %u\n", parameters.name, algorithm, data_size);
+      std::exit(EXIT_FAILURE);
+    }
+  }
+}
+
+/**
+ * @brief Measure all algorithms of a check code type and print the results.
+ */
+void MeasureCheckCode(const TableParameters &parameters, const uint32_t duration) {
+  redcrc_CrcEngine hardware_engine = {};
+  redcrc_Init(&hardware_engine, parameters.check_code_type);
+  const bool kHardwareEnabled = hardware_engine.hardware_crc32c_enabled || hardware_engine.hardware_folding_enabled;
+  // The benchmark disables the CPU instructions of the second engine to measure the slicing-by-8 algorithm on the same CPU
+  redcrc_CrcEngine slicing_engine = hardware_engine;
+  slicing_engine.hardware_crc32c_enabled = false;
+  slicing_engine.hardware_folding_enabled = false;
+
+  for (const uint16_t kDataSize : kDataSizes) {
+    const auto kTable = [&parameters, kDataSize]() {
+      for (uint32_t message = 0U; message < NUMBER_OF_MESSAGES; ++message) {
+        crcs[message] = CalculateCrcTable(parameters, kDataSize, messages[message].data());
+      }
+    };
+    const auto kSingle = [kDataSize](const redcrc_CrcEngine *const engine) {
+      for (uint32_t message = 0U; message < NUMBER_OF_MESSAGES; ++message) {
+        redcrc_CalculateCrc(engine, kDataSize, messages[message].data(), &crcs[message]);
+      }
+    };
+    const auto kSlicing = [&kSingle, &slicing_engine]() { kSingle(&slicing_engine); };
+    const auto kHardware = [&kSingle, &hardware_engine]() { kSingle(&hardware_engine); };
+    const auto kBatch = [kDataSize, &slicing_engine]() {
+      for (uint32_t message = 0U; message < NUMBER_OF_MESSAGES; ++message) {
+        batch_entries[message] = {kDataSize, messages[message].data(), &crcs[message]};
+      }
+      redcrc_CalculateCrcBatch(&slicing_engine, NUMBER_OF_MESSAGES, batch_entries.data());
+    };
+
+    kSlicing();
+    VerifyCrcs(parameters, kDataSize, "slicing");
+    kBatch();
+    VerifyCrcs(parameters, kDataSize, "batch");
+    kHardware();
+    VerifyCrcs(parameters, kDataSize, "hardware");
+
+    const double kTableTime = Measure(kTable, kDataSize, duration);
+    const double kSlicingTime = Measure(kSlicing, kDataSize, duration);
+    const double kBatchTime = Measure(kBatch, kDataSize, duration);
+    if (kHardwareEnabled) {
+      const double kHardwareTime = Measure(kHardware, kDataSize, duration);
+      std::printf("%6s %10u %12.3f %12.3f %12.3f %12.3f %8.2f\n", parameters.name, kDataSize, kTableTime, kSlicingTime, kBatchTime, kHardwareTime,
+                  kTableTime / kHardwareTime);
+    } else {
+      std::printf("%6s %10u %12.3f %12.3f %12.3f %12s %8.2f\n", parameters.name, kDataSize, kTableTime, kSlicingTime, kBatchTime, "n/a",
+                  kTableTime / kSlicingTime);
+    }
+  }
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// System adapter functions of the benchmark
+// -----------------------------------------------------------------------------
+
+extern "C" {
+void rasys_FatalError(const radef_RaStaReturnCode error_reason) {
+  std::fprintf(stderr, "Fatal error %d\n", static_cast<int>(error_reason));
+  std::abort();
+}
+}
+
+// -----------------------------------------------------------------------------
+// Main
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+  const uint32_t kDuration = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 100U;
+
+  for (uint32_t message = 0U; message < NUMBER_OF_MESSAGES; ++message) {
+    for (uint32_t index = 0U; index < messages[message].size(); ++index) {
+      messages[message][index] = static_cast<uint8_t>((message * 31U) + index);
+    }
+  }
+
+  std::printf("messages per calculation: %u, time per byte [ns]\n", NUMBER_OF_MESSAGES);
+  std::printf("%6s %10s %12s %12s %12s %12s %8s\n", "check", "data size", "table", "slicing", "batch", "hardware", "speedup");
+  for (const TableParameters &kParameters : kCheckCodes) {
+    MeasureCheckCode(kParameters, kDuration);
+  }
+
+  return 0;
+}
@@ -43,6 +43,15 @@
 // Global Type Definitions
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Handle of a RedL instance.
+ *
+ * Every instance owns the state of an independent RedL with its own configuration and redundancy channels. The handle is returned by ::redint_Init and is
+ * passed to all other RedL interface functions, to the transport interface and to the notification functions. The content of the instance is private to the
+ * RedL.
+ */
+typedef struct redint_Instance redint_Instance;
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -57,29 +66,34 @@ extern "C" {
 /**
  * @brief Initialize the RedL.
  *
- * This function is used to initialize the red_interface module. It checks the passed ::redcty_RedundancyLayerConfiguration configuration and if it is
- * valid, it initializes the internal data, the state machine module, the defer queue module, the received buffer module and the core module.
+ * This function is used to initialize a new RedL instance. It checks the passed ::redcty_RedundancyLayerConfiguration configuration and if it is valid, it
+ * initializes the internal data, the state machine module, the defer queue module, the received buffer module and the core module of the instance. Every
+ * instance needs its own configuration. The handle of the initialized instance is returned to the application, which passes it to all other RedL interface
+ * functions.
  *
- * @pre The RedL interface module must not be initialized, otherwise a ::radef_kAlreadyInitialized error is returned.
+ * @pre An instance must be available, otherwise a ::radef_kAlreadyInitialized error is returned. At most ::RADEF_MAX_NUMBER_OF_RED_INSTANCES instances can be
+ * initialized.
  *
  * @param [in] redundancy_layer_configuration Pointer to RedL configuration. More details about valid configuration can be found
  * directly in ::redcty_RedundancyLayerConfiguration. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
+ * @param [out] instance Pointer to the handle of the initialized RedL instance. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
  * @return ::radef_kNoError -> successful initialized
- * @return ::radef_kAlreadyInitialized -> module already initialized
+ * @return ::radef_kAlreadyInitialized -> all instances already initialized
  * @return ::radef_kInvalidConfiguration -> invalid configuration data
  * @return ::radef_kInvalidParameter -> invalid parameter
  */
-radef_RaStaReturnCode redint_Init(const redcty_RedundancyLayerConfiguration* const redundancy_layer_configuration);
+radef_RaStaReturnCode redint_Init(const redcty_RedundancyLayerConfiguration* const redundancy_layer_configuration, redint_Instance** const instance);
 
 /**
  * @brief Get the initialization state of the RedL.
  *
- * This function returns the initialization state of the RedL.
+ * This function returns the initialization state of a RedL instance.
  *
+ * @param [in] instance Pointer to the RedL instance returned by ::redint_Init. A NULL pointer is reported as not initialized.
  * @return ::radef_kNoError -> successful initialized
  * @return ::radef_kNotInitialized -> not initialized
  */
-radef_RaStaReturnCode redint_GetInitializationState(void);
+radef_RaStaReturnCode redint_GetInitializationState(const redint_Instance* const instance);
 
 /**
  * @brief Open a given redundancy channel.
@@ -87,28 +101,32 @@ radef_RaStaReturnCode redint_GetInitializationState(void);
  * This function initializes the internal data of a given redundancy channel and opens a redundancy channel by calling redstm_ProcessChannelStateMachine() with
  * the ::redstm_kRedundancyChannelEventOpen event.
  *
- * @pre The RedL interface module must be initialized, otherwise a ::radef_kNotInitialized error is returned.
+ * @pre The RedL instance must be initialized, otherwise a ::radef_kNotInitialized error is returned.
  *
+ * @param [in] instance Pointer to the RedL instance returned by ::redint_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
  * @param [in] redundancy_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of redundancy channels.
  * @return ::radef_kNoError -> successful operation
  * @return ::radef_kNotInitialized -> module not initialized
  * @return ::radef_kInvalidParameter -> invalid parameter
  */
-radef_RaStaReturnCode redint_OpenRedundancyChannel(const uint32_t redundancy_channel_id);
+radef_RaStaReturnCode redint_OpenRedundancyChannel(redint_Instance* const instance, const uint32_t redundancy_channel_id);
 
 /**
  * @brief Close a given redundancy channel.
  *
  * This function closes a given redundancy channel by calling redstm_ProcessChannelStateMachine() with the ::redstm_kRedundancyChannelEventClose event.
  *
- * @pre The RedL interface module must be initialized, otherwise a ::radef_kNotInitialized error is returned.
+ * @pre The RedL instance must be initialized, otherwise a ::radef_kNotInitialized error is returned.
  *
+ * @param [in] instance Pointer to the RedL instance returned by ::redint_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
  * @param [in] redundancy_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of redundancy channels.
  * @return ::radef_kNoError -> successful operation
  * @return ::radef_kNotInitialized -> module not initialized
  * @return ::radef_kInvalidParameter -> invalid parameter
  */
-radef_RaStaReturnCode redint_CloseRedundancyChannel(const uint32_t redundancy_channel_id);
+radef_RaStaReturnCode redint_CloseRedundancyChannel(redint_Instance* const instance, const uint32_t redundancy_channel_id);
 
 /**
  * @brief Send a message over a given redundancy channel.
@@ -116,8 +134,10 @@ radef_RaStaReturnCode redint_CloseRedundancyChannel(const uint32_t redundancy_ch
  * This function copies the given message to the send buffer of the given redundancy channel and triggers the sending of this message by calling
  * redstm_ProcessChannelStateMachine() with the ::redstm_kRedundancyChannelEventSendData event.
  *
- * @pre The RedL interface module must be initialized, otherwise a ::radef_kNotInitialized error is returned.
+ * @pre The RedL instance must be initialized, otherwise a ::radef_kNotInitialized error is returned.
  *
+ * @param [in] instance Pointer to the RedL instance returned by ::redint_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
  * @param [in] redundancy_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of redundancy channels.
  * @param [in] message_size The size of the message data [bytes] must be in the range from ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE to
  * ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, else a ::radef_kInvalidMessageSize error is returned.
@@ -129,7 +149,8 @@ radef_RaStaReturnCode redint_CloseRedundancyChannel(const uint32_t redundancy_ch
  * @return ::radef_kInvalidMessageSize -> invalid message size
  * @return ::radef_kInvalidOperationInCurrentState -> sending messages is not allowed in the current redundancy channel state machine state
  */
-radef_RaStaReturnCode redint_SendMessage(const uint32_t redundancy_channel_id, const uint16_t message_size, const uint8_t* const message_data);
+radef_RaStaReturnCode redint_SendMessage(redint_Instance* const instance, const uint32_t redundancy_channel_id, const uint16_t message_size,
+                                         const uint8_t* const message_data);
 
 /**
  * @brief Read a received message from a given redundancy channel.
@@ -137,8 +158,10 @@ radef_RaStaReturnCode redint_SendMessage(const uint32_t redundancy_channel_id, c
  * This function reads a received message from the received buffer of a given redundancy channel. If no message is in the received buffer, a
  * ::radef_kNoMessageReceived error is returned.
  *
- * @pre The RedL interface module must be initialized, otherwise a ::radef_kNotInitialized error is returned.
+ * @pre The RedL instance must be initialized, otherwise a ::radef_kNotInitialized error is returned.
  *
+ * @param [in] instance Pointer to the RedL instance returned by ::redint_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
  * @param [in] redundancy_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of redundancy channels.
  * @param [in] buffer_size Size of the buffer [bytes] available in the upper layer. Valid range: ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE <= value <=
  * ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE. If the size of the message to read is greater then the buffer size a ::radef_kInvalidBufferSize error is returned.
@@ -150,24 +173,51 @@ radef_RaStaReturnCode redint_SendMessage(const uint32_t redundancy_channel_id, c
  * @return ::radef_kInvalidParameter -> invalid parameter
  * @return ::radef_kInvalidBufferSize -> invalid buffer size
  */
-radef_RaStaReturnCode redint_ReadMessage(const uint32_t redundancy_channel_id, const uint16_t buffer_size, uint16_t* const message_size,
-                                         uint8_t* const message_buffer);
+radef_RaStaReturnCode redint_ReadMessage(redint_Instance* const instance, const uint32_t redundancy_channel_id, const uint16_t buffer_size,
+                                         uint16_t* const message_size, uint8_t* const message_buffer);
 
 /**
  * @brief Check redundancy layer timings and read pending messages form the transport channels.
  *
- * This function calls the internal function ReceivedMessagesPolling() and checks the defer queue timeout by calling reddfq_IsTimeout() and
- * redstm_ProcessChannelStateMachine() with the ::redstm_kRedundancyChannelEventDeferTimeout event, for all configured redundancy channels which are in the
- * ::redstm_kRedundancyChannelStateUp state.
+ * This function calls the internal function ReceivedMessagesPolling() for all configured redundancy channels which are in the
+ * ::redstm_kRedundancyChannelStateUp state. Afterwards it checks the defer queue timeout of the redundancy channels returned by reddfq_GetExpiredChannel()
+ * which are in the ::redstm_kRedundancyChannelStateUp state. As long as reddfq_IsTimeout() reports a timeout, redstm_ProcessChannelStateMachine() is called
+ * with the ::redstm_kRedundancyChannelEventDeferTimeout event. The effort of the timeout checks therefore depends on the number of expiring defer timers.
  *
- * @pre The RedL interface module must be initialized, otherwise a ::radef_kNotInitialized error is returned.
+ * @remark Every ::redstm_kRedundancyChannelEventDeferTimeout event delivers the message with the oldest sequence number and its consecutive successors. When
+ * several messages of a redundancy channel with gaps in between are timed out, they are all delivered within one call, oldest sequence number first,
+ * and not only one of them per call. The defer timer of a redundancy channel only expires again, when the message received first is removed from the
+ * defer queue. A timed out message received first, which is not the message with the oldest sequence number, would otherwise stay in the defer queue
+ * after the expiry of the defer timer.
+ *
+ * @pre The RedL instance must be initialized, otherwise a ::radef_kNotInitialized error is returned.
  *
  * @remark This function must be called periodically, in a appropriate interval related to the configured timings.
  *
+ * @param [in] instance Pointer to the RedL instance returned by ::redint_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
+ * @return ::radef_kNoError -> successful operation
+ * @return ::radef_kNotInitialized -> module not initialized
+ */
+radef_RaStaReturnCode redint_CheckTimings(redint_Instance* const instance);
+
+/**
+ * @brief Get the time until the next redundancy layer timing deadline.
+ *
+ * This function returns the time until the defer queue timeout of the next redundancy channel elapses. The application can use it to wait until
+ * ::redint_CheckTimings must be called again, unless a message is received before.
+ *
+ * @pre The RedL instance must be initialized, otherwise a ::radef_kNotInitialized error is returned.
+ *
+ * @param [in] instance Pointer to the RedL instance returned by ::redint_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
+ * @param [out] time_to_next_deadline Pointer to the time until the next deadline [ms]. 0 if a deadline is already reached and UINT32_MAX if no defer queue
+ * contains a message. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
  * @return ::radef_kNoError -> successful operation
  * @return ::radef_kNotInitialized -> module not initialized
+ * @return ::radef_kInvalidParameter -> invalid parameter
  */
-radef_RaStaReturnCode redint_CheckTimings(void);
+radef_RaStaReturnCode redint_GetNextDeadline(redint_Instance* const instance, uint32_t* const time_to_next_deadline);
 
 /** @}*/
 
@@ -26,6 +26,7 @@
 #include <stdint.h>
 
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_redundancy/redint_red_interface.h"
 
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
@@ -51,22 +52,24 @@ extern "C" {
  *
  * This function is called by the redundancy layer to notify the upper layer that a received message is ready to be read on a specific redundancy channel.
  *
+ * @param [in] instance Handle of the RedL instance, which sends the notification.
  * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of redundancy channels.
  */
-void rednot_MessageReceivedNotification(const uint32_t red_channel_id);
+void rednot_MessageReceivedNotification(redint_Instance* const instance, const uint32_t red_channel_id);
 
 /**
  * @brief Redundancy layer diagnostic notification function to SafRetL adapter.
  *
  * This function is called by the redundancy layer to notify the upper layer about new diagnostic data from a specific redundancy channel.
  *
+ * @param [in] instance Handle of the RedL instance, which sends the notification.
  * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of redundancy channels.
  * @param [in] tr_channel_id Transport channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_CHANNELS *
  * ::RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS.
  * @param [in] TransportChannelDiagnosticData Transport channel diagnostic data structure. Structure and valid ranges can be found in
  * ::radef_TransportChannelDiagnosticData.
  */
-void rednot_DiagnosticNotification(const uint32_t red_channel_id, const uint32_t tr_channel_id,
+void rednot_DiagnosticNotification(redint_Instance* const instance, const uint32_t red_channel_id, const uint32_t tr_channel_id,
                                    const radef_TransportChannelDiagnosticData TransportChannelDiagnosticData);
 
 /** @}*/
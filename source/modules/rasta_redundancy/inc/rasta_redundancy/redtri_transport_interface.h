@@ -28,6 +28,7 @@
 #include <stdint.h>
 
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_redundancy/redint_red_interface.h"
 
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
@@ -62,13 +63,16 @@ void redtri_Init(void);
  * This function is used to send a RedL message over a specific transport channel of the transport layer. The RedL only defines the interface function, the
  * implementation of this interface function must be done in the transport layer.
  *
+ * @param [in] instance Handle of the RedL instance, which uses the transport channel. The transport layer uses it to map the transport channel id to the
+ * transport channel assigned to this RedL instance.
  * @param [in] transport_channel_id Transport channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_CHANNELS *
  * ::RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS.
  * @param [in] message_size Size of the message data [bytes]. Valid range: ::RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE <= value <=
  * ::RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE.
  * @param [in] message_data Pointer to message data array. For the message data the full value range is valid and usable.
  */
-void redtri_SendMessage(const uint32_t transport_channel_id, const uint16_t message_size, const uint8_t* const message_data);
+void redtri_SendMessage(redint_Instance* const instance, const uint32_t transport_channel_id, const uint16_t message_size,
+                        const uint8_t* const message_data);
 
 /**
  * @brief Read a received RedL message from a transport channel.
@@ -76,6 +80,8 @@ void redtri_SendMessage(const uint32_t transport_channel_id, const uint16_t mess
  * This function is used to read a RedL message from a specific transport channel of the transport layer. The RedL only defines the interface function, the
  * implementation of this interface function must be done in the transport layer.
  *
+ * @param [in] instance Handle of the RedL instance, which uses the transport channel. The transport layer uses it to map the transport channel id to the
+ * transport channel assigned to this RedL instance.
  * @param [in] transport_channel_id Transport channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_CHANNELS *
  * ::RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS.
  * @param [in] buffer_size Size of the buffer [bytes]. Valid range: ::RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE <= value <= ::RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE.
@@ -84,8 +90,8 @@ void redtri_SendMessage(const uint32_t transport_channel_id, const uint16_t mess
  * @return radef_kNoError -> successful operation
  * @return radef_kNoMessageReceived -> no message received (used for polling)
  */
-radef_RaStaReturnCode redtri_ReadMessage(const uint32_t transport_channel_id, const uint16_t buffer_size, uint16_t* const message_size,
-                                         uint8_t* const message_buffer);
+radef_RaStaReturnCode redtri_ReadMessage(redint_Instance* const instance, const uint32_t transport_channel_id, const uint16_t buffer_size,
+                                         uint16_t* const message_size, uint8_t* const message_buffer);
 
 /** @}*/
 
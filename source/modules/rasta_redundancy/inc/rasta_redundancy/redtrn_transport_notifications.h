@@ -15,6 +15,7 @@
  * @brief Interface of RaSTA transport layer notifications.
  *
  * This module defines and implements the transport layer message received notification, as it acts as entry point to the RedL for the transport layer.
+ * If the stack is built with ::RADEF_TRANSPORT_INGRESS_RINGS, the transport layer pushes the received messages into the ingress rings of the RedL instead.
  */
 #ifndef REDTRN_TRANSPORT_NOTIFICATIONS_H_
 #define REDTRN_TRANSPORT_NOTIFICATIONS_H_
@@ -24,6 +25,9 @@
 // -----------------------------------------------------------------------------
 #include <stdint.h>
 
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_redundancy/redint_red_interface.h"
+
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
 // -----------------------------------------------------------------------------
@@ -53,11 +57,40 @@ extern "C" {
  * is set. If the associated redundancy channel state machine is not in the up state, the message is read and discarded.
  * If in any case there was no message to read, the received message pending flag of this transport channel is cleared.
  *
+ * @param [in] instance Pointer to the RedL instance, which uses the transport channel. The instance is selected before the message is processed. If the
+ * pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
  * @param [in] transport_channel_id Transport channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_CHANNELS *
  * ::RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS. If the transport channel id is out of range, or the transport channel id is not in the configuration of a
  * redundancy channel, a ::radef_kInvalidParameter fatal error is thrown.
  */
-void redtrn_MessageReceivedNotification(const uint32_t transport_channel_id);
+void redtrn_MessageReceivedNotification(redint_Instance* const instance, const uint32_t transport_channel_id);
+
+#ifdef RADEF_TRANSPORT_INGRESS_RINGS
+/**
+ * @brief Push a received message of the transport layer into the ingress ring of the transport channel.
+ *
+ * This function is called by the I/O thread of the transport layer instead of ::redtrn_MessageReceivedNotification. It copies the message into the ingress
+ * ring of the transport channel and marks the transport channel as pending. The message is processed by the thread running the RedL instance with the next
+ * call of ::redint_CheckTimings. The function does not select the instance and can be called concurrently to the RedL API functions of the instance, but only
+ * by one thread per transport channel.
+ *
+ * @param [in] instance Pointer to the RedL instance, which uses the transport channel. If the pointer is NULL, a ::radef_kInvalidParameter error is
+ * returned.
+ * @param [in] transport_channel_id Transport channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_CHANNELS *
+ * ::RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS. If the transport channel id is out of range, or the transport channel id is not in the configuration of a
+ * redundancy channel, a ::radef_kInvalidParameter error is returned.
+ * @param [in] message_size Size of the message data [bytes]. Valid range: ::RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE <= value <=
+ * ::RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE. If the value is out of range, a ::radef_kInvalidParameter error is returned.
+ * @param [in] message_data Pointer to the message data. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
+ * @return ::radef_kNoError -> message pushed
+ * @return ::radef_kNotInitialized -> RedL instance not initialized
+ * @return ::radef_kInvalidParameter -> invalid parameter
+ * @return ::radef_kReceiveBufferFull -> ingress ring of the transport channel full, the message is dropped and counted in the diagnostic data of the transport
+ * channel
+ */
+radef_RaStaReturnCode redtrn_PushReceivedMessage(redint_Instance* const instance, const uint32_t transport_channel_id, const uint16_t message_size,
+                                                 const uint8_t* const message_data);
+#endif
 
 /** @}*/
 
@@ -0,0 +1,298 @@
+# @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+#
+# @file GenerateCrcTables.py
+#
+# @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+#
+# @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+#
+# @brief CRC lookup table generator
+#
+# Generates the constant lookup tables of the redundancy layer CRC module (redcrc_red_crc_tables.c/.h) for all check code types with a CRC (B to E).
+# The generated files are part of the repository, the generator has to be run again only if the check code types or the table layout change:
+#
+#   python GenerateCrcTables.py <output directory>
+
+import os
+import sys
+
+################################
+# PROPERTIES
+################################
+
+nSpacesIndent = 2
+nValuesPerLine = 8
+
+tableSize = 256
+slicingTables = 8
+crc32cShiftTables = 4
+crc32cStreamSize = 128
+maxWidth = 32
+
+## CRC parameters of the check code types B to E according to the RaSTA standard (width, polynomial, reflected)
+checkCodeTypes = [
+    ('B', 32, 0xEE5B42FD, False),
+    ('C', 32, 0x1EDC6F41, True),
+    ('D', 16, 0x1021, True),
+    ('E', 16, 0x8005, True),
+]
+
+fileHeader = '''/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file {fileName}
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{{-,Initial version,-,-}}
+ *
+ * @brief {brief}
+ *
+ * This file is generated by scripts/GenerateCrcTables.py, do not edit it manually.
+ */
+'''
+
+################################
+# FUNCTIONS
+################################
+
+## @brief   reflect the lower bits of a value
+#
+#  @param   value           value to reflect
+#  @param   numberOfBits    number of bits to reflect
+def reflectBits(value, numberOfBits):
+    reflected = 0
+    for bit in range(numberOfBits):
+        if value & (1 << bit):
+            reflected |= 1 << (numberOfBits - 1 - bit)
+    return reflected
+
+## @brief   generate the slicing-by-8 lookup tables of a check code type
+#
+#  Table 0 is the classic byte-wise lookup table, table n contains the CRC of a byte followed by n zero bytes. For non-reflected CRCs, the values are aligned
+#  to the most significant bit of a uint32_t.
+#
+#  @param   width       CRC width [bits]
+#  @param   polynomial  CRC polynomial without MSB
+#  @param   reflected   true, if input and output are reflected
+def generateSlicingTables(width, polynomial, reflected):
+    mask = (1 << width) - 1
+    tables = [[0] * tableSize for _ in range(slicingTables)]
+    for index in range(tableSize):
+        if reflected:
+            crc = index
+            reflectedPolynomial = reflectBits(polynomial, width)
+            for _ in range(8):
+                crc = (crc >> 1) ^ reflectedPolynomial if crc & 1 else crc >> 1
+        else:
+            crc = index << (width - 8)
+            for _ in range(8):
+                crc = ((crc << 1) ^ polynomial) if crc & (1 << (width - 1)) else crc << 1
+            crc = (crc & mask) << (maxWidth - width)
+        tables[0][index] = crc
+    for table in range(1, slicingTables):
+        for index in range(tableSize):
+            previous = tables[table - 1][index]
+            if reflected:
+                tables[table][index] = (previous >> 8) ^ tables[0][previous & 0xFF]
+            else:
+                tables[table][index] = ((previous << 8) & 0xFFFFFFFF) ^ tables[0][previous >> 24]
+    return tables
+
+## @brief   generate the lookup tables to shift a reflected CRC register over the CRC32C stream size of zero bytes
+#
+#  Table n contains the shifted CRC of byte n of the CRC register.
+#
+#  @param   table   byte-wise lookup table of the reflected CRC
+def generateShiftTables(table):
+    shiftTables = [[0] * tableSize for _ in range(crc32cShiftTables)]
+    for shiftTable in range(crc32cShiftTables):
+        for index in range(tableSize):
+            crc = index << (8 * shiftTable)
+            for _ in range(crc32cStreamSize):
+                crc = (crc >> 8) ^ table[crc & 0xFF]
+            shiftTables[shiftTable][index] = crc
+    return shiftTables
+
+## @brief   calculate x^exponent mod polynomial
+#
+#  @param   exponent    exponent of x
+#  @param   width       CRC width [bits]
+#  @param   polynomial  CRC polynomial without MSB
+def xPowerModPolynomial(exponent, width, polynomial):
+    remainder = 1
+    for _ in range(exponent):
+        remainder <<= 1
+        if remainder & (1 << width):
+            remainder ^= (1 << width) | polynomial
+    return remainder
+
+## @brief   generate the carry-less multiplication folding constants of a check code type
+#
+#  Returns the constants to fold the low and high 64 bits of a block over 128 and 512 bits. For reflected CRCs, the constants are reflected within 64 bits
+#  and use x^(n-1), as the carry-less multiplication of two reflected values yields a result which is shifted by one bit.
+#
+#  @param   width       CRC width [bits]
+#  @param   polynomial  CRC polynomial without MSB
+#  @param   reflected   true, if input and output are reflected
+def generateFoldingConstants(width, polynomial, reflected):
+    if reflected:
+        return [reflectBits(xPowerModPolynomial(exponent, width, polynomial), width) << (64 - width) for exponent in (191, 127, 575, 511)]
+    return [xPowerModPolynomial(exponent, width, polynomial) for exponent in (128, 192, 512, 576)]
+
+## @brief   format a list of values as C initializer lines
+#
+#  @param   values      values to format
+#  @param   valueFormat format string of a single value
+#  @param   indent      indentation of the lines
+def formatValues(values, valueFormat, indent):
+    lines = []
+    for start in range(0, len(values), nValuesPerLine):
+        lines.append(indent + ', '.join(valueFormat.format(v) for v in values[start:start + nValuesPerLine]) + ',')
+    lines[-1] = lines[-1][:-1]
+    return lines
+
+## @brief   write the header file
+#
+#  @param   path    output directory
+def writeHeaderFile(path):
+    fileName = 'redcrc_red_crc_tables.h'
+    guard = 'REDCRC_RED_CRC_TABLES_H_'
+    lines = fileHeader.format(fileName=fileName, brief='Interface of the constant lookup tables of the RaSTA redundancy layer CRC module.').splitlines()
+    lines += [
+        '#ifndef ' + guard,
+        '#define ' + guard,
+        '',
+        '// -----------------------------------------------------------------------------',
+        '// Includes',
+        '// -----------------------------------------------------------------------------',
+        '#include <stdint.h>',
+        '',
+        '// -----------------------------------------------------------------------------',
+        '// Global Macro Definitions',
+        '// -----------------------------------------------------------------------------',
+        '',
+        '#define REDCRC_TABLE_TYPES ({}U)           ///< Number of check code types with a CRC (check code types B to E) [types]'.format(len(checkCodeTypes)),
+        '#define REDCRC_TABLE_SIZE ({}U)          ///< Size of a CRC lookup table [elements]'.format(tableSize),
+        '#define REDCRC_SLICING_TABLES ({}U)        ///< Number of CRC lookup tables for the slicing-by-8 algorithm [tables]'.format(slicingTables),
+        '#define REDCRC_CRC32C_SHIFT_TABLES ({}U)   ///< Number of lookup tables to shift a CRC32C over ::REDCRC_CRC32C_STREAM_SIZE zero bytes [tables]'.format(
+            crc32cShiftTables),
+        '#define REDCRC_CRC32C_STREAM_SIZE ({}U)  ///< Size of each of the three interleaved streams of the hardware CRC32C calculation [bytes]'.format(
+            crc32cStreamSize),
+        '',
+        '// -----------------------------------------------------------------------------',
+        '// Global Type Definitions',
+        '// -----------------------------------------------------------------------------',
+        '',
+        '/**',
+        ' * @brief Typedef for the constants of the carry-less multiplication CRC calculation.',
+        ' *',
+        ' * Every constant is x^n mod P for the polynomial P of the check code type. For reflected CRCs, the constants are reflected within 64 bits and use x^(n-1),',
+        ' * as the carry-less multiplication of two reflected values yields a result which is shifted by one bit.',
+        ' */',
+        '//lint -save -e9045 (structures are defined globally)',
+        'typedef struct {',
+        '  uint64_t fold_128_low;   ///< Constant to fold the low 64 bits of a block over 128 bits',
+        '  uint64_t fold_128_high;  ///< Constant to fold the high 64 bits of a block over 128 bits',
+        '  uint64_t fold_512_low;   ///< Constant to fold the low 64 bits of a block over 512 bits',
+        '  uint64_t fold_512_high;  ///< Constant to fold the high 64 bits of a block over 512 bits',
+        '} redcrc_FoldingConstants;',
+        '//lint -restore',
+        '',
+        '// -----------------------------------------------------------------------------',
+        '// Global Const Declarations',
+        '// -----------------------------------------------------------------------------',
+        '',
+        '/**',
+        ' * @brief The CRC lookup tables for the slicing-by-8 algorithm of the check code types B to E, indexed by (check code type - ::redcty_kCheckCodeB).',
+        ' *',
+        ' * Table 0 is the classic byte-wise lookup table. Table n contains the CRC of a byte followed by n zero bytes. For non-reflected CRCs, the table values are',
+        ' * aligned to the most significant bit of a uint32_t.',
+        ' */',
+        'extern const uint32_t redcrc_kCrcTables[REDCRC_TABLE_TYPES][REDCRC_SLICING_TABLES][REDCRC_TABLE_SIZE];',
+        '',
+        '/**',
+        ' * @brief Lookup tables to shift a CRC32C (check code type C) over ::REDCRC_CRC32C_STREAM_SIZE zero bytes.',
+        ' *',
+        ' * Used to combine the CRCs of the interleaved streams of the hardware CRC32C calculation. Table n contains the shifted CRC of byte n of the CRC.',
+        ' */',
+        'extern const uint32_t redcrc_kCrc32cShiftTables[REDCRC_CRC32C_SHIFT_TABLES][REDCRC_TABLE_SIZE];',
+        '',
+        '/**',
+        ' * @brief The constants of the carry-less multiplication CRC calculation of the check code types B to E, indexed by (check code type - ::redcty_kCheckCodeB).',
+        ' */',
+        'extern const redcrc_FoldingConstants redcrc_kFoldingConstants[REDCRC_TABLE_TYPES];',
+        '',
+        '#endif  // ' + guard,
+    ]
+    writeFile(os.path.join(path, fileName), lines)
+
+## @brief   write the source file
+#
+#  @param   path    output directory
+def writeSourceFile(path):
+    fileName = 'redcrc_red_crc_tables.c'
+    indent = ' ' * nSpacesIndent
+    lines = fileHeader.format(fileName=fileName, brief='Constant lookup tables of the RaSTA redundancy layer CRC module.').splitlines()
+    lines += [
+        '',
+        '// -----------------------------------------------------------------------------',
+        '// Includes',
+        '// -----------------------------------------------------------------------------',
+        '#include "redcrc_red_crc_tables.h"  // NOLINT(build/include_subdir)',
+        '',
+        '#include <stdint.h>',
+        '',
+        '// -----------------------------------------------------------------------------',
+        '// Global Constant Definitions',
+        '// -----------------------------------------------------------------------------',
+        '',
+        'const uint32_t redcrc_kCrcTables[REDCRC_TABLE_TYPES][REDCRC_SLICING_TABLES][REDCRC_TABLE_SIZE] = {',
+    ]
+    allTables = [generateSlicingTables(width, polynomial, reflected) for (_, width, polynomial, reflected) in checkCodeTypes]
+    for typeIndex, (name, width, polynomial, reflected) in enumerate(checkCodeTypes):
+        lines.append('{}{{  // Check code type {}: CRC{} with polynomial 0x{:X}'.format(indent, name, width, polynomial))
+        for table in range(slicingTables):
+            lines.append('{}{{'.format(indent * 2))
+            lines += formatValues(allTables[typeIndex][table], '0x{:08X}U', indent * 3)
+            lines.append('{}}}{}'.format(indent * 2, ',' if table < slicingTables - 1 else ''))
+        lines.append('{}}}{}'.format(indent, ',' if typeIndex < len(checkCodeTypes) - 1 else ''))
+    lines += ['};', '']
+
+    crc32cIndex = [t[0] for t in checkCodeTypes].index('C')
+    shiftTables = generateShiftTables(allTables[crc32cIndex][0])
+    lines.append('const uint32_t redcrc_kCrc32cShiftTables[REDCRC_CRC32C_SHIFT_TABLES][REDCRC_TABLE_SIZE] = {')
+    for shiftTable in range(crc32cShiftTables):
+        lines.append('{}{{'.format(indent))
+        lines += formatValues(shiftTables[shiftTable], '0x{:08X}U', indent * 2)
+        lines.append('{}}}{}'.format(indent, ',' if shiftTable < crc32cShiftTables - 1 else ''))
+    lines += ['};', '']
+
+    lines.append('const redcrc_FoldingConstants redcrc_kFoldingConstants[REDCRC_TABLE_TYPES] = {')
+    for typeIndex, (name, width, polynomial, reflected) in enumerate(checkCodeTypes):
+        constants = generateFoldingConstants(width, polynomial, reflected)
+        lines.append('{}{{0x{:016X}U, 0x{:016X}U, 0x{:016X}U, 0x{:016X}U}}{}  // Check code type {}'.format(
+            indent, *constants, ',' if typeIndex < len(checkCodeTypes) - 1 else ' ', name))
+    lines += ['};']
+    writeFile(os.path.join(path, fileName), lines)
+
+## @brief   write lines to a file
+#
+#  @param   fileName    file to write
+#  @param   lines       lines to write
+def writeFile(fileName, lines):
+    with open(fileName, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+################################
+# MAIN
+################################
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        print('usage: python GenerateCrcTables.py <output directory>')
+        sys.exit(1)
+    writeHeaderFile(sys.argv[1])
+    writeSourceFile(sys.argv[1])
@@ -30,6 +30,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "rasta_common/radef_rasta_definitions.h"
 #include "rasta_redundancy/redcty_red_config_types.h"
 #include "redtyp_red_types.h"  // NOLINT(build/include_subdir)
 
@@ -48,6 +49,8 @@
 typedef struct {
   bool message_in_buffer;                   ///< flag which indicates, that a new unprocessed message is in the message input buffer
   uint32_t transport_channel_id;            ///< transport channel of message in input buffer, used for diagnostics
+  bool check_code_checked;                  ///< flag which indicates, that the check code of the message was already checked by the caller
+  bool check_code_valid;                    ///< result of the check code check of the caller, only used if check_code_checked is set
   redtyp_RedundancyMessage message_buffer;  ///< input buffer for newly received message
 } redcor_InputBuffer;
 //lint -restore
@@ -78,6 +81,33 @@ typedef struct {
 } redcor_RedundancyChannelData;
 //lint -restore
 
+/**
+ * @brief Struct for the data of a RedL core instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  /**
+   * @brief Initialization state of the module. True, if the module is initialized.
+   */
+  bool initialized;
+
+  /**
+   * @brief Pointer to redundancy layer configuration.
+   */
+  const redcty_RedundancyLayerConfiguration *redundancy_configuration;
+
+  /**
+   * @brief Process data of the redundancy channels.
+   */
+  redcor_RedundancyChannelData redundancy_channels[RADEF_MAX_NUMBER_OF_RED_CHANNELS];
+
+  /**
+   * @brief ID of the redundancy core debug logger.
+   */
+  uint16_t logger_id;
+} redcor_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -108,9 +138,10 @@ bool redcor_IsConfigurationValid(const redcty_RedundancyLayerConfiguration *cons
  * @brief Initialize all data of the redundancy layer core.
  *
  * This function is used to initialize the core module. The validity of the configuration is checked by calling the redcor_IsConfigurationValid() function. If
- * the configuration is not valid a ::radef_kInvalidConfiguration fatal error is thrown. It saves the passed redundancy layer configuration. The initialization
- * of the redundancy messages module and the redundancy diagnostics module is called. Finally for all configured channels the ::redcor_InitRedundancyChannelData
- * function is called to properly initialize the data for all configured channels.
+ * the configuration is not valid a ::radef_kInvalidConfiguration fatal error is thrown. It saves the passed redundancy layer configuration and builds the table
+ * of the associated redundancy channels of all configured transport channels. The initialization of the redundancy messages module and the redundancy
+ * diagnostics module is called. Finally for all configured channels the ::redcor_InitRedundancyChannelData function is called to properly initialize the data
+ * for all configured channels.
  *
  * @pre The core module must not be initialized, otherwise a ::radef_kAlreadyInitialized fatal error is thrown.
  *
@@ -119,6 +150,16 @@ bool redcor_IsConfigurationValid(const redcty_RedundancyLayerConfiguration *cons
  */
 void redcor_Init(const redcty_RedundancyLayerConfiguration *const redundancy_layer_configuration);
 
+/**
+ * @brief Select the RedL core instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the RedL core functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void redcor_SelectInstance(const uint32_t instance_index);
+
 /**
  * @brief Initialize the data of a dedicated redundancy channel.
  *
@@ -172,6 +213,27 @@ void redcor_DeferQueueTimeout(const uint32_t red_channel_id);
 void redcor_WriteReceivedMessageToInputBuffer(const uint32_t red_channel_id, const uint32_t transport_channel_id,
                                               const redtyp_RedundancyMessage *const received_message);
 
+/**
+ * @brief Write a received message, whose check code was already checked, to the input buffer.
+ *
+ * This function writes a received message to the input buffer like ::redcor_WriteReceivedMessageToInputBuffer and additionally saves the result of the check
+ * code check. ::redcor_ProcessReceivedMessage then uses this result instead of checking the check code again. It is used by the received message polling,
+ * which checks the check codes of several received messages at once with ::redmsg_CheckMessageCrcBatch.
+ *
+ * @pre The core module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
+ * @param [in] transport_channel_id Transport channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_CHANNELS *
+ * ::RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS. If the transport channel id is out of range, or the transport channel id is not in the configuration of the
+ * specified redundancy channel, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] check_code_valid True, if the check code of the message is valid. The full value range is valid and usable.
+ * @param [in] received_message Pointer to struct containing the message. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * The received_message->message_size must be in the range from ::RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE to ::RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, else a
+ * ::radef_kInvalidParameter fatal error message is thrown.
+ */
+void redcor_WriteCheckedMessageToInputBuffer(const uint32_t red_channel_id, const uint32_t transport_channel_id, const bool check_code_valid,
+                                             const redtyp_RedundancyMessage *const received_message);
+
 /**
  * @brief Clear input buffer message pending flag.
  *
@@ -188,7 +250,8 @@ void redcor_ClearInputBufferMessagePendingFlag(const uint32_t red_channel_id);
  *
  * This function processes a received message from the input buffer. The following tasks are done:
  * - Check if a received message is in the input buffer, else a ::radef_kNoMessageReceived fatal error is thrown.
- * - Check if the message CRC is correct, else the message is ignored
+ * - Check if the message CRC is correct, else the message is ignored. If the message was written with ::redcor_WriteCheckedMessageToInputBuffer, the
+ *   result of the check of the caller is used.
  * - Check that after the initialization only one message with sequence number 0 is processed, else ignore the message
  * - Ignore messages with Seq_pdu < Seq_rx, but update the redundancy channel diagnostics
  * - For messages with Seq_pdu = Seq_rx, add message to received buffer, increase Seq_rx, update the redundancy channel diagnostics
@@ -291,7 +354,9 @@ void redcor_SendMessage(const uint32_t red_channel_id);
 /**
  * @brief Get the associated redundancy channel from a given transport channel.
  *
- * This function gets the redundancy channel, which is associated to the given transport channel.
+ * This function gets the redundancy channel, which is associated to the given transport channel. The redundancy channel is read with
+ * ::reddia_GetAssociatedRedundancyChannel from the transport channel lookup table of the diagnostics module, which is built at the initialization and is
+ * indexed by the transport channel id.
  *
  * @pre The core module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
@@ -24,12 +24,57 @@
 #include "rasta_common/ralog_rasta_logger.h"
 #include "rasta_common/rasys_rasta_system_adapter.h"
 #include "rasta_redundancy/redcty_red_config_types.h"
+#include "redcrc_red_crc_tables.h"  // NOLINT(build/include_subdir)
 
 // -----------------------------------------------------------------------------
 // Local Macro Definitions
 // -----------------------------------------------------------------------------
 
-#define CRC_TABLE_SIZE (256U)  ///< Size of the CRC lookup table [elements]
+#if (!defined(REDCRC_DISABLE_HARDWARE_CRC) && defined(__GNUC__) && defined(__x86_64__))
+/**
+ * @brief Hardware CRC32C available: x86-64 SSE4.2 crc32 instruction, availability is detected at runtime.
+ */
+#define HARDWARE_CRC32C_X86 1
+#define HARDWARE_CRC32C_ARM 0  ///< Hardware CRC32C not available: ARMv8 CRC32C instructions
+/**
+ * @brief Hardware carry-less multiplication available: x86-64 PCLMULQDQ instruction, availability is detected at runtime.
+ */
+#define HARDWARE_CLMUL_X86 1
+#elif (!defined(REDCRC_DISABLE_HARDWARE_CRC) && defined(__GNUC__) && defined(__aarch64__) && defined(__ARM_FEATURE_CRC32))
+#define HARDWARE_CRC32C_X86 0  ///< Hardware CRC32C not available: x86-64 SSE4.2 crc32 instruction
+/**
+ * @brief Hardware CRC32C available: ARMv8 CRC32C instructions, availability is given by the compiler target.
+ */
+#define HARDWARE_CRC32C_ARM 1
+#define HARDWARE_CLMUL_X86 0  ///< Hardware carry-less multiplication not available: x86-64 PCLMULQDQ instruction
+#else
+#define HARDWARE_CRC32C_X86 0  ///< Hardware CRC32C not available: x86-64 SSE4.2 crc32 instruction
+#define HARDWARE_CRC32C_ARM 0  ///< Hardware CRC32C not available: ARMv8 CRC32C instructions
+#define HARDWARE_CLMUL_X86 0   ///< Hardware carry-less multiplication not available: x86-64 PCLMULQDQ instruction
+#endif
+
+#if HARDWARE_CLMUL_X86 != 0
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+#define HARDWARE_CLMUL_TARGET __attribute__((target("pclmul,ssse3")))  ///< Enables the PCLMULQDQ and SSSE3 instructions for a single function
+#else
+#define HARDWARE_CLMUL_TARGET  ///< No hardware carry-less multiplication instructions
+#endif
+
+#if HARDWARE_CRC32C_X86 != 0
+#include <nmmintrin.h>
+#define HARDWARE_CRC32C_TARGET __attribute__((target("sse4.2")))  ///< Enables the SSE4.2 instructions for a single function
+#elif HARDWARE_CRC32C_ARM != 0
+#include <arm_acle.h>
+#define HARDWARE_CRC32C_TARGET  ///< The CRC extension is enabled for the whole compilation unit
+#else
+#define HARDWARE_CRC32C_TARGET  ///< No hardware CRC32C instructions
+#endif
+
+#define CRC_SLICING_BLOCK_SIZE (8U)   ///< Number of data bytes processed per step of the slicing-by-8 algorithm [bytes]
+#define CRC_FOLDING_BLOCK_SIZE (16U)  ///< Size of a data block folded with one carry-less multiplication step [bytes]
+#define CRC_FOLDING_LANES (4U)        ///< Number of data blocks folded in parallel by the carry-less multiplication CRC calculation [blocks]
+#define CRC_BATCH_LANES (4U)          ///< Number of data buffers processed in parallel lanes by ::redcrc_CalculateCrcBatch
 
 // -----------------------------------------------------------------------------
 // Local Type Definitions
@@ -51,15 +96,6 @@ typedef struct {
 // Local Variable Definitions
 // -----------------------------------------------------------------------------
 
-PRIVATE bool redcrc_initialized = false;  ///< Initialization state of the module. True, if the module is initialized.
-
-PRIVATE redcty_CheckCodeType redcrc_check_code_type;  ///< Configured check code type.
-
-PRIVATE uint32_t redcrc_table[CRC_TABLE_SIZE];  ///< The CRC lookup table, calculated by calling GenerateCrcTable().
-
-PRIVATE uint32_t redcrc_crc_mask;      ///< CRC mask for internal CRC computation
-PRIVATE uint32_t redcrc_crc_high_bit;  ///< CRC high bit for internal CRC computation
-
 // -----------------------------------------------------------------------------
 // Local Function Prototypes
 // -----------------------------------------------------------------------------
@@ -81,16 +117,177 @@ PRIVATE uint32_t redcrc_crc_high_bit;  ///< CRC high bit for internal CRC comput
 static uint32_t ReflectBits(uint32_t value_in, uint16_t number_of_bits);
 
 /**
- * @brief Generates a CRC lookup table according to the configured ::redcrc_check_code_type.
+ * @brief Calculates the CRC register over a data buffer with the slicing-by-8 table algorithm.
  *
- * This function generates a CRC lookup table and sets the variables redcrc_crc_mask and redcrc_crc_high_bit according to the options in the configured
- * ::redcrc_check_code_type. The generated CRC lookup table contains ::CRC_TABLE_SIZE elements.
- * The configured check code type must be in the range: ::redcty_kCheckCodeB <= value < ::redcty_kCheckCodeMax. If the value is outside this range, a
- * ::radef_kInternalError fatal error is thrown.
- * The configured CRC width must be in the range: ::kMinWidth <= value <= ::kMaxWidth. If the value is outside this range, a ::radef_kInternalError fatal error
- * is thrown.
+ * Only the CRC register is calculated, the input and output processing is done by the caller.
+ *
+ * @param crc_engine Pointer to the initialized CRC engine. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param crc_options Pointer to the CRC options of the configured check code type. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param crc Initial CRC register (reflected, if the input is reflected). The full value range is valid and usable.
+ * @param data_size Size of the data buffer [bytes]. The full value range is valid and usable.
+ * @param data_buffer Pointer to the data buffer. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return The calculated CRC register. The full value range is valid and usable.
+ */
+static uint32_t CalculateCrcTable(const redcrc_CrcEngine* const crc_engine, const CrcOptions* const crc_options, const uint32_t crc, const uint16_t data_size,
+                                  const uint8_t* const data_buffer);
+
+/**
+ * @brief Updates an aligned CRC register with 8 data bytes using the slicing-by-8 lookup tables.
+ *
+ * For a not reflected input, the CRC register must be aligned to the most significant bit like the lookup table values.
+ *
+ * @param table Pointer to the slicing-by-8 lookup tables of the configured check code type. If the pointer is NULL, a ::radef_kInternalError fatal error is
+ * thrown.
+ * @param refin true, if the input is reflected.
+ * @param crc_register Aligned CRC register. The full value range is valid and usable.
+ * @param data Pointer to the first of 8 data bytes. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return The updated CRC register. The full value range is valid and usable.
+ */
+static uint32_t UpdateCrcSlicing(const uint32_t (*const table)[REDCRC_TABLE_SIZE], const bool refin, const uint32_t crc_register, const uint8_t* const data);
+
+/**
+ * @brief Calculates the CRC of the data buffers of up to ::CRC_BATCH_LANES batch entries in parallel lanes with the slicing-by-8 table algorithm.
+ *
+ * The common part of all data buffers is processed in one loop, which updates the CRC registers of all lanes in every step. The remaining data bytes of every
+ * lane are then processed with ::CalculateCrcTable. Unused lanes repeat the calculation of the first lane, their result is discarded.
+ *
+ * @param crc_engine Pointer to the initialized CRC engine. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param crc_options Pointer to the CRC options of the configured check code type. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param number_of_lanes Number of used lanes. Valid range: 1 <= value <= ::CRC_BATCH_LANES. If the value is outside this range, a ::radef_kInternalError
+ * fatal error is thrown.
+ * @param lane_entries Array of pointers to the batch entries of the used lanes. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ */
+static void CalculateCrcTableBatch(const redcrc_CrcEngine* const crc_engine, const CrcOptions* const crc_options, const uint32_t number_of_lanes,
+                                   const redcrc_CrcBatchEntry* const lane_entries[CRC_BATCH_LANES]);
+
+/**
+ * @brief Calculates the initial CRC register of the configured check code type.
+ *
+ * @param crc_options Pointer to the CRC options of the configured check code type. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return The initial CRC register (reflected, if the input is reflected). The full value range is valid and usable.
  */
-static void GenerateCrcTable(void);
+static uint32_t InitializeCrcRegister(const CrcOptions* const crc_options);
+
+/**
+ * @brief Calculates the CRC value from a calculated CRC register by the output processing of the configured check code type.
+ *
+ * @param crc_engine Pointer to the initialized CRC engine. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param crc_options Pointer to the CRC options of the configured check code type. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param crc_register The calculated CRC register. The full value range is valid and usable.
+ * @return The CRC value. The full value range is valid and usable.
+ */
+static uint32_t FinalizeCrcRegister(const redcrc_CrcEngine* const crc_engine, const CrcOptions* const crc_options, const uint32_t crc_register);
+
+/**
+ * @brief Calculates the CRC register over a data buffer with the fastest available algorithm for the configured check code type and the data size.
+ *
+ * @param crc_engine Pointer to the initialized CRC engine. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param crc_options Pointer to the CRC options of the configured check code type. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param data_size Size of the data buffer [bytes]. The full value range is valid and usable.
+ * @param data_buffer Pointer to the data buffer. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return The calculated CRC register. The full value range is valid and usable.
+ */
+static uint32_t CalculateCrcRegister(const redcrc_CrcEngine* const crc_engine, const CrcOptions* const crc_options, const uint16_t data_size,
+                                     const uint8_t* const data_buffer);
+
+/**
+ * @brief Checks if the CRC of a data buffer is calculated with the slicing-by-8 table algorithm.
+ *
+ * @param crc_engine Pointer to the initialized CRC engine. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param data_size Size of the data buffer [bytes]. The full value range is valid and usable.
+ * @return true, if the table algorithm is used.
+ * @return false, if CPU instructions are used.
+ */
+static bool IsTableAlgorithmUsed(const redcrc_CrcEngine* const crc_engine, const uint16_t data_size);
+
+/**
+ * @brief Reads a uint32_t in little-endian byte order from a data buffer.
+ *
+ * @param data Pointer to the first of 4 data bytes. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return The read value. The full value range is valid and usable.
+ */
+static uint32_t ReadU32LittleEndian(const uint8_t* const data);
+
+/**
+ * @brief Reads a uint32_t in big-endian byte order from a data buffer.
+ *
+ * @param data Pointer to the first of 4 data bytes. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return The read value. The full value range is valid and usable.
+ */
+static uint32_t ReadU32BigEndian(const uint8_t* const data);
+
+/**
+ * @brief Checks if the CPU supports the CRC32C instructions.
+ *
+ * @return true, if the CRC32C instructions are supported.
+ * @return false, if the CRC32C instructions are not supported or not available for this platform.
+ */
+static bool IsHardwareCrc32cSupported(void);
+
+/**
+ * @brief Shifts a CRC32C register over ::REDCRC_CRC32C_STREAM_SIZE zero bytes.
+ *
+ * @param crc CRC32C register to shift. The full value range is valid and usable.
+ * @return The shifted CRC32C register. The full value range is valid and usable.
+ */
+static uint32_t ShiftCrc32c(const uint32_t crc);
+
+/**
+ * @brief Calculates the CRC32C register over a data buffer with the CRC32C instructions of the CPU.
+ *
+ * Long data buffers are processed in three interleaved streams of ::REDCRC_CRC32C_STREAM_SIZE bytes to hide the latency of the CRC32C instruction. The
+ * resulting CRC registers are combined with ::ShiftCrc32c. Only the CRC register is calculated, the input and output processing is done by the caller.
+ *
+ * @param crc Initial CRC32C register (reflected). The full value range is valid and usable.
+ * @param data_size Size of the data buffer [bytes]. The full value range is valid and usable.
+ * @param data_buffer Pointer to the data buffer. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return The calculated CRC32C register. The full value range is valid and usable.
+ */
+static uint32_t CalculateCrc32cHardware(const uint32_t crc, const uint16_t data_size, const uint8_t* const data_buffer);
+
+/**
+ * @brief Checks if the CPU supports the carry-less multiplication instructions.
+ *
+ * @return true, if the carry-less multiplication instructions are supported.
+ * @return false, if the carry-less multiplication instructions are not supported or not available for this platform.
+ */
+static bool IsHardwareClmulSupported(void);
+
+/**
+ * @brief Calculates the CRC register over a data buffer with the carry-less multiplication instructions of the CPU.
+ *
+ * The data is folded in four parallel lanes of ::CRC_FOLDING_BLOCK_SIZE bytes, until a single 128 bit remainder is left, which is congruent to the processed
+ * data modulo the polynomial. The CRC of the remainder and the remaining data bytes is then calculated with ::CalculateCrcTable. Only the CRC register is
+ * calculated, the input and output processing is done by the caller.
+ *
+ * @param crc_engine Pointer to the initialized CRC engine. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param crc_options Pointer to the CRC options of the configured check code type. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param crc Initial CRC register (reflected, if the input is reflected). The full value range is valid and usable.
+ * @param data_size Size of the data buffer [bytes]. Valid range: (::CRC_FOLDING_LANES * ::CRC_FOLDING_BLOCK_SIZE) <= value. If the value is outside this range,
+ * a ::radef_kInternalError fatal error is thrown.
+ * @param data_buffer Pointer to the data buffer. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return The calculated CRC register. The full value range is valid and usable.
+ */
+static uint32_t CalculateCrcFolding(const redcrc_CrcEngine* const crc_engine, const CrcOptions* const crc_options, const uint32_t crc, const uint16_t data_size,
+                                    const uint8_t* const data_buffer);
+
+/**
+ * @brief Updates a CRC32C register with 8 data bytes using the CRC32C instruction of the CPU.
+ *
+ * @param crc CRC32C register. The full value range is valid and usable.
+ * @param data Pointer to the first of 8 data bytes. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return The updated CRC32C register. The full value range is valid and usable.
+ */
+static uint32_t UpdateCrc32cU64(const uint32_t crc, const uint8_t* const data);
+
+/**
+ * @brief Updates a CRC32C register with 1 data byte using the CRC32C instruction of the CPU.
+ *
+ * @param crc CRC32C register. The full value range is valid and usable.
+ * @param data Data byte. The full value range is valid and usable.
+ * @return The updated CRC32C register. The full value range is valid and usable.
+ */
+static uint32_t UpdateCrc32cU8(const uint32_t crc, const uint8_t data);
 
 /** @}*/
 
@@ -160,64 +357,100 @@ static const CrcOptions kCrcOptions[(uint16_t)redcty_kCheckCodeMax] = {
 // Global Function Implementations
 // -----------------------------------------------------------------------------
 
-void redcrc_Init(const redcty_CheckCodeType configured_check_code_type) {
+void redcrc_Init(redcrc_CrcEngine* const crc_engine, const redcty_CheckCodeType configured_check_code_type) {
   // Input parameter checks
-  raas_AssertTrue(!redcrc_initialized, radef_kAlreadyInitialized);
+  raas_AssertNotNull(crc_engine, radef_kInvalidParameter);
+  raas_AssertTrue(!crc_engine->initialized, radef_kAlreadyInitialized);
   raas_AssertU16InRange((uint16_t)configured_check_code_type, (uint16_t)redcty_kCheckCodeMin, (uint16_t)(redcty_kCheckCodeMax)-1U, radef_kInvalidParameter);
 
-  // Initialize local variables
-  redcrc_check_code_type = configured_check_code_type;
-  redcrc_initialized = true;
-
-  if (redcrc_check_code_type != redcty_kCheckCodeA) {  // Check code type A is no CRC check -> no CRC table is generated
-    // Generate CRC table
-    GenerateCrcTable();
+  // Initialize engine
+  crc_engine->check_code_type = configured_check_code_type;
+  crc_engine->table = NULL;
+  crc_engine->folding_constants = NULL;
+  crc_engine->crc_mask = 0U;
+  crc_engine->hardware_crc32c_enabled = false;
+  crc_engine->hardware_folding_enabled = false;
+  crc_engine->initialized = true;
+
+  if (crc_engine->check_code_type != redcty_kCheckCodeA) {  // Check code type A is no CRC check -> no CRC table is selected
+    const uint16_t table_type = (uint16_t)crc_engine->check_code_type - (uint16_t)redcty_kCheckCodeB;
+    const uint16_t width = kCrcOptions[(uint16_t)crc_engine->check_code_type].width;
+
+    // Select the constant CRC tables of the configured check code type
+    crc_engine->table = redcrc_kCrcTables[table_type];
+    crc_engine->folding_constants = &redcrc_kFoldingConstants[table_type];
+    crc_engine->crc_mask = ((((uint32_t)1U << (width - 1U)) - 1U) << 1U) | 1U;
+
+    // Check code type C is CRC32C, use the CPU instructions if available
+    if ((crc_engine->check_code_type == redcty_kCheckCodeC) && IsHardwareCrc32cSupported()) {
+      crc_engine->hardware_crc32c_enabled = true;
+    } else if ((crc_engine->check_code_type != redcty_kCheckCodeC) && IsHardwareClmulSupported()) {
+      // Other check codes have no dedicated instruction, use the carry-less multiplication if available
+      crc_engine->hardware_folding_enabled = true;
+    } else {
+      // Table algorithm only
+    }
   }
 }
 
-void redcrc_CalculateCrc(const uint16_t data_size, const uint8_t* const data_buffer, uint32_t* const calculated_crc) {
+void redcrc_CalculateCrc(const redcrc_CrcEngine* const crc_engine, const uint16_t data_size, const uint8_t* const data_buffer, uint32_t* const calculated_crc) {
   // Input parameter check
-  raas_AssertTrue(redcrc_initialized, radef_kNotInitialized);
+  raas_AssertNotNull(crc_engine, radef_kInvalidParameter);
+  raas_AssertTrue(crc_engine->initialized, radef_kNotInitialized);
   raas_AssertU16InRange(data_size, RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE, RADEF_RED_LAYER_MESSAGE_HEADER_SIZE + RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE,
                         radef_kInvalidParameter);
   raas_AssertNotNull(data_buffer, radef_kInvalidParameter);
   raas_AssertNotNull(calculated_crc, radef_kInvalidParameter);
   // Range checks
-  raas_AssertU16InRange((uint16_t)redcrc_check_code_type, (uint16_t)redcty_kCheckCodeB, (uint16_t)(redcty_kCheckCodeMax)-1U, radef_kInternalError);
-  raas_AssertU16InRange(kCrcOptions[(uint16_t)redcrc_check_code_type].width, kMinWidth, kMaxWidth, radef_kInternalError);
+  raas_AssertU16InRange((uint16_t)crc_engine->check_code_type, (uint16_t)redcty_kCheckCodeB, (uint16_t)(redcty_kCheckCodeMax)-1U, radef_kInternalError);
+  raas_AssertU16InRange(kCrcOptions[(uint16_t)crc_engine->check_code_type].width, kMinWidth, kMaxWidth, radef_kInternalError);
 
-  const CrcOptions* const kMyCrcOptions = &kCrcOptions[(uint16_t)redcrc_check_code_type];
-  uint32_t crc = kMyCrcOptions->initial_optimized;
-  uint16_t data_buffer_index = 0U;
+  const CrcOptions* const kMyCrcOptions = &kCrcOptions[(uint16_t)crc_engine->check_code_type];
 
-  // Process reflected input
-  if (kMyCrcOptions->refin) {
-    crc = ReflectBits(crc, kMyCrcOptions->width);
-  }
+  *calculated_crc = FinalizeCrcRegister(crc_engine, kMyCrcOptions, CalculateCrcRegister(crc_engine, kMyCrcOptions, data_size, data_buffer));
+}
 
-  // CRC calculation
-  if (!kMyCrcOptions->refin) {
-    while (data_buffer_index < data_size) {
-      crc = (crc << kBitsPerByte) ^ redcrc_table[((crc >> (kMyCrcOptions->width - kBitsPerByte)) & 0x000000FFU) ^ data_buffer[data_buffer_index]];
-      data_buffer_index++;
-    }
-  } else {
-    while (data_buffer_index < data_size) {
-      crc = (crc >> kBitsPerByte) ^ redcrc_table[(crc & 0x000000FFU) ^ data_buffer[data_buffer_index]];
-      data_buffer_index++;
+void redcrc_CalculateCrcBatch(const redcrc_CrcEngine* const crc_engine, const uint16_t number_of_entries, const redcrc_CrcBatchEntry* const entries) {
+  // Input parameter check
+  raas_AssertNotNull(crc_engine, radef_kInvalidParameter);
+  raas_AssertTrue(crc_engine->initialized, radef_kNotInitialized);
+  raas_AssertNotNull(entries, radef_kInvalidParameter);
+  raas_AssertTrue(number_of_entries > 0U, radef_kInvalidParameter);
+
+  for (uint32_t entry_index = 0U; entry_index < number_of_entries; ++entry_index) {
+    raas_AssertU16InRange(entries[entry_index].data_size, RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE,
+                          RADEF_RED_LAYER_MESSAGE_HEADER_SIZE + RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, radef_kInvalidParameter);
+    raas_AssertNotNull(entries[entry_index].data_buffer, radef_kInvalidParameter);
+    raas_AssertNotNull(entries[entry_index].calculated_crc, radef_kInvalidParameter);
+  }
+  // Range checks
+  raas_AssertU16InRange((uint16_t)crc_engine->check_code_type, (uint16_t)redcty_kCheckCodeB, (uint16_t)(redcty_kCheckCodeMax)-1U, radef_kInternalError);
+  raas_AssertU16InRange(kCrcOptions[(uint16_t)crc_engine->check_code_type].width, kMinWidth, kMaxWidth, radef_kInternalError);
+
+  const CrcOptions* const kMyCrcOptions = &kCrcOptions[(uint16_t)crc_engine->check_code_type];
+  const redcrc_CrcBatchEntry* lane_entries[CRC_BATCH_LANES] = {NULL};
+  uint32_t number_of_lanes = 0U;
+
+  for (uint32_t entry_index = 0U; entry_index < number_of_entries; ++entry_index) {
+    if (IsTableAlgorithmUsed(crc_engine, entries[entry_index].data_size)) {
+      // Collect the entry in the next free lane and process the lanes as soon as all lanes are used
+      lane_entries[number_of_lanes] = &entries[entry_index];
+      number_of_lanes++;
+      if (number_of_lanes == CRC_BATCH_LANES) {
+        CalculateCrcTableBatch(crc_engine, kMyCrcOptions, number_of_lanes, lane_entries);
+        number_of_lanes = 0U;
+      }
+    } else {
+      // The CPU instructions already overlap the calculation steps, process the entry on its own
+      *entries[entry_index].calculated_crc = FinalizeCrcRegister(
+          crc_engine, kMyCrcOptions, CalculateCrcRegister(crc_engine, kMyCrcOptions, entries[entry_index].data_size, entries[entry_index].data_buffer));
     }
   }
 
-  // Output processing
-  if ((kMyCrcOptions->refout || kMyCrcOptions->refin) && !(kMyCrcOptions->refout && kMyCrcOptions->refin)) {  // refout XOR refin
-    // no coverage start (The above condition is never true, with the predefined constant CRC options)
-    crc = ReflectBits(crc, kMyCrcOptions->width);
-    // no coverage end
+  // Process the remaining entries
+  if (number_of_lanes > 0U) {
+    CalculateCrcTableBatch(crc_engine, kMyCrcOptions, number_of_lanes, lane_entries);
   }
-  crc ^= kMyCrcOptions->final_xor;
-  crc &= redcrc_crc_mask;
-
-  *calculated_crc = crc;
 }
 
 // -----------------------------------------------------------------------------
@@ -241,38 +474,349 @@ static uint32_t ReflectBits(uint32_t value_in, uint16_t number_of_bits) {
   return value_out;
 }
 
-static void GenerateCrcTable(void) {
-  // Range checks
-  raas_AssertU16InRange((uint16_t)redcrc_check_code_type, (uint16_t)redcty_kCheckCodeB, (uint16_t)(redcty_kCheckCodeMax)-1U, radef_kInternalError);
-  raas_AssertU16InRange(kCrcOptions[(uint16_t)redcrc_check_code_type].width, kMinWidth, kMaxWidth, radef_kInternalError);
+static uint32_t CalculateCrcTable(const redcrc_CrcEngine* const crc_engine, const CrcOptions* const crc_options, const uint32_t crc, const uint16_t data_size,
+                                  const uint8_t* const data_buffer) {
+  // Input parameter check
+  raas_AssertNotNull(crc_engine, radef_kInternalError);
+  raas_AssertNotNull(crc_options, radef_kInternalError);
+  raas_AssertNotNull(data_buffer, radef_kInternalError);
+
+  const uint32_t(*const table)[REDCRC_TABLE_SIZE] = crc_engine->table;
+  uint32_t crc_register = crc;
+  uint16_t data_buffer_index = 0U;
 
-  uint32_t bit;
-  const CrcOptions* const kMyCrcOptions = &kCrcOptions[(uint16_t)redcrc_check_code_type];
+  // 8 bytes per step with the slicing-by-8 algorithm and the remaining bytes byte-wise
+  if (!crc_options->refin) {
+    const uint32_t width_shift = (uint32_t)kMaxWidth - crc_options->width;
+    crc_register <<= width_shift;  // Align CRC to the most significant bit like the lookup table values
 
-  // Initialize CRC mask and CRC high bit
-  redcrc_crc_mask = ((((uint32_t)1U << (kMyCrcOptions->width - 1U)) - 1U) << 1U) | 1U;
-  redcrc_crc_high_bit = (uint32_t)1U << (kMyCrcOptions->width - 1U);
+    while ((uint16_t)(data_size - data_buffer_index) >= CRC_SLICING_BLOCK_SIZE) {
+      crc_register = UpdateCrcSlicing(table, false, crc_register, &data_buffer[data_buffer_index]);
+      data_buffer_index += CRC_SLICING_BLOCK_SIZE;
+    }
+    while (data_buffer_index < data_size) {
+      crc_register = (crc_register << kBitsPerByte) ^ table[0U][(crc_register >> 24U) ^ data_buffer[data_buffer_index]];
+      data_buffer_index++;
+    }
+
+    crc_register >>= width_shift;
+  } else {
+    while ((uint16_t)(data_size - data_buffer_index) >= CRC_SLICING_BLOCK_SIZE) {
+      crc_register = UpdateCrcSlicing(table, true, crc_register, &data_buffer[data_buffer_index]);
+      data_buffer_index += CRC_SLICING_BLOCK_SIZE;
+    }
+    while (data_buffer_index < data_size) {
+      crc_register = (crc_register >> kBitsPerByte) ^ table[0U][(crc_register & 0x000000FFU) ^ data_buffer[data_buffer_index]];
+      data_buffer_index++;
+    }
+  }
+
+  return crc_register;
+}
 
-  // Generate CRC lookup table
-  for (uint32_t table_index = 0U; table_index < CRC_TABLE_SIZE; table_index++) {
-    uint32_t crc = table_index;
-    if (kMyCrcOptions->refin) {
-      crc = ReflectBits(crc, kBitsPerByte);
+static uint32_t UpdateCrcSlicing(const uint32_t (*const table)[REDCRC_TABLE_SIZE], const bool refin, const uint32_t crc_register, const uint8_t* const data) {
+  // Input parameter check
+  raas_AssertNotNull(table, radef_kInternalError);
+  raas_AssertNotNull(data, radef_kInternalError);
+
+  uint32_t updated_crc_register = 0U;
+  if (!refin) {
+    const uint32_t word_1 = crc_register ^ ReadU32BigEndian(&data[0U]);
+    const uint32_t word_2 = ReadU32BigEndian(&data[4U]);
+    updated_crc_register = table[7U][word_1 >> 24U] ^ table[6U][(word_1 >> 16U) & 0x000000FFU] ^ table[5U][(word_1 >> 8U) & 0x000000FFU] ^
+                           table[4U][word_1 & 0x000000FFU] ^ table[3U][word_2 >> 24U] ^ table[2U][(word_2 >> 16U) & 0x000000FFU] ^
+                           table[1U][(word_2 >> 8U) & 0x000000FFU] ^ table[0U][word_2 & 0x000000FFU];
+  } else {
+    const uint32_t word_1 = crc_register ^ ReadU32LittleEndian(&data[0U]);
+    const uint32_t word_2 = ReadU32LittleEndian(&data[4U]);
+    updated_crc_register = table[7U][word_1 & 0x000000FFU] ^ table[6U][(word_1 >> 8U) & 0x000000FFU] ^ table[5U][(word_1 >> 16U) & 0x000000FFU] ^
+                           table[4U][word_1 >> 24U] ^ table[3U][word_2 & 0x000000FFU] ^ table[2U][(word_2 >> 8U) & 0x000000FFU] ^
+                           table[1U][(word_2 >> 16U) & 0x000000FFU] ^ table[0U][word_2 >> 24U];
+  }
+  return updated_crc_register;
+}
+
+static void CalculateCrcTableBatch(const redcrc_CrcEngine* const crc_engine, const CrcOptions* const crc_options, const uint32_t number_of_lanes,
+                                   const redcrc_CrcBatchEntry* const lane_entries[CRC_BATCH_LANES]) {
+  // Input parameter check
+  raas_AssertNotNull(crc_engine, radef_kInternalError);
+  raas_AssertNotNull(crc_options, radef_kInternalError);
+  raas_AssertU32InRange(number_of_lanes, 1U, CRC_BATCH_LANES, radef_kInternalError);
+  raas_AssertNotNull(lane_entries, radef_kInternalError);
+
+  const uint32_t width_shift = crc_options->refin ? 0U : ((uint32_t)kMaxWidth - crc_options->width);
+  const uint8_t* data_buffers[CRC_BATCH_LANES];
+  uint32_t crc_registers[CRC_BATCH_LANES];
+  uint16_t common_size = lane_entries[0U]->data_size;
+
+  for (uint32_t lane = 0U; lane < CRC_BATCH_LANES; ++lane) {
+    // Unused lanes repeat the first lane
+    const redcrc_CrcBatchEntry* const lane_entry = (lane < number_of_lanes) ? lane_entries[lane] : lane_entries[0U];
+    data_buffers[lane] = lane_entry->data_buffer;
+    // Align CRC to the most significant bit like the lookup table values, if the input is not reflected
+    crc_registers[lane] = InitializeCrcRegister(crc_options) << width_shift;
+    if (lane_entry->data_size < common_size) {
+      common_size = lane_entry->data_size;
     }
-    crc = (crc << (kMyCrcOptions->width - kBitsPerByte));
+  }
+  common_size -= common_size % CRC_SLICING_BLOCK_SIZE;
+
+  // 8 bytes per step of every lane, the lanes are independent of each other
+  for (uint16_t data_buffer_index = 0U; data_buffer_index < common_size; data_buffer_index += CRC_SLICING_BLOCK_SIZE) {
+    for (uint32_t lane = 0U; lane < CRC_BATCH_LANES; ++lane) {
+      crc_registers[lane] = UpdateCrcSlicing(crc_engine->table, crc_options->refin, crc_registers[lane], &data_buffers[lane][data_buffer_index]);
+    }
+  }
+
+  // Remaining data bytes and output processing of the used lanes
+  for (uint32_t lane = 0U; lane < number_of_lanes; ++lane) {
+    const uint32_t crc_register = CalculateCrcTable(crc_engine, crc_options, crc_registers[lane] >> width_shift,
+                                                    (uint16_t)(lane_entries[lane]->data_size - common_size), &data_buffers[lane][common_size]);
+    *lane_entries[lane]->calculated_crc = FinalizeCrcRegister(crc_engine, crc_options, crc_register);
+  }
+}
+
+static uint32_t InitializeCrcRegister(const CrcOptions* const crc_options) {
+  // Input parameter check
+  raas_AssertNotNull(crc_options, radef_kInternalError);
+
+  uint32_t crc_register = crc_options->initial_optimized;
+
+  // Process reflected input
+  if (crc_options->refin) {
+    crc_register = ReflectBits(crc_register, crc_options->width);
+  }
+  return crc_register;
+}
+
+static uint32_t FinalizeCrcRegister(const redcrc_CrcEngine* const crc_engine, const CrcOptions* const crc_options, const uint32_t crc_register) {
+  // Input parameter check
+  raas_AssertNotNull(crc_engine, radef_kInternalError);
+  raas_AssertNotNull(crc_options, radef_kInternalError);
+
+  uint32_t crc = crc_register;
+
+  // Output processing
+  if ((crc_options->refout || crc_options->refin) && !(crc_options->refout && crc_options->refin)) {  // refout XOR refin
+    // no coverage start (The above condition is never true, with the predefined constant CRC options)
+    crc = ReflectBits(crc, crc_options->width);
+    // no coverage end
+  }
+  crc ^= crc_options->final_xor;
+  crc &= crc_engine->crc_mask;
+
+  return crc;
+}
+
+static uint32_t CalculateCrcRegister(const redcrc_CrcEngine* const crc_engine, const CrcOptions* const crc_options, const uint16_t data_size,
+                                     const uint8_t* const data_buffer) {
+  // Input parameter check
+  raas_AssertNotNull(crc_engine, radef_kInternalError);
+  raas_AssertNotNull(crc_options, radef_kInternalError);
+  raas_AssertNotNull(data_buffer, radef_kInternalError);
+
+  const uint32_t crc = InitializeCrcRegister(crc_options);
+  uint32_t crc_register = 0U;
+
+  // CRC calculation
+  if (crc_engine->hardware_crc32c_enabled) {
+    crc_register = CalculateCrc32cHardware(crc, data_size, data_buffer);
+  } else if (!IsTableAlgorithmUsed(crc_engine, data_size)) {
+    crc_register = CalculateCrcFolding(crc_engine, crc_options, crc, data_size, data_buffer);
+  } else {
+    crc_register = CalculateCrcTable(crc_engine, crc_options, crc, data_size, data_buffer);
+  }
+  return crc_register;
+}
 
-    for (uint16_t bit_index = 0U; bit_index < kBitsPerByte; bit_index++) {
-      bit = crc & redcrc_crc_high_bit;
-      crc <<= 1U;
-      if (bit != 0U) {
-        crc ^= kMyCrcOptions->polynomial;
+static bool IsTableAlgorithmUsed(const redcrc_CrcEngine* const crc_engine, const uint16_t data_size) {
+  // Input parameter check
+  raas_AssertNotNull(crc_engine, radef_kInternalError);
+
+  return !crc_engine->hardware_crc32c_enabled && !(crc_engine->hardware_folding_enabled && (data_size >= (CRC_FOLDING_LANES * CRC_FOLDING_BLOCK_SIZE)));
+}
+
+static uint32_t ReadU32LittleEndian(const uint8_t* const data) {
+  // Input parameter check
+  raas_AssertNotNull(data, radef_kInternalError);
+
+  return (uint32_t)data[0U] | ((uint32_t)data[1U] << 8U) | ((uint32_t)data[2U] << 16U) | ((uint32_t)data[3U] << 24U);
+}
+
+static uint32_t ReadU32BigEndian(const uint8_t* const data) {
+  // Input parameter check
+  raas_AssertNotNull(data, radef_kInternalError);
+
+  return ((uint32_t)data[0U] << 24U) | ((uint32_t)data[1U] << 16U) | ((uint32_t)data[2U] << 8U) | (uint32_t)data[3U];
+}
+
+static bool IsHardwareCrc32cSupported(void) {
+  bool supported = false;
+#if HARDWARE_CRC32C_X86 != 0
+  __builtin_cpu_init();
+  supported = (__builtin_cpu_supports("sse4.2") != 0);
+#elif HARDWARE_CRC32C_ARM != 0
+  supported = true;
+#endif
+  return supported;
+}
+
+static uint32_t ShiftCrc32c(const uint32_t crc) {
+  return redcrc_kCrc32cShiftTables[0U][crc & 0x000000FFU] ^ redcrc_kCrc32cShiftTables[1U][(crc >> 8U) & 0x000000FFU] ^
+         redcrc_kCrc32cShiftTables[2U][(crc >> 16U) & 0x000000FFU] ^ redcrc_kCrc32cShiftTables[3U][crc >> 24U];
+}
+
+HARDWARE_CRC32C_TARGET static uint32_t CalculateCrc32cHardware(const uint32_t crc, const uint16_t data_size, const uint8_t* const data_buffer) {
+  // Input parameter check
+  raas_AssertNotNull(data_buffer, radef_kInternalError);
+
+  uint32_t crc_stream_1 = crc;
+  uint16_t data_buffer_index = 0U;
+
+  // Three interleaved streams, the CRC of the first stream is shifted over the following two streams
+  while ((uint16_t)(data_size - data_buffer_index) >= (REDCRC_CRC32C_STREAM_SIZE * 3U)) {
+    uint32_t crc_stream_2 = 0U;
+    uint32_t crc_stream_3 = 0U;
+    for (uint16_t stream_index = 0U; stream_index < REDCRC_CRC32C_STREAM_SIZE; stream_index += CRC_SLICING_BLOCK_SIZE) {
+      crc_stream_1 = UpdateCrc32cU64(crc_stream_1, &data_buffer[data_buffer_index + stream_index]);
+      crc_stream_2 = UpdateCrc32cU64(crc_stream_2, &data_buffer[data_buffer_index + REDCRC_CRC32C_STREAM_SIZE + stream_index]);
+      crc_stream_3 = UpdateCrc32cU64(crc_stream_3, &data_buffer[data_buffer_index + (REDCRC_CRC32C_STREAM_SIZE * 2U) + stream_index]);
+    }
+    crc_stream_1 = ShiftCrc32c(ShiftCrc32c(crc_stream_1) ^ crc_stream_2) ^ crc_stream_3;
+    data_buffer_index += (REDCRC_CRC32C_STREAM_SIZE * 3U);
+  }
+
+  // Remaining data, 8 bytes per step and the remaining bytes byte-wise
+  while ((uint16_t)(data_size - data_buffer_index) >= CRC_SLICING_BLOCK_SIZE) {
+    crc_stream_1 = UpdateCrc32cU64(crc_stream_1, &data_buffer[data_buffer_index]);
+    data_buffer_index += CRC_SLICING_BLOCK_SIZE;
+  }
+  while (data_buffer_index < data_size) {
+    crc_stream_1 = UpdateCrc32cU8(crc_stream_1, data_buffer[data_buffer_index]);
+    data_buffer_index++;
+  }
+
+  return crc_stream_1;
+}
+
+HARDWARE_CRC32C_TARGET static uint32_t UpdateCrc32cU64(const uint32_t crc, const uint8_t* const data) {
+  // Input parameter check
+  raas_AssertNotNull(data, radef_kInternalError);
+
+  const uint64_t data_word = (uint64_t)ReadU32LittleEndian(data) | ((uint64_t)ReadU32LittleEndian(&data[4U]) << 32U);
+  uint32_t updated_crc;
+#if HARDWARE_CRC32C_X86 != 0
+  updated_crc = (uint32_t)_mm_crc32_u64(crc, data_word);
+#elif HARDWARE_CRC32C_ARM != 0
+  updated_crc = __crc32cd(crc, data_word);
+#else
+  // no coverage start (Never called without hardware CRC32C, the table algorithm gives the same result)
+  updated_crc = crc;
+  for (uint32_t byte_index = 0U; byte_index < CRC_SLICING_BLOCK_SIZE; byte_index++) {
+    updated_crc = UpdateCrc32cU8(updated_crc, (uint8_t)(data_word >> (byte_index * kBitsPerByte)));
+  }
+  // no coverage end
+#endif
+  return updated_crc;
+}
+
+HARDWARE_CRC32C_TARGET static uint32_t UpdateCrc32cU8(const uint32_t crc, const uint8_t data) {
+  uint32_t updated_crc;
+#if HARDWARE_CRC32C_X86 != 0
+  updated_crc = _mm_crc32_u8(crc, data);
+#elif HARDWARE_CRC32C_ARM != 0
+  updated_crc = __crc32cb(crc, data);
+#else
+  // no coverage start (Never called without hardware CRC32C, the table algorithm gives the same result)
+  updated_crc = (crc >> kBitsPerByte) ^ redcrc_kCrcTables[(uint16_t)redcty_kCheckCodeC - (uint16_t)redcty_kCheckCodeB][0U][(crc & 0x000000FFU) ^ data];
+  // no coverage end
+#endif
+  return updated_crc;
+}
+
+static bool IsHardwareClmulSupported(void) {
+  bool supported = false;
+#if HARDWARE_CLMUL_X86 != 0
+  __builtin_cpu_init();
+  supported = ((__builtin_cpu_supports("pclmul") != 0) && (__builtin_cpu_supports("ssse3") != 0));
+#endif
+  return supported;
+}
+
+HARDWARE_CLMUL_TARGET static uint32_t CalculateCrcFolding(const redcrc_CrcEngine* const crc_engine, const CrcOptions* const crc_options, const uint32_t crc,
+                                                          const uint16_t data_size, const uint8_t* const data_buffer) {
+  // Input parameter check
+  raas_AssertNotNull(crc_engine, radef_kInternalError);
+  raas_AssertNotNull(crc_options, radef_kInternalError);
+  raas_AssertNotNull(data_buffer, radef_kInternalError);
+  raas_AssertTrue(data_size >= (CRC_FOLDING_LANES * CRC_FOLDING_BLOCK_SIZE), radef_kInternalError);
+
+  uint32_t crc_register;
+#if HARDWARE_CLMUL_X86 != 0
+  // For non-reflected CRCs, the first data byte holds the highest order coefficients and the blocks are byte swapped
+  const __m128i byte_swap_mask = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m128i fold_128 = _mm_set_epi64x((int64_t)crc_engine->folding_constants->fold_128_high, (int64_t)crc_engine->folding_constants->fold_128_low);
+  const __m128i fold_512 = _mm_set_epi64x((int64_t)crc_engine->folding_constants->fold_512_high, (int64_t)crc_engine->folding_constants->fold_512_low);
+  __m128i lanes[CRC_FOLDING_LANES];
+  uint16_t data_buffer_index = 0U;
+
+  for (uint32_t lane = 0U; lane < CRC_FOLDING_LANES; lane++) {
+    lanes[lane] = _mm_loadu_si128((const __m128i*)&data_buffer[lane * CRC_FOLDING_BLOCK_SIZE]);
+    if (!crc_options->refin) {
+      lanes[lane] = _mm_shuffle_epi8(lanes[lane], byte_swap_mask);
+    }
+  }
+  data_buffer_index += (CRC_FOLDING_LANES * CRC_FOLDING_BLOCK_SIZE);
+
+  // The initial CRC register is added to the first data bits
+  if (!crc_options->refin) {
+    lanes[0U] = _mm_xor_si128(lanes[0U], _mm_set_epi32((int32_t)(crc << ((uint32_t)kMaxWidth - crc_options->width)), 0, 0, 0));
+  } else {
+    lanes[0U] = _mm_xor_si128(lanes[0U], _mm_cvtsi32_si128((int32_t)crc));
+  }
+
+  // Fold the four lanes over the next four data blocks
+  while ((uint16_t)(data_size - data_buffer_index) >= (CRC_FOLDING_LANES * CRC_FOLDING_BLOCK_SIZE)) {
+    for (uint32_t lane = 0U; lane < CRC_FOLDING_LANES; lane++) {
+      __m128i data_block = _mm_loadu_si128((const __m128i*)&data_buffer[data_buffer_index + (lane * CRC_FOLDING_BLOCK_SIZE)]);
+      if (!crc_options->refin) {
+        data_block = _mm_shuffle_epi8(data_block, byte_swap_mask);
       }
+      lanes[lane] = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(lanes[lane], fold_512, 0x11), _mm_clmulepi64_si128(lanes[lane], fold_512, 0x00)),
+                                  data_block);
     }
+    data_buffer_index += (CRC_FOLDING_LANES * CRC_FOLDING_BLOCK_SIZE);
+  }
+
+  // Fold the four lanes into one
+  __m128i remainder = lanes[0U];
+  for (uint32_t lane = 1U; lane < CRC_FOLDING_LANES; lane++) {
+    remainder = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(remainder, fold_128, 0x11), _mm_clmulepi64_si128(remainder, fold_128, 0x00)), lanes[lane]);
+  }
 
-    if (kMyCrcOptions->refin) {
-      crc = ReflectBits(crc, kMyCrcOptions->width);
+  // Fold the remaining complete data blocks
+  while ((uint16_t)(data_size - data_buffer_index) >= CRC_FOLDING_BLOCK_SIZE) {
+    __m128i data_block = _mm_loadu_si128((const __m128i*)&data_buffer[data_buffer_index]);
+    if (!crc_options->refin) {
+      data_block = _mm_shuffle_epi8(data_block, byte_swap_mask);
     }
-    crc &= redcrc_crc_mask;
-    redcrc_table[table_index] = crc;
+    remainder = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(remainder, fold_128, 0x11), _mm_clmulepi64_si128(remainder, fold_128, 0x00)), data_block);
+    data_buffer_index += CRC_FOLDING_BLOCK_SIZE;
+  }
+
+  // The remainder is congruent to the processed data, calculate the CRC of the remainder followed by the remaining data bytes
+  uint8_t remainder_bytes[CRC_FOLDING_BLOCK_SIZE];
+  if (!crc_options->refin) {
+    remainder = _mm_shuffle_epi8(remainder, byte_swap_mask);
   }
+  _mm_storeu_si128((__m128i*)remainder_bytes, remainder);
+
+  crc_register = CalculateCrcTable(crc_engine, crc_options, 0U, CRC_FOLDING_BLOCK_SIZE, remainder_bytes);
+  crc_register = CalculateCrcTable(crc_engine, crc_options, crc_register, data_size - data_buffer_index, &data_buffer[data_buffer_index]);
+#else
+  // no coverage start (Never called without hardware carry-less multiplication)
+  crc_register = CalculateCrcTable(crc_engine, crc_options, crc, data_size, data_buffer);
+  // no coverage end
+#endif
+  return crc_register;
 }
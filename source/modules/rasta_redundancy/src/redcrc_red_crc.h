@@ -54,6 +54,13 @@
  * - refout = true
  * - final_xor = 0
  * .
+ *
+ * All CRCs are calculated with the slicing-by-8 table algorithm. The lookup tables of all check code types are constant data, generated with
+ * scripts/GenerateCrcTables.py, so they need no initialization and are placed in read-only memory. For check code type C, the CRC32C instructions of the CPU
+ * are used instead, if they are available (x86-64 with SSE4.2, detected at runtime during ::redcrc_Init, or ARMv8 compiled with the CRC extension). For check
+ * code types B, D and E, data buffers of at least 64 bytes are folded with the carry-less multiplication instructions of the CPU, if they are available
+ * (x86-64 with PCLMULQDQ, detected at runtime during ::redcrc_Init). The use of CPU instructions can be disabled at compile time by defining
+ * REDCRC_DISABLE_HARDWARE_CRC.
  */
 #ifndef REDCRC_RED_CRC_H_
 #define REDCRC_RED_CRC_H_
@@ -61,9 +68,11 @@
 // -----------------------------------------------------------------------------
 // Includes
 // -----------------------------------------------------------------------------
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "rasta_redundancy/redcty_red_config_types.h"
+#include "redcrc_red_crc_tables.h"  // NOLINT(build/include_subdir)
 
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
@@ -73,6 +82,37 @@
 // Global Type Definitions
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Typedef for a CRC engine.
+ *
+ * A CRC engine holds the complete state of the CRC calculation for one check code type. Several engines with different check code types can be used in
+ * parallel, e.g. by several redundancy layer instances. An engine is only read by ::redcrc_CalculateCrc and ::redcrc_CalculateCrcBatch, so an initialized
+ * engine can be used concurrently from several threads. The engine is initialized by ::redcrc_Init, its members must not be changed by the user.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;                                  ///< Initialization state of the engine. True, if the engine is initialized.
+  redcty_CheckCodeType check_code_type;              ///< Configured check code type.
+  const uint32_t (*table)[REDCRC_TABLE_SIZE];        ///< CRC lookup tables for the slicing-by-8 algorithm, points into ::redcrc_kCrcTables.
+  const redcrc_FoldingConstants *folding_constants;  ///< Carry-less multiplication constants, points into ::redcrc_kFoldingConstants.
+  uint32_t crc_mask;                                 ///< CRC mask for internal CRC computation
+  bool hardware_crc32c_enabled;                      ///< True, if the CRC32C instructions of the CPU are used for check code type C.
+  bool hardware_folding_enabled;                     ///< True, if the carry-less multiplication instructions of the CPU are used for check code types B, D, E.
+} redcrc_CrcEngine;
+//lint -restore
+
+/**
+ * @brief Typedef for one entry of a batched CRC calculation.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  uint16_t data_size;          ///< Size of data buffer [bytes]. Valid range: ::RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE <= value <=
+                               ///< ::RADEF_RED_LAYER_MESSAGE_HEADER_SIZE + ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE.
+  const uint8_t *data_buffer;  ///< Pointer to data buffer. NULL is not allowed.
+  uint32_t *calculated_crc;    ///< Pointer to the calculated CRC. NULL is not allowed.
+} redcrc_CrcBatchEntry;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -85,37 +125,57 @@ extern "C" {
 #endif  // __cplusplus
 
 /**
- * @brief Initialize the CRC module and generate the CRC lookup table according to the configured check_code_type.
+ * @brief Initialize a CRC engine and select the CRC lookup tables according to the configured check_code_type.
  *
- * This function is used to initialize the CRC module. It saves the passed check code type. A fatal error is raised, if this function is called multiple times.
- * This function calls the internal function GenerateCrcTable(), which generates the CRC lookup table according to the configured check_code_type. For check
- * code type A (no CRC check) no CRC lookup table is generated.
+ * This function is used to initialize a CRC engine. It saves the passed check code type in the engine. A fatal error is raised, if this function is called
+ * multiple times for the same engine. The engine must therefore be zero-initialized before the first call, e.g. by static storage duration.
+ * The CRC lookup tables are constant data (see redcrc_red_crc_tables.h), this function only selects the tables of the configured check_code_type. For check
+ * code type A (no CRC check) no CRC lookup table is selected.
  *
- * @pre The CRC module must not be initialized, otherwise a ::radef_kAlreadyInitialized fatal error is thrown.
+ * @pre The CRC engine must not be initialized, otherwise a ::radef_kAlreadyInitialized fatal error is thrown.
  *
+ * @param [out] crc_engine Pointer to the CRC engine to initialize. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
  * @param [in] configured_check_code_type Configured type of CRC check code. All enum entries of ::redcty_CheckCodeType are valid and usable.
  */
-void redcrc_Init(const redcty_CheckCodeType configured_check_code_type);
+void redcrc_Init(redcrc_CrcEngine *const crc_engine, const redcty_CheckCodeType configured_check_code_type);
 
 /**
  * @brief Calculate the defined type of CRC of a data buffer.
  *
- * This function calculates the configured type of CRC value of the data_size bytes in the data_buffer.
+ * This function calculates the type of CRC value configured in the crc_engine of the data_size bytes in the data_buffer. The engine is not modified.
  * The configured check code type must be in the range: ::redcty_kCheckCodeB <= value < ::redcty_kCheckCodeMax. If the value is outside this range, a
  * ::radef_kInternalError fatal error is thrown.
  * The configured CRC width must be in the range: ::kMinWidth <= value <= ::kMaxWidth. If the value is outside this range, a ::radef_kInternalError fatal error
  * is thrown.
  *
- * @pre The CRC module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ * @pre The CRC engine must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
+ * @param [in] crc_engine Pointer to the initialized CRC engine. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
  * @param [in] data_size Size of data buffer [bytes]. Valid range: ::RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE <= value <= ::RADEF_RED_LAYER_MESSAGE_HEADER_SIZE +
  * ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE.  If the value is outside this range, a ::radef_kInvalidParameter fatal error is thrown.
  * @param [in] data_buffer Pointer to data buffer containing the data for the CRC calculation. If the pointer is NULL, a ::radef_kInvalidParameter fatal error
  * is thrown.
- * @param [out] calculated_crc Pointer to calculated CRC. The full value range is valid and usable. If the pointer is NULL, a ::radef_kInvalidParameter fatal
- * error is thrown.
+ * @param [out] calculated_crc Pointer to calculated CRC. The full value range is valid and usable. If the pointer is NULL, a ::radef_kInvalidParameter
+ * fatal error is thrown.
+ */
+void redcrc_CalculateCrc(const redcrc_CrcEngine *const crc_engine, const uint16_t data_size, const uint8_t *const data_buffer, uint32_t *const calculated_crc);
+
+/**
+ * @brief Calculate the defined type of CRC of several independent data buffers at once.
+ *
+ * The data buffers which are calculated with the slicing-by-8 table algorithm are processed in groups of parallel lanes. The independent CRC registers of the
+ * lanes are updated in the same loop, so the table lookups of the lanes overlap instead of waiting for each other. Data buffers which are calculated with CPU
+ * instructions are processed one after the other. Buffers with different sizes can be mixed within a batch. The calculated CRC of every entry is identical
+ * to the result of ::redcrc_CalculateCrc for the same data buffer. The engine is not modified.
+ *
+ * @pre The CRC engine must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [in] crc_engine Pointer to the initialized CRC engine. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] number_of_entries Number of entries in the entries array. Valid range: 1 <= value. For 0, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] entries Pointer to array of batch entries. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown. The data size and the
+ * pointers of every entry are checked as described in ::redcrc_CalculateCrc, before any CRC is calculated.
  */
-void redcrc_CalculateCrc(const uint16_t data_size, const uint8_t *const data_buffer, uint32_t *const calculated_crc);
+void redcrc_CalculateCrcBatch(const redcrc_CrcEngine *const crc_engine, const uint16_t number_of_entries, const redcrc_CrcBatchEntry *const entries);
 
 /** @}*/
 
@@ -0,0 +1,1271 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redcrc_red_crc_tables.c
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Constant lookup tables of the RaSTA redundancy layer CRC module.
+ *
+ * This file is generated by scripts/GenerateCrcTables.py, do not edit it manually.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "redcrc_red_crc_tables.h"  // NOLINT(build/include_subdir)
+
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Global Constant Definitions
+// -----------------------------------------------------------------------------
+
+const uint32_t redcrc_kCrcTables[REDCRC_TABLE_TYPES][REDCRC_SLICING_TABLES][REDCRC_TABLE_SIZE] = {
+  {  // Check code type B: CRC32 with polynomial 0xEE5B42FD
+    {
+      0x00000000U, 0xEE5B42FDU, 0x32EDC707U, 0xDCB685FAU, 0x65DB8E0EU, 0x8B80CCF3U, 0x57364909U, 0xB96D0BF4U,
+      0xCBB71C1CU, 0x25EC5EE1U, 0xF95ADB1BU, 0x170199E6U, 0xAE6C9212U, 0x4037D0EFU, 0x9C815515U, 0x72DA17E8U,
+      0x79357AC5U, 0x976E3838U, 0x4BD8BDC2U, 0xA583FF3FU, 0x1CEEF4CBU, 0xF2B5B636U, 0x2E0333CCU, 0xC0587131U,
+      0xB28266D9U, 0x5CD92424U, 0x806FA1DEU, 0x6E34E323U, 0xD759E8D7U, 0x3902AA2AU, 0xE5B42FD0U, 0x0BEF6D2DU,
+      0xF26AF58AU, 0x1C31B777U, 0xC087328DU, 0x2EDC7070U, 0x97B17B84U, 0x79EA3979U, 0xA55CBC83U, 0x4B07FE7EU,
+      0x39DDE996U, 0xD786AB6BU, 0x0B302E91U, 0xE56B6C6CU, 0x5C066798U, 0xB25D2565U, 0x6EEBA09FU, 0x80B0E262U,
+      0x8B5F8F4FU, 0x6504CDB2U, 0xB9B24848U, 0x57E90AB5U, 0xEE840141U, 0x00DF43BCU, 0xDC69C646U, 0x323284BBU,
+      0x40E89353U, 0xAEB3D1AEU, 0x72055454U, 0x9C5E16A9U, 0x25331D5DU, 0xCB685FA0U, 0x17DEDA5AU, 0xF98598A7U,
+      0x0A8EA9E9U, 0xE4D5EB14U, 0x38636EEEU, 0xD6382C13U, 0x6F5527E7U, 0x810E651AU, 0x5DB8E0E0U, 0xB3E3A21DU,
+      0xC139B5F5U, 0x2F62F708U, 0xF3D472F2U, 0x1D8F300FU, 0xA4E23BFBU, 0x4AB97906U, 0x960FFCFCU, 0x7854BE01U,
+      0x73BBD32CU, 0x9DE091D1U, 0x4156142BU, 0xAF0D56D6U, 0x16605D22U, 0xF83B1FDFU, 0x248D9A25U, 0xCAD6D8D8U,
+      0xB80CCF30U, 0x56578DCDU, 0x8AE10837U, 0x64BA4ACAU, 0xDDD7413EU, 0x338C03C3U, 0xEF3A8639U, 0x0161C4C4U,
+      0xF8E45C63U, 0x16BF1E9EU, 0xCA099B64U, 0x2452D999U, 0x9D3FD26DU, 0x73649090U, 0xAFD2156AU, 0x41895797U,
+      0x3353407FU, 0xDD080282U, 0x01BE8778U, 0xEFE5C585U, 0x5688CE71U, 0xB8D38C8CU, 0x64650976U, 0x8A3E4B8BU,
+      0x81D126A6U, 0x6F8A645BU, 0xB33CE1A1U, 0x5D67A35CU, 0xE40AA8A8U, 0x0A51EA55U, 0xD6E76FAFU, 0x38BC2D52U,
+      0x4A663ABAU, 0xA43D7847U, 0x788BFDBDU, 0x96D0BF40U, 0x2FBDB4B4U, 0xC1E6F649U, 0x1D5073B3U, 0xF30B314EU,
+      0x151D53D2U, 0xFB46112FU, 0x27F094D5U, 0xC9ABD628U, 0x70C6DDDCU, 0x9E9D9F21U, 0x422B1ADBU, 0xAC705826U,
+      0xDEAA4FCEU, 0x30F10D33U, 0xEC4788C9U, 0x021CCA34U, 0xBB71C1C0U, 0x552A833DU, 0x899C06C7U, 0x67C7443AU,
+      0x6C282917U, 0x82736BEAU, 0x5EC5EE10U, 0xB09EACEDU, 0x09F3A719U, 0xE7A8E5E4U, 0x3B1E601EU, 0xD54522E3U,
+      0xA79F350BU, 0x49C477F6U, 0x9572F20CU, 0x7B29B0F1U, 0xC244BB05U, 0x2C1FF9F8U, 0xF0A97C02U, 0x1EF23EFFU,
+      0xE777A658U, 0x092CE4A5U, 0xD59A615FU, 0x3BC123A2U, 0x82AC2856U, 0x6CF76AABU, 0xB041EF51U, 0x5E1AADACU,
+      0x2CC0BA44U, 0xC29BF8B9U, 0x1E2D7D43U, 0xF0763FBEU, 0x491B344AU, 0xA74076B7U, 0x7BF6F34DU, 0x95ADB1B0U,
+      0x9E42DC9DU, 0x70199E60U, 0xACAF1B9AU, 0x42F45967U, 0xFB995293U, 0x15C2106EU, 0xC9749594U, 0x272FD769U,
+      0x55F5C081U, 0xBBAE827CU, 0x67180786U, 0x8943457BU, 0x302E4E8FU, 0xDE750C72U, 0x02C38988U, 0xEC98CB75U,
+      0x1F93FA3BU, 0xF1C8B8C6U, 0x2D7E3D3CU, 0xC3257FC1U, 0x7A487435U, 0x941336C8U, 0x48A5B332U, 0xA6FEF1CFU,
+      0xD424E627U, 0x3A7FA4DAU, 0xE6C92120U, 0x089263DDU, 0xB1FF6829U, 0x5FA42AD4U, 0x8312AF2EU, 0x6D49EDD3U,
+      0x66A680FEU, 0x88FDC203U, 0x544B47F9U, 0xBA100504U, 0x037D0EF0U, 0xED264C0DU, 0x3190C9F7U, 0xDFCB8B0AU,
+      0xAD119CE2U, 0x434ADE1FU, 0x9FFC5BE5U, 0x71A71918U, 0xC8CA12ECU, 0x26915011U, 0xFA27D5EBU, 0x147C9716U,
+      0xEDF90FB1U, 0x03A24D4CU, 0xDF14C8B6U, 0x314F8A4BU, 0x882281BFU, 0x6679C342U, 0xBACF46B8U, 0x54940445U,
+      0x264E13ADU, 0xC8155150U, 0x14A3D4AAU, 0xFAF89657U, 0x43959DA3U, 0xADCEDF5EU, 0x71785AA4U, 0x9F231859U,
+      0x94CC7574U, 0x7A973789U, 0xA621B273U, 0x487AF08EU, 0xF117FB7AU, 0x1F4CB987U, 0xC3FA3C7DU, 0x2DA17E80U,
+      0x5F7B6968U, 0xB1202B95U, 0x6D96AE6FU, 0x83CDEC92U, 0x3AA0E766U, 0xD4FBA59BU, 0x084D2061U, 0xE616629CU
+    },
+    {
+      0x00000000U, 0x2A3AA7A4U, 0x54754F48U, 0x7E4FE8ECU, 0xA8EA9E90U, 0x82D03934U, 0xFC9FD1D8U, 0xD6A5767CU,
+      0xBF8E7FDDU, 0x95B4D879U, 0xEBFB3095U, 0xC1C19731U, 0x1764E14DU, 0x3D5E46E9U, 0x4311AE05U, 0x692B09A1U,
+      0x9147BD47U, 0xBB7D1AE3U, 0xC532F20FU, 0xEF0855ABU, 0x39AD23D7U, 0x13978473U, 0x6DD86C9FU, 0x47E2CB3BU,
+      0x2EC9C29AU, 0x04F3653EU, 0x7ABC8DD2U, 0x50862A76U, 0x86235C0AU, 0xAC19FBAEU, 0xD2561342U, 0xF86CB4E6U,
+      0xCCD43873U, 0xE6EE9FD7U, 0x98A1773BU, 0xB29BD09FU, 0x643EA6E3U, 0x4E040147U, 0x304BE9ABU, 0x1A714E0FU,
+      0x735A47AEU, 0x5960E00AU, 0x272F08E6U, 0x0D15AF42U, 0xDBB0D93EU, 0xF18A7E9AU, 0x8FC59676U, 0xA5FF31D2U,
+      0x5D938534U, 0x77A92290U, 0x09E6CA7CU, 0x23DC6DD8U, 0xF5791BA4U, 0xDF43BC00U, 0xA10C54ECU, 0x8B36F348U,
+      0xE21DFAE9U, 0xC8275D4DU, 0xB668B5A1U, 0x9C521205U, 0x4AF76479U, 0x60CDC3DDU, 0x1E822B31U, 0x34B88C95U,
+      0x77F3321BU, 0x5DC995BFU, 0x23867D53U, 0x09BCDAF7U, 0xDF19AC8BU, 0xF5230B2FU, 0x8B6CE3C3U, 0xA1564467U,
+      0xC87D4DC6U, 0xE247EA62U, 0x9C08028EU, 0xB632A52AU, 0x6097D356U, 0x4AAD74F2U, 0x34E29C1EU, 0x1ED83BBAU,
+      0xE6B48F5CU, 0xCC8E28F8U, 0xB2C1C014U, 0x98FB67B0U, 0x4E5E11CCU, 0x6464B668U, 0x1A2B5E84U, 0x3011F920U,
+      0x593AF081U, 0x73005725U, 0x0D4FBFC9U, 0x2775186DU, 0xF1D06E11U, 0xDBEAC9B5U, 0xA5A52159U, 0x8F9F86FDU,
+      0xBB270A68U, 0x911DADCCU, 0xEF524520U, 0xC568E284U, 0x13CD94F8U, 0x39F7335CU, 0x47B8DBB0U, 0x6D827C14U,
+      0x04A975B5U, 0x2E93D211U, 0x50DC3AFDU, 0x7AE69D59U, 0xAC43EB25U, 0x86794C81U, 0xF836A46DU, 0xD20C03C9U,
+      0x2A60B72FU, 0x005A108BU, 0x7E15F867U, 0x542F5FC3U, 0x828A29BFU, 0xA8B08E1BU, 0xD6FF66F7U, 0xFCC5C153U,
+      0x95EEC8F2U, 0xBFD46F56U, 0xC19B87BAU, 0xEBA1201EU, 0x3D045662U, 0x173EF1C6U, 0x6971192AU, 0x434BBE8EU,
+      0xEFE66436U, 0xC5DCC392U, 0xBB932B7EU, 0x91A98CDAU, 0x470CFAA6U, 0x6D365D02U, 0x1379B5EEU, 0x3943124AU,
+      0x50681BEBU, 0x7A52BC4FU, 0x041D54A3U, 0x2E27F307U, 0xF882857BU, 0xD2B822DFU, 0xACF7CA33U, 0x86CD6D97U,
+      0x7EA1D971U, 0x549B7ED5U, 0x2AD49639U, 0x00EE319DU, 0xD64B47E1U, 0xFC71E045U, 0x823E08A9U, 0xA804AF0DU,
+      0xC12FA6ACU, 0xEB150108U, 0x955AE9E4U, 0xBF604E40U, 0x69C5383CU, 0x43FF9F98U, 0x3DB07774U, 0x178AD0D0U,
+      0x23325C45U, 0x0908FBE1U, 0x7747130DU, 0x5D7DB4A9U, 0x8BD8C2D5U, 0xA1E26571U, 0xDFAD8D9DU, 0xF5972A39U,
+      0x9CBC2398U, 0xB686843CU, 0xC8C96CD0U, 0xE2F3CB74U, 0x3456BD08U, 0x1E6C1AACU, 0x6023F240U, 0x4A1955E4U,
+      0xB275E102U, 0x984F46A6U, 0xE600AE4AU, 0xCC3A09EEU, 0x1A9F7F92U, 0x30A5D836U, 0x4EEA30DAU, 0x64D0977EU,
+      0x0DFB9EDFU, 0x27C1397BU, 0x598ED197U, 0x73B47633U, 0xA511004FU, 0x8F2BA7EBU, 0xF1644F07U, 0xDB5EE8A3U,
+      0x9815562DU, 0xB22FF189U, 0xCC601965U, 0xE65ABEC1U, 0x30FFC8BDU, 0x1AC56F19U, 0x648A87F5U, 0x4EB02051U,
+      0x279B29F0U, 0x0DA18E54U, 0x73EE66B8U, 0x59D4C11CU, 0x8F71B760U, 0xA54B10C4U, 0xDB04F828U, 0xF13E5F8CU,
+      0x0952EB6AU, 0x23684CCEU, 0x5D27A422U, 0x771D0386U, 0xA1B875FAU, 0x8B82D25EU, 0xF5CD3AB2U, 0xDFF79D16U,
+      0xB6DC94B7U, 0x9CE63313U, 0xE2A9DBFFU, 0xC8937C5BU, 0x1E360A27U, 0x340CAD83U, 0x4A43456FU, 0x6079E2CBU,
+      0x54C16E5EU, 0x7EFBC9FAU, 0x00B42116U, 0x2A8E86B2U, 0xFC2BF0CEU, 0xD611576AU, 0xA85EBF86U, 0x82641822U,
+      0xEB4F1183U, 0xC175B627U, 0xBF3A5ECBU, 0x9500F96FU, 0x43A58F13U, 0x699F28B7U, 0x17D0C05BU, 0x3DEA67FFU,
+      0xC586D319U, 0xEFBC74BDU, 0x91F39C51U, 0xBBC93BF5U, 0x6D6C4D89U, 0x4756EA2DU, 0x391902C1U, 0x1323A565U,
+      0x7A08ACC4U, 0x50320B60U, 0x2E7DE38CU, 0x04474428U, 0xD2E23254U, 0xF8D895F0U, 0x86977D1CU, 0xACADDAB8U
+    },
+    {
+      0x00000000U, 0x31978A91U, 0x632F1522U, 0x52B89FB3U, 0xC65E2A44U, 0xF7C9A0D5U, 0xA5713F66U, 0x94E6B5F7U,
+      0x62E71675U, 0x53709CE4U, 0x01C80357U, 0x305F89C6U, 0xA4B93C31U, 0x952EB6A0U, 0xC7962913U, 0xF601A382U,
+      0xC5CE2CEAU, 0xF459A67BU, 0xA6E139C8U, 0x9776B359U, 0x039006AEU, 0x32078C3FU, 0x60BF138CU, 0x5128991DU,
+      0xA7293A9FU, 0x96BEB00EU, 0xC4062FBDU, 0xF591A52CU, 0x617710DBU, 0x50E09A4AU, 0x025805F9U, 0x33CF8F68U,
+      0x65C71B29U, 0x545091B8U, 0x06E80E0BU, 0x377F849AU, 0xA399316DU, 0x920EBBFCU, 0xC0B6244FU, 0xF121AEDEU,
+      0x07200D5CU, 0x36B787CDU, 0x640F187EU, 0x559892EFU, 0xC17E2718U, 0xF0E9AD89U, 0xA251323AU, 0x93C6B8ABU,
+      0xA00937C3U, 0x919EBD52U, 0xC32622E1U, 0xF2B1A870U, 0x66571D87U, 0x57C09716U, 0x057808A5U, 0x34EF8234U,
+      0xC2EE21B6U, 0xF379AB27U, 0xA1C13494U, 0x9056BE05U, 0x04B00BF2U, 0x35278163U, 0x679F1ED0U, 0x56089441U,
+      0xCB8E3652U, 0xFA19BCC3U, 0xA8A12370U, 0x9936A9E1U, 0x0DD01C16U, 0x3C479687U, 0x6EFF0934U, 0x5F6883A5U,
+      0xA9692027U, 0x98FEAAB6U, 0xCA463505U, 0xFBD1BF94U, 0x6F370A63U, 0x5EA080F2U, 0x0C181F41U, 0x3D8F95D0U,
+      0x0E401AB8U, 0x3FD79029U, 0x6D6F0F9AU, 0x5CF8850BU, 0xC81E30FCU, 0xF989BA6DU, 0xAB3125DEU, 0x9AA6AF4FU,
+      0x6CA70CCDU, 0x5D30865CU, 0x0F8819EFU, 0x3E1F937EU, 0xAAF92689U, 0x9B6EAC18U, 0xC9D633ABU, 0xF841B93AU,
+      0xAE492D7BU, 0x9FDEA7EAU, 0xCD663859U, 0xFCF1B2C8U, 0x6817073FU, 0x59808DAEU, 0x0B38121DU, 0x3AAF988CU,
+      0xCCAE3B0EU, 0xFD39B19FU, 0xAF812E2CU, 0x9E16A4BDU, 0x0AF0114AU, 0x3B679BDBU, 0x69DF0468U, 0x58488EF9U,
+      0x6B870191U, 0x5A108B00U, 0x08A814B3U, 0x393F9E22U, 0xADD92BD5U, 0x9C4EA144U, 0xCEF63EF7U, 0xFF61B466U,
+      0x096017E4U, 0x38F79D75U, 0x6A4F02C6U, 0x5BD88857U, 0xCF3E3DA0U, 0xFEA9B731U, 0xAC112882U, 0x9D86A213U,
+      0x79472E59U, 0x48D0A4C8U, 0x1A683B7BU, 0x2BFFB1EAU, 0xBF19041DU, 0x8E8E8E8CU, 0xDC36113FU, 0xEDA19BAEU,
+      0x1BA0382CU, 0x2A37B2BDU, 0x788F2D0EU, 0x4918A79FU, 0xDDFE1268U, 0xEC6998F9U, 0xBED1074AU, 0x8F468DDBU,
+      0xBC8902B3U, 0x8D1E8822U, 0xDFA61791U, 0xEE319D00U, 0x7AD728F7U, 0x4B40A266U, 0x19F83DD5U, 0x286FB744U,
+      0xDE6E14C6U, 0xEFF99E57U, 0xBD4101E4U, 0x8CD68B75U, 0x18303E82U, 0x29A7B413U, 0x7B1F2BA0U, 0x4A88A131U,
+      0x1C803570U, 0x2D17BFE1U, 0x7FAF2052U, 0x4E38AAC3U, 0xDADE1F34U, 0xEB4995A5U, 0xB9F10A16U, 0x88668087U,
+      0x7E672305U, 0x4FF0A994U, 0x1D483627U, 0x2CDFBCB6U, 0xB8390941U, 0x89AE83D0U, 0xDB161C63U, 0xEA8196F2U,
+      0xD94E199AU, 0xE8D9930BU, 0xBA610CB8U, 0x8BF68629U, 0x1F1033DEU, 0x2E87B94FU, 0x7C3F26FCU, 0x4DA8AC6DU,
+      0xBBA90FEFU, 0x8A3E857EU, 0xD8861ACDU, 0xE911905CU, 0x7DF725ABU, 0x4C60AF3AU, 0x1ED83089U, 0x2F4FBA18U,
+      0xB2C9180BU, 0x835E929AU, 0xD1E60D29U, 0xE07187B8U, 0x7497324FU, 0x4500B8DEU, 0x17B8276DU, 0x262FADFCU,
+      0xD02E0E7EU, 0xE1B984EFU, 0xB3011B5CU, 0x829691CDU, 0x1670243AU, 0x27E7AEABU, 0x755F3118U, 0x44C8BB89U,
+      0x770734E1U, 0x4690BE70U, 0x142821C3U, 0x25BFAB52U, 0xB1591EA5U, 0x80CE9434U, 0xD2760B87U, 0xE3E18116U,
+      0x15E02294U, 0x2477A805U, 0x76CF37B6U, 0x4758BD27U, 0xD3BE08D0U, 0xE2298241U, 0xB0911DF2U, 0x81069763U,
+      0xD70E0322U, 0xE69989B3U, 0xB4211600U, 0x85B69C91U, 0x11502966U, 0x20C7A3F7U, 0x727F3C44U, 0x43E8B6D5U,
+      0xB5E91557U, 0x847E9FC6U, 0xD6C60075U, 0xE7518AE4U, 0x73B73F13U, 0x4220B582U, 0x10982A31U, 0x210FA0A0U,
+      0x12C02FC8U, 0x2357A559U, 0x71EF3AEAU, 0x4078B07BU, 0xD49E058CU, 0xE5098F1DU, 0xB7B110AEU, 0x86269A3FU,
+      0x702739BDU, 0x41B0B32CU, 0x13082C9FU, 0x229FA60EU, 0xB67913F9U, 0x87EE9968U, 0xD55606DBU, 0xE4C18C4AU
+    },
+    {
+      0x00000000U, 0xF28E5CB2U, 0x0B47FB99U, 0xF9C9A72BU, 0x168FF732U, 0xE401AB80U, 0x1DC80CABU, 0xEF465019U,
+      0x2D1FEE64U, 0xDF91B2D6U, 0x265815FDU, 0xD4D6494FU, 0x3B901956U, 0xC91E45E4U, 0x30D7E2CFU, 0xC259BE7DU,
+      0x5A3FDCC8U, 0xA8B1807AU, 0x51782751U, 0xA3F67BE3U, 0x4CB02BFAU, 0xBE3E7748U, 0x47F7D063U, 0xB5798CD1U,
+      0x772032ACU, 0x85AE6E1EU, 0x7C67C935U, 0x8EE99587U, 0x61AFC59EU, 0x9321992CU, 0x6AE83E07U, 0x986662B5U,
+      0xB47FB990U, 0x46F1E522U, 0xBF384209U, 0x4DB61EBBU, 0xA2F04EA2U, 0x507E1210U, 0xA9B7B53BU, 0x5B39E989U,
+      0x996057F4U, 0x6BEE0B46U, 0x9227AC6DU, 0x60A9F0DFU, 0x8FEFA0C6U, 0x7D61FC74U, 0x84A85B5FU, 0x762607EDU,
+      0xEE406558U, 0x1CCE39EAU, 0xE5079EC1U, 0x1789C273U, 0xF8CF926AU, 0x0A41CED8U, 0xF38869F3U, 0x01063541U,
+      0xC35F8B3CU, 0x31D1D78EU, 0xC81870A5U, 0x3A962C17U, 0xD5D07C0EU, 0x275E20BCU, 0xDE978797U, 0x2C19DB25U,
+      0x86A431DDU, 0x742A6D6FU, 0x8DE3CA44U, 0x7F6D96F6U, 0x902BC6EFU, 0x62A59A5DU, 0x9B6C3D76U, 0x69E261C4U,
+      0xABBBDFB9U, 0x5935830BU, 0xA0FC2420U, 0x52727892U, 0xBD34288BU, 0x4FBA7439U, 0xB673D312U, 0x44FD8FA0U,
+      0xDC9BED15U, 0x2E15B1A7U, 0xD7DC168CU, 0x25524A3EU, 0xCA141A27U, 0x389A4695U, 0xC153E1BEU, 0x33DDBD0CU,
+      0xF1840371U, 0x030A5FC3U, 0xFAC3F8E8U, 0x084DA45AU, 0xE70BF443U, 0x1585A8F1U, 0xEC4C0FDAU, 0x1EC25368U,
+      0x32DB884DU, 0xC055D4FFU, 0x399C73D4U, 0xCB122F66U, 0x24547F7FU, 0xD6DA23CDU, 0x2F1384E6U, 0xDD9DD854U,
+      0x1FC46629U, 0xED4A3A9BU, 0x14839DB0U, 0xE60DC102U, 0x094B911BU, 0xFBC5CDA9U, 0x020C6A82U, 0xF0823630U,
+      0x68E45485U, 0x9A6A0837U, 0x63A3AF1CU, 0x912DF3AEU, 0x7E6BA3B7U, 0x8CE5FF05U, 0x752C582EU, 0x87A2049CU,
+      0x45FBBAE1U, 0xB775E653U, 0x4EBC4178U, 0xBC321DCAU, 0x53744DD3U, 0xA1FA1161U, 0x5833B64AU, 0xAABDEAF8U,
+      0xE3132147U, 0x119D7DF5U, 0xE854DADEU, 0x1ADA866CU, 0xF59CD675U, 0x07128AC7U, 0xFEDB2DECU, 0x0C55715EU,
+      0xCE0CCF23U, 0x3C829391U, 0xC54B34BAU, 0x37C56808U, 0xD8833811U, 0x2A0D64A3U, 0xD3C4C388U, 0x214A9F3AU,
+      0xB92CFD8FU, 0x4BA2A13DU, 0xB26B0616U, 0x40E55AA4U, 0xAFA30ABDU, 0x5D2D560FU, 0xA4E4F124U, 0x566AAD96U,
+      0x943313EBU, 0x66BD4F59U, 0x9F74E872U, 0x6DFAB4C0U, 0x82BCE4D9U, 0x7032B86BU, 0x89FB1F40U, 0x7B7543F2U,
+      0x576C98D7U, 0xA5E2C465U, 0x5C2B634EU, 0xAEA53FFCU, 0x41E36FE5U, 0xB36D3357U, 0x4AA4947CU, 0xB82AC8CEU,
+      0x7A7376B3U, 0x88FD2A01U, 0x71348D2AU, 0x83BAD198U, 0x6CFC8181U, 0x9E72DD33U, 0x67BB7A18U, 0x953526AAU,
+      0x0D53441FU, 0xFFDD18ADU, 0x0614BF86U, 0xF49AE334U, 0x1BDCB32DU, 0xE952EF9FU, 0x109B48B4U, 0xE2151406U,
+      0x204CAA7BU, 0xD2C2F6C9U, 0x2B0B51E2U, 0xD9850D50U, 0x36C35D49U, 0xC44D01FBU, 0x3D84A6D0U, 0xCF0AFA62U,
+      0x65B7109AU, 0x97394C28U, 0x6EF0EB03U, 0x9C7EB7B1U, 0x7338E7A8U, 0x81B6BB1AU, 0x787F1C31U, 0x8AF14083U,
+      0x48A8FEFEU, 0xBA26A24CU, 0x43EF0567U, 0xB16159D5U, 0x5E2709CCU, 0xACA9557EU, 0x5560F255U, 0xA7EEAEE7U,
+      0x3F88CC52U, 0xCD0690E0U, 0x34CF37CBU, 0xC6416B79U, 0x29073B60U, 0xDB8967D2U, 0x2240C0F9U, 0xD0CE9C4BU,
+      0x12972236U, 0xE0197E84U, 0x19D0D9AFU, 0xEB5E851DU, 0x0418D504U, 0xF69689B6U, 0x0F5F2E9DU, 0xFDD1722FU,
+      0xD1C8A90AU, 0x2346F5B8U, 0xDA8F5293U, 0x28010E21U, 0xC7475E38U, 0x35C9028AU, 0xCC00A5A1U, 0x3E8EF913U,
+      0xFCD7476EU, 0x0E591BDCU, 0xF790BCF7U, 0x051EE045U, 0xEA58B05CU, 0x18D6ECEEU, 0xE11F4BC5U, 0x13911777U,
+      0x8BF775C2U, 0x79792970U, 0x80B08E5BU, 0x723ED2E9U, 0x9D7882F0U, 0x6FF6DE42U, 0x963F7969U, 0x64B125DBU,
+      0xA6E89BA6U, 0x5466C714U, 0xADAF603FU, 0x5F213C8DU, 0xB0676C94U, 0x42E93026U, 0xBB20970DU, 0x49AECBBFU
+    },
+    {
+      0x00000000U, 0x287D0073U, 0x50FA00E6U, 0x78870095U, 0xA1F401CCU, 0x898901BFU, 0xF10E012AU, 0xD9730159U,
+      0xADB34165U, 0x85CE4116U, 0xFD494183U, 0xD53441F0U, 0x0C4740A9U, 0x243A40DAU, 0x5CBD404FU, 0x74C0403CU,
+      0xB53DC037U, 0x9D40C044U, 0xE5C7C0D1U, 0xCDBAC0A2U, 0x14C9C1FBU, 0x3CB4C188U, 0x4433C11DU, 0x6C4EC16EU,
+      0x188E8152U, 0x30F38121U, 0x487481B4U, 0x600981C7U, 0xB97A809EU, 0x910780EDU, 0xE9808078U, 0xC1FD800BU,
+      0x8420C293U, 0xAC5DC2E0U, 0xD4DAC275U, 0xFCA7C206U, 0x25D4C35FU, 0x0DA9C32CU, 0x752EC3B9U, 0x5D53C3CAU,
+      0x299383F6U, 0x01EE8385U, 0x79698310U, 0x51148363U, 0x8867823AU, 0xA01A8249U, 0xD89D82DCU, 0xF0E082AFU,
+      0x311D02A4U, 0x196002D7U, 0x61E70242U, 0x499A0231U, 0x90E90368U, 0xB894031BU, 0xC013038EU, 0xE86E03FDU,
+      0x9CAE43C1U, 0xB4D343B2U, 0xCC544327U, 0xE4294354U, 0x3D5A420DU, 0x1527427EU, 0x6DA042EBU, 0x45DD4298U,
+      0xE61AC7DBU, 0xCE67C7A8U, 0xB6E0C73DU, 0x9E9DC74EU, 0x47EEC617U, 0x6F93C664U, 0x1714C6F1U, 0x3F69C682U,
+      0x4BA986BEU, 0x63D486CDU, 0x1B538658U, 0x332E862BU, 0xEA5D8772U, 0xC2208701U, 0xBAA78794U, 0x92DA87E7U,
+      0x532707ECU, 0x7B5A079FU, 0x03DD070AU, 0x2BA00779U, 0xF2D30620U, 0xDAAE0653U, 0xA22906C6U, 0x8A5406B5U,
+      0xFE944689U, 0xD6E946FAU, 0xAE6E466FU, 0x8613461CU, 0x5F604745U, 0x771D4736U, 0x0F9A47A3U, 0x27E747D0U,
+      0x623A0548U, 0x4A47053BU, 0x32C005AEU, 0x1ABD05DDU, 0xC3CE0484U, 0xEBB304F7U, 0x93340462U, 0xBB490411U,
+      0xCF89442DU, 0xE7F4445EU, 0x9F7344CBU, 0xB70E44B8U, 0x6E7D45E1U, 0x46004592U, 0x3E874507U, 0x16FA4574U,
+      0xD707C57FU, 0xFF7AC50CU, 0x87FDC599U, 0xAF80C5EAU, 0x76F3C4B3U, 0x5E8EC4C0U, 0x2609C455U, 0x0E74C426U,
+      0x7AB4841AU, 0x52C98469U, 0x2A4E84FCU, 0x0233848FU, 0xDB4085D6U, 0xF33D85A5U, 0x8BBA8530U, 0xA3C78543U,
+      0x226ECD4BU, 0x0A13CD38U, 0x7294CDADU, 0x5AE9CDDEU, 0x839ACC87U, 0xABE7CCF4U, 0xD360CC61U, 0xFB1DCC12U,
+      0x8FDD8C2EU, 0xA7A08C5DU, 0xDF278CC8U, 0xF75A8CBBU, 0x2E298DE2U, 0x06548D91U, 0x7ED38D04U, 0x56AE8D77U,
+      0x97530D7CU, 0xBF2E0D0FU, 0xC7A90D9AU, 0xEFD40DE9U, 0x36A70CB0U, 0x1EDA0CC3U, 0x665D0C56U, 0x4E200C25U,
+      0x3AE04C19U, 0x129D4C6AU, 0x6A1A4CFFU, 0x42674C8CU, 0x9B144DD5U, 0xB3694DA6U, 0xCBEE4D33U, 0xE3934D40U,
+      0xA64E0FD8U, 0x8E330FABU, 0xF6B40F3EU, 0xDEC90F4DU, 0x07BA0E14U, 0x2FC70E67U, 0x57400EF2U, 0x7F3D0E81U,
+      0x0BFD4EBDU, 0x23804ECEU, 0x5B074E5BU, 0x737A4E28U, 0xAA094F71U, 0x82744F02U, 0xFAF34F97U, 0xD28E4FE4U,
+      0x1373CFEFU, 0x3B0ECF9CU, 0x4389CF09U, 0x6BF4CF7AU, 0xB287CE23U, 0x9AFACE50U, 0xE27DCEC5U, 0xCA00CEB6U,
+      0xBEC08E8AU, 0x96BD8EF9U, 0xEE3A8E6CU, 0xC6478E1FU, 0x1F348F46U, 0x37498F35U, 0x4FCE8FA0U, 0x67B38FD3U,
+      0xC4740A90U, 0xEC090AE3U, 0x948E0A76U, 0xBCF30A05U, 0x65800B5CU, 0x4DFD0B2FU, 0x357A0BBAU, 0x1D070BC9U,
+      0x69C74BF5U, 0x41BA4B86U, 0x393D4B13U, 0x11404B60U, 0xC8334A39U, 0xE04E4A4AU, 0x98C94ADFU, 0xB0B44AACU,
+      0x7149CAA7U, 0x5934CAD4U, 0x21B3CA41U, 0x09CECA32U, 0xD0BDCB6BU, 0xF8C0CB18U, 0x8047CB8DU, 0xA83ACBFEU,
+      0xDCFA8BC2U, 0xF4878BB1U, 0x8C008B24U, 0xA47D8B57U, 0x7D0E8A0EU, 0x55738A7DU, 0x2DF48AE8U, 0x05898A9BU,
+      0x4054C803U, 0x6829C870U, 0x10AEC8E5U, 0x38D3C896U, 0xE1A0C9CFU, 0xC9DDC9BCU, 0xB15AC929U, 0x9927C95AU,
+      0xEDE78966U, 0xC59A8915U, 0xBD1D8980U, 0x956089F3U, 0x4C1388AAU, 0x646E88D9U, 0x1CE9884CU, 0x3494883FU,
+      0xF5690834U, 0xDD140847U, 0xA59308D2U, 0x8DEE08A1U, 0x549D09F8U, 0x7CE0098BU, 0x0467091EU, 0x2C1A096DU,
+      0x58DA4951U, 0x70A74922U, 0x082049B7U, 0x205D49C4U, 0xF92E489DU, 0xD15348EEU, 0xA9D4487BU, 0x81A94808U
+    },
+    {
+      0x00000000U, 0x44DD9A96U, 0x89BB352CU, 0xCD66AFBAU, 0xFD2D28A5U, 0xB9F0B233U, 0x74961D89U, 0x304B871FU,
+      0x140113B7U, 0x50DC8921U, 0x9DBA269BU, 0xD967BC0DU, 0xE92C3B12U, 0xADF1A184U, 0x60970E3EU, 0x244A94A8U,
+      0x2802276EU, 0x6CDFBDF8U, 0xA1B91242U, 0xE56488D4U, 0xD52F0FCBU, 0x91F2955DU, 0x5C943AE7U, 0x1849A071U,
+      0x3C0334D9U, 0x78DEAE4FU, 0xB5B801F5U, 0xF1659B63U, 0xC12E1C7CU, 0x85F386EAU, 0x48952950U, 0x0C48B3C6U,
+      0x50044EDCU, 0x14D9D44AU, 0xD9BF7BF0U, 0x9D62E166U, 0xAD296679U, 0xE9F4FCEFU, 0x24925355U, 0x604FC9C3U,
+      0x44055D6BU, 0x00D8C7FDU, 0xCDBE6847U, 0x8963F2D1U, 0xB92875CEU, 0xFDF5EF58U, 0x309340E2U, 0x744EDA74U,
+      0x780669B2U, 0x3CDBF324U, 0xF1BD5C9EU, 0xB560C608U, 0x852B4117U, 0xC1F6DB81U, 0x0C90743BU, 0x484DEEADU,
+      0x6C077A05U, 0x28DAE093U, 0xE5BC4F29U, 0xA161D5BFU, 0x912A52A0U, 0xD5F7C836U, 0x1891678CU, 0x5C4CFD1AU,
+      0xA0089DB8U, 0xE4D5072EU, 0x29B3A894U, 0x6D6E3202U, 0x5D25B51DU, 0x19F82F8BU, 0xD49E8031U, 0x90431AA7U,
+      0xB4098E0FU, 0xF0D41499U, 0x3DB2BB23U, 0x796F21B5U, 0x4924A6AAU, 0x0DF93C3CU, 0xC09F9386U, 0x84420910U,
+      0x880ABAD6U, 0xCCD72040U, 0x01B18FFAU, 0x456C156CU, 0x75279273U, 0x31FA08E5U, 0xFC9CA75FU, 0xB8413DC9U,
+      0x9C0BA961U, 0xD8D633F7U, 0x15B09C4DU, 0x516D06DBU, 0x612681C4U, 0x25FB1B52U, 0xE89DB4E8U, 0xAC402E7EU,
+      0xF00CD364U, 0xB4D149F2U, 0x79B7E648U, 0x3D6A7CDEU, 0x0D21FBC1U, 0x49FC6157U, 0x849ACEEDU, 0xC047547BU,
+      0xE40DC0D3U, 0xA0D05A45U, 0x6DB6F5FFU, 0x296B6F69U, 0x1920E876U, 0x5DFD72E0U, 0x909BDD5AU, 0xD44647CCU,
+      0xD80EF40AU, 0x9CD36E9CU, 0x51B5C126U, 0x15685BB0U, 0x2523DCAFU, 0x61FE4639U, 0xAC98E983U, 0xE8457315U,
+      0xCC0FE7BDU, 0x88D27D2BU, 0x45B4D291U, 0x01694807U, 0x3122CF18U, 0x75FF558EU, 0xB899FA34U, 0xFC4460A2U,
+      0xAE4A798DU, 0xEA97E31BU, 0x27F14CA1U, 0x632CD637U, 0x53675128U, 0x17BACBBEU, 0xDADC6404U, 0x9E01FE92U,
+      0xBA4B6A3AU, 0xFE96F0ACU, 0x33F05F16U, 0x772DC580U, 0x4766429FU, 0x03BBD809U, 0xCEDD77B3U, 0x8A00ED25U,
+      0x86485EE3U, 0xC295C475U, 0x0FF36BCFU, 0x4B2EF159U, 0x7B657646U, 0x3FB8ECD0U, 0xF2DE436AU, 0xB603D9FCU,
+      0x92494D54U, 0xD694D7C2U, 0x1BF27878U, 0x5F2FE2EEU, 0x6F6465F1U, 0x2BB9FF67U, 0xE6DF50DDU, 0xA202CA4BU,
+      0xFE4E3751U, 0xBA93ADC7U, 0x77F5027DU, 0x332898EBU, 0x03631FF4U, 0x47BE8562U, 0x8AD82AD8U, 0xCE05B04EU,
+      0xEA4F24E6U, 0xAE92BE70U, 0x63F411CAU, 0x27298B5CU, 0x17620C43U, 0x53BF96D5U, 0x9ED9396FU, 0xDA04A3F9U,
+      0xD64C103FU, 0x92918AA9U, 0x5FF72513U, 0x1B2ABF85U, 0x2B61389AU, 0x6FBCA20CU, 0xA2DA0DB6U, 0xE6079720U,
+      0xC24D0388U, 0x8690991EU, 0x4BF636A4U, 0x0F2BAC32U, 0x3F602B2DU, 0x7BBDB1BBU, 0xB6DB1E01U, 0xF2068497U,
+      0x0E42E435U, 0x4A9F7EA3U, 0x87F9D119U, 0xC3244B8FU, 0xF36FCC90U, 0xB7B25606U, 0x7AD4F9BCU, 0x3E09632AU,
+      0x1A43F782U, 0x5E9E6D14U, 0x93F8C2AEU, 0xD7255838U, 0xE76EDF27U, 0xA3B345B1U, 0x6ED5EA0BU, 0x2A08709DU,
+      0x2640C35BU, 0x629D59CDU, 0xAFFBF677U, 0xEB266CE1U, 0xDB6DEBFEU, 0x9FB07168U, 0x52D6DED2U, 0x160B4444U,
+      0x3241D0ECU, 0x769C4A7AU, 0xBBFAE5C0U, 0xFF277F56U, 0xCF6CF849U, 0x8BB162DFU, 0x46D7CD65U, 0x020A57F3U,
+      0x5E46AAE9U, 0x1A9B307FU, 0xD7FD9FC5U, 0x93200553U, 0xA36B824CU, 0xE7B618DAU, 0x2AD0B760U, 0x6E0D2DF6U,
+      0x4A47B95EU, 0x0E9A23C8U, 0xC3FC8C72U, 0x872116E4U, 0xB76A91FBU, 0xF3B70B6DU, 0x3ED1A4D7U, 0x7A0C3E41U,
+      0x76448D87U, 0x32991711U, 0xFFFFB8ABU, 0xBB22223DU, 0x8B69A522U, 0xCFB43FB4U, 0x02D2900EU, 0x460F0A98U,
+      0x62459E30U, 0x269804A6U, 0xEBFEAB1CU, 0xAF23318AU, 0x9F68B695U, 0xDBB52C03U, 0x16D383B9U, 0x520E192FU
+    },
+    {
+      0x00000000U, 0xB2CFB1E7U, 0x8BC42133U, 0x390B90D4U, 0xF9D3009BU, 0x4B1CB17CU, 0x721721A8U, 0xC0D8904FU,
+      0x1DFD43CBU, 0xAF32F22CU, 0x963962F8U, 0x24F6D31FU, 0xE42E4350U, 0x56E1F2B7U, 0x6FEA6263U, 0xDD25D384U,
+      0x3BFA8796U, 0x89353671U, 0xB03EA6A5U, 0x02F11742U, 0xC229870DU, 0x70E636EAU, 0x49EDA63EU, 0xFB2217D9U,
+      0x2607C45DU, 0x94C875BAU, 0xADC3E56EU, 0x1F0C5489U, 0xDFD4C4C6U, 0x6D1B7521U, 0x5410E5F5U, 0xE6DF5412U,
+      0x77F50F2CU, 0xC53ABECBU, 0xFC312E1FU, 0x4EFE9FF8U, 0x8E260FB7U, 0x3CE9BE50U, 0x05E22E84U, 0xB72D9F63U,
+      0x6A084CE7U, 0xD8C7FD00U, 0xE1CC6DD4U, 0x5303DC33U, 0x93DB4C7CU, 0x2114FD9BU, 0x181F6D4FU, 0xAAD0DCA8U,
+      0x4C0F88BAU, 0xFEC0395DU, 0xC7CBA989U, 0x7504186EU, 0xB5DC8821U, 0x071339C6U, 0x3E18A912U, 0x8CD718F5U,
+      0x51F2CB71U, 0xE33D7A96U, 0xDA36EA42U, 0x68F95BA5U, 0xA821CBEAU, 0x1AEE7A0DU, 0x23E5EAD9U, 0x912A5B3EU,
+      0xEFEA1E58U, 0x5D25AFBFU, 0x642E3F6BU, 0xD6E18E8CU, 0x16391EC3U, 0xA4F6AF24U, 0x9DFD3FF0U, 0x2F328E17U,
+      0xF2175D93U, 0x40D8EC74U, 0x79D37CA0U, 0xCB1CCD47U, 0x0BC45D08U, 0xB90BECEFU, 0x80007C3BU, 0x32CFCDDCU,
+      0xD41099CEU, 0x66DF2829U, 0x5FD4B8FDU, 0xED1B091AU, 0x2DC39955U, 0x9F0C28B2U, 0xA607B866U, 0x14C80981U,
+      0xC9EDDA05U, 0x7B226BE2U, 0x4229FB36U, 0xF0E64AD1U, 0x303EDA9EU, 0x82F16B79U, 0xBBFAFBADU, 0x09354A4AU,
+      0x981F1174U, 0x2AD0A093U, 0x13DB3047U, 0xA11481A0U, 0x61CC11EFU, 0xD303A008U, 0xEA0830DCU, 0x58C7813BU,
+      0x85E252BFU, 0x372DE358U, 0x0E26738CU, 0xBCE9C26BU, 0x7C315224U, 0xCEFEE3C3U, 0xF7F57317U, 0x453AC2F0U,
+      0xA3E596E2U, 0x112A2705U, 0x2821B7D1U, 0x9AEE0636U, 0x5A369679U, 0xE8F9279EU, 0xD1F2B74AU, 0x633D06ADU,
+      0xBE18D529U, 0x0CD764CEU, 0x35DCF41AU, 0x871345FDU, 0x47CBD5B2U, 0xF5046455U, 0xCC0FF481U, 0x7EC04566U,
+      0x318F7E4DU, 0x8340CFAAU, 0xBA4B5F7EU, 0x0884EE99U, 0xC85C7ED6U, 0x7A93CF31U, 0x43985FE5U, 0xF157EE02U,
+      0x2C723D86U, 0x9EBD8C61U, 0xA7B61CB5U, 0x1579AD52U, 0xD5A13D1DU, 0x676E8CFAU, 0x5E651C2EU, 0xECAAADC9U,
+      0x0A75F9DBU, 0xB8BA483CU, 0x81B1D8E8U, 0x337E690FU, 0xF3A6F940U, 0x416948A7U, 0x7862D873U, 0xCAAD6994U,
+      0x1788BA10U, 0xA5470BF7U, 0x9C4C9B23U, 0x2E832AC4U, 0xEE5BBA8BU, 0x5C940B6CU, 0x659F9BB8U, 0xD7502A5FU,
+      0x467A7161U, 0xF4B5C086U, 0xCDBE5052U, 0x7F71E1B5U, 0xBFA971FAU, 0x0D66C01DU, 0x346D50C9U, 0x86A2E12EU,
+      0x5B8732AAU, 0xE948834DU, 0xD0431399U, 0x628CA27EU, 0xA2543231U, 0x109B83D6U, 0x29901302U, 0x9B5FA2E5U,
+      0x7D80F6F7U, 0xCF4F4710U, 0xF644D7C4U, 0x448B6623U, 0x8453F66CU, 0x369C478BU, 0x0F97D75FU, 0xBD5866B8U,
+      0x607DB53CU, 0xD2B204DBU, 0xEBB9940FU, 0x597625E8U, 0x99AEB5A7U, 0x2B610440U, 0x126A9494U, 0xA0A52573U,
+      0xDE656015U, 0x6CAAD1F2U, 0x55A14126U, 0xE76EF0C1U, 0x27B6608EU, 0x9579D169U, 0xAC7241BDU, 0x1EBDF05AU,
+      0xC39823DEU, 0x71579239U, 0x485C02EDU, 0xFA93B30AU, 0x3A4B2345U, 0x888492A2U, 0xB18F0276U, 0x0340B391U,
+      0xE59FE783U, 0x57505664U, 0x6E5BC6B0U, 0xDC947757U, 0x1C4CE718U, 0xAE8356FFU, 0x9788C62BU, 0x254777CCU,
+      0xF862A448U, 0x4AAD15AFU, 0x73A6857BU, 0xC169349CU, 0x01B1A4D3U, 0xB37E1534U, 0x8A7585E0U, 0x38BA3407U,
+      0xA9906F39U, 0x1B5FDEDEU, 0x22544E0AU, 0x909BFFEDU, 0x50436FA2U, 0xE28CDE45U, 0xDB874E91U, 0x6948FF76U,
+      0xB46D2CF2U, 0x06A29D15U, 0x3FA90DC1U, 0x8D66BC26U, 0x4DBE2C69U, 0xFF719D8EU, 0xC67A0D5AU, 0x74B5BCBDU,
+      0x926AE8AFU, 0x20A55948U, 0x19AEC99CU, 0xAB61787BU, 0x6BB9E834U, 0xD97659D3U, 0xE07DC907U, 0x52B278E0U,
+      0x8F97AB64U, 0x3D581A83U, 0x04538A57U, 0xB69C3BB0U, 0x7644ABFFU, 0xC48B1A18U, 0xFD808ACCU, 0x4F4F3B2BU
+    },
+    {
+      0x00000000U, 0x631EFC9AU, 0xC63DF934U, 0xA52305AEU, 0x6220B095U, 0x013E4C0FU, 0xA41D49A1U, 0xC703B53BU,
+      0xC441612AU, 0xA75F9DB0U, 0x027C981EU, 0x61626484U, 0xA661D1BFU, 0xC57F2D25U, 0x605C288BU, 0x0342D411U,
+      0x66D980A9U, 0x05C77C33U, 0xA0E4799DU, 0xC3FA8507U, 0x04F9303CU, 0x67E7CCA6U, 0xC2C4C908U, 0xA1DA3592U,
+      0xA298E183U, 0xC1861D19U, 0x64A518B7U, 0x07BBE42DU, 0xC0B85116U, 0xA3A6AD8CU, 0x0685A822U, 0x659B54B8U,
+      0xCDB30152U, 0xAEADFDC8U, 0x0B8EF866U, 0x689004FCU, 0xAF93B1C7U, 0xCC8D4D5DU, 0x69AE48F3U, 0x0AB0B469U,
+      0x09F26078U, 0x6AEC9CE2U, 0xCFCF994CU, 0xACD165D6U, 0x6BD2D0EDU, 0x08CC2C77U, 0xADEF29D9U, 0xCEF1D543U,
+      0xAB6A81FBU, 0xC8747D61U, 0x6D5778CFU, 0x0E498455U, 0xC94A316EU, 0xAA54CDF4U, 0x0F77C85AU, 0x6C6934C0U,
+      0x6F2BE0D1U, 0x0C351C4BU, 0xA91619E5U, 0xCA08E57FU, 0x0D0B5044U, 0x6E15ACDEU, 0xCB36A970U, 0xA82855EAU,
+      0x753D4059U, 0x1623BCC3U, 0xB300B96DU, 0xD01E45F7U, 0x171DF0CCU, 0x74030C56U, 0xD12009F8U, 0xB23EF562U,
+      0xB17C2173U, 0xD262DDE9U, 0x7741D847U, 0x145F24DDU, 0xD35C91E6U, 0xB0426D7CU, 0x156168D2U, 0x767F9448U,
+      0x13E4C0F0U, 0x70FA3C6AU, 0xD5D939C4U, 0xB6C7C55EU, 0x71C47065U, 0x12DA8CFFU, 0xB7F98951U, 0xD4E775CBU,
+      0xD7A5A1DAU, 0xB4BB5D40U, 0x119858EEU, 0x7286A474U, 0xB585114FU, 0xD69BEDD5U, 0x73B8E87BU, 0x10A614E1U,
+      0xB88E410BU, 0xDB90BD91U, 0x7EB3B83FU, 0x1DAD44A5U, 0xDAAEF19EU, 0xB9B00D04U, 0x1C9308AAU, 0x7F8DF430U,
+      0x7CCF2021U, 0x1FD1DCBBU, 0xBAF2D915U, 0xD9EC258FU, 0x1EEF90B4U, 0x7DF16C2EU, 0xD8D26980U, 0xBBCC951AU,
+      0xDE57C1A2U, 0xBD493D38U, 0x186A3896U, 0x7B74C40CU, 0xBC777137U, 0xDF698DADU, 0x7A4A8803U, 0x19547499U,
+      0x1A16A088U, 0x79085C12U, 0xDC2B59BCU, 0xBF35A526U, 0x7836101DU, 0x1B28EC87U, 0xBE0BE929U, 0xDD1515B3U,
+      0xEA7A80B2U, 0x89647C28U, 0x2C477986U, 0x4F59851CU, 0x885A3027U, 0xEB44CCBDU, 0x4E67C913U, 0x2D793589U,
+      0x2E3BE198U, 0x4D251D02U, 0xE80618ACU, 0x8B18E436U, 0x4C1B510DU, 0x2F05AD97U, 0x8A26A839U, 0xE93854A3U,
+      0x8CA3001BU, 0xEFBDFC81U, 0x4A9EF92FU, 0x298005B5U, 0xEE83B08EU, 0x8D9D4C14U, 0x28BE49BAU, 0x4BA0B520U,
+      0x48E26131U, 0x2BFC9DABU, 0x8EDF9805U, 0xEDC1649FU, 0x2AC2D1A4U, 0x49DC2D3EU, 0xECFF2890U, 0x8FE1D40AU,
+      0x27C981E0U, 0x44D77D7AU, 0xE1F478D4U, 0x82EA844EU, 0x45E93175U, 0x26F7CDEFU, 0x83D4C841U, 0xE0CA34DBU,
+      0xE388E0CAU, 0x80961C50U, 0x25B519FEU, 0x46ABE564U, 0x81A8505FU, 0xE2B6ACC5U, 0x4795A96BU, 0x248B55F1U,
+      0x41100149U, 0x220EFDD3U, 0x872DF87DU, 0xE43304E7U, 0x2330B1DCU, 0x402E4D46U, 0xE50D48E8U, 0x8613B472U,
+      0x85516063U, 0xE64F9CF9U, 0x436C9957U, 0x207265CDU, 0xE771D0F6U, 0x846F2C6CU, 0x214C29C2U, 0x4252D558U,
+      0x9F47C0EBU, 0xFC593C71U, 0x597A39DFU, 0x3A64C545U, 0xFD67707EU, 0x9E798CE4U, 0x3B5A894AU, 0x584475D0U,
+      0x5B06A1C1U, 0x38185D5BU, 0x9D3B58F5U, 0xFE25A46FU, 0x39261154U, 0x5A38EDCEU, 0xFF1BE860U, 0x9C0514FAU,
+      0xF99E4042U, 0x9A80BCD8U, 0x3FA3B976U, 0x5CBD45ECU, 0x9BBEF0D7U, 0xF8A00C4DU, 0x5D8309E3U, 0x3E9DF579U,
+      0x3DDF2168U, 0x5EC1DDF2U, 0xFBE2D85CU, 0x98FC24C6U, 0x5FFF91FDU, 0x3CE16D67U, 0x99C268C9U, 0xFADC9453U,
+      0x52F4C1B9U, 0x31EA3D23U, 0x94C9388DU, 0xF7D7C417U, 0x30D4712CU, 0x53CA8DB6U, 0xF6E98818U, 0x95F77482U,
+      0x96B5A093U, 0xF5AB5C09U, 0x508859A7U, 0x3396A53DU, 0xF4951006U, 0x978BEC9CU, 0x32A8E932U, 0x51B615A8U,
+      0x342D4110U, 0x5733BD8AU, 0xF210B824U, 0x910E44BEU, 0x560DF185U, 0x35130D1FU, 0x903008B1U, 0xF32EF42BU,
+      0xF06C203AU, 0x9372DCA0U, 0x3651D90EU, 0x554F2594U, 0x924C90AFU, 0xF1526C35U, 0x5471699BU, 0x376F9501U
+    }
+  },
+  {  // Check code type C: CRC32 with polynomial 0x1EDC6F41
+    {
+      0x00000000U, 0xF26B8303U, 0xE13B70F7U, 0x1350F3F4U, 0xC79A971FU, 0x35F1141CU, 0x26A1E7E8U, 0xD4CA64EBU,
+      0x8AD958CFU, 0x78B2DBCCU, 0x6BE22838U, 0x9989AB3BU, 0x4D43CFD0U, 0xBF284CD3U, 0xAC78BF27U, 0x5E133C24U,
+      0x105EC76FU, 0xE235446CU, 0xF165B798U, 0x030E349BU, 0xD7C45070U, 0x25AFD373U, 0x36FF2087U, 0xC494A384U,
+      0x9A879FA0U, 0x68EC1CA3U, 0x7BBCEF57U, 0x89D76C54U, 0x5D1D08BFU, 0xAF768BBCU, 0xBC267848U, 0x4E4DFB4BU,
+      0x20BD8EDEU, 0xD2D60DDDU, 0xC186FE29U, 0x33ED7D2AU, 0xE72719C1U, 0x154C9AC2U, 0x061C6936U, 0xF477EA35U,
+      0xAA64D611U, 0x580F5512U, 0x4B5FA6E6U, 0xB93425E5U, 0x6DFE410EU, 0x9F95C20DU, 0x8CC531F9U, 0x7EAEB2FAU,
+      0x30E349B1U, 0xC288CAB2U, 0xD1D83946U, 0x23B3BA45U, 0xF779DEAEU, 0x05125DADU, 0x1642AE59U, 0xE4292D5AU,
+      0xBA3A117EU, 0x4851927DU, 0x5B016189U, 0xA96AE28AU, 0x7DA08661U, 0x8FCB0562U, 0x9C9BF696U, 0x6EF07595U,
+      0x417B1DBCU, 0xB3109EBFU, 0xA0406D4BU, 0x522BEE48U, 0x86E18AA3U, 0x748A09A0U, 0x67DAFA54U, 0x95B17957U,
+      0xCBA24573U, 0x39C9C670U, 0x2A993584U, 0xD8F2B687U, 0x0C38D26CU, 0xFE53516FU, 0xED03A29BU, 0x1F682198U,
+      0x5125DAD3U, 0xA34E59D0U, 0xB01EAA24U, 0x42752927U, 0x96BF4DCCU, 0x64D4CECFU, 0x77843D3BU, 0x85EFBE38U,
+      0xDBFC821CU, 0x2997011FU, 0x3AC7F2EBU, 0xC8AC71E8U, 0x1C661503U, 0xEE0D9600U, 0xFD5D65F4U, 0x0F36E6F7U,
+      0x61C69362U, 0x93AD1061U, 0x80FDE395U, 0x72966096U, 0xA65C047DU, 0x5437877EU, 0x4767748AU, 0xB50CF789U,
+      0xEB1FCBADU, 0x197448AEU, 0x0A24BB5AU, 0xF84F3859U, 0x2C855CB2U, 0xDEEEDFB1U, 0xCDBE2C45U, 0x3FD5AF46U,
+      0x7198540DU, 0x83F3D70EU, 0x90A324FAU, 0x62C8A7F9U, 0xB602C312U, 0x44694011U, 0x5739B3E5U, 0xA55230E6U,
+      0xFB410CC2U, 0x092A8FC1U, 0x1A7A7C35U, 0xE811FF36U, 0x3CDB9BDDU, 0xCEB018DEU, 0xDDE0EB2AU, 0x2F8B6829U,
+      0x82F63B78U, 0x709DB87BU, 0x63CD4B8FU, 0x91A6C88CU, 0x456CAC67U, 0xB7072F64U, 0xA457DC90U, 0x563C5F93U,
+      0x082F63B7U, 0xFA44E0B4U, 0xE9141340U, 0x1B7F9043U, 0xCFB5F4A8U, 0x3DDE77ABU, 0x2E8E845FU, 0xDCE5075CU,
+      0x92A8FC17U, 0x60C37F14U, 0x73938CE0U, 0x81F80FE3U, 0x55326B08U, 0xA759E80BU, 0xB4091BFFU, 0x466298FCU,
+      0x1871A4D8U, 0xEA1A27DBU, 0xF94AD42FU, 0x0B21572CU, 0xDFEB33C7U, 0x2D80B0C4U, 0x3ED04330U, 0xCCBBC033U,
+      0xA24BB5A6U, 0x502036A5U, 0x4370C551U, 0xB11B4652U, 0x65D122B9U, 0x97BAA1BAU, 0x84EA524EU, 0x7681D14DU,
+      0x2892ED69U, 0xDAF96E6AU, 0xC9A99D9EU, 0x3BC21E9DU, 0xEF087A76U, 0x1D63F975U, 0x0E330A81U, 0xFC588982U,
+      0xB21572C9U, 0x407EF1CAU, 0x532E023EU, 0xA145813DU, 0x758FE5D6U, 0x87E466D5U, 0x94B49521U, 0x66DF1622U,
+      0x38CC2A06U, 0xCAA7A905U, 0xD9F75AF1U, 0x2B9CD9F2U, 0xFF56BD19U, 0x0D3D3E1AU, 0x1E6DCDEEU, 0xEC064EEDU,
+      0xC38D26C4U, 0x31E6A5C7U, 0x22B65633U, 0xD0DDD530U, 0x0417B1DBU, 0xF67C32D8U, 0xE52CC12CU, 0x1747422FU,
+      0x49547E0BU, 0xBB3FFD08U, 0xA86F0EFCU, 0x5A048DFFU, 0x8ECEE914U, 0x7CA56A17U, 0x6FF599E3U, 0x9D9E1AE0U,
+      0xD3D3E1ABU, 0x21B862A8U, 0x32E8915CU, 0xC083125FU, 0x144976B4U, 0xE622F5B7U, 0xF5720643U, 0x07198540U,
+      0x590AB964U, 0xAB613A67U, 0xB831C993U, 0x4A5A4A90U, 0x9E902E7BU, 0x6CFBAD78U, 0x7FAB5E8CU, 0x8DC0DD8FU,
+      0xE330A81AU, 0x115B2B19U, 0x020BD8EDU, 0xF0605BEEU, 0x24AA3F05U, 0xD6C1BC06U, 0xC5914FF2U, 0x37FACCF1U,
+      0x69E9F0D5U, 0x9B8273D6U, 0x88D28022U, 0x7AB90321U, 0xAE7367CAU, 0x5C18E4C9U, 0x4F48173DU, 0xBD23943EU,
+      0xF36E6F75U, 0x0105EC76U, 0x12551F82U, 0xE03E9C81U, 0x34F4F86AU, 0xC69F7B69U, 0xD5CF889DU, 0x27A40B9EU,
+      0x79B737BAU, 0x8BDCB4B9U, 0x988C474DU, 0x6AE7C44EU, 0xBE2DA0A5U, 0x4C4623A6U, 0x5F16D052U, 0xAD7D5351U
+    },
+    {
+      0x00000000U, 0x13A29877U, 0x274530EEU, 0x34E7A899U, 0x4E8A61DCU, 0x5D28F9ABU, 0x69CF5132U, 0x7A6DC945U,
+      0x9D14C3B8U, 0x8EB65BCFU, 0xBA51F356U, 0xA9F36B21U, 0xD39EA264U, 0xC03C3A13U, 0xF4DB928AU, 0xE7790AFDU,
+      0x3FC5F181U, 0x2C6769F6U, 0x1880C16FU, 0x0B225918U, 0x714F905DU, 0x62ED082AU, 0x560AA0B3U, 0x45A838C4U,
+      0xA2D13239U, 0xB173AA4EU, 0x859402D7U, 0x96369AA0U, 0xEC5B53E5U, 0xFFF9CB92U, 0xCB1E630BU, 0xD8BCFB7CU,
+      0x7F8BE302U, 0x6C297B75U, 0x58CED3ECU, 0x4B6C4B9BU, 0x310182DEU, 0x22A31AA9U, 0x1644B230U, 0x05E62A47U,
+      0xE29F20BAU, 0xF13DB8CDU, 0xC5DA1054U, 0xD6788823U, 0xAC154166U, 0xBFB7D911U, 0x8B507188U, 0x98F2E9FFU,
+      0x404E1283U, 0x53EC8AF4U, 0x670B226DU, 0x74A9BA1AU, 0x0EC4735FU, 0x1D66EB28U, 0x298143B1U, 0x3A23DBC6U,
+      0xDD5AD13BU, 0xCEF8494CU, 0xFA1FE1D5U, 0xE9BD79A2U, 0x93D0B0E7U, 0x80722890U, 0xB4958009U, 0xA737187EU,
+      0xFF17C604U, 0xECB55E73U, 0xD852F6EAU, 0xCBF06E9DU, 0xB19DA7D8U, 0xA23F3FAFU, 0x96D89736U, 0x857A0F41U,
+      0x620305BCU, 0x71A19DCBU, 0x45463552U, 0x56E4AD25U, 0x2C896460U, 0x3F2BFC17U, 0x0BCC548EU, 0x186ECCF9U,
+      0xC0D23785U, 0xD370AFF2U, 0xE797076BU, 0xF4359F1CU, 0x8E585659U, 0x9DFACE2EU, 0xA91D66B7U, 0xBABFFEC0U,
+      0x5DC6F43DU, 0x4E646C4AU, 0x7A83C4D3U, 0x69215CA4U, 0x134C95E1U, 0x00EE0D96U, 0x3409A50FU, 0x27AB3D78U,
+      0x809C2506U, 0x933EBD71U, 0xA7D915E8U, 0xB47B8D9FU, 0xCE1644DAU, 0xDDB4DCADU, 0xE9537434U, 0xFAF1EC43U,
+      0x1D88E6BEU, 0x0E2A7EC9U, 0x3ACDD650U, 0x296F4E27U, 0x53028762U, 0x40A01F15U, 0x7447B78CU, 0x67E52FFBU,
+      0xBF59D487U, 0xACFB4CF0U, 0x981CE469U, 0x8BBE7C1EU, 0xF1D3B55BU, 0xE2712D2CU, 0xD69685B5U, 0xC5341DC2U,
+      0x224D173FU, 0x31EF8F48U, 0x050827D1U, 0x16AABFA6U, 0x6CC776E3U, 0x7F65EE94U, 0x4B82460DU, 0x5820DE7AU,
+      0xFBC3FAF9U, 0xE861628EU, 0xDC86CA17U, 0xCF245260U, 0xB5499B25U, 0xA6EB0352U, 0x920CABCBU, 0x81AE33BCU,
+      0x66D73941U, 0x7575A136U, 0x419209AFU, 0x523091D8U, 0x285D589DU, 0x3BFFC0EAU, 0x0F186873U, 0x1CBAF004U,
+      0xC4060B78U, 0xD7A4930FU, 0xE3433B96U, 0xF0E1A3E1U, 0x8A8C6AA4U, 0x992EF2D3U, 0xADC95A4AU, 0xBE6BC23DU,
+      0x5912C8C0U, 0x4AB050B7U, 0x7E57F82EU, 0x6DF56059U, 0x1798A91CU, 0x043A316BU, 0x30DD99F2U, 0x237F0185U,
+      0x844819FBU, 0x97EA818CU, 0xA30D2915U, 0xB0AFB162U, 0xCAC27827U, 0xD960E050U, 0xED8748C9U, 0xFE25D0BEU,
+      0x195CDA43U, 0x0AFE4234U, 0x3E19EAADU, 0x2DBB72DAU, 0x57D6BB9FU, 0x447423E8U, 0x70938B71U, 0x63311306U,
+      0xBB8DE87AU, 0xA82F700DU, 0x9CC8D894U, 0x8F6A40E3U, 0xF50789A6U, 0xE6A511D1U, 0xD242B948U, 0xC1E0213FU,
+      0x26992BC2U, 0x353BB3B5U, 0x01DC1B2CU, 0x127E835BU, 0x68134A1EU, 0x7BB1D269U, 0x4F567AF0U, 0x5CF4E287U,
+      0x04D43CFDU, 0x1776A48AU, 0x23910C13U, 0x30339464U, 0x4A5E5D21U, 0x59FCC556U, 0x6D1B6DCFU, 0x7EB9F5B8U,
+      0x99C0FF45U, 0x8A626732U, 0xBE85CFABU, 0xAD2757DCU, 0xD74A9E99U, 0xC4E806EEU, 0xF00FAE77U, 0xE3AD3600U,
+      0x3B11CD7CU, 0x28B3550BU, 0x1C54FD92U, 0x0FF665E5U, 0x759BACA0U, 0x663934D7U, 0x52DE9C4EU, 0x417C0439U,
+      0xA6050EC4U, 0xB5A796B3U, 0x81403E2AU, 0x92E2A65DU, 0xE88F6F18U, 0xFB2DF76FU, 0xCFCA5FF6U, 0xDC68C781U,
+      0x7B5FDFFFU, 0x68FD4788U, 0x5C1AEF11U, 0x4FB87766U, 0x35D5BE23U, 0x26772654U, 0x12908ECDU, 0x013216BAU,
+      0xE64B1C47U, 0xF5E98430U, 0xC10E2CA9U, 0xD2ACB4DEU, 0xA8C17D9BU, 0xBB63E5ECU, 0x8F844D75U, 0x9C26D502U,
+      0x449A2E7EU, 0x5738B609U, 0x63DF1E90U, 0x707D86E7U, 0x0A104FA2U, 0x19B2D7D5U, 0x2D557F4CU, 0x3EF7E73BU,
+      0xD98EEDC6U, 0xCA2C75B1U, 0xFECBDD28U, 0xED69455FU, 0x97048C1AU, 0x84A6146DU, 0xB041BCF4U, 0xA3E32483U
+    },
+    {
+      0x00000000U, 0xA541927EU, 0x4F6F520DU, 0xEA2EC073U, 0x9EDEA41AU, 0x3B9F3664U, 0xD1B1F617U, 0x74F06469U,
+      0x38513EC5U, 0x9D10ACBBU, 0x773E6CC8U, 0xD27FFEB6U, 0xA68F9ADFU, 0x03CE08A1U, 0xE9E0C8D2U, 0x4CA15AACU,
+      0x70A27D8AU, 0xD5E3EFF4U, 0x3FCD2F87U, 0x9A8CBDF9U, 0xEE7CD990U, 0x4B3D4BEEU, 0xA1138B9DU, 0x045219E3U,
+      0x48F3434FU, 0xEDB2D131U, 0x079C1142U, 0xA2DD833CU, 0xD62DE755U, 0x736C752BU, 0x9942B558U, 0x3C032726U,
+      0xE144FB14U, 0x4405696AU, 0xAE2BA919U, 0x0B6A3B67U, 0x7F9A5F0EU, 0xDADBCD70U, 0x30F50D03U, 0x95B49F7DU,
+      0xD915C5D1U, 0x7C5457AFU, 0x967A97DCU, 0x333B05A2U, 0x47CB61CBU, 0xE28AF3B5U, 0x08A433C6U, 0xADE5A1B8U,
+      0x91E6869EU, 0x34A714E0U, 0xDE89D493U, 0x7BC846EDU, 0x0F382284U, 0xAA79B0FAU, 0x40577089U, 0xE516E2F7U,
+      0xA9B7B85BU, 0x0CF62A25U, 0xE6D8EA56U, 0x43997828U, 0x37691C41U, 0x92288E3FU, 0x78064E4CU, 0xDD47DC32U,
+      0xC76580D9U, 0x622412A7U, 0x880AD2D4U, 0x2D4B40AAU, 0x59BB24C3U, 0xFCFAB6BDU, 0x16D476CEU, 0xB395E4B0U,
+      0xFF34BE1CU, 0x5A752C62U, 0xB05BEC11U, 0x151A7E6FU, 0x61EA1A06U, 0xC4AB8878U, 0x2E85480BU, 0x8BC4DA75U,
+      0xB7C7FD53U, 0x12866F2DU, 0xF8A8AF5EU, 0x5DE93D20U, 0x29195949U, 0x8C58CB37U, 0x66760B44U, 0xC337993AU,
+      0x8F96C396U, 0x2AD751E8U, 0xC0F9919BU, 0x65B803E5U, 0x1148678CU, 0xB409F5F2U, 0x5E273581U, 0xFB66A7FFU,
+      0x26217BCDU, 0x8360E9B3U, 0x694E29C0U, 0xCC0FBBBEU, 0xB8FFDFD7U, 0x1DBE4DA9U, 0xF7908DDAU, 0x52D11FA4U,
+      0x1E704508U, 0xBB31D776U, 0x511F1705U, 0xF45E857BU, 0x80AEE112U, 0x25EF736CU, 0xCFC1B31FU, 0x6A802161U,
+      0x56830647U, 0xF3C29439U, 0x19EC544AU, 0xBCADC634U, 0xC85DA25DU, 0x6D1C3023U, 0x8732F050U, 0x2273622EU,
+      0x6ED23882U, 0xCB93AAFCU, 0x21BD6A8FU, 0x84FCF8F1U, 0xF00C9C98U, 0x554D0EE6U, 0xBF63CE95U, 0x1A225CEBU,
+      0x8B277743U, 0x2E66E53DU, 0xC448254EU, 0x6109B730U, 0x15F9D359U, 0xB0B84127U, 0x5A968154U, 0xFFD7132AU,
+      0xB3764986U, 0x1637DBF8U, 0xFC191B8BU, 0x595889F5U, 0x2DA8ED9CU, 0x88E97FE2U, 0x62C7BF91U, 0xC7862DEFU,
+      0xFB850AC9U, 0x5EC498B7U, 0xB4EA58C4U, 0x11ABCABAU, 0x655BAED3U, 0xC01A3CADU, 0x2A34FCDEU, 0x8F756EA0U,
+      0xC3D4340CU, 0x6695A672U, 0x8CBB6601U, 0x29FAF47FU, 0x5D0A9016U, 0xF84B0268U, 0x1265C21BU, 0xB7245065U,
+      0x6A638C57U, 0xCF221E29U, 0x250CDE5AU, 0x804D4C24U, 0xF4BD284DU, 0x51FCBA33U, 0xBBD27A40U, 0x1E93E83EU,
+      0x5232B292U, 0xF77320ECU, 0x1D5DE09FU, 0xB81C72E1U, 0xCCEC1688U, 0x69AD84F6U, 0x83834485U, 0x26C2D6FBU,
+      0x1AC1F1DDU, 0xBF8063A3U, 0x55AEA3D0U, 0xF0EF31AEU, 0x841F55C7U, 0x215EC7B9U, 0xCB7007CAU, 0x6E3195B4U,
+      0x2290CF18U, 0x87D15D66U, 0x6DFF9D15U, 0xC8BE0F6BU, 0xBC4E6B02U, 0x190FF97CU, 0xF321390FU, 0x5660AB71U,
+      0x4C42F79AU, 0xE90365E4U, 0x032DA597U, 0xA66C37E9U, 0xD29C5380U, 0x77DDC1FEU, 0x9DF3018DU, 0x38B293F3U,
+      0x7413C95FU, 0xD1525B21U, 0x3B7C9B52U, 0x9E3D092CU, 0xEACD6D45U, 0x4F8CFF3BU, 0xA5A23F48U, 0x00E3AD36U,
+      0x3CE08A10U, 0x99A1186EU, 0x738FD81DU, 0xD6CE4A63U, 0xA23E2E0AU, 0x077FBC74U, 0xED517C07U, 0x4810EE79U,
+      0x04B1B4D5U, 0xA1F026ABU, 0x4BDEE6D8U, 0xEE9F74A6U, 0x9A6F10CFU, 0x3F2E82B1U, 0xD50042C2U, 0x7041D0BCU,
+      0xAD060C8EU, 0x08479EF0U, 0xE2695E83U, 0x4728CCFDU, 0x33D8A894U, 0x96993AEAU, 0x7CB7FA99U, 0xD9F668E7U,
+      0x9557324BU, 0x3016A035U, 0xDA386046U, 0x7F79F238U, 0x0B899651U, 0xAEC8042FU, 0x44E6C45CU, 0xE1A75622U,
+      0xDDA47104U, 0x78E5E37AU, 0x92CB2309U, 0x378AB177U, 0x437AD51EU, 0xE63B4760U, 0x0C158713U, 0xA954156DU,
+      0xE5F54FC1U, 0x40B4DDBFU, 0xAA9A1DCCU, 0x0FDB8FB2U, 0x7B2BEBDBU, 0xDE6A79A5U, 0x3444B9D6U, 0x91052BA8U
+    },
+    {
+      0x00000000U, 0xDD45AAB8U, 0xBF672381U, 0x62228939U, 0x7B2231F3U, 0xA6679B4BU, 0xC4451272U, 0x1900B8CAU,
+      0xF64463E6U, 0x2B01C95EU, 0x49234067U, 0x9466EADFU, 0x8D665215U, 0x5023F8ADU, 0x32017194U, 0xEF44DB2CU,
+      0xE964B13DU, 0x34211B85U, 0x560392BCU, 0x8B463804U, 0x924680CEU, 0x4F032A76U, 0x2D21A34FU, 0xF06409F7U,
+      0x1F20D2DBU, 0xC2657863U, 0xA047F15AU, 0x7D025BE2U, 0x6402E328U, 0xB9474990U, 0xDB65C0A9U, 0x06206A11U,
+      0xD725148BU, 0x0A60BE33U, 0x6842370AU, 0xB5079DB2U, 0xAC072578U, 0x71428FC0U, 0x136006F9U, 0xCE25AC41U,
+      0x2161776DU, 0xFC24DDD5U, 0x9E0654ECU, 0x4343FE54U, 0x5A43469EU, 0x8706EC26U, 0xE524651FU, 0x3861CFA7U,
+      0x3E41A5B6U, 0xE3040F0EU, 0x81268637U, 0x5C632C8FU, 0x45639445U, 0x98263EFDU, 0xFA04B7C4U, 0x27411D7CU,
+      0xC805C650U, 0x15406CE8U, 0x7762E5D1U, 0xAA274F69U, 0xB327F7A3U, 0x6E625D1BU, 0x0C40D422U, 0xD1057E9AU,
+      0xABA65FE7U, 0x76E3F55FU, 0x14C17C66U, 0xC984D6DEU, 0xD0846E14U, 0x0DC1C4ACU, 0x6FE34D95U, 0xB2A6E72DU,
+      0x5DE23C01U, 0x80A796B9U, 0xE2851F80U, 0x3FC0B538U, 0x26C00DF2U, 0xFB85A74AU, 0x99A72E73U, 0x44E284CBU,
+      0x42C2EEDAU, 0x9F874462U, 0xFDA5CD5BU, 0x20E067E3U, 0x39E0DF29U, 0xE4A57591U, 0x8687FCA8U, 0x5BC25610U,
+      0xB4868D3CU, 0x69C32784U, 0x0BE1AEBDU, 0xD6A40405U, 0xCFA4BCCFU, 0x12E11677U, 0x70C39F4EU, 0xAD8635F6U,
+      0x7C834B6CU, 0xA1C6E1D4U, 0xC3E468EDU, 0x1EA1C255U, 0x07A17A9FU, 0xDAE4D027U, 0xB8C6591EU, 0x6583F3A6U,
+      0x8AC7288AU, 0x57828232U, 0x35A00B0BU, 0xE8E5A1B3U, 0xF1E51979U, 0x2CA0B3C1U, 0x4E823AF8U, 0x93C79040U,
+      0x95E7FA51U, 0x48A250E9U, 0x2A80D9D0U, 0xF7C57368U, 0xEEC5CBA2U, 0x3380611AU, 0x51A2E823U, 0x8CE7429BU,
+      0x63A399B7U, 0xBEE6330FU, 0xDCC4BA36U, 0x0181108EU, 0x1881A844U, 0xC5C402FCU, 0xA7E68BC5U, 0x7AA3217DU,
+      0x52A0C93FU, 0x8FE56387U, 0xEDC7EABEU, 0x30824006U, 0x2982F8CCU, 0xF4C75274U, 0x96E5DB4DU, 0x4BA071F5U,
+      0xA4E4AAD9U, 0x79A10061U, 0x1B838958U, 0xC6C623E0U, 0xDFC69B2AU, 0x02833192U, 0x60A1B8ABU, 0xBDE41213U,
+      0xBBC47802U, 0x6681D2BAU, 0x04A35B83U, 0xD9E6F13BU, 0xC0E649F1U, 0x1DA3E349U, 0x7F816A70U, 0xA2C4C0C8U,
+      0x4D801BE4U, 0x90C5B15CU, 0xF2E73865U, 0x2FA292DDU, 0x36A22A17U, 0xEBE780AFU, 0x89C50996U, 0x5480A32EU,
+      0x8585DDB4U, 0x58C0770CU, 0x3AE2FE35U, 0xE7A7548DU, 0xFEA7EC47U, 0x23E246FFU, 0x41C0CFC6U, 0x9C85657EU,
+      0x73C1BE52U, 0xAE8414EAU, 0xCCA69DD3U, 0x11E3376BU, 0x08E38FA1U, 0xD5A62519U, 0xB784AC20U, 0x6AC10698U,
+      0x6CE16C89U, 0xB1A4C631U, 0xD3864F08U, 0x0EC3E5B0U, 0x17C35D7AU, 0xCA86F7C2U, 0xA8A47EFBU, 0x75E1D443U,
+      0x9AA50F6FU, 0x47E0A5D7U, 0x25C22CEEU, 0xF8878656U, 0xE1873E9CU, 0x3CC29424U, 0x5EE01D1DU, 0x83A5B7A5U,
+      0xF90696D8U, 0x24433C60U, 0x4661B559U, 0x9B241FE1U, 0x8224A72BU, 0x5F610D93U, 0x3D4384AAU, 0xE0062E12U,
+      0x0F42F53EU, 0xD2075F86U, 0xB025D6BFU, 0x6D607C07U, 0x7460C4CDU, 0xA9256E75U, 0xCB07E74CU, 0x16424DF4U,
+      0x106227E5U, 0xCD278D5DU, 0xAF050464U, 0x7240AEDCU, 0x6B401616U, 0xB605BCAEU, 0xD4273597U, 0x09629F2FU,
+      0xE6264403U, 0x3B63EEBBU, 0x59416782U, 0x8404CD3AU, 0x9D0475F0U, 0x4041DF48U, 0x22635671U, 0xFF26FCC9U,
+      0x2E238253U, 0xF36628EBU, 0x9144A1D2U, 0x4C010B6AU, 0x5501B3A0U, 0x88441918U, 0xEA669021U, 0x37233A99U,
+      0xD867E1B5U, 0x05224B0DU, 0x6700C234U, 0xBA45688CU, 0xA345D046U, 0x7E007AFEU, 0x1C22F3C7U, 0xC167597FU,
+      0xC747336EU, 0x1A0299D6U, 0x782010EFU, 0xA565BA57U, 0xBC65029DU, 0x6120A825U, 0x0302211CU, 0xDE478BA4U,
+      0x31035088U, 0xEC46FA30U, 0x8E647309U, 0x5321D9B1U, 0x4A21617BU, 0x9764CBC3U, 0xF54642FAU, 0x2803E842U
+    },
+    {
+      0x00000000U, 0x38116FACU, 0x7022DF58U, 0x4833B0F4U, 0xE045BEB0U, 0xD854D11CU, 0x906761E8U, 0xA8760E44U,
+      0xC5670B91U, 0xFD76643DU, 0xB545D4C9U, 0x8D54BB65U, 0x2522B521U, 0x1D33DA8DU, 0x55006A79U, 0x6D1105D5U,
+      0x8F2261D3U, 0xB7330E7FU, 0xFF00BE8BU, 0xC711D127U, 0x6F67DF63U, 0x5776B0CFU, 0x1F45003BU, 0x27546F97U,
+      0x4A456A42U, 0x725405EEU, 0x3A67B51AU, 0x0276DAB6U, 0xAA00D4F2U, 0x9211BB5EU, 0xDA220BAAU, 0xE2336406U,
+      0x1BA8B557U, 0x23B9DAFBU, 0x6B8A6A0FU, 0x539B05A3U, 0xFBED0BE7U, 0xC3FC644BU, 0x8BCFD4BFU, 0xB3DEBB13U,
+      0xDECFBEC6U, 0xE6DED16AU, 0xAEED619EU, 0x96FC0E32U, 0x3E8A0076U, 0x069B6FDAU, 0x4EA8DF2EU, 0x76B9B082U,
+      0x948AD484U, 0xAC9BBB28U, 0xE4A80BDCU, 0xDCB96470U, 0x74CF6A34U, 0x4CDE0598U, 0x04EDB56CU, 0x3CFCDAC0U,
+      0x51EDDF15U, 0x69FCB0B9U, 0x21CF004DU, 0x19DE6FE1U, 0xB1A861A5U, 0x89B90E09U, 0xC18ABEFDU, 0xF99BD151U,
+      0x37516AAEU, 0x0F400502U, 0x4773B5F6U, 0x7F62DA5AU, 0xD714D41EU, 0xEF05BBB2U, 0xA7360B46U, 0x9F2764EAU,
+      0xF236613FU, 0xCA270E93U, 0x8214BE67U, 0xBA05D1CBU, 0x1273DF8FU, 0x2A62B023U, 0x625100D7U, 0x5A406F7BU,
+      0xB8730B7DU, 0x806264D1U, 0xC851D425U, 0xF040BB89U, 0x5836B5CDU, 0x6027DA61U, 0x28146A95U, 0x10050539U,
+      0x7D1400ECU, 0x45056F40U, 0x0D36DFB4U, 0x3527B018U, 0x9D51BE5CU, 0xA540D1F0U, 0xED736104U, 0xD5620EA8U,
+      0x2CF9DFF9U, 0x14E8B055U, 0x5CDB00A1U, 0x64CA6F0DU, 0xCCBC6149U, 0xF4AD0EE5U, 0xBC9EBE11U, 0x848FD1BDU,
+      0xE99ED468U, 0xD18FBBC4U, 0x99BC0B30U, 0xA1AD649CU, 0x09DB6AD8U, 0x31CA0574U, 0x79F9B580U, 0x41E8DA2CU,
+      0xA3DBBE2AU, 0x9BCAD186U, 0xD3F96172U, 0xEBE80EDEU, 0x439E009AU, 0x7B8F6F36U, 0x33BCDFC2U, 0x0BADB06EU,
+      0x66BCB5BBU, 0x5EADDA17U, 0x169E6AE3U, 0x2E8F054FU, 0x86F90B0BU, 0xBEE864A7U, 0xF6DBD453U, 0xCECABBFFU,
+      0x6EA2D55CU, 0x56B3BAF0U, 0x1E800A04U, 0x269165A8U, 0x8EE76BECU, 0xB6F60440U, 0xFEC5B4B4U, 0xC6D4DB18U,
+      0xABC5DECDU, 0x93D4B161U, 0xDBE70195U, 0xE3F66E39U, 0x4B80607DU, 0x73910FD1U, 0x3BA2BF25U, 0x03B3D089U,
+      0xE180B48FU, 0xD991DB23U, 0x91A26BD7U, 0xA9B3047BU, 0x01C50A3FU, 0x39D46593U, 0x71E7D567U, 0x49F6BACBU,
+      0x24E7BF1EU, 0x1CF6D0B2U, 0x54C56046U, 0x6CD40FEAU, 0xC4A201AEU, 0xFCB36E02U, 0xB480DEF6U, 0x8C91B15AU,
+      0x750A600BU, 0x4D1B0FA7U, 0x0528BF53U, 0x3D39D0FFU, 0x954FDEBBU, 0xAD5EB117U, 0xE56D01E3U, 0xDD7C6E4FU,
+      0xB06D6B9AU, 0x887C0436U, 0xC04FB4C2U, 0xF85EDB6EU, 0x5028D52AU, 0x6839BA86U, 0x200A0A72U, 0x181B65DEU,
+      0xFA2801D8U, 0xC2396E74U, 0x8A0ADE80U, 0xB21BB12CU, 0x1A6DBF68U, 0x227CD0C4U, 0x6A4F6030U, 0x525E0F9CU,
+      0x3F4F0A49U, 0x075E65E5U, 0x4F6DD511U, 0x777CBABDU, 0xDF0AB4F9U, 0xE71BDB55U, 0xAF286BA1U, 0x9739040DU,
+      0x59F3BFF2U, 0x61E2D05EU, 0x29D160AAU, 0x11C00F06U, 0xB9B60142U, 0x81A76EEEU, 0xC994DE1AU, 0xF185B1B6U,
+      0x9C94B463U, 0xA485DBCFU, 0xECB66B3BU, 0xD4A70497U, 0x7CD10AD3U, 0x44C0657FU, 0x0CF3D58BU, 0x34E2BA27U,
+      0xD6D1DE21U, 0xEEC0B18DU, 0xA6F30179U, 0x9EE26ED5U, 0x36946091U, 0x0E850F3DU, 0x46B6BFC9U, 0x7EA7D065U,
+      0x13B6D5B0U, 0x2BA7BA1CU, 0x63940AE8U, 0x5B856544U, 0xF3F36B00U, 0xCBE204ACU, 0x83D1B458U, 0xBBC0DBF4U,
+      0x425B0AA5U, 0x7A4A6509U, 0x3279D5FDU, 0x0A68BA51U, 0xA21EB415U, 0x9A0FDBB9U, 0xD23C6B4DU, 0xEA2D04E1U,
+      0x873C0134U, 0xBF2D6E98U, 0xF71EDE6CU, 0xCF0FB1C0U, 0x6779BF84U, 0x5F68D028U, 0x175B60DCU, 0x2F4A0F70U,
+      0xCD796B76U, 0xF56804DAU, 0xBD5BB42EU, 0x854ADB82U, 0x2D3CD5C6U, 0x152DBA6AU, 0x5D1E0A9EU, 0x650F6532U,
+      0x081E60E7U, 0x300F0F4BU, 0x783CBFBFU, 0x402DD013U, 0xE85BDE57U, 0xD04AB1FBU, 0x9879010FU, 0xA0686EA3U
+    },
+    {
+      0x00000000U, 0xEF306B19U, 0xDB8CA0C3U, 0x34BCCBDAU, 0xB2F53777U, 0x5DC55C6EU, 0x697997B4U, 0x8649FCADU,
+      0x6006181FU, 0x8F367306U, 0xBB8AB8DCU, 0x54BAD3C5U, 0xD2F32F68U, 0x3DC34471U, 0x097F8FABU, 0xE64FE4B2U,
+      0xC00C303EU, 0x2F3C5B27U, 0x1B8090FDU, 0xF4B0FBE4U, 0x72F90749U, 0x9DC96C50U, 0xA975A78AU, 0x4645CC93U,
+      0xA00A2821U, 0x4F3A4338U, 0x7B8688E2U, 0x94B6E3FBU, 0x12FF1F56U, 0xFDCF744FU, 0xC973BF95U, 0x2643D48CU,
+      0x85F4168DU, 0x6AC47D94U, 0x5E78B64EU, 0xB148DD57U, 0x370121FAU, 0xD8314AE3U, 0xEC8D8139U, 0x03BDEA20U,
+      0xE5F20E92U, 0x0AC2658BU, 0x3E7EAE51U, 0xD14EC548U, 0x570739E5U, 0xB83752FCU, 0x8C8B9926U, 0x63BBF23FU,
+      0x45F826B3U, 0xAAC84DAAU, 0x9E748670U, 0x7144ED69U, 0xF70D11C4U, 0x183D7ADDU, 0x2C81B107U, 0xC3B1DA1EU,
+      0x25FE3EACU, 0xCACE55B5U, 0xFE729E6FU, 0x1142F576U, 0x970B09DBU, 0x783B62C2U, 0x4C87A918U, 0xA3B7C201U,
+      0x0E045BEBU, 0xE13430F2U, 0xD588FB28U, 0x3AB89031U, 0xBCF16C9CU, 0x53C10785U, 0x677DCC5FU, 0x884DA746U,
+      0x6E0243F4U, 0x813228EDU, 0xB58EE337U, 0x5ABE882EU, 0xDCF77483U, 0x33C71F9AU, 0x077BD440U, 0xE84BBF59U,
+      0xCE086BD5U, 0x213800CCU, 0x1584CB16U, 0xFAB4A00FU, 0x7CFD5CA2U, 0x93CD37BBU, 0xA771FC61U, 0x48419778U,
+      0xAE0E73CAU, 0x413E18D3U, 0x7582D309U, 0x9AB2B810U, 0x1CFB44BDU, 0xF3CB2FA4U, 0xC777E47EU, 0x28478F67U,
+      0x8BF04D66U, 0x64C0267FU, 0x507CEDA5U, 0xBF4C86BCU, 0x39057A11U, 0xD6351108U, 0xE289DAD2U, 0x0DB9B1CBU,
+      0xEBF65579U, 0x04C63E60U, 0x307AF5BAU, 0xDF4A9EA3U, 0x5903620EU, 0xB6330917U, 0x828FC2CDU, 0x6DBFA9D4U,
+      0x4BFC7D58U, 0xA4CC1641U, 0x9070DD9BU, 0x7F40B682U, 0xF9094A2FU, 0x16392136U, 0x2285EAECU, 0xCDB581F5U,
+      0x2BFA6547U, 0xC4CA0E5EU, 0xF076C584U, 0x1F46AE9DU, 0x990F5230U, 0x763F3929U, 0x4283F2F3U, 0xADB399EAU,
+      0x1C08B7D6U, 0xF338DCCFU, 0xC7841715U, 0x28B47C0CU, 0xAEFD80A1U, 0x41CDEBB8U, 0x75712062U, 0x9A414B7BU,
+      0x7C0EAFC9U, 0x933EC4D0U, 0xA7820F0AU, 0x48B26413U, 0xCEFB98BEU, 0x21CBF3A7U, 0x1577387DU, 0xFA475364U,
+      0xDC0487E8U, 0x3334ECF1U, 0x0788272BU, 0xE8B84C32U, 0x6EF1B09FU, 0x81C1DB86U, 0xB57D105CU, 0x5A4D7B45U,
+      0xBC029FF7U, 0x5332F4EEU, 0x678E3F34U, 0x88BE542DU, 0x0EF7A880U, 0xE1C7C399U, 0xD57B0843U, 0x3A4B635AU,
+      0x99FCA15BU, 0x76CCCA42U, 0x42700198U, 0xAD406A81U, 0x2B09962CU, 0xC439FD35U, 0xF08536EFU, 0x1FB55DF6U,
+      0xF9FAB944U, 0x16CAD25DU, 0x22761987U, 0xCD46729EU, 0x4B0F8E33U, 0xA43FE52AU, 0x90832EF0U, 0x7FB345E9U,
+      0x59F09165U, 0xB6C0FA7CU, 0x827C31A6U, 0x6D4C5ABFU, 0xEB05A612U, 0x0435CD0BU, 0x308906D1U, 0xDFB96DC8U,
+      0x39F6897AU, 0xD6C6E263U, 0xE27A29B9U, 0x0D4A42A0U, 0x8B03BE0DU, 0x6433D514U, 0x508F1ECEU, 0xBFBF75D7U,
+      0x120CEC3DU, 0xFD3C8724U, 0xC9804CFEU, 0x26B027E7U, 0xA0F9DB4AU, 0x4FC9B053U, 0x7B757B89U, 0x94451090U,
+      0x720AF422U, 0x9D3A9F3BU, 0xA98654E1U, 0x46B63FF8U, 0xC0FFC355U, 0x2FCFA84CU, 0x1B736396U, 0xF443088FU,
+      0xD200DC03U, 0x3D30B71AU, 0x098C7CC0U, 0xE6BC17D9U, 0x60F5EB74U, 0x8FC5806DU, 0xBB794BB7U, 0x544920AEU,
+      0xB206C41CU, 0x5D36AF05U, 0x698A64DFU, 0x86BA0FC6U, 0x00F3F36BU, 0xEFC39872U, 0xDB7F53A8U, 0x344F38B1U,
+      0x97F8FAB0U, 0x78C891A9U, 0x4C745A73U, 0xA344316AU, 0x250DCDC7U, 0xCA3DA6DEU, 0xFE816D04U, 0x11B1061DU,
+      0xF7FEE2AFU, 0x18CE89B6U, 0x2C72426CU, 0xC3422975U, 0x450BD5D8U, 0xAA3BBEC1U, 0x9E87751BU, 0x71B71E02U,
+      0x57F4CA8EU, 0xB8C4A197U, 0x8C786A4DU, 0x63480154U, 0xE501FDF9U, 0x0A3196E0U, 0x3E8D5D3AU, 0xD1BD3623U,
+      0x37F2D291U, 0xD8C2B988U, 0xEC7E7252U, 0x034E194BU, 0x8507E5E6U, 0x6A378EFFU, 0x5E8B4525U, 0xB1BB2E3CU
+    },
+    {
+      0x00000000U, 0x68032CC8U, 0xD0065990U, 0xB8057558U, 0xA5E0C5D1U, 0xCDE3E919U, 0x75E69C41U, 0x1DE5B089U,
+      0x4E2DFD53U, 0x262ED19BU, 0x9E2BA4C3U, 0xF628880BU, 0xEBCD3882U, 0x83CE144AU, 0x3BCB6112U, 0x53C84DDAU,
+      0x9C5BFAA6U, 0xF458D66EU, 0x4C5DA336U, 0x245E8FFEU, 0x39BB3F77U, 0x51B813BFU, 0xE9BD66E7U, 0x81BE4A2FU,
+      0xD27607F5U, 0xBA752B3DU, 0x02705E65U, 0x6A7372ADU, 0x7796C224U, 0x1F95EEECU, 0xA7909BB4U, 0xCF93B77CU,
+      0x3D5B83BDU, 0x5558AF75U, 0xED5DDA2DU, 0x855EF6E5U, 0x98BB466CU, 0xF0B86AA4U, 0x48BD1FFCU, 0x20BE3334U,
+      0x73767EEEU, 0x1B755226U, 0xA370277EU, 0xCB730BB6U, 0xD696BB3FU, 0xBE9597F7U, 0x0690E2AFU, 0x6E93CE67U,
+      0xA100791BU, 0xC90355D3U, 0x7106208BU, 0x19050C43U, 0x04E0BCCAU, 0x6CE39002U, 0xD4E6E55AU, 0xBCE5C992U,
+      0xEF2D8448U, 0x872EA880U, 0x3F2BDDD8U, 0x5728F110U, 0x4ACD4199U, 0x22CE6D51U, 0x9ACB1809U, 0xF2C834C1U,
+      0x7AB7077AU, 0x12B42BB2U, 0xAAB15EEAU, 0xC2B27222U, 0xDF57C2ABU, 0xB754EE63U, 0x0F519B3BU, 0x6752B7F3U,
+      0x349AFA29U, 0x5C99D6E1U, 0xE49CA3B9U, 0x8C9F8F71U, 0x917A3FF8U, 0xF9791330U, 0x417C6668U, 0x297F4AA0U,
+      0xE6ECFDDCU, 0x8EEFD114U, 0x36EAA44CU, 0x5EE98884U, 0x430C380DU, 0x2B0F14C5U, 0x930A619DU, 0xFB094D55U,
+      0xA8C1008FU, 0xC0C22C47U, 0x78C7591FU, 0x10C475D7U, 0x0D21C55EU, 0x6522E996U, 0xDD279CCEU, 0xB524B006U,
+      0x47EC84C7U, 0x2FEFA80FU, 0x97EADD57U, 0xFFE9F19FU, 0xE20C4116U, 0x8A0F6DDEU, 0x320A1886U, 0x5A09344EU,
+      0x09C17994U, 0x61C2555CU, 0xD9C72004U, 0xB1C40CCCU, 0xAC21BC45U, 0xC422908DU, 0x7C27E5D5U, 0x1424C91DU,
+      0xDBB77E61U, 0xB3B452A9U, 0x0BB127F1U, 0x63B20B39U, 0x7E57BBB0U, 0x16549778U, 0xAE51E220U, 0xC652CEE8U,
+      0x959A8332U, 0xFD99AFFAU, 0x459CDAA2U, 0x2D9FF66AU, 0x307A46E3U, 0x58796A2BU, 0xE07C1F73U, 0x887F33BBU,
+      0xF56E0EF4U, 0x9D6D223CU, 0x25685764U, 0x4D6B7BACU, 0x508ECB25U, 0x388DE7EDU, 0x808892B5U, 0xE88BBE7DU,
+      0xBB43F3A7U, 0xD340DF6FU, 0x6B45AA37U, 0x034686FFU, 0x1EA33676U, 0x76A01ABEU, 0xCEA56FE6U, 0xA6A6432EU,
+      0x6935F452U, 0x0136D89AU, 0xB933ADC2U, 0xD130810AU, 0xCCD53183U, 0xA4D61D4BU, 0x1CD36813U, 0x74D044DBU,
+      0x27180901U, 0x4F1B25C9U, 0xF71E5091U, 0x9F1D7C59U, 0x82F8CCD0U, 0xEAFBE018U, 0x52FE9540U, 0x3AFDB988U,
+      0xC8358D49U, 0xA036A181U, 0x1833D4D9U, 0x7030F811U, 0x6DD54898U, 0x05D66450U, 0xBDD31108U, 0xD5D03DC0U,
+      0x8618701AU, 0xEE1B5CD2U, 0x561E298AU, 0x3E1D0542U, 0x23F8B5CBU, 0x4BFB9903U, 0xF3FEEC5BU, 0x9BFDC093U,
+      0x546E77EFU, 0x3C6D5B27U, 0x84682E7FU, 0xEC6B02B7U, 0xF18EB23EU, 0x998D9EF6U, 0x2188EBAEU, 0x498BC766U,
+      0x1A438ABCU, 0x7240A674U, 0xCA45D32CU, 0xA246FFE4U, 0xBFA34F6DU, 0xD7A063A5U, 0x6FA516FDU, 0x07A63A35U,
+      0x8FD9098EU, 0xE7DA2546U, 0x5FDF501EU, 0x37DC7CD6U, 0x2A39CC5FU, 0x423AE097U, 0xFA3F95CFU, 0x923CB907U,
+      0xC1F4F4DDU, 0xA9F7D815U, 0x11F2AD4DU, 0x79F18185U, 0x6414310CU, 0x0C171DC4U, 0xB412689CU, 0xDC114454U,
+      0x1382F328U, 0x7B81DFE0U, 0xC384AAB8U, 0xAB878670U, 0xB66236F9U, 0xDE611A31U, 0x66646F69U, 0x0E6743A1U,
+      0x5DAF0E7BU, 0x35AC22B3U, 0x8DA957EBU, 0xE5AA7B23U, 0xF84FCBAAU, 0x904CE762U, 0x2849923AU, 0x404ABEF2U,
+      0xB2828A33U, 0xDA81A6FBU, 0x6284D3A3U, 0x0A87FF6BU, 0x17624FE2U, 0x7F61632AU, 0xC7641672U, 0xAF673ABAU,
+      0xFCAF7760U, 0x94AC5BA8U, 0x2CA92EF0U, 0x44AA0238U, 0x594FB2B1U, 0x314C9E79U, 0x8949EB21U, 0xE14AC7E9U,
+      0x2ED97095U, 0x46DA5C5DU, 0xFEDF2905U, 0x96DC05CDU, 0x8B39B544U, 0xE33A998CU, 0x5B3FECD4U, 0x333CC01CU,
+      0x60F48DC6U, 0x08F7A10EU, 0xB0F2D456U, 0xD8F1F89EU, 0xC5144817U, 0xAD1764DFU, 0x15121187U, 0x7D113D4FU
+    },
+    {
+      0x00000000U, 0x493C7D27U, 0x9278FA4EU, 0xDB448769U, 0x211D826DU, 0x6821FF4AU, 0xB3657823U, 0xFA590504U,
+      0x423B04DAU, 0x0B0779FDU, 0xD043FE94U, 0x997F83B3U, 0x632686B7U, 0x2A1AFB90U, 0xF15E7CF9U, 0xB86201DEU,
+      0x847609B4U, 0xCD4A7493U, 0x160EF3FAU, 0x5F328EDDU, 0xA56B8BD9U, 0xEC57F6FEU, 0x37137197U, 0x7E2F0CB0U,
+      0xC64D0D6EU, 0x8F717049U, 0x5435F720U, 0x1D098A07U, 0xE7508F03U, 0xAE6CF224U, 0x7528754DU, 0x3C14086AU,
+      0x0D006599U, 0x443C18BEU, 0x9F789FD7U, 0xD644E2F0U, 0x2C1DE7F4U, 0x65219AD3U, 0xBE651DBAU, 0xF759609DU,
+      0x4F3B6143U, 0x06071C64U, 0xDD439B0DU, 0x947FE62AU, 0x6E26E32EU, 0x271A9E09U, 0xFC5E1960U, 0xB5626447U,
+      0x89766C2DU, 0xC04A110AU, 0x1B0E9663U, 0x5232EB44U, 0xA86BEE40U, 0xE1579367U, 0x3A13140EU, 0x732F6929U,
+      0xCB4D68F7U, 0x827115D0U, 0x593592B9U, 0x1009EF9EU, 0xEA50EA9AU, 0xA36C97BDU, 0x782810D4U, 0x31146DF3U,
+      0x1A00CB32U, 0x533CB615U, 0x8878317CU, 0xC1444C5BU, 0x3B1D495FU, 0x72213478U, 0xA965B311U, 0xE059CE36U,
+      0x583BCFE8U, 0x1107B2CFU, 0xCA4335A6U, 0x837F4881U, 0x79264D85U, 0x301A30A2U, 0xEB5EB7CBU, 0xA262CAECU,
+      0x9E76C286U, 0xD74ABFA1U, 0x0C0E38C8U, 0x453245EFU, 0xBF6B40EBU, 0xF6573DCCU, 0x2D13BAA5U, 0x642FC782U,
+      0xDC4DC65CU, 0x9571BB7BU, 0x4E353C12U, 0x07094135U, 0xFD504431U, 0xB46C3916U, 0x6F28BE7FU, 0x2614C358U,
+      0x1700AEABU, 0x5E3CD38CU, 0x857854E5U, 0xCC4429C2U, 0x361D2CC6U, 0x7F2151E1U, 0xA465D688U, 0xED59ABAFU,
+      0x553BAA71U, 0x1C07D756U, 0xC743503FU, 0x8E7F2D18U, 0x7426281CU, 0x3D1A553BU, 0xE65ED252U, 0xAF62AF75U,
+      0x9376A71FU, 0xDA4ADA38U, 0x010E5D51U, 0x48322076U, 0xB26B2572U, 0xFB575855U, 0x2013DF3CU, 0x692FA21BU,
+      0xD14DA3C5U, 0x9871DEE2U, 0x4335598BU, 0x0A0924ACU, 0xF05021A8U, 0xB96C5C8FU, 0x6228DBE6U, 0x2B14A6C1U,
+      0x34019664U, 0x7D3DEB43U, 0xA6796C2AU, 0xEF45110DU, 0x151C1409U, 0x5C20692EU, 0x8764EE47U, 0xCE589360U,
+      0x763A92BEU, 0x3F06EF99U, 0xE44268F0U, 0xAD7E15D7U, 0x572710D3U, 0x1E1B6DF4U, 0xC55FEA9DU, 0x8C6397BAU,
+      0xB0779FD0U, 0xF94BE2F7U, 0x220F659EU, 0x6B3318B9U, 0x916A1DBDU, 0xD856609AU, 0x0312E7F3U, 0x4A2E9AD4U,
+      0xF24C9B0AU, 0xBB70E62DU, 0x60346144U, 0x29081C63U, 0xD3511967U, 0x9A6D6440U, 0x4129E329U, 0x08159E0EU,
+      0x3901F3FDU, 0x703D8EDAU, 0xAB7909B3U, 0xE2457494U, 0x181C7190U, 0x51200CB7U, 0x8A648BDEU, 0xC358F6F9U,
+      0x7B3AF727U, 0x32068A00U, 0xE9420D69U, 0xA07E704EU, 0x5A27754AU, 0x131B086DU, 0xC85F8F04U, 0x8163F223U,
+      0xBD77FA49U, 0xF44B876EU, 0x2F0F0007U, 0x66337D20U, 0x9C6A7824U, 0xD5560503U, 0x0E12826AU, 0x472EFF4DU,
+      0xFF4CFE93U, 0xB67083B4U, 0x6D3404DDU, 0x240879FAU, 0xDE517CFEU, 0x976D01D9U, 0x4C2986B0U, 0x0515FB97U,
+      0x2E015D56U, 0x673D2071U, 0xBC79A718U, 0xF545DA3FU, 0x0F1CDF3BU, 0x4620A21CU, 0x9D642575U, 0xD4585852U,
+      0x6C3A598CU, 0x250624ABU, 0xFE42A3C2U, 0xB77EDEE5U, 0x4D27DBE1U, 0x041BA6C6U, 0xDF5F21AFU, 0x96635C88U,
+      0xAA7754E2U, 0xE34B29C5U, 0x380FAEACU, 0x7133D38BU, 0x8B6AD68FU, 0xC256ABA8U, 0x19122CC1U, 0x502E51E6U,
+      0xE84C5038U, 0xA1702D1FU, 0x7A34AA76U, 0x3308D751U, 0xC951D255U, 0x806DAF72U, 0x5B29281BU, 0x1215553CU,
+      0x230138CFU, 0x6A3D45E8U, 0xB179C281U, 0xF845BFA6U, 0x021CBAA2U, 0x4B20C785U, 0x906440ECU, 0xD9583DCBU,
+      0x613A3C15U, 0x28064132U, 0xF342C65BU, 0xBA7EBB7CU, 0x4027BE78U, 0x091BC35FU, 0xD25F4436U, 0x9B633911U,
+      0xA777317BU, 0xEE4B4C5CU, 0x350FCB35U, 0x7C33B612U, 0x866AB316U, 0xCF56CE31U, 0x14124958U, 0x5D2E347FU,
+      0xE54C35A1U, 0xAC704886U, 0x7734CFEFU, 0x3E08B2C8U, 0xC451B7CCU, 0x8D6DCAEBU, 0x56294D82U, 0x1F1530A5U
+    }
+  },
+  {  // Check code type D: CRC16 with polynomial 0x1021
+    {
+      0x00000000U, 0x00001189U, 0x00002312U, 0x0000329BU, 0x00004624U, 0x000057ADU, 0x00006536U, 0x000074BFU,
+      0x00008C48U, 0x00009DC1U, 0x0000AF5AU, 0x0000BED3U, 0x0000CA6CU, 0x0000DBE5U, 0x0000E97EU, 0x0000F8F7U,
+      0x00001081U, 0x00000108U, 0x00003393U, 0x0000221AU, 0x000056A5U, 0x0000472CU, 0x000075B7U, 0x0000643EU,
+      0x00009CC9U, 0x00008D40U, 0x0000BFDBU, 0x0000AE52U, 0x0000DAEDU, 0x0000CB64U, 0x0000F9FFU, 0x0000E876U,
+      0x00002102U, 0x0000308BU, 0x00000210U, 0x00001399U, 0x00006726U, 0x000076AFU, 0x00004434U, 0x000055BDU,
+      0x0000AD4AU, 0x0000BCC3U, 0x00008E58U, 0x00009FD1U, 0x0000EB6EU, 0x0000FAE7U, 0x0000C87CU, 0x0000D9F5U,
+      0x00003183U, 0x0000200AU, 0x00001291U, 0x00000318U, 0x000077A7U, 0x0000662EU, 0x000054B5U, 0x0000453CU,
+      0x0000BDCBU, 0x0000AC42U, 0x00009ED9U, 0x00008F50U, 0x0000FBEFU, 0x0000EA66U, 0x0000D8FDU, 0x0000C974U,
+      0x00004204U, 0x0000538DU, 0x00006116U, 0x0000709FU, 0x00000420U, 0x000015A9U, 0x00002732U, 0x000036BBU,
+      0x0000CE4CU, 0x0000DFC5U, 0x0000ED5EU, 0x0000FCD7U, 0x00008868U, 0x000099E1U, 0x0000AB7AU, 0x0000BAF3U,
+      0x00005285U, 0x0000430CU, 0x00007197U, 0x0000601EU, 0x000014A1U, 0x00000528U, 0x000037B3U, 0x0000263AU,
+      0x0000DECDU, 0x0000CF44U, 0x0000FDDFU, 0x0000EC56U, 0x000098E9U, 0x00008960U, 0x0000BBFBU, 0x0000AA72U,
+      0x00006306U, 0x0000728FU, 0x00004014U, 0x0000519DU, 0x00002522U, 0x000034ABU, 0x00000630U, 0x000017B9U,
+      0x0000EF4EU, 0x0000FEC7U, 0x0000CC5CU, 0x0000DDD5U, 0x0000A96AU, 0x0000B8E3U, 0x00008A78U, 0x00009BF1U,
+      0x00007387U, 0x0000620EU, 0x00005095U, 0x0000411CU, 0x000035A3U, 0x0000242AU, 0x000016B1U, 0x00000738U,
+      0x0000FFCFU, 0x0000EE46U, 0x0000DCDDU, 0x0000CD54U, 0x0000B9EBU, 0x0000A862U, 0x00009AF9U, 0x00008B70U,
+      0x00008408U, 0x00009581U, 0x0000A71AU, 0x0000B693U, 0x0000C22CU, 0x0000D3A5U, 0x0000E13EU, 0x0000F0B7U,
+      0x00000840U, 0x000019C9U, 0x00002B52U, 0x00003ADBU, 0x00004E64U, 0x00005FEDU, 0x00006D76U, 0x00007CFFU,
+      0x00009489U, 0x00008500U, 0x0000B79BU, 0x0000A612U, 0x0000D2ADU, 0x0000C324U, 0x0000F1BFU, 0x0000E036U,
+      0x000018C1U, 0x00000948U, 0x00003BD3U, 0x00002A5AU, 0x00005EE5U, 0x00004F6CU, 0x00007DF7U, 0x00006C7EU,
+      0x0000A50AU, 0x0000B483U, 0x00008618U, 0x00009791U, 0x0000E32EU, 0x0000F2A7U, 0x0000C03CU, 0x0000D1B5U,
+      0x00002942U, 0x000038CBU, 0x00000A50U, 0x00001BD9U, 0x00006F66U, 0x00007EEFU, 0x00004C74U, 0x00005DFDU,
+      0x0000B58BU, 0x0000A402U, 0x00009699U, 0x00008710U, 0x0000F3AFU, 0x0000E226U, 0x0000D0BDU, 0x0000C134U,
+      0x000039C3U, 0x0000284AU, 0x00001AD1U, 0x00000B58U, 0x00007FE7U, 0x00006E6EU, 0x00005CF5U, 0x00004D7CU,
+      0x0000C60CU, 0x0000D785U, 0x0000E51EU, 0x0000F497U, 0x00008028U, 0x000091A1U, 0x0000A33AU, 0x0000B2B3U,
+      0x00004A44U, 0x00005BCDU, 0x00006956U, 0x000078DFU, 0x00000C60U, 0x00001DE9U, 0x00002F72U, 0x00003EFBU,
+      0x0000D68DU, 0x0000C704U, 0x0000F59FU, 0x0000E416U, 0x000090A9U, 0x00008120U, 0x0000B3BBU, 0x0000A232U,
+      0x00005AC5U, 0x00004B4CU, 0x000079D7U, 0x0000685EU, 0x00001CE1U, 0x00000D68U, 0x00003FF3U, 0x00002E7AU,
+      0x0000E70EU, 0x0000F687U, 0x0000C41CU, 0x0000D595U, 0x0000A12AU, 0x0000B0A3U, 0x00008238U, 0x000093B1U,
+      0x00006B46U, 0x00007ACFU, 0x00004854U, 0x000059DDU, 0x00002D62U, 0x00003CEBU, 0x00000E70U, 0x00001FF9U,
+      0x0000F78FU, 0x0000E606U, 0x0000D49DU, 0x0000C514U, 0x0000B1ABU, 0x0000A022U, 0x000092B9U, 0x00008330U,
+      0x00007BC7U, 0x00006A4EU, 0x000058D5U, 0x0000495CU, 0x00003DE3U, 0x00002C6AU, 0x00001EF1U, 0x00000F78U
+    },
+    {
+      0x00000000U, 0x000019D8U, 0x000033B0U, 0x00002A68U, 0x00006760U, 0x00007EB8U, 0x000054D0U, 0x00004D08U,
+      0x0000CEC0U, 0x0000D718U, 0x0000FD70U, 0x0000E4A8U, 0x0000A9A0U, 0x0000B078U, 0x00009A10U, 0x000083C8U,
+      0x00009591U, 0x00008C49U, 0x0000A621U, 0x0000BFF9U, 0x0000F2F1U, 0x0000EB29U, 0x0000C141U, 0x0000D899U,
+      0x00005B51U, 0x00004289U, 0x000068E1U, 0x00007139U, 0x00003C31U, 0x000025E9U, 0x00000F81U, 0x00001659U,
+      0x00002333U, 0x00003AEBU, 0x00001083U, 0x0000095BU, 0x00004453U, 0x00005D8BU, 0x000077E3U, 0x00006E3BU,
+      0x0000EDF3U, 0x0000F42BU, 0x0000DE43U, 0x0000C79BU, 0x00008A93U, 0x0000934BU, 0x0000B923U, 0x0000A0FBU,
+      0x0000B6A2U, 0x0000AF7AU, 0x00008512U, 0x00009CCAU, 0x0000D1C2U, 0x0000C81AU, 0x0000E272U, 0x0000FBAAU,
+      0x00007862U, 0x000061BAU, 0x00004BD2U, 0x0000520AU, 0x00001F02U, 0x000006DAU, 0x00002CB2U, 0x0000356AU,
+      0x00004666U, 0x00005FBEU, 0x000075D6U, 0x00006C0EU, 0x00002106U, 0x000038DEU, 0x000012B6U, 0x00000B6EU,
+      0x000088A6U, 0x0000917EU, 0x0000BB16U, 0x0000A2CEU, 0x0000EFC6U, 0x0000F61EU, 0x0000DC76U, 0x0000C5AEU,
+      0x0000D3F7U, 0x0000CA2FU, 0x0000E047U, 0x0000F99FU, 0x0000B497U, 0x0000AD4FU, 0x00008727U, 0x00009EFFU,
+      0x00001D37U, 0x000004EFU, 0x00002E87U, 0x0000375FU, 0x00007A57U, 0x0000638FU, 0x000049E7U, 0x0000503FU,
+      0x00006555U, 0x00007C8DU, 0x000056E5U, 0x00004F3DU, 0x00000235U, 0x00001BEDU, 0x00003185U, 0x0000285DU,
+      0x0000AB95U, 0x0000B24DU, 0x00009825U, 0x000081FDU, 0x0000CCF5U, 0x0000D52DU, 0x0000FF45U, 0x0000E69DU,
+      0x0000F0C4U, 0x0000E91CU, 0x0000C374U, 0x0000DAACU, 0x000097A4U, 0x00008E7CU, 0x0000A414U, 0x0000BDCCU,
+      0x00003E04U, 0x000027DCU, 0x00000DB4U, 0x0000146CU, 0x00005964U, 0x000040BCU, 0x00006AD4U, 0x0000730CU,
+      0x00008CCCU, 0x00009514U, 0x0000BF7CU, 0x0000A6A4U, 0x0000EBACU, 0x0000F274U, 0x0000D81CU, 0x0000C1C4U,
+      0x0000420CU, 0x00005BD4U, 0x000071BCU, 0x00006864U, 0x0000256CU, 0x00003CB4U, 0x000016DCU, 0x00000F04U,
+      0x0000195DU, 0x00000085U, 0x00002AEDU, 0x00003335U, 0x00007E3DU, 0x000067E5U, 0x00004D8DU, 0x00005455U,
+      0x0000D79DU, 0x0000CE45U, 0x0000E42DU, 0x0000FDF5U, 0x0000B0FDU, 0x0000A925U, 0x0000834DU, 0x00009A95U,
+      0x0000AFFFU, 0x0000B627U, 0x00009C4FU, 0x00008597U, 0x0000C89FU, 0x0000D147U, 0x0000FB2FU, 0x0000E2F7U,
+      0x0000613FU, 0x000078E7U, 0x0000528FU, 0x00004B57U, 0x0000065FU, 0x00001F87U, 0x000035EFU, 0x00002C37U,
+      0x00003A6EU, 0x000023B6U, 0x000009DEU, 0x00001006U, 0x00005D0EU, 0x000044D6U, 0x00006EBEU, 0x00007766U,
+      0x0000F4AEU, 0x0000ED76U, 0x0000C71EU, 0x0000DEC6U, 0x000093CEU, 0x00008A16U, 0x0000A07EU, 0x0000B9A6U,
+      0x0000CAAAU, 0x0000D372U, 0x0000F91AU, 0x0000E0C2U, 0x0000ADCAU, 0x0000B412U, 0x00009E7AU, 0x000087A2U,
+      0x0000046AU, 0x00001DB2U, 0x000037DAU, 0x00002E02U, 0x0000630AU, 0x00007AD2U, 0x000050BAU, 0x00004962U,
+      0x00005F3BU, 0x000046E3U, 0x00006C8BU, 0x00007553U, 0x0000385BU, 0x00002183U, 0x00000BEBU, 0x00001233U,
+      0x000091FBU, 0x00008823U, 0x0000A24BU, 0x0000BB93U, 0x0000F69BU, 0x0000EF43U, 0x0000C52BU, 0x0000DCF3U,
+      0x0000E999U, 0x0000F041U, 0x0000DA29U, 0x0000C3F1U, 0x00008EF9U, 0x00009721U, 0x0000BD49U, 0x0000A491U,
+      0x00002759U, 0x00003E81U, 0x000014E9U, 0x00000D31U, 0x00004039U, 0x000059E1U, 0x00007389U, 0x00006A51U,
+      0x00007C08U, 0x000065D0U, 0x00004FB8U, 0x00005660U, 0x00001B68U, 0x000002B0U, 0x000028D8U, 0x00003100U,
+      0x0000B2C8U, 0x0000AB10U, 0x00008178U, 0x000098A0U, 0x0000D5A8U, 0x0000CC70U, 0x0000E618U, 0x0000FFC0U
+    },
+    {
+      0x00000000U, 0x00005ADCU, 0x0000B5B8U, 0x0000EF64U, 0x00006361U, 0x000039BDU, 0x0000D6D9U, 0x00008C05U,
+      0x0000C6C2U, 0x00009C1EU, 0x0000737AU, 0x000029A6U, 0x0000A5A3U, 0x0000FF7FU, 0x0000101BU, 0x00004AC7U,
+      0x00008595U, 0x0000DF49U, 0x0000302DU, 0x00006AF1U, 0x0000E6F4U, 0x0000BC28U, 0x0000534CU, 0x00000990U,
+      0x00004357U, 0x0000198BU, 0x0000F6EFU, 0x0000AC33U, 0x00002036U, 0x00007AEAU, 0x0000958EU, 0x0000CF52U,
+      0x0000033BU, 0x000059E7U, 0x0000B683U, 0x0000EC5FU, 0x0000605AU, 0x00003A86U, 0x0000D5E2U, 0x00008F3EU,
+      0x0000C5F9U, 0x00009F25U, 0x00007041U, 0x00002A9DU, 0x0000A698U, 0x0000FC44U, 0x00001320U, 0x000049FCU,
+      0x000086AEU, 0x0000DC72U, 0x00003316U, 0x000069CAU, 0x0000E5CFU, 0x0000BF13U, 0x00005077U, 0x00000AABU,
+      0x0000406CU, 0x00001AB0U, 0x0000F5D4U, 0x0000AF08U, 0x0000230DU, 0x000079D1U, 0x000096B5U, 0x0000CC69U,
+      0x00000676U, 0x00005CAAU, 0x0000B3CEU, 0x0000E912U, 0x00006517U, 0x00003FCBU, 0x0000D0AFU, 0x00008A73U,
+      0x0000C0B4U, 0x00009A68U, 0x0000750CU, 0x00002FD0U, 0x0000A3D5U, 0x0000F909U, 0x0000166DU, 0x00004CB1U,
+      0x000083E3U, 0x0000D93FU, 0x0000365BU, 0x00006C87U, 0x0000E082U, 0x0000BA5EU, 0x0000553AU, 0x00000FE6U,
+      0x00004521U, 0x00001FFDU, 0x0000F099U, 0x0000AA45U, 0x00002640U, 0x00007C9CU, 0x000093F8U, 0x0000C924U,
+      0x0000054DU, 0x00005F91U, 0x0000B0F5U, 0x0000EA29U, 0x0000662CU, 0x00003CF0U, 0x0000D394U, 0x00008948U,
+      0x0000C38FU, 0x00009953U, 0x00007637U, 0x00002CEBU, 0x0000A0EEU, 0x0000FA32U, 0x00001556U, 0x00004F8AU,
+      0x000080D8U, 0x0000DA04U, 0x00003560U, 0x00006FBCU, 0x0000E3B9U, 0x0000B965U, 0x00005601U, 0x00000CDDU,
+      0x0000461AU, 0x00001CC6U, 0x0000F3A2U, 0x0000A97EU, 0x0000257BU, 0x00007FA7U, 0x000090C3U, 0x0000CA1FU,
+      0x00000CECU, 0x00005630U, 0x0000B954U, 0x0000E388U, 0x00006F8DU, 0x00003551U, 0x0000DA35U, 0x000080E9U,
+      0x0000CA2EU, 0x000090F2U, 0x00007F96U, 0x0000254AU, 0x0000A94FU, 0x0000F393U, 0x00001CF7U, 0x0000462BU,
+      0x00008979U, 0x0000D3A5U, 0x00003CC1U, 0x0000661DU, 0x0000EA18U, 0x0000B0C4U, 0x00005FA0U, 0x0000057CU,
+      0x00004FBBU, 0x00001567U, 0x0000FA03U, 0x0000A0DFU, 0x00002CDAU, 0x00007606U, 0x00009962U, 0x0000C3BEU,
+      0x00000FD7U, 0x0000550BU, 0x0000BA6FU, 0x0000E0B3U, 0x00006CB6U, 0x0000366AU, 0x0000D90EU, 0x000083D2U,
+      0x0000C915U, 0x000093C9U, 0x00007CADU, 0x00002671U, 0x0000AA74U, 0x0000F0A8U, 0x00001FCCU, 0x00004510U,
+      0x00008A42U, 0x0000D09EU, 0x00003FFAU, 0x00006526U, 0x0000E923U, 0x0000B3FFU, 0x00005C9BU, 0x00000647U,
+      0x00004C80U, 0x0000165CU, 0x0000F938U, 0x0000A3E4U, 0x00002FE1U, 0x0000753DU, 0x00009A59U, 0x0000C085U,
+      0x00000A9AU, 0x00005046U, 0x0000BF22U, 0x0000E5FEU, 0x000069FBU, 0x00003327U, 0x0000DC43U, 0x0000869FU,
+      0x0000CC58U, 0x00009684U, 0x000079E0U, 0x0000233CU, 0x0000AF39U, 0x0000F5E5U, 0x00001A81U, 0x0000405DU,
+      0x00008F0FU, 0x0000D5D3U, 0x00003AB7U, 0x0000606BU, 0x0000EC6EU, 0x0000B6B2U, 0x000059D6U, 0x0000030AU,
+      0x000049CDU, 0x00001311U, 0x0000FC75U, 0x0000A6A9U, 0x00002AACU, 0x00007070U, 0x00009F14U, 0x0000C5C8U,
+      0x000009A1U, 0x0000537DU, 0x0000BC19U, 0x0000E6C5U, 0x00006AC0U, 0x0000301CU, 0x0000DF78U, 0x000085A4U,
+      0x0000CF63U, 0x000095BFU, 0x00007ADBU, 0x00002007U, 0x0000AC02U, 0x0000F6DEU, 0x000019BAU, 0x00004366U,
+      0x00008C34U, 0x0000D6E8U, 0x0000398CU, 0x00006350U, 0x0000EF55U, 0x0000B589U, 0x00005AEDU, 0x00000031U,
+      0x00004AF6U, 0x0000102AU, 0x0000FF4EU, 0x0000A592U, 0x00002997U, 0x0000734BU, 0x00009C2FU, 0x0000C6F3U
+    },
+    {
+      0x00000000U, 0x00001CBBU, 0x00003976U, 0x000025CDU, 0x000072ECU, 0x00006E57U, 0x00004B9AU, 0x00005721U,
+      0x0000E5D8U, 0x0000F963U, 0x0000DCAEU, 0x0000C015U, 0x00009734U, 0x00008B8FU, 0x0000AE42U, 0x0000B2F9U,
+      0x0000C3A1U, 0x0000DF1AU, 0x0000FAD7U, 0x0000E66CU, 0x0000B14DU, 0x0000ADF6U, 0x0000883BU, 0x00009480U,
+      0x00002679U, 0x00003AC2U, 0x00001F0FU, 0x000003B4U, 0x00005495U, 0x0000482EU, 0x00006DE3U, 0x00007158U,
+      0x00008F53U, 0x000093E8U, 0x0000B625U, 0x0000AA9EU, 0x0000FDBFU, 0x0000E104U, 0x0000C4C9U, 0x0000D872U,
+      0x00006A8BU, 0x00007630U, 0x000053FDU, 0x00004F46U, 0x00001867U, 0x000004DCU, 0x00002111U, 0x00003DAAU,
+      0x00004CF2U, 0x00005049U, 0x00007584U, 0x0000693FU, 0x00003E1EU, 0x000022A5U, 0x00000768U, 0x00001BD3U,
+      0x0000A92AU, 0x0000B591U, 0x0000905CU, 0x00008CE7U, 0x0000DBC6U, 0x0000C77DU, 0x0000E2B0U, 0x0000FE0BU,
+      0x000016B7U, 0x00000A0CU, 0x00002FC1U, 0x0000337AU, 0x0000645BU, 0x000078E0U, 0x00005D2DU, 0x00004196U,
+      0x0000F36FU, 0x0000EFD4U, 0x0000CA19U, 0x0000D6A2U, 0x00008183U, 0x00009D38U, 0x0000B8F5U, 0x0000A44EU,
+      0x0000D516U, 0x0000C9ADU, 0x0000EC60U, 0x0000F0DBU, 0x0000A7FAU, 0x0000BB41U, 0x00009E8CU, 0x00008237U,
+      0x000030CEU, 0x00002C75U, 0x000009B8U, 0x00001503U, 0x00004222U, 0x00005E99U, 0x00007B54U, 0x000067EFU,
+      0x000099E4U, 0x0000855FU, 0x0000A092U, 0x0000BC29U, 0x0000EB08U, 0x0000F7B3U, 0x0000D27EU, 0x0000CEC5U,
+      0x00007C3CU, 0x00006087U, 0x0000454AU, 0x000059F1U, 0x00000ED0U, 0x0000126BU, 0x000037A6U, 0x00002B1DU,
+      0x00005A45U, 0x000046FEU, 0x00006333U, 0x00007F88U, 0x000028A9U, 0x00003412U, 0x000011DFU, 0x00000D64U,
+      0x0000BF9DU, 0x0000A326U, 0x000086EBU, 0x00009A50U, 0x0000CD71U, 0x0000D1CAU, 0x0000F407U, 0x0000E8BCU,
+      0x00002D6EU, 0x000031D5U, 0x00001418U, 0x000008A3U, 0x00005F82U, 0x00004339U, 0x000066F4U, 0x00007A4FU,
+      0x0000C8B6U, 0x0000D40DU, 0x0000F1C0U, 0x0000ED7BU, 0x0000BA5AU, 0x0000A6E1U, 0x0000832CU, 0x00009F97U,
+      0x0000EECFU, 0x0000F274U, 0x0000D7B9U, 0x0000CB02U, 0x00009C23U, 0x00008098U, 0x0000A555U, 0x0000B9EEU,
+      0x00000B17U, 0x000017ACU, 0x00003261U, 0x00002EDAU, 0x000079FBU, 0x00006540U, 0x0000408DU, 0x00005C36U,
+      0x0000A23DU, 0x0000BE86U, 0x00009B4BU, 0x000087F0U, 0x0000D0D1U, 0x0000CC6AU, 0x0000E9A7U, 0x0000F51CU,
+      0x000047E5U, 0x00005B5EU, 0x00007E93U, 0x00006228U, 0x00003509U, 0x000029B2U, 0x00000C7FU, 0x000010C4U,
+      0x0000619CU, 0x00007D27U, 0x000058EAU, 0x00004451U, 0x00001370U, 0x00000FCBU, 0x00002A06U, 0x000036BDU,
+      0x00008444U, 0x000098FFU, 0x0000BD32U, 0x0000A189U, 0x0000F6A8U, 0x0000EA13U, 0x0000CFDEU, 0x0000D365U,
+      0x00003BD9U, 0x00002762U, 0x000002AFU, 0x00001E14U, 0x00004935U, 0x0000558EU, 0x00007043U, 0x00006CF8U,
+      0x0000DE01U, 0x0000C2BAU, 0x0000E777U, 0x0000FBCCU, 0x0000ACEDU, 0x0000B056U, 0x0000959BU, 0x00008920U,
+      0x0000F878U, 0x0000E4C3U, 0x0000C10EU, 0x0000DDB5U, 0x00008A94U, 0x0000962FU, 0x0000B3E2U, 0x0000AF59U,
+      0x00001DA0U, 0x0000011BU, 0x000024D6U, 0x0000386DU, 0x00006F4CU, 0x000073F7U, 0x0000563AU, 0x00004A81U,
+      0x0000B48AU, 0x0000A831U, 0x00008DFCU, 0x00009147U, 0x0000C666U, 0x0000DADDU, 0x0000FF10U, 0x0000E3ABU,
+      0x00005152U, 0x00004DE9U, 0x00006824U, 0x0000749FU, 0x000023BEU, 0x00003F05U, 0x00001AC8U, 0x00000673U,
+      0x0000772BU, 0x00006B90U, 0x00004E5DU, 0x000052E6U, 0x000005C7U, 0x0000197CU, 0x00003CB1U, 0x0000200AU,
+      0x000092F3U, 0x00008E48U, 0x0000AB85U, 0x0000B73EU, 0x0000E01FU, 0x0000FCA4U, 0x0000D969U, 0x0000C5D2U
+    },
+    {
+      0x00000000U, 0x00000B44U, 0x00001688U, 0x00001DCCU, 0x00002D10U, 0x00002654U, 0x00003B98U, 0x000030DCU,
+      0x00005A20U, 0x00005164U, 0x00004CA8U, 0x000047ECU, 0x00007730U, 0x00007C74U, 0x000061B8U, 0x00006AFCU,
+      0x0000B440U, 0x0000BF04U, 0x0000A2C8U, 0x0000A98CU, 0x00009950U, 0x00009214U, 0x00008FD8U, 0x0000849CU,
+      0x0000EE60U, 0x0000E524U, 0x0000F8E8U, 0x0000F3ACU, 0x0000C370U, 0x0000C834U, 0x0000D5F8U, 0x0000DEBCU,
+      0x00006091U, 0x00006BD5U, 0x00007619U, 0x00007D5DU, 0x00004D81U, 0x000046C5U, 0x00005B09U, 0x0000504DU,
+      0x00003AB1U, 0x000031F5U, 0x00002C39U, 0x0000277DU, 0x000017A1U, 0x00001CE5U, 0x00000129U, 0x00000A6DU,
+      0x0000D4D1U, 0x0000DF95U, 0x0000C259U, 0x0000C91DU, 0x0000F9C1U, 0x0000F285U, 0x0000EF49U, 0x0000E40DU,
+      0x00008EF1U, 0x000085B5U, 0x00009879U, 0x0000933DU, 0x0000A3E1U, 0x0000A8A5U, 0x0000B569U, 0x0000BE2DU,
+      0x0000C122U, 0x0000CA66U, 0x0000D7AAU, 0x0000DCEEU, 0x0000EC32U, 0x0000E776U, 0x0000FABAU, 0x0000F1FEU,
+      0x00009B02U, 0x00009046U, 0x00008D8AU, 0x000086CEU, 0x0000B612U, 0x0000BD56U, 0x0000A09AU, 0x0000ABDEU,
+      0x00007562U, 0x00007E26U, 0x000063EAU, 0x000068AEU, 0x00005872U, 0x00005336U, 0x00004EFAU, 0x000045BEU,
+      0x00002F42U, 0x00002406U, 0x000039CAU, 0x0000328EU, 0x00000252U, 0x00000916U, 0x000014DAU, 0x00001F9EU,
+      0x0000A1B3U, 0x0000AAF7U, 0x0000B73BU, 0x0000BC7FU, 0x00008CA3U, 0x000087E7U, 0x00009A2BU, 0x0000916FU,
+      0x0000FB93U, 0x0000F0D7U, 0x0000ED1BU, 0x0000E65FU, 0x0000D683U, 0x0000DDC7U, 0x0000C00BU, 0x0000CB4FU,
+      0x000015F3U, 0x00001EB7U, 0x0000037BU, 0x0000083FU, 0x000038E3U, 0x000033A7U, 0x00002E6BU, 0x0000252FU,
+      0x00004FD3U, 0x00004497U, 0x0000595BU, 0x0000521FU, 0x000062C3U, 0x00006987U, 0x0000744BU, 0x00007F0FU,
+      0x00008A55U, 0x00008111U, 0x00009CDDU, 0x00009799U, 0x0000A745U, 0x0000AC01U, 0x0000B1CDU, 0x0000BA89U,
+      0x0000D075U, 0x0000DB31U, 0x0000C6FDU, 0x0000CDB9U, 0x0000FD65U, 0x0000F621U, 0x0000EBEDU, 0x0000E0A9U,
+      0x00003E15U, 0x00003551U, 0x0000289DU, 0x000023D9U, 0x00001305U, 0x00001841U, 0x0000058DU, 0x00000EC9U,
+      0x00006435U, 0x00006F71U, 0x000072BDU, 0x000079F9U, 0x00004925U, 0x00004261U, 0x00005FADU, 0x000054E9U,
+      0x0000EAC4U, 0x0000E180U, 0x0000FC4CU, 0x0000F708U, 0x0000C7D4U, 0x0000CC90U, 0x0000D15CU, 0x0000DA18U,
+      0x0000B0E4U, 0x0000BBA0U, 0x0000A66CU, 0x0000AD28U, 0x00009DF4U, 0x000096B0U, 0x00008B7CU, 0x00008038U,
+      0x00005E84U, 0x000055C0U, 0x0000480CU, 0x00004348U, 0x00007394U, 0x000078D0U, 0x0000651CU, 0x00006E58U,
+      0x000004A4U, 0x00000FE0U, 0x0000122CU, 0x00001968U, 0x000029B4U, 0x000022F0U, 0x00003F3CU, 0x00003478U,
+      0x00004B77U, 0x00004033U, 0x00005DFFU, 0x000056BBU, 0x00006667U, 0x00006D23U, 0x000070EFU, 0x00007BABU,
+      0x00001157U, 0x00001A13U, 0x000007DFU, 0x00000C9BU, 0x00003C47U, 0x00003703U, 0x00002ACFU, 0x0000218BU,
+      0x0000FF37U, 0x0000F473U, 0x0000E9BFU, 0x0000E2FBU, 0x0000D227U, 0x0000D963U, 0x0000C4AFU, 0x0000CFEBU,
+      0x0000A517U, 0x0000AE53U, 0x0000B39FU, 0x0000B8DBU, 0x00008807U, 0x00008343U, 0x00009E8FU, 0x000095CBU,
+      0x00002BE6U, 0x000020A2U, 0x00003D6EU, 0x0000362AU, 0x000006F6U, 0x00000DB2U, 0x0000107EU, 0x00001B3AU,
+      0x000071C6U, 0x00007A82U, 0x0000674EU, 0x00006C0AU, 0x00005CD6U, 0x00005792U, 0x00004A5EU, 0x0000411AU,
+      0x00009FA6U, 0x000094E2U, 0x0000892EU, 0x0000826AU, 0x0000B2B6U, 0x0000B9F2U, 0x0000A43EU, 0x0000AF7AU,
+      0x0000C586U, 0x0000CEC2U, 0x0000D30EU, 0x0000D84AU, 0x0000E896U, 0x0000E3D2U, 0x0000FE1EU, 0x0000F55AU
+    },
+    {
+      0x00000000U, 0x0000042BU, 0x00000856U, 0x00000C7DU, 0x000010ACU, 0x00001487U, 0x000018FAU, 0x00001CD1U,
+      0x00002158U, 0x00002573U, 0x0000290EU, 0x00002D25U, 0x000031F4U, 0x000035DFU, 0x000039A2U, 0x00003D89U,
+      0x000042B0U, 0x0000469BU, 0x00004AE6U, 0x00004ECDU, 0x0000521CU, 0x00005637U, 0x00005A4AU, 0x00005E61U,
+      0x000063E8U, 0x000067C3U, 0x00006BBEU, 0x00006F95U, 0x00007344U, 0x0000776FU, 0x00007B12U, 0x00007F39U,
+      0x00008560U, 0x0000814BU, 0x00008D36U, 0x0000891DU, 0x000095CCU, 0x000091E7U, 0x00009D9AU, 0x000099B1U,
+      0x0000A438U, 0x0000A013U, 0x0000AC6EU, 0x0000A845U, 0x0000B494U, 0x0000B0BFU, 0x0000BCC2U, 0x0000B8E9U,
+      0x0000C7D0U, 0x0000C3FBU, 0x0000CF86U, 0x0000CBADU, 0x0000D77CU, 0x0000D357U, 0x0000DF2AU, 0x0000DB01U,
+      0x0000E688U, 0x0000E2A3U, 0x0000EEDEU, 0x0000EAF5U, 0x0000F624U, 0x0000F20FU, 0x0000FE72U, 0x0000FA59U,
+      0x000002D1U, 0x000006FAU, 0x00000A87U, 0x00000EACU, 0x0000127DU, 0x00001656U, 0x00001A2BU, 0x00001E00U,
+      0x00002389U, 0x000027A2U, 0x00002BDFU, 0x00002FF4U, 0x00003325U, 0x0000370EU, 0x00003B73U, 0x00003F58U,
+      0x00004061U, 0x0000444AU, 0x00004837U, 0x00004C1CU, 0x000050CDU, 0x000054E6U, 0x0000589BU, 0x00005CB0U,
+      0x00006139U, 0x00006512U, 0x0000696FU, 0x00006D44U, 0x00007195U, 0x000075BEU, 0x000079C3U, 0x00007DE8U,
+      0x000087B1U, 0x0000839AU, 0x00008FE7U, 0x00008BCCU, 0x0000971DU, 0x00009336U, 0x00009F4BU, 0x00009B60U,
+      0x0000A6E9U, 0x0000A2C2U, 0x0000AEBFU, 0x0000AA94U, 0x0000B645U, 0x0000B26EU, 0x0000BE13U, 0x0000BA38U,
+      0x0000C501U, 0x0000C12AU, 0x0000CD57U, 0x0000C97CU, 0x0000D5ADU, 0x0000D186U, 0x0000DDFBU, 0x0000D9D0U,
+      0x0000E459U, 0x0000E072U, 0x0000EC0FU, 0x0000E824U, 0x0000F4F5U, 0x0000F0DEU, 0x0000FCA3U, 0x0000F888U,
+      0x000005A2U, 0x00000189U, 0x00000DF4U, 0x000009DFU, 0x0000150EU, 0x00001125U, 0x00001D58U, 0x00001973U,
+      0x000024FAU, 0x000020D1U, 0x00002CACU, 0x00002887U, 0x00003456U, 0x0000307DU, 0x00003C00U, 0x0000382BU,
+      0x00004712U, 0x00004339U, 0x00004F44U, 0x00004B6FU, 0x000057BEU, 0x00005395U, 0x00005FE8U, 0x00005BC3U,
+      0x0000664AU, 0x00006261U, 0x00006E1CU, 0x00006A37U, 0x000076E6U, 0x000072CDU, 0x00007EB0U, 0x00007A9BU,
+      0x000080C2U, 0x000084E9U, 0x00008894U, 0x00008CBFU, 0x0000906EU, 0x00009445U, 0x00009838U, 0x00009C13U,
+      0x0000A19AU, 0x0000A5B1U, 0x0000A9CCU, 0x0000ADE7U, 0x0000B136U, 0x0000B51DU, 0x0000B960U, 0x0000BD4BU,
+      0x0000C272U, 0x0000C659U, 0x0000CA24U, 0x0000CE0FU, 0x0000D2DEU, 0x0000D6F5U, 0x0000DA88U, 0x0000DEA3U,
+      0x0000E32AU, 0x0000E701U, 0x0000EB7CU, 0x0000EF57U, 0x0000F386U, 0x0000F7ADU, 0x0000FBD0U, 0x0000FFFBU,
+      0x00000773U, 0x00000358U, 0x00000F25U, 0x00000B0EU, 0x000017DFU, 0x000013F4U, 0x00001F89U, 0x00001BA2U,
+      0x0000262BU, 0x00002200U, 0x00002E7DU, 0x00002A56U, 0x00003687U, 0x000032ACU, 0x00003ED1U, 0x00003AFAU,
+      0x000045C3U, 0x000041E8U, 0x00004D95U, 0x000049BEU, 0x0000556FU, 0x00005144U, 0x00005D39U, 0x00005912U,
+      0x0000649BU, 0x000060B0U, 0x00006CCDU, 0x000068E6U, 0x00007437U, 0x0000701CU, 0x00007C61U, 0x0000784AU,
+      0x00008213U, 0x00008638U, 0x00008A45U, 0x00008E6EU, 0x000092BFU, 0x00009694U, 0x00009AE9U, 0x00009EC2U,
+      0x0000A34BU, 0x0000A760U, 0x0000AB1DU, 0x0000AF36U, 0x0000B3E7U, 0x0000B7CCU, 0x0000BBB1U, 0x0000BF9AU,
+      0x0000C0A3U, 0x0000C488U, 0x0000C8F5U, 0x0000CCDEU, 0x0000D00FU, 0x0000D424U, 0x0000D859U, 0x0000DC72U,
+      0x0000E1FBU, 0x0000E5D0U, 0x0000E9ADU, 0x0000ED86U, 0x0000F157U, 0x0000F57CU, 0x0000F901U, 0x0000FD2AU
+    },
+    {
+      0x00000000U, 0x00009FD5U, 0x000037BBU, 0x0000A86EU, 0x00006F76U, 0x0000F0A3U, 0x000058CDU, 0x0000C718U,
+      0x0000DEECU, 0x00004139U, 0x0000E957U, 0x00007682U, 0x0000B19AU, 0x00002E4FU, 0x00008621U, 0x000019F4U,
+      0x0000B5C9U, 0x00002A1CU, 0x00008272U, 0x00001DA7U, 0x0000DABFU, 0x0000456AU, 0x0000ED04U, 0x000072D1U,
+      0x00006B25U, 0x0000F4F0U, 0x00005C9EU, 0x0000C34BU, 0x00000453U, 0x00009B86U, 0x000033E8U, 0x0000AC3DU,
+      0x00006383U, 0x0000FC56U, 0x00005438U, 0x0000CBEDU, 0x00000CF5U, 0x00009320U, 0x00003B4EU, 0x0000A49BU,
+      0x0000BD6FU, 0x000022BAU, 0x00008AD4U, 0x00001501U, 0x0000D219U, 0x00004DCCU, 0x0000E5A2U, 0x00007A77U,
+      0x0000D64AU, 0x0000499FU, 0x0000E1F1U, 0x00007E24U, 0x0000B93CU, 0x000026E9U, 0x00008E87U, 0x00001152U,
+      0x000008A6U, 0x00009773U, 0x00003F1DU, 0x0000A0C8U, 0x000067D0U, 0x0000F805U, 0x0000506BU, 0x0000CFBEU,
+      0x0000C706U, 0x000058D3U, 0x0000F0BDU, 0x00006F68U, 0x0000A870U, 0x000037A5U, 0x00009FCBU, 0x0000001EU,
+      0x000019EAU, 0x0000863FU, 0x00002E51U, 0x0000B184U, 0x0000769CU, 0x0000E949U, 0x00004127U, 0x0000DEF2U,
+      0x000072CFU, 0x0000ED1AU, 0x00004574U, 0x0000DAA1U, 0x00001DB9U, 0x0000826CU, 0x00002A02U, 0x0000B5D7U,
+      0x0000AC23U, 0x000033F6U, 0x00009B98U, 0x0000044DU, 0x0000C355U, 0x00005C80U, 0x0000F4EEU, 0x00006B3BU,
+      0x0000A485U, 0x00003B50U, 0x0000933EU, 0x00000CEBU, 0x0000CBF3U, 0x00005426U, 0x0000FC48U, 0x0000639DU,
+      0x00007A69U, 0x0000E5BCU, 0x00004DD2U, 0x0000D207U, 0x0000151FU, 0x00008ACAU, 0x000022A4U, 0x0000BD71U,
+      0x0000114CU, 0x00008E99U, 0x000026F7U, 0x0000B922U, 0x00007E3AU, 0x0000E1EFU, 0x00004981U, 0x0000D654U,
+      0x0000CFA0U, 0x00005075U, 0x0000F81BU, 0x000067CEU, 0x0000A0D6U, 0x00003F03U, 0x0000976DU, 0x000008B8U,
+      0x0000861DU, 0x000019C8U, 0x0000B1A6U, 0x00002E73U, 0x0000E96BU, 0x000076BEU, 0x0000DED0U, 0x00004105U,
+      0x000058F1U, 0x0000C724U, 0x00006F4AU, 0x0000F09FU, 0x00003787U, 0x0000A852U, 0x0000003CU, 0x00009FE9U,
+      0x000033D4U, 0x0000AC01U, 0x0000046FU, 0x00009BBAU, 0x00005CA2U, 0x0000C377U, 0x00006B19U, 0x0000F4CCU,
+      0x0000ED38U, 0x000072EDU, 0x0000DA83U, 0x00004556U, 0x0000824EU, 0x00001D9BU, 0x0000B5F5U, 0x00002A20U,
+      0x0000E59EU, 0x00007A4BU, 0x0000D225U, 0x00004DF0U, 0x00008AE8U, 0x0000153DU, 0x0000BD53U, 0x00002286U,
+      0x00003B72U, 0x0000A4A7U, 0x00000CC9U, 0x0000931CU, 0x00005404U, 0x0000CBD1U, 0x000063BFU, 0x0000FC6AU,
+      0x00005057U, 0x0000CF82U, 0x000067ECU, 0x0000F839U, 0x00003F21U, 0x0000A0F4U, 0x0000089AU, 0x0000974FU,
+      0x00008EBBU, 0x0000116EU, 0x0000B900U, 0x000026D5U, 0x0000E1CDU, 0x00007E18U, 0x0000D676U, 0x000049A3U,
+      0x0000411BU, 0x0000DECEU, 0x000076A0U, 0x0000E975U, 0x00002E6DU, 0x0000B1B8U, 0x000019D6U, 0x00008603U,
+      0x00009FF7U, 0x00000022U, 0x0000A84CU, 0x00003799U, 0x0000F081U, 0x00006F54U, 0x0000C73AU, 0x000058EFU,
+      0x0000F4D2U, 0x00006B07U, 0x0000C369U, 0x00005CBCU, 0x00009BA4U, 0x00000471U, 0x0000AC1FU, 0x000033CAU,
+      0x00002A3EU, 0x0000B5EBU, 0x00001D85U, 0x00008250U, 0x00004548U, 0x0000DA9DU, 0x000072F3U, 0x0000ED26U,
+      0x00002298U, 0x0000BD4DU, 0x00001523U, 0x00008AF6U, 0x00004DEEU, 0x0000D23BU, 0x00007A55U, 0x0000E580U,
+      0x0000FC74U, 0x000063A1U, 0x0000CBCFU, 0x0000541AU, 0x00009302U, 0x00000CD7U, 0x0000A4B9U, 0x00003B6CU,
+      0x00009751U, 0x00000884U, 0x0000A0EAU, 0x00003F3FU, 0x0000F827U, 0x000067F2U, 0x0000CF9CU, 0x00005049U,
+      0x000049BDU, 0x0000D668U, 0x00007E06U, 0x0000E1D3U, 0x000026CBU, 0x0000B91EU, 0x00001170U, 0x00008EA5U
+    },
+    {
+      0x00000000U, 0x000081BFU, 0x00000B6FU, 0x00008AD0U, 0x000016DEU, 0x00009761U, 0x00001DB1U, 0x00009C0EU,
+      0x00002DBCU, 0x0000AC03U, 0x000026D3U, 0x0000A76CU, 0x00003B62U, 0x0000BADDU, 0x0000300DU, 0x0000B1B2U,
+      0x00005B78U, 0x0000DAC7U, 0x00005017U, 0x0000D1A8U, 0x00004DA6U, 0x0000CC19U, 0x000046C9U, 0x0000C776U,
+      0x000076C4U, 0x0000F77BU, 0x00007DABU, 0x0000FC14U, 0x0000601AU, 0x0000E1A5U, 0x00006B75U, 0x0000EACAU,
+      0x0000B6F0U, 0x0000374FU, 0x0000BD9FU, 0x00003C20U, 0x0000A02EU, 0x00002191U, 0x0000AB41U, 0x00002AFEU,
+      0x00009B4CU, 0x00001AF3U, 0x00009023U, 0x0000119CU, 0x00008D92U, 0x00000C2DU, 0x000086FDU, 0x00000742U,
+      0x0000ED88U, 0x00006C37U, 0x0000E6E7U, 0x00006758U, 0x0000FB56U, 0x00007AE9U, 0x0000F039U, 0x00007186U,
+      0x0000C034U, 0x0000418BU, 0x0000CB5BU, 0x00004AE4U, 0x0000D6EAU, 0x00005755U, 0x0000DD85U, 0x00005C3AU,
+      0x000065F1U, 0x0000E44EU, 0x00006E9EU, 0x0000EF21U, 0x0000732FU, 0x0000F290U, 0x00007840U, 0x0000F9FFU,
+      0x0000484DU, 0x0000C9F2U, 0x00004322U, 0x0000C29DU, 0x00005E93U, 0x0000DF2CU, 0x000055FCU, 0x0000D443U,
+      0x00003E89U, 0x0000BF36U, 0x000035E6U, 0x0000B459U, 0x00002857U, 0x0000A9E8U, 0x00002338U, 0x0000A287U,
+      0x00001335U, 0x0000928AU, 0x0000185AU, 0x000099E5U, 0x000005EBU, 0x00008454U, 0x00000E84U, 0x00008F3BU,
+      0x0000D301U, 0x000052BEU, 0x0000D86EU, 0x000059D1U, 0x0000C5DFU, 0x00004460U, 0x0000CEB0U, 0x00004F0FU,
+      0x0000FEBDU, 0x00007F02U, 0x0000F5D2U, 0x0000746DU, 0x0000E863U, 0x000069DCU, 0x0000E30CU, 0x000062B3U,
+      0x00008879U, 0x000009C6U, 0x00008316U, 0x000002A9U, 0x00009EA7U, 0x00001F18U, 0x000095C8U, 0x00001477U,
+      0x0000A5C5U, 0x0000247AU, 0x0000AEAAU, 0x00002F15U, 0x0000B31BU, 0x000032A4U, 0x0000B874U, 0x000039CBU,
+      0x0000CBE2U, 0x00004A5DU, 0x0000C08DU, 0x00004132U, 0x0000DD3CU, 0x00005C83U, 0x0000D653U, 0x000057ECU,
+      0x0000E65EU, 0x000067E1U, 0x0000ED31U, 0x00006C8EU, 0x0000F080U, 0x0000713FU, 0x0000FBEFU, 0x00007A50U,
+      0x0000909AU, 0x00001125U, 0x00009BF5U, 0x00001A4AU, 0x00008644U, 0x000007FBU, 0x00008D2BU, 0x00000C94U,
+      0x0000BD26U, 0x00003C99U, 0x0000B649U, 0x000037F6U, 0x0000ABF8U, 0x00002A47U, 0x0000A097U, 0x00002128U,
+      0x00007D12U, 0x0000FCADU, 0x0000767DU, 0x0000F7C2U, 0x00006BCCU, 0x0000EA73U, 0x000060A3U, 0x0000E11CU,
+      0x000050AEU, 0x0000D111U, 0x00005BC1U, 0x0000DA7EU, 0x00004670U, 0x0000C7CFU, 0x00004D1FU, 0x0000CCA0U,
+      0x0000266AU, 0x0000A7D5U, 0x00002D05U, 0x0000ACBAU, 0x000030B4U, 0x0000B10BU, 0x00003BDBU, 0x0000BA64U,
+      0x00000BD6U, 0x00008A69U, 0x000000B9U, 0x00008106U, 0x00001D08U, 0x00009CB7U, 0x00001667U, 0x000097D8U,
+      0x0000AE13U, 0x00002FACU, 0x0000A57CU, 0x000024C3U, 0x0000B8CDU, 0x00003972U, 0x0000B3A2U, 0x0000321DU,
+      0x000083AFU, 0x00000210U, 0x000088C0U, 0x0000097FU, 0x00009571U, 0x000014CEU, 0x00009E1EU, 0x00001FA1U,
+      0x0000F56BU, 0x000074D4U, 0x0000FE04U, 0x00007FBBU, 0x0000E3B5U, 0x0000620AU, 0x0000E8DAU, 0x00006965U,
+      0x0000D8D7U, 0x00005968U, 0x0000D3B8U, 0x00005207U, 0x0000CE09U, 0x00004FB6U, 0x0000C566U, 0x000044D9U,
+      0x000018E3U, 0x0000995CU, 0x0000138CU, 0x00009233U, 0x00000E3DU, 0x00008F82U, 0x00000552U, 0x000084EDU,
+      0x0000355FU, 0x0000B4E0U, 0x00003E30U, 0x0000BF8FU, 0x00002381U, 0x0000A23EU, 0x000028EEU, 0x0000A951U,
+      0x0000439BU, 0x0000C224U, 0x000048F4U, 0x0000C94BU, 0x00005545U, 0x0000D4FAU, 0x00005E2AU, 0x0000DF95U,
+      0x00006E27U, 0x0000EF98U, 0x00006548U, 0x0000E4F7U, 0x000078F9U, 0x0000F946U, 0x00007396U, 0x0000F229U
+    }
+  },
+  {  // Check code type E: CRC16 with polynomial 0x8005
+    {
+      0x00000000U, 0x0000C0C1U, 0x0000C181U, 0x00000140U, 0x0000C301U, 0x000003C0U, 0x00000280U, 0x0000C241U,
+      0x0000C601U, 0x000006C0U, 0x00000780U, 0x0000C741U, 0x00000500U, 0x0000C5C1U, 0x0000C481U, 0x00000440U,
+      0x0000CC01U, 0x00000CC0U, 0x00000D80U, 0x0000CD41U, 0x00000F00U, 0x0000CFC1U, 0x0000CE81U, 0x00000E40U,
+      0x00000A00U, 0x0000CAC1U, 0x0000CB81U, 0x00000B40U, 0x0000C901U, 0x000009C0U, 0x00000880U, 0x0000C841U,
+      0x0000D801U, 0x000018C0U, 0x00001980U, 0x0000D941U, 0x00001B00U, 0x0000DBC1U, 0x0000DA81U, 0x00001A40U,
+      0x00001E00U, 0x0000DEC1U, 0x0000DF81U, 0x00001F40U, 0x0000DD01U, 0x00001DC0U, 0x00001C80U, 0x0000DC41U,
+      0x00001400U, 0x0000D4C1U, 0x0000D581U, 0x00001540U, 0x0000D701U, 0x000017C0U, 0x00001680U, 0x0000D641U,
+      0x0000D201U, 0x000012C0U, 0x00001380U, 0x0000D341U, 0x00001100U, 0x0000D1C1U, 0x0000D081U, 0x00001040U,
+      0x0000F001U, 0x000030C0U, 0x00003180U, 0x0000F141U, 0x00003300U, 0x0000F3C1U, 0x0000F281U, 0x00003240U,
+      0x00003600U, 0x0000F6C1U, 0x0000F781U, 0x00003740U, 0x0000F501U, 0x000035C0U, 0x00003480U, 0x0000F441U,
+      0x00003C00U, 0x0000FCC1U, 0x0000FD81U, 0x00003D40U, 0x0000FF01U, 0x00003FC0U, 0x00003E80U, 0x0000FE41U,
+      0x0000FA01U, 0x00003AC0U, 0x00003B80U, 0x0000FB41U, 0x00003900U, 0x0000F9C1U, 0x0000F881U, 0x00003840U,
+      0x00002800U, 0x0000E8C1U, 0x0000E981U, 0x00002940U, 0x0000EB01U, 0x00002BC0U, 0x00002A80U, 0x0000EA41U,
+      0x0000EE01U, 0x00002EC0U, 0x00002F80U, 0x0000EF41U, 0x00002D00U, 0x0000EDC1U, 0x0000EC81U, 0x00002C40U,
+      0x0000E401U, 0x000024C0U, 0x00002580U, 0x0000E541U, 0x00002700U, 0x0000E7C1U, 0x0000E681U, 0x00002640U,
+      0x00002200U, 0x0000E2C1U, 0x0000E381U, 0x00002340U, 0x0000E101U, 0x000021C0U, 0x00002080U, 0x0000E041U,
+      0x0000A001U, 0x000060C0U, 0x00006180U, 0x0000A141U, 0x00006300U, 0x0000A3C1U, 0x0000A281U, 0x00006240U,
+      0x00006600U, 0x0000A6C1U, 0x0000A781U, 0x00006740U, 0x0000A501U, 0x000065C0U, 0x00006480U, 0x0000A441U,
+      0x00006C00U, 0x0000ACC1U, 0x0000AD81U, 0x00006D40U, 0x0000AF01U, 0x00006FC0U, 0x00006E80U, 0x0000AE41U,
+      0x0000AA01U, 0x00006AC0U, 0x00006B80U, 0x0000AB41U, 0x00006900U, 0x0000A9C1U, 0x0000A881U, 0x00006840U,
+      0x00007800U, 0x0000B8C1U, 0x0000B981U, 0x00007940U, 0x0000BB01U, 0x00007BC0U, 0x00007A80U, 0x0000BA41U,
+      0x0000BE01U, 0x00007EC0U, 0x00007F80U, 0x0000BF41U, 0x00007D00U, 0x0000BDC1U, 0x0000BC81U, 0x00007C40U,
+      0x0000B401U, 0x000074C0U, 0x00007580U, 0x0000B541U, 0x00007700U, 0x0000B7C1U, 0x0000B681U, 0x00007640U,
+      0x00007200U, 0x0000B2C1U, 0x0000B381U, 0x00007340U, 0x0000B101U, 0x000071C0U, 0x00007080U, 0x0000B041U,
+      0x00005000U, 0x000090C1U, 0x00009181U, 0x00005140U, 0x00009301U, 0x000053C0U, 0x00005280U, 0x00009241U,
+      0x00009601U, 0x000056C0U, 0x00005780U, 0x00009741U, 0x00005500U, 0x000095C1U, 0x00009481U, 0x00005440U,
+      0x00009C01U, 0x00005CC0U, 0x00005D80U, 0x00009D41U, 0x00005F00U, 0x00009FC1U, 0x00009E81U, 0x00005E40U,
+      0x00005A00U, 0x00009AC1U, 0x00009B81U, 0x00005B40U, 0x00009901U, 0x000059C0U, 0x00005880U, 0x00009841U,
+      0x00008801U, 0x000048C0U, 0x00004980U, 0x00008941U, 0x00004B00U, 0x00008BC1U, 0x00008A81U, 0x00004A40U,
+      0x00004E00U, 0x00008EC1U, 0x00008F81U, 0x00004F40U, 0x00008D01U, 0x00004DC0U, 0x00004C80U, 0x00008C41U,
+      0x00004400U, 0x000084C1U, 0x00008581U, 0x00004540U, 0x00008701U, 0x000047C0U, 0x00004680U, 0x00008641U,
+      0x00008201U, 0x000042C0U, 0x00004380U, 0x00008341U, 0x00004100U, 0x000081C1U, 0x00008081U, 0x00004040U
+    },
+    {
+      0x00000000U, 0x00009001U, 0x00006001U, 0x0000F000U, 0x0000C002U, 0x00005003U, 0x0000A003U, 0x00003002U,
+      0x0000C007U, 0x00005006U, 0x0000A006U, 0x00003007U, 0x00000005U, 0x00009004U, 0x00006004U, 0x0000F005U,
+      0x0000C00DU, 0x0000500CU, 0x0000A00CU, 0x0000300DU, 0x0000000FU, 0x0000900EU, 0x0000600EU, 0x0000F00FU,
+      0x0000000AU, 0x0000900BU, 0x0000600BU, 0x0000F00AU, 0x0000C008U, 0x00005009U, 0x0000A009U, 0x00003008U,
+      0x0000C019U, 0x00005018U, 0x0000A018U, 0x00003019U, 0x0000001BU, 0x0000901AU, 0x0000601AU, 0x0000F01BU,
+      0x0000001EU, 0x0000901FU, 0x0000601FU, 0x0000F01EU, 0x0000C01CU, 0x0000501DU, 0x0000A01DU, 0x0000301CU,
+      0x00000014U, 0x00009015U, 0x00006015U, 0x0000F014U, 0x0000C016U, 0x00005017U, 0x0000A017U, 0x00003016U,
+      0x0000C013U, 0x00005012U, 0x0000A012U, 0x00003013U, 0x00000011U, 0x00009010U, 0x00006010U, 0x0000F011U,
+      0x0000C031U, 0x00005030U, 0x0000A030U, 0x00003031U, 0x00000033U, 0x00009032U, 0x00006032U, 0x0000F033U,
+      0x00000036U, 0x00009037U, 0x00006037U, 0x0000F036U, 0x0000C034U, 0x00005035U, 0x0000A035U, 0x00003034U,
+      0x0000003CU, 0x0000903DU, 0x0000603DU, 0x0000F03CU, 0x0000C03EU, 0x0000503FU, 0x0000A03FU, 0x0000303EU,
+      0x0000C03BU, 0x0000503AU, 0x0000A03AU, 0x0000303BU, 0x00000039U, 0x00009038U, 0x00006038U, 0x0000F039U,
+      0x00000028U, 0x00009029U, 0x00006029U, 0x0000F028U, 0x0000C02AU, 0x0000502BU, 0x0000A02BU, 0x0000302AU,
+      0x0000C02FU, 0x0000502EU, 0x0000A02EU, 0x0000302FU, 0x0000002DU, 0x0000902CU, 0x0000602CU, 0x0000F02DU,
+      0x0000C025U, 0x00005024U, 0x0000A024U, 0x00003025U, 0x00000027U, 0x00009026U, 0x00006026U, 0x0000F027U,
+      0x00000022U, 0x00009023U, 0x00006023U, 0x0000F022U, 0x0000C020U, 0x00005021U, 0x0000A021U, 0x00003020U,
+      0x0000C061U, 0x00005060U, 0x0000A060U, 0x00003061U, 0x00000063U, 0x00009062U, 0x00006062U, 0x0000F063U,
+      0x00000066U, 0x00009067U, 0x00006067U, 0x0000F066U, 0x0000C064U, 0x00005065U, 0x0000A065U, 0x00003064U,
+      0x0000006CU, 0x0000906DU, 0x0000606DU, 0x0000F06CU, 0x0000C06EU, 0x0000506FU, 0x0000A06FU, 0x0000306EU,
+      0x0000C06BU, 0x0000506AU, 0x0000A06AU, 0x0000306BU, 0x00000069U, 0x00009068U, 0x00006068U, 0x0000F069U,
+      0x00000078U, 0x00009079U, 0x00006079U, 0x0000F078U, 0x0000C07AU, 0x0000507BU, 0x0000A07BU, 0x0000307AU,
+      0x0000C07FU, 0x0000507EU, 0x0000A07EU, 0x0000307FU, 0x0000007DU, 0x0000907CU, 0x0000607CU, 0x0000F07DU,
+      0x0000C075U, 0x00005074U, 0x0000A074U, 0x00003075U, 0x00000077U, 0x00009076U, 0x00006076U, 0x0000F077U,
+      0x00000072U, 0x00009073U, 0x00006073U, 0x0000F072U, 0x0000C070U, 0x00005071U, 0x0000A071U, 0x00003070U,
+      0x00000050U, 0x00009051U, 0x00006051U, 0x0000F050U, 0x0000C052U, 0x00005053U, 0x0000A053U, 0x00003052U,
+      0x0000C057U, 0x00005056U, 0x0000A056U, 0x00003057U, 0x00000055U, 0x00009054U, 0x00006054U, 0x0000F055U,
+      0x0000C05DU, 0x0000505CU, 0x0000A05CU, 0x0000305DU, 0x0000005FU, 0x0000905EU, 0x0000605EU, 0x0000F05FU,
+      0x0000005AU, 0x0000905BU, 0x0000605BU, 0x0000F05AU, 0x0000C058U, 0x00005059U, 0x0000A059U, 0x00003058U,
+      0x0000C049U, 0x00005048U, 0x0000A048U, 0x00003049U, 0x0000004BU, 0x0000904AU, 0x0000604AU, 0x0000F04BU,
+      0x0000004EU, 0x0000904FU, 0x0000604FU, 0x0000F04EU, 0x0000C04CU, 0x0000504DU, 0x0000A04DU, 0x0000304CU,
+      0x00000044U, 0x00009045U, 0x00006045U, 0x0000F044U, 0x0000C046U, 0x00005047U, 0x0000A047U, 0x00003046U,
+      0x0000C043U, 0x00005042U, 0x0000A042U, 0x00003043U, 0x00000041U, 0x00009040U, 0x00006040U, 0x0000F041U
+    },
+    {
+      0x00000000U, 0x0000C051U, 0x0000C0A1U, 0x000000F0U, 0x0000C141U, 0x00000110U, 0x000001E0U, 0x0000C1B1U,
+      0x0000C281U, 0x000002D0U, 0x00000220U, 0x0000C271U, 0x000003C0U, 0x0000C391U, 0x0000C361U, 0x00000330U,
+      0x0000C501U, 0x00000550U, 0x000005A0U, 0x0000C5F1U, 0x00000440U, 0x0000C411U, 0x0000C4E1U, 0x000004B0U,
+      0x00000780U, 0x0000C7D1U, 0x0000C721U, 0x00000770U, 0x0000C6C1U, 0x00000690U, 0x00000660U, 0x0000C631U,
+      0x0000CA01U, 0x00000A50U, 0x00000AA0U, 0x0000CAF1U, 0x00000B40U, 0x0000CB11U, 0x0000CBE1U, 0x00000BB0U,
+      0x00000880U, 0x0000C8D1U, 0x0000C821U, 0x00000870U, 0x0000C9C1U, 0x00000990U, 0x00000960U, 0x0000C931U,
+      0x00000F00U, 0x0000CF51U, 0x0000CFA1U, 0x00000FF0U, 0x0000CE41U, 0x00000E10U, 0x00000EE0U, 0x0000CEB1U,
+      0x0000CD81U, 0x00000DD0U, 0x00000D20U, 0x0000CD71U, 0x00000CC0U, 0x0000CC91U, 0x0000CC61U, 0x00000C30U,
+      0x0000D401U, 0x00001450U, 0x000014A0U, 0x0000D4F1U, 0x00001540U, 0x0000D511U, 0x0000D5E1U, 0x000015B0U,
+      0x00001680U, 0x0000D6D1U, 0x0000D621U, 0x00001670U, 0x0000D7C1U, 0x00001790U, 0x00001760U, 0x0000D731U,
+      0x00001100U, 0x0000D151U, 0x0000D1A1U, 0x000011F0U, 0x0000D041U, 0x00001010U, 0x000010E0U, 0x0000D0B1U,
+      0x0000D381U, 0x000013D0U, 0x00001320U, 0x0000D371U, 0x000012C0U, 0x0000D291U, 0x0000D261U, 0x00001230U,
+      0x00001E00U, 0x0000DE51U, 0x0000DEA1U, 0x00001EF0U, 0x0000DF41U, 0x00001F10U, 0x00001FE0U, 0x0000DFB1U,
+      0x0000DC81U, 0x00001CD0U, 0x00001C20U, 0x0000DC71U, 0x00001DC0U, 0x0000DD91U, 0x0000DD61U, 0x00001D30U,
+      0x0000DB01U, 0x00001B50U, 0x00001BA0U, 0x0000DBF1U, 0x00001A40U, 0x0000DA11U, 0x0000DAE1U, 0x00001AB0U,
+      0x00001980U, 0x0000D9D1U, 0x0000D921U, 0x00001970U, 0x0000D8C1U, 0x00001890U, 0x00001860U, 0x0000D831U,
+      0x0000E801U, 0x00002850U, 0x000028A0U, 0x0000E8F1U, 0x00002940U, 0x0000E911U, 0x0000E9E1U, 0x000029B0U,
+      0x00002A80U, 0x0000EAD1U, 0x0000EA21U, 0x00002A70U, 0x0000EBC1U, 0x00002B90U, 0x00002B60U, 0x0000EB31U,
+      0x00002D00U, 0x0000ED51U, 0x0000EDA1U, 0x00002DF0U, 0x0000EC41U, 0x00002C10U, 0x00002CE0U, 0x0000ECB1U,
+      0x0000EF81U, 0x00002FD0U, 0x00002F20U, 0x0000EF71U, 0x00002EC0U, 0x0000EE91U, 0x0000EE61U, 0x00002E30U,
+      0x00002200U, 0x0000E251U, 0x0000E2A1U, 0x000022F0U, 0x0000E341U, 0x00002310U, 0x000023E0U, 0x0000E3B1U,
+      0x0000E081U, 0x000020D0U, 0x00002020U, 0x0000E071U, 0x000021C0U, 0x0000E191U, 0x0000E161U, 0x00002130U,
+      0x0000E701U, 0x00002750U, 0x000027A0U, 0x0000E7F1U, 0x00002640U, 0x0000E611U, 0x0000E6E1U, 0x000026B0U,
+      0x00002580U, 0x0000E5D1U, 0x0000E521U, 0x00002570U, 0x0000E4C1U, 0x00002490U, 0x00002460U, 0x0000E431U,
+      0x00003C00U, 0x0000FC51U, 0x0000FCA1U, 0x00003CF0U, 0x0000FD41U, 0x00003D10U, 0x00003DE0U, 0x0000FDB1U,
+      0x0000FE81U, 0x00003ED0U, 0x00003E20U, 0x0000FE71U, 0x00003FC0U, 0x0000FF91U, 0x0000FF61U, 0x00003F30U,
+      0x0000F901U, 0x00003950U, 0x000039A0U, 0x0000F9F1U, 0x00003840U, 0x0000F811U, 0x0000F8E1U, 0x000038B0U,
+      0x00003B80U, 0x0000FBD1U, 0x0000FB21U, 0x00003B70U, 0x0000FAC1U, 0x00003A90U, 0x00003A60U, 0x0000FA31U,
+      0x0000F601U, 0x00003650U, 0x000036A0U, 0x0000F6F1U, 0x00003740U, 0x0000F711U, 0x0000F7E1U, 0x000037B0U,
+      0x00003480U, 0x0000F4D1U, 0x0000F421U, 0x00003470U, 0x0000F5C1U, 0x00003590U, 0x00003560U, 0x0000F531U,
+      0x00003300U, 0x0000F351U, 0x0000F3A1U, 0x000033F0U, 0x0000F241U, 0x00003210U, 0x000032E0U, 0x0000F2B1U,
+      0x0000F181U, 0x000031D0U, 0x00003120U, 0x0000F171U, 0x000030C0U, 0x0000F091U, 0x0000F061U, 0x00003030U
+    },
+    {
+      0x00000000U, 0x0000FC01U, 0x0000B801U, 0x00004400U, 0x00003001U, 0x0000CC00U, 0x00008800U, 0x00007401U,
+      0x00006002U, 0x00009C03U, 0x0000D803U, 0x00002402U, 0x00005003U, 0x0000AC02U, 0x0000E802U, 0x00001403U,
+      0x0000C004U, 0x00003C05U, 0x00007805U, 0x00008404U, 0x0000F005U, 0x00000C04U, 0x00004804U, 0x0000B405U,
+      0x0000A006U, 0x00005C07U, 0x00001807U, 0x0000E406U, 0x00009007U, 0x00006C06U, 0x00002806U, 0x0000D407U,
+      0x0000C00BU, 0x00003C0AU, 0x0000780AU, 0x0000840BU, 0x0000F00AU, 0x00000C0BU, 0x0000480BU, 0x0000B40AU,
+      0x0000A009U, 0x00005C08U, 0x00001808U, 0x0000E409U, 0x00009008U, 0x00006C09U, 0x00002809U, 0x0000D408U,
+      0x0000000FU, 0x0000FC0EU, 0x0000B80EU, 0x0000440FU, 0x0000300EU, 0x0000CC0FU, 0x0000880FU, 0x0000740EU,
+      0x0000600DU, 0x00009C0CU, 0x0000D80CU, 0x0000240DU, 0x0000500CU, 0x0000AC0DU, 0x0000E80DU, 0x0000140CU,
+      0x0000C015U, 0x00003C14U, 0x00007814U, 0x00008415U, 0x0000F014U, 0x00000C15U, 0x00004815U, 0x0000B414U,
+      0x0000A017U, 0x00005C16U, 0x00001816U, 0x0000E417U, 0x00009016U, 0x00006C17U, 0x00002817U, 0x0000D416U,
+      0x00000011U, 0x0000FC10U, 0x0000B810U, 0x00004411U, 0x00003010U, 0x0000CC11U, 0x00008811U, 0x00007410U,
+      0x00006013U, 0x00009C12U, 0x0000D812U, 0x00002413U, 0x00005012U, 0x0000AC13U, 0x0000E813U, 0x00001412U,
+      0x0000001EU, 0x0000FC1FU, 0x0000B81FU, 0x0000441EU, 0x0000301FU, 0x0000CC1EU, 0x0000881EU, 0x0000741FU,
+      0x0000601CU, 0x00009C1DU, 0x0000D81DU, 0x0000241CU, 0x0000501DU, 0x0000AC1CU, 0x0000E81CU, 0x0000141DU,
+      0x0000C01AU, 0x00003C1BU, 0x0000781BU, 0x0000841AU, 0x0000F01BU, 0x00000C1AU, 0x0000481AU, 0x0000B41BU,
+      0x0000A018U, 0x00005C19U, 0x00001819U, 0x0000E418U, 0x00009019U, 0x00006C18U, 0x00002818U, 0x0000D419U,
+      0x0000C029U, 0x00003C28U, 0x00007828U, 0x00008429U, 0x0000F028U, 0x00000C29U, 0x00004829U, 0x0000B428U,
+      0x0000A02BU, 0x00005C2AU, 0x0000182AU, 0x0000E42BU, 0x0000902AU, 0x00006C2BU, 0x0000282BU, 0x0000D42AU,
+      0x0000002DU, 0x0000FC2CU, 0x0000B82CU, 0x0000442DU, 0x0000302CU, 0x0000CC2DU, 0x0000882DU, 0x0000742CU,
+      0x0000602FU, 0x00009C2EU, 0x0000D82EU, 0x0000242FU, 0x0000502EU, 0x0000AC2FU, 0x0000E82FU, 0x0000142EU,
+      0x00000022U, 0x0000FC23U, 0x0000B823U, 0x00004422U, 0x00003023U, 0x0000CC22U, 0x00008822U, 0x00007423U,
+      0x00006020U, 0x00009C21U, 0x0000D821U, 0x00002420U, 0x00005021U, 0x0000AC20U, 0x0000E820U, 0x00001421U,
+      0x0000C026U, 0x00003C27U, 0x00007827U, 0x00008426U, 0x0000F027U, 0x00000C26U, 0x00004826U, 0x0000B427U,
+      0x0000A024U, 0x00005C25U, 0x00001825U, 0x0000E424U, 0x00009025U, 0x00006C24U, 0x00002824U, 0x0000D425U,
+      0x0000003CU, 0x0000FC3DU, 0x0000B83DU, 0x0000443CU, 0x0000303DU, 0x0000CC3CU, 0x0000883CU, 0x0000743DU,
+      0x0000603EU, 0x00009C3FU, 0x0000D83FU, 0x0000243EU, 0x0000503FU, 0x0000AC3EU, 0x0000E83EU, 0x0000143FU,
+      0x0000C038U, 0x00003C39U, 0x00007839U, 0x00008438U, 0x0000F039U, 0x00000C38U, 0x00004838U, 0x0000B439U,
+      0x0000A03AU, 0x00005C3BU, 0x0000183BU, 0x0000E43AU, 0x0000903BU, 0x00006C3AU, 0x0000283AU, 0x0000D43BU,
+      0x0000C037U, 0x00003C36U, 0x00007836U, 0x00008437U, 0x0000F036U, 0x00000C37U, 0x00004837U, 0x0000B436U,
+      0x0000A035U, 0x00005C34U, 0x00001834U, 0x0000E435U, 0x00009034U, 0x00006C35U, 0x00002835U, 0x0000D434U,
+      0x00000033U, 0x0000FC32U, 0x0000B832U, 0x00004433U, 0x00003032U, 0x0000CC33U, 0x00008833U, 0x00007432U,
+      0x00006031U, 0x00009C30U, 0x0000D830U, 0x00002431U, 0x00005030U, 0x0000AC31U, 0x0000E831U, 0x00001430U
+    },
+    {
+      0x00000000U, 0x0000C03DU, 0x0000C079U, 0x00000044U, 0x0000C0F1U, 0x000000CCU, 0x00000088U, 0x0000C0B5U,
+      0x0000C1E1U, 0x000001DCU, 0x00000198U, 0x0000C1A5U, 0x00000110U, 0x0000C12DU, 0x0000C169U, 0x00000154U,
+      0x0000C3C1U, 0x000003FCU, 0x000003B8U, 0x0000C385U, 0x00000330U, 0x0000C30DU, 0x0000C349U, 0x00000374U,
+      0x00000220U, 0x0000C21DU, 0x0000C259U, 0x00000264U, 0x0000C2D1U, 0x000002ECU, 0x000002A8U, 0x0000C295U,
+      0x0000C781U, 0x000007BCU, 0x000007F8U, 0x0000C7C5U, 0x00000770U, 0x0000C74DU, 0x0000C709U, 0x00000734U,
+      0x00000660U, 0x0000C65DU, 0x0000C619U, 0x00000624U, 0x0000C691U, 0x000006ACU, 0x000006E8U, 0x0000C6D5U,
+      0x00000440U, 0x0000C47DU, 0x0000C439U, 0x00000404U, 0x0000C4B1U, 0x0000048CU, 0x000004C8U, 0x0000C4F5U,
+      0x0000C5A1U, 0x0000059CU, 0x000005D8U, 0x0000C5E5U, 0x00000550U, 0x0000C56DU, 0x0000C529U, 0x00000514U,
+      0x0000CF01U, 0x00000F3CU, 0x00000F78U, 0x0000CF45U, 0x00000FF0U, 0x0000CFCDU, 0x0000CF89U, 0x00000FB4U,
+      0x00000EE0U, 0x0000CEDDU, 0x0000CE99U, 0x00000EA4U, 0x0000CE11U, 0x00000E2CU, 0x00000E68U, 0x0000CE55U,
+      0x00000CC0U, 0x0000CCFDU, 0x0000CCB9U, 0x00000C84U, 0x0000CC31U, 0x00000C0CU, 0x00000C48U, 0x0000CC75U,
+      0x0000CD21U, 0x00000D1CU, 0x00000D58U, 0x0000CD65U, 0x00000DD0U, 0x0000CDEDU, 0x0000CDA9U, 0x00000D94U,
+      0x00000880U, 0x0000C8BDU, 0x0000C8F9U, 0x000008C4U, 0x0000C871U, 0x0000084CU, 0x00000808U, 0x0000C835U,
+      0x0000C961U, 0x0000095CU, 0x00000918U, 0x0000C925U, 0x00000990U, 0x0000C9ADU, 0x0000C9E9U, 0x000009D4U,
+      0x0000CB41U, 0x00000B7CU, 0x00000B38U, 0x0000CB05U, 0x00000BB0U, 0x0000CB8DU, 0x0000CBC9U, 0x00000BF4U,
+      0x00000AA0U, 0x0000CA9DU, 0x0000CAD9U, 0x00000AE4U, 0x0000CA51U, 0x00000A6CU, 0x00000A28U, 0x0000CA15U,
+      0x0000DE01U, 0x00001E3CU, 0x00001E78U, 0x0000DE45U, 0x00001EF0U, 0x0000DECDU, 0x0000DE89U, 0x00001EB4U,
+      0x00001FE0U, 0x0000DFDDU, 0x0000DF99U, 0x00001FA4U, 0x0000DF11U, 0x00001F2CU, 0x00001F68U, 0x0000DF55U,
+      0x00001DC0U, 0x0000DDFDU, 0x0000DDB9U, 0x00001D84U, 0x0000DD31U, 0x00001D0CU, 0x00001D48U, 0x0000DD75U,
+      0x0000DC21U, 0x00001C1CU, 0x00001C58U, 0x0000DC65U, 0x00001CD0U, 0x0000DCEDU, 0x0000DCA9U, 0x00001C94U,
+      0x00001980U, 0x0000D9BDU, 0x0000D9F9U, 0x000019C4U, 0x0000D971U, 0x0000194CU, 0x00001908U, 0x0000D935U,
+      0x0000D861U, 0x0000185CU, 0x00001818U, 0x0000D825U, 0x00001890U, 0x0000D8ADU, 0x0000D8E9U, 0x000018D4U,
+      0x0000DA41U, 0x00001A7CU, 0x00001A38U, 0x0000DA05U, 0x00001AB0U, 0x0000DA8DU, 0x0000DAC9U, 0x00001AF4U,
+      0x00001BA0U, 0x0000DB9DU, 0x0000DBD9U, 0x00001BE4U, 0x0000DB51U, 0x00001B6CU, 0x00001B28U, 0x0000DB15U,
+      0x00001100U, 0x0000D13DU, 0x0000D179U, 0x00001144U, 0x0000D1F1U, 0x000011CCU, 0x00001188U, 0x0000D1B5U,
+      0x0000D0E1U, 0x000010DCU, 0x00001098U, 0x0000D0A5U, 0x00001010U, 0x0000D02DU, 0x0000D069U, 0x00001054U,
+      0x0000D2C1U, 0x000012FCU, 0x000012B8U, 0x0000D285U, 0x00001230U, 0x0000D20DU, 0x0000D249U, 0x00001274U,
+      0x00001320U, 0x0000D31DU, 0x0000D359U, 0x00001364U, 0x0000D3D1U, 0x000013ECU, 0x000013A8U, 0x0000D395U,
+      0x0000D681U, 0x000016BCU, 0x000016F8U, 0x0000D6C5U, 0x00001670U, 0x0000D64DU, 0x0000D609U, 0x00001634U,
+      0x00001760U, 0x0000D75DU, 0x0000D719U, 0x00001724U, 0x0000D791U, 0x000017ACU, 0x000017E8U, 0x0000D7D5U,
+      0x00001540U, 0x0000D57DU, 0x0000D539U, 0x00001504U, 0x0000D5B1U, 0x0000158CU, 0x000015C8U, 0x0000D5F5U,
+      0x0000D4A1U, 0x0000149CU, 0x000014D8U, 0x0000D4E5U, 0x00001450U, 0x0000D46DU, 0x0000D429U, 0x00001414U
+    },
+    {
+      0x00000000U, 0x0000D101U, 0x0000E201U, 0x00003300U, 0x00008401U, 0x00005500U, 0x00006600U, 0x0000B701U,
+      0x00004801U, 0x00009900U, 0x0000AA00U, 0x00007B01U, 0x0000CC00U, 0x00001D01U, 0x00002E01U, 0x0000FF00U,
+      0x00009002U, 0x00004103U, 0x00007203U, 0x0000A302U, 0x00001403U, 0x0000C502U, 0x0000F602U, 0x00002703U,
+      0x0000D803U, 0x00000902U, 0x00003A02U, 0x0000EB03U, 0x00005C02U, 0x00008D03U, 0x0000BE03U, 0x00006F02U,
+      0x00006007U, 0x0000B106U, 0x00008206U, 0x00005307U, 0x0000E406U, 0x00003507U, 0x00000607U, 0x0000D706U,
+      0x00002806U, 0x0000F907U, 0x0000CA07U, 0x00001B06U, 0x0000AC07U, 0x00007D06U, 0x00004E06U, 0x00009F07U,
+      0x0000F005U, 0x00002104U, 0x00001204U, 0x0000C305U, 0x00007404U, 0x0000A505U, 0x00009605U, 0x00004704U,
+      0x0000B804U, 0x00006905U, 0x00005A05U, 0x00008B04U, 0x00003C05U, 0x0000ED04U, 0x0000DE04U, 0x00000F05U,
+      0x0000C00EU, 0x0000110FU, 0x0000220FU, 0x0000F30EU, 0x0000440FU, 0x0000950EU, 0x0000A60EU, 0x0000770FU,
+      0x0000880FU, 0x0000590EU, 0x00006A0EU, 0x0000BB0FU, 0x00000C0EU, 0x0000DD0FU, 0x0000EE0FU, 0x00003F0EU,
+      0x0000500CU, 0x0000810DU, 0x0000B20DU, 0x0000630CU, 0x0000D40DU, 0x0000050CU, 0x0000360CU, 0x0000E70DU,
+      0x0000180DU, 0x0000C90CU, 0x0000FA0CU, 0x00002B0DU, 0x00009C0CU, 0x00004D0DU, 0x00007E0DU, 0x0000AF0CU,
+      0x0000A009U, 0x00007108U, 0x00004208U, 0x00009309U, 0x00002408U, 0x0000F509U, 0x0000C609U, 0x00001708U,
+      0x0000E808U, 0x00003909U, 0x00000A09U, 0x0000DB08U, 0x00006C09U, 0x0000BD08U, 0x00008E08U, 0x00005F09U,
+      0x0000300BU, 0x0000E10AU, 0x0000D20AU, 0x0000030BU, 0x0000B40AU, 0x0000650BU, 0x0000560BU, 0x0000870AU,
+      0x0000780AU, 0x0000A90BU, 0x00009A0BU, 0x00004B0AU, 0x0000FC0BU, 0x00002D0AU, 0x00001E0AU, 0x0000CF0BU,
+      0x0000C01FU, 0x0000111EU, 0x0000221EU, 0x0000F31FU, 0x0000441EU, 0x0000951FU, 0x0000A61FU, 0x0000771EU,
+      0x0000881EU, 0x0000591FU, 0x00006A1FU, 0x0000BB1EU, 0x00000C1FU, 0x0000DD1EU, 0x0000EE1EU, 0x00003F1FU,
+      0x0000501DU, 0x0000811CU, 0x0000B21CU, 0x0000631DU, 0x0000D41CU, 0x0000051DU, 0x0000361DU, 0x0000E71CU,
+      0x0000181CU, 0x0000C91DU, 0x0000FA1DU, 0x00002B1CU, 0x00009C1DU, 0x00004D1CU, 0x00007E1CU, 0x0000AF1DU,
+      0x0000A018U, 0x00007119U, 0x00004219U, 0x00009318U, 0x00002419U, 0x0000F518U, 0x0000C618U, 0x00001719U,
+      0x0000E819U, 0x00003918U, 0x00000A18U, 0x0000DB19U, 0x00006C18U, 0x0000BD19U, 0x00008E19U, 0x00005F18U,
+      0x0000301AU, 0x0000E11BU, 0x0000D21BU, 0x0000031AU, 0x0000B41BU, 0x0000651AU, 0x0000561AU, 0x0000871BU,
+      0x0000781BU, 0x0000A91AU, 0x00009A1AU, 0x00004B1BU, 0x0000FC1AU, 0x00002D1BU, 0x00001E1BU, 0x0000CF1AU,
+      0x00000011U, 0x0000D110U, 0x0000E210U, 0x00003311U, 0x00008410U, 0x00005511U, 0x00006611U, 0x0000B710U,
+      0x00004810U, 0x00009911U, 0x0000AA11U, 0x00007B10U, 0x0000CC11U, 0x00001D10U, 0x00002E10U, 0x0000FF11U,
+      0x00009013U, 0x00004112U, 0x00007212U, 0x0000A313U, 0x00001412U, 0x0000C513U, 0x0000F613U, 0x00002712U,
+      0x0000D812U, 0x00000913U, 0x00003A13U, 0x0000EB12U, 0x00005C13U, 0x00008D12U, 0x0000BE12U, 0x00006F13U,
+      0x00006016U, 0x0000B117U, 0x00008217U, 0x00005316U, 0x0000E417U, 0x00003516U, 0x00000616U, 0x0000D717U,
+      0x00002817U, 0x0000F916U, 0x0000CA16U, 0x00001B17U, 0x0000AC16U, 0x00007D17U, 0x00004E17U, 0x00009F16U,
+      0x0000F014U, 0x00002115U, 0x00001215U, 0x0000C314U, 0x00007415U, 0x0000A514U, 0x00009614U, 0x00004715U,
+      0x0000B815U, 0x00006914U, 0x00005A14U, 0x00008B15U, 0x00003C14U, 0x0000ED15U, 0x0000DE15U, 0x00000F14U
+    },
+    {
+      0x00000000U, 0x0000C010U, 0x0000C023U, 0x00000033U, 0x0000C045U, 0x00000055U, 0x00000066U, 0x0000C076U,
+      0x0000C089U, 0x00000099U, 0x000000AAU, 0x0000C0BAU, 0x000000CCU, 0x0000C0DCU, 0x0000C0EFU, 0x000000FFU,
+      0x0000C111U, 0x00000101U, 0x00000132U, 0x0000C122U, 0x00000154U, 0x0000C144U, 0x0000C177U, 0x00000167U,
+      0x00000198U, 0x0000C188U, 0x0000C1BBU, 0x000001ABU, 0x0000C1DDU, 0x000001CDU, 0x000001FEU, 0x0000C1EEU,
+      0x0000C221U, 0x00000231U, 0x00000202U, 0x0000C212U, 0x00000264U, 0x0000C274U, 0x0000C247U, 0x00000257U,
+      0x000002A8U, 0x0000C2B8U, 0x0000C28BU, 0x0000029BU, 0x0000C2EDU, 0x000002FDU, 0x000002CEU, 0x0000C2DEU,
+      0x00000330U, 0x0000C320U, 0x0000C313U, 0x00000303U, 0x0000C375U, 0x00000365U, 0x00000356U, 0x0000C346U,
+      0x0000C3B9U, 0x000003A9U, 0x0000039AU, 0x0000C38AU, 0x000003FCU, 0x0000C3ECU, 0x0000C3DFU, 0x000003CFU,
+      0x0000C441U, 0x00000451U, 0x00000462U, 0x0000C472U, 0x00000404U, 0x0000C414U, 0x0000C427U, 0x00000437U,
+      0x000004C8U, 0x0000C4D8U, 0x0000C4EBU, 0x000004FBU, 0x0000C48DU, 0x0000049DU, 0x000004AEU, 0x0000C4BEU,
+      0x00000550U, 0x0000C540U, 0x0000C573U, 0x00000563U, 0x0000C515U, 0x00000505U, 0x00000536U, 0x0000C526U,
+      0x0000C5D9U, 0x000005C9U, 0x000005FAU, 0x0000C5EAU, 0x0000059CU, 0x0000C58CU, 0x0000C5BFU, 0x000005AFU,
+      0x00000660U, 0x0000C670U, 0x0000C643U, 0x00000653U, 0x0000C625U, 0x00000635U, 0x00000606U, 0x0000C616U,
+      0x0000C6E9U, 0x000006F9U, 0x000006CAU, 0x0000C6DAU, 0x000006ACU, 0x0000C6BCU, 0x0000C68FU, 0x0000069FU,
+      0x0000C771U, 0x00000761U, 0x00000752U, 0x0000C742U, 0x00000734U, 0x0000C724U, 0x0000C717U, 0x00000707U,
+      0x000007F8U, 0x0000C7E8U, 0x0000C7DBU, 0x000007CBU, 0x0000C7BDU, 0x000007ADU, 0x0000079EU, 0x0000C78EU,
+      0x0000C881U, 0x00000891U, 0x000008A2U, 0x0000C8B2U, 0x000008C4U, 0x0000C8D4U, 0x0000C8E7U, 0x000008F7U,
+      0x00000808U, 0x0000C818U, 0x0000C82BU, 0x0000083BU, 0x0000C84DU, 0x0000085DU, 0x0000086EU, 0x0000C87EU,
+      0x00000990U, 0x0000C980U, 0x0000C9B3U, 0x000009A3U, 0x0000C9D5U, 0x000009C5U, 0x000009F6U, 0x0000C9E6U,
+      0x0000C919U, 0x00000909U, 0x0000093AU, 0x0000C92AU, 0x0000095CU, 0x0000C94CU, 0x0000C97FU, 0x0000096FU,
+      0x00000AA0U, 0x0000CAB0U, 0x0000CA83U, 0x00000A93U, 0x0000CAE5U, 0x00000AF5U, 0x00000AC6U, 0x0000CAD6U,
+      0x0000CA29U, 0x00000A39U, 0x00000A0AU, 0x0000CA1AU, 0x00000A6CU, 0x0000CA7CU, 0x0000CA4FU, 0x00000A5FU,
+      0x0000CBB1U, 0x00000BA1U, 0x00000B92U, 0x0000CB82U, 0x00000BF4U, 0x0000CBE4U, 0x0000CBD7U, 0x00000BC7U,
+      0x00000B38U, 0x0000CB28U, 0x0000CB1BU, 0x00000B0BU, 0x0000CB7DU, 0x00000B6DU, 0x00000B5EU, 0x0000CB4EU,
+      0x00000CC0U, 0x0000CCD0U, 0x0000CCE3U, 0x00000CF3U, 0x0000CC85U, 0x00000C95U, 0x00000CA6U, 0x0000CCB6U,
+      0x0000CC49U, 0x00000C59U, 0x00000C6AU, 0x0000CC7AU, 0x00000C0CU, 0x0000CC1CU, 0x0000CC2FU, 0x00000C3FU,
+      0x0000CDD1U, 0x00000DC1U, 0x00000DF2U, 0x0000CDE2U, 0x00000D94U, 0x0000CD84U, 0x0000CDB7U, 0x00000DA7U,
+      0x00000D58U, 0x0000CD48U, 0x0000CD7BU, 0x00000D6BU, 0x0000CD1DU, 0x00000D0DU, 0x00000D3EU, 0x0000CD2EU,
+      0x0000CEE1U, 0x00000EF1U, 0x00000EC2U, 0x0000CED2U, 0x00000EA4U, 0x0000CEB4U, 0x0000CE87U, 0x00000E97U,
+      0x00000E68U, 0x0000CE78U, 0x0000CE4BU, 0x00000E5BU, 0x0000CE2DU, 0x00000E3DU, 0x00000E0EU, 0x0000CE1EU,
+      0x00000FF0U, 0x0000CFE0U, 0x0000CFD3U, 0x00000FC3U, 0x0000CFB5U, 0x00000FA5U, 0x00000F96U, 0x0000CF86U,
+      0x0000CF79U, 0x00000F69U, 0x00000F5AU, 0x0000CF4AU, 0x00000F3CU, 0x0000CF2CU, 0x0000CF1FU, 0x00000F0FU
+    },
+    {
+      0x00000000U, 0x0000CCC1U, 0x0000D981U, 0x00001540U, 0x0000F301U, 0x00003FC0U, 0x00002A80U, 0x0000E641U,
+      0x0000A601U, 0x00006AC0U, 0x00007F80U, 0x0000B341U, 0x00005500U, 0x000099C1U, 0x00008C81U, 0x00004040U,
+      0x00000C01U, 0x0000C0C0U, 0x0000D580U, 0x00001941U, 0x0000FF00U, 0x000033C1U, 0x00002681U, 0x0000EA40U,
+      0x0000AA00U, 0x000066C1U, 0x00007381U, 0x0000BF40U, 0x00005901U, 0x000095C0U, 0x00008080U, 0x00004C41U,
+      0x00001802U, 0x0000D4C3U, 0x0000C183U, 0x00000D42U, 0x0000EB03U, 0x000027C2U, 0x00003282U, 0x0000FE43U,
+      0x0000BE03U, 0x000072C2U, 0x00006782U, 0x0000AB43U, 0x00004D02U, 0x000081C3U, 0x00009483U, 0x00005842U,
+      0x00001403U, 0x0000D8C2U, 0x0000CD82U, 0x00000143U, 0x0000E702U, 0x00002BC3U, 0x00003E83U, 0x0000F242U,
+      0x0000B202U, 0x00007EC3U, 0x00006B83U, 0x0000A742U, 0x00004103U, 0x00008DC2U, 0x00009882U, 0x00005443U,
+      0x00003004U, 0x0000FCC5U, 0x0000E985U, 0x00002544U, 0x0000C305U, 0x00000FC4U, 0x00001A84U, 0x0000D645U,
+      0x00009605U, 0x00005AC4U, 0x00004F84U, 0x00008345U, 0x00006504U, 0x0000A9C5U, 0x0000BC85U, 0x00007044U,
+      0x00003C05U, 0x0000F0C4U, 0x0000E584U, 0x00002945U, 0x0000CF04U, 0x000003C5U, 0x00001685U, 0x0000DA44U,
+      0x00009A04U, 0x000056C5U, 0x00004385U, 0x00008F44U, 0x00006905U, 0x0000A5C4U, 0x0000B084U, 0x00007C45U,
+      0x00002806U, 0x0000E4C7U, 0x0000F187U, 0x00003D46U, 0x0000DB07U, 0x000017C6U, 0x00000286U, 0x0000CE47U,
+      0x00008E07U, 0x000042C6U, 0x00005786U, 0x00009B47U, 0x00007D06U, 0x0000B1C7U, 0x0000A487U, 0x00006846U,
+      0x00002407U, 0x0000E8C6U, 0x0000FD86U, 0x00003147U, 0x0000D706U, 0x00001BC7U, 0x00000E87U, 0x0000C246U,
+      0x00008206U, 0x00004EC7U, 0x00005B87U, 0x00009746U, 0x00007107U, 0x0000BDC6U, 0x0000A886U, 0x00006447U,
+      0x00006008U, 0x0000ACC9U, 0x0000B989U, 0x00007548U, 0x00009309U, 0x00005FC8U, 0x00004A88U, 0x00008649U,
+      0x0000C609U, 0x00000AC8U, 0x00001F88U, 0x0000D349U, 0x00003508U, 0x0000F9C9U, 0x0000EC89U, 0x00002048U,
+      0x00006C09U, 0x0000A0C8U, 0x0000B588U, 0x00007949U, 0x00009F08U, 0x000053C9U, 0x00004689U, 0x00008A48U,
+      0x0000CA08U, 0x000006C9U, 0x00001389U, 0x0000DF48U, 0x00003909U, 0x0000F5C8U, 0x0000E088U, 0x00002C49U,
+      0x0000780AU, 0x0000B4CBU, 0x0000A18BU, 0x00006D4AU, 0x00008B0BU, 0x000047CAU, 0x0000528AU, 0x00009E4BU,
+      0x0000DE0BU, 0x000012CAU, 0x0000078AU, 0x0000CB4BU, 0x00002D0AU, 0x0000E1CBU, 0x0000F48BU, 0x0000384AU,
+      0x0000740BU, 0x0000B8CAU, 0x0000AD8AU, 0x0000614BU, 0x0000870AU, 0x00004BCBU, 0x00005E8BU, 0x0000924AU,
+      0x0000D20AU, 0x00001ECBU, 0x00000B8BU, 0x0000C74AU, 0x0000210BU, 0x0000EDCAU, 0x0000F88AU, 0x0000344BU,
+      0x0000500CU, 0x00009CCDU, 0x0000898DU, 0x0000454CU, 0x0000A30DU, 0x00006FCCU, 0x00007A8CU, 0x0000B64DU,
+      0x0000F60DU, 0x00003ACCU, 0x00002F8CU, 0x0000E34DU, 0x0000050CU, 0x0000C9CDU, 0x0000DC8DU, 0x0000104CU,
+      0x00005C0DU, 0x000090CCU, 0x0000858CU, 0x0000494DU, 0x0000AF0CU, 0x000063CDU, 0x0000768DU, 0x0000BA4CU,
+      0x0000FA0CU, 0x000036CDU, 0x0000238DU, 0x0000EF4CU, 0x0000090DU, 0x0000C5CCU, 0x0000D08CU, 0x00001C4DU,
+      0x0000480EU, 0x000084CFU, 0x0000918FU, 0x00005D4EU, 0x0000BB0FU, 0x000077CEU, 0x0000628EU, 0x0000AE4FU,
+      0x0000EE0FU, 0x000022CEU, 0x0000378EU, 0x0000FB4FU, 0x00001D0EU, 0x0000D1CFU, 0x0000C48FU, 0x0000084EU,
+      0x0000440FU, 0x000088CEU, 0x00009D8EU, 0x0000514FU, 0x0000B70EU, 0x00007BCFU, 0x00006E8FU, 0x0000A24EU,
+      0x0000E20EU, 0x00002ECFU, 0x00003B8FU, 0x0000F74EU, 0x0000110FU, 0x0000DDCEU, 0x0000C88EU, 0x0000044FU
+    }
+  }
+};
+
+const uint32_t redcrc_kCrc32cShiftTables[REDCRC_CRC32C_SHIFT_TABLES][REDCRC_TABLE_SIZE] = {
+  {
+    0x00000000U, 0x6992CEA2U, 0xD3259D44U, 0xBAB753E6U, 0xA3A74C79U, 0xCA3582DBU, 0x7082D13DU, 0x19101F9FU,
+    0x42A2EE03U, 0x2B3020A1U, 0x91877347U, 0xF815BDE5U, 0xE105A27AU, 0x88976CD8U, 0x32203F3EU, 0x5BB2F19CU,
+    0x8545DC06U, 0xECD712A4U, 0x56604142U, 0x3FF28FE0U, 0x26E2907FU, 0x4F705EDDU, 0xF5C70D3BU, 0x9C55C399U,
+    0xC7E73205U, 0xAE75FCA7U, 0x14C2AF41U, 0x7D5061E3U, 0x64407E7CU, 0x0DD2B0DEU, 0xB765E338U, 0xDEF72D9AU,
+    0x0F67CEFDU, 0x66F5005FU, 0xDC4253B9U, 0xB5D09D1BU, 0xACC08284U, 0xC5524C26U, 0x7FE51FC0U, 0x1677D162U,
+    0x4DC520FEU, 0x2457EE5CU, 0x9EE0BDBAU, 0xF7727318U, 0xEE626C87U, 0x87F0A225U, 0x3D47F1C3U, 0x54D53F61U,
+    0x8A2212FBU, 0xE3B0DC59U, 0x59078FBFU, 0x3095411DU, 0x29855E82U, 0x40179020U, 0xFAA0C3C6U, 0x93320D64U,
+    0xC880FCF8U, 0xA112325AU, 0x1BA561BCU, 0x7237AF1EU, 0x6B27B081U, 0x02B57E23U, 0xB8022DC5U, 0xD190E367U,
+    0x1ECF9DFAU, 0x775D5358U, 0xCDEA00BEU, 0xA478CE1CU, 0xBD68D183U, 0xD4FA1F21U, 0x6E4D4CC7U, 0x07DF8265U,
+    0x5C6D73F9U, 0x35FFBD5BU, 0x8F48EEBDU, 0xE6DA201FU, 0xFFCA3F80U, 0x9658F122U, 0x2CEFA2C4U, 0x457D6C66U,
+    0x9B8A41FCU, 0xF2188F5EU, 0x48AFDCB8U, 0x213D121AU, 0x382D0D85U, 0x51BFC327U, 0xEB0890C1U, 0x829A5E63U,
+    0xD928AFFFU, 0xB0BA615DU, 0x0A0D32BBU, 0x639FFC19U, 0x7A8FE386U, 0x131D2D24U, 0xA9AA7EC2U, 0xC038B060U,
+    0x11A85307U, 0x783A9DA5U, 0xC28DCE43U, 0xAB1F00E1U, 0xB20F1F7EU, 0xDB9DD1DCU, 0x612A823AU, 0x08B84C98U,
+    0x530ABD04U, 0x3A9873A6U, 0x802F2040U, 0xE9BDEEE2U, 0xF0ADF17DU, 0x993F3FDFU, 0x23886C39U, 0x4A1AA29BU,
+    0x94ED8F01U, 0xFD7F41A3U, 0x47C81245U, 0x2E5ADCE7U, 0x374AC378U, 0x5ED80DDAU, 0xE46F5E3CU, 0x8DFD909EU,
+    0xD64F6102U, 0xBFDDAFA0U, 0x056AFC46U, 0x6CF832E4U, 0x75E82D7BU, 0x1C7AE3D9U, 0xA6CDB03FU, 0xCF5F7E9DU,
+    0x3D9F3BF4U, 0x540DF556U, 0xEEBAA6B0U, 0x87286812U, 0x9E38778DU, 0xF7AAB92FU, 0x4D1DEAC9U, 0x248F246BU,
+    0x7F3DD5F7U, 0x16AF1B55U, 0xAC1848B3U, 0xC58A8611U, 0xDC9A998EU, 0xB508572CU, 0x0FBF04CAU, 0x662DCA68U,
+    0xB8DAE7F2U, 0xD1482950U, 0x6BFF7AB6U, 0x026DB414U, 0x1B7DAB8BU, 0x72EF6529U, 0xC85836CFU, 0xA1CAF86DU,
+    0xFA7809F1U, 0x93EAC753U, 0x295D94B5U, 0x40CF5A17U, 0x59DF4588U, 0x304D8B2AU, 0x8AFAD8CCU, 0xE368166EU,
+    0x32F8F509U, 0x5B6A3BABU, 0xE1DD684DU, 0x884FA6EFU, 0x915FB970U, 0xF8CD77D2U, 0x427A2434U, 0x2BE8EA96U,
+    0x705A1B0AU, 0x19C8D5A8U, 0xA37F864EU, 0xCAED48ECU, 0xD3FD5773U, 0xBA6F99D1U, 0x00D8CA37U, 0x694A0495U,
+    0xB7BD290FU, 0xDE2FE7ADU, 0x6498B44BU, 0x0D0A7AE9U, 0x141A6576U, 0x7D88ABD4U, 0xC73FF832U, 0xAEAD3690U,
+    0xF51FC70CU, 0x9C8D09AEU, 0x263A5A48U, 0x4FA894EAU, 0x56B88B75U, 0x3F2A45D7U, 0x859D1631U, 0xEC0FD893U,
+    0x2350A60EU, 0x4AC268ACU, 0xF0753B4AU, 0x99E7F5E8U, 0x80F7EA77U, 0xE96524D5U, 0x53D27733U, 0x3A40B991U,
+    0x61F2480DU, 0x086086AFU, 0xB2D7D549U, 0xDB451BEBU, 0xC2550474U, 0xABC7CAD6U, 0x11709930U, 0x78E25792U,
+    0xA6157A08U, 0xCF87B4AAU, 0x7530E74CU, 0x1CA229EEU, 0x05B23671U, 0x6C20F8D3U, 0xD697AB35U, 0xBF056597U,
+    0xE4B7940BU, 0x8D255AA9U, 0x3792094FU, 0x5E00C7EDU, 0x4710D872U, 0x2E8216D0U, 0x94354536U, 0xFDA78B94U,
+    0x2C3768F3U, 0x45A5A651U, 0xFF12F5B7U, 0x96803B15U, 0x8F90248AU, 0xE602EA28U, 0x5CB5B9CEU, 0x3527776CU,
+    0x6E9586F0U, 0x07074852U, 0xBDB01BB4U, 0xD422D516U, 0xCD32CA89U, 0xA4A0042BU, 0x1E1757CDU, 0x7785996FU,
+    0xA972B4F5U, 0xC0E07A57U, 0x7A5729B1U, 0x13C5E713U, 0x0AD5F88CU, 0x6347362EU, 0xD9F065C8U, 0xB062AB6AU,
+    0xEBD05AF6U, 0x82429454U, 0x38F5C7B2U, 0x51670910U, 0x4877168FU, 0x21E5D82DU, 0x9B528BCBU, 0xF2C04569U
+  },
+  {
+    0x00000000U, 0x7B3E77E8U, 0xF67CEFD0U, 0x8D429838U, 0xE915A951U, 0x922BDEB9U, 0x1F694681U, 0x64573169U,
+    0xD7C72453U, 0xACF953BBU, 0x21BBCB83U, 0x5A85BC6BU, 0x3ED28D02U, 0x45ECFAEAU, 0xC8AE62D2U, 0xB390153AU,
+    0xAA623E57U, 0xD15C49BFU, 0x5C1ED187U, 0x2720A66FU, 0x43779706U, 0x3849E0EEU, 0xB50B78D6U, 0xCE350F3EU,
+    0x7DA51A04U, 0x069B6DECU, 0x8BD9F5D4U, 0xF0E7823CU, 0x94B0B355U, 0xEF8EC4BDU, 0x62CC5C85U, 0x19F22B6DU,
+    0x51280A5FU, 0x2A167DB7U, 0xA754E58FU, 0xDC6A9267U, 0xB83DA30EU, 0xC303D4E6U, 0x4E414CDEU, 0x357F3B36U,
+    0x86EF2E0CU, 0xFDD159E4U, 0x7093C1DCU, 0x0BADB634U, 0x6FFA875DU, 0x14C4F0B5U, 0x9986688DU, 0xE2B81F65U,
+    0xFB4A3408U, 0x807443E0U, 0x0D36DBD8U, 0x7608AC30U, 0x125F9D59U, 0x6961EAB1U, 0xE4237289U, 0x9F1D0561U,
+    0x2C8D105BU, 0x57B367B3U, 0xDAF1FF8BU, 0xA1CF8863U, 0xC598B90AU, 0xBEA6CEE2U, 0x33E456DAU, 0x48DA2132U,
+    0xA25014BEU, 0xD96E6356U, 0x542CFB6EU, 0x2F128C86U, 0x4B45BDEFU, 0x307BCA07U, 0xBD39523FU, 0xC60725D7U,
+    0x759730EDU, 0x0EA94705U, 0x83EBDF3DU, 0xF8D5A8D5U, 0x9C8299BCU, 0xE7BCEE54U, 0x6AFE766CU, 0x11C00184U,
+    0x08322AE9U, 0x730C5D01U, 0xFE4EC539U, 0x8570B2D1U, 0xE12783B8U, 0x9A19F450U, 0x175B6C68U, 0x6C651B80U,
+    0xDFF50EBAU, 0xA4CB7952U, 0x2989E16AU, 0x52B79682U, 0x36E0A7EBU, 0x4DDED003U, 0xC09C483BU, 0xBBA23FD3U,
+    0xF3781EE1U, 0x88466909U, 0x0504F131U, 0x7E3A86D9U, 0x1A6DB7B0U, 0x6153C058U, 0xEC115860U, 0x972F2F88U,
+    0x24BF3AB2U, 0x5F814D5AU, 0xD2C3D562U, 0xA9FDA28AU, 0xCDAA93E3U, 0xB694E40BU, 0x3BD67C33U, 0x40E80BDBU,
+    0x591A20B6U, 0x2224575EU, 0xAF66CF66U, 0xD458B88EU, 0xB00F89E7U, 0xCB31FE0FU, 0x46736637U, 0x3D4D11DFU,
+    0x8EDD04E5U, 0xF5E3730DU, 0x78A1EB35U, 0x039F9CDDU, 0x67C8ADB4U, 0x1CF6DA5CU, 0x91B44264U, 0xEA8A358CU,
+    0x414C5F8DU, 0x3A722865U, 0xB730B05DU, 0xCC0EC7B5U, 0xA859F6DCU, 0xD3678134U, 0x5E25190CU, 0x251B6EE4U,
+    0x968B7BDEU, 0xEDB50C36U, 0x60F7940EU, 0x1BC9E3E6U, 0x7F9ED28FU, 0x04A0A567U, 0x89E23D5FU, 0xF2DC4AB7U,
+    0xEB2E61DAU, 0x90101632U, 0x1D528E0AU, 0x666CF9E2U, 0x023BC88BU, 0x7905BF63U, 0xF447275BU, 0x8F7950B3U,
+    0x3CE94589U, 0x47D73261U, 0xCA95AA59U, 0xB1ABDDB1U, 0xD5FCECD8U, 0xAEC29B30U, 0x23800308U, 0x58BE74E0U,
+    0x106455D2U, 0x6B5A223AU, 0xE618BA02U, 0x9D26CDEAU, 0xF971FC83U, 0x824F8B6BU, 0x0F0D1353U, 0x743364BBU,
+    0xC7A37181U, 0xBC9D0669U, 0x31DF9E51U, 0x4AE1E9B9U, 0x2EB6D8D0U, 0x5588AF38U, 0xD8CA3700U, 0xA3F440E8U,
+    0xBA066B85U, 0xC1381C6DU, 0x4C7A8455U, 0x3744F3BDU, 0x5313C2D4U, 0x282DB53CU, 0xA56F2D04U, 0xDE515AECU,
+    0x6DC14FD6U, 0x16FF383EU, 0x9BBDA006U, 0xE083D7EEU, 0x84D4E687U, 0xFFEA916FU, 0x72A80957U, 0x09967EBFU,
+    0xE31C4B33U, 0x98223CDBU, 0x1560A4E3U, 0x6E5ED30BU, 0x0A09E262U, 0x7137958AU, 0xFC750DB2U, 0x874B7A5AU,
+    0x34DB6F60U, 0x4FE51888U, 0xC2A780B0U, 0xB999F758U, 0xDDCEC631U, 0xA6F0B1D9U, 0x2BB229E1U, 0x508C5E09U,
+    0x497E7564U, 0x3240028CU, 0xBF029AB4U, 0xC43CED5CU, 0xA06BDC35U, 0xDB55ABDDU, 0x561733E5U, 0x2D29440DU,
+    0x9EB95137U, 0xE58726DFU, 0x68C5BEE7U, 0x13FBC90FU, 0x77ACF866U, 0x0C928F8EU, 0x81D017B6U, 0xFAEE605EU,
+    0xB234416CU, 0xC90A3684U, 0x4448AEBCU, 0x3F76D954U, 0x5B21E83DU, 0x201F9FD5U, 0xAD5D07EDU, 0xD6637005U,
+    0x65F3653FU, 0x1ECD12D7U, 0x938F8AEFU, 0xE8B1FD07U, 0x8CE6CC6EU, 0xF7D8BB86U, 0x7A9A23BEU, 0x01A45456U,
+    0x18567F3BU, 0x636808D3U, 0xEE2A90EBU, 0x9514E703U, 0xF143D66AU, 0x8A7DA182U, 0x073F39BAU, 0x7C014E52U,
+    0xCF915B68U, 0xB4AF2C80U, 0x39EDB4B8U, 0x42D3C350U, 0x2684F239U, 0x5DBA85D1U, 0xD0F81DE9U, 0xABC66A01U
+  },
+  {
+    0x00000000U, 0x8298BF1AU, 0x00DD08C5U, 0x8245B7DFU, 0x01BA118AU, 0x8322AE90U, 0x0167194FU, 0x83FFA655U,
+    0x03742314U, 0x81EC9C0EU, 0x03A92BD1U, 0x813194CBU, 0x02CE329EU, 0x80568D84U, 0x02133A5BU, 0x808B8541U,
+    0x06E84628U, 0x8470F932U, 0x06354EEDU, 0x84ADF1F7U, 0x075257A2U, 0x85CAE8B8U, 0x078F5F67U, 0x8517E07DU,
+    0x059C653CU, 0x8704DA26U, 0x05416DF9U, 0x87D9D2E3U, 0x042674B6U, 0x86BECBACU, 0x04FB7C73U, 0x8663C369U,
+    0x0DD08C50U, 0x8F48334AU, 0x0D0D8495U, 0x8F953B8FU, 0x0C6A9DDAU, 0x8EF222C0U, 0x0CB7951FU, 0x8E2F2A05U,
+    0x0EA4AF44U, 0x8C3C105EU, 0x0E79A781U, 0x8CE1189BU, 0x0F1EBECEU, 0x8D8601D4U, 0x0FC3B60BU, 0x8D5B0911U,
+    0x0B38CA78U, 0x89A07562U, 0x0BE5C2BDU, 0x897D7DA7U, 0x0A82DBF2U, 0x881A64E8U, 0x0A5FD337U, 0x88C76C2DU,
+    0x084CE96CU, 0x8AD45676U, 0x0891E1A9U, 0x8A095EB3U, 0x09F6F8E6U, 0x8B6E47FCU, 0x092BF023U, 0x8BB34F39U,
+    0x1BA118A0U, 0x9939A7BAU, 0x1B7C1065U, 0x99E4AF7FU, 0x1A1B092AU, 0x9883B630U, 0x1AC601EFU, 0x985EBEF5U,
+    0x18D53BB4U, 0x9A4D84AEU, 0x18083371U, 0x9A908C6BU, 0x196F2A3EU, 0x9BF79524U, 0x19B222FBU, 0x9B2A9DE1U,
+    0x1D495E88U, 0x9FD1E192U, 0x1D94564DU, 0x9F0CE957U, 0x1CF34F02U, 0x9E6BF018U, 0x1C2E47C7U, 0x9EB6F8DDU,
+    0x1E3D7D9CU, 0x9CA5C286U, 0x1EE07559U, 0x9C78CA43U, 0x1F876C16U, 0x9D1FD30CU, 0x1F5A64D3U, 0x9DC2DBC9U,
+    0x167194F0U, 0x94E92BEAU, 0x16AC9C35U, 0x9434232FU, 0x17CB857AU, 0x95533A60U, 0x17168DBFU, 0x958E32A5U,
+    0x1505B7E4U, 0x979D08FEU, 0x15D8BF21U, 0x9740003BU, 0x14BFA66EU, 0x96271974U, 0x1462AEABU, 0x96FA11B1U,
+    0x1099D2D8U, 0x92016DC2U, 0x1044DA1DU, 0x92DC6507U, 0x1123C352U, 0x93BB7C48U, 0x11FECB97U, 0x9366748DU,
+    0x13EDF1CCU, 0x91754ED6U, 0x1330F909U, 0x91A84613U, 0x1257E046U, 0x90CF5F5CU, 0x128AE883U, 0x90125799U,
+    0x37423140U, 0xB5DA8E5AU, 0x379F3985U, 0xB507869FU, 0x36F820CAU, 0xB4609FD0U, 0x3625280FU, 0xB4BD9715U,
+    0x34361254U, 0xB6AEAD4EU, 0x34EB1A91U, 0xB673A58BU, 0x358C03DEU, 0xB714BCC4U, 0x35510B1BU, 0xB7C9B401U,
+    0x31AA7768U, 0xB332C872U, 0x31777FADU, 0xB3EFC0B7U, 0x301066E2U, 0xB288D9F8U, 0x30CD6E27U, 0xB255D13DU,
+    0x32DE547CU, 0xB046EB66U, 0x32035CB9U, 0xB09BE3A3U, 0x336445F6U, 0xB1FCFAECU, 0x33B94D33U, 0xB121F229U,
+    0x3A92BD10U, 0xB80A020AU, 0x3A4FB5D5U, 0xB8D70ACFU, 0x3B28AC9AU, 0xB9B01380U, 0x3BF5A45FU, 0xB96D1B45U,
+    0x39E69E04U, 0xBB7E211EU, 0x393B96C1U, 0xBBA329DBU, 0x385C8F8EU, 0xBAC43094U, 0x3881874BU, 0xBA193851U,
+    0x3C7AFB38U, 0xBEE24422U, 0x3CA7F3FDU, 0xBE3F4CE7U, 0x3DC0EAB2U, 0xBF5855A8U, 0x3D1DE277U, 0xBF855D6DU,
+    0x3F0ED82CU, 0xBD966736U, 0x3FD3D0E9U, 0xBD4B6FF3U, 0x3EB4C9A6U, 0xBC2C76BCU, 0x3E69C163U, 0xBCF17E79U,
+    0x2CE329E0U, 0xAE7B96FAU, 0x2C3E2125U, 0xAEA69E3FU, 0x2D59386AU, 0xAFC18770U, 0x2D8430AFU, 0xAF1C8FB5U,
+    0x2F970AF4U, 0xAD0FB5EEU, 0x2F4A0231U, 0xADD2BD2BU, 0x2E2D1B7EU, 0xACB5A464U, 0x2EF013BBU, 0xAC68ACA1U,
+    0x2A0B6FC8U, 0xA893D0D2U, 0x2AD6670DU, 0xA84ED817U, 0x2BB17E42U, 0xA929C158U, 0x2B6C7687U, 0xA9F4C99DU,
+    0x297F4CDCU, 0xABE7F3C6U, 0x29A24419U, 0xAB3AFB03U, 0x28C55D56U, 0xAA5DE24CU, 0x28185593U, 0xAA80EA89U,
+    0x2133A5B0U, 0xA3AB1AAAU, 0x21EEAD75U, 0xA376126FU, 0x2089B43AU, 0xA2110B20U, 0x2054BCFFU, 0xA2CC03E5U,
+    0x224786A4U, 0xA0DF39BEU, 0x229A8E61U, 0xA002317BU, 0x23FD972EU, 0xA1652834U, 0x23209FEBU, 0xA1B820F1U,
+    0x27DBE398U, 0xA5435C82U, 0x2706EB5DU, 0xA59E5447U, 0x2661F212U, 0xA4F94D08U, 0x26BCFAD7U, 0xA42445CDU,
+    0x24AFC08CU, 0xA6377F96U, 0x2472C849U, 0xA6EA7753U, 0x2515D106U, 0xA78D6E1CU, 0x25C8D9C3U, 0xA75066D9U
+  },
+  {
+    0x00000000U, 0x6E846280U, 0xDD08C500U, 0xB38CA780U, 0xBFFDFCF1U, 0xD1799E71U, 0x62F539F1U, 0x0C715B71U,
+    0x7A178F13U, 0x1493ED93U, 0xA71F4A13U, 0xC99B2893U, 0xC5EA73E2U, 0xAB6E1162U, 0x18E2B6E2U, 0x7666D462U,
+    0xF42F1E26U, 0x9AAB7CA6U, 0x2927DB26U, 0x47A3B9A6U, 0x4BD2E2D7U, 0x25568057U, 0x96DA27D7U, 0xF85E4557U,
+    0x8E389135U, 0xE0BCF3B5U, 0x53305435U, 0x3DB436B5U, 0x31C56DC4U, 0x5F410F44U, 0xECCDA8C4U, 0x8249CA44U,
+    0xEDB24ABDU, 0x8336283DU, 0x30BA8FBDU, 0x5E3EED3DU, 0x524FB64CU, 0x3CCBD4CCU, 0x8F47734CU, 0xE1C311CCU,
+    0x97A5C5AEU, 0xF921A72EU, 0x4AAD00AEU, 0x2429622EU, 0x2858395FU, 0x46DC5BDFU, 0xF550FC5FU, 0x9BD49EDFU,
+    0x199D549BU, 0x7719361BU, 0xC495919BU, 0xAA11F31BU, 0xA660A86AU, 0xC8E4CAEAU, 0x7B686D6AU, 0x15EC0FEAU,
+    0x638ADB88U, 0x0D0EB908U, 0xBE821E88U, 0xD0067C08U, 0xDC772779U, 0xB2F345F9U, 0x017FE279U, 0x6FFB80F9U,
+    0xDE88E38BU, 0xB00C810BU, 0x0380268BU, 0x6D04440BU, 0x61751F7AU, 0x0FF17DFAU, 0xBC7DDA7AU, 0xD2F9B8FAU,
+    0xA49F6C98U, 0xCA1B0E18U, 0x7997A998U, 0x1713CB18U, 0x1B629069U, 0x75E6F2E9U, 0xC66A5569U, 0xA8EE37E9U,
+    0x2AA7FDADU, 0x44239F2DU, 0xF7AF38ADU, 0x992B5A2DU, 0x955A015CU, 0xFBDE63DCU, 0x4852C45CU, 0x26D6A6DCU,
+    0x50B072BEU, 0x3E34103EU, 0x8DB8B7BEU, 0xE33CD53EU, 0xEF4D8E4FU, 0x81C9ECCFU, 0x32454B4FU, 0x5CC129CFU,
+    0x333AA936U, 0x5DBECBB6U, 0xEE326C36U, 0x80B60EB6U, 0x8CC755C7U, 0xE2433747U, 0x51CF90C7U, 0x3F4BF247U,
+    0x492D2625U, 0x27A944A5U, 0x9425E325U, 0xFAA181A5U, 0xF6D0DAD4U, 0x9854B854U, 0x2BD81FD4U, 0x455C7D54U,
+    0xC715B710U, 0xA991D590U, 0x1A1D7210U, 0x74991090U, 0x78E84BE1U, 0x166C2961U, 0xA5E08EE1U, 0xCB64EC61U,
+    0xBD023803U, 0xD3865A83U, 0x600AFD03U, 0x0E8E9F83U, 0x02FFC4F2U, 0x6C7BA672U, 0xDFF701F2U, 0xB1736372U,
+    0xB8FDB1E7U, 0xD679D367U, 0x65F574E7U, 0x0B711667U, 0x07004D16U, 0x69842F96U, 0xDA088816U, 0xB48CEA96U,
+    0xC2EA3EF4U, 0xAC6E5C74U, 0x1FE2FBF4U, 0x71669974U, 0x7D17C205U, 0x1393A085U, 0xA01F0705U, 0xCE9B6585U,
+    0x4CD2AFC1U, 0x2256CD41U, 0x91DA6AC1U, 0xFF5E0841U, 0xF32F5330U, 0x9DAB31B0U, 0x2E279630U, 0x40A3F4B0U,
+    0x36C520D2U, 0x58414252U, 0xEBCDE5D2U, 0x85498752U, 0x8938DC23U, 0xE7BCBEA3U, 0x54301923U, 0x3AB47BA3U,
+    0x554FFB5AU, 0x3BCB99DAU, 0x88473E5AU, 0xE6C35CDAU, 0xEAB207ABU, 0x8436652BU, 0x37BAC2ABU, 0x593EA02BU,
+    0x2F587449U, 0x41DC16C9U, 0xF250B149U, 0x9CD4D3C9U, 0x90A588B8U, 0xFE21EA38U, 0x4DAD4DB8U, 0x23292F38U,
+    0xA160E57CU, 0xCFE487FCU, 0x7C68207CU, 0x12EC42FCU, 0x1E9D198DU, 0x70197B0DU, 0xC395DC8DU, 0xAD11BE0DU,
+    0xDB776A6FU, 0xB5F308EFU, 0x067FAF6FU, 0x68FBCDEFU, 0x648A969EU, 0x0A0EF41EU, 0xB982539EU, 0xD706311EU,
+    0x6675526CU, 0x08F130ECU, 0xBB7D976CU, 0xD5F9F5ECU, 0xD988AE9DU, 0xB70CCC1DU, 0x04806B9DU, 0x6A04091DU,
+    0x1C62DD7FU, 0x72E6BFFFU, 0xC16A187FU, 0xAFEE7AFFU, 0xA39F218EU, 0xCD1B430EU, 0x7E97E48EU, 0x1013860EU,
+    0x925A4C4AU, 0xFCDE2ECAU, 0x4F52894AU, 0x21D6EBCAU, 0x2DA7B0BBU, 0x4323D23BU, 0xF0AF75BBU, 0x9E2B173BU,
+    0xE84DC359U, 0x86C9A1D9U, 0x35450659U, 0x5BC164D9U, 0x57B03FA8U, 0x39345D28U, 0x8AB8FAA8U, 0xE43C9828U,
+    0x8BC718D1U, 0xE5437A51U, 0x56CFDDD1U, 0x384BBF51U, 0x343AE420U, 0x5ABE86A0U, 0xE9322120U, 0x87B643A0U,
+    0xF1D097C2U, 0x9F54F542U, 0x2CD852C2U, 0x425C3042U, 0x4E2D6B33U, 0x20A909B3U, 0x9325AE33U, 0xFDA1CCB3U,
+    0x7FE806F7U, 0x116C6477U, 0xA2E0C3F7U, 0xCC64A177U, 0xC015FA06U, 0xAE919886U, 0x1D1D3F06U, 0x73995D86U,
+    0x05FF89E4U, 0x6B7BEB64U, 0xD8F74CE4U, 0xB6732E64U, 0xBA027515U, 0xD4861795U, 0x670AB015U, 0x098ED295U
+  }
+};
+
+const redcrc_FoldingConstants redcrc_kFoldingConstants[REDCRC_TABLE_TYPES] = {
+  {0x000000005376C1C7U, 0x0000000030AD077EU, 0x0000000000000004U, 0x00000000A1F401CCU},  // Check code type B
+  {0x3743F7BD00000000U, 0x3171D43000000000U, 0x1C19243B00000000U, 0x75BBA45B00000000U},  // Check code type C
+  {0xA95D000000000000U, 0x7EEA000000000000U, 0x9822000000000000U, 0x7F90000000000000U},  // Check code type D
+  {0xCCD0000000000000U, 0xC100000000000000U, 0xC450000000000000U, 0x8101000000000000U}   // Check code type E
+};
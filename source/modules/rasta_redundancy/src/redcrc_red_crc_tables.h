@@ -0,0 +1,77 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redcrc_red_crc_tables.h
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Interface of the constant lookup tables of the RaSTA redundancy layer CRC module.
+ *
+ * This file is generated by scripts/GenerateCrcTables.py, do not edit it manually.
+ */
+#ifndef REDCRC_RED_CRC_TABLES_H_
+#define REDCRC_RED_CRC_TABLES_H_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Global Macro Definitions
+// -----------------------------------------------------------------------------
+
+#define REDCRC_TABLE_TYPES (4U)           ///< Number of check code types with a CRC (check code types B to E) [types]
+#define REDCRC_TABLE_SIZE (256U)          ///< Size of a CRC lookup table [elements]
+#define REDCRC_SLICING_TABLES (8U)        ///< Number of CRC lookup tables for the slicing-by-8 algorithm [tables]
+#define REDCRC_CRC32C_SHIFT_TABLES (4U)   ///< Number of lookup tables to shift a CRC32C over ::REDCRC_CRC32C_STREAM_SIZE zero bytes [tables]
+#define REDCRC_CRC32C_STREAM_SIZE (128U)  ///< Size of each of the three interleaved streams of the hardware CRC32C calculation [bytes]
+
+// -----------------------------------------------------------------------------
+// Global Type Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Typedef for the constants of the carry-less multiplication CRC calculation.
+ *
+ * Every constant is x^n mod P for the polynomial P of the check code type. For reflected CRCs, the constants are reflected within 64 bits and use x^(n-1),
+ * as the carry-less multiplication of two reflected values yields a result which is shifted by one bit.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  uint64_t fold_128_low;   ///< Constant to fold the low 64 bits of a block over 128 bits
+  uint64_t fold_128_high;  ///< Constant to fold the high 64 bits of a block over 128 bits
+  uint64_t fold_512_low;   ///< Constant to fold the low 64 bits of a block over 512 bits
+  uint64_t fold_512_high;  ///< Constant to fold the high 64 bits of a block over 512 bits
+} redcrc_FoldingConstants;
+//lint -restore
+
+// -----------------------------------------------------------------------------
+// Global Const Declarations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief The CRC lookup tables for the slicing-by-8 algorithm of the check code types B to E, indexed by (check code type - ::redcty_kCheckCodeB).
+ *
+ * Table 0 is the classic byte-wise lookup table. Table n contains the CRC of a byte followed by n zero bytes. For non-reflected CRCs, the table values are
+ * aligned to the most significant bit of a uint32_t.
+ */
+extern const uint32_t redcrc_kCrcTables[REDCRC_TABLE_TYPES][REDCRC_SLICING_TABLES][REDCRC_TABLE_SIZE];
+
+/**
+ * @brief Lookup tables to shift a CRC32C (check code type C) over ::REDCRC_CRC32C_STREAM_SIZE zero bytes.
+ *
+ * Used to combine the CRCs of the interleaved streams of the hardware CRC32C calculation. Table n contains the shifted CRC of byte n of the CRC.
+ */
+extern const uint32_t redcrc_kCrc32cShiftTables[REDCRC_CRC32C_SHIFT_TABLES][REDCRC_TABLE_SIZE];
+
+/**
+ * @brief The constants of the carry-less multiplication CRC calculation of the check code types B to E, indexed by (check code type - ::redcty_kCheckCodeB).
+ */
+extern const redcrc_FoldingConstants redcrc_kFoldingConstants[REDCRC_TABLE_TYPES];
+
+#endif  // REDCRC_RED_CRC_TABLES_H_
@@ -24,6 +24,7 @@
 #include "rasta_common/radef_rasta_definitions.h"
 #include "rasta_common/ralog_rasta_logger.h"
 #include "rasta_common/rasys_rasta_system_adapter.h"
+#include "rasta_common/ratmw_rasta_timer_wheel.h"
 #include "rasta_redundancy/redint_red_interface.h"
 #include "redmsg_red_messages.h"  // NOLINT(build/include_subdir)
 #include "redtyp_red_types.h"     // NOLINT(build/include_subdir)
@@ -32,44 +33,91 @@
 // Local Macro Definitions
 // -----------------------------------------------------------------------------
 
+#if ((RADEF_DEFER_QUEUE_INDEX_SIZE & (RADEF_DEFER_QUEUE_INDEX_SIZE - 1U)) != 0U) || (RADEF_DEFER_QUEUE_INDEX_SIZE < RADEF_MAX_DEFER_QUEUE_SIZE)
+#error "RADEF_DEFER_QUEUE_INDEX_SIZE must be a power of two and at least RADEF_MAX_DEFER_QUEUE_SIZE"
+#endif
+
+#if RADEF_MAX_NUMBER_OF_RED_CHANNELS >= RATMW_NO_TIMER
+#error "RADEF_MAX_NUMBER_OF_RED_CHANNELS exceeds the number of timers of a timer wheel"
+#endif
+
 // -----------------------------------------------------------------------------
 // Local Type Definitions
 // -----------------------------------------------------------------------------
 
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
 /**
- * @brief Typedef for a defer queue entry.
+ * @brief Data of all RedL defer queue instances.
  */
-typedef struct {
-  redtyp_RedundancyMessage message;  ///< Redundancy layer PDU message
-  uint32_t received_timestamp;       ///< Message received timestamp [ms]
-} DeferQueueEntry;
+PRIVATE reddfq_InstanceData reddfq_instances[RADEF_MAX_NUMBER_OF_RED_INSTANCES];
 
 /**
- * @brief Typedef for a defer queue.
+ * @brief Data of the selected RedL defer queue instance.
  */
-typedef struct {
-  uint32_t used_defer_queue_entries;                    ///< Number of used defer queue entries [messages]
-  DeferQueueEntry entries[RADEF_MAX_DEFER_QUEUE_SIZE];  ///< Array containing all defer queue entries
-} DeferQueue;
+PRIVATE RADEF_THREAD_LOCAL reddfq_InstanceData *reddfq_instance = &reddfq_instances[0];
 
 // -----------------------------------------------------------------------------
-// Local Variable Definitions
+// Local Function Prototypes
 // -----------------------------------------------------------------------------
 
-PRIVATE bool reddfq_initialized = false;                                   ///< Initialization state of the module. True, if the module is initialized
-PRIVATE uint32_t reddfq_number_of_red_channels = 0U;                       ///< Number of configured redundancy channels
-PRIVATE uint32_t reddfq_defer_queue_size = 0U;                             ///< Configured defer queue size [messages]
-PRIVATE uint32_t reddfq_t_seq = 0U;                                        ///< Configured defer time [ms]
-PRIVATE DeferQueue reddfq_defer_queues[RADEF_MAX_NUMBER_OF_RED_CHANNELS];  ///< Defer queues for all redundancy channels
+/** @addtogroup red_deferQueue
+ * @{
+ */
 
-// -----------------------------------------------------------------------------
-// Local Function Prototypes
-// -----------------------------------------------------------------------------
+/**
+ * @brief Find the defer queue entry of a sequence number.
+ *
+ * This internal function searches the list of the index position of the sequence number and returns the first entry with this sequence number.
+ *
+ * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
+ * @param [in] sequence_number Sequence number to search. The full value range is valid and usable.
+ * @return Entry with the sequence number, ::RADEF_MAX_DEFER_QUEUE_SIZE if no entry is found.
+ */
+static uint16_t FindEntry(const uint32_t red_channel_id, const uint32_t sequence_number);
+
+/**
+ * @brief Remove a used entry from the defer queue.
+ *
+ * This internal function unlinks the entry from its index position and from the received order, marks it as unused and puts it back on the free entry stack.
+ * If the entry contained the oldest sequence number, the next oldest sequence number is searched.
+ *
+ * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
+ * @param [in] entry_index Used defer queue entry. Valid range: 0 <= value < configured defer queue size.
+ */
+static void RemoveEntry(const uint32_t red_channel_id, const uint16_t entry_index);
+
+/**
+ * @brief Update the oldest sequence number after the entry with the oldest sequence number was removed.
+ *
+ * This internal function searches the following sequence numbers in the index, since the messages in the defer queue have usually close sequence numbers. If
+ * none of them is found, all used entries are searched.
+ *
+ * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
+ * @param [in] removed_sequence_number Oldest sequence number, which was removed. The full value range is valid and usable.
+ */
+static void UpdateOldestSequenceNumber(const uint32_t red_channel_id, const uint32_t removed_sequence_number);
+
+/**
+ * @brief Start the defer timer of a redundancy channel for the entry received first.
+ *
+ * This internal function starts the defer timer with the deadline received timestamp + Tseq + 1 of the entry received first, which is the time at which
+ * ::reddfq_IsTimeout() reports a timeout. If the defer queue is empty, the defer timer is stopped.
+ *
+ * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
+ */
+static void StartDeferTimer(const uint32_t red_channel_id);
+
+/** @}*/
 
 // -----------------------------------------------------------------------------
 // Local Constant Definitions
 // -----------------------------------------------------------------------------
 
+static const uint16_t kNoEntry = (uint16_t)RADEF_MAX_DEFER_QUEUE_SIZE;  ///< Entry index, which does not reference an entry
+
 // -----------------------------------------------------------------------------
 // Global Constant Definitions
 // -----------------------------------------------------------------------------
@@ -80,182 +128,195 @@ PRIVATE DeferQueue reddfq_defer_queues[RADEF_MAX_NUMBER_OF_RED_CHANNELS];  ///<
 
 void reddfq_Init(const uint32_t configured_red_channels, const uint32_t configured_defer_queue_size, const uint32_t configured_t_seq) {
   // Input parameter check
-  raas_AssertTrue(!reddfq_initialized, radef_kAlreadyInitialized);
+  raas_AssertTrue(!reddfq_instance->initialized, radef_kAlreadyInitialized);
   raas_AssertU32InRange(configured_red_channels, redcty_kMinNumberOfRedundancyChannels, RADEF_MAX_NUMBER_OF_RED_CHANNELS, radef_kInvalidParameter);
   raas_AssertU32InRange(configured_defer_queue_size, redcty_kMinDeferQueueSize, RADEF_MAX_DEFER_QUEUE_SIZE, radef_kInvalidParameter);
   raas_AssertU32InRange(configured_t_seq, redcty_kMinTSeq, redcty_kMaxTSeq, radef_kInvalidParameter);
 
   // Initialize local variable
-  reddfq_number_of_red_channels = configured_red_channels;
-  reddfq_defer_queue_size = configured_defer_queue_size;
-  reddfq_t_seq = configured_t_seq;
-  reddfq_initialized = true;
+  reddfq_instance->number_of_red_channels = configured_red_channels;
+  reddfq_instance->defer_queue_size = configured_defer_queue_size;
+  reddfq_instance->t_seq = configured_t_seq;
+  ratmw_Init(&reddfq_instance->timer_wheel, reddfq_instance->timers, (uint16_t)configured_red_channels);
+  reddfq_instance->initialized = true;
 
   // Init buffers for all configured channels
-  for (uint32_t index = 0U; index < reddfq_number_of_red_channels; ++index) {
+  for (uint32_t index = 0U; index < reddfq_instance->number_of_red_channels; ++index) {
     reddfq_InitDeferQueue(index);
   }
 }
 
+void reddfq_SelectInstance(const uint32_t instance_index) {
+  // Input parameter check
+  raas_AssertU32InRange(instance_index, 0U, RADEF_MAX_NUMBER_OF_RED_INSTANCES - 1U, radef_kInvalidParameter);
+
+  reddfq_instance = &reddfq_instances[instance_index];
+}
+
 void reddfq_InitDeferQueue(const uint32_t red_channel_id) {
   // Input parameter check
-  raas_AssertTrue(reddfq_initialized, radef_kNotInitialized);
-  raas_AssertU32InRange(red_channel_id, 0U, reddfq_number_of_red_channels - 1U, radef_kInvalidParameter);
+  raas_AssertTrue(reddfq_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(red_channel_id, 0U, reddfq_instance->number_of_red_channels - 1U, radef_kInvalidParameter);
+
+  reddfq_DeferQueue* const defer_queue = &reddfq_instance->defer_queues[red_channel_id];
 
   // Init defer queue
-  reddfq_defer_queues[red_channel_id].used_defer_queue_entries = 0U;
-  for (uint32_t index = 0U; index < reddfq_defer_queue_size; ++index) {
-    reddfq_defer_queues[red_channel_id].entries[index].message.message_size = 0U;  // Message size = 0 means unused defer queue entry
+  defer_queue->used_defer_queue_entries = 0U;
+  defer_queue->oldest_sequence_number = 0U;
+  defer_queue->oldest_received_entry = kNoEntry;
+  defer_queue->newest_received_entry = kNoEntry;
+  for (uint32_t index = 0U; index < reddfq_instance->defer_queue_size; ++index) {
+    defer_queue->entries[index].message.message_size = 0U;  // Message size = 0 means unused defer queue entry
+    defer_queue->free_entry_stack[index] = (uint16_t)(reddfq_instance->defer_queue_size - 1U - index);  // Entry 0 is on top of the stack
+  }
+  for (uint32_t position = 0U; position < RADEF_DEFER_QUEUE_INDEX_SIZE; ++position) {
+    defer_queue->index[position] = kNoEntry;
   }
+  ratmw_StopTimer(&reddfq_instance->timer_wheel, (uint16_t)red_channel_id);
 }
 
 void reddfq_AddMessage(const uint32_t red_channel_id, const redtyp_RedundancyMessage* const redundancy_message) {
   // Input parameter check
-  raas_AssertTrue(reddfq_initialized, radef_kNotInitialized);
-  raas_AssertU32InRange(red_channel_id, 0U, reddfq_number_of_red_channels - 1U, radef_kInvalidParameter);
+  raas_AssertTrue(reddfq_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(red_channel_id, 0U, reddfq_instance->number_of_red_channels - 1U, radef_kInvalidParameter);
   raas_AssertNotNull(redundancy_message, radef_kInvalidParameter);
   raas_AssertU16InRange(redundancy_message->message_size, RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInvalidParameter);
 
+  reddfq_DeferQueue* const defer_queue = &reddfq_instance->defer_queues[red_channel_id];
+
   // Check if there is free space in the defer queue, else ignore the message
-  if (reddfq_defer_queues[red_channel_id].used_defer_queue_entries < reddfq_defer_queue_size) {
-    bool free_entry_found = false;
-    uint32_t queue_index = 0U;
-
-    // Search free defer queue entry for the new message
-    while ((queue_index < reddfq_defer_queue_size) && !free_entry_found) {
-      if (reddfq_defer_queues[red_channel_id].entries[queue_index].message.message_size == 0U) {
-        // Free entry found
-        free_entry_found = true;
-
-        // Copy message
-        DeferQueueEntry* const free_entry_in_queue = &reddfq_defer_queues[red_channel_id].entries[queue_index];
-        free_entry_in_queue->message.message_size = redundancy_message->message_size;
-        for (uint16_t copy_index = 0U; copy_index < free_entry_in_queue->message.message_size; ++copy_index) {
-          free_entry_in_queue->message.message[copy_index] = redundancy_message->message[copy_index];
-        }
-
-        free_entry_in_queue->received_timestamp = rasys_GetTimerValue();  // Set timestamp
-        ++reddfq_defer_queues[red_channel_id].used_defer_queue_entries;
-      }
-      ++queue_index;
+  if (defer_queue->used_defer_queue_entries < reddfq_instance->defer_queue_size) {
+    // Take a free entry from the top of the free entry stack
+    const uint16_t kEntryIndex = defer_queue->free_entry_stack[reddfq_instance->defer_queue_size - defer_queue->used_defer_queue_entries - 1U];
+    raas_AssertTrue(kEntryIndex < reddfq_instance->defer_queue_size, radef_kInternalError);
+    reddfq_DeferQueueEntry* const free_entry_in_queue = &defer_queue->entries[kEntryIndex];
+    raas_AssertTrue(free_entry_in_queue->message.message_size == 0U, radef_kInternalError);  // Raise a fatal error, if the entry is not free
+
+    // Copy message
+    free_entry_in_queue->message.message_size = redundancy_message->message_size;
+    for (uint16_t copy_index = 0U; copy_index < free_entry_in_queue->message.message_size; ++copy_index) {
+      free_entry_in_queue->message.message[copy_index] = redundancy_message->message[copy_index];
+    }
+
+    free_entry_in_queue->received_timestamp = rasys_GetTimerValue();  // Set timestamp
+    free_entry_in_queue->sequence_number = redmsg_GetMessageSequenceNumber(&free_entry_in_queue->message);
+
+    // Link the entry to its index position
+    const uint32_t kPosition = free_entry_in_queue->sequence_number & (RADEF_DEFER_QUEUE_INDEX_SIZE - 1U);
+    free_entry_in_queue->next_in_position = defer_queue->index[kPosition];
+    defer_queue->index[kPosition] = kEntryIndex;
+
+    // Append the entry to the received order
+    free_entry_in_queue->previous_received = defer_queue->newest_received_entry;
+    free_entry_in_queue->next_received = kNoEntry;
+    if (defer_queue->newest_received_entry == kNoEntry) {
+      defer_queue->oldest_received_entry = kEntryIndex;
+      StartDeferTimer(red_channel_id);
+    } else {
+      defer_queue->entries[defer_queue->newest_received_entry].next_received = kEntryIndex;
     }
-    raas_AssertTrue(free_entry_found, radef_kInternalError);  // Raise a fatal error, if here no free space was found in the defer queue
+    defer_queue->newest_received_entry = kEntryIndex;
+
+    // Update the oldest sequence number
+    if ((defer_queue->used_defer_queue_entries == 0U) ||
+        reddfq_IsSequenceNumberOlder(free_entry_in_queue->sequence_number, defer_queue->oldest_sequence_number)) {
+      defer_queue->oldest_sequence_number = free_entry_in_queue->sequence_number;
+    }
+
+    ++defer_queue->used_defer_queue_entries;
   }
 }
 
 void reddfq_GetMessage(const uint32_t red_channel_id, const uint32_t sequence_number, redtyp_RedundancyMessage* const redundancy_message) {
   // Input parameter check
-  raas_AssertTrue(reddfq_initialized, radef_kNotInitialized);
-  raas_AssertU32InRange(red_channel_id, 0U, reddfq_number_of_red_channels - 1U, radef_kInvalidParameter);
+  raas_AssertTrue(reddfq_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(red_channel_id, 0U, reddfq_instance->number_of_red_channels - 1U, radef_kInvalidParameter);
   raas_AssertNotNull(redundancy_message, radef_kInvalidParameter);
 
-  bool message_found = false;
-  uint32_t queue_index = 0U;
-
   // Search message sequence number
-  while ((queue_index < reddfq_defer_queue_size) && !message_found) {
-    if (reddfq_defer_queues[red_channel_id].entries[queue_index].message.message_size != 0U) {  // Is this defer queue entry used?
-      if (redmsg_GetMessageSequenceNumber(&reddfq_defer_queues[red_channel_id].entries[queue_index].message) == sequence_number) {
-        // Message found
-        message_found = true;
-
-        // Check and copy message size
-        redtyp_RedundancyMessage* const message_in_queue = &reddfq_defer_queues[red_channel_id].entries[queue_index].message;
-        raas_AssertU16InRange(message_in_queue->message_size, RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
-        redundancy_message->message_size = message_in_queue->message_size;
-
-        // Copy message
-        for (uint16_t copy_index = 0U; copy_index < redundancy_message->message_size; ++copy_index) {
-          redundancy_message->message[copy_index] = message_in_queue->message[copy_index];
-        }
-
-        // "Remove" message from defer queue
-        message_in_queue->message_size = 0U;
-        --reddfq_defer_queues[red_channel_id].used_defer_queue_entries;
-      }
-    }
-    ++queue_index;
+  const uint16_t kEntryIndex = FindEntry(red_channel_id, sequence_number);
+  raas_AssertTrue(kEntryIndex != kNoEntry, radef_kInvalidSequenceNumber);  // Raise a fatal error, if the message was not found
+
+  // Check and copy message size
+  const redtyp_RedundancyMessage* const kMessageInQueue = &reddfq_instance->defer_queues[red_channel_id].entries[kEntryIndex].message;
+  raas_AssertU16InRange(kMessageInQueue->message_size, RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
+  redundancy_message->message_size = kMessageInQueue->message_size;
+
+  // Copy message
+  for (uint16_t copy_index = 0U; copy_index < redundancy_message->message_size; ++copy_index) {
+    redundancy_message->message[copy_index] = kMessageInQueue->message[copy_index];
   }
-  raas_AssertTrue(message_found, radef_kInvalidSequenceNumber);  // Raise a fatal error, if the message was not found
+
+  // Remove message from defer queue
+  RemoveEntry(red_channel_id, kEntryIndex);
 }
 
 bool reddfq_IsTimeout(const uint32_t red_channel_id) {
   // Input parameter check
-  raas_AssertTrue(reddfq_initialized, radef_kNotInitialized);
-  raas_AssertU32InRange(red_channel_id, 0U, reddfq_number_of_red_channels - 1U, radef_kInvalidParameter);
+  raas_AssertTrue(reddfq_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(red_channel_id, 0U, reddfq_instance->number_of_red_channels - 1U, radef_kInvalidParameter);
 
   bool is_timeout = false;
-  uint32_t index = 0U;
-
-  // Check defer queue timeout
-  while ((index < reddfq_defer_queue_size) && !is_timeout) {
-    if (reddfq_defer_queues[red_channel_id].entries[index].message.message_size != 0U) {  // Is this defer queue entry used?
-      if ((rasys_GetTimerValue() - reddfq_defer_queues[red_channel_id].entries[index].received_timestamp) >
-          reddfq_t_seq) {  // Unsigned integer wrap around allowed in this calculation
-        is_timeout = true;
-      }
+  const uint16_t kOldestReceivedEntry = reddfq_instance->defer_queues[red_channel_id].oldest_received_entry;
+
+  // Check defer queue timeout. The entry received first is the first one to reach the timeout.
+  if (kOldestReceivedEntry != kNoEntry) {
+    if ((rasys_GetTimerValue() - reddfq_instance->defer_queues[red_channel_id].entries[kOldestReceivedEntry].received_timestamp) >
+        reddfq_instance->t_seq) {  // Unsigned integer wrap around allowed in this calculation
+      is_timeout = true;
     }
-    ++index;
   }
 
   return is_timeout;
 }
 
-bool reddfq_Contains(const uint32_t red_channel_id, const uint32_t sequence_number) {
+bool reddfq_GetExpiredChannel(uint32_t* const red_channel_id) {
   // Input parameter check
-  raas_AssertTrue(reddfq_initialized, radef_kNotInitialized);
-  raas_AssertU32InRange(red_channel_id, 0U, reddfq_number_of_red_channels - 1U, radef_kInvalidParameter);
+  raas_AssertTrue(reddfq_instance->initialized, radef_kNotInitialized);
+  raas_AssertNotNull(red_channel_id, radef_kInvalidParameter);
 
-  bool sequence_number_found = false;
-  uint32_t index = 0U;
+  uint16_t timer_id = RATMW_NO_TIMER;
+  const bool kTimerExpired = ratmw_GetExpiredTimer(&reddfq_instance->timer_wheel, rasys_GetTimerValue(), &timer_id);
 
-  // Search message sequence number
-  while ((index < reddfq_defer_queue_size) && !sequence_number_found) {
-    if (reddfq_defer_queues[red_channel_id].entries[index].message.message_size != 0U) {  // Is this defer queue entry used?
-      if (redmsg_GetMessageSequenceNumber(&reddfq_defer_queues[red_channel_id].entries[index].message) == sequence_number) {
-        sequence_number_found = true;
-      }
-    }
-    ++index;
+  if (kTimerExpired) {
+    *red_channel_id = timer_id;
   }
 
-  return sequence_number_found;
+  return kTimerExpired;
+}
+
+bool reddfq_GetTimeToNextDeadline(uint32_t* const time_to_next_deadline) {
+  // Input parameter check
+  raas_AssertTrue(reddfq_instance->initialized, radef_kNotInitialized);
+  raas_AssertNotNull(time_to_next_deadline, radef_kInvalidParameter);
+
+  return ratmw_GetTimeToNextDeadline(&reddfq_instance->timer_wheel, rasys_GetTimerValue(), time_to_next_deadline);
+}
+
+bool reddfq_Contains(const uint32_t red_channel_id, const uint32_t sequence_number) {
+  // Input parameter check
+  raas_AssertTrue(reddfq_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(red_channel_id, 0U, reddfq_instance->number_of_red_channels - 1U, radef_kInvalidParameter);
+
+  return (FindEntry(red_channel_id, sequence_number) != kNoEntry);
 }
 
 uint32_t reddfq_GetOldestSequenceNumber(const uint32_t red_channel_id) {
   // Input parameter check
-  raas_AssertTrue(reddfq_initialized, radef_kNotInitialized);
-  raas_AssertU32InRange(red_channel_id, 0U, reddfq_number_of_red_channels - 1U, radef_kInvalidParameter);
-  raas_AssertTrue(reddfq_defer_queues[red_channel_id].used_defer_queue_entries > 0U, radef_kDeferQueueEmpty);
-  raas_AssertU32InRange(reddfq_defer_queues[red_channel_id].used_defer_queue_entries, 1U, reddfq_defer_queue_size, radef_kInternalError);
-
-  // Search first used defer queue entry and initialize oldest_sequence_number
-  uint32_t search_used_index = 0U;
-  while (reddfq_defer_queues[red_channel_id].entries[search_used_index].message.message_size == 0U) {
-    ++search_used_index;
-    raas_AssertTrue(search_used_index < reddfq_defer_queue_size, radef_kDeferQueueEmpty);
-  }
-  uint32_t oldest_sequence_number = redmsg_GetMessageSequenceNumber(&reddfq_defer_queues[red_channel_id].entries[search_used_index].message);
-
-  // Search oldest message sequence number
-  for (uint32_t search_oldest_index = search_used_index + 1U; search_oldest_index < reddfq_defer_queue_size; ++search_oldest_index) {
-    if (reddfq_defer_queues[red_channel_id].entries[search_oldest_index].message.message_size != 0U) {  // Is this defer queue entry used?
-      const uint32_t kMessageSequenceNumber = redmsg_GetMessageSequenceNumber(&reddfq_defer_queues[red_channel_id].entries[search_oldest_index].message);
-      if (reddfq_IsSequenceNumberOlder(kMessageSequenceNumber, oldest_sequence_number)) {
-        oldest_sequence_number = kMessageSequenceNumber;
-      }
-    }
-  }
+  raas_AssertTrue(reddfq_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(red_channel_id, 0U, reddfq_instance->number_of_red_channels - 1U, radef_kInvalidParameter);
+  raas_AssertTrue(reddfq_instance->defer_queues[red_channel_id].used_defer_queue_entries > 0U, radef_kDeferQueueEmpty);
+  raas_AssertU32InRange(reddfq_instance->defer_queues[red_channel_id].used_defer_queue_entries, 1U, reddfq_instance->defer_queue_size, radef_kInternalError);
 
-  return oldest_sequence_number;
+  return reddfq_instance->defer_queues[red_channel_id].oldest_sequence_number;
 }
 
 uint32_t reddfq_GetUsedEntries(const uint32_t red_channel_id) {
   // Input parameter check
-  raas_AssertTrue(reddfq_initialized, radef_kNotInitialized);
-  raas_AssertU32InRange(red_channel_id, 0U, reddfq_number_of_red_channels - 1U, radef_kInvalidParameter);
+  raas_AssertTrue(reddfq_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(red_channel_id, 0U, reddfq_instance->number_of_red_channels - 1U, radef_kInvalidParameter);
 
-  return reddfq_defer_queues[red_channel_id].used_defer_queue_entries;
+  return reddfq_instance->defer_queues[red_channel_id].used_defer_queue_entries;
 }
 
 bool reddfq_IsSequenceNumberOlder(const uint32_t sequence_number_to_compare, const uint32_t sequence_number_reference) {
@@ -275,3 +336,92 @@ bool reddfq_IsSequenceNumberOlder(const uint32_t sequence_number_to_compare, con
 // -----------------------------------------------------------------------------
 // Local Function Implementations
 // -----------------------------------------------------------------------------
+
+static uint16_t FindEntry(const uint32_t red_channel_id, const uint32_t sequence_number) {
+  const reddfq_DeferQueue* const kDeferQueue = &reddfq_instance->defer_queues[red_channel_id];
+  uint16_t entry_index = kDeferQueue->index[sequence_number & (RADEF_DEFER_QUEUE_INDEX_SIZE - 1U)];
+
+  // Search the entries of the index position
+  while ((entry_index != kNoEntry) && (kDeferQueue->entries[entry_index].sequence_number != sequence_number)) {
+    entry_index = kDeferQueue->entries[entry_index].next_in_position;
+  }
+
+  return entry_index;
+}
+
+static void RemoveEntry(const uint32_t red_channel_id, const uint16_t entry_index) {
+  reddfq_DeferQueue* const defer_queue = &reddfq_instance->defer_queues[red_channel_id];
+  reddfq_DeferQueueEntry* const entry = &defer_queue->entries[entry_index];
+  raas_AssertTrue(defer_queue->used_defer_queue_entries > 0U, radef_kInternalError);
+
+  // Unlink the entry from its index position
+  uint16_t* link_to_entry = &defer_queue->index[entry->sequence_number & (RADEF_DEFER_QUEUE_INDEX_SIZE - 1U)];
+  while (*link_to_entry != entry_index) {
+    raas_AssertTrue(*link_to_entry != kNoEntry, radef_kInternalError);
+    link_to_entry = &defer_queue->entries[*link_to_entry].next_in_position;
+  }
+  *link_to_entry = entry->next_in_position;
+
+  // Unlink the entry from the received order. If the entry received first is removed, the defer timer is started for the next one.
+  if (entry->previous_received == kNoEntry) {
+    defer_queue->oldest_received_entry = entry->next_received;
+    StartDeferTimer(red_channel_id);
+  } else {
+    defer_queue->entries[entry->previous_received].next_received = entry->next_received;
+  }
+  if (entry->next_received == kNoEntry) {
+    defer_queue->newest_received_entry = entry->previous_received;
+  } else {
+    defer_queue->entries[entry->next_received].previous_received = entry->previous_received;
+  }
+
+  // "Remove" message from defer queue and put the entry back on the free entry stack
+  entry->message.message_size = 0U;
+  --defer_queue->used_defer_queue_entries;
+  defer_queue->free_entry_stack[reddfq_instance->defer_queue_size - defer_queue->used_defer_queue_entries - 1U] = entry_index;
+
+  if ((defer_queue->used_defer_queue_entries > 0U) && (entry->sequence_number == defer_queue->oldest_sequence_number)) {
+    UpdateOldestSequenceNumber(red_channel_id, entry->sequence_number);
+  }
+}
+
+static void UpdateOldestSequenceNumber(const uint32_t red_channel_id, const uint32_t removed_sequence_number) {
+  reddfq_DeferQueue* const defer_queue = &reddfq_instance->defer_queues[red_channel_id];
+  bool oldest_found = false;
+
+  // Search the removed and the following sequence numbers in the index
+  for (uint32_t offset = 0U; (offset < reddfq_instance->defer_queue_size) && !oldest_found; ++offset) {
+    const uint32_t kSequenceNumber = removed_sequence_number + offset;  // Unsigned integer wrap around allowed in this calculation
+    if (FindEntry(red_channel_id, kSequenceNumber) != kNoEntry) {
+      defer_queue->oldest_sequence_number = kSequenceNumber;
+      oldest_found = true;
+    }
+  }
+
+  // Search all used entries, if the oldest sequence number is not close to the removed one
+  if (!oldest_found) {
+    uint16_t entry_index = defer_queue->oldest_received_entry;
+    raas_AssertTrue(entry_index != kNoEntry, radef_kInternalError);
+    defer_queue->oldest_sequence_number = defer_queue->entries[entry_index].sequence_number;
+
+    entry_index = defer_queue->entries[entry_index].next_received;
+    while (entry_index != kNoEntry) {
+      if (reddfq_IsSequenceNumberOlder(defer_queue->entries[entry_index].sequence_number, defer_queue->oldest_sequence_number)) {
+        defer_queue->oldest_sequence_number = defer_queue->entries[entry_index].sequence_number;
+      }
+      entry_index = defer_queue->entries[entry_index].next_received;
+    }
+  }
+}
+
+static void StartDeferTimer(const uint32_t red_channel_id) {
+  const uint16_t kOldestReceivedEntry = reddfq_instance->defer_queues[red_channel_id].oldest_received_entry;
+
+  if (kOldestReceivedEntry == kNoEntry) {
+    ratmw_StopTimer(&reddfq_instance->timer_wheel, (uint16_t)red_channel_id);
+  } else {
+    // The deadline is relative to the received timestamp, so that no current timer value is needed
+    ratmw_StartTimer(&reddfq_instance->timer_wheel, (uint16_t)red_channel_id,
+                     reddfq_instance->defer_queues[red_channel_id].entries[kOldestReceivedEntry].received_timestamp, reddfq_instance->t_seq + 1U);
+  }
+}
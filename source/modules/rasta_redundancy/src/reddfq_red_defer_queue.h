@@ -25,6 +25,8 @@
  * - Get the minimum sequence number in the defer queue
  * - Get the number of used defer queue entries
  * .
+ * The messages are found by their sequence number with an index, the earliest timeout is checked on the message received first and the oldest sequence number
+ * is kept up to date while adding and removing messages. Like this, the execution time of the functions does not depend on the defer queue size.
  */
 #ifndef REDDFQ_RED_DEFER_QUEUE_H_
 #define REDDFQ_RED_DEFER_QUEUE_H_
@@ -35,6 +37,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/ratmw_rasta_timer_wheel.h"
 #include "redtyp_red_types.h"  // NOLINT(build/include_subdir)
 
 // -----------------------------------------------------------------------------
@@ -45,6 +49,55 @@
 // Global Type Definitions
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Typedef for a defer queue entry.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  redtyp_RedundancyMessage message;  ///< Redundancy layer PDU message
+  uint32_t received_timestamp;       ///< Message received timestamp [ms]
+  uint32_t sequence_number;          ///< Sequence number of the message
+  uint16_t next_in_position;         ///< Next entry with the same index position (::RADEF_MAX_DEFER_QUEUE_SIZE for none)
+  uint16_t previous_received;        ///< Entry received before this entry (::RADEF_MAX_DEFER_QUEUE_SIZE for none)
+  uint16_t next_received;            ///< Entry received after this entry (::RADEF_MAX_DEFER_QUEUE_SIZE for none)
+} reddfq_DeferQueueEntry;
+//lint -restore
+
+/**
+ * @brief Typedef for a defer queue.
+ *
+ * The index is a ring with ::RADEF_DEFER_QUEUE_INDEX_SIZE positions, which are addressed by the sequence number of the messages. Every position refers to the
+ * first entry of a list of entries with this position. Since the core module only adds messages in a sequence number range of up to ten times the defer queue
+ * size, these lists have usually only one entry. In addition, the used entries are linked in the order they were received, so that the entry with the earliest
+ * timeout is always the first one of this list.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  uint32_t used_defer_queue_entries;                           ///< Number of used defer queue entries [messages]
+  uint32_t oldest_sequence_number;                             ///< Oldest sequence number of all used entries (only valid, if there are used entries)
+  uint16_t oldest_received_entry;                              ///< Entry received first (::RADEF_MAX_DEFER_QUEUE_SIZE for none)
+  uint16_t newest_received_entry;                              ///< Entry received last (::RADEF_MAX_DEFER_QUEUE_SIZE for none)
+  uint16_t free_entry_stack[RADEF_MAX_DEFER_QUEUE_SIZE];       ///< Stack with the free entries (the top is at configured defer queue size - used entries - 1)
+  uint16_t index[RADEF_DEFER_QUEUE_INDEX_SIZE];                ///< First entry of every index position (::RADEF_MAX_DEFER_QUEUE_SIZE for none)
+  reddfq_DeferQueueEntry entries[RADEF_MAX_DEFER_QUEUE_SIZE];  ///< Array containing all defer queue entries
+} reddfq_DeferQueue;
+//lint -restore
+
+/**
+ * @brief Struct for the data of a RedL defer queue instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;                                                  ///< Initialization state of the module. True, if the module is initialized
+  uint32_t number_of_red_channels;                                   ///< Number of configured redundancy channels
+  uint32_t defer_queue_size;                                         ///< Configured defer queue size [messages]
+  uint32_t t_seq;                                                    ///< Configured defer time [ms]
+  reddfq_DeferQueue defer_queues[RADEF_MAX_NUMBER_OF_RED_CHANNELS];  ///< Defer queues for all redundancy channels
+  ratmw_TimerWheel timer_wheel;                                      ///< Timer wheel with the defer timers of all redundancy channels
+  ratmw_Timer timers[RADEF_MAX_NUMBER_OF_RED_CHANNELS];              ///< Defer timer of every redundancy channel (timer id = red. channel id)
+} reddfq_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -72,11 +125,22 @@ extern "C" {
  */
 void reddfq_Init(const uint32_t configured_red_channels, const uint32_t configured_defer_queue_size, const uint32_t configured_t_seq);
 
+/**
+ * @brief Select the RedL defer queue instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the RedL defer queue functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void reddfq_SelectInstance(const uint32_t instance_index);
+
 /**
  * @brief Initialization of the defer queue of a dedicated redundancy channel.
  *
- * This function initializes the defer queue of a given redundancy channel. It resets the number of used elements and sets the
- * message length of all elements in the defer queue to 0, to indicate that these defer queue elements are not used.
+ * This function initializes the defer queue of a given redundancy channel. It resets the number of used elements, the index and the received
+ * order and sets the message length of all elements in the defer queue to 0, to indicate that these defer queue elements are not used. The defer timer of the
+ * redundancy channel is stopped.
  *
  * @pre The defer queue module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
@@ -88,7 +152,7 @@ void reddfq_InitDeferQueue(const uint32_t red_channel_id);
  * @brief Add a redundancy layer message to the defer queue. If the queue is full, the message will be ignored.
  *
  * When there is free space in the defer queue, a RedL message with a current time stamp is added to the buffer. If the defer queue is full, the message is
- * ignored. After adding the message to the defer queue, the number of used entries is updated.
+ * ignored. After adding the message to the defer queue, the number of used entries, the index and the oldest sequence number are updated.
  *
  * @pre The defer queue module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
@@ -120,7 +184,8 @@ void reddfq_GetMessage(const uint32_t red_channel_id, const uint32_t sequence_nu
 /**
  * @brief Check defer queue timeout on a dedicated redundancy channel.
  *
- * This function checks if a message in the defer queue fulfils the defer queue timeout criteria: rasys_GetTimerValue() - message received timestamp > Tseq
+ * This function checks if a message in the defer queue fulfils the defer queue timeout criteria: rasys_GetTimerValue() - message received timestamp > Tseq.
+ * Since all messages have the same timeout, only the message received first is checked.
  *
  * @pre The defer queue module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
@@ -130,6 +195,35 @@ void reddfq_GetMessage(const uint32_t red_channel_id, const uint32_t sequence_nu
  */
 bool reddfq_IsTimeout(const uint32_t red_channel_id);
 
+/**
+ * @brief Get a redundancy channel with an expired defer timer.
+ *
+ * Every redundancy channel has a defer timer, which runs while its defer queue is not empty and expires when ::reddfq_IsTimeout() starts to report a timeout
+ * for the message received first. The defer timer is restarted whenever the message received first is removed from the defer queue. This function returns
+ * one redundancy channel with an expired defer timer. Every expiry is returned only once.
+ *
+ * @pre The defer queue module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [out] red_channel_id Pointer to the redundancy channel identification. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return true, if a redundancy channel with an expired defer timer is returned.
+ * @return false, if no defer timer is expired.
+ */
+bool reddfq_GetExpiredChannel(uint32_t* const red_channel_id);
+
+/**
+ * @brief Get the time until the next deadline of a defer timer.
+ *
+ * This function returns the time until the earliest deadline of the defer timers of all redundancy channels. If a defer timer is expired, the time is 0.
+ *
+ * @pre The defer queue module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [out] time_to_next_deadline Pointer to the time until the next deadline [ms]. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is
+ * thrown.
+ * @return true, if a defer timer is running and the time until its deadline is returned.
+ * @return false, if no defer timer is running.
+ */
+bool reddfq_GetTimeToNextDeadline(uint32_t* const time_to_next_deadline);
+
 /**
  * @brief Checks if a message with a defined sequence number is in the defer queue.
  *
@@ -147,8 +241,9 @@ bool reddfq_Contains(const uint32_t red_channel_id, const uint32_t sequence_numb
 /**
  * @brief Returns the oldest sequence number found in the defer queue.
  *
- * This function searches the oldest sequence number of all messages in the defer queue and returns it. This function takes respect to uint32_t wrap around for
- * up counted sequence numbers. A sequence number is detected to be older, if the difference of two sequence numbers - 1 is < (UINT32_MAX / 2).
+ * This function returns the oldest sequence number of all messages in the defer queue, which is updated when adding and removing messages. This function
+ * takes respect to uint32_t wrap around for up counted sequence numbers. A sequence number is detected to be older, if the difference of two sequence
+ * numbers - 1 is < (UINT32_MAX / 2).
  *
  * @pre The defer queue module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  * @pre The defer queue module must not be empty, otherwise a ::radef_kDeferQueueEmpty fatal error is thrown.
@@ -28,11 +28,17 @@
 #include "rasta_common/rasys_rasta_system_adapter.h"
 #include "rasta_redundancy/redcty_red_config_types.h"
 #include "rasta_redundancy/rednot_red_notifications.h"
+#include "redins_red_instances.h"      // NOLINT(build/include_subdir)
+#include "redrng_red_ingress_rings.h"  // NOLINT(build/include_subdir)
 
 // -----------------------------------------------------------------------------
 // Local Macro Definitions
 // -----------------------------------------------------------------------------
 
+#if (RADEF_MAX_RED_LAYER_N_DIAGNOSIS < 10U) || (RADEF_MAX_RED_LAYER_N_DIAGNOSIS > 1000U)
+#error "RADEF_MAX_RED_LAYER_N_DIAGNOSIS must be in the range from 10 to 1000"
+#endif
+
 // -----------------------------------------------------------------------------
 // Local Type Definitions
 // -----------------------------------------------------------------------------
@@ -42,34 +48,14 @@
 // -----------------------------------------------------------------------------
 
 /**
- * @brief Initialization state of the module. True, if the module is initialized.
- */
-PRIVATE bool reddia_initialized = false;
-
-/**
- * @brief Pointer to redundancy layer configuration.
+ * @brief Data of all RedL diagnostics instances.
  */
-PRIVATE const redcty_RedundancyLayerConfiguration* reddia_redundancy_configuration = NULL;
+PRIVATE reddia_InstanceData reddia_instances[RADEF_MAX_NUMBER_OF_RED_INSTANCES];
 
 /**
- * @brief Timestamps of earliest received messages.
+ * @brief Data of the selected RedL diagnostics instance.
  */
-PRIVATE reddia_ReceivedMessageTimestamp reddia_received_messages_timestamps[RADEF_MAX_NUMBER_OF_RED_CHANNELS][RADEF_MAX_RED_LAYER_N_DIAGNOSIS];
-
-/**
- * @brief Current number of messages in the current diagnosis window.
- */
-PRIVATE uint32_t reddia_current_n_diagnosis[RADEF_MAX_NUMBER_OF_RED_CHANNELS];
-
-/**
- * @brief Diagnostic data of all transport channels.
- */
-PRIVATE radef_TransportChannelDiagnosticData reddia_transport_channel_diagnostic_data[RADEF_MAX_NUMBER_OF_RED_CHANNELS][RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS];
-
-/**
- * @brief ID of the redundancy diagnostics debug logger.
- */
-PRIVATE uint16_t reddia_logger_id;  //lint !e551 (static variable is used only in the DEBUG build for the debug logger)
+PRIVATE RADEF_THREAD_LOCAL reddia_InstanceData* reddia_instance = &reddia_instances[0];
 
 // -----------------------------------------------------------------------------
 // Local Function Prototypes
@@ -92,16 +78,26 @@ PRIVATE uint16_t reddia_logger_id;  //lint !e551 (static variable is used only i
  */
 uint32_t GetTransportChannelIndex(const uint32_t red_channel_id, const uint32_t transport_channel_id);
 
+/**
+ * @brief Build the transport channel lookup table from the redundancy layer configuration.
+ *
+ * All entries of ::reddia_InstanceData::transport_channel_lookup are first marked as not configured. Then the redundancy channel and the transport channel
+ * index of every configured transport channel are stored at the position of its transport channel id.
+ *
+ * @param [in] redundancy_layer_configuration Pointer to the validated redundancy layer configuration data structure.
+ */
+static void BuildTransportChannelLookup(const redcty_RedundancyLayerConfiguration* const redundancy_layer_configuration);
+
 /**
  * @brief Returns true, if a received message timestamp of a message with the given sequence number is already stored. If so, it updates the diagnostic data of
  * the transport channel of the newly received message.
  *
  * First, this function checks if a received message timestamp of a message with the given sequence number is already stored in
- * ::reddia_received_messages_timestamps. If so, ::radef_TransportChannelDiagnosticData.t_drift, ::radef_TransportChannelDiagnosticData.t_drift2 and the
- * ::reddia_ReceivedMessageTimestamp.message_received_flag of the given transport channel are updated.
+ * ::reddia_InstanceData::received_messages_timestamps. If so, ::radef_TransportChannelDiagnosticData.t_drift, ::radef_TransportChannelDiagnosticData.t_drift2
+ * and the ::reddia_ReceivedMessageTimestamp.message_received_flag of the given transport channel are updated.
  *
- * @pre The ::reddia_current_n_diagnosis of the given redundancy channel must be smaller or equal to the configured n_diagnosis, else a ::radef_kInternalError
- * fatal error is thrown.
+ * @pre The ::reddia_InstanceData::current_n_diagnosis of the given redundancy channel must be smaller or equal to the configured n_diagnosis, else a
+ * ::radef_kInternalError fatal error is thrown.
  *
  * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
  * @param [in] transport_channel_id Transport channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_CHANNELS *
@@ -122,8 +118,8 @@ static bool IsSequenceNumberAlreadyReceivedUpdateDiagnosticData(const uint32_t r
  * This Function checks, if the configured diagnosis window is reached for the given redundancy channel. If so, the diagnostic data is collected and the
  * diagnostic notifications are triggered for all associated transport channels by calling rednot_DiagnosticNotification() and subsequently the diagnostic data
  * of this redundancy channel is reset by calling ::reddia_InitRedundancyChannelDiagnostics(). Finally the timestamp, sequence number, transport channel id are
- * stored in ::reddia_received_messages_timestamps and the ::reddia_current_n_diagnosis of this transport channel is increased.
- * If ::reddia_current_n_diagnosis of the given redundancy channel is greater than n_diagnosis a ::radef_kInternalError fatal error is thrown.
+ * stored in ::reddia_InstanceData::received_messages_timestamps and the ::reddia_InstanceData::current_n_diagnosis of this transport channel is increased.
+ * If ::reddia_InstanceData::current_n_diagnosis of the given redundancy channel is greater than n_diagnosis a ::radef_kInternalError fatal error is thrown.
  *
  * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
  * @param [in] transport_channel_id Transport channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_CHANNELS *
@@ -141,6 +137,10 @@ static void AddFirstTimeReceivedMessageDiagnosticData(const uint32_t red_channel
 // Local Constant Definitions
 // -----------------------------------------------------------------------------
 
+static const uint32_t kTransportChannelLookupSize =
+    RADEF_MAX_NUMBER_OF_RED_CHANNELS * RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS;  ///< Number of entries of the transport channel lookup table
+static const uint32_t kNotConfiguredRedChannelId = RADEF_MAX_NUMBER_OF_RED_CHANNELS;  ///< Redundancy channel id of not configured transport channels
+
 // -----------------------------------------------------------------------------
 // Global Constant Definitions
 // -----------------------------------------------------------------------------
@@ -151,57 +151,68 @@ static void AddFirstTimeReceivedMessageDiagnosticData(const uint32_t red_channel
 
 void reddia_InitRedundancyLayerDiagnostics(const redcty_RedundancyLayerConfiguration* const redundancy_layer_configuration) {
   // Input parameter check
-  raas_AssertTrue(!reddia_initialized, radef_kAlreadyInitialized);
+  raas_AssertTrue(!reddia_instance->initialized, radef_kAlreadyInitialized);
   raas_AssertNotNull(redundancy_layer_configuration, radef_kInvalidParameter);
   raas_AssertTrue(reddia_IsConfigurationValid(redundancy_layer_configuration), radef_kInvalidConfiguration);
 
-  reddia_logger_id = ralog_INIT_LOGGER(ralog_kLogLevelNone);
-  ralog_LOG_DEBUG(reddia_logger_id, "Redundancy layer diagnostics init ...\n");
+  reddia_instance->logger_id = ralog_INIT_LOGGER(ralog_kLogLevelNone);
+  ralog_LOG_DEBUG(reddia_instance->logger_id, "Redundancy layer diagnostics init ...\n");
 
   // Initialize local variables
-  reddia_redundancy_configuration = redundancy_layer_configuration;
-  reddia_initialized = true;
+  reddia_instance->redundancy_configuration = redundancy_layer_configuration;
+  BuildTransportChannelLookup(reddia_instance->redundancy_configuration);
+  reddia_instance->initialized = true;
 
   // Initialize diagnostic data for all configured redundancy channels
-  for (uint32_t index = 0U; index < reddia_redundancy_configuration->number_of_redundancy_channels; ++index) {
+  for (uint32_t index = 0U; index < reddia_instance->redundancy_configuration->number_of_redundancy_channels; ++index) {
     reddia_InitRedundancyChannelDiagnostics(index);
   }
 }
 
+void reddia_SelectInstance(const uint32_t instance_index) {
+  // Input parameter check
+  raas_AssertU32InRange(instance_index, 0U, RADEF_MAX_NUMBER_OF_RED_INSTANCES - 1U, radef_kInvalidParameter);
+
+  reddia_instance = &reddia_instances[instance_index];
+}
+
 void reddia_InitRedundancyChannelDiagnostics(const uint32_t red_channel_id) {
   // Input parameter check
-  raas_AssertTrue(reddia_initialized, radef_kNotInitialized);
-  raas_AssertU32InRange(red_channel_id, 0U, reddia_redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInvalidParameter);
+  raas_AssertTrue(reddia_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(red_channel_id, 0U, reddia_instance->redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(reddia_logger_id, "Data init red. channel: %u\n", red_channel_id);
+  ralog_LOG_DEBUG(reddia_instance->logger_id, "Data init red. channel: %u\n", red_channel_id);
 
   // Initialize current messages counter
-  reddia_current_n_diagnosis[red_channel_id] = 0U;
+  reddia_instance->current_n_diagnosis[red_channel_id] = 0U;
 
   // Initialize timestamps data of first received messages
-  for (uint32_t diagnosis_index = 0U; diagnosis_index < reddia_redundancy_configuration->n_diagnosis; ++diagnosis_index) {
-    reddia_received_messages_timestamps[red_channel_id][diagnosis_index].sequence_number = 0U;
-    reddia_received_messages_timestamps[red_channel_id][diagnosis_index].received_time_stamp = 0U;
+  for (uint32_t diagnosis_index = 0U; diagnosis_index < reddia_instance->redundancy_configuration->n_diagnosis; ++diagnosis_index) {
+    reddia_instance->received_messages_timestamps[red_channel_id][diagnosis_index].sequence_number = 0U;
+    reddia_instance->received_messages_timestamps[red_channel_id][diagnosis_index].received_time_stamp = 0U;
     for (uint32_t tr_channel_index = 0U;
-         tr_channel_index < reddia_redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels; ++tr_channel_index) {
-      reddia_received_messages_timestamps[red_channel_id][diagnosis_index].message_received_flag[tr_channel_index] = false;
+         tr_channel_index < reddia_instance->redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels;
+         ++tr_channel_index) {
+      reddia_instance->received_messages_timestamps[red_channel_id][diagnosis_index].message_received_flag[tr_channel_index] = false;
     }
   }
 
   // Initialize transport channels diagnostic data
   for (uint32_t tr_channel_index = 0U;
-       tr_channel_index < reddia_redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels; ++tr_channel_index) {
-    reddia_transport_channel_diagnostic_data[red_channel_id][tr_channel_index].n_diagnosis = 0U;
-    reddia_transport_channel_diagnostic_data[red_channel_id][tr_channel_index].n_missed = 0U;
-    reddia_transport_channel_diagnostic_data[red_channel_id][tr_channel_index].t_drift = 0U;
-    reddia_transport_channel_diagnostic_data[red_channel_id][tr_channel_index].t_drift2 = 0U;
+       tr_channel_index < reddia_instance->redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels;
+       ++tr_channel_index) {
+    reddia_instance->transport_channel_diagnostic_data[red_channel_id][tr_channel_index].n_diagnosis = 0U;
+    reddia_instance->transport_channel_diagnostic_data[red_channel_id][tr_channel_index].n_missed = 0U;
+    reddia_instance->transport_channel_diagnostic_data[red_channel_id][tr_channel_index].t_drift = 0U;
+    reddia_instance->transport_channel_diagnostic_data[red_channel_id][tr_channel_index].t_drift2 = 0U;
+    reddia_instance->transport_channel_diagnostic_data[red_channel_id][tr_channel_index].n_dropped = 0U;
   }
 }
 
 void reddia_UpdateRedundancyChannelDiagnostics(const uint32_t red_channel_id, const uint32_t transport_channel_id, const uint32_t message_sequence_number) {
   // Input parameter check
-  raas_AssertTrue(reddia_initialized, radef_kNotInitialized);
-  raas_AssertU32InRange(red_channel_id, 0U, reddia_redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInvalidParameter);
+  raas_AssertTrue(reddia_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(red_channel_id, 0U, reddia_instance->redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInvalidParameter);
   raas_AssertTrue(reddia_IsTransportChannelIdValid(red_channel_id, transport_channel_id), radef_kInvalidParameter);
 
   const uint32_t kCurrentTime = rasys_GetTimerValue();
@@ -230,6 +241,7 @@ bool reddia_IsConfigurationValid(const redcty_RedundancyLayerConfiguration* cons
                                  RADEF_MAX_NUMBER_OF_RED_CHANNELS)) {
     configuration_valid = false;
   } else {
+    bool transport_channel_id_used[RADEF_MAX_NUMBER_OF_RED_CHANNELS * RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS] = {false};
     for (uint32_t red_channel_index = 0U; red_channel_index < redundancy_layer_configuration->number_of_redundancy_channels; ++red_channel_index) {
       // Check if redundancy cannel id is equal to redundancy channel index
       if (redundancy_layer_configuration->redundancy_channel_configurations[red_channel_index].red_channel_id != red_channel_index) {
@@ -239,13 +251,18 @@ bool reddia_IsConfigurationValid(const redcty_RedundancyLayerConfiguration* cons
                                      redcty_kMinNumberOfTransportChannels, RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS)) {
         configuration_valid = false;
       } else {
-        // Check if transport channel IDs are in the valid range
+        // Check if transport channel IDs are in the valid range and configured only once
         for (uint32_t tr_channel_index = 0U;
              tr_channel_index < redundancy_layer_configuration->redundancy_channel_configurations[red_channel_index].num_transport_channels;
              ++tr_channel_index) {
-          if (!rahlp_IsU32InRange(redundancy_layer_configuration->redundancy_channel_configurations[red_channel_index].transport_channel_ids[tr_channel_index],
-                                  0U, (RADEF_MAX_NUMBER_OF_RED_CHANNELS * RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS) - 1U)) {
+          const uint32_t kTrChannelId =
+              redundancy_layer_configuration->redundancy_channel_configurations[red_channel_index].transport_channel_ids[tr_channel_index];
+          if (!rahlp_IsU32InRange(kTrChannelId, 0U, kTransportChannelLookupSize - 1U)) {
+            configuration_valid = false;
+          } else if (transport_channel_id_used[kTrChannelId]) {
             configuration_valid = false;
+          } else {
+            transport_channel_id_used[kTrChannelId] = true;
           }
         }
       }
@@ -257,76 +274,91 @@ bool reddia_IsConfigurationValid(const redcty_RedundancyLayerConfiguration* cons
 
 bool reddia_IsTransportChannelIdValid(const uint32_t red_channel_id, const uint32_t transport_channel_id) {
   // Input parameter check
-  raas_AssertU32InRange(red_channel_id, 0U, reddia_redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInvalidParameter);
+  raas_AssertU32InRange(red_channel_id, 0U, reddia_instance->redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInvalidParameter);
 
-  // Check if the transport channel id is found in the configuration of this redundancy channel
+  // Check if the transport channel id is associated to this redundancy channel in the transport channel lookup table
   bool transport_channel_id_valid = false;
-  for (uint32_t tr_channel_index = 0U;
-       tr_channel_index < reddia_redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels; ++tr_channel_index) {
-    if (transport_channel_id == reddia_redundancy_configuration->redundancy_channel_configurations[red_channel_id].transport_channel_ids[tr_channel_index]) {
-      transport_channel_id_valid = true;
-    }
+  if (transport_channel_id < kTransportChannelLookupSize) {
+    transport_channel_id_valid = (reddia_instance->transport_channel_lookup[transport_channel_id].red_channel_id == red_channel_id);
   }
 
   return transport_channel_id_valid;
 }
 
+bool reddia_GetAssociatedRedundancyChannel(const uint32_t transport_channel_id, uint32_t* const red_channel_id) {
+  // Input parameter check
+  raas_AssertNotNull(red_channel_id, radef_kInvalidParameter);
+
+  bool red_channel_found = false;
+  if ((transport_channel_id < kTransportChannelLookupSize) &&
+      (reddia_instance->transport_channel_lookup[transport_channel_id].red_channel_id != kNotConfiguredRedChannelId)) {
+    *red_channel_id = reddia_instance->transport_channel_lookup[transport_channel_id].red_channel_id;
+    red_channel_found = true;
+  }
+
+  return red_channel_found;
+}
+
 // -----------------------------------------------------------------------------
 // Local Function Implementations
 // -----------------------------------------------------------------------------
 
 uint32_t GetTransportChannelIndex(const uint32_t red_channel_id, const uint32_t transport_channel_id) {
   // Input parameter check
-  raas_AssertU32InRange(red_channel_id, 0U, reddia_redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
+  raas_AssertU32InRange(red_channel_id, 0U, reddia_instance->redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
+  raas_AssertTrue(reddia_IsTransportChannelIdValid(red_channel_id, transport_channel_id), radef_kInternalError);
 
-  uint32_t tr_channel_index = 0U;
-  bool tr_channel_id_found = false;
+  return reddia_instance->transport_channel_lookup[transport_channel_id].transport_channel_index;
+}
 
-  while ((tr_channel_index < reddia_redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels) &&
-         !tr_channel_id_found) {
-    if (transport_channel_id == reddia_redundancy_configuration->redundancy_channel_configurations[red_channel_id].transport_channel_ids[tr_channel_index]) {
-      tr_channel_id_found = true;
-    } else {
-      ++tr_channel_index;
-    }
+static void BuildTransportChannelLookup(const redcty_RedundancyLayerConfiguration* const redundancy_layer_configuration) {
+  // Mark all transport channels as not configured
+  for (uint32_t tr_channel_id = 0U; tr_channel_id < kTransportChannelLookupSize; ++tr_channel_id) {
+    reddia_instance->transport_channel_lookup[tr_channel_id].red_channel_id = kNotConfiguredRedChannelId;
+    reddia_instance->transport_channel_lookup[tr_channel_id].transport_channel_index = 0U;
   }
 
-  raas_AssertTrue(tr_channel_id_found, radef_kInternalError);
-
-  return tr_channel_index;
+  // Add all configured transport channels
+  for (uint32_t red_channel_index = 0U; red_channel_index < redundancy_layer_configuration->number_of_redundancy_channels; ++red_channel_index) {
+    for (uint32_t tr_channel_index = 0U;
+         tr_channel_index < redundancy_layer_configuration->redundancy_channel_configurations[red_channel_index].num_transport_channels; ++tr_channel_index) {
+      const uint32_t kTrChannelId = redundancy_layer_configuration->redundancy_channel_configurations[red_channel_index].transport_channel_ids[tr_channel_index];
+      reddia_instance->transport_channel_lookup[kTrChannelId].red_channel_id = red_channel_index;
+      reddia_instance->transport_channel_lookup[kTrChannelId].transport_channel_index = tr_channel_index;
+    }
+  }
 }
 
 static bool IsSequenceNumberAlreadyReceivedUpdateDiagnosticData(const uint32_t red_channel_id, const uint32_t transport_channel_id,
                                                                 const uint32_t message_sequence_number, const uint32_t current_time_stamp) {
   // Input parameter check
-  raas_AssertU32InRange(red_channel_id, 0U, reddia_redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
+  raas_AssertU32InRange(red_channel_id, 0U, reddia_instance->redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
   raas_AssertTrue(reddia_IsTransportChannelIdValid(red_channel_id, transport_channel_id), radef_kInternalError);
-  raas_AssertTrue(reddia_current_n_diagnosis[red_channel_id] <= reddia_redundancy_configuration->n_diagnosis, radef_kInternalError);
+  raas_AssertTrue(reddia_instance->current_n_diagnosis[red_channel_id] <= reddia_instance->redundancy_configuration->n_diagnosis, radef_kInternalError);
 
   uint32_t timestamp_loop = 0U;
   bool sequence_number_found = false;
 
   // Search message sequence number in stored timestamps
-  while ((timestamp_loop < reddia_current_n_diagnosis[red_channel_id]) && !sequence_number_found) {
+  while ((timestamp_loop < reddia_instance->current_n_diagnosis[red_channel_id]) && !sequence_number_found) {
     // Start search with the newest message
-    uint32_t timestamp_index = (reddia_current_n_diagnosis[red_channel_id] - 1U) - timestamp_loop;
-    if (message_sequence_number == reddia_received_messages_timestamps[red_channel_id][timestamp_index].sequence_number) {
+    uint32_t timestamp_index = (reddia_instance->current_n_diagnosis[red_channel_id] - 1U) - timestamp_loop;
+    if (message_sequence_number == reddia_instance->received_messages_timestamps[red_channel_id][timestamp_index].sequence_number) {
       // Message sequence number found
       sequence_number_found = true;
       // Update diagnostic data of the current message received transport channel
-      const uint32_t kDeltaTDrift =
-          current_time_stamp -
-          reddia_received_messages_timestamps[red_channel_id][timestamp_index].received_time_stamp;  // Unsigned integer overflow allowed in this calculation
+      // Unsigned integer overflow allowed in this calculation
+      const uint32_t kDeltaTDrift = current_time_stamp - reddia_instance->received_messages_timestamps[red_channel_id][timestamp_index].received_time_stamp;
 
-      ralog_LOG_DEBUG(reddia_logger_id, "Red. channel: %u, Tr. channel: %u, Seq: %u, delta_t_drift: %u\n", red_channel_id, transport_channel_id,
+      ralog_LOG_DEBUG(reddia_instance->logger_id, "Red. channel: %u, Tr. channel: %u, Seq: %u, delta_t_drift: %u\n", red_channel_id, transport_channel_id,
                       message_sequence_number, kDeltaTDrift);
 
-      if (kDeltaTDrift <= reddia_redundancy_configuration->t_seq) {
+      if (kDeltaTDrift <= reddia_instance->redundancy_configuration->t_seq) {
         const uint32_t kTrChannelIndex = GetTransportChannelIndex(red_channel_id, transport_channel_id);
         // Message delay <= Tseq -> calculate and update Tdrift and Tdrift^2
-        reddia_transport_channel_diagnostic_data[red_channel_id][kTrChannelIndex].t_drift += kDeltaTDrift;
-        reddia_transport_channel_diagnostic_data[red_channel_id][kTrChannelIndex].t_drift2 += (kDeltaTDrift * kDeltaTDrift);
-        reddia_received_messages_timestamps[red_channel_id][timestamp_index].message_received_flag[kTrChannelIndex] = true;
+        reddia_instance->transport_channel_diagnostic_data[red_channel_id][kTrChannelIndex].t_drift += kDeltaTDrift;
+        reddia_instance->transport_channel_diagnostic_data[red_channel_id][kTrChannelIndex].t_drift2 += (kDeltaTDrift * kDeltaTDrift);
+        reddia_instance->received_messages_timestamps[red_channel_id][timestamp_index].message_received_flag[kTrChannelIndex] = true;
       }
     } else {
       ++timestamp_loop;
@@ -338,41 +370,52 @@ static bool IsSequenceNumberAlreadyReceivedUpdateDiagnosticData(const uint32_t r
 static void AddFirstTimeReceivedMessageDiagnosticData(const uint32_t red_channel_id, const uint32_t transport_channel_id,
                                                       const uint32_t message_sequence_number, const uint32_t current_time_stamp) {
   // Input parameter check
-  raas_AssertU32InRange(red_channel_id, 0U, reddia_redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
+  raas_AssertU32InRange(red_channel_id, 0U, reddia_instance->redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
   raas_AssertTrue(reddia_IsTransportChannelIdValid(red_channel_id, transport_channel_id), radef_kInternalError);
-  raas_AssertTrue(reddia_current_n_diagnosis[red_channel_id] <= reddia_redundancy_configuration->n_diagnosis, radef_kInternalError);
+  raas_AssertTrue(reddia_instance->current_n_diagnosis[red_channel_id] <= reddia_instance->redundancy_configuration->n_diagnosis, radef_kInternalError);
 
-  if (reddia_current_n_diagnosis[red_channel_id] >= reddia_redundancy_configuration->n_diagnosis) {
+  if (reddia_instance->current_n_diagnosis[red_channel_id] >= reddia_instance->redundancy_configuration->n_diagnosis) {
     // Redundancy channel diagnostic window reached, loop over for all associated transport channels
     for (uint32_t tr_channel_index = 0U;
-         tr_channel_index < reddia_redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels; ++tr_channel_index) {
+         tr_channel_index < reddia_instance->redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels;
+         ++tr_channel_index) {
       // Prepare diagnostic notification data
 
       // Count and update n_missed from timestamps data structure
-      for (uint32_t diagnosis_index = 0U; diagnosis_index < reddia_redundancy_configuration->n_diagnosis; ++diagnosis_index) {
-        if (!reddia_received_messages_timestamps[red_channel_id][diagnosis_index].message_received_flag[tr_channel_index]) {
-          ++reddia_transport_channel_diagnostic_data[red_channel_id][tr_channel_index].n_missed;
+      for (uint32_t diagnosis_index = 0U; diagnosis_index < reddia_instance->redundancy_configuration->n_diagnosis; ++diagnosis_index) {
+        if (!reddia_instance->received_messages_timestamps[red_channel_id][diagnosis_index].message_received_flag[tr_channel_index]) {
+          ++reddia_instance->transport_channel_diagnostic_data[red_channel_id][tr_channel_index].n_missed;
         }
       }
 
       // Update n_diagnosis
-      reddia_transport_channel_diagnostic_data[red_channel_id][tr_channel_index].n_diagnosis = reddia_current_n_diagnosis[red_channel_id];
+      reddia_instance->transport_channel_diagnostic_data[red_channel_id][tr_channel_index].n_diagnosis = reddia_instance->current_n_diagnosis[red_channel_id];
+
+      const uint32_t kTrChannelId =
+          reddia_instance->redundancy_configuration->redundancy_channel_configurations[red_channel_id].transport_channel_ids[tr_channel_index];
+
+#ifdef RADEF_TRANSPORT_INGRESS_RINGS
+      // Take the messages dropped in the ingress ring since the last diagnostic notification
+      reddia_instance->transport_channel_diagnostic_data[red_channel_id][tr_channel_index].n_dropped =
+          redrng_TakeDroppedMessages(redins_GetSelectedInstance(), kTrChannelId);
+#endif
 
       // Send diagnostic notifications
-      const uint32_t kTrChannelId = reddia_redundancy_configuration->redundancy_channel_configurations[red_channel_id].transport_channel_ids[tr_channel_index];
-      rednot_DiagnosticNotification(red_channel_id, kTrChannelId, reddia_transport_channel_diagnostic_data[red_channel_id][tr_channel_index]);
-      ralog_LOG_DEBUG(reddia_logger_id, "Send diag. notification: Red. channel: %u, Tr. channel: %u\n", red_channel_id, transport_channel_id);
+      rednot_DiagnosticNotification(redins_GetSelectedInstance(), red_channel_id, kTrChannelId,
+                                    reddia_instance->transport_channel_diagnostic_data[red_channel_id][tr_channel_index]);
+      ralog_LOG_DEBUG(reddia_instance->logger_id, "Send diag. notification: Red. channel: %u, Tr. channel: %u\n", red_channel_id, transport_channel_id);
     }
     // Clear diagnostic data of this redundancy channel
     reddia_InitRedundancyChannelDiagnostics(red_channel_id);
   }
   // Add first transport channel received message received timestamp
-  ralog_LOG_DEBUG(reddia_logger_id, "Add message: Red. channel: %u, Tr. channel: %u, Seq: %u\n", red_channel_id, transport_channel_id, message_sequence_number);
+  ralog_LOG_DEBUG(reddia_instance->logger_id, "Add message: Red. channel: %u, Tr. channel: %u, Seq: %u\n", red_channel_id, transport_channel_id,
+                  message_sequence_number);
 
-  reddia_received_messages_timestamps[red_channel_id][reddia_current_n_diagnosis[red_channel_id]].received_time_stamp = current_time_stamp;
-  reddia_received_messages_timestamps[red_channel_id][reddia_current_n_diagnosis[red_channel_id]].sequence_number = message_sequence_number;
-  reddia_received_messages_timestamps[red_channel_id][reddia_current_n_diagnosis[red_channel_id]]
+  reddia_instance->received_messages_timestamps[red_channel_id][reddia_instance->current_n_diagnosis[red_channel_id]].received_time_stamp = current_time_stamp;
+  reddia_instance->received_messages_timestamps[red_channel_id][reddia_instance->current_n_diagnosis[red_channel_id]].sequence_number = message_sequence_number;
+  reddia_instance->received_messages_timestamps[red_channel_id][reddia_instance->current_n_diagnosis[red_channel_id]]
       .message_received_flag[GetTransportChannelIndex(red_channel_id, transport_channel_id)] = true;
   // Increase number of messages in this diagnosis window
-  ++reddia_current_n_diagnosis[red_channel_id];
+  ++reddia_instance->current_n_diagnosis[red_channel_id];
 }
@@ -33,6 +33,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "rasta_common/radef_rasta_definitions.h"
 #include "rasta_redundancy/redcty_red_config_types.h"
 
 // -----------------------------------------------------------------------------
@@ -55,6 +56,62 @@ typedef struct {
 } reddia_ReceivedMessageTimestamp;
 //lint -restore
 
+/**
+ * @brief Struct for an entry of the transport channel lookup table.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  uint32_t red_channel_id;           ///< Redundancy channel identification, ::RADEF_MAX_NUMBER_OF_RED_CHANNELS if the transport channel is not configured.
+  uint32_t transport_channel_index;  ///< Index of the transport channel in the configuration of the redundancy channel.
+} reddia_TransportChannelLookupEntry;
+//lint -restore
+
+/**
+ * @brief Struct for the data of a RedL diagnostics instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  /**
+   * @brief Initialization state of the module. True, if the module is initialized.
+   */
+  bool initialized;
+
+  /**
+   * @brief Pointer to redundancy layer configuration.
+   */
+  const redcty_RedundancyLayerConfiguration* redundancy_configuration;
+
+  /**
+   * @brief Timestamps of earliest received messages.
+   */
+  reddia_ReceivedMessageTimestamp received_messages_timestamps[RADEF_MAX_NUMBER_OF_RED_CHANNELS][RADEF_MAX_RED_LAYER_N_DIAGNOSIS];
+
+  /**
+   * @brief Current number of messages in the current diagnosis window.
+   */
+  uint32_t current_n_diagnosis[RADEF_MAX_NUMBER_OF_RED_CHANNELS];
+
+  /**
+   * @brief Diagnostic data of all transport channels.
+   */
+  radef_TransportChannelDiagnosticData transport_channel_diagnostic_data[RADEF_MAX_NUMBER_OF_RED_CHANNELS][RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS];
+
+  /**
+   * @brief Transport channel lookup table, indexed by the transport channel id.
+   *
+   * The table is built at the initialization of the module and maps every configured transport channel id to its redundancy channel and to its index in the
+   * redundancy channel configuration. Since the transport channel ids are limited by the configuration check, also sparse transport channel ids are directly
+   * used as table index.
+   */
+  reddia_TransportChannelLookupEntry transport_channel_lookup[RADEF_MAX_NUMBER_OF_RED_CHANNELS * RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS];
+
+  /**
+   * @brief ID of the redundancy diagnostics debug logger.
+   */
+  uint16_t logger_id;
+} reddia_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -70,8 +127,9 @@ extern "C" {
  * @brief Initialize the RedL diagnostics module.
  *
  * This function is used to initialize the RedL diagnostics module. The validity of the configuration is checked by calling the ::reddia_IsConfigurationValid()
- * function. It saves the passed redundancy layer configuration pointer. For all configured channels, the ::reddia_InitRedundancyChannelDiagnostics() function
- * is called to properly initialize the diagnostic data for all configured channels.
+ * function. It saves the passed redundancy layer configuration pointer and builds the transport channel lookup table, which maps every configured transport
+ * channel id to its redundancy channel and to its index in the redundancy channel configuration. For all configured channels, the
+ * ::reddia_InitRedundancyChannelDiagnostics() function is called to properly initialize the diagnostic data for all configured channels.
  *
  * @pre The RedL diagnostics module must not be initialized, otherwise a ::radef_kAlreadyInitialized fatal error is thrown.
  *
@@ -80,6 +138,16 @@ extern "C" {
  */
 void reddia_InitRedundancyLayerDiagnostics(const redcty_RedundancyLayerConfiguration *const redundancy_layer_configuration);
 
+/**
+ * @brief Select the RedL diagnostics instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the RedL diagnostics functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void reddia_SelectInstance(const uint32_t instance_index);
+
 /**
  * @brief Initialize diagnostic data of a dedicated redundancy channel.
  *
@@ -133,6 +201,7 @@ void reddia_UpdateRedundancyChannelDiagnostics(const uint32_t red_channel_id, co
  * - red_channel_ids are identical to their index in the configuration data structure
  * - ::redcty_kMinNumberOfTransportChannels <= num_transport_channels <= ::RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS
  * - 0 <= transport_channel_ids < (::RADEF_MAX_NUMBER_OF_RED_CHANNELS * ::RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS)
+ * - every transport_channel_id is configured only once over all redundancy channels
  * .
  * @param [in] redundancy_layer_configuration Pointer to redundancy layer configuration data structure. If the pointer is NULL, a ::radef_kInvalidParameter
  * fatal error is thrown.
@@ -144,7 +213,8 @@ bool reddia_IsConfigurationValid(const redcty_RedundancyLayerConfiguration *cons
 /**
  * @brief Checks, if a transport channel identification is valid for a given redundancy channel.
  *
- * This function checks, if a transport channel identification is found in the configuration of a given redundancy channel.
+ * This function checks, if a transport channel identification is found in the configuration of a given redundancy channel. The check is a single access to
+ * the transport channel lookup table, which is built at the initialization of the module.
  *
  * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
  * @param transport_channel_id Transport channel identification to check. The full value range is valid, but if the transport channel is not associated to
@@ -154,6 +224,21 @@ bool reddia_IsConfigurationValid(const redcty_RedundancyLayerConfiguration *cons
  */
 bool reddia_IsTransportChannelIdValid(const uint32_t red_channel_id, const uint32_t transport_channel_id);
 
+/**
+ * @brief Get the associated redundancy channel of a transport channel.
+ *
+ * This function reads the redundancy channel of a transport channel from the transport channel lookup table, which is built at the initialization of the
+ * module.
+ *
+ * @param transport_channel_id Transport channel identification. The full value range is valid, but if the transport channel is not in the configuration of a
+ * redundancy channel, the function returns false.
+ * @param [out] red_channel_id Pointer to the associated redundancy channel identification. It is only written, if the transport channel is configured. If
+ * the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return true, if the transport channel is in the configuration of a redundancy channel
+ * @return false, if the transport channel is not in the configuration of a redundancy channel
+ */
+bool reddia_GetAssociatedRedundancyChannel(const uint32_t transport_channel_id, uint32_t *const red_channel_id);
+
 /** @}*/
 
 #ifdef __cplusplus
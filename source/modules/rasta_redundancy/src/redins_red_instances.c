@@ -0,0 +1,124 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redins_red_instances.c
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Implementation of RaSTA redundancy layer instances module.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "redins_red_instances.h"  // NOLINT(build/include_subdir)
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rasta_common/raas_rasta_assert.h"
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_redundancy/redint_red_interface.h"
+#include "redcor_red_core.h"             // NOLINT(build/include_subdir)
+#include "reddfq_red_defer_queue.h"      // NOLINT(build/include_subdir)
+#include "reddia_red_diagnostics.h"      // NOLINT(build/include_subdir)
+#include "redmsg_red_messages.h"         // NOLINT(build/include_subdir)
+#include "redrbf_red_received_buffer.h"  // NOLINT(build/include_subdir)
+#include "redstm_red_state_machine.h"    // NOLINT(build/include_subdir)
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+#if RADEF_MAX_NUMBER_OF_RED_INSTANCES < 1U
+#error "RADEF_MAX_NUMBER_OF_RED_INSTANCES must be at least 1"
+#endif
+
+// Without RADEF_MULTI_THREADED, the instance selection is shared by all threads of the process, so that only a single instance is safe to use
+#if (RADEF_MAX_NUMBER_OF_RED_INSTANCES != 1U) && !defined(RADEF_MULTI_THREADED)
+#error "More than one RedL instance needs the stack to be built with RADEF_MULTI_THREADED"
+#endif
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Data of all RedL instances.
+ */
+PRIVATE redint_Instance redins_instances[RADEF_MAX_NUMBER_OF_RED_INSTANCES];
+
+/**
+ * @brief Number of created instances.
+ */
+PRIVATE uint32_t redins_number_of_instances = 0U;
+
+/**
+ * @brief Pointer to the selected instance. NULL, if no instance is selected yet.
+ */
+PRIVATE RADEF_THREAD_LOCAL redint_Instance* redins_selected_instance = NULL;
+
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+
+bool redins_IsInstanceAvailable(void) {
+  return redins_number_of_instances < RADEF_MAX_NUMBER_OF_RED_INSTANCES;
+}
+
+redint_Instance* redins_CreateInstance(void) {
+  raas_AssertTrue(redins_IsInstanceAvailable(), radef_kInternalError);
+
+  redint_Instance* const instance = &redins_instances[redins_number_of_instances];
+  instance->instance_index = redins_number_of_instances;
+  ++redins_number_of_instances;
+
+  return instance;
+}
+
+void redins_SelectInstance(redint_Instance* const instance) {
+  // Input parameter check
+  raas_AssertNotNull(instance, radef_kInvalidParameter);
+
+  if (instance != redins_selected_instance) {
+    const uint32_t kInstanceIndex = instance->instance_index;
+
+    redmsg_SelectInstance(kInstanceIndex);
+    reddia_SelectInstance(kInstanceIndex);
+    redrbf_SelectInstance(kInstanceIndex);
+    reddfq_SelectInstance(kInstanceIndex);
+    redcor_SelectInstance(kInstanceIndex);
+    redstm_SelectInstance(kInstanceIndex);
+
+    redins_selected_instance = instance;
+  }
+}
+
+redint_Instance* redins_GetSelectedInstance(void) {
+  return redins_selected_instance;
+}
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
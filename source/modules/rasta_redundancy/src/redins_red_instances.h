@@ -0,0 +1,136 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redins_red_instances.h
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @addtogroup red_instances
+ * @{
+ *
+ * @brief Interface of RaSTA redundancy layer instances module.
+ *
+ * This module manages the ::RADEF_MAX_NUMBER_OF_RED_INSTANCES RedL instances of the process. Every RedL module keeps its data separately for every instance and
+ * works on the data of the selected instance. The interface and the transport notification functions select the instance passed by the caller, before they
+ * call any other RedL module.
+ *
+ * By default, the selection applies to the whole process, so that the stack supports only one instance. Several instances need the stack to be built with
+ * ::RADEF_MULTI_THREADED, where every thread has its own selection. Different instances can then be serviced by different threads at the same time, as long
+ * as every instance is serviced by only one thread at a time. All instances must be created before the threads are started.
+ */
+#ifndef REDINS_RED_INSTANCES_H_
+#define REDINS_RED_INSTANCES_H_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_redundancy/redcty_red_config_types.h"
+#include "rasta_redundancy/redint_red_interface.h"
+#include "redtyp_red_types.h"  // NOLINT(build/include_subdir)
+
+// -----------------------------------------------------------------------------
+// Global Macro Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Maximum number of received messages, whose check codes are checked at once by the received message polling.
+ */
+#define REDINS_POLLING_BATCH_SIZE (4U)
+
+// -----------------------------------------------------------------------------
+// Global Type Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Struct for the data of a RedL instance, which is referenced by the ::redint_Instance handle.
+ */
+//lint -save -e9045 (structures are defined globally)
+struct redint_Instance {
+  uint32_t instance_index;                                             ///< Index of the instance data in the RedL modules
+  bool initialized;                                                    ///< Initialization state of the instance. True, if the instance is initialized.
+  const redcty_RedundancyLayerConfiguration* redundancy_configuration;  ///< Pointer to redundancy layer configuration.
+  uint16_t logger_id;                                                  ///< ID of the redundancy interface debug logger.
+
+  /**
+   * @brief Transport channel indices for received message polling.
+   *
+   * tr_channel_polling_read_indices is used to make sure, that the received message polling continues on the next transport channel, after a polling
+   * interruption due to low received buffer capacity. It prevents from restarting the received message polling always with the first transport channel,
+   * because this could lead to never reading messages form the other transport channels.
+   */
+  uint32_t tr_channel_polling_read_indices[RADEF_MAX_NUMBER_OF_RED_CHANNELS];
+
+  /**
+   * @brief Messages read by the received message polling, whose check codes are not checked yet.
+   *
+   * The received message polling collects up to ::REDINS_POLLING_BATCH_SIZE messages, checks their check codes at once with ::redmsg_CheckMessageCrcBatch
+   * and then processes them in the order they were read. The messages are part of the instance data to keep them off the stack.
+   */
+  redtyp_RedundancyMessage polling_messages[REDINS_POLLING_BATCH_SIZE];
+  uint32_t polling_tr_channel_ids[REDINS_POLLING_BATCH_SIZE];  ///< Transport channels of the messages in polling_messages.
+};
+//lint -restore
+
+// -----------------------------------------------------------------------------
+// Global Const Declarations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Prototypes
+// -----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Check if an instance is available.
+ *
+ * @return true -> an instance is available and can be created with ::redins_CreateInstance
+ * @return false -> all ::RADEF_MAX_NUMBER_OF_RED_INSTANCES instances are already created
+ */
+bool redins_IsInstanceAvailable(void);
+
+/**
+ * @brief Create an instance.
+ *
+ * This function takes the next available instance. The instance is not initialized and none of its data is set, except for the instance index.
+ *
+ * @pre An instance must be available (see ::redins_IsInstanceAvailable), otherwise a ::radef_kInternalError fatal error is thrown.
+ *
+ * @return Pointer to the created instance.
+ */
+redint_Instance* redins_CreateInstance(void);
+
+/**
+ * @brief Select an instance.
+ *
+ * This function selects the instance in all RedL modules, so that all following calls of the RedL modules work on the data of this instance.
+ *
+ * @param [in] instance Pointer to an instance created with ::redins_CreateInstance. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ */
+void redins_SelectInstance(redint_Instance* const instance);
+
+/**
+ * @brief Get the selected instance.
+ *
+ * This function returns the instance selected with ::redins_SelectInstance. The modules pass this instance to the transport interface and the notification
+ * functions.
+ *
+ * @return Pointer to the selected instance. NULL, if no instance is selected yet.
+ */
+redint_Instance* redins_GetSelectedInstance(void);
+
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+#endif  // REDINS_RED_INSTANCES_H_
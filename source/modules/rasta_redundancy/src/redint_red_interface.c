@@ -29,7 +29,10 @@
 #include "rasta_redundancy/redtri_transport_interface.h"
 #include "redcor_red_core.h"             // NOLINT(build/include_subdir)
 #include "reddfq_red_defer_queue.h"      // NOLINT(build/include_subdir)
+#include "redins_red_instances.h"        // NOLINT(build/include_subdir)
+#include "redmsg_red_messages.h"         // NOLINT(build/include_subdir)
 #include "redrbf_red_received_buffer.h"  // NOLINT(build/include_subdir)
+#include "redrng_red_ingress_rings.h"    // NOLINT(build/include_subdir)
 #include "redstm_red_state_machine.h"    // NOLINT(build/include_subdir)
 #include "redtyp_red_types.h"            // NOLINT(build/include_subdir)
 
@@ -41,30 +44,6 @@
 // Local Type Definitions
 // -----------------------------------------------------------------------------
 
-/**
- * @brief Initialization state of this module.
- */
-PRIVATE radef_RaStaReturnCode redint_initialization_state = radef_kNotInitialized;
-
-/**
- * @brief Pointer to redundancy layer configuration.
- */
-PRIVATE const redcty_RedundancyLayerConfiguration* redint_redundancy_configuration = NULL;
-
-/**
- * @brief ID of the redundancy core debug logger.
- */
-PRIVATE uint16_t redint_logger_id;  //lint !e551 (static variable is used only in the DEBUG build for the debug logger)
-
-/**
- * @brief Transport channel indices for received message polling.
- *
- * tr_channel_polling_read_indices is used to make sure, that the received message polling continues on the next transport channel, after a polling
- * interruption due to low received buffer capacity. It prevents from restarting the received message polling always with the first transport channel, because
- * this could lead to never reading messages form the other transport channels.
- */
-PRIVATE uint32_t tr_channel_polling_read_indices[RADEF_MAX_NUMBER_OF_RED_CHANNELS];
-
 // -----------------------------------------------------------------------------
 // Local Variable Definitions
 // -----------------------------------------------------------------------------
@@ -79,26 +58,42 @@ PRIVATE uint32_t tr_channel_polling_read_indices[RADEF_MAX_NUMBER_OF_RED_CHANNEL
  * This function reads and evaluates the received message pending flags of all transport channels associated to the given redundancy channel and returns
  * true, if a received message is pending on any of these transport channels.
  *
+ * @param [in] instance Pointer to the selected RedL instance.
  * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
  * @return true, if a message is pending on this redundancy channel
  * @return false, if no message is pending on this redundancy channel
  */
-static bool IsMessagePending(const uint32_t red_channel_id);
+static bool IsMessagePending(const redint_Instance* const instance, const uint32_t red_channel_id);
 
 /**
  * @brief Polls received messages from the transport channels, copies messages to the input buffer and triggers the state machine for received message
  * processing.
  *
  * This function polls messages from the transport channels. If the received message pending flag is set and the number of free received buffer entries is
- * greater than the number of used defer queue entries, the message is read from the transport channel and copied to the input buffer. Afterwards the state
- * machine is triggered for received message processing.
+ * greater than the number of used defer queue entries plus the number of already read but not yet processed messages, the message is read from the transport
+ * channel. The read messages are collected and processed with ::ProcessPolledMessages, as soon as ::REDINS_POLLING_BATCH_SIZE messages are read, the free
+ * received buffer entries do not suffice for one more message or the polling ends. Since the free received buffer entries are checked again after the
+ * processing, the polling stops at the same message and processes the messages in the same order as a polling, which processes every message immediately.
  * After a polling interruption due to low received buffer capacity, the received message polling continues on the next transport channel. This prevents from
  * restarting the received message polling always with the first transport channel, because this could lead to never reading messages form the other transport
  * channels.
  *
+ * @param [in] instance Pointer to the selected RedL instance.
+ * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
+ */
+static void ReceivedMessagesPolling(redint_Instance* const instance, const uint32_t red_channel_id);
+
+/**
+ * @brief Checks the check codes of the messages read by the received message polling at once and processes the messages.
+ *
+ * This function checks the check codes of the read messages with ::redmsg_CheckMessageCrcBatch. Afterwards every message is copied, together with the result
+ * of its check code check, to the input buffer and the state machine is triggered for received message processing, in the order the messages were read.
+ *
+ * @param [in] instance Pointer to the selected RedL instance.
  * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
+ * @param [in] number_of_messages Number of read messages in instance->polling_messages. Valid range: 1 <= value <= ::REDINS_POLLING_BATCH_SIZE.
  */
-static void ReceivedMessagesPolling(const uint32_t red_channel_id);
+static void ProcessPolledMessages(redint_Instance* const instance, const uint32_t red_channel_id, const uint16_t number_of_messages);
 
 /**
  * @brief Discards all received messages from the transport channels of a given redundancy channel.
@@ -109,9 +104,21 @@ static void ReceivedMessagesPolling(const uint32_t red_channel_id);
  * given redundancy channel, until all messages of all associated transport channels are read and discarded.
  * This function is used to discard all received messages of a redundancy channel, while this redundancy channel is in closed state.
  *
+ * @param [in] instance Pointer to the selected RedL instance.
  * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of channels.
  */
-static void DiscardMessages(const uint32_t red_channel_id);
+static void DiscardMessages(redint_Instance* const instance, const uint32_t red_channel_id);
+
+/**
+ * @brief Select an initialized RedL instance.
+ *
+ * This internal function checks, if the instance is initialized, and selects it in all RedL modules.
+ *
+ * @param [in] instance Pointer to the RedL instance. A NULL pointer is handled like an instance, which is not initialized.
+ * @return true -> the instance is initialized and selected
+ * @return false -> the instance is not initialized
+ */
+static bool SelectInitializedInstance(redint_Instance* const instance);
 
 // -----------------------------------------------------------------------------
 // Local Constant Definitions
@@ -125,52 +132,64 @@ static void DiscardMessages(const uint32_t red_channel_id);
 // Global Function Implementations
 // -----------------------------------------------------------------------------
 
-radef_RaStaReturnCode redint_Init(const redcty_RedundancyLayerConfiguration* const redundancy_layer_configuration) {
+radef_RaStaReturnCode redint_Init(const redcty_RedundancyLayerConfiguration* const redundancy_layer_configuration, redint_Instance** const instance) {
   radef_RaStaReturnCode return_code = radef_kNoError;
 
-  if (redint_initialization_state == radef_kNoError) {
-    return_code = radef_kAlreadyInitialized;
-  } else if (redundancy_layer_configuration == NULL) {
+  if (!redins_IsInstanceAvailable()) {
+    return_code = radef_kAlreadyInitialized;  // All instances are already initialized
+  } else if ((redundancy_layer_configuration == NULL) || (instance == NULL)) {
     return_code = radef_kInvalidParameter;
   } else if (!redcor_IsConfigurationValid(redundancy_layer_configuration)) {
     return_code = radef_kInvalidConfiguration;
   } else {
-    redint_logger_id = ralog_INIT_LOGGER(ralog_kLogLevelNone);
-    ralog_LOG_DEBUG(redint_logger_id, "Redundancy interface init ...\n");
+    redint_Instance* const new_instance = redins_CreateInstance();
+    redins_SelectInstance(new_instance);
 
-    // Initialize redundancy interface module
-    redint_redundancy_configuration = redundancy_layer_configuration;
+    new_instance->logger_id = ralog_INIT_LOGGER(ralog_kLogLevelNone);
+    ralog_LOG_DEBUG(new_instance->logger_id, "Redundancy interface init ...\n");
+
+    // Initialize redundancy interface data of the instance
+    new_instance->redundancy_configuration = redundancy_layer_configuration;
 
     // Initialize internal data
-    for (uint32_t red_channel_index = 0U; red_channel_index < redint_redundancy_configuration->number_of_redundancy_channels; ++red_channel_index) {
-      tr_channel_polling_read_indices[red_channel_index] = 0U;
+    for (uint32_t red_channel_index = 0U; red_channel_index < new_instance->redundancy_configuration->number_of_redundancy_channels; ++red_channel_index) {
+      new_instance->tr_channel_polling_read_indices[red_channel_index] = 0U;
     }
 
     // Initialize other modules
-    redstm_Init(redint_redundancy_configuration->number_of_redundancy_channels);
-    reddfq_Init(redint_redundancy_configuration->number_of_redundancy_channels, redint_redundancy_configuration->n_defer_queue_size,
-                redint_redundancy_configuration->t_seq);
-    redrbf_Init(redint_redundancy_configuration->number_of_redundancy_channels);
-    redcor_Init(redint_redundancy_configuration);
-
-    redint_initialization_state = radef_kNoError;
+    redstm_Init(new_instance->redundancy_configuration->number_of_redundancy_channels);
+    reddfq_Init(new_instance->redundancy_configuration->number_of_redundancy_channels, new_instance->redundancy_configuration->n_defer_queue_size,
+                new_instance->redundancy_configuration->t_seq);
+    redrbf_Init(new_instance->redundancy_configuration->number_of_redundancy_channels);
+    redcor_Init(new_instance->redundancy_configuration);
+#ifdef RADEF_TRANSPORT_INGRESS_RINGS
+    redrng_Init(new_instance);
+#endif
+
+    new_instance->initialized = true;
+    *instance = new_instance;
   }
 
   return return_code;
 }
 
-radef_RaStaReturnCode redint_GetInitializationState(void) {
-  return redint_initialization_state;
+radef_RaStaReturnCode redint_GetInitializationState(const redint_Instance* const instance) {
+  radef_RaStaReturnCode return_code = radef_kNotInitialized;
+
+  if ((instance != NULL) && instance->initialized) {
+    return_code = radef_kNoError;
+  }
+  return return_code;
 }
 
-radef_RaStaReturnCode redint_OpenRedundancyChannel(const uint32_t redundancy_channel_id) {
+radef_RaStaReturnCode redint_OpenRedundancyChannel(redint_Instance* const instance, const uint32_t redundancy_channel_id) {
   radef_RaStaReturnCode return_code = radef_kNoError;
 
-  if (redint_initialization_state == radef_kNoError) {
-    if (rahlp_IsU32InRange(redundancy_channel_id, 0U, redint_redundancy_configuration->number_of_redundancy_channels - 1U)) {
-      ralog_LOG_DEBUG(redint_logger_id, "Open red. channel: %u\n", redundancy_channel_id);
+  if (SelectInitializedInstance(instance)) {
+    if (rahlp_IsU32InRange(redundancy_channel_id, 0U, instance->redundancy_configuration->number_of_redundancy_channels - 1U)) {
+      ralog_LOG_DEBUG(instance->logger_id, "Open red. channel: %u\n", redundancy_channel_id);
 
-      tr_channel_polling_read_indices[redundancy_channel_id] = 0U;
+      instance->tr_channel_polling_read_indices[redundancy_channel_id] = 0U;
       redstm_ProcessChannelStateMachine(redundancy_channel_id, redstm_kRedundancyChannelEventOpen);
     } else {
       return_code = radef_kInvalidParameter;
@@ -182,12 +201,12 @@ radef_RaStaReturnCode redint_OpenRedundancyChannel(const uint32_t redundancy_cha
   return return_code;
 }
 
-radef_RaStaReturnCode redint_CloseRedundancyChannel(const uint32_t redundancy_channel_id) {
+radef_RaStaReturnCode redint_CloseRedundancyChannel(redint_Instance* const instance, const uint32_t redundancy_channel_id) {
   radef_RaStaReturnCode return_code = radef_kNoError;
 
-  if (redint_initialization_state == radef_kNoError) {
-    if (rahlp_IsU32InRange(redundancy_channel_id, 0U, redint_redundancy_configuration->number_of_redundancy_channels - 1U)) {
-      ralog_LOG_DEBUG(redint_logger_id, "Close red. channel: %u\n", redundancy_channel_id);
+  if (SelectInitializedInstance(instance)) {
+    if (rahlp_IsU32InRange(redundancy_channel_id, 0U, instance->redundancy_configuration->number_of_redundancy_channels - 1U)) {
+      ralog_LOG_DEBUG(instance->logger_id, "Close red. channel: %u\n", redundancy_channel_id);
 
       redstm_ProcessChannelStateMachine(redundancy_channel_id, redstm_kRedundancyChannelEventClose);
     } else {
@@ -200,19 +219,20 @@ radef_RaStaReturnCode redint_CloseRedundancyChannel(const uint32_t redundancy_ch
   return return_code;
 }
 
-radef_RaStaReturnCode redint_SendMessage(const uint32_t redundancy_channel_id, const uint16_t message_size, const uint8_t* const message_data) {
+radef_RaStaReturnCode redint_SendMessage(redint_Instance* const instance, const uint32_t redundancy_channel_id, const uint16_t message_size,
+                                         const uint8_t* const message_data) {
   radef_RaStaReturnCode return_code = radef_kNoError;
 
-  if (redint_initialization_state != radef_kNoError) {
+  if (!SelectInitializedInstance(instance)) {
     return_code = radef_kNotInitialized;
   } else if (redstm_GetChannelState(redundancy_channel_id) != redstm_kRedundancyChannelStateUp) {
     return_code = radef_kInvalidOperationInCurrentState;
-  } else if (!rahlp_IsU32InRange(redundancy_channel_id, 0U, redint_redundancy_configuration->number_of_redundancy_channels - 1U) || (message_data == NULL)) {
+  } else if (!rahlp_IsU32InRange(redundancy_channel_id, 0U, instance->redundancy_configuration->number_of_redundancy_channels - 1U) || (message_data == NULL)) {
     return_code = radef_kInvalidParameter;
   } else if (!rahlp_IsU32InRange(message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE)) {
     return_code = radef_kInvalidMessageSize;
   } else {
-    ralog_LOG_DEBUG(redint_logger_id, "Send message red. channel: %u\n", redundancy_channel_id);
+    ralog_LOG_DEBUG(instance->logger_id, "Send message red. channel: %u\n", redundancy_channel_id);
 
     redcor_WriteMessagePayloadToSendBuffer(redundancy_channel_id, message_size, message_data);
     redstm_ProcessChannelStateMachine(redundancy_channel_id, redstm_kRedundancyChannelEventSendData);
@@ -223,19 +243,19 @@ radef_RaStaReturnCode redint_SendMessage(const uint32_t redundancy_channel_id, c
   return return_code;
 }
 
-radef_RaStaReturnCode redint_ReadMessage(const uint32_t redundancy_channel_id, const uint16_t buffer_size, uint16_t* const message_size,
-                                         uint8_t* const message_buffer) {
+radef_RaStaReturnCode redint_ReadMessage(redint_Instance* const instance, const uint32_t redundancy_channel_id, const uint16_t buffer_size,
+                                         uint16_t* const message_size, uint8_t* const message_buffer) {
   radef_RaStaReturnCode return_code = radef_kNoError;
 
-  if (redint_initialization_state != radef_kNoError) {
+  if (!SelectInitializedInstance(instance)) {
     return_code = radef_kNotInitialized;
   } else if (!rahlp_IsU16InRange(buffer_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE)) {
     return_code = radef_kInvalidParameter;
-  } else if (rahlp_IsU32InRange(redundancy_channel_id, 0U, redint_redundancy_configuration->number_of_redundancy_channels - 1U) && (message_size != NULL) &&
+  } else if (rahlp_IsU32InRange(redundancy_channel_id, 0U, instance->redundancy_configuration->number_of_redundancy_channels - 1U) && (message_size != NULL) &&
              (message_buffer != NULL)) {
     return_code = redrbf_ReadFromBuffer(redundancy_channel_id, buffer_size, message_size, message_buffer);
 
-    ralog_LOG_DEBUG(redint_logger_id, "Read message red. channel: %u, return_code %u\n", redundancy_channel_id, return_code);
+    ralog_LOG_DEBUG(instance->logger_id, "Read message red. channel: %u, return_code %u\n", redundancy_channel_id, return_code);
   } else {
     return_code = radef_kInvalidParameter;
   }
@@ -243,24 +263,33 @@ radef_RaStaReturnCode redint_ReadMessage(const uint32_t redundancy_channel_id, c
   return return_code;
 }
 
-radef_RaStaReturnCode redint_CheckTimings(void) {
+radef_RaStaReturnCode redint_CheckTimings(redint_Instance* const instance) {
   radef_RaStaReturnCode return_code = radef_kNoError;
 
-  if (redint_initialization_state == radef_kNoError) {
+  if (SelectInitializedInstance(instance)) {
+#ifdef RADEF_TRANSPORT_INGRESS_RINGS
+    // Take over the transport channels, which received messages from the I/O thread
+    redrng_TakePendingTransportChannels(instance);
+#endif
     // Loop over all configured redundancy channels
-    for (uint32_t red_channel_id = 0U; red_channel_id < redint_redundancy_configuration->number_of_redundancy_channels; ++red_channel_id) {
+    for (uint32_t red_channel_id = 0U; red_channel_id < instance->redundancy_configuration->number_of_redundancy_channels; ++red_channel_id) {
       if (redstm_GetChannelState(red_channel_id) == redstm_kRedundancyChannelStateUp) {
         // Received messages polling
-        ReceivedMessagesPolling(red_channel_id);
-        // Check defer queue timeout
-        if (reddfq_IsTimeout(red_channel_id)) {
-          ralog_LOG_DEBUG(redint_logger_id, "Defer queue timeout red. channel: %u\n", red_channel_id);
-
-          redstm_ProcessChannelStateMachine(red_channel_id, redstm_kRedundancyChannelEventDeferTimeout);
-        }
+        ReceivedMessagesPolling(instance, red_channel_id);
       } else {
         // Discard all received messages, while the redundancy channel is not in up state
-        DiscardMessages(red_channel_id);
+        DiscardMessages(instance, red_channel_id);
+      }
+    }
+
+    // Check defer queue timeout of the redundancy channels with an expired defer timer
+    uint32_t expired_red_channel_id = 0U;
+    while (reddfq_GetExpiredChannel(&expired_red_channel_id)) {
+      // Every defer queue timeout delivers at least the message with the oldest sequence number, so that all timed out messages are delivered here
+      while ((redstm_GetChannelState(expired_red_channel_id) == redstm_kRedundancyChannelStateUp) && reddfq_IsTimeout(expired_red_channel_id)) {
+        ralog_LOG_DEBUG(instance->logger_id, "Defer queue timeout red. channel: %u\n", expired_red_channel_id);
+
+        redstm_ProcessChannelStateMachine(expired_red_channel_id, redstm_kRedundancyChannelEventDeferTimeout);
       }
     }
   } else {
@@ -269,20 +298,36 @@ radef_RaStaReturnCode redint_CheckTimings(void) {
   return return_code;
 }
 
+radef_RaStaReturnCode redint_GetNextDeadline(redint_Instance* const instance, uint32_t* const time_to_next_deadline) {
+  radef_RaStaReturnCode return_code = radef_kNoError;
+
+  if (!SelectInitializedInstance(instance)) {
+    return_code = radef_kNotInitialized;
+  } else if (time_to_next_deadline == NULL) {
+    return_code = radef_kInvalidParameter;
+  } else if (!reddfq_GetTimeToNextDeadline(time_to_next_deadline)) {
+    *time_to_next_deadline = UINT32_MAX;  // No defer timer is running
+  } else {
+    // Time to the next deadline returned by the defer queue module
+  }
+
+  return return_code;
+}
+
 // -----------------------------------------------------------------------------
 // Local Function Implementations
 // -----------------------------------------------------------------------------
 
-static bool IsMessagePending(const uint32_t red_channel_id) {
+static bool IsMessagePending(const redint_Instance* const instance, const uint32_t red_channel_id) {
   // Input parameter check
-  raas_AssertU32InRange(red_channel_id, 0U, redint_redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
+  raas_AssertU32InRange(red_channel_id, 0U, instance->redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
 
   bool message_pending = false;
 
   // Loop over all associated transport channels
   for (uint32_t tr_channel_index = 0U;
-       tr_channel_index < redint_redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels; ++tr_channel_index) {
-    const uint32_t kTrChannelId = redint_redundancy_configuration->redundancy_channel_configurations[red_channel_id].transport_channel_ids[tr_channel_index];
+       tr_channel_index < instance->redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels; ++tr_channel_index) {
+    const uint32_t kTrChannelId = instance->redundancy_configuration->redundancy_channel_configurations[red_channel_id].transport_channel_ids[tr_channel_index];
     if (redcor_GetMessagePendingFlag(red_channel_id, kTrChannelId)) {
       message_pending = true;
     }
@@ -290,61 +335,107 @@ static bool IsMessagePending(const uint32_t red_channel_id) {
   return message_pending;
 }
 
-static void ReceivedMessagesPolling(const uint32_t red_channel_id) {
+static void ReceivedMessagesPolling(redint_Instance* const instance, const uint32_t red_channel_id) {
   // Input parameter check
-  raas_AssertU32InRange(red_channel_id, 0U, redint_redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
+  raas_AssertU32InRange(red_channel_id, 0U, instance->redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
 
+  uint16_t number_of_read_messages = 0U;
   uint16_t free_received_buffer_entries = redrbf_GetFreeBufferEntries(red_channel_id);
   uint32_t used_defer_queue_entries = reddfq_GetUsedEntries(red_channel_id);
-  bool is_message_pending = IsMessagePending(red_channel_id);
-
-  while ((free_received_buffer_entries > used_defer_queue_entries) && is_message_pending) {
-    const uint32_t kTrChannelId = redint_redundancy_configuration->redundancy_channel_configurations[red_channel_id]
-                                      .transport_channel_ids[tr_channel_polling_read_indices[red_channel_id]];
-    if (redcor_GetMessagePendingFlag(red_channel_id, kTrChannelId)) {
-      redtyp_RedundancyMessage received_message;
-      if (radef_kNoError == redtri_ReadMessage(kTrChannelId, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, &received_message.message_size, received_message.message)) {
-        // Message received
-        ralog_LOG_DEBUG(redint_logger_id, "Message received red. channel: %u, tr. channel: %u\n", red_channel_id, kTrChannelId);
-
-        redcor_WriteReceivedMessageToInputBuffer(red_channel_id, kTrChannelId, &received_message);
-        redstm_ProcessChannelStateMachine(red_channel_id, redstm_kRedundancyChannelEventReceiveData);
-        // Clear input buffer message pending flag here, in case the state machine decided to not process the message
-        redcor_ClearInputBufferMessagePendingFlag(red_channel_id);
-      } else {
-        // No more messages pending on this transport channel
-        redcor_ClearMessagePendingFlag(red_channel_id, kTrChannelId);
+  bool is_message_pending = IsMessagePending(instance, red_channel_id);
+
+  // Every read message may use a received buffer or defer queue entry, when it is processed. If the free entries do not suffice for one more message, the
+  // read messages are processed first and the free entries are checked again, since discarded messages use no entry. This reads the same messages as a
+  // polling which processes every message immediately.
+  while (((free_received_buffer_entries > used_defer_queue_entries) || (number_of_read_messages > 0U)) && is_message_pending) {
+    if (free_received_buffer_entries <= (used_defer_queue_entries + number_of_read_messages)) {
+      ProcessPolledMessages(instance, red_channel_id, number_of_read_messages);
+      number_of_read_messages = 0U;
+    } else {
+      const uint32_t kTrChannelId = instance->redundancy_configuration->redundancy_channel_configurations[red_channel_id]
+                                        .transport_channel_ids[instance->tr_channel_polling_read_indices[red_channel_id]];
+      if (redcor_GetMessagePendingFlag(red_channel_id, kTrChannelId)) {
+        redtyp_RedundancyMessage *const received_message = &instance->polling_messages[number_of_read_messages];
+        if (radef_kNoError == redrng_READ_MESSAGE(instance, kTrChannelId, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, &received_message->message_size,
+                                                 received_message->message)) {
+          // Message received
+          ralog_LOG_DEBUG(instance->logger_id, "Message received red. channel: %u, tr. channel: %u\n", red_channel_id, kTrChannelId);
+
+          instance->polling_tr_channel_ids[number_of_read_messages] = kTrChannelId;
+          ++number_of_read_messages;
+          if (number_of_read_messages >= REDINS_POLLING_BATCH_SIZE) {
+            ProcessPolledMessages(instance, red_channel_id, number_of_read_messages);
+            number_of_read_messages = 0U;
+          }
+        } else {
+          // No more messages pending on this transport channel
+          redcor_ClearMessagePendingFlag(red_channel_id, kTrChannelId);
+        }
       }
-    }
 
-    ++tr_channel_polling_read_indices[red_channel_id];
-    // Handle index overflow
-    if (tr_channel_polling_read_indices[red_channel_id] >=
-        redint_redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels) {
-      tr_channel_polling_read_indices[red_channel_id] = 0U;
+      ++instance->tr_channel_polling_read_indices[red_channel_id];
+      // Handle index overflow
+      if (instance->tr_channel_polling_read_indices[red_channel_id] >=
+          instance->redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels) {
+        instance->tr_channel_polling_read_indices[red_channel_id] = 0U;
+      }
     }
 
     // Update variables for loop condition
     free_received_buffer_entries = redrbf_GetFreeBufferEntries(red_channel_id);
     used_defer_queue_entries = reddfq_GetUsedEntries(red_channel_id);
-    is_message_pending = IsMessagePending(red_channel_id);
+    is_message_pending = IsMessagePending(instance, red_channel_id);
+  }
+
+  // Process the remaining read messages
+  if (number_of_read_messages > 0U) {
+    ProcessPolledMessages(instance, red_channel_id, number_of_read_messages);
   }
 }
 
-static void DiscardMessages(const uint32_t red_channel_id) {
+static void ProcessPolledMessages(redint_Instance* const instance, const uint32_t red_channel_id, const uint16_t number_of_messages) {
   // Input parameter check
-  raas_AssertU32InRange(red_channel_id, 0U, redint_redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
+  raas_AssertU16InRange(number_of_messages, 1U, REDINS_POLLING_BATCH_SIZE, radef_kInternalError);
+
+  radef_RaStaReturnCode check_code_results[REDINS_POLLING_BATCH_SIZE];
+  redmsg_CheckMessageCrcBatch(number_of_messages, instance->polling_messages, check_code_results);
+
+  for (uint16_t message_index = 0U; message_index < number_of_messages; ++message_index) {
+    const bool kCheckCodeValid = (radef_kNoError == check_code_results[message_index]);
+    redcor_WriteCheckedMessageToInputBuffer(red_channel_id, instance->polling_tr_channel_ids[message_index], kCheckCodeValid,
+                                            &instance->polling_messages[message_index]);
+    redstm_ProcessChannelStateMachine(red_channel_id, redstm_kRedundancyChannelEventReceiveData);
+    // Clear input buffer message pending flag here, in case the state machine decided to not process the message
+    redcor_ClearInputBufferMessagePendingFlag(red_channel_id);
+  }
+}
+
+static void DiscardMessages(redint_Instance* const instance, const uint32_t red_channel_id) {
+  // Input parameter check
+  raas_AssertU32InRange(red_channel_id, 0U, instance->redundancy_configuration->number_of_redundancy_channels - 1U, radef_kInternalError);
 
   uint32_t tr_channel_index = 0U;
 
-  while (IsMessagePending(red_channel_id) &&
-         (tr_channel_index < redint_redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels)) {
-    const uint32_t kTrChannelId = redint_redundancy_configuration->redundancy_channel_configurations[red_channel_id].transport_channel_ids[tr_channel_index];
+  while (IsMessagePending(instance, red_channel_id) &&
+         (tr_channel_index < instance->redundancy_configuration->redundancy_channel_configurations[red_channel_id].num_transport_channels)) {
+    const uint32_t kTrChannelId = instance->redundancy_configuration->redundancy_channel_configurations[red_channel_id].transport_channel_ids[tr_channel_index];
     redtyp_RedundancyMessage received_message;
-    while (radef_kNoError == redtri_ReadMessage(kTrChannelId, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, &received_message.message_size, received_message.message)) {
+    while (radef_kNoError == redrng_READ_MESSAGE(instance, kTrChannelId, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, &received_message.message_size,
+                                                received_message.message)) {
       // nothing to do, messages are discarded
     }
     redcor_ClearMessagePendingFlag(red_channel_id, kTrChannelId);
     ++tr_channel_index;
   }
 }
+
+static bool SelectInitializedInstance(redint_Instance* const instance) {
+  bool instance_selected = false;
+
+  if (redint_GetInitializationState(instance) == radef_kNoError) {
+    redins_SelectInstance(instance);
+    instance_selected = true;
+  }
+
+  return instance_selected;
+}
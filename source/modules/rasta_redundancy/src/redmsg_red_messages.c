@@ -21,6 +21,7 @@
 
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/raend_rasta_endian.h"
 #include "rasta_common/ralog_rasta_logger.h"
 #include "rasta_common/rasys_rasta_system_adapter.h"
 #include "rasta_redundancy/redcty_red_config_types.h"
@@ -31,6 +32,8 @@
 // Local Macro Definitions
 // -----------------------------------------------------------------------------
 
+#define CRC_BATCH_SIZE (8U)  ///< Maximum number of messages passed at once to ::redcrc_CalculateCrcBatch by ::redmsg_CheckMessageCrcBatch
+
 // -----------------------------------------------------------------------------
 // Local Type Definitions
 // -----------------------------------------------------------------------------
@@ -49,14 +52,14 @@ enum {
 // -----------------------------------------------------------------------------
 
 /**
- * @brief Initialization state of the module. True, if the module is initialized.
+ * @brief Data of all RedL messages instances.
  */
-PRIVATE bool redmsg_initialized = false;
+PRIVATE redmsg_InstanceData redmsg_instances[RADEF_MAX_NUMBER_OF_RED_INSTANCES];
 
 /**
- * @brief Configured check code type.
+ * @brief Data of the selected RedL messages instance.
  */
-PRIVATE redcty_CheckCodeType redmsg_check_code_type;
+PRIVATE RADEF_THREAD_LOCAL redmsg_InstanceData *redmsg_instance = &redmsg_instances[0];
 
 // -----------------------------------------------------------------------------
 // Local Function Prototypes
@@ -69,7 +72,7 @@ PRIVATE redcty_CheckCodeType redmsg_check_code_type;
 /**
  * @brief Set a Uint16 at a specific position in a message
  *
- * This internal function sets a Uint16 byte by byte in little endian format at a given position in a message. If the Uint16 doesn't fit inside the message
+ * This internal function sets a Uint16 word in little endian format at a given position in a message. If the Uint16 doesn't fit inside the message
  * (position + Uint16 byte size > red_message->message_size), a ::radef_kInternalError fatal error message is thrown. red_message->message_size must be set
  * correctly before calling this function.
  *
@@ -82,7 +85,7 @@ static void SetUint16InMessage(const uint16_t position, const uint16_t data, red
 /**
  * @brief Set a Uint32 at a specific position in a message
  *
- * This internal function sets a Uint32 byte by byte in little endian format at a given position in a message. If the Uint32 doesn't fit inside the message
+ * This internal function sets a Uint32 word in little endian format at a given position in a message. If the Uint32 doesn't fit inside the message
  * (position + Uint32 byte size > red_message->message_size), a ::radef_kInternalError fatal error message is thrown. red_message->message_size must be set
  * correctly before calling this function.
  *
@@ -107,7 +110,7 @@ static void SetPayloadDataInMessage(const redtyp_RedundancyMessagePayload *const
 /**
  * @brief Get a Uint16 from a specific position in a message
  *
- * This internal function extracts a Uint16 byte by byte from a given position in the little endian format message. If the Uint16 extends over the size of
+ * This internal function extracts a Uint16 word from a given position in the little endian format message. If the Uint16 extends over the size of
  * the message from the given start position (position + Uint16 byte size > red_message->message_size), a ::radef_kInternalError fatal error message is thrown.
  * red_message->message_size must be set correctly before calling this function.
  *
@@ -121,7 +124,7 @@ static uint16_t GetUint16FromMessage(const redtyp_RedundancyMessage *const red_m
 /**
  * @brief Get a Uint32 from a specific position in a message
  *
- * This internal function extracts a Uint32 byte by byte from a given position in the little endian format message. If the Uint32 extends over the size of
+ * This internal function extracts a Uint32 word from a given position in the little endian format message. If the Uint32 extends over the size of
  * the message from the given start position (position + Uint32 byte size > red_message->message_size), a ::radef_kInternalError fatal error message is thrown.
  * red_message->message_size must be set correctly before calling this function.
  *
@@ -142,6 +145,42 @@ static uint32_t GetUint32FromMessage(const redtyp_RedundancyMessage *const red_m
  */
 static uint16_t GetCheckCodeLength(const redcty_CheckCodeType check_code_type);
 
+/**
+ * @brief Check the input parameters of a received redundancy layer message, before its check code is verified.
+ *
+ * The redundancy_message->message_size must be in the range from ::RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE to ::RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE and equal to
+ * the message size stored in the message, else a ::radef_kInvalidParameter fatal error message is thrown.
+ *
+ * @param [in] redundancy_message pointer to message struct. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ */
+static void AssertReceivedMessage(const redtyp_RedundancyMessage *const redundancy_message);
+
+/**
+ * @brief Compare the check code stored in a redundancy layer message with a calculated CRC.
+ *
+ * @param [in] redundancy_message pointer to message struct. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [in] check_code_length length of the check code [bytes]. Valid values: ::kCheckCodeCrc16Length, ::kCheckCodeCrc32Length. For other values, a
+ * ::radef_kInternalError fatal error is thrown.
+ * @param [in] calculated_crc calculated CRC of the message without check code. The full value range is valid and usable.
+ * @return ::radef_kNoError -> check code is OK
+ * @return ::radef_kInvalidMessageCrc -> wrong check code
+ */
+static radef_RaStaReturnCode VerifyCheckCode(const redtyp_RedundancyMessage *const redundancy_message, const uint16_t check_code_length,
+                                             const uint32_t calculated_crc);
+
+/**
+ * @brief Write the complete message header in a message
+ *
+ * This internal function writes the 8 byte message header (message length, reserve and sequence number) as whole words in little endian format. The message
+ * length is taken from red_message->message_size, which must be set correctly before calling this function. The message size is checked once for the complete
+ * header. If the header doesn't fit inside the message (::RADEF_RED_LAYER_MESSAGE_HEADER_SIZE > red_message->message_size), a ::radef_kInternalError fatal
+ * error message is thrown.
+ *
+ * @param [in] sequence_number Sequence number to write in the message. The full value range is valid and usable.
+ * @param [inout] red_message Pointer to a message, where the header must be written. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ */
+static void EncodeMessageHeader(const uint32_t sequence_number, redtyp_RedundancyMessage *const red_message);
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -169,41 +208,46 @@ static const uint16_t kMsgReserveDataInitValue = 0U;  ///< Reserve data initial
 
 void redmsg_Init(const redcty_CheckCodeType configured_check_code_type) {
   // Input parameter check
-  raas_AssertTrue(!redmsg_initialized, radef_kAlreadyInitialized);
+  raas_AssertTrue(!redmsg_instance->initialized, radef_kAlreadyInitialized);
   raas_AssertU16InRange((uint16_t)configured_check_code_type, (uint16_t)redcty_kCheckCodeMin, (uint16_t)(redcty_kCheckCodeMax)-1U, radef_kInvalidParameter);
 
   // Initialize local variable
-  redmsg_check_code_type = configured_check_code_type;
-  redmsg_initialized = true;
+  redmsg_instance->check_code_type = configured_check_code_type;
+  redmsg_instance->initialized = true;
+
+  // Initialize CRC engine
+  redcrc_Init(&redmsg_instance->crc_engine, redmsg_instance->check_code_type);
+}
+
+void redmsg_SelectInstance(const uint32_t instance_index) {
+  // Input parameter check
+  raas_AssertU32InRange(instance_index, 0U, RADEF_MAX_NUMBER_OF_RED_INSTANCES - 1U, radef_kInvalidParameter);
 
-  // Initialize CRC module
-  redcrc_Init(redmsg_check_code_type);
+  redmsg_instance = &redmsg_instances[instance_index];
 }
 
 void redmsg_CreateMessage(const uint32_t sequence_number, const redtyp_RedundancyMessagePayload *const message_payload,
                           redtyp_RedundancyMessage *const redundancy_message) {
   // Input parameter check
-  raas_AssertTrue(redmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(redmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(message_payload, radef_kInvalidParameter);
   raas_AssertU16InRange(message_payload->payload_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, radef_kInvalidParameter);
   raas_AssertNotNull(redundancy_message, radef_kInvalidParameter);
 
   // Set message header data
   redundancy_message->message_size = kMsgPayloadDataPosition + message_payload->payload_size +
-                                     GetCheckCodeLength(redmsg_check_code_type);  // set message size before calling SetUint16InMessage()
-  SetUint16InMessage(kMsgLengthPosition, redundancy_message->message_size, redundancy_message);
-  SetUint16InMessage(kMsgReservePosition, kMsgReserveDataInitValue, redundancy_message);
-  SetUint32InMessage(kMsgSequenceNbrPosition, sequence_number, redundancy_message);
+                                     GetCheckCodeLength(redmsg_instance->check_code_type);  // set message size before calling EncodeMessageHeader()
+  EncodeMessageHeader(sequence_number, redundancy_message);
 
   // Set message payload data
   SetPayloadDataInMessage(message_payload, redundancy_message);
 
   // Calculate and set check code data
-  uint16_t check_code_length = GetCheckCodeLength(redmsg_check_code_type);
+  uint16_t check_code_length = GetCheckCodeLength(redmsg_instance->check_code_type);
   if (check_code_length > 0U) {
     uint32_t calculated_crc = 0U;
     const uint16_t kMessageLengthWithoutCheckCode = kMsgPayloadDataPosition + message_payload->payload_size;
-    redcrc_CalculateCrc(kMessageLengthWithoutCheckCode, redundancy_message->message, &calculated_crc);
+    redcrc_CalculateCrc(&redmsg_instance->crc_engine, kMessageLengthWithoutCheckCode, redundancy_message->message, &calculated_crc);
     switch (check_code_length) {
       case kCheckCodeCrc32Length:
         SetUint32InMessage(kMessageLengthWithoutCheckCode, calculated_crc, redundancy_message);
@@ -222,61 +266,87 @@ void redmsg_CreateMessage(const uint32_t sequence_number, const redtyp_Redundanc
 
 radef_RaStaReturnCode redmsg_CheckMessageCrc(const redtyp_RedundancyMessage *const redundancy_message) {
   // Input parameter check
-  raas_AssertTrue(redmsg_initialized, radef_kNotInitialized);
-  raas_AssertNotNull(redundancy_message, radef_kInvalidParameter);
-  raas_AssertU16InRange(redundancy_message->message_size, RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInvalidParameter);
-  raas_AssertTrue(redundancy_message->message_size == GetUint16FromMessage(redundancy_message, kMsgLengthPosition), radef_kInvalidParameter);
+  raas_AssertTrue(redmsg_instance->initialized, radef_kNotInitialized);
+  AssertReceivedMessage(redundancy_message);
 
   // Calculate and verify check code data
   radef_RaStaReturnCode return_code = radef_kNoError;
-  uint16_t check_code_length = GetCheckCodeLength(redmsg_check_code_type);
+  uint16_t check_code_length = GetCheckCodeLength(redmsg_instance->check_code_type);
   if (check_code_length > 0U) {
     uint32_t calculated_crc = 0U;
     const uint16_t kMessageLengthWithoutCheckCode = (uint16_t)(redundancy_message->message_size - check_code_length);
-    redcrc_CalculateCrc(kMessageLengthWithoutCheckCode, redundancy_message->message, &calculated_crc);
-    switch (check_code_length) {
-      case kCheckCodeCrc32Length:
-        if (GetUint32FromMessage(redundancy_message, kMessageLengthWithoutCheckCode) != calculated_crc) {
-          return_code = radef_kInvalidMessageCrc;
-        }
-        break;
-      case kCheckCodeCrc16Length:
-        if (GetUint16FromMessage(redundancy_message, kMessageLengthWithoutCheckCode) != (uint16_t)calculated_crc) {
-          return_code = radef_kInvalidMessageCrc;
-        }
-        break;
-        // no coverage start
-      default:
-        rasys_FatalError(radef_kInternalError);
-        break;
-        // no coverage end
-    }
+    redcrc_CalculateCrc(&redmsg_instance->crc_engine, kMessageLengthWithoutCheckCode, redundancy_message->message, &calculated_crc);
+    return_code = VerifyCheckCode(redundancy_message, check_code_length, calculated_crc);
   }
 
   return return_code;
 }
 
+void redmsg_CheckMessageCrcBatch(const uint16_t number_of_messages, const redtyp_RedundancyMessage *const redundancy_messages,
+                                 radef_RaStaReturnCode *const return_codes) {
+  // Input parameter check
+  raas_AssertTrue(redmsg_instance->initialized, radef_kNotInitialized);
+  raas_AssertNotNull(redundancy_messages, radef_kInvalidParameter);
+  raas_AssertNotNull(return_codes, radef_kInvalidParameter);
+  raas_AssertTrue(number_of_messages > 0U, radef_kInvalidParameter);
+  for (uint32_t message_index = 0U; message_index < number_of_messages; ++message_index) {
+    AssertReceivedMessage(&redundancy_messages[message_index]);
+  }
+
+  const uint16_t check_code_length = GetCheckCodeLength(redmsg_instance->check_code_type);
+  if (check_code_length > 0U) {
+    redcrc_CrcBatchEntry crc_batch[CRC_BATCH_SIZE];
+    uint32_t calculated_crcs[CRC_BATCH_SIZE];
+
+    for (uint32_t first_message_index = 0U; first_message_index < number_of_messages; first_message_index += CRC_BATCH_SIZE) {
+      const uint32_t remaining_messages = number_of_messages - first_message_index;
+      const uint16_t batch_size = (uint16_t)((remaining_messages < CRC_BATCH_SIZE) ? remaining_messages : CRC_BATCH_SIZE);
+
+      // Calculate the check codes of all messages of the batch at once
+      for (uint32_t batch_index = 0U; batch_index < batch_size; ++batch_index) {
+        const redtyp_RedundancyMessage *const kMessage = &redundancy_messages[first_message_index + batch_index];
+        crc_batch[batch_index].data_size = (uint16_t)(kMessage->message_size - check_code_length);
+        crc_batch[batch_index].data_buffer = kMessage->message;
+        crc_batch[batch_index].calculated_crc = &calculated_crcs[batch_index];
+      }
+      redcrc_CalculateCrcBatch(&redmsg_instance->crc_engine, batch_size, crc_batch);
+
+      // Verify check code data
+      for (uint32_t batch_index = 0U; batch_index < batch_size; ++batch_index) {
+        const uint32_t message_index = first_message_index + batch_index;
+        return_codes[message_index] = VerifyCheckCode(&redundancy_messages[message_index], check_code_length, calculated_crcs[batch_index]);
+      }
+    }
+  } else {
+    // No check code
+    for (uint32_t message_index = 0U; message_index < number_of_messages; ++message_index) {
+      return_codes[message_index] = radef_kNoError;
+    }
+  }
+}
+
 uint32_t redmsg_GetMessageSequenceNumber(const redtyp_RedundancyMessage *const redundancy_message) {
   // Input parameter check
-  raas_AssertTrue(redmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(redmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(redundancy_message, radef_kInvalidParameter);
   raas_AssertU16InRange(redundancy_message->message_size, RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInvalidParameter);
   raas_AssertTrue(redundancy_message->message_size == GetUint16FromMessage(redundancy_message, kMsgLengthPosition), radef_kInvalidParameter);
 
-  // Get and return the sequence number from the message
-  return GetUint32FromMessage(redundancy_message, kMsgSequenceNbrPosition);
+  // Get and return the sequence number from the message, the message size check above covers the complete header
+  return raend_LoadUint32(&redundancy_message->message[kMsgSequenceNbrPosition]);
 }
 
 void redmsg_GetMessagePayload(const redtyp_RedundancyMessage *const redundancy_message, redtyp_RedundancyMessagePayload *const message_payload) {
   // Input parameter check
-  raas_AssertTrue(redmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(redmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(redundancy_message, radef_kInvalidParameter);
   raas_AssertU16InRange(redundancy_message->message_size, RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInvalidParameter);
   raas_AssertTrue(redundancy_message->message_size == GetUint16FromMessage(redundancy_message, kMsgLengthPosition), radef_kInvalidParameter);
   raas_AssertNotNull(message_payload, radef_kInvalidParameter);
 
   // Extract message data
-  const uint16_t message_payload_size = (uint16_t)(redundancy_message->message_size - (kMsgPayloadDataPosition + GetCheckCodeLength(redmsg_check_code_type)));
+  const uint16_t message_payload_size =
+      (uint16_t)(redundancy_message->message_size - (kMsgPayloadDataPosition + GetCheckCodeLength(redmsg_instance->check_code_type)));
   raas_AssertU16InRange(message_payload_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
 
   message_payload->payload_size = message_payload_size;
@@ -296,8 +366,7 @@ static void SetUint16InMessage(const uint16_t position, const uint16_t data, red
   raas_AssertTrue((position + kByteCountUint16) <= RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
 
   // Write variable in message
-  red_message->message[position + 1U] = (uint8_t)((data >> 8) & 0xFFU);
-  red_message->message[position] = (uint8_t)(data & 0xFFU);
+  raend_StoreUint16(&red_message->message[position], data);
 }
 
 static void SetUint32InMessage(const uint16_t position, const uint32_t data, redtyp_RedundancyMessage *const red_message) {
@@ -307,10 +376,7 @@ static void SetUint32InMessage(const uint16_t position, const uint32_t data, red
   raas_AssertTrue((position + kByteCountUint32) <= RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
 
   // Write variable in message
-  red_message->message[position + 3U] = (uint8_t)((data >> 24) & 0xFFU);
-  red_message->message[position + 2U] = (uint8_t)((data >> 16) & 0xFFU);
-  red_message->message[position + 1U] = (uint8_t)((data >> 8) & 0xFFU);
-  red_message->message[position] = (uint8_t)(data & 0xFFU);
+  raend_StoreUint32(&red_message->message[position], data);
 }
 
 static void SetPayloadDataInMessage(const redtyp_RedundancyMessagePayload *const message_payload, redtyp_RedundancyMessage *const red_message) {
@@ -333,12 +399,7 @@ static uint16_t GetUint16FromMessage(const redtyp_RedundancyMessage *const red_m
   raas_AssertTrue((position + kByteCountUint16) <= RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
 
   // Get variable from message
-  uint16_t data = 0U;
-  for (uint16_t index = 0U; index < kByteCountUint16; ++index) {
-    data += (uint16_t)red_message->message[position + index] << (index * 8U);
-  }
-
-  return data;
+  return raend_LoadUint16(&red_message->message[position]);
 }
 
 static uint32_t GetUint32FromMessage(const redtyp_RedundancyMessage *const red_message, const uint16_t position) {
@@ -348,12 +409,7 @@ static uint32_t GetUint32FromMessage(const redtyp_RedundancyMessage *const red_m
   raas_AssertTrue((position + kByteCountUint32) <= RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
 
   // Get variable from message
-  uint32_t data = 0U;
-  for (uint16_t index = 0U; index < kByteCountUint32; ++index) {
-    data += (uint32_t)red_message->message[position + index] << (index * 8U);
-  }
-
-  return data;
+  return raend_LoadUint32(&red_message->message[position]);
 }
 
 static uint16_t GetCheckCodeLength(const redcty_CheckCodeType check_code_type) {
@@ -380,3 +436,49 @@ static uint16_t GetCheckCodeLength(const redcty_CheckCodeType check_code_type) {
 
   return check_code_length;
 }
+
+static void AssertReceivedMessage(const redtyp_RedundancyMessage *const redundancy_message) {
+  // Input parameter check
+  raas_AssertNotNull(redundancy_message, radef_kInvalidParameter);
+  raas_AssertU16InRange(redundancy_message->message_size, RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInvalidParameter);
+  raas_AssertTrue(redundancy_message->message_size == GetUint16FromMessage(redundancy_message, kMsgLengthPosition), radef_kInvalidParameter);
+}
+
+static radef_RaStaReturnCode VerifyCheckCode(const redtyp_RedundancyMessage *const redundancy_message, const uint16_t check_code_length,
+                                             const uint32_t calculated_crc) {
+  // Input parameter check
+  raas_AssertNotNull(redundancy_message, radef_kInternalError);
+
+  radef_RaStaReturnCode return_code = radef_kNoError;
+  const uint16_t kMessageLengthWithoutCheckCode = (uint16_t)(redundancy_message->message_size - check_code_length);
+  switch (check_code_length) {
+    case kCheckCodeCrc32Length:
+      if (GetUint32FromMessage(redundancy_message, kMessageLengthWithoutCheckCode) != calculated_crc) {
+        return_code = radef_kInvalidMessageCrc;
+      }
+      break;
+    case kCheckCodeCrc16Length:
+      if (GetUint16FromMessage(redundancy_message, kMessageLengthWithoutCheckCode) != (uint16_t)calculated_crc) {
+        return_code = radef_kInvalidMessageCrc;
+      }
+      break;
+      // no coverage start
+    default:
+      rasys_FatalError(radef_kInternalError);
+      break;
+      // no coverage end
+  }
+  return return_code;
+}
+
+static void EncodeMessageHeader(const uint32_t sequence_number, redtyp_RedundancyMessage *const red_message) {
+  // Input parameter check
+  raas_AssertNotNull(red_message, radef_kInternalError);
+  raas_AssertTrue(RADEF_RED_LAYER_MESSAGE_HEADER_SIZE <= red_message->message_size, radef_kInternalError);
+  raas_AssertTrue(red_message->message_size <= RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
+
+  // Write message header in message (little endian format)
+  raend_StoreUint16(&red_message->message[kMsgLengthPosition], red_message->message_size);
+  raend_StoreUint16(&red_message->message[kMsgReservePosition], kMsgReserveDataInitValue);
+  raend_StoreUint32(&red_message->message[kMsgSequenceNbrPosition], sequence_number);
+}
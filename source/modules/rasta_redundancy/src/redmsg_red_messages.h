@@ -30,6 +30,7 @@
 
 #include "rasta_common/radef_rasta_definitions.h"
 #include "rasta_redundancy/redcty_red_config_types.h"
+#include "redcrc_red_crc.h"    // NOLINT(build/include_subdir)
 #include "redtyp_red_types.h"  // NOLINT(build/include_subdir)
 
 // -----------------------------------------------------------------------------
@@ -40,6 +41,17 @@
 // Global Type Definitions
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Struct for the data of a RedL messages instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;                      ///< Initialization state of the module. True, if the module is initialized.
+  redcty_CheckCodeType check_code_type;  ///< Configured check code type.
+  redcrc_CrcEngine crc_engine;           ///< CRC engine of the configured check code type, owned by this module.
+} redmsg_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -63,6 +75,16 @@ extern "C" {
  */
 void redmsg_Init(const redcty_CheckCodeType configured_check_code_type);
 
+/**
+ * @brief Select the RedL messages instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the RedL messages functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void redmsg_SelectInstance(const uint32_t instance_index);
+
 /**
  * @brief Create a new redundancy layer message and calculate the check code.
  *
@@ -103,6 +125,24 @@ void redmsg_CreateMessage(const uint32_t sequence_number, const redtyp_Redundanc
  */
 radef_RaStaReturnCode redmsg_CheckMessageCrc(const redtyp_RedundancyMessage *const redundancy_message);
 
+/**
+ * @brief Check the check codes of several redundancy layer messages at once.
+ *
+ * This function checks the validity of the provided RedL messages like ::redmsg_CheckMessageCrc, but calculates the check codes of the messages together with
+ * ::redcrc_CalculateCrcBatch. The result of every message is identical to the result of ::redmsg_CheckMessageCrc for the same message. All messages are
+ * checked as described in ::redmsg_CheckMessageCrc, before any check code is calculated.
+ *
+ * @pre The messages module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [in] number_of_messages number of messages in the redundancy_messages array. Valid range: 1 <= value. For 0, a ::radef_kInvalidParameter fatal error
+ * is thrown.
+ * @param [in] redundancy_messages pointer to array of message structs. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [out] return_codes pointer to array of number_of_messages return codes, one per message: ::radef_kNoError -> check code is OK,
+ * ::radef_kInvalidMessageCrc -> wrong check code. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ */
+void redmsg_CheckMessageCrcBatch(const uint16_t number_of_messages, const redtyp_RedundancyMessage *const redundancy_messages,
+                                 radef_RaStaReturnCode *const return_codes);
+
 /**
  * @brief Get the sequence number of a redundancy layer message.
  *
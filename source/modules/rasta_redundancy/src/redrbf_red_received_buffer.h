@@ -23,6 +23,7 @@
 // -----------------------------------------------------------------------------
 // Includes
 // -----------------------------------------------------------------------------
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "rasta_common/radef_rasta_definitions.h"
@@ -36,6 +37,30 @@
 // Global Type Definitions
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Struct for redundancy layer received messages payload buffer.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  uint16_t read_idx;                                             ///< buffer read index (next message to read)
+  uint16_t write_idx;                                            ///< buffer write index (next message to write)
+  uint16_t used_elements;                                        ///< current amount of used elements in the buffer [messages]
+  redtyp_RedundancyMessagePayload buffer[RADEF_MAX_N_SEND_MAX];  ///< buffer with the payload of correctly received
+                                                                 ///< messages, waiting for the read from the safety and retransmission layer adapter
+} redrbf_ReceivedBuffer;
+//lint -restore
+
+/**
+ * @brief Struct for the data of a RedL received buffer instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;                                                          ///< Initialization state of the module. True, if the module is initialized.
+  uint32_t number_of_red_channels;                                           ///< Number of configured redundancy channels.
+  redrbf_ReceivedBuffer received_buffers[RADEF_MAX_NUMBER_OF_RED_CHANNELS];  ///< Received buffers for all redundancy channels.
+} redrbf_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -60,6 +85,16 @@ extern "C" {
  */
 void redrbf_Init(const uint32_t configured_red_channels);
 
+/**
+ * @brief Select the RedL received buffer instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the RedL received buffer functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void redrbf_SelectInstance(const uint32_t instance_index);
+
 /**
  * @brief Initialize the received buffer of a dedicated redundancy channel.
  *
@@ -0,0 +1,217 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redrng_red_ingress_rings.c
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Implementation of RaSTA redundancy layer transport ingress rings module.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "redrng_red_ingress_rings.h"  // NOLINT(build/include_subdir)
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rasta_common/raas_rasta_assert.h"
+#include "rasta_common/radef_rasta_definitions.h"
+#include "redcor_red_core.h"       // NOLINT(build/include_subdir)
+#include "redins_red_instances.h"  // NOLINT(build/include_subdir)
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Number of transport channel ids.
+ */
+#define NUMBER_OF_TRANSPORT_CHANNEL_IDS (RADEF_MAX_NUMBER_OF_RED_CHANNELS * RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS)
+
+/**
+ * @brief Number of transport channels marked in one word of the pending bitmap.
+ */
+#define BITS_PER_PENDING_WORD (32U)
+
+/**
+ * @brief Number of words of the pending bitmap.
+ */
+#define NUMBER_OF_PENDING_WORDS ((NUMBER_OF_TRANSPORT_CHANNEL_IDS + BITS_PER_PENDING_WORD - 1U) / BITS_PER_PENDING_WORD)
+
+#if (RADEF_TRANSPORT_INGRESS_RING_SIZE == 0U) || ((RADEF_TRANSPORT_INGRESS_RING_SIZE & (RADEF_TRANSPORT_INGRESS_RING_SIZE - 1U)) != 0U)
+#error "RADEF_TRANSPORT_INGRESS_RING_SIZE must be a power of two"
+#endif
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Struct for a single producer / single consumer ring of received messages.
+ *
+ * The indices run freely and are masked with the ring size to address a message, so that a full ring can be distinguished from an empty ring.
+ */
+typedef struct {
+  atomic_uint write_index;                                                                    ///< Index of the next message to push, written by the producer
+  atomic_uint read_index;                                                                     ///< Index of the next message to read, written by the consumer
+  atomic_uint dropped_messages;                                                               ///< Number of messages dropped because the ring was full
+  uint16_t message_sizes[RADEF_TRANSPORT_INGRESS_RING_SIZE];                                  ///< Sizes of the messages in the ring [bytes]
+  uint8_t messages[RADEF_TRANSPORT_INGRESS_RING_SIZE][RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE];  ///< Data of the messages in the ring
+} IngressRing;
+
+/**
+ * @brief Struct for the ingress rings of a RedL instance.
+ */
+typedef struct {
+  IngressRing rings[NUMBER_OF_TRANSPORT_CHANNEL_IDS];               ///< Ingress ring of every transport channel
+  atomic_uint pending_transport_channels[NUMBER_OF_PENDING_WORDS];  ///< Bitmap of the transport channels with pushed messages
+} InstanceRings;
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Ingress rings of all RedL instances.
+ *
+ * The rings are addressed with the instance index and not with the selected instance, since the producer runs in another thread than the instance.
+ */
+PRIVATE InstanceRings redrng_instances[RADEF_MAX_NUMBER_OF_RED_INSTANCES];
+
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+
+void redrng_Init(const redint_Instance* const instance) {
+  // Input parameter check
+  raas_AssertNotNull(instance, radef_kInvalidParameter);
+
+  InstanceRings* const instance_rings = &redrng_instances[instance->instance_index];
+  for (uint32_t transport_channel_id = 0U; transport_channel_id < NUMBER_OF_TRANSPORT_CHANNEL_IDS; ++transport_channel_id) {
+    atomic_store(&instance_rings->rings[transport_channel_id].write_index, 0U);
+    atomic_store(&instance_rings->rings[transport_channel_id].read_index, 0U);
+    atomic_store(&instance_rings->rings[transport_channel_id].dropped_messages, 0U);
+  }
+  for (uint32_t word_index = 0U; word_index < NUMBER_OF_PENDING_WORDS; ++word_index) {
+    atomic_store(&instance_rings->pending_transport_channels[word_index], 0U);
+  }
+}
+
+bool redrng_PushMessage(const redint_Instance* const instance, const uint32_t transport_channel_id, const uint16_t message_size,
+                        const uint8_t* const message_data) {
+  // Input parameter check
+  raas_AssertNotNull(instance, radef_kInvalidParameter);
+  raas_AssertU32InRange(transport_channel_id, 0U, NUMBER_OF_TRANSPORT_CHANNEL_IDS - 1U, radef_kInvalidParameter);
+  raas_AssertU16InRange(message_size, RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, radef_kInvalidParameter);
+  raas_AssertNotNull(message_data, radef_kInvalidParameter);
+
+  InstanceRings* const instance_rings = &redrng_instances[instance->instance_index];
+  IngressRing* const ring = &instance_rings->rings[transport_channel_id];
+  bool message_pushed = false;
+
+  // Only the producer writes the write index, the read index is acquired to see the messages released by the consumer
+  const uint32_t kWriteIndex = atomic_load_explicit(&ring->write_index, memory_order_relaxed);
+  const uint32_t kReadIndex = atomic_load_explicit(&ring->read_index, memory_order_acquire);
+  if ((kWriteIndex - kReadIndex) < RADEF_TRANSPORT_INGRESS_RING_SIZE) {
+    const uint32_t kPosition = kWriteIndex & (RADEF_TRANSPORT_INGRESS_RING_SIZE - 1U);
+    for (uint16_t index = 0U; index < message_size; ++index) {
+      ring->messages[kPosition][index] = message_data[index];
+    }
+    ring->message_sizes[kPosition] = message_size;
+    atomic_store_explicit(&ring->write_index, kWriteIndex + 1U, memory_order_release);
+    message_pushed = true;
+  } else {
+    // The message is dropped, it is counted for the diagnostic data of the transport channel
+    (void)atomic_fetch_add_explicit(&ring->dropped_messages, 1U, memory_order_relaxed);
+  }
+
+  // Mark the transport channel also if the ring is full, so that the consumer continues to read it
+  const uint32_t kPendingBit = 1U << (transport_channel_id % BITS_PER_PENDING_WORD);
+  (void)atomic_fetch_or_explicit(&instance_rings->pending_transport_channels[transport_channel_id / BITS_PER_PENDING_WORD], kPendingBit,
+                                 memory_order_release);
+
+  return message_pushed;
+}
+
+radef_RaStaReturnCode redrng_ReadMessage(const redint_Instance* const instance, const uint32_t transport_channel_id, const uint16_t buffer_size,
+                                         uint16_t* const message_size, uint8_t* const message_buffer) {
+  // Input parameter check
+  raas_AssertNotNull(instance, radef_kInvalidParameter);
+  raas_AssertU32InRange(transport_channel_id, 0U, NUMBER_OF_TRANSPORT_CHANNEL_IDS - 1U, radef_kInvalidParameter);
+  raas_AssertNotNull(message_size, radef_kInvalidParameter);
+  raas_AssertNotNull(message_buffer, radef_kInvalidParameter);
+
+  IngressRing* const ring = &redrng_instances[instance->instance_index].rings[transport_channel_id];
+  radef_RaStaReturnCode ret = radef_kNoMessageReceived;
+
+  // Only the consumer writes the read index, the write index is acquired to see the messages released by the producer
+  const uint32_t kReadIndex = atomic_load_explicit(&ring->read_index, memory_order_relaxed);
+  const uint32_t kWriteIndex = atomic_load_explicit(&ring->write_index, memory_order_acquire);
+  if (kReadIndex != kWriteIndex) {
+    const uint32_t kPosition = kReadIndex & (RADEF_TRANSPORT_INGRESS_RING_SIZE - 1U);
+    raas_AssertTrue(ring->message_sizes[kPosition] <= buffer_size, radef_kInvalidBufferSize);
+
+    for (uint16_t index = 0U; index < ring->message_sizes[kPosition]; ++index) {
+      message_buffer[index] = ring->messages[kPosition][index];
+    }
+    *message_size = ring->message_sizes[kPosition];
+    atomic_store_explicit(&ring->read_index, kReadIndex + 1U, memory_order_release);
+    ret = radef_kNoError;
+  }
+
+  return ret;
+}
+
+uint32_t redrng_TakeDroppedMessages(const redint_Instance* const instance, const uint32_t transport_channel_id) {
+  // Input parameter check
+  raas_AssertNotNull(instance, radef_kInvalidParameter);
+  raas_AssertU32InRange(transport_channel_id, 0U, NUMBER_OF_TRANSPORT_CHANNEL_IDS - 1U, radef_kInvalidParameter);
+
+  return atomic_exchange_explicit(&redrng_instances[instance->instance_index].rings[transport_channel_id].dropped_messages, 0U, memory_order_relaxed);
+}
+
+void redrng_TakePendingTransportChannels(const redint_Instance* const instance) {
+  // Input parameter check
+  raas_AssertNotNull(instance, radef_kInvalidParameter);
+
+  InstanceRings* const instance_rings = &redrng_instances[instance->instance_index];
+  for (uint32_t word_index = 0U; word_index < NUMBER_OF_PENDING_WORDS; ++word_index) {
+    uint32_t pending_bits = atomic_exchange_explicit(&instance_rings->pending_transport_channels[word_index], 0U, memory_order_acquire);
+
+    uint32_t bit_index = 0U;
+    while (pending_bits != 0U) {
+      if ((pending_bits & 1U) != 0U) {
+        const uint32_t kTransportChannelId = (word_index * BITS_PER_PENDING_WORD) + bit_index;
+        uint32_t red_channel_id = 0U;
+        redcor_GetAssociatedRedundancyChannel(kTransportChannelId, &red_channel_id);
+        redcor_SetMessagePendingFlag(red_channel_id, kTransportChannelId);
+      }
+      pending_bits >>= 1U;
+      ++bit_index;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
@@ -0,0 +1,147 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redrng_red_ingress_rings.h
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @addtogroup red_ingress_rings
+ * @{
+ *
+ * @brief Interface of RaSTA redundancy layer transport ingress rings module.
+ *
+ * If the stack is built with RADEF_TRANSPORT_INGRESS_RINGS (CMake option RASTA_TRANSPORT_INGRESS_RINGS), the transport layer does not notify the RedL about
+ * received messages and does not provide them with ::redtri_ReadMessage. Instead, an I/O thread of the transport layer pushes the received messages with
+ * ::redtrn_PushReceivedMessage into an ingress ring of the transport channel. Every transport channel has its own single producer / single consumer ring of
+ * ::RADEF_TRANSPORT_INGRESS_RING_SIZE messages, with the I/O thread as producer and the thread running the RedL instance as consumer. After a message is
+ * pushed, the transport channel is marked in the pending bitmap of the instance. ::redint_CheckTimings takes over the marked transport channels into the
+ * message pending flags of the core module and reads the messages from the rings, like it reads them from the transport layer otherwise. A message pushed into
+ * a full ring is dropped. ::redtrn_PushReceivedMessage returns ::radef_kReceiveBufferFull for it and the dropped messages of a transport channel are reported
+ * in ::radef_TransportChannelDiagnosticData.n_dropped of its next diagnostic notification.
+ *
+ * The ring indices and the pending bitmap are only accessed with C11 atomic operations, so that no lock is needed and no message notification is lost: a
+ * transport channel is marked after its message is stored and the mark is taken before the ring is read empty.
+ */
+#ifndef REDRNG_RED_INGRESS_RINGS_H_
+#define REDRNG_RED_INGRESS_RINGS_H_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_redundancy/redint_red_interface.h"
+#include "rasta_redundancy/redtri_transport_interface.h"
+
+// -----------------------------------------------------------------------------
+// Global Macro Definitions
+// -----------------------------------------------------------------------------
+
+#ifdef RADEF_TRANSPORT_INGRESS_RINGS
+/**
+ * @brief Read a received message of a transport channel from its ingress ring.
+ */
+#define redrng_READ_MESSAGE(instance, transport_channel_id, buffer_size, message_size, message_buffer) \
+  redrng_ReadMessage(instance, transport_channel_id, buffer_size, message_size, message_buffer)  //lint !e9026 (function like macro selects the message source)
+#else
+/**
+ * @brief Read a received message of a transport channel from the transport layer.
+ */
+#define redrng_READ_MESSAGE(instance, transport_channel_id, buffer_size, message_size, message_buffer) \
+  redtri_ReadMessage(instance, transport_channel_id, buffer_size, message_size, message_buffer)  //lint !e9026 (function like macro selects the message source)
+#endif
+
+// -----------------------------------------------------------------------------
+// Global Type Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Const Declarations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Prototypes
+// -----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Initialize the ingress rings of an instance.
+ *
+ * This function empties all ingress rings, clears their counts of dropped messages and clears the pending bitmap of the instance. It must be called before the I/O thread starts to push messages.
+ *
+ * @param [in] instance Pointer to the RedL instance. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ */
+void redrng_Init(const redint_Instance* const instance);
+
+/**
+ * @brief Push a received message into the ingress ring of a transport channel.
+ *
+ * This function is called by the producer of the ring. It copies the message into the ring and marks the transport channel in the pending bitmap of the
+ * instance. If the ring is full, the message is dropped and counted for ::redrng_TakeDroppedMessages. It does not access the data of any other RedL module, so
+ * that it can be called concurrently to the functions of the instance.
+ *
+ * @param [in] instance Pointer to the RedL instance. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] transport_channel_id Transport channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_CHANNELS *
+ * ::RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS. If the value is out of range, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] message_size Size of the message data [bytes]. Valid range: ::RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE <= value <=
+ * ::RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE. If the value is out of range, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] message_data Pointer to the message data. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return true -> message pushed
+ * @return false -> the ring is full, the message is not pushed
+ */
+bool redrng_PushMessage(const redint_Instance* const instance, const uint32_t transport_channel_id, const uint16_t message_size,
+                        const uint8_t* const message_data);
+
+/**
+ * @brief Read a received message from the ingress ring of a transport channel.
+ *
+ * This function is called by the consumer of the ring. It has the same interface as ::redtri_ReadMessage.
+ *
+ * @param [in] instance Pointer to the RedL instance. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] transport_channel_id Transport channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_CHANNELS *
+ * ::RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS. If the value is out of range, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] buffer_size Size of the buffer [bytes]. If the buffer is smaller than the message, a ::radef_kInvalidBufferSize fatal error is thrown.
+ * @param [out] message_size Pointer to the size of the received message data [bytes]. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is
+ * thrown.
+ * @param [out] message_buffer Pointer to a buffer for saving the received message. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return radef_kNoError -> successful operation
+ * @return radef_kNoMessageReceived -> ring empty
+ */
+radef_RaStaReturnCode redrng_ReadMessage(const redint_Instance* const instance, const uint32_t transport_channel_id, const uint16_t buffer_size,
+                                         uint16_t* const message_size, uint8_t* const message_buffer);
+
+/**
+ * @brief Take the number of dropped messages of a transport channel.
+ * This function is called by the consumer of the ring. It returns the number of messages, which are dropped because the ring was full, since the last call
+ * and resets the count.
+ * @param [in] instance Pointer to the RedL instance. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] transport_channel_id Transport channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_CHANNELS *
+ * ::RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS. If the value is out of range, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return Number of dropped messages since the last call
+ */
+uint32_t redrng_TakeDroppedMessages(const redint_Instance* const instance, const uint32_t transport_channel_id);
+
+/**
+ * @brief Take over the pending transport channels of an instance.
+ *
+ * This function clears the pending bitmap of the instance and sets the message pending flag of every marked transport channel with
+ * ::redcor_SetMessagePendingFlag. The instance must be selected.
+ *
+ * @param [in] instance Pointer to the selected RedL instance. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ */
+void redrng_TakePendingTransportChannels(const redint_Instance* const instance);
+
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+#endif  // REDRNG_RED_INGRESS_RINGS_H_
@@ -39,20 +39,14 @@
 // -----------------------------------------------------------------------------
 
 /**
- * @brief Initialization state of the module. True, if the module is initialized.
+ * @brief Data of all RedL state machine instances.
  */
-PRIVATE bool redstm_initialized = false;
+PRIVATE redstm_InstanceData redstm_instances[RADEF_MAX_NUMBER_OF_RED_INSTANCES];
 
 /**
- * @brief Number of configured redundancy channels.
+ * @brief Data of the selected RedL state machine instance.
  */
-PRIVATE uint32_t redstm_number_of_red_channels = 0U;
-
-/**
- * @brief States of the redundancy channel state machines.
- */
-PRIVATE redstm_RedundancyChannelStates redstm_redundancy_channel_states[RADEF_MAX_NUMBER_OF_RED_CHANNELS] = {redstm_kRedundancyChannelStateNotInitialized,
-                                                                                                             redstm_kRedundancyChannelStateNotInitialized};
+PRIVATE RADEF_THREAD_LOCAL redstm_InstanceData *redstm_instance = &redstm_instances[0];
 
 // -----------------------------------------------------------------------------
 // Local Function Prototypes
@@ -102,28 +96,35 @@ static void ProcessStateUpEvents(const uint32_t red_channel_id, const redstm_Red
 
 void redstm_Init(const uint32_t configured_red_channels) {
   // Input parameter check
-  raas_AssertTrue(!redstm_initialized, radef_kAlreadyInitialized);
+  raas_AssertTrue(!redstm_instance->initialized, radef_kAlreadyInitialized);
   raas_AssertU32InRange(configured_red_channels, redcty_kMinNumberOfRedundancyChannels, RADEF_MAX_NUMBER_OF_RED_CHANNELS, radef_kInvalidParameter);
 
-  redstm_number_of_red_channels = configured_red_channels;
+  redstm_instance->number_of_red_channels = configured_red_channels;
 
-  redstm_initialized = true;
+  redstm_instance->initialized = true;
 
   // Init states for all configured channels
-  for (uint32_t index = 0U; index < redstm_number_of_red_channels; ++index) {
-    redstm_redundancy_channel_states[index] = redstm_kRedundancyChannelStateClosed;
+  for (uint32_t index = 0U; index < redstm_instance->number_of_red_channels; ++index) {
+    redstm_instance->redundancy_channel_states[index] = redstm_kRedundancyChannelStateClosed;
   }
 }
 
+void redstm_SelectInstance(const uint32_t instance_index) {
+  // Input parameter check
+  raas_AssertU32InRange(instance_index, 0U, RADEF_MAX_NUMBER_OF_RED_INSTANCES - 1U, radef_kInvalidParameter);
+
+  redstm_instance = &redstm_instances[instance_index];
+}
+
 void redstm_ProcessChannelStateMachine(const uint32_t red_channel_id, const redstm_RedundancyChannelEvents event) {
   // Input parameter check
-  raas_AssertTrue(redstm_initialized, radef_kNotInitialized);
-  raas_AssertU32InRange(red_channel_id, 0U, redstm_number_of_red_channels - 1U, radef_kInvalidParameter);
+  raas_AssertTrue(redstm_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(red_channel_id, 0U, redstm_instance->number_of_red_channels - 1U, radef_kInvalidParameter);
   raas_AssertU16InRange((uint16_t)event, (uint16_t)redstm_kRedundancyChannelEventMin, ((uint16_t)redstm_kRedundancyChannelEventMax) - 1U,
                         radef_kInvalidParameter);
 
   // Process the events
-  switch (redstm_redundancy_channel_states[red_channel_id]) {
+  switch (redstm_instance->redundancy_channel_states[red_channel_id]) {
     case redstm_kRedundancyChannelStateClosed:
       ProcessStateClosedEvents(red_channel_id, event);
       break;
@@ -141,12 +142,12 @@ void redstm_ProcessChannelStateMachine(const uint32_t red_channel_id, const reds
 
 redstm_RedundancyChannelStates redstm_GetChannelState(const uint32_t red_channel_id) {
   // Input parameter check
-  raas_AssertTrue(redstm_initialized, radef_kNotInitialized);
-  raas_AssertU32InRange(red_channel_id, 0U, redstm_number_of_red_channels - 1U, radef_kInvalidParameter);
-  raas_AssertU16InRange((uint16_t)redstm_redundancy_channel_states[red_channel_id], (uint16_t)redstm_kRedundancyChannelStateMin,
+  raas_AssertTrue(redstm_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(red_channel_id, 0U, redstm_instance->number_of_red_channels - 1U, radef_kInvalidParameter);
+  raas_AssertU16InRange((uint16_t)redstm_instance->redundancy_channel_states[red_channel_id], (uint16_t)redstm_kRedundancyChannelStateMin,
                         ((uint16_t)redstm_kRedundancyChannelStateMax) - 1U, radef_kInternalError);
 
-  return redstm_redundancy_channel_states[red_channel_id];
+  return redstm_instance->redundancy_channel_states[red_channel_id];
 }
 
 // -----------------------------------------------------------------------------
@@ -155,16 +156,16 @@ redstm_RedundancyChannelStates redstm_GetChannelState(const uint32_t red_channel
 
 static void ProcessStateClosedEvents(const uint32_t red_channel_id, const redstm_RedundancyChannelEvents event) {
   // Input parameter check
-  raas_AssertU32InRange(red_channel_id, 0U, redstm_number_of_red_channels - 1U, radef_kInternalError);
+  raas_AssertU32InRange(red_channel_id, 0U, redstm_instance->number_of_red_channels - 1U, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)event, (uint16_t)redstm_kRedundancyChannelEventMin, ((uint16_t)redstm_kRedundancyChannelEventMax) - 1U, radef_kInternalError);
   // Make sure that we really are in closed state
-  raas_AssertTrue(redstm_redundancy_channel_states[red_channel_id] == redstm_kRedundancyChannelStateClosed, radef_kInternalError);
+  raas_AssertTrue(redstm_instance->redundancy_channel_states[red_channel_id] == redstm_kRedundancyChannelStateClosed, radef_kInternalError);
 
   // Process the events
   switch (event) {
     case redstm_kRedundancyChannelEventOpen:
       redcor_InitRedundancyChannelData(red_channel_id);
-      redstm_redundancy_channel_states[red_channel_id] = redstm_kRedundancyChannelStateUp;
+      redstm_instance->redundancy_channel_states[red_channel_id] = redstm_kRedundancyChannelStateUp;
       break;
     case redstm_kRedundancyChannelEventClose:        // fall-through
     case redstm_kRedundancyChannelEventReceiveData:  // fall-through
@@ -182,10 +183,10 @@ static void ProcessStateClosedEvents(const uint32_t red_channel_id, const redstm
 
 static void ProcessStateUpEvents(const uint32_t red_channel_id, const redstm_RedundancyChannelEvents event) {
   // Input parameter check
-  raas_AssertU32InRange(red_channel_id, 0U, redstm_number_of_red_channels - 1U, radef_kInternalError);
+  raas_AssertU32InRange(red_channel_id, 0U, redstm_instance->number_of_red_channels - 1U, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)event, (uint16_t)redstm_kRedundancyChannelEventMin, ((uint16_t)redstm_kRedundancyChannelEventMax) - 1U, radef_kInternalError);
   // Make sure that we really are in up state
-  raas_AssertTrue(redstm_redundancy_channel_states[red_channel_id] == redstm_kRedundancyChannelStateUp, radef_kInternalError);
+  raas_AssertTrue(redstm_instance->redundancy_channel_states[red_channel_id] == redstm_kRedundancyChannelStateUp, radef_kInternalError);
 
   // Process the events
   switch (event) {
@@ -194,7 +195,7 @@ static void ProcessStateUpEvents(const uint32_t red_channel_id, const redstm_Red
       break;
     case redstm_kRedundancyChannelEventClose:
       redcor_InitRedundancyChannelData(red_channel_id);  // cleanup redundancy channel data by calling the redcor_InitRedundancyChannelData() function
-      redstm_redundancy_channel_states[red_channel_id] = redstm_kRedundancyChannelStateClosed;
+      redstm_instance->redundancy_channel_states[red_channel_id] = redstm_kRedundancyChannelStateClosed;
       break;
     case redstm_kRedundancyChannelEventReceiveData:
       redcor_ProcessReceivedMessage(red_channel_id);
@@ -22,8 +22,11 @@
 // -----------------------------------------------------------------------------
 // Includes
 // -----------------------------------------------------------------------------
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "rasta_common/radef_rasta_definitions.h"
+
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
 // -----------------------------------------------------------------------------
@@ -60,6 +63,17 @@ typedef enum {
   redstm_kRedundancyChannelEventMax            ///< Max value for redundancy channel events enum
 } redstm_RedundancyChannelEvents;
 
+/**
+ * @brief Struct for the data of a RedL state machine instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;                                                                           ///< Initialization state of the module.
+  uint32_t number_of_red_channels;                                                            ///< Number of configured redundancy channels.
+  redstm_RedundancyChannelStates redundancy_channel_states[RADEF_MAX_NUMBER_OF_RED_CHANNELS];  ///< States of the redundancy channel state machines.
+} redstm_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -83,6 +97,16 @@ extern "C" {
  */
 void redstm_Init(const uint32_t configured_red_channels);
 
+/**
+ * @brief Select the RedL state machine instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the RedL state machine functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RED_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void redstm_SelectInstance(const uint32_t instance_index);
+
 /**
  * @brief Process redundancy channel state machine.
  *
@@ -17,14 +17,20 @@
 // -----------------------------------------------------------------------------
 #include "rasta_redundancy/redtrn_transport_notifications.h"
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/rahlp_rasta_helper.h"
+#include "rasta_redundancy/redint_red_interface.h"
 #include "rasta_redundancy/redtri_transport_interface.h"
 #include "redcor_red_core.h"             // NOLINT(build/include_subdir)
 #include "reddfq_red_defer_queue.h"      // NOLINT(build/include_subdir)
+#include "redins_red_instances.h"        // NOLINT(build/include_subdir)
 #include "redrbf_red_received_buffer.h"  // NOLINT(build/include_subdir)
+#include "redrng_red_ingress_rings.h"    // NOLINT(build/include_subdir)
 #include "redstm_red_state_machine.h"    // NOLINT(build/include_subdir)
 
 // -----------------------------------------------------------------------------
@@ -43,6 +49,18 @@
 // Local Function Prototypes
 // -----------------------------------------------------------------------------
 
+#ifdef RADEF_TRANSPORT_INGRESS_RINGS
+/**
+ * @brief Check if a transport channel is in the configuration of a redundancy channel of an instance.
+ *
+ * @param [in] instance Pointer to the RedL instance.
+ * @param [in] transport_channel_id Transport channel identification.
+ * @return true -> transport channel configured
+ * @return false -> transport channel not configured
+ */
+static bool IsTransportChannelConfigured(const redint_Instance* const instance, const uint32_t transport_channel_id);
+#endif
+
 // -----------------------------------------------------------------------------
 // Local Constant Definitions
 // -----------------------------------------------------------------------------
@@ -54,10 +72,13 @@
 // -----------------------------------------------------------------------------
 // Global Function Implementations
 // -----------------------------------------------------------------------------
-void redtrn_MessageReceivedNotification(const uint32_t transport_channel_id) {
+void redtrn_MessageReceivedNotification(redint_Instance* const instance, const uint32_t transport_channel_id) {
   // Input parameter check
+  raas_AssertNotNull(instance, radef_kInvalidParameter);
   raas_AssertU32InRange(transport_channel_id, 0U, (RADEF_MAX_NUMBER_OF_RED_CHANNELS * RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS) - 1U, radef_kInvalidParameter);
 
+  redins_SelectInstance(instance);
+
   uint32_t red_channel_id;
   redcor_GetAssociatedRedundancyChannel(transport_channel_id, &red_channel_id);
 
@@ -69,7 +90,7 @@ void redtrn_MessageReceivedNotification(const uint32_t transport_channel_id) {
     const uint32_t kUsedDeferQueueEntries = reddfq_GetUsedEntries(red_channel_id);
     if (kFreeReceivedBufferEntries > kUsedDeferQueueEntries) {
       if (radef_kNoError ==
-          redtri_ReadMessage(transport_channel_id, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, &received_message.message_size, received_message.message)) {
+          redrng_READ_MESSAGE(instance, transport_channel_id, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, &received_message.message_size, received_message.message)) {
         // Message received
         redcor_WriteReceivedMessageToInputBuffer(red_channel_id, transport_channel_id, &received_message);
         redstm_ProcessChannelStateMachine(red_channel_id, redstm_kRedundancyChannelEventReceiveData);
@@ -86,13 +107,57 @@ void redtrn_MessageReceivedNotification(const uint32_t transport_channel_id) {
   } else {
     // The redundancy channel is not in state up -> read and discard message
     if (radef_kNoMessageReceived ==
-        redtri_ReadMessage(transport_channel_id, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, &received_message.message_size, received_message.message)) {
+        redrng_READ_MESSAGE(instance, transport_channel_id, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE, &received_message.message_size, received_message.message)) {
       // No more messages pending on this transport channel
       redcor_ClearMessagePendingFlag(red_channel_id, transport_channel_id);
     }
   }
 }
 
+#ifdef RADEF_TRANSPORT_INGRESS_RINGS
+radef_RaStaReturnCode redtrn_PushReceivedMessage(redint_Instance* const instance, const uint32_t transport_channel_id, const uint16_t message_size,
+                                                 const uint8_t* const message_data) {
+  radef_RaStaReturnCode ret = radef_kInvalidParameter;
+
+  // Input parameter check
+  if ((instance != NULL) && (message_data != NULL) &&
+      rahlp_IsU32InRange(transport_channel_id, 0U, (RADEF_MAX_NUMBER_OF_RED_CHANNELS * RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS) - 1U) &&
+      rahlp_IsU16InRange(message_size, RADEF_MIN_RED_LAYER_PDU_MESSAGE_SIZE, RADEF_MAX_RED_LAYER_PDU_MESSAGE_SIZE)) {
+    if (!instance->initialized) {
+      ret = radef_kNotInitialized;
+    } else if (IsTransportChannelConfigured(instance, transport_channel_id)) {
+      if (redrng_PushMessage(instance, transport_channel_id, message_size, message_data)) {
+        ret = radef_kNoError;
+      } else {
+        ret = radef_kReceiveBufferFull;
+      }
+    } else {
+      // Transport channel not configured -> radef_kInvalidParameter
+    }
+  }
+
+  return ret;
+}
+#endif
+
 // -----------------------------------------------------------------------------
 // Local Function Implementations
 // -----------------------------------------------------------------------------
+
+#ifdef RADEF_TRANSPORT_INGRESS_RINGS
+static bool IsTransportChannelConfigured(const redint_Instance* const instance, const uint32_t transport_channel_id) {
+  const redcty_RedundancyLayerConfiguration* const kConfiguration = instance->redundancy_configuration;
+  bool configured = false;
+
+  for (uint32_t red_channel_index = 0U; red_channel_index < kConfiguration->number_of_redundancy_channels; ++red_channel_index) {
+    const redcty_RedundancyChannelConfiguration* const kChannelConfiguration = &kConfiguration->redundancy_channel_configurations[red_channel_index];
+    for (uint32_t transport_channel_index = 0U; transport_channel_index < kChannelConfiguration->num_transport_channels; ++transport_channel_index) {
+      if (kChannelConfiguration->transport_channel_ids[transport_channel_index] == transport_channel_id) {
+        configured = true;
+      }
+    }
+  }
+
+  return configured;
+}
+#endif
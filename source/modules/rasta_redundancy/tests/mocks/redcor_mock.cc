@@ -59,6 +59,10 @@ extern "C" {
     ASSERT_NE(redcorMock::getInstance(), nullptr) << "Mock object not initialized!";
     redcorMock::getInstance()->redcor_WriteReceivedMessageToInputBuffer(red_channel_id, transport_channel_id, received_message);
   }
+  void redcor_WriteCheckedMessageToInputBuffer(const uint32_t red_channel_id, const uint32_t transport_channel_id, const bool check_code_valid, const redtyp_RedundancyMessage * received_message){
+    ASSERT_NE(redcorMock::getInstance(), nullptr) << "Mock object not initialized!";
+    redcorMock::getInstance()->redcor_WriteCheckedMessageToInputBuffer(red_channel_id, transport_channel_id, check_code_valid, received_message);
+  }
   void redcor_ClearInputBufferMessagePendingFlag(const uint32_t red_channel_id){
     ASSERT_NE(redcorMock::getInstance(), nullptr) << "Mock object not initialized!";
     redcorMock::getInstance()->redcor_ClearInputBufferMessagePendingFlag(red_channel_id);
@@ -97,6 +101,10 @@ extern "C" {
     ASSERT_NE(redcorMock::getInstance(), nullptr) << "Mock object not initialized!";
     redcorMock::getInstance()->redcor_GetAssociatedRedundancyChannel(transport_channel_id, red_channel_id);
   }
+  void redcor_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(redcorMock::getInstance(), nullptr) << "Mock object not initialized!";
+    redcorMock::getInstance()->redcor_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -67,6 +67,11 @@ public:
   */
   MOCK_METHOD(void, redcor_WriteReceivedMessageToInputBuffer, (const uint32_t red_channel_id, const uint32_t transport_channel_id, const redtyp_RedundancyMessage * received_message));
 
+  /**
+  * @brief Mock Method object for the redcor_WriteCheckedMessageToInputBuffer function
+  */
+  MOCK_METHOD(void, redcor_WriteCheckedMessageToInputBuffer, (const uint32_t red_channel_id, const uint32_t transport_channel_id, const bool check_code_valid, const redtyp_RedundancyMessage * received_message));
+
   /**
   * @brief Mock Method object for the redcor_ClearInputBufferMessagePendingFlag function
   */
@@ -112,6 +117,11 @@ public:
   */
   MOCK_METHOD(void, redcor_GetAssociatedRedundancyChannel, (const uint32_t transport_channel_id, uint32_t * red_channel_id));
 
+  /**
+  * @brief Mock Method object for the redcor_SelectInstance function
+  */
+  MOCK_METHOD(void, redcor_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
@@ -37,13 +37,17 @@ redcrcMock::~redcrcMock() {
 
 extern "C" {
 
-  void redcrc_Init(const redcty_CheckCodeType configured_check_code_type){
+  void redcrc_Init(redcrc_CrcEngine * crc_engine, const redcty_CheckCodeType configured_check_code_type){
     ASSERT_NE(redcrcMock::getInstance, nullptr) << "Mock object not initialized!";
-    redcrcMock::getInstance()->redcrc_Init(configured_check_code_type);
+    redcrcMock::getInstance()->redcrc_Init(crc_engine, configured_check_code_type);
   }
-  void redcrc_CalculateCrc(const uint16_t data_size, const uint8_t * data_buffer, uint32_t * calculated_crc){
+  void redcrc_CalculateCrc(const redcrc_CrcEngine * crc_engine, const uint16_t data_size, const uint8_t * data_buffer, uint32_t * calculated_crc){
     ASSERT_NE(redcrcMock::getInstance, nullptr) << "Mock object not initialized!";
-    redcrcMock::getInstance()->redcrc_CalculateCrc(data_size, data_buffer, calculated_crc);
+    redcrcMock::getInstance()->redcrc_CalculateCrc(crc_engine, data_size, data_buffer, calculated_crc);
+  }
+  void redcrc_CalculateCrcBatch(const redcrc_CrcEngine * crc_engine, const uint16_t number_of_entries, const redcrc_CrcBatchEntry * entries){
+    ASSERT_NE(redcrcMock::getInstance, nullptr) << "Mock object not initialized!";
+    redcrcMock::getInstance()->redcrc_CalculateCrcBatch(crc_engine, number_of_entries, entries);
   }
 }
 
@@ -20,6 +20,7 @@
 // -----------------------------------------------------------------------------
 #include "gmock/gmock.h"
 #include "rasta_redundancy/redcty_red_config_types.h"
+#include "redcrc_red_crc.h"
 
 // -----------------------------------------------------------------------------
 // Mock class
@@ -44,12 +45,17 @@ public:
   /**
   * @brief Mock Method object for the redcrc_Init function
   */
-  MOCK_METHOD(void, redcrc_Init, (const redcty_CheckCodeType configured_check_code_type));
+  MOCK_METHOD(void, redcrc_Init, (redcrc_CrcEngine * crc_engine, const redcty_CheckCodeType configured_check_code_type));
 
   /**
   * @brief Mock Method object for the redcrc_CalculateCrc function
   */
-  MOCK_METHOD(void, redcrc_CalculateCrc, (const uint16_t data_size, const uint8_t * data_buffer, uint32_t * calculated_crc));
+  MOCK_METHOD(void, redcrc_CalculateCrc, (const redcrc_CrcEngine * crc_engine, const uint16_t data_size, const uint8_t * data_buffer, uint32_t * calculated_crc));
+
+  /**
+  * @brief Mock Method object for the redcrc_CalculateCrcBatch function
+  */
+  MOCK_METHOD(void, redcrc_CalculateCrcBatch, (const redcrc_CrcEngine * crc_engine, const uint16_t number_of_entries, const redcrc_CrcBatchEntry * entries));
 
   /**
   * @brief Get the Instance object
@@ -59,6 +59,18 @@ extern "C" {
     }
     return reddfqMock::getInstance()->reddfq_IsTimeout(red_channel_id);
   }
+  bool reddfq_GetExpiredChannel(uint32_t* const red_channel_id){
+    if(reddfqMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return reddfqMock::getInstance()->reddfq_GetExpiredChannel(red_channel_id);
+  }
+  bool reddfq_GetTimeToNextDeadline(uint32_t* const time_to_next_deadline){
+    if(reddfqMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return reddfqMock::getInstance()->reddfq_GetTimeToNextDeadline(time_to_next_deadline);
+  }
   bool reddfq_Contains(const uint32_t red_channel_id, const uint32_t sequence_number){
     if(reddfqMock::getInstance() == nullptr) {
       ADD_FAILURE() << "Mock object not initialized!";
@@ -83,6 +95,10 @@ extern "C" {
     }
     return reddfqMock::getInstance()->reddfq_IsSequenceNumberOlder(sequence_number_to_compare, sequence_number_reference);
   }
+  void reddfq_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(reddfqMock::getInstance(), nullptr) << "Mock object not initialized!";
+    reddfqMock::getInstance()->reddfq_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -66,6 +66,16 @@ public:
   */
   MOCK_METHOD(bool, reddfq_IsTimeout, (const uint32_t red_channel_id));
 
+  /**
+  * @brief Mock Method object for the reddfq_GetExpiredChannel function
+  */
+  MOCK_METHOD(bool, reddfq_GetExpiredChannel, (uint32_t * red_channel_id));
+
+  /**
+  * @brief Mock Method object for the reddfq_GetTimeToNextDeadline function
+  */
+  MOCK_METHOD(bool, reddfq_GetTimeToNextDeadline, (uint32_t * time_to_next_deadline));
+
   /**
   * @brief Mock Method object for the reddfq_Contains function
   */
@@ -86,6 +96,11 @@ public:
   */
   MOCK_METHOD(bool, reddfq_IsSequenceNumberOlder, (const uint32_t sequence_number_to_compare, const uint32_t sequence_number_reference));
 
+  /**
+  * @brief Mock Method object for the reddfq_SelectInstance function
+  */
+  MOCK_METHOD(void, reddfq_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
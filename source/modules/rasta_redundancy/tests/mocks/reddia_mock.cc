@@ -61,6 +61,16 @@ extern "C" {
     }
     return reddiaMock::getInstance()->reddia_IsTransportChannelIdValid(red_channel_id, transport_channel_id);
   }
+  bool reddia_GetAssociatedRedundancyChannel(const uint32_t transport_channel_id, uint32_t * red_channel_id){
+    if(reddiaMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return reddiaMock::getInstance()->reddia_GetAssociatedRedundancyChannel(transport_channel_id, red_channel_id);
+  }
+  void reddia_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(reddiaMock::getInstance(), nullptr) << "Mock object not initialized!";
+    reddiaMock::getInstance()->reddia_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
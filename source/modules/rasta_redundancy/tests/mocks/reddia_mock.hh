@@ -66,6 +66,16 @@ public:
   */
   MOCK_METHOD(bool, reddia_IsTransportChannelIdValid, (const uint32_t red_channel_id, const uint32_t transport_channel_id));
 
+  /**
+  * @brief Mock Method object for the reddia_GetAssociatedRedundancyChannel function
+  */
+  MOCK_METHOD(bool, reddia_GetAssociatedRedundancyChannel, (const uint32_t transport_channel_id, uint32_t * red_channel_id));
+
+  /**
+  * @brief Mock Method object for the reddia_SelectInstance function
+  */
+  MOCK_METHOD(void, reddia_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
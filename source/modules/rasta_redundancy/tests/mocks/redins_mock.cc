@@ -0,0 +1,67 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redins_mock.cc
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version e465d64cd5d036bb35a06ffd760b7d3b77e6e7cf
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock source file for the redins module
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "redins_mock.hh"
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+redinsMock * redinsMock::instance = NULL;
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+redinsMock::redinsMock() {
+  instance = this;
+}
+
+redinsMock::~redinsMock() {
+  instance = NULL;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+extern "C" {
+
+  bool redins_IsInstanceAvailable(void){
+    if(redinsMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return redinsMock::getInstance()->redins_IsInstanceAvailable();
+  }
+
+  redint_Instance * redins_CreateInstance(void){
+    if(redinsMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return redinsMock::getInstance()->redins_CreateInstance();
+  }
+
+  void redins_SelectInstance(redint_Instance *const instance){
+    ASSERT_NE(redinsMock::getInstance(), nullptr) << "Mock object not initialized!";
+    redinsMock::getInstance()->redins_SelectInstance(instance);
+  }
+
+  redint_Instance * redins_GetSelectedInstance(void){
+    if(redinsMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return redinsMock::getInstance()->redins_GetSelectedInstance();
+  }
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -0,0 +1,74 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redins_mock.hh
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version e465d64cd5d036bb35a06ffd760b7d3b77e6e7cf
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock header file for the redins module
+ */
+
+#ifndef SOURCE_MODULES_RASTA_REDUNDANCY_TESTS_MOCKS_REDINS_MOCK_HH_
+#define SOURCE_MODULES_RASTA_REDUNDANCY_TESTS_MOCKS_REDINS_MOCK_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "gmock/gmock.h"
+#include "redins_red_instances.h"
+
+// -----------------------------------------------------------------------------
+// Mock class
+// -----------------------------------------------------------------------------
+/**
+ * @brief Mock class for the rasta redins class
+ */
+class redinsMock {
+private:
+  static redinsMock *instance;  ///< redinsMock instance
+
+public:
+  /**
+  * @brief redinsMock constructor
+  */
+  redinsMock();
+  /**
+  * @brief redinsMock destructor
+  */
+  virtual ~redinsMock();
+
+  /**
+  * @brief Mock Method object for the redins_IsInstanceAvailable function
+  */
+  MOCK_METHOD(bool, redins_IsInstanceAvailable, ());
+
+  /**
+  * @brief Mock Method object for the redins_CreateInstance function
+  */
+  MOCK_METHOD(redint_Instance *, redins_CreateInstance, ());
+
+  /**
+  * @brief Mock Method object for the redins_SelectInstance function
+  */
+  MOCK_METHOD(void, redins_SelectInstance, (redint_Instance * instance));
+
+  /**
+  * @brief Mock Method object for the redins_GetSelectedInstance function
+  */
+  MOCK_METHOD(redint_Instance *, redins_GetSelectedInstance, ());
+
+  /**
+  * @brief Get the Instance object
+  *
+  * @return redinsMock*
+  */
+  static redinsMock *getInstance() {
+    return instance;
+  }
+};
+
+#endif // SOURCE_MODULES_RASTA_REDUNDANCY_TESTS_MOCKS_REDINS_MOCK_HH_
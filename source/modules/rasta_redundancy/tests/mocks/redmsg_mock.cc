@@ -51,6 +51,12 @@ extern "C" {
     }
     return redmsgMock::getInstance()->redmsg_CheckMessageCrc(redundancy_message);
   }
+  void redmsg_CheckMessageCrcBatch(const uint16_t number_of_messages, const redtyp_RedundancyMessage * redundancy_messages, radef_RaStaReturnCode * return_codes){
+    if(redmsgMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    redmsgMock::getInstance()->redmsg_CheckMessageCrcBatch(number_of_messages, redundancy_messages, return_codes);
+  }
   uint32_t redmsg_GetMessageSequenceNumber(const redtyp_RedundancyMessage * redundancy_message){
     if(redmsgMock::getInstance() == nullptr) {
       ADD_FAILURE() << "Mock object not initialized!";
@@ -61,6 +67,10 @@ extern "C" {
     ASSERT_NE(redmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
     redmsgMock::getInstance()->redmsg_GetMessagePayload(redundancy_message, message_payload);
   }
+  void redmsg_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(redmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
+    redmsgMock::getInstance()->redmsg_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
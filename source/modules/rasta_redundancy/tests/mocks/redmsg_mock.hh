@@ -58,6 +58,11 @@ public:
   */
   MOCK_METHOD(radef_RaStaReturnCode, redmsg_CheckMessageCrc, (const redtyp_RedundancyMessage * redundancy_message));
 
+  /**
+  * @brief Mock Method object for the redmsg_CheckMessageCrcBatch function
+  */
+  MOCK_METHOD(void, redmsg_CheckMessageCrcBatch, (const uint16_t number_of_messages, const redtyp_RedundancyMessage * redundancy_messages, radef_RaStaReturnCode * return_codes));
+
   /**
   * @brief Mock Method object for the redmsg_GetMessageSequenceNumber function
   */
@@ -68,6 +73,11 @@ public:
   */
   MOCK_METHOD(void, redmsg_GetMessagePayload, (const redtyp_RedundancyMessage * redundancy_message, redtyp_RedundancyMessagePayload * message_payload));
 
+  /**
+  * @brief Mock Method object for the redmsg_SelectInstance function
+  */
+  MOCK_METHOD(void, redmsg_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
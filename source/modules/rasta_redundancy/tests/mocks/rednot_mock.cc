@@ -37,13 +37,13 @@ rednotMock::~rednotMock() {
 
 extern "C" {
 
-  void rednot_MessageReceivedNotification(const uint32_t red_channel_id){
+  void rednot_MessageReceivedNotification(redint_Instance *const instance, const uint32_t red_channel_id){
     ASSERT_NE(rednotMock::getInstance(), nullptr) << "Mock object not initialized!";
-    rednotMock::getInstance()->rednot_MessageReceivedNotification(red_channel_id);
+    rednotMock::getInstance()->rednot_MessageReceivedNotification(instance, red_channel_id);
   }
-  void rednot_DiagnosticNotification(const uint32_t red_channel_id, const uint32_t tr_channel_id, const radef_TransportChannelDiagnosticData TransportChannelDiagnosticData){
+  void rednot_DiagnosticNotification(redint_Instance *const instance, const uint32_t red_channel_id, const uint32_t tr_channel_id, const radef_TransportChannelDiagnosticData TransportChannelDiagnosticData){
     ASSERT_NE(rednotMock::getInstance(), nullptr) << "Mock object not initialized!";
-    rednotMock::getInstance()->rednot_DiagnosticNotification(red_channel_id, tr_channel_id, TransportChannelDiagnosticData);
+    rednotMock::getInstance()->rednot_DiagnosticNotification(instance, red_channel_id, tr_channel_id, TransportChannelDiagnosticData);
   }
 }
 
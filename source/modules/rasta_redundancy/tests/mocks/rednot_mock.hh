@@ -20,6 +20,7 @@
 // -----------------------------------------------------------------------------
 #include "gmock/gmock.h"
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_redundancy/redint_red_interface.h"
 
 // -----------------------------------------------------------------------------
 // Mock class
@@ -44,12 +45,12 @@ public:
   /**
   * @brief Mock Method object for the rednot_MessageReceivedNotification function
   */
-  MOCK_METHOD(void, rednot_MessageReceivedNotification, (const uint32_t red_channel_id));
+  MOCK_METHOD(void, rednot_MessageReceivedNotification, (redint_Instance * instance, const uint32_t red_channel_id));
 
   /**
   * @brief Mock Method object for the rednot_DiagnosticNotification function
   */
-  MOCK_METHOD(void, rednot_DiagnosticNotification, (const uint32_t red_channel_id, const uint32_t tr_channel_id, const radef_TransportChannelDiagnosticData TransportChannelDiagnosticData));
+  MOCK_METHOD(void, rednot_DiagnosticNotification, (redint_Instance * instance, const uint32_t red_channel_id, const uint32_t tr_channel_id, const radef_TransportChannelDiagnosticData TransportChannelDiagnosticData));
 
   /**
   * @brief Get the Instance object
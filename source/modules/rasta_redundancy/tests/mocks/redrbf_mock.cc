@@ -61,6 +61,10 @@ extern "C" {
     }
     return redrbfMock::getInstance()->redrbf_GetFreeBufferEntries(red_channel_id);
   }
+  void redrbf_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(redrbfMock::getInstance(), nullptr) << "Mock object not initialized!";
+    redrbfMock::getInstance()->redrbf_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
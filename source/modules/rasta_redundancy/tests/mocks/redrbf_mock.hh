@@ -67,6 +67,11 @@ public:
   */
   MOCK_METHOD(uint16_t, redrbf_GetFreeBufferEntries, (const uint32_t red_channel_id));
 
+  /**
+  * @brief Mock Method object for the redrbf_SelectInstance function
+  */
+  MOCK_METHOD(void, redrbf_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
@@ -51,6 +51,10 @@ extern "C" {
     }
     return redstmMock::getInstance()->redstm_GetChannelState(red_channel_id);
   }
+  void redstm_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(redstmMock::getInstance(), nullptr) << "Mock object not initialized!";
+    redstmMock::getInstance()->redstm_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -56,6 +56,11 @@ public:
   */
   MOCK_METHOD(redstm_RedundancyChannelStates, redstm_GetChannelState, (const uint32_t red_channel_id));
 
+  /**
+  * @brief Mock Method object for the redstm_SelectInstance function
+  */
+  MOCK_METHOD(void, redstm_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
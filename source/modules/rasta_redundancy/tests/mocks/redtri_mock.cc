@@ -41,15 +41,15 @@ extern "C" {
     ASSERT_NE(redtriMock::getInstance(), nullptr) << "Mock object not initialized!";
     redtriMock::getInstance()->redtri_Init();
   }
-  void redtri_SendMessage(const uint32_t transport_channel_id, const uint16_t message_size, const uint8_t * message_data){
+  void redtri_SendMessage(redint_Instance *const instance, const uint32_t transport_channel_id, const uint16_t message_size, const uint8_t * message_data){
     ASSERT_NE(redtriMock::getInstance(), nullptr) << "Mock object not initialized!";
-    redtriMock::getInstance()->redtri_SendMessage(transport_channel_id, message_size, message_data);
+    redtriMock::getInstance()->redtri_SendMessage(instance, transport_channel_id, message_size, message_data);
   }
-  radef_RaStaReturnCode redtri_ReadMessage(const uint32_t transport_channel_id, const uint16_t buffer_size, uint16_t * message_size, uint8_t * message_buffer){
+  radef_RaStaReturnCode redtri_ReadMessage(redint_Instance *const instance, const uint32_t transport_channel_id, const uint16_t buffer_size, uint16_t * message_size, uint8_t * message_buffer){
     if(redtriMock::getInstance() == nullptr) {
       ADD_FAILURE() << "Mock object not initialized!";
     }
-    return redtriMock::getInstance()->redtri_ReadMessage(transport_channel_id, buffer_size, message_size, message_buffer);
+    return redtriMock::getInstance()->redtri_ReadMessage(instance, transport_channel_id, buffer_size, message_size, message_buffer);
   }
 }
 
@@ -20,6 +20,7 @@
 // -----------------------------------------------------------------------------
 #include "gmock/gmock.h"
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_redundancy/redint_red_interface.h"
 
 // -----------------------------------------------------------------------------
 // Mock class
@@ -49,12 +50,12 @@ public:
   /**
   * @brief Mock Method object for the redtri_SendMessage function
   */
-  MOCK_METHOD(void, redtri_SendMessage, (const uint32_t transport_channel_id, const uint16_t message_size, const uint8_t * message_data));
+  MOCK_METHOD(void, redtri_SendMessage, (redint_Instance * instance, const uint32_t transport_channel_id, const uint16_t message_size, const uint8_t * message_data));
 
   /**
   * @brief Mock Method object for the redtri_ReadMessage function
   */
-  MOCK_METHOD(radef_RaStaReturnCode, redtri_ReadMessage, (const uint32_t transport_channel_id, const uint16_t buffer_size, uint16_t * message_size, uint8_t * message_buffer));
+  MOCK_METHOD(radef_RaStaReturnCode, redtri_ReadMessage, (redint_Instance * instance, const uint32_t transport_channel_id, const uint16_t buffer_size, uint16_t * message_size, uint8_t * message_buffer));
 
   /**
   * @brief Get the Instance object
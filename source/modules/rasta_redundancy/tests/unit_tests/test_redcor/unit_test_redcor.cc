@@ -223,25 +223,25 @@ TEST_P(InitTestWithParam, redcorTest001VerifyInit)
 
     // call the function
     EXPECT_NO_THROW(redcor_Init(&config));
-    EXPECT_TRUE(redcor_initialized);
+    EXPECT_TRUE(redcor_instance->initialized);
 
     // verify configuration set correct
-    EXPECT_EQ(redcor_redundancy_configuration->check_code_type, config.check_code_type);
-    EXPECT_EQ(redcor_redundancy_configuration->n_defer_queue_size, config.n_defer_queue_size);
-    EXPECT_EQ(redcor_redundancy_configuration->n_diagnosis, config.n_diagnosis);
-    EXPECT_EQ(redcor_redundancy_configuration->number_of_redundancy_channels, config.number_of_redundancy_channels);
-    EXPECT_EQ(redcor_redundancy_configuration->t_seq, config.t_seq);
+    EXPECT_EQ(redcor_instance->redundancy_configuration->check_code_type, config.check_code_type);
+    EXPECT_EQ(redcor_instance->redundancy_configuration->n_defer_queue_size, config.n_defer_queue_size);
+    EXPECT_EQ(redcor_instance->redundancy_configuration->n_diagnosis, config.n_diagnosis);
+    EXPECT_EQ(redcor_instance->redundancy_configuration->number_of_redundancy_channels, config.number_of_redundancy_channels);
+    EXPECT_EQ(redcor_instance->redundancy_configuration->t_seq, config.t_seq);
 
     // verify each redundancy channel config
     for(uint16_t i = 0; i < number_of_redundancy_channels; i++)
     {
-      EXPECT_EQ(redcor_redundancy_configuration->redundancy_channel_configurations[i].num_transport_channels, config.redundancy_channel_configurations[i].num_transport_channels);
-      EXPECT_EQ(redcor_redundancy_configuration->redundancy_channel_configurations[i].red_channel_id, config.redundancy_channel_configurations[i].red_channel_id);
+      EXPECT_EQ(redcor_instance->redundancy_configuration->redundancy_channel_configurations[i].num_transport_channels, config.redundancy_channel_configurations[i].num_transport_channels);
+      EXPECT_EQ(redcor_instance->redundancy_configuration->redundancy_channel_configurations[i].red_channel_id, config.redundancy_channel_configurations[i].red_channel_id);
 
       // verify transport channels
       for(uint16_t t = 0; t < number_of_transport_channels; t++)
       {
-        EXPECT_EQ(redcor_redundancy_configuration->redundancy_channel_configurations[i].transport_channel_ids[t], config.redundancy_channel_configurations[i].transport_channel_ids[t]);
+        EXPECT_EQ(redcor_instance->redundancy_configuration->redundancy_channel_configurations[i].transport_channel_ids[t], config.redundancy_channel_configurations[i].transport_channel_ids[t]);
       }
     }
   }
@@ -517,18 +517,18 @@ TEST_P(InitRedundancyChannelDataTestWithParam, redcorTest006VerifyInitRedundancy
   if(channel_id <= UT_REDCOR_REDUNDANCY_CHANNEL_ID_MAX)
   {
     // set values to verify reset after InitRedundancyChannelData
-    redcor_redundancy_channels[channel_id].seq_rx = 10U;
-    redcor_redundancy_channels[channel_id].seq_tx = 20U;
+    redcor_instance->redundancy_channels[channel_id].seq_rx = 10U;
+    redcor_instance->redundancy_channels[channel_id].seq_tx = 20U;
 
     for (uint32_t tr_channel_index = 0U; tr_channel_index < config.number_of_redundancy_channels * config.redundancy_channel_configurations->num_transport_channels; ++tr_channel_index) {
-      redcor_redundancy_channels[channel_id].received_data_pending[tr_channel_index] = true;
+      redcor_instance->redundancy_channels[channel_id].received_data_pending[tr_channel_index] = true;
     }
 
-    redcor_redundancy_channels[channel_id].input_buffer.message_in_buffer = true;
-    redcor_redundancy_channels[channel_id].input_buffer.message_buffer.message_size = 1000U;
-    redcor_redundancy_channels[channel_id].input_buffer.transport_channel_id = 2U;
-    redcor_redundancy_channels[channel_id].send_buffer.message_in_buffer = true;
-    redcor_redundancy_channels[channel_id].send_buffer.message_payload_buffer.payload_size = 900U;
+    redcor_instance->redundancy_channels[channel_id].input_buffer.message_in_buffer = true;
+    redcor_instance->redundancy_channels[channel_id].input_buffer.message_buffer.message_size = 1000U;
+    redcor_instance->redundancy_channels[channel_id].input_buffer.transport_channel_id = 2U;
+    redcor_instance->redundancy_channels[channel_id].send_buffer.message_in_buffer = true;
+    redcor_instance->redundancy_channels[channel_id].send_buffer.message_payload_buffer.payload_size = 900U;
   }
 
   if(expect_fatal_error)
@@ -547,22 +547,22 @@ TEST_P(InitRedundancyChannelDataTestWithParam, redcorTest006VerifyInitRedundancy
     EXPECT_NO_THROW(redcor_InitRedundancyChannelData(channel_id));
 
     // verify redundancy channel is reset
-    EXPECT_EQ(redcor_redundancy_channels[channel_id].seq_rx, 0U);
-    EXPECT_EQ(redcor_redundancy_channels[channel_id].seq_tx, 0U);
+    EXPECT_EQ(redcor_instance->redundancy_channels[channel_id].seq_rx, 0U);
+    EXPECT_EQ(redcor_instance->redundancy_channels[channel_id].seq_tx, 0U);
 
     // verify transport channel does not contain pending data
     for (uint32_t tr_channel_index = 0U; tr_channel_index < config.number_of_redundancy_channels * config.redundancy_channel_configurations->num_transport_channels; ++tr_channel_index) {
-      EXPECT_EQ(redcor_redundancy_channels[channel_id].received_data_pending[tr_channel_index], false);
+      EXPECT_EQ(redcor_instance->redundancy_channels[channel_id].received_data_pending[tr_channel_index], false);
     }
 
     // verify input buffer of redundancy channel is reset
-    EXPECT_EQ(redcor_redundancy_channels[channel_id].input_buffer.message_in_buffer, false);
-    EXPECT_EQ(redcor_redundancy_channels[channel_id].input_buffer.message_buffer.message_size, 0U);
-    EXPECT_EQ(redcor_redundancy_channels[channel_id].input_buffer.transport_channel_id, 0U);
+    EXPECT_EQ(redcor_instance->redundancy_channels[channel_id].input_buffer.message_in_buffer, false);
+    EXPECT_EQ(redcor_instance->redundancy_channels[channel_id].input_buffer.message_buffer.message_size, 0U);
+    EXPECT_EQ(redcor_instance->redundancy_channels[channel_id].input_buffer.transport_channel_id, 0U);
 
     // verify send buffer of redundancy channel is reset
-    EXPECT_EQ(redcor_redundancy_channels[channel_id].send_buffer.message_in_buffer, false);
-    EXPECT_EQ(redcor_redundancy_channels[channel_id].send_buffer.message_payload_buffer.payload_size, 0U);
+    EXPECT_EQ(redcor_instance->redundancy_channels[channel_id].send_buffer.message_in_buffer, false);
+    EXPECT_EQ(redcor_instance->redundancy_channels[channel_id].send_buffer.message_payload_buffer.payload_size, 0U);
   }
 }
 
@@ -680,7 +680,7 @@ INSTANTIATE_TEST_SUITE_P(
  * Test steps:
  * - Init the module with default configuration
  * - Expect a radef_kInvalidParameter when fatal error gets thrown
- * - Call GetAssociatedRedundancyChannel function for given transport channel id
+ * - Call GetAssociatedRedundancyChannel function for given transport channel id, the associated redundancy channel is read from the diagnostics module
  * - Verify the associated redundancy channel
  * .
  *
@@ -732,6 +732,8 @@ TEST_P(GetAssociatedRedundancyChannelTestWithParam, redcorTest017VerifyGetAssoci
   else
   {
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+    EXPECT_CALL(reddia_mock, reddia_GetAssociatedRedundancyChannel(transport_channel_id, &redundancy_channel_id_result))
+        .WillOnce(DoAll(SetArgPointee<1>(expected_redundancy_channel_id), Return(true)));
     EXPECT_NO_THROW(redcor_GetAssociatedRedundancyChannel(transport_channel_id, &redundancy_channel_id_result));
     EXPECT_EQ(expected_redundancy_channel_id, redundancy_channel_id_result);
   }
@@ -749,6 +751,49 @@ INSTANTIATE_TEST_SUITE_P(
   )
 );
 
+/**
+ * @test        @ID{redcorTest018} Verify the GetAssociatedRedundancyChannel function with a not configured transport channel id.
+ *
+ * @details     This test verifies that the GetAssociatedRedundancyChannel function reads the associated redundancy channel from the transport channel lookup
+ *              table of the diagnostics module and throws a fatal error, if the transport channel id is not configured.
+ *
+ * Test steps:
+ * - Init the module with default configuration
+ * - Call GetAssociatedRedundancyChannel function for a transport channel id, which the diagnostics module reports as not configured
+ * - Verify that a radef_kInvalidParameter fatal error is thrown
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redcorTest, redcorTest018VerifyGetAssociatedRedundancyChannelNotConfigured)
+{
+  // test variables
+  uint32_t redundancy_channel_id_result = 0;
+
+  // expect calls for init module
+  EXPECT_CALL(reddia_mock, reddia_IsConfigurationValid(_)).WillOnce(Return(true));
+  EXPECT_CALL(reddia_mock, reddia_InitRedundancyLayerDiagnostics(_)).Times(1);
+  EXPECT_CALL(redmsg_mock, redmsg_Init(_)).Times(1);
+
+  // expect calls for init of each redundancy channel
+  EXPECT_CALL(reddfq_mock, reddfq_InitDeferQueue(_)).Times(default_config.number_of_redundancy_channels);
+  EXPECT_CALL(redrbf_mock, redrbf_InitBuffer(_)).Times(default_config.number_of_redundancy_channels);
+  EXPECT_CALL(reddia_mock, reddia_InitRedundancyChannelDiagnostics(_)).Times(default_config.number_of_redundancy_channels);
+
+  // init the module
+  redcor_Init(&default_config);
+
+  // verify the not configured transport channel id
+  EXPECT_CALL(reddia_mock, reddia_GetAssociatedRedundancyChannel(2U, &redundancy_channel_id_result)).WillOnce(Return(false));
+  EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &redcorTest::invalidArgumentException));
+  EXPECT_THROW(redcor_GetAssociatedRedundancyChannel(2U, &redundancy_channel_id_result), std::invalid_argument);
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
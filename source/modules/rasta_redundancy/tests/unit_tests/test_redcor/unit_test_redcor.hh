@@ -31,6 +31,7 @@
 #include "rasys_mock.hh"
 #include "reddfq_mock.hh"
 #include "reddia_mock.hh"
+#include "redins_mock.hh"
 #include "redrbf_mock.hh"
 #include "redmsg_mock.hh"
 #include "redtri_mock.hh"
@@ -42,6 +43,7 @@ using testing::StrictMock;
 using testing::InSequence;
 using testing::Return;
 using testing::SetArgPointee;
+using testing::DoAll;
 using testing::Invoke;
 
 // -----------------------------------------------------------------------------
@@ -70,7 +72,7 @@ using testing::Invoke;
 #define UT_REDCOR_T_SEQ_MIN                         50U        ///< minimum time period (in ms) how long a message is buffered
 #define UT_REDCOR_T_SEQ_MAX                         500U       ///< maximum time period (in ms) how long a message is buffered
 #define UT_REDCOR_QUEUE_SIZE_MIN                    4U         ///< minimum size of the defer queue
-#define UT_REDCOR_QUEUE_SIZE_MAX                    10U        ///< maximum size of the defer queue
+#define UT_REDCOR_QUEUE_SIZE_MAX                    64U        ///< maximum size of the defer queue
 
 // Diagnosis
 #define UT_REDCOR_N_DIAGNOSIS_MIN                   10U        ///< Minimum diagnosis window size
@@ -82,9 +84,7 @@ using testing::Invoke;
 
 extern uint8_t test_red_message_data_u8[UT_REDCOR_MSG_LEN_MAX];
 extern uint8_t test_red_payload_data_u8[UT_REDCOR_DATA_LEN_MAX];
-extern bool redcor_initialized;                                                                         ///< initialization state (local variable)
-extern const redcty_RedundancyLayerConfiguration *redcor_redundancy_configuration;                      ///< redundancy channel configuration (in red_core)
-extern redcor_RedundancyChannelData redcor_redundancy_channels[UT_REDCOR_REDUNDANCY_CHANNEL_NUM_MAX];   ///< redundancy channels (in red_core)
+extern RADEF_THREAD_LOCAL redcor_InstanceData *redcor_instance;                                         ///< data of the selected core module instance
 
 /**
  * @brief default config for tests
@@ -124,7 +124,9 @@ class redcorTest : public ::testing::Test
 public:
   redcorTest() {
     // reset initialization state
-    redcor_initialized = false;
+    redcor_instance->initialized = false;
+    // the transport interface is called with the selected RedL instance
+    EXPECT_CALL(redins_mock, redins_GetSelectedInstance()).WillRepeatedly(Return(&test_instance));
   }
   ~redcorTest() {
   }
@@ -151,7 +153,7 @@ public:
    * @brief Function to verify message data
    * This functions verifies that the message data is equal to the test payload data (which gets used in the tests)
    */
-  void VerifySendMessageData(const uint32_t transport_channel_id, const uint16_t message_size, const uint8_t* const message_data) {
+  void VerifySendMessageData(redint_Instance* const instance, const uint32_t transport_channel_id, const uint16_t message_size, const uint8_t* const message_data) {
     for (uint16_t i = 0; i < message_size; i++)
     {
       ASSERT_EQ(message_data[i], test_red_message_data_u8[i]);
@@ -217,9 +219,12 @@ public:
 
   static const uint8_t expected_sequence_nbr_pos      = 4;                ///< expected Byteposition of the Sequence Number (according to RASW-202)
 
+  redint_Instance test_instance = {};     ///< RedL instance, which is passed to the transport interface
+
   StrictMock<rasysMock> rasys_mock;       ///< mock for the rasta system adapter class
   reddfqMock reddfq_mock;                 ///< mock for the redundancy defer queue class
   reddiaMock reddia_mock;                 ///< mock for the redundancy diagnostics class
+  redinsMock redins_mock;                 ///< mock for the redundancy instances class
   redmsgMock redmsg_mock;                 ///< mock for the redundancy messages class
   redrbfMock redrbf_mock;                 ///< mock for the redundancy received buffer class
   redtriMock redtri_mock;                 ///< mock for the redundancy transport interface
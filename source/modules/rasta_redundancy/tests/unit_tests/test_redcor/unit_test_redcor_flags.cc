@@ -228,13 +228,13 @@ TEST_P(SetMessagePendingFlagTestWithParam, redcorTest010VerifySetMessagePendingF
   else
   {
     // verify pending flag not set
-    EXPECT_FALSE(redcor_redundancy_channels[redundancy_channel_id].received_data_pending[transport_channel_id]);
+    EXPECT_FALSE(redcor_instance->redundancy_channels[redundancy_channel_id].received_data_pending[transport_channel_id]);
 
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
     EXPECT_NO_THROW(redcor_SetMessagePendingFlag(redundancy_channel_id, transport_channel_id));
 
     // verify pending flag set
-    EXPECT_TRUE(redcor_redundancy_channels[redundancy_channel_id].received_data_pending[transport_channel_id]);
+    EXPECT_TRUE(redcor_instance->redundancy_channels[redundancy_channel_id].received_data_pending[transport_channel_id]);
   }
 }
 
@@ -438,7 +438,7 @@ TEST_P(ClearMessagePendingFlagTestWithParam, redcorTest012VerifyClearMessagePend
   {
     // set pending flag and verify
     EXPECT_NO_THROW(redcor_SetMessagePendingFlag(redundancy_channel_id, transport_channel_id_to_set_pending));
-    EXPECT_TRUE(redcor_redundancy_channels[redundancy_channel_id].received_data_pending[transport_channel_id_to_set_pending]);
+    EXPECT_TRUE(redcor_instance->redundancy_channels[redundancy_channel_id].received_data_pending[transport_channel_id_to_set_pending]);
   }
 
   // perform the test
@@ -451,7 +451,7 @@ TEST_P(ClearMessagePendingFlagTestWithParam, redcorTest012VerifyClearMessagePend
   {
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
     EXPECT_NO_THROW(redcor_ClearMessagePendingFlag(redundancy_channel_id, transport_channel_id_to_clear_pending));
-    EXPECT_FALSE(redcor_redundancy_channels[redundancy_channel_id].received_data_pending[transport_channel_id_to_clear_pending]);
+    EXPECT_FALSE(redcor_instance->redundancy_channels[redundancy_channel_id].received_data_pending[transport_channel_id_to_clear_pending]);
   }
 }
 
@@ -533,12 +533,12 @@ TEST_P(ClearSendBufferMessagePendingFlagTestWithParam, redcorTest014VerifyClearS
   {
     // Add message and verify
     EXPECT_NO_THROW(redcor_WriteMessagePayloadToSendBuffer(redundancy_channel_id, payload_size, payload));
-    EXPECT_TRUE(redcor_redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
+    EXPECT_TRUE(redcor_instance->redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
 
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
     EXPECT_NO_THROW(redcor_ClearSendBufferMessagePendingFlag(redundancy_channel_id));
 
-    EXPECT_FALSE(redcor_redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
+    EXPECT_FALSE(redcor_instance->redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
   }
 }
 
@@ -605,8 +605,8 @@ TEST_P(ClearInputBufferMessagePendingFlagTestWithParam, redcorTest016VerifyClear
   if(redundancy_channel_id <= UT_REDCOR_REDUNDANCY_CHANNEL_ID_MAX)
   {
     // set flag to true and verify
-    redcor_redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer = true;
-    EXPECT_TRUE(redcor_redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer);
+    redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer = true;
+    EXPECT_TRUE(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer);
   }
 
   // perform the test
@@ -620,7 +620,7 @@ TEST_P(ClearInputBufferMessagePendingFlagTestWithParam, redcorTest016VerifyClear
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
     EXPECT_NO_THROW(redcor_ClearInputBufferMessagePendingFlag(redundancy_channel_id));
 
-    EXPECT_FALSE(redcor_redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer);
+    EXPECT_FALSE(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer);
   }
 }
 
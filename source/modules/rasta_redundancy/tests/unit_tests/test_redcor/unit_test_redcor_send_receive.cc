@@ -224,19 +224,19 @@ TEST_P(WriteReceivedMessageToInputBufferTestWithParam, redcorTest008VerifyWriteR
   else
   {
     // Verify input buffer empty before write
-    ASSERT_EQ(redcor_redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer, false);
-    ASSERT_EQ(redcor_redundancy_channels[redundancy_channel_id].input_buffer.message_buffer.message_size, 0U);
+    ASSERT_EQ(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer, false);
+    ASSERT_EQ(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.message_buffer.message_size, 0U);
 
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
     EXPECT_NO_THROW(redcor_WriteReceivedMessageToInputBuffer(redundancy_channel_id, transport_channel_id, &received_message));
 
     // Verify input buffer is updated and contains message
-    ASSERT_EQ(redcor_redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer, true);
-    ASSERT_EQ(redcor_redundancy_channels[redundancy_channel_id].input_buffer.message_buffer.message_size, received_message.message_size);
-    ASSERT_EQ(redcor_redundancy_channels[redundancy_channel_id].input_buffer.transport_channel_id, transport_channel_id);
+    ASSERT_EQ(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer, true);
+    ASSERT_EQ(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.message_buffer.message_size, received_message.message_size);
+    ASSERT_EQ(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.transport_channel_id, transport_channel_id);
     for (uint16_t copy_index = 0U; copy_index < received_message.message_size; ++copy_index)
     {
-      ASSERT_EQ(redcor_redundancy_channels[redundancy_channel_id].input_buffer.message_buffer.message[copy_index], received_message.message[copy_index]);
+      ASSERT_EQ(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.message_buffer.message[copy_index], received_message.message[copy_index]);
     }
   }
 }
@@ -334,8 +334,8 @@ TEST_P(ProcessReceivedMessageTestWithParam, redcorTest009VerifyProcessReceivedMe
   if(redundancy_channel_id <= UT_REDCOR_REDUNDANCY_CHANNEL_ID_MAX)
   {
     // set next expected sequence numbers
-    redcor_redundancy_channels[redundancy_channel_id].seq_rx = rx_seq_nbr;
-    redcor_redundancy_channels[redundancy_channel_id].seq_tx = tx_seq_nbr;
+    redcor_instance->redundancy_channels[redundancy_channel_id].seq_rx = rx_seq_nbr;
+    redcor_instance->redundancy_channels[redundancy_channel_id].seq_tx = tx_seq_nbr;
   }
 
   // set expectations
@@ -422,6 +422,81 @@ INSTANTIATE_TEST_SUITE_P(
   )
 );
 
+/**
+ * @test        @ID{redcorTest019} Verify the WriteCheckedMessageToInputBuffer function.
+ *
+ * @details     This test verifies, that the ProcessReceivedMessage function uses the check code result written with the WriteCheckedMessageToInputBuffer
+ *              function instead of checking the check code again.
+ *
+ * Test steps:
+ * - Init module with default configuration
+ * - Call WriteCheckedMessageToInputBuffer function with a valid check code and verify message and check code result in input buffer
+ * - Call ProcessReceivedMessage function and verify that the message is added to the received buffer without a check code check
+ * - Call WriteCheckedMessageToInputBuffer function with an invalid check code
+ * - Call ProcessReceivedMessage function and verify that the message is ignored without a check code check
+ * - Call WriteReceivedMessageToInputBuffer function and verify that the check code result is reset
+ * - Call ProcessReceivedMessage function and verify that the check code is checked
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redcorTest, redcorTest019VerifyWriteCheckedMessageToInputBuffer)
+{
+  // test variables
+  const uint32_t redundancy_channel_id      = UT_REDCOR_REDUNDANCY_CHANNEL_ID_MIN;
+  const uint32_t transport_channel_id       = default_config.redundancy_channel_configurations[redundancy_channel_id].transport_channel_ids[0];
+  redtyp_RedundancyMessage message          = {UT_REDCOR_MSG_LEN_MAX, {}};
+
+  // expect calls for configuration validation and init of both redundancy channel
+  EXPECT_CALL(reddia_mock, reddia_IsConfigurationValid(_)).WillOnce(Return(true));
+  EXPECT_CALL(reddia_mock, reddia_InitRedundancyLayerDiagnostics(_)).Times(1);
+  EXPECT_CALL(redmsg_mock, redmsg_Init(_)).Times(1);
+
+  // expect calls for init of each redundancy channel
+  EXPECT_CALL(reddfq_mock, reddfq_InitDeferQueue(_)).Times(default_config.number_of_redundancy_channels);
+  EXPECT_CALL(redrbf_mock, redrbf_InitBuffer(_)).Times(default_config.number_of_redundancy_channels);
+  EXPECT_CALL(reddia_mock, reddia_InitRedundancyChannelDiagnostics(_)).Times(default_config.number_of_redundancy_channels);
+
+  // init the module
+  redcor_Init(&default_config);
+
+  EXPECT_CALL(reddia_mock, reddia_IsTransportChannelIdValid(redundancy_channel_id, transport_channel_id)).Times(3).WillRepeatedly(Return(true));
+  EXPECT_CALL(reddfq_mock, reddfq_IsSequenceNumberOlder(_ ,_)).WillRepeatedly(Invoke(this, &redcorTest::IsSequenceNumberOlder));
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+  // message with valid check code is processed without check code check
+  EXPECT_NO_THROW(redcor_WriteCheckedMessageToInputBuffer(redundancy_channel_id, transport_channel_id, true, &message));
+  EXPECT_TRUE(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer);
+  EXPECT_TRUE(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.check_code_checked);
+  EXPECT_TRUE(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.check_code_valid);
+
+  EXPECT_CALL(redmsg_mock, redmsg_CheckMessageCrc(_)).Times(0);
+  EXPECT_CALL(redmsg_mock, redmsg_GetMessageSequenceNumber(_)).WillRepeatedly(Return(0U));
+  EXPECT_CALL(reddia_mock, reddia_UpdateRedundancyChannelDiagnostics(redundancy_channel_id, transport_channel_id, 0U)).Times(1);
+  EXPECT_CALL(redmsg_mock, redmsg_GetMessagePayload(_, _)).Times(1);
+  EXPECT_CALL(redrbf_mock, redrbf_AddToBuffer(redundancy_channel_id, _)).Times(1);
+  EXPECT_CALL(reddfq_mock, reddfq_Contains(redundancy_channel_id, _)).WillOnce(Return(false));
+  EXPECT_NO_THROW(redcor_ProcessReceivedMessage(redundancy_channel_id));
+  EXPECT_FALSE(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.message_in_buffer);
+
+  // message with invalid check code is ignored without check code check
+  EXPECT_NO_THROW(redcor_WriteCheckedMessageToInputBuffer(redundancy_channel_id, transport_channel_id, false, &message));
+  EXPECT_TRUE(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.check_code_checked);
+  EXPECT_FALSE(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.check_code_valid);
+  EXPECT_NO_THROW(redcor_ProcessReceivedMessage(redundancy_channel_id));
+
+  // check code of a message written without check code result is checked
+  EXPECT_NO_THROW(redcor_WriteReceivedMessageToInputBuffer(redundancy_channel_id, transport_channel_id, &message));
+  EXPECT_FALSE(redcor_instance->redundancy_channels[redundancy_channel_id].input_buffer.check_code_checked);
+  EXPECT_CALL(redmsg_mock, redmsg_CheckMessageCrc(_)).WillOnce(Return(radef_kInvalidMessageCrc));
+  EXPECT_NO_THROW(redcor_ProcessReceivedMessage(redundancy_channel_id));
+}
+
 /**
  * @test        @ID{redcorTest013} Verify the WriteMessagePayloadToSendBuffer function.
  *
@@ -484,11 +559,11 @@ TEST_P(WriteMessagePayloadToSendBufferTestWithParam, redcorTest013VerifyWriteMes
   {
     if(message_already_in_buffer)
     {
-      redcor_redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer = true;
+      redcor_instance->redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer = true;
     }
     else
     {
-      EXPECT_FALSE(redcor_redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
+      EXPECT_FALSE(redcor_instance->redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
     }
   }
 
@@ -506,11 +581,11 @@ TEST_P(WriteMessagePayloadToSendBufferTestWithParam, redcorTest013VerifyWriteMes
     // verify the payload content
     for (uint16_t index = 0U; index < payload_size; ++index)
     {
-      EXPECT_EQ(redcor_redundancy_channels[redundancy_channel_id].send_buffer.message_payload_buffer.payload[index], test_red_payload_data_u8[index]);
+      EXPECT_EQ(redcor_instance->redundancy_channels[redundancy_channel_id].send_buffer.message_payload_buffer.payload[index], test_red_payload_data_u8[index]);
     }
 
     // verify the message in buffer flag is set
-    EXPECT_TRUE(redcor_redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
+    EXPECT_TRUE(redcor_instance->redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
   }
 }
 
@@ -598,11 +673,11 @@ TEST_P(SendMessageTestWithParam, redcorTest015VerifySendMessage)
     if(add_message_to_buffer)
     {
       EXPECT_NO_THROW(redcor_WriteMessagePayloadToSendBuffer(redundancy_channel_id, payload_size, &payload));
-      EXPECT_TRUE(redcor_redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
+      EXPECT_TRUE(redcor_instance->redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
     }
     else
     {
-      EXPECT_FALSE(redcor_redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
+      EXPECT_FALSE(redcor_instance->redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
     }
   }
 
@@ -616,13 +691,13 @@ TEST_P(SendMessageTestWithParam, redcorTest015VerifySendMessage)
   {
     // Send message on each transport channel
     EXPECT_CALL(redmsg_mock, redmsg_CreateMessage(_, _, _)).WillOnce(SetArgPointee<2>(message_to_send));
-    EXPECT_CALL(redtri_mock, redtri_SendMessage(_, _, _)).Times(2).WillRepeatedly(Invoke(this, &redcorTest::VerifySendMessageData));
+    EXPECT_CALL(redtri_mock, redtri_SendMessage(&test_instance, _, _, _)).Times(2).WillRepeatedly(Invoke(this, &redcorTest::VerifySendMessageData));
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
 
     EXPECT_NO_THROW(redcor_SendMessage(redundancy_channel_id));
 
-    EXPECT_FALSE(redcor_redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
-    EXPECT_EQ(redcor_redundancy_channels[redundancy_channel_id].seq_tx, expected_next_seq_nbr_to_be_sent);
+    EXPECT_FALSE(redcor_instance->redundancy_channels[redundancy_channel_id].send_buffer.message_in_buffer);
+    EXPECT_EQ(redcor_instance->redundancy_channels[redundancy_channel_id].seq_tx, expected_next_seq_nbr_to_be_sent);
   }
 }
 
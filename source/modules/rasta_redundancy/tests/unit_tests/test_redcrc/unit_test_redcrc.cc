@@ -34,6 +34,36 @@
 // Local Function Prototypes
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Calculates a CRC bit by bit as reference for the table driven implementation
+ *
+ * @param check_code_type Check code type to calculate (redcty_kCheckCodeB to redcty_kCheckCodeE)
+ * @param data_size Size of the data [bytes]
+ * @param data Pointer to the data
+ * @return Calculated CRC
+ */
+static uint32_t CalculateReferenceCrc(redcty_CheckCodeType check_code_type, uint16_t data_size, const uint8_t * data);
+
+/**
+ * @brief Calculates the CRC register bit by bit, without initial value and final xor of the check code type
+ *
+ * @param check_code_type Check code type to calculate (redcty_kCheckCodeB to redcty_kCheckCodeE)
+ * @param initial_register Initial CRC register (reflected for reflected check code types)
+ * @param data_size Size of the data [bytes]
+ * @param data Pointer to the data
+ * @return Calculated CRC register (reflected for reflected check code types)
+ */
+static uint32_t CalculateReferenceCrcRegister(redcty_CheckCodeType check_code_type, uint32_t initial_register, uint16_t data_size, const uint8_t * data);
+
+/**
+ * @brief Reflects the lower number_of_bits of a value
+ *
+ * @param value Value to reflect
+ * @param number_of_bits Number of bits to reflect
+ * @return Reflected value
+ */
+static uint32_t ReflectReferenceBits(uint32_t value, uint16_t number_of_bits);
+
 // -----------------------------------------------------------------------------
 // Local Constant Definitions
 // -----------------------------------------------------------------------------
@@ -145,6 +175,20 @@ class CalculateCrcTestWithParam:    public redcrcTest,
   radef_RaStaReturnCode expected_error =                std::get<3>(GetParam());        ///< expected error return code
 };
 
+/**
+ * @brief Test class for value-parametrized reference crc test
+ *
+ * Parameter order:
+ * - Configured check code type (redcty_CheckCodeType)
+ * .
+ */
+class ReferenceCrcTestWithParam:    public redcrcTest,
+                                    public testing::WithParamInterface<redcty_CheckCodeType>
+{
+  public:
+  redcty_CheckCodeType configured_checkcode_type =      GetParam();                     ///< configured check code type
+};
+
 // -----------------------------------------------------------------------------
 // Test Cases
 // -----------------------------------------------------------------------------
@@ -190,23 +234,21 @@ class CalculateCrcTestWithParam:    public redcrcTest,
  */
 TEST_P(InitTestWithParam, redcrcTest001VerifyInitFunction)
 {
-  extern uint32_t redcrc_check_code_type;
-
   // perform test
   if(expect_fatal_error)
   {
     // call the init function and expect a fatal error
     EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &redcrcTest::invalidArgumentException));
-    EXPECT_THROW(redcrc_Init(configured_checkcode_type), std::invalid_argument);
+    EXPECT_THROW(redcrc_Init(&crc_engine, configured_checkcode_type), std::invalid_argument);
   }
   else
   {
     // call the init function and verify if parameter are set correctly
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
-    EXPECT_NO_THROW(redcrc_Init(configured_checkcode_type));
+    EXPECT_NO_THROW(redcrc_Init(&crc_engine, configured_checkcode_type));
 
-    EXPECT_EQ(redcrc_check_code_type, configured_checkcode_type);
-    EXPECT_TRUE(redcrc_initialized);
+    EXPECT_EQ(crc_engine.check_code_type, configured_checkcode_type);
+    EXPECT_TRUE(crc_engine.initialized);
   }
 }
 
@@ -245,20 +287,22 @@ TEST_F(redcrcTest, redcrcTest002VerifyInitFunctionCalls)
   EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kAlreadyInitialized)).WillOnce(Invoke(this, &redcrcTest::invalidArgumentException));
 
   // call the init function and verify that it completes successful
-  EXPECT_NO_THROW(redcrc_Init(redcty_kCheckCodeA));
+  EXPECT_NO_THROW(redcrc_Init(&crc_engine, redcty_kCheckCodeA));
 
   // call the init function again and verify that an assertion violations is raised as the module is already initialized
-  EXPECT_THROW(redcrc_Init(redcty_kCheckCodeA), std::invalid_argument);
+  EXPECT_THROW(redcrc_Init(&crc_engine, redcty_kCheckCodeA), std::invalid_argument);
 }
 
 /**
  * @test        @ID{redcrcTest003} Null pointer checks
  *
- * @details     This test verifies that the fatal error function is executed whenever the redcrc_CalculateCrc is called
- *              with a null pointer as argument.
+ * @details     This test verifies that the fatal error function is executed whenever the redcrc_Init or the redcrc_CalculateCrc
+ *              function is called with a null pointer as argument.
  *
  * Test steps:
+ * - call the redcrc_Init function with invalid CRC engine pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - init module
+ * - call the redcrc_CalculateCrc function with invalid CRC engine pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the redcrc_CalculateCrc function with invalid data buffer pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the redcrc_CalculateCrc function with invalid calculated crc pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * .
@@ -272,10 +316,7 @@ TEST_F(redcrcTest, redcrcTest002VerifyInitFunctionCalls)
  */
 TEST_F(redcrcTest, redcrcTest003VerifyNullPointerCheck)
 {
-  // init module
-  redcrc_Init(redcty_kCheckCodeB);
-
-  const uint8_t nbr_of_function_calls = 2U;        // number of function calls
+  const uint8_t nbr_of_function_calls = 4U;        // number of function calls
 
   // set test variables
   uint16_t data_size = UT_REDCRC_DATA_LEN_MIN;
@@ -288,8 +329,14 @@ TEST_F(redcrcTest, redcrcTest003VerifyNullPointerCheck)
     .WillRepeatedly(Invoke(this, &redcrcTest::invalidArgumentException));
 
   // perform test
-  EXPECT_THROW(redcrc_CalculateCrc(data_size, (uint8_t *)NULL, &calculated_crc),std::invalid_argument);
-  EXPECT_THROW(redcrc_CalculateCrc(data_size, &data_buffer, (uint32_t *)NULL),std::invalid_argument);
+  EXPECT_THROW(redcrc_Init((redcrc_CrcEngine *)NULL, redcty_kCheckCodeB),std::invalid_argument);
+
+  // init module
+  redcrc_Init(&crc_engine, redcty_kCheckCodeB);
+
+  EXPECT_THROW(redcrc_CalculateCrc((redcrc_CrcEngine *)NULL, data_size, &data_buffer, &calculated_crc),std::invalid_argument);
+  EXPECT_THROW(redcrc_CalculateCrc(&crc_engine, data_size, (uint8_t *)NULL, &calculated_crc),std::invalid_argument);
+  EXPECT_THROW(redcrc_CalculateCrc(&crc_engine, data_size, &data_buffer, (uint32_t *)NULL),std::invalid_argument);
 }
 
 /**
@@ -341,20 +388,20 @@ TEST_P(CalculateCrcTestWithParam, redcrcTest004VerifyCalculateCrcFunction)
   uint32_t calculated_crc = 0U;
 
   // init module
-  redcrc_Init(configured_checkcode_type);
+  redcrc_Init(&crc_engine, configured_checkcode_type);
 
   // perform test
   if(expected_error != radef_kNoError)
   {
     // call the init function and expect a fatal error
     EXPECT_CALL(rasys_mock, rasys_FatalError(expected_error)).WillOnce(Invoke(this, &redcrcTest::invalidArgumentException));
-    EXPECT_THROW(redcrc_CalculateCrc(data_size, data_pointer, &calculated_crc), std::invalid_argument);
+    EXPECT_THROW(redcrc_CalculateCrc(&crc_engine, data_size, data_pointer, &calculated_crc), std::invalid_argument);
   }
   else
   {
     // call the init function and verify if parameter are set correctly
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
-    EXPECT_NO_THROW(redcrc_CalculateCrc(data_size, data_pointer, &calculated_crc));
+    EXPECT_NO_THROW(redcrc_CalculateCrc(&crc_engine, data_size, data_pointer, &calculated_crc));
 
     // verify generated crc value
     switch (configured_checkcode_type)
@@ -388,8 +435,516 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(redcty_kCheckCodeE, UT_REDCRC_DATA_LEN_MAX, (uint8_t*)test_message, radef_kNoError)
   ));
 
+/**
+ * @test        @ID{redcrcTest005} Verify the redcrc_CalculateCrc function against a bitwise reference.
+ *
+ * @details     This test verifies that the redcrc_CalculateCrc function calculates the same CRC as a bitwise
+ *              reference implementation for all data sizes and different alignments of the data buffer. This covers
+ *              the slicing-by-8 steps as well as all numbers of remaining bytes.
+ *
+ * Test steps:
+ * - init the module with the given check code type
+ * - for every data size from the minimum to the maximum data size and every data buffer offset from 0 to 7
+ *   - call the redcrc_CalculateCrc function
+ *   - verify that the calculated CRC matches the bitwise reference CRC
+ * .
+ *
+ * @testParameter
+ * - Check code type: Check code type to use
+ * .
+ * | Test Run | Input parameter    |
+ * |----------|--------------------|
+ * |          | Check code type    |
+ * | 0        | redcty_kCheckCodeB |
+ * | 1        | redcty_kCheckCodeC |
+ * | 2        | redcty_kCheckCodeD |
+ * | 3        | redcty_kCheckCodeE |
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         This is a value-parametrized test case which needs instantiation with defined values.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_P(ReferenceCrcTestWithParam, redcrcTest005VerifyCalculateCrcAgainstReference)
+{
+  const uint16_t max_offset = 8U;
+  uint8_t test_data[UT_REDCRC_DATA_LEN_MAX + max_offset];
+
+  // pseudo random test data
+  uint32_t random_value = 0x12345678U;
+  for (uint32_t i = 0U; i < sizeof(test_data); i++) {
+    random_value = (random_value * 1103515245U) + 12345U;
+    test_data[i] = (uint8_t)(random_value >> 16U);
+  }
+
+  // init module
+  redcrc_Init(&crc_engine, configured_checkcode_type);
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+  for (uint16_t offset = 0U; offset < max_offset; offset++) {
+    for (uint16_t data_size = UT_REDCRC_DATA_LEN_MIN; data_size <= UT_REDCRC_DATA_LEN_MAX; data_size++) {
+      uint32_t calculated_crc = 0U;
+      redcrc_CalculateCrc(&crc_engine, data_size, &test_data[offset], &calculated_crc);
+      ASSERT_EQ(calculated_crc, CalculateReferenceCrc(configured_checkcode_type, data_size, &test_data[offset]))
+        << "data size: " << data_size << ", offset: " << offset;
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  verifyCalculateCrcAgainstReference,
+  ReferenceCrcTestWithParam,
+  ::testing::Values(
+    redcty_kCheckCodeB,
+    redcty_kCheckCodeC,
+    redcty_kCheckCodeD,
+    redcty_kCheckCodeE
+  ));
+
+/**
+ * @test        @ID{redcrcTest006} Verify the hardware CRC32C calculation.
+ *
+ * @details     This test verifies that the hardware CRC32C is only used for check code type C and that it calculates
+ *              the same CRC as the table algorithm for all data sizes and different alignments of the data buffer.
+ *
+ * Test steps:
+ * - init the module with check code type B and verify that the hardware CRC32C is not used
+ * - init the module with check code type C
+ * - for every data size from the minimum to the maximum data size and every data buffer offset from 0 to 7
+ *   - call the redcrc_CalculateCrc function with the selected CRC calculation (hardware if supported by the CPU)
+ *   - call the redcrc_CalculateCrc function with the table algorithm
+ *   - verify that both CRCs match
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redcrcTest, redcrcTest006VerifyHardwareCrc32c)
+{
+  const uint16_t max_offset = 8U;
+  uint8_t test_data[UT_REDCRC_DATA_LEN_MAX + max_offset];
+
+  for (uint32_t i = 0U; i < sizeof(test_data); i++) {
+    test_data[i] = (uint8_t)((i * 37U) + (i >> 3U));
+  }
+
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+  // no hardware CRC for other check code types
+  redcrc_Init(&crc_engine, redcty_kCheckCodeB);
+  EXPECT_FALSE(crc_engine.hardware_crc32c_enabled);
+
+  crc_engine.initialized = false;
+  redcrc_Init(&crc_engine, redcty_kCheckCodeC);
+  const bool hardware_crc32c_enabled = crc_engine.hardware_crc32c_enabled;
+
+  for (uint16_t offset = 0U; offset < max_offset; offset++) {
+    for (uint16_t data_size = UT_REDCRC_DATA_LEN_MIN; data_size <= UT_REDCRC_DATA_LEN_MAX; data_size++) {
+      uint32_t selected_crc = 0U;
+      uint32_t table_crc = 0U;
+
+      crc_engine.hardware_crc32c_enabled = hardware_crc32c_enabled;
+      redcrc_CalculateCrc(&crc_engine, data_size, &test_data[offset], &selected_crc);
+      crc_engine.hardware_crc32c_enabled = false;
+      redcrc_CalculateCrc(&crc_engine, data_size, &test_data[offset], &table_crc);
+
+      ASSERT_EQ(selected_crc, table_crc) << "data size: " << data_size << ", offset: " << offset;
+    }
+  }
+}
+
+/**
+ * @test        @ID{redcrcTest007} Verify the carry-less multiplication CRC calculation.
+ *
+ * @details     This test verifies that the carry-less multiplication is not used for check code type C and that it
+ *              calculates the same CRC as the table algorithm for the check code types B, D and E, all data sizes and
+ *              different alignments of the data buffer.
+ *
+ * Test steps:
+ * - init the module with check code type C and verify that the carry-less multiplication is not used
+ * - for the check code types B, D and E
+ *   - init the module with the check code type
+ *   - for every data size from the minimum to the maximum data size and every data buffer offset from 0 to 7
+ *     - call the redcrc_CalculateCrc function with the selected CRC calculation (carry-less multiplication if supported by the CPU)
+ *     - call the redcrc_CalculateCrc function with the table algorithm
+ *     - verify that both CRCs match
+ *   .
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redcrcTest, redcrcTest007VerifyHardwareFolding)
+{
+  const uint16_t max_offset = 8U;
+  const redcty_CheckCodeType check_code_types[] = {redcty_kCheckCodeB, redcty_kCheckCodeD, redcty_kCheckCodeE};
+  uint8_t test_data[UT_REDCRC_DATA_LEN_MAX + max_offset];
+
+  for (uint32_t i = 0U; i < sizeof(test_data); i++) {
+    test_data[i] = (uint8_t)((i * 53U) + (i >> 2U));
+  }
+
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+  // no carry-less multiplication for check code type C
+  redcrc_Init(&crc_engine, redcty_kCheckCodeC);
+  EXPECT_FALSE(crc_engine.hardware_folding_enabled);
+
+  for (const redcty_CheckCodeType check_code_type : check_code_types) {
+    crc_engine.initialized = false;
+    redcrc_Init(&crc_engine, check_code_type);
+    const bool hardware_folding_enabled = crc_engine.hardware_folding_enabled;
+
+    for (uint16_t offset = 0U; offset < max_offset; offset++) {
+      for (uint16_t data_size = UT_REDCRC_DATA_LEN_MIN; data_size <= UT_REDCRC_DATA_LEN_MAX; data_size++) {
+        uint32_t selected_crc = 0U;
+        uint32_t table_crc = 0U;
+
+        crc_engine.hardware_folding_enabled = hardware_folding_enabled;
+        redcrc_CalculateCrc(&crc_engine, data_size, &test_data[offset], &selected_crc);
+        crc_engine.hardware_folding_enabled = false;
+        redcrc_CalculateCrc(&crc_engine, data_size, &test_data[offset], &table_crc);
+
+        ASSERT_EQ(selected_crc, table_crc) << "check code type: " << check_code_type << ", data size: " << data_size << ", offset: " << offset;
+      }
+    }
+  }
+}
+
+/**
+ * @test        @ID{redcrcTest008} Verify the constant CRC tables.
+ *
+ * @details     This test verifies the generated constant CRC tables against the bitwise reference CRC calculation.
+ *
+ * Test steps:
+ * - for the check code types B, C, D and E
+ *   - verify that every entry n of slicing table t equals the CRC register of byte n followed by t zero bytes
+ *     (aligned to the most significant bit for non-reflected check code types)
+ *   - verify that every folding constant equals the CRC register of a single set bit followed by zero bytes,
+ *     which is x^k mod P for the exponent k of the constant (reflected within 64 bits for reflected check code types)
+ *   .
+ * - verify that every entry n of shift table t equals the CRC32C register (n << 8t) shifted over the stream size of zero bytes
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redcrcTest, redcrcTest008VerifyConstantCrcTables)
+{
+  const uint16_t widths[REDCRC_TABLE_TYPES] = {32U, 32U, 16U, 16U};
+  uint8_t test_data[REDCRC_CRC32C_STREAM_SIZE] = {};
+
+  for (uint16_t table_type = 0U; table_type < REDCRC_TABLE_TYPES; table_type++) {
+    const redcty_CheckCodeType check_code_type = (redcty_CheckCodeType)(redcty_kCheckCodeB + table_type);
+    const uint16_t width = widths[table_type];
+    const bool reflected = (check_code_type != redcty_kCheckCodeB);
+
+    // slicing tables
+    for (uint16_t slicing_table = 0U; slicing_table < REDCRC_SLICING_TABLES; slicing_table++) {
+      for (uint16_t table_index = 0U; table_index < REDCRC_TABLE_SIZE; table_index++) {
+        test_data[0] = (uint8_t)table_index;
+        uint32_t expected_value = CalculateReferenceCrcRegister(check_code_type, 0U, slicing_table + 1U, test_data);
+        if (!reflected) {
+          expected_value <<= (32U - width);
+        }
+        ASSERT_EQ(redcrc_kCrcTables[table_type][slicing_table][table_index], expected_value)
+            << "check code type: " << check_code_type << ", table: " << slicing_table << ", index: " << table_index;
+      }
+    }
+
+    // folding constants, a single set bit in the first byte followed by zero bytes is x^((8 * length) - 8 + width), respectively
+    // x^((8 * length) - 1 + width) with reflected input
+    const uint32_t exponents[4] = {reflected ? 191U : 128U, reflected ? 127U : 192U, reflected ? 575U : 512U, reflected ? 511U : 576U};
+    const uint64_t constants[4] = {redcrc_kFoldingConstants[table_type].fold_128_low, redcrc_kFoldingConstants[table_type].fold_128_high,
+                                   redcrc_kFoldingConstants[table_type].fold_512_low, redcrc_kFoldingConstants[table_type].fold_512_high};
+    uint8_t folding_data[80] = {};
+    folding_data[0] = 1U;
+    for (uint16_t constant_index = 0U; constant_index < 4U; constant_index++) {
+      const uint16_t length = (uint16_t)((exponents[constant_index] - width + (reflected ? 1U : 8U)) / 8U);
+      uint64_t expected_value = CalculateReferenceCrcRegister(check_code_type, 0U, length, folding_data);
+      if (reflected) {
+        expected_value <<= (64U - width);
+      }
+      EXPECT_EQ(constants[constant_index], expected_value) << "check code type: " << check_code_type << ", constant: " << constant_index;
+    }
+  }
+
+  // CRC32C shift tables
+  std::memset(test_data, 0, sizeof(test_data));
+  for (uint16_t shift_table = 0U; shift_table < REDCRC_CRC32C_SHIFT_TABLES; shift_table++) {
+    for (uint16_t table_index = 0U; table_index < REDCRC_TABLE_SIZE; table_index++) {
+      const uint32_t crc = (uint32_t)table_index << (8U * shift_table);
+      ASSERT_EQ(redcrc_kCrc32cShiftTables[shift_table][table_index],
+                CalculateReferenceCrcRegister(redcty_kCheckCodeC, crc, REDCRC_CRC32C_STREAM_SIZE, test_data))
+          << "table: " << shift_table << ", index: " << table_index;
+    }
+  }
+}
+
+/**
+ * @test        @ID{redcrcTest009} Verify independent CRC engines.
+ *
+ * @details     This test verifies that several CRC engines with different check code types can be used alternately
+ *              and that every engine calculates the CRC of its own check code type.
+ *
+ * Test steps:
+ * - init one CRC engine for each of the check code types B, C, D and E
+ * - for every data size from the minimum to the maximum data size
+ *   - call the redcrc_CalculateCrc function alternately with every engine
+ *   - verify that every calculated CRC matches the bitwise reference CRC of the check code type of the engine
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redcrcTest, redcrcTest009VerifyIndependentCrcEngines)
+{
+  const redcty_CheckCodeType check_code_types[REDCRC_TABLE_TYPES] = {redcty_kCheckCodeB, redcty_kCheckCodeC, redcty_kCheckCodeD, redcty_kCheckCodeE};
+  redcrc_CrcEngine crc_engines[REDCRC_TABLE_TYPES] = {};
+
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+  for (uint16_t engine_index = 0U; engine_index < REDCRC_TABLE_TYPES; engine_index++) {
+    redcrc_Init(&crc_engines[engine_index], check_code_types[engine_index]);
+  }
+
+  for (uint16_t data_size = UT_REDCRC_DATA_LEN_MIN; data_size <= UT_REDCRC_DATA_LEN_MAX; data_size++) {
+    for (uint16_t engine_index = 0U; engine_index < REDCRC_TABLE_TYPES; engine_index++) {
+      uint32_t calculated_crc = 0U;
+      redcrc_CalculateCrc(&crc_engines[engine_index], data_size, test_message, &calculated_crc);
+
+      ASSERT_EQ(calculated_crc, CalculateReferenceCrc(check_code_types[engine_index], data_size, test_message))
+          << "check code type: " << check_code_types[engine_index] << ", data size: " << data_size;
+    }
+  }
+}
+
+/**
+ * @test        @ID{redcrcTest010} Verify the input parameter check of the redcrc_CalculateCrcBatch function.
+ *
+ * @details     This test verifies that the fatal error function is executed whenever the
+ *              redcrc_CalculateCrcBatch function is called with invalid parameters.
+ *
+ * Test steps:
+ * - call the redcrc_CalculateCrcBatch function without initialized CRC engine and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - init module
+ * - call the redcrc_CalculateCrcBatch function with invalid CRC engine pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the redcrc_CalculateCrcBatch function with invalid entries pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the redcrc_CalculateCrcBatch function with zero entries and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the redcrc_CalculateCrcBatch function with an entry with invalid data pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the redcrc_CalculateCrcBatch function with an entry with invalid result pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the redcrc_CalculateCrcBatch function with an entry with too small data size and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the redcrc_CalculateCrcBatch function with an entry with too large data size and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redcrcTest, redcrcTest010VerifyBatchParameterCheck)
+{
+  const uint16_t nbr_of_entries = 2U;              // number of batch entries
+  const uint8_t nbr_of_function_calls = 7U;        // number of function calls
+
+  // set test variables
+  uint32_t calculated_crcs[nbr_of_entries] = {};
+  redcrc_CrcBatchEntry entries[nbr_of_entries] = {};
+
+  for (uint16_t i = 0U; i < nbr_of_entries; i++) {
+    entries[i].data_size = UT_REDCRC_DATA_LEN_MIN;
+    entries[i].data_buffer = test_message;
+    entries[i].calculated_crc = &calculated_crcs[i];
+  }
+
+  // set expectations
+  EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kNotInitialized)).WillOnce(Invoke(this, &redcrcTest::invalidArgumentException));
+  EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter))
+    .Times(nbr_of_function_calls)
+    .WillRepeatedly(Invoke(this, &redcrcTest::invalidArgumentException));
+
+  // perform test
+  EXPECT_THROW(redcrc_CalculateCrcBatch(&crc_engine, nbr_of_entries, entries), std::invalid_argument);
+
+  // init module
+  redcrc_Init(&crc_engine, redcty_kCheckCodeB);
+
+  EXPECT_THROW(redcrc_CalculateCrcBatch((redcrc_CrcEngine *)NULL, nbr_of_entries, entries), std::invalid_argument);
+  EXPECT_THROW(redcrc_CalculateCrcBatch(&crc_engine, nbr_of_entries, (redcrc_CrcBatchEntry *)NULL), std::invalid_argument);
+  EXPECT_THROW(redcrc_CalculateCrcBatch(&crc_engine, 0U, entries), std::invalid_argument);
+
+  entries[1].data_buffer = NULL;
+  EXPECT_THROW(redcrc_CalculateCrcBatch(&crc_engine, nbr_of_entries, entries), std::invalid_argument);
+  entries[1].data_buffer = test_message;
+
+  entries[1].calculated_crc = NULL;
+  EXPECT_THROW(redcrc_CalculateCrcBatch(&crc_engine, nbr_of_entries, entries), std::invalid_argument);
+  entries[1].calculated_crc = &calculated_crcs[1];
+
+  entries[1].data_size = UT_REDCRC_DATA_LEN_MIN - 1U;
+  EXPECT_THROW(redcrc_CalculateCrcBatch(&crc_engine, nbr_of_entries, entries), std::invalid_argument);
+
+  entries[1].data_size = UT_REDCRC_DATA_LEN_MAX + 1U;
+  EXPECT_THROW(redcrc_CalculateCrcBatch(&crc_engine, nbr_of_entries, entries), std::invalid_argument);
+}
+
+/**
+ * @test        @ID{redcrcTest011} Verify the redcrc_CalculateCrcBatch function.
+ *
+ * @details     This test verifies that the redcrc_CalculateCrcBatch function calculates the same CRCs as the bitwise
+ *              reference CRC calculation for data buffers of different sizes and alignments within one batch.
+ *
+ * Test steps:
+ * - prepare batch entries with data sizes below and above the carry-less multiplication limit and the minimum and maximum data size
+ * - for the check code types B, C, D and E, with and without CPU instructions
+ *   - init the module with the check code type
+ *   - call the redcrc_CalculateCrcBatch function for a growing number of entries (not a multiple of the lanes as well)
+ *   - verify that the CRC of every entry matches the bitwise reference CRC
+ *   .
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redcrcTest, redcrcTest011VerifyCalculateCrcBatch)
+{
+  const uint16_t nbr_of_entries = 11U;             // number of batch entries
+  const uint16_t data_sizes[nbr_of_entries] = {UT_REDCRC_DATA_LEN_MAX, UT_REDCRC_DATA_LEN_MIN, 37U, 43U, 44U, 63U, 64U, 100U, 500U, 1000U, 1101U};
+  const uint16_t offsets[nbr_of_entries] = {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 8U};
+  const redcty_CheckCodeType check_code_types[REDCRC_TABLE_TYPES] = {redcty_kCheckCodeB, redcty_kCheckCodeC, redcty_kCheckCodeD, redcty_kCheckCodeE};
+
+  // set test variables
+  uint32_t calculated_crcs[nbr_of_entries] = {};
+  redcrc_CrcBatchEntry entries[nbr_of_entries] = {};
+
+  for (uint16_t i = 0U; i < nbr_of_entries; i++) {
+    entries[i].data_size = data_sizes[i];
+    entries[i].data_buffer = &test_message[offsets[i]];
+    entries[i].calculated_crc = &calculated_crcs[i];
+  }
+
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+  for (const redcty_CheckCodeType check_code_type : check_code_types) {
+    for (const bool hardware_enabled : {true, false}) {
+      crc_engine.initialized = false;
+      redcrc_Init(&crc_engine, check_code_type);
+      if (!hardware_enabled) {
+        crc_engine.hardware_crc32c_enabled = false;
+        crc_engine.hardware_folding_enabled = false;
+      }
+
+      for (uint16_t batch_size = 1U; batch_size <= nbr_of_entries; batch_size++) {
+        std::memset(calculated_crcs, 0, sizeof(calculated_crcs));
+
+        // perform test
+        redcrc_CalculateCrcBatch(&crc_engine, batch_size, entries);
+
+        // verify the calculated CRCs
+        for (uint16_t i = 0U; i < batch_size; i++) {
+          ASSERT_EQ(calculated_crcs[i], CalculateReferenceCrc(check_code_type, data_sizes[i], &test_message[offsets[i]]))
+              << "check code type: " << check_code_type << ", hardware: " << hardware_enabled << ", batch size: " << batch_size << ", entry: " << i;
+        }
+      }
+    }
+  }
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
 // Local Function Implementations
 // -----------------------------------------------------------------------------
+
+static uint32_t CalculateReferenceCrc(redcty_CheckCodeType check_code_type, uint16_t data_size, const uint8_t * data) {
+  // Only check code type C uses an initial value and a final xor, both are symmetric to reflection
+  const uint32_t initial_value = (check_code_type == redcty_kCheckCodeC) ? 0xFFFFFFFFU : 0U;
+  const uint32_t final_xor = (check_code_type == redcty_kCheckCodeC) ? 0xFFFFFFFFU : 0U;
+
+  return CalculateReferenceCrcRegister(check_code_type, initial_value, data_size, data) ^ final_xor;
+}
+
+static uint32_t CalculateReferenceCrcRegister(redcty_CheckCodeType check_code_type, uint32_t initial_register, uint16_t data_size, const uint8_t * data) {
+  // CRC parameters according to the check code types of the RaSTA standard
+  uint16_t width = 32U;
+  uint32_t polynomial = 0xEE5B42FDU;
+  bool reflected = false;
+
+  switch (check_code_type) {
+    case redcty_kCheckCodeC:
+      polynomial = 0x1EDC6F41U;
+      reflected = true;
+      break;
+    case redcty_kCheckCodeD:
+      width = 16U;
+      polynomial = 0x1021U;
+      reflected = true;
+      break;
+    case redcty_kCheckCodeE:
+      width = 16U;
+      polynomial = 0x8005U;
+      reflected = true;
+      break;
+    default:
+      break;
+  }
+
+  const uint32_t high_bit = (uint32_t)1U << (width - 1U);
+  const uint32_t mask = (high_bit - 1U) | high_bit;
+  uint32_t crc = reflected ? ReflectReferenceBits(initial_register, width) : initial_register;
+
+  for (uint16_t index = 0U; index < data_size; index++) {
+    uint32_t data_byte = data[index];
+    if (reflected) {
+      data_byte = ReflectReferenceBits(data_byte, 8U);
+    }
+    crc ^= data_byte << (width - 8U);
+    for (uint16_t bit = 0U; bit < 8U; bit++) {
+      if ((crc & high_bit) != 0U) {
+        crc = (crc << 1U) ^ polynomial;
+      } else {
+        crc <<= 1U;
+      }
+      crc &= mask;
+    }
+  }
+
+  if (reflected) {
+    crc = ReflectReferenceBits(crc, width);
+  }
+  return crc & mask;
+}
+
+static uint32_t ReflectReferenceBits(uint32_t value, uint16_t number_of_bits) {
+  uint32_t reflected_value = 0U;
+  for (uint16_t bit = 0U; bit < number_of_bits; bit++) {
+    if ((value & ((uint32_t)1U << bit)) != 0U) {
+      reflected_value |= (uint32_t)1U << (number_of_bits - 1U - bit);
+    }
+  }
+  return reflected_value;
+}
@@ -21,11 +21,13 @@
 
 // clang-format off
 #include <vector>
+#include <cstring>
 #include <cmath>
 #include <stdexcept>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "src/redcrc_red_crc.h"
+#include "src/redcrc_red_crc_tables.h"
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasys_mock.hh"
 #include "test_helper.hh"
@@ -50,7 +52,6 @@ using testing::Return;
 // Global Variable Declarations
 // -----------------------------------------------------------------------------
 
-extern bool redcrc_initialized;    ///< initialization state (local variable)
 
 // -----------------------------------------------------------------------------
 // Global Const Declarations
@@ -73,8 +74,8 @@ class redcrcTest : public ::testing::Test
 public:
   redcrcTest()
   {
-    // reset initialization state
-    redcrc_initialized = false;
+    // reset CRC engine
+    std::memset(&crc_engine, 0, sizeof(crc_engine));
   }
   ~redcrcTest()
   {
@@ -89,6 +90,7 @@ public:
   }
 
   rasysMock rasys_mock;        ///< mock for the rasta system adapter class
+  redcrc_CrcEngine crc_engine;  ///< CRC engine under test
 };
 
 #endif  // SOURCE_MODULES_RASTA_REDUNDANCY_TESTS_UNIT_TESTS_TEST_REDCRC_UNIT_TEST_REDCRC_HH_
@@ -257,7 +257,7 @@ class GetUsedEntriesTestWithParam :     public reddfqTest,
  *
  * @testParameter
  * - Redundancy channels: Number of configured redundancy channels
- * - Queue size: Configured defer queue size (in messages) (valid range: 4 - 10)
+ * - Queue size: Configured defer queue size (in messages) (valid range: 4 - 64)
  * - Tseq: Configured Tseq (in ms) (valid range: 50 - 500)
  * - Expect Fatal Error: Indicates if a fatal error is expected
  * .
@@ -265,13 +265,13 @@ class GetUsedEntriesTestWithParam :     public reddfqTest,
  * |----------|---------------------|----------------|------|--------------------|--------------------|
  * |          | Redundancy channels | Queue size     | Tseq | Expect Fatal Error | Test Result        |
  * | 0        | 1                   | 4U             | 50U  | false              | Normal operation   |
- * | 1        | 2                   | 10U            | 500U | false              | Normal operation   |
+ * | 1        | 2                   | 64U            | 500U | false              | Normal operation   |
  * | 2        | 0                   | 4U             | 50U  | true               | Fatal error raised |
  * | 3        | 1                   | 3U             | 50U  | true               | Fatal error raised |
  * | 4        | 1                   | 4U             | 49U  | true               | Fatal error raised |
- * | 5        | 3                   | 10U            | 500U | true               | Fatal error raised |
- * | 6        | 2                   | 11U            | 500U | true               | Fatal error raised |
- * | 7        | 2                   | 10U            | 501U | true               | Fatal error raised |
+ * | 5        | 3                   | 64U            | 500U | true               | Fatal error raised |
+ * | 6        | 2                   | 65U            | 500U | true               | Fatal error raised |
+ * | 7        | 2                   | 64U            | 501U | true               | Fatal error raised |
  *
  * @safetyRel   No
  *
@@ -282,9 +282,6 @@ class GetUsedEntriesTestWithParam :     public reddfqTest,
  */
 TEST_P(InitTestWithParam, reddfqTest001VerifyInitFunction)
 {
-  extern uint32_t reddfq_number_of_red_channels;
-  extern uint32_t reddfq_defer_queue_size;
-  extern uint32_t reddfq_t_seq;
 
   // perform test
   if(expect_fatal_error)
@@ -292,7 +289,7 @@ TEST_P(InitTestWithParam, reddfqTest001VerifyInitFunction)
     // call the init function and expect a fatal error
     EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &reddfqTest::invalidArgumentException));
     EXPECT_THROW(reddfq_Init(redundancy_channels, queue_size, t_sequence), std::invalid_argument);
-    EXPECT_FALSE(reddfq_initialized);
+    EXPECT_FALSE(reddfq_instance->initialized);
   }
   else
   {
@@ -300,10 +297,10 @@ TEST_P(InitTestWithParam, reddfqTest001VerifyInitFunction)
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0U);
     EXPECT_NO_THROW(reddfq_Init(redundancy_channels, queue_size, t_sequence));
 
-    EXPECT_EQ(reddfq_number_of_red_channels, redundancy_channels);
-    EXPECT_EQ(reddfq_defer_queue_size, queue_size);
-    EXPECT_EQ(reddfq_t_seq, t_sequence);
-    EXPECT_TRUE(reddfq_initialized);
+    EXPECT_EQ(reddfq_instance->number_of_red_channels, redundancy_channels);
+    EXPECT_EQ(reddfq_instance->defer_queue_size, queue_size);
+    EXPECT_EQ(reddfq_instance->t_seq, t_sequence);
+    EXPECT_TRUE(reddfq_instance->initialized);
   }
 }
 
@@ -366,6 +363,8 @@ TEST_F(reddfqTest, reddfqTest002VerifyInitFunctionCalls)
  * - init module
  * - call the reddfq_AddMessage function with invalid payload pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the reddfq_GetMessage function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the reddfq_GetExpiredChannel function with invalid channel pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the reddfq_GetTimeToNextDeadline function with invalid time pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * .
  *
  * @safetyRel   No
@@ -385,7 +384,7 @@ TEST_F(reddfqTest, reddfqTest003VerifyNullPointerCheck)
   // test variables
   redtyp_RedundancyMessage message    = {};
   uint32_t sequence_number            = 0U;
-  uint8_t nbr_of_function_calls       = 2U;                    // number of function calls
+  uint8_t nbr_of_function_calls       = 4U;                    // number of function calls
 
   // init module
   reddfq_Init(red_channels, queue_size, t_seq);
@@ -398,6 +397,8 @@ TEST_F(reddfqTest, reddfqTest003VerifyNullPointerCheck)
   // perform test
   EXPECT_THROW(reddfq_AddMessage(channel_id, (redtyp_RedundancyMessage *)NULL), std::invalid_argument);
   EXPECT_THROW(reddfq_GetMessage(channel_id, sequence_number, (redtyp_RedundancyMessage *)NULL), std::invalid_argument);
+  EXPECT_THROW(reddfq_GetExpiredChannel((uint32_t *)NULL), std::invalid_argument);
+  EXPECT_THROW(reddfq_GetTimeToNextDeadline((uint32_t *)NULL), std::invalid_argument);
 }
 
 /**
@@ -414,6 +415,8 @@ TEST_F(reddfqTest, reddfqTest003VerifyNullPointerCheck)
  * - call the reddfq_GetOldestSequenceNumber function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the reddfq_GetUsedEntries function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the reddfq_IsTimeout function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - call the reddfq_GetExpiredChannel function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - call the reddfq_GetTimeToNextDeadline function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * .
  *
  * @safetyRel   No
@@ -425,13 +428,14 @@ TEST_F(reddfqTest, reddfqTest003VerifyNullPointerCheck)
  */
 TEST_F(reddfqTest, reddfqTest004VerifyInitializationCheck)
 {
-  uint8_t nbr_of_function_calls       = 7U;        // number of function calls
-  reddfq_initialized                  = false;
+  uint8_t nbr_of_function_calls       = 9U;        // number of function calls
+  reddfq_instance->initialized                  = false;
 
   // test variables
   uint32_t channel_id                 = UT_REDDFQ_CHANNEL_ID_MIN;
   uint32_t sequence_number            = 0U;
   redtyp_RedundancyMessage message    = {};
+  uint32_t time_to_next_deadline      = 0U;
 
   // expect fatal error function
   EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kNotInitialized))
@@ -446,6 +450,8 @@ TEST_F(reddfqTest, reddfqTest004VerifyInitializationCheck)
   EXPECT_THROW(reddfq_GetOldestSequenceNumber(channel_id), std::invalid_argument);
   EXPECT_THROW(reddfq_GetUsedEntries(channel_id), std::invalid_argument);
   EXPECT_THROW(reddfq_IsTimeout(channel_id), std::invalid_argument);
+  EXPECT_THROW(reddfq_GetExpiredChannel(&channel_id), std::invalid_argument);
+  EXPECT_THROW(reddfq_GetTimeToNextDeadline(&time_to_next_deadline), std::invalid_argument);
 }
 
 /**
@@ -565,8 +571,8 @@ INSTANTIATE_TEST_SUITE_P(
  * | 1        | 0          | 36U          | test_red_message_data_u8  | 4U                    | 1               | False              | Normal operation   |
  * | 2        | 0          | 1113U        | test_red_message_data_u8  | 4U                    | 4               | False              | Normal operation   |
  * | 3        | 0          | 1113U        | test_red_message_data_u8  | 4U                    | 5               | False              | Normal operation   |
- * | 4        | 1          | 1113U        | test_red_message_data_u8  | 10U                   | 10              | False              | Normal operation   |
- * | 5        | 1          | 1113U        | test_red_message_data_u8  | 10U                   | 11              | False              | Normal operation   |
+ * | 4        | 1          | 1113U        | test_red_message_data_u8  | 64U                   | 64              | False              | Normal operation   |
+ * | 5        | 1          | 1113U        | test_red_message_data_u8  | 64U                   | 65              | False              | Normal operation   |
  * | 6        | 1          | 1114U        | test_red_message_data_u8  | 4U                    | 4               | True               | Fatal error raised |
  * | 7        | 2          | 1113U        | test_red_message_data_u8  | 4U                    | 4               | True               | Fatal error raised |
  *
@@ -579,7 +585,6 @@ INSTANTIATE_TEST_SUITE_P(
  */
 TEST_P(AddMessageTestWithParam, reddfqTest006VerifyAddMessageFunction)
 {
-  extern uint32_t reddfq_defer_queue_size;
 
   uint16_t i                    = 0U;               // loop iterator
   uint32_t message_seq_nbr      = 1U;               // message sequence number to set and check in queue
@@ -601,8 +606,8 @@ TEST_P(AddMessageTestWithParam, reddfqTest006VerifyAddMessageFunction)
   reddfq_Init(UT_REDDFQ_CHANNEL_NUM_MAX, configured_queue_size, UT_REDDFQ_T_SEQ_MIN);
 
   // verify initialization
-  EXPECT_TRUE(reddfq_initialized);
-  EXPECT_EQ(configured_queue_size, reddfq_defer_queue_size);
+  EXPECT_TRUE(reddfq_instance->initialized);
+  EXPECT_EQ(configured_queue_size, reddfq_instance->defer_queue_size);
 
   // perform test
   if(expect_fatal_error)
@@ -614,6 +619,7 @@ TEST_P(AddMessageTestWithParam, reddfqTest006VerifyAddMessageFunction)
   else
   {
     EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).Times(expected_used_entries);
+    EXPECT_CALL(redmsg_mock, redmsg_GetMessageSequenceNumber(_)).Times(expected_used_entries).WillRepeatedly(Invoke(this, &reddfqTest::GetMessageSequenceNumber));
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
 
     for(i = 0U; i < messages_to_add; i++)
@@ -639,8 +645,8 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(UT_REDDFQ_CHANNEL_ID_MIN, UT_REDDFQ_MSG_LEN_MIN, test_red_message_data_u8, UT_REDDFQ_QUEUE_SIZE_MIN, 1U, false),
     std::make_tuple(UT_REDDFQ_CHANNEL_ID_MIN, UT_REDDFQ_MSG_LEN_MAX, test_red_message_data_u8, UT_REDDFQ_QUEUE_SIZE_MIN, 4U, false),
     std::make_tuple(UT_REDDFQ_CHANNEL_ID_MIN, UT_REDDFQ_MSG_LEN_MAX, test_red_message_data_u8, UT_REDDFQ_QUEUE_SIZE_MIN, 5U, false),
-    std::make_tuple(UT_REDDFQ_CHANNEL_ID_MAX, UT_REDDFQ_MSG_LEN_MAX, test_red_message_data_u8, UT_REDDFQ_QUEUE_SIZE_MAX, 10U, false),
-    std::make_tuple(UT_REDDFQ_CHANNEL_ID_MAX, UT_REDDFQ_MSG_LEN_MAX, test_red_message_data_u8, UT_REDDFQ_QUEUE_SIZE_MAX, 11U, false),
+    std::make_tuple(UT_REDDFQ_CHANNEL_ID_MAX, UT_REDDFQ_MSG_LEN_MAX, test_red_message_data_u8, UT_REDDFQ_QUEUE_SIZE_MAX, UT_REDDFQ_QUEUE_SIZE_MAX, false),
+    std::make_tuple(UT_REDDFQ_CHANNEL_ID_MAX, UT_REDDFQ_MSG_LEN_MAX, test_red_message_data_u8, UT_REDDFQ_QUEUE_SIZE_MAX, (UT_REDDFQ_QUEUE_SIZE_MAX + 1U), false),
     std::make_tuple(UT_REDDFQ_CHANNEL_ID_MAX, (UT_REDDFQ_MSG_LEN_MAX + 1U), test_red_message_data_u8, UT_REDDFQ_QUEUE_SIZE_MIN, 4U, true),
     std::make_tuple((UT_REDDFQ_CHANNEL_ID_MAX + 1), UT_REDDFQ_MSG_LEN_MAX, test_red_message_data_u8, UT_REDDFQ_QUEUE_SIZE_MIN, 4U, true)
   )
@@ -685,7 +691,6 @@ INSTANTIATE_TEST_SUITE_P(
  */
 TEST_P(GetMessageTestWithParam, reddfqTest007VerifyGetMessageFunction)
 {
-  extern uint32_t reddfq_defer_queue_size;
 
   uint16_t i                                    = 0U;                            // loop iterator
   uint8_t * data_ptr                            = test_red_message_data_u8;      // test message data
@@ -705,7 +710,7 @@ TEST_P(GetMessageTestWithParam, reddfqTest007VerifyGetMessageFunction)
   reddfq_Init(UT_REDDFQ_CHANNEL_NUM_MAX, UT_REDDFQ_QUEUE_SIZE_MIN, UT_REDDFQ_T_SEQ_MIN);
 
   // verify initialization
-  EXPECT_TRUE(reddfq_initialized);
+  EXPECT_TRUE(reddfq_instance->initialized);
 
   if(expected_return_code != radef_kInvalidParameter)
   {
@@ -800,7 +805,6 @@ INSTANTIATE_TEST_SUITE_P(
  */
 TEST_P(IsTimeoutTestWithParam, reddfqTest008VerifyIsTimeoutFunction)
 {
-  extern uint32_t reddfq_t_seq;
   uint16_t i                             = 0U;                            // loop iterator
   uint32_t start_timer_value             = 0U;                            // starting value of timer when adding message
   redtyp_RedundancyMessage message       = {UT_REDDFQ_MSG_LEN_MAX, {}};   // test message to add to queue
@@ -813,7 +817,7 @@ TEST_P(IsTimeoutTestWithParam, reddfqTest008VerifyIsTimeoutFunction)
   reddfq_Init(UT_REDDFQ_CHANNEL_NUM_MIN, UT_REDDFQ_QUEUE_SIZE_MAX, configured_timeout);
 
   // Verify timeout set correctly
-  EXPECT_EQ(reddfq_t_seq, configured_timeout);
+  EXPECT_EQ(reddfq_instance->t_seq, configured_timeout);
 
   // copy test message
   for (i = 0U; i < message.message_size; i++)
@@ -826,6 +830,7 @@ TEST_P(IsTimeoutTestWithParam, reddfqTest008VerifyIsTimeoutFunction)
     EXPECT_CALL(rasys_mock, rasys_GetTimerValue())
       .WillOnce(Return(start_timer_value))
       .WillOnce(Return(timer_value_to_return));
+    EXPECT_CALL(redmsg_mock, redmsg_GetMessageSequenceNumber(_)).WillOnce(Invoke(this, &reddfqTest::GetMessageSequenceNumber));
 
     // add message
     reddfq_AddMessage(channel_id, &message);
@@ -902,11 +907,8 @@ TEST_P(ContainsTestWithParam, reddfqTest009VerifyContainsFunction)
     // expect timer to be called at adding message
     EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).Times(1U);
 
-    if(add_message_channel_id == get_message_channel_id)
-    {
-      // expect get sequence nbr call in contains function (only if queue contains message)
-      EXPECT_CALL(redmsg_mock, redmsg_GetMessageSequenceNumber(_)).Times(1).WillOnce(Invoke(this, &reddfqTest::GetMessageSequenceNumber));
-    }
+    // expect get sequence nbr call at adding message
+    EXPECT_CALL(redmsg_mock, redmsg_GetMessageSequenceNumber(_)).Times(1).WillOnce(Invoke(this, &reddfqTest::GetMessageSequenceNumber));
 
     // set message sequence nbr and verify
     setDataInBuffer_u32(&message_to_add.message, seq_nbr_to_add, expected_sequence_nbr_pos);
@@ -1089,7 +1091,7 @@ INSTANTIATE_TEST_SUITE_P(
  * |          | Channel id to get used entries | Channel id of msg to add | Messages to add | Expect used entries | Expect fatal error | Test Result        |
  * | 0        | 0U                             | 0U                       | 0               | 0                   | False              | Normal operation   |
  * | 1        | 1U                             | 1U                       | 10              | 10                  | False              | Normal operation   |
- * | 2        | 1U                             | 1U                       | 11              | 10                  | False              | Normal operation   |
+ * | 2        | 1U                             | 1U                       | 65              | 64                  | False              | Normal operation   |
  * | 3        | 2U                             | 1U                       | 0               | 0                   | True               | Fatal error raised |
  * | 4        | 1U                             | 0U                       | 10              | 0                   | False              | Normal operation   |
  *
@@ -1118,8 +1120,9 @@ TEST_P(GetUsedEntriesTestWithParam, reddfqTest011VerifyGetUsedEntriesFunction)
     expected_gettimer_calls = UT_REDDFQ_QUEUE_SIZE_MAX;
   }
 
-  // expect timer to be called on every successful add message call
+  // expect timer and get sequence nbr to be called on every successful add message call
   EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).Times(expected_gettimer_calls);
+  EXPECT_CALL(redmsg_mock, redmsg_GetMessageSequenceNumber(_)).Times(expected_gettimer_calls).WillRepeatedly(Invoke(this, &reddfqTest::GetMessageSequenceNumber));
 
   for(i = 0U; i < messages_to_add; i++)
   {
@@ -1151,12 +1154,245 @@ INSTANTIATE_TEST_SUITE_P(
   ::testing::Values(
     std::make_tuple(UT_REDDFQ_CHANNEL_ID_MIN, UT_REDDFQ_CHANNEL_ID_MIN, 0U, 0U, false),
     std::make_tuple(UT_REDDFQ_CHANNEL_ID_MAX, UT_REDDFQ_CHANNEL_ID_MAX, 10U, 10U, false),
-    std::make_tuple(UT_REDDFQ_CHANNEL_ID_MAX, UT_REDDFQ_CHANNEL_ID_MAX, 11U, 10U, false),
+    std::make_tuple(UT_REDDFQ_CHANNEL_ID_MAX, UT_REDDFQ_CHANNEL_ID_MAX, (UT_REDDFQ_QUEUE_SIZE_MAX + 1U), UT_REDDFQ_QUEUE_SIZE_MAX, false),
     std::make_tuple(UT_REDDFQ_CHANNEL_ID_MAX, (UT_REDDFQ_CHANNEL_ID_MAX + 1U), 0U, 0U, true),
     std::make_tuple(UT_REDDFQ_CHANNEL_ID_MIN, UT_REDDFQ_CHANNEL_ID_MAX, 10U, 0U, false)
   )
 );
 
+/**
+ * @test        @ID{reddfqTest012} Verify the draining of a defer queue with reordered messages.
+ *
+ * @details     This test verifies that the oldest sequence number and the defer queue timeout are kept up to date, when out of order received messages are
+ *              added to and removed from a full defer queue.
+ *
+ * Test steps:
+ * - Initialize module with max queue size and min timeout
+ * - Add messages with descending sequence numbers and ascending received timestamps until the queue is full
+ * - Verify that the oldest sequence number is the one of the message received last
+ * - Verify the defer queue timeout of the message received first
+ * - Read the message received first and verify that the defer queue timeout follows the message received second
+ * - Read the other messages in ascending sequence number order and verify the oldest sequence number and the used entries after every read
+ * - Verify that there is no defer queue timeout on the empty queue
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(reddfqTest, reddfqTest012VerifyDrainReorderedMessages)
+{
+  // Test variables
+  const uint32_t first_seq_nbr                = 0xfffffff0U;     // sequence number of the oldest message (with wrap around)
+  const uint32_t channel_id                   = UT_REDDFQ_CHANNEL_ID_MIN;
+  redtyp_RedundancyMessage message_to_add     = {UT_REDDFQ_MSG_LEN_MAX,{}};
+  redtyp_RedundancyMessage message_to_read    = {};
+
+  // Init Module
+  reddfq_Init(UT_REDDFQ_CHANNEL_NUM_MIN, UT_REDDFQ_QUEUE_SIZE_MAX, UT_REDDFQ_T_SEQ_MIN);
+
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0U);
+  EXPECT_CALL(redmsg_mock, redmsg_GetMessageSequenceNumber(_)).Times(UT_REDDFQ_QUEUE_SIZE_MAX).WillRepeatedly(Invoke(this, &reddfqTest::GetMessageSequenceNumber));
+
+  // add messages with descending sequence numbers, the message received at timestamp i has the sequence number first_seq_nbr + UT_REDDFQ_QUEUE_SIZE_MAX - 1 - i
+  for(uint32_t i = 0U; i < UT_REDDFQ_QUEUE_SIZE_MAX; i++)
+  {
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillOnce(Return(i)).RetiresOnSaturation();
+    setDataInBuffer_u32(&message_to_add.message, (first_seq_nbr + UT_REDDFQ_QUEUE_SIZE_MAX - 1U - i), expected_sequence_nbr_pos);
+    EXPECT_NO_THROW(reddfq_AddMessage(channel_id, &message_to_add));
+  }
+  EXPECT_EQ(UT_REDDFQ_QUEUE_SIZE_MAX, reddfq_GetUsedEntries(channel_id));
+  EXPECT_EQ(first_seq_nbr, reddfq_GetOldestSequenceNumber(channel_id));
+
+  // the message received first (timestamp 0) defines the timeout
+  EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillOnce(Return(UT_REDDFQ_T_SEQ_MIN)).WillOnce(Return(UT_REDDFQ_T_SEQ_MIN + 1U)).RetiresOnSaturation();
+  EXPECT_FALSE(reddfq_IsTimeout(channel_id));
+  EXPECT_TRUE(reddfq_IsTimeout(channel_id));
+
+  // read the message received first, the message received second (timestamp 1) defines the timeout now
+  EXPECT_NO_THROW(reddfq_GetMessage(channel_id, (first_seq_nbr + UT_REDDFQ_QUEUE_SIZE_MAX - 1U), &message_to_read));
+  EXPECT_EQ(first_seq_nbr, reddfq_GetOldestSequenceNumber(channel_id));
+  EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillOnce(Return(UT_REDDFQ_T_SEQ_MIN + 1U)).WillOnce(Return(UT_REDDFQ_T_SEQ_MIN + 2U)).RetiresOnSaturation();
+  EXPECT_FALSE(reddfq_IsTimeout(channel_id));
+  EXPECT_TRUE(reddfq_IsTimeout(channel_id));
+
+  // drain the defer queue in ascending sequence number order
+  for(uint32_t i = 0U; i < (UT_REDDFQ_QUEUE_SIZE_MAX - 1U); i++)
+  {
+    EXPECT_EQ(first_seq_nbr + i, reddfq_GetOldestSequenceNumber(channel_id));
+    EXPECT_TRUE(reddfq_Contains(channel_id, first_seq_nbr + i));
+    EXPECT_NO_THROW(reddfq_GetMessage(channel_id, (first_seq_nbr + i), &message_to_read));
+    EXPECT_EQ(first_seq_nbr + i, getDataFromBuffer_u32(&message_to_read.message, expected_sequence_nbr_pos));
+    EXPECT_FALSE(reddfq_Contains(channel_id, first_seq_nbr + i));
+    EXPECT_EQ(UT_REDDFQ_QUEUE_SIZE_MAX - 2U - i, reddfq_GetUsedEntries(channel_id));
+  }
+
+  // no timeout on an empty defer queue
+  EXPECT_FALSE(reddfq_IsTimeout(channel_id));
+}
+
+/**
+ * @test        @ID{reddfqTest013} Verify the defer timers.
+ *
+ * @details     This test verifies that the defer timer of a redundancy channel follows the message received first and that the GetExpiredChannel and
+ *              GetTimeToNextDeadline functions report the defer timers.
+ *
+ * Test steps:
+ * - Initialize module with two channels and min timeout
+ * - Verify that no defer timer is running on the empty defer queues
+ * - Add a message to channel 0 at timestamp 0 and a message to channel 1 at timestamp 5
+ * - Verify that the time to the next deadline is Tseq + 1
+ * - Verify that no defer timer is expired at timestamp Tseq and that channel 0 is expired once at timestamp Tseq + 1
+ * - Read the message of channel 0 and verify that the time to the next deadline follows the message of channel 1
+ * - Verify that channel 1 is expired at timestamp 5 + Tseq + 1
+ * - Add a message to channel 1 and init its defer queue, verify that no defer timer is running afterwards
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(reddfqTest, reddfqTest013VerifyDeferTimers)
+{
+  // Test variables
+  const uint32_t second_timestamp             = 5U;              // received timestamp of the message of channel 1
+  redtyp_RedundancyMessage message_to_add     = {UT_REDDFQ_MSG_LEN_MIN,{}};
+  redtyp_RedundancyMessage message_to_read    = {};
+  uint32_t red_channel_id                     = UT_REDDFQ_CHANNEL_ID_MAX + 1U;
+  uint32_t time_to_next_deadline              = 0U;
+
+  // Init Module
+  reddfq_Init(UT_REDDFQ_CHANNEL_NUM_MAX, UT_REDDFQ_QUEUE_SIZE_MIN, UT_REDDFQ_T_SEQ_MIN);
+
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0U);
+  EXPECT_CALL(redmsg_mock, redmsg_GetMessageSequenceNumber(_)).WillRepeatedly(Invoke(this, &reddfqTest::GetMessageSequenceNumber));
+  EXPECT_CALL(rasys_mock, rasys_GetTimerValue())
+    .WillOnce(Return(0U))                                               // no timer running
+    .WillOnce(Return(0U))                                               // add message to channel 0
+    .WillOnce(Return(second_timestamp))                                 // add message to channel 1
+    .WillOnce(Return(second_timestamp))                                 // time to next deadline
+    .WillOnce(Return(UT_REDDFQ_T_SEQ_MIN))                              // no timer expired
+    .WillOnce(Return(UT_REDDFQ_T_SEQ_MIN + 1U))                         // channel 0 expired
+    .WillOnce(Return(UT_REDDFQ_T_SEQ_MIN + 1U))                         // expiry returned only once
+    .WillOnce(Return(UT_REDDFQ_T_SEQ_MIN + 1U))                         // time to next deadline of channel 1
+    .WillOnce(Return(second_timestamp + UT_REDDFQ_T_SEQ_MIN + 1U))      // channel 1 expired
+    .WillOnce(Return(second_timestamp + UT_REDDFQ_T_SEQ_MIN + 1U))      // add message to channel 1
+    .WillOnce(Return(second_timestamp + UT_REDDFQ_T_SEQ_MIN + 1U));     // no timer running
+
+  // no defer timer running on empty defer queues
+  EXPECT_FALSE(reddfq_GetTimeToNextDeadline(&time_to_next_deadline));
+
+  // add one message to each channel
+  setDataInBuffer_u32(&message_to_add.message, 100U, expected_sequence_nbr_pos);
+  reddfq_AddMessage(UT_REDDFQ_CHANNEL_ID_MIN, &message_to_add);
+  setDataInBuffer_u32(&message_to_add.message, 200U, expected_sequence_nbr_pos);
+  reddfq_AddMessage(UT_REDDFQ_CHANNEL_ID_MAX, &message_to_add);
+
+  EXPECT_TRUE(reddfq_GetTimeToNextDeadline(&time_to_next_deadline));
+  EXPECT_EQ(UT_REDDFQ_T_SEQ_MIN + 1U - second_timestamp, time_to_next_deadline);
+
+  // the defer timer of channel 0 expires, when the defer queue timeout is reached
+  EXPECT_FALSE(reddfq_GetExpiredChannel(&red_channel_id));
+  EXPECT_TRUE(reddfq_GetExpiredChannel(&red_channel_id));
+  EXPECT_EQ(UT_REDDFQ_CHANNEL_ID_MIN, red_channel_id);
+  EXPECT_FALSE(reddfq_GetExpiredChannel(&red_channel_id));
+
+  // reading the message of channel 0 stops its defer timer
+  reddfq_GetMessage(UT_REDDFQ_CHANNEL_ID_MIN, 100U, &message_to_read);
+  EXPECT_TRUE(reddfq_GetTimeToNextDeadline(&time_to_next_deadline));
+  EXPECT_EQ(second_timestamp, time_to_next_deadline);
+
+  EXPECT_TRUE(reddfq_GetExpiredChannel(&red_channel_id));
+  EXPECT_EQ(UT_REDDFQ_CHANNEL_ID_MAX, red_channel_id);
+
+  // init of the defer queue stops its defer timer
+  setDataInBuffer_u32(&message_to_add.message, 201U, expected_sequence_nbr_pos);
+  reddfq_AddMessage(UT_REDDFQ_CHANNEL_ID_MAX, &message_to_add);
+  reddfq_InitDeferQueue(UT_REDDFQ_CHANNEL_ID_MAX);
+  EXPECT_FALSE(reddfq_GetTimeToNextDeadline(&time_to_next_deadline));
+}
+
+/**
+ * @test        @ID{reddfqTest014} Verify the defer queue timeout of several timed out messages.
+ *
+ * @details     This test verifies the sequence of defer queue calls of the CheckTimings function of the redundancy layer interface, when two messages with a
+ *              gap in between are timed out at the expiry of the defer timer. The messages are delivered oldest sequence number first and the defer queue
+ *              timeout is reported until both are delivered, while the defer timer expires only once.
+ *
+ * Test steps:
+ * - Initialize module with min timeout
+ * - Add the message with sequence number 102 at timestamp 0 and the message with sequence number 100 at timestamp 1
+ * - Verify that the defer timer of the channel expires once at timestamp Tseq + 2 and that the defer queue timeout is reported
+ * - Read the message with the oldest sequence number 100 and verify that the defer timer does not expire again, but that the defer queue timeout is still
+ *   reported for the message received first
+ * - Read the message with the oldest sequence number 102 and verify that no defer queue timeout is reported and no defer timer is running
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(reddfqTest, reddfqTest014VerifySeveralTimedOutMessages)
+{
+  // Test variables
+  const uint32_t first_received_seq_nbr       = 102U;            // sequence number of the message received first
+  const uint32_t second_received_seq_nbr      = 100U;            // sequence number of the message received second
+  const uint32_t timeout_timestamp            = UT_REDDFQ_T_SEQ_MIN + 2U;  // timestamp at which both messages are timed out
+  const uint32_t channel_id                   = UT_REDDFQ_CHANNEL_ID_MIN;
+  redtyp_RedundancyMessage message_to_add     = {UT_REDDFQ_MSG_LEN_MIN,{}};
+  redtyp_RedundancyMessage message_to_read    = {};
+  uint32_t red_channel_id                     = UT_REDDFQ_CHANNEL_ID_MAX + 1U;
+  uint32_t time_to_next_deadline              = 0U;
+
+  // Init Module
+  reddfq_Init(UT_REDDFQ_CHANNEL_NUM_MIN, UT_REDDFQ_QUEUE_SIZE_MIN, UT_REDDFQ_T_SEQ_MIN);
+
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0U);
+  EXPECT_CALL(redmsg_mock, redmsg_GetMessageSequenceNumber(_)).WillRepeatedly(Invoke(this, &reddfqTest::GetMessageSequenceNumber));
+  EXPECT_CALL(rasys_mock, rasys_GetTimerValue())
+    .WillOnce(Return(0U))                                               // add message received first
+    .WillOnce(Return(1U))                                               // add message received second
+    .WillRepeatedly(Return(timeout_timestamp));                         // both messages timed out
+
+  // add two messages with a gap in between, the message with the higher sequence number is received first
+  setDataInBuffer_u32(&message_to_add.message, first_received_seq_nbr, expected_sequence_nbr_pos);
+  reddfq_AddMessage(channel_id, &message_to_add);
+  setDataInBuffer_u32(&message_to_add.message, second_received_seq_nbr, expected_sequence_nbr_pos);
+  reddfq_AddMessage(channel_id, &message_to_add);
+
+  // the defer timer expires once for both messages
+  EXPECT_TRUE(reddfq_GetExpiredChannel(&red_channel_id));
+  EXPECT_EQ(channel_id, red_channel_id);
+  EXPECT_TRUE(reddfq_IsTimeout(channel_id));
+
+  // the first defer queue timeout delivers the message with the oldest sequence number
+  EXPECT_EQ(second_received_seq_nbr, reddfq_GetOldestSequenceNumber(channel_id));
+  reddfq_GetMessage(channel_id, second_received_seq_nbr, &message_to_read);
+  EXPECT_EQ(second_received_seq_nbr, getDataFromBuffer_u32(&message_to_read.message, expected_sequence_nbr_pos));
+
+  // the message received first is still timed out, but its defer timer does not expire again
+  EXPECT_FALSE(reddfq_GetExpiredChannel(&red_channel_id));
+  EXPECT_TRUE(reddfq_IsTimeout(channel_id));
+
+  // the second defer queue timeout delivers the message received first
+  EXPECT_EQ(first_received_seq_nbr, reddfq_GetOldestSequenceNumber(channel_id));
+  reddfq_GetMessage(channel_id, first_received_seq_nbr, &message_to_read);
+  EXPECT_EQ(first_received_seq_nbr, getDataFromBuffer_u32(&message_to_read.message, expected_sequence_nbr_pos));
+
+  // no more timeout on the empty defer queue
+  EXPECT_FALSE(reddfq_IsTimeout(channel_id));
+  EXPECT_FALSE(reddfq_GetTimeToNextDeadline(&time_to_next_deadline));
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
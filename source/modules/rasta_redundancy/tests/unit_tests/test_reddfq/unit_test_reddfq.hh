@@ -51,7 +51,7 @@ using testing::Throw;
 #define UT_REDDFQ_CHANNEL_ID_MIN 0U                                        ///< minimum channel id
 #define UT_REDDFQ_CHANNEL_ID_MAX 1U                                        ///< maximum channel id
 #define UT_REDDFQ_QUEUE_SIZE_MIN 4U                                        ///< minimum size of the defer queue
-#define UT_REDDFQ_QUEUE_SIZE_MAX 10U                                       ///< maximum size of the defer queue
+#define UT_REDDFQ_QUEUE_SIZE_MAX 64U                                       ///< maximum size of the defer queue
 #define UT_REDDFQ_T_SEQ_MIN 50U                                           ///< minimum time period (in ms) how long a message is buffered
 #define UT_REDDFQ_T_SEQ_MAX 500U                                          ///< maximum time period (in ms) how long a message is buffered
 
@@ -64,7 +64,7 @@ using testing::Throw;
 // -----------------------------------------------------------------------------
 
 extern uint8_t test_red_message_data_u8[UT_REDDFQ_MSG_LEN_MAX];
-extern bool reddfq_initialized;                                         ///< initialization state (local variable)
+extern RADEF_THREAD_LOCAL reddfq_InstanceData *reddfq_instance;         ///< data of the selected defer queue module instance
 
 // -----------------------------------------------------------------------------
 // Global Const Declarations
@@ -87,7 +87,7 @@ class reddfqTest : public ::testing::Test
 public:
   reddfqTest()
   {
-    reddfq_initialized = false;
+    reddfq_instance->initialized = false;
   }
 
   ~reddfqTest()
@@ -243,25 +243,25 @@ TEST_P(InitTestWithParam, reddiaTest001VerifyInitFunction)
     // call the init function and verify initialized set to true
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
     EXPECT_NO_THROW(reddia_InitRedundancyLayerDiagnostics(&default_config));
-    EXPECT_TRUE(reddia_initialized);
+    EXPECT_TRUE(reddia_instance->initialized);
 
     // verify configuration set correct
-    EXPECT_EQ(reddia_redundancy_configuration->check_code_type, default_config.check_code_type);
-    EXPECT_EQ(reddia_redundancy_configuration->n_defer_queue_size, default_config.n_defer_queue_size);
-    EXPECT_EQ(reddia_redundancy_configuration->n_diagnosis, default_config.n_diagnosis);
-    EXPECT_EQ(reddia_redundancy_configuration->number_of_redundancy_channels, default_config.number_of_redundancy_channels);
-    EXPECT_EQ(reddia_redundancy_configuration->t_seq, default_config.t_seq);
+    EXPECT_EQ(reddia_instance->redundancy_configuration->check_code_type, default_config.check_code_type);
+    EXPECT_EQ(reddia_instance->redundancy_configuration->n_defer_queue_size, default_config.n_defer_queue_size);
+    EXPECT_EQ(reddia_instance->redundancy_configuration->n_diagnosis, default_config.n_diagnosis);
+    EXPECT_EQ(reddia_instance->redundancy_configuration->number_of_redundancy_channels, default_config.number_of_redundancy_channels);
+    EXPECT_EQ(reddia_instance->redundancy_configuration->t_seq, default_config.t_seq);
 
     // verify each redundancy channel config
     for(uint16_t i = 0; i < default_config.number_of_redundancy_channels; i++)
     {
-      EXPECT_EQ(reddia_redundancy_configuration->redundancy_channel_configurations[i].num_transport_channels, default_config.redundancy_channel_configurations[i].num_transport_channels);
-      EXPECT_EQ(reddia_redundancy_configuration->redundancy_channel_configurations[i].red_channel_id, default_config.redundancy_channel_configurations[i].red_channel_id);
+      EXPECT_EQ(reddia_instance->redundancy_configuration->redundancy_channel_configurations[i].num_transport_channels, default_config.redundancy_channel_configurations[i].num_transport_channels);
+      EXPECT_EQ(reddia_instance->redundancy_configuration->redundancy_channel_configurations[i].red_channel_id, default_config.redundancy_channel_configurations[i].red_channel_id);
 
       // verify transport channels
       for(uint16_t t = 0; t < default_config.redundancy_channel_configurations[i].num_transport_channels; t++)
       {
-        EXPECT_EQ(reddia_redundancy_configuration->redundancy_channel_configurations[i].transport_channel_ids[t], default_config.redundancy_channel_configurations[i].transport_channel_ids[t]);
+        EXPECT_EQ(reddia_instance->redundancy_configuration->redundancy_channel_configurations[i].transport_channel_ids[t], default_config.redundancy_channel_configurations[i].transport_channel_ids[t]);
       }
     }
   }
@@ -353,6 +353,7 @@ TEST_F(reddiaTest, reddiaTest003VerifyInitializationCheck)
  * - call the reddia_InitRedundancyLayerDiagnostics function with invalid configuration pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - init the module with default config
  * - call the reddia_IsConfigurationValid function with invalid configuration pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the reddia_GetAssociatedRedundancyChannel function with invalid redundancy channel pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * .
  *
  * @safetyRel   No
@@ -364,7 +365,7 @@ TEST_F(reddiaTest, reddiaTest003VerifyInitializationCheck)
  */
 TEST_F(reddiaTest, reddiaTest004VerifyNullPointerCheck)
 {
-  const uint8_t nbr_of_function_calls = 2U;        // number of function calls
+  const uint8_t nbr_of_function_calls = 3U;        // number of function calls
 
   EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(nbr_of_function_calls).WillRepeatedly(Invoke(this, &reddiaTest::invalidArgumentException));
 
@@ -375,6 +376,7 @@ TEST_F(reddiaTest, reddiaTest004VerifyNullPointerCheck)
   reddia_InitRedundancyLayerDiagnostics(&default_config);
 
   EXPECT_THROW(reddia_IsConfigurationValid((redcty_RedundancyLayerConfiguration *)NULL), std::invalid_argument);
+  EXPECT_THROW(reddia_GetAssociatedRedundancyChannel(0U, (uint32_t *)NULL), std::invalid_argument);
 }
 
 /**
@@ -439,19 +441,20 @@ TEST_P(InitRedundancyChannelDiagnosticsTestWithParam, reddiaTest005verifyInitRed
   {
     // set values to properties which are getting reset by function call
     for (uint32_t i = 0U; i < config.n_diagnosis; i++) {
-      reddia_received_messages_timestamps[redundancy_channel_id][i].sequence_number = 1U;
-      reddia_received_messages_timestamps[redundancy_channel_id][i].received_time_stamp = 1U;
+      reddia_instance->received_messages_timestamps[redundancy_channel_id][i].sequence_number = 1U;
+      reddia_instance->received_messages_timestamps[redundancy_channel_id][i].received_time_stamp = 1U;
       for (uint32_t tr = 0U; tr < config.redundancy_channel_configurations[redundancy_channel_id].num_transport_channels; tr++) {
-        reddia_received_messages_timestamps[redundancy_channel_id][i].message_received_flag[tr] = true;
+        reddia_instance->received_messages_timestamps[redundancy_channel_id][i].message_received_flag[tr] = true;
       }
     }
 
     for(uint16_t i = 0U; i < config.redundancy_channel_configurations[redundancy_channel_id].num_transport_channels; i++)
     {
-      reddia_transport_channel_diagnostic_data[redundancy_channel_id][i].n_diagnosis = 1U;
-      reddia_transport_channel_diagnostic_data[redundancy_channel_id][i].n_missed = 1U;
-      reddia_transport_channel_diagnostic_data[redundancy_channel_id][i].t_drift = 1U;
-      reddia_transport_channel_diagnostic_data[redundancy_channel_id][i].t_drift2 = 1U;
+      reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][i].n_diagnosis = 1U;
+      reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][i].n_missed = 1U;
+      reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][i].t_drift = 1U;
+      reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][i].t_drift2 = 1U;
+      reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][i].n_dropped = 1U;
     }
 
     // call the function
@@ -460,21 +463,22 @@ TEST_P(InitRedundancyChannelDiagnosticsTestWithParam, reddiaTest005verifyInitRed
 
     // verify properties are reset
     for (uint32_t i = 0; i < config.n_diagnosis; i++) {
-      EXPECT_EQ(reddia_received_messages_timestamps[redundancy_channel_id][i].sequence_number, 0U);
-      EXPECT_EQ(reddia_received_messages_timestamps[redundancy_channel_id][i].received_time_stamp, 0U);
+      EXPECT_EQ(reddia_instance->received_messages_timestamps[redundancy_channel_id][i].sequence_number, 0U);
+      EXPECT_EQ(reddia_instance->received_messages_timestamps[redundancy_channel_id][i].received_time_stamp, 0U);
       for (uint32_t tr = 0; tr < config.redundancy_channel_configurations[redundancy_channel_id].num_transport_channels; tr++) {
-        EXPECT_FALSE(reddia_received_messages_timestamps[redundancy_channel_id][i].message_received_flag[tr]);
+        EXPECT_FALSE(reddia_instance->received_messages_timestamps[redundancy_channel_id][i].message_received_flag[tr]);
       }
     }
 
-    EXPECT_EQ(reddia_current_n_diagnosis[redundancy_channel_id], 0U);
+    EXPECT_EQ(reddia_instance->current_n_diagnosis[redundancy_channel_id], 0U);
 
     for(uint16_t i = 0; i < config.redundancy_channel_configurations[redundancy_channel_id].num_transport_channels; i++)
     {
-      EXPECT_EQ(reddia_transport_channel_diagnostic_data[redundancy_channel_id][i].n_diagnosis, 0U);
-      EXPECT_EQ(reddia_transport_channel_diagnostic_data[redundancy_channel_id][i].n_missed, 0U);
-      EXPECT_EQ(reddia_transport_channel_diagnostic_data[redundancy_channel_id][i].t_drift, 0U);
-      EXPECT_EQ(reddia_transport_channel_diagnostic_data[redundancy_channel_id][i].t_drift2, 0U);
+      EXPECT_EQ(reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][i].n_diagnosis, 0U);
+      EXPECT_EQ(reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][i].n_missed, 0U);
+      EXPECT_EQ(reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][i].t_drift, 0U);
+      EXPECT_EQ(reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][i].t_drift2, 0U);
+      EXPECT_EQ(reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][i].n_dropped, 0U);
     }
   }
 }
@@ -588,11 +592,11 @@ TEST_P(UpdateRedundancyChannelDiagnosticsTestWithParam, reddiaTest006verifyUpdat
     expected_message_diagnosis_index = 0;
 
     // if diagnosis window reached diagnostics data for this channel gets reset and notification is sent to every transport channel configured
-    EXPECT_CALL(rednot_mock, rednot_DiagnosticNotification(redundancy_channel_id, config.redundancy_channel_configurations[redundancy_channel_id].transport_channel_ids[0], _)).Times(1);
+    EXPECT_CALL(rednot_mock, rednot_DiagnosticNotification(&test_instance, redundancy_channel_id, config.redundancy_channel_configurations[redundancy_channel_id].transport_channel_ids[0], _)).Times(1);
 
     if(config.redundancy_channel_configurations[redundancy_channel_id].num_transport_channels > 1)
     {
-      EXPECT_CALL(rednot_mock, rednot_DiagnosticNotification(redundancy_channel_id, config.redundancy_channel_configurations[redundancy_channel_id].transport_channel_ids[1], _)).Times(1);
+      EXPECT_CALL(rednot_mock, rednot_DiagnosticNotification(&test_instance, redundancy_channel_id, config.redundancy_channel_configurations[redundancy_channel_id].transport_channel_ids[1], _)).Times(1);
     }
   }
 
@@ -608,17 +612,17 @@ TEST_P(UpdateRedundancyChannelDiagnosticsTestWithParam, reddiaTest006verifyUpdat
   }
   else
   {
-    reddia_initialized = true;
+    reddia_instance->initialized = true;
   }
 
   // set current messages in diagnosis window
-  reddia_current_n_diagnosis[redundancy_channel_id] = messages_in_diagnosis_window;
+  reddia_instance->current_n_diagnosis[redundancy_channel_id] = messages_in_diagnosis_window;
 
   if(message_already_received)
   {
     // set msg seq nbr and timestamp to message which was already received
-    reddia_received_messages_timestamps[redundancy_channel_id][0].sequence_number = message_sequence_number;
-    reddia_received_messages_timestamps[redundancy_channel_id][0].received_time_stamp = already_received_message_timestamp;
+    reddia_instance->received_messages_timestamps[redundancy_channel_id][0].sequence_number = message_sequence_number;
+    reddia_instance->received_messages_timestamps[redundancy_channel_id][0].received_time_stamp = already_received_message_timestamp;
 
     // if message already received, difference (tdrift) between the messages timestamps is calculated
     if(config.t_seq >= expected_t_drift && !diagnosis_window_reached)
@@ -636,10 +640,10 @@ TEST_P(UpdateRedundancyChannelDiagnosticsTestWithParam, reddiaTest006verifyUpdat
 
     if(diagnosis_window_overflow)
     {
-      EXPECT_EQ(reddia_transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].n_diagnosis, 0U);
-      EXPECT_EQ(reddia_transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].n_missed, 0U);
-      EXPECT_EQ(reddia_transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].t_drift, 0U);
-      EXPECT_EQ(reddia_transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].t_drift2, 0U);
+      EXPECT_EQ(reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].n_diagnosis, 0U);
+      EXPECT_EQ(reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].n_missed, 0U);
+      EXPECT_EQ(reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].t_drift, 0U);
+      EXPECT_EQ(reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].t_drift2, 0U);
     }
   }
   else
@@ -650,16 +654,16 @@ TEST_P(UpdateRedundancyChannelDiagnosticsTestWithParam, reddiaTest006verifyUpdat
 
     if(message_already_received && expect_tdrift_updated)
     {
-      EXPECT_EQ(reddia_transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].t_drift, expected_t_drift);
-      EXPECT_EQ(reddia_transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].t_drift2, (expected_t_drift * expected_t_drift));
-      EXPECT_TRUE(reddia_received_messages_timestamps[redundancy_channel_id][0].message_received_flag[transport_channel_index]);
+      EXPECT_EQ(reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].t_drift, expected_t_drift);
+      EXPECT_EQ(reddia_instance->transport_channel_diagnostic_data[redundancy_channel_id][transport_channel_index].t_drift2, (expected_t_drift * expected_t_drift));
+      EXPECT_TRUE(reddia_instance->received_messages_timestamps[redundancy_channel_id][0].message_received_flag[transport_channel_index]);
     }
 
     if(!message_already_received)
     {
-      EXPECT_EQ(reddia_received_messages_timestamps[redundancy_channel_id][expected_message_diagnosis_index].received_time_stamp, message_timestamp);
-      EXPECT_EQ(reddia_received_messages_timestamps[redundancy_channel_id][expected_message_diagnosis_index].sequence_number, message_sequence_number);
-      EXPECT_TRUE(reddia_received_messages_timestamps[redundancy_channel_id][expected_message_diagnosis_index].message_received_flag[transport_channel_index]);
+      EXPECT_EQ(reddia_instance->received_messages_timestamps[redundancy_channel_id][expected_message_diagnosis_index].received_time_stamp, message_timestamp);
+      EXPECT_EQ(reddia_instance->received_messages_timestamps[redundancy_channel_id][expected_message_diagnosis_index].sequence_number, message_sequence_number);
+      EXPECT_TRUE(reddia_instance->received_messages_timestamps[redundancy_channel_id][expected_message_diagnosis_index].message_received_flag[transport_channel_index]);
     }
   }
 }
@@ -704,7 +708,7 @@ INSTANTIATE_TEST_SUITE_P(
  * - Check code type: Type of check code
  * - T Seq: Time for out of sequence message buffering in ms (valid range: 50 - 500)
  * - N diagnosis: diagnosis window size (valid range: 10 - 1000)
- * - Defer queue size: Size of defer queue (valid range: 4 - 10)
+ * - Defer queue size: Size of defer queue (valid range: 4 - 64)
  * - Red channels: Number of configured redundancy channels (valid range: 1 -2)
  * - Red channel Start Id: Redundancy Channel identification start value (+1 on every channel)
  * - Tr channels: Number of configured transport channels per Redundancy channel (valid range: 1 - 2)
@@ -715,26 +719,26 @@ INSTANTIATE_TEST_SUITE_P(
  * |----------|----------------------|-------|-------------|------------------|--------------|----------------------|-------------|---------------------|---------------------|--------------------|
  * |          | Check code type      | T Seq | N diagnosis | Defer queue size | Red channels | Red channel Start Id | Tr channels | Tr channel Start Id | Expect config valid | Test Result        |
  * |        0 | redcty_kCheckCodeA   |   50U |         10U |               4U |           1U |                   0U |          1U |                  0U |                true | Normal Operation   |
- * |        1 | redcty_kCheckCodeE   |  500U |       1000U |              10U |           2U |                   0U |          1U |                  1U |                true | Normal Operation   |
- * |        2 | redcty_kCheckCodeE   |  500U |       1000U |              10U |           2U |                   0U |          1U |                  2U |                true | Normal Operation   |
- * |        3 | redcty_kCheckCodeE   |  500U |       1000U |              10U |           2U |                   0U |          1U |                  3U |               false | Fatal error raised |
- * |        4 | redcty_kCheckCodeE   |  500U |       1000U |              10U |           2U |                   0U |          2U |                  0U |                true | Normal Operation   |
- * |        5 | redcty_kCheckCodeE   |  500U |       1000U |              10U |           2U |                   0U |          2U |                  1U |               false | Fatal error raised |
- * |        6 | redcty_kCheckCodeE   |  500U |       1000U |              10U |           2U |                   0U |          2U |                  2U |               false | Fatal error raised |
- * |        7 | redcty_kCheckCodeE   |  500U |       1000U |              10U |           2U |                   0U |          2U |                  3U |               false | Fatal error raised |
+ * |        1 | redcty_kCheckCodeE   |  500U |       1000U |              64U |           2U |                   0U |          1U |                  1U |                true | Normal Operation   |
+ * |        2 | redcty_kCheckCodeE   |  500U |       1000U |              64U |           2U |                   0U |          1U |                  2U |                true | Normal Operation   |
+ * |        3 | redcty_kCheckCodeE   |  500U |       1000U |              64U |           2U |                   0U |          1U |                  3U |               false | Fatal error raised |
+ * |        4 | redcty_kCheckCodeE   |  500U |       1000U |              64U |           2U |                   0U |          2U |                  0U |                true | Normal Operation   |
+ * |        5 | redcty_kCheckCodeE   |  500U |       1000U |              64U |           2U |                   0U |          2U |                  1U |               false | Fatal error raised |
+ * |        6 | redcty_kCheckCodeE   |  500U |       1000U |              64U |           2U |                   0U |          2U |                  2U |               false | Fatal error raised |
+ * |        7 | redcty_kCheckCodeE   |  500U |       1000U |              64U |           2U |                   0U |          2U |                  3U |               false | Fatal error raised |
  * |        8 | redcty_kCheckCodeA   |   49U |         10U |               4U |           1U |                   0U |          1U |                  0U |               false | Fatal error raised |
  * |        9 | redcty_kCheckCodeA   |   50U |          9U |               4U |           1U |                   0U |          1U |                  0U |               false | Fatal error raised |
  * |       10 | redcty_kCheckCodeA   |   50U |         10U |               3U |           1U |                   0U |          1U |                  0U |               false | Fatal error raised |
  * |       11 | redcty_kCheckCodeA   |   50U |         10U |               4U |           0U |                   0U |          1U |                  0U |               false | Fatal error raised |
  * |       12 | redcty_kCheckCodeA   |   50U |         10U |               4U |           1U |                   0U |          0U |                  0U |               false | Fatal error raised |
- * |       13 | redcty_kCheckCodeMax |  500U |       1000U |              10U |           2U |                   0U |          2U |                  0U |               false | Fatal error raised |
- * |       14 | redcty_kCheckCodeE   |  501U |       1000U |              10U |           2U |                   0U |          2U |                  0U |               false | Fatal error raised |
- * |       15 | redcty_kCheckCodeE   |  500U |       1001U |              10U |           2U |                   0U |          2U |                  0U |               false | Fatal error raised |
- * |       16 | redcty_kCheckCodeE   |  500U |       1000U |              11U |           2U |                   0U |          2U |                  0U |               false | Fatal error raised |
- * |       17 | redcty_kCheckCodeE   |  500U |       1000U |              10U |           3U |                   0U |          2U |                  0U |               false | Fatal error raised |
- * |       18 | redcty_kCheckCodeE   |  500U |       1000U |              10U |           2U |                   1U |          2U |                  0U |               false | Fatal error raised |
- * |       19 | redcty_kCheckCodeE   |  500U |       1000U |              10U |           2U |                   0U |          3U |                  0U |               false | Fatal error raised |
- * |       20 | redcty_kCheckCodeE   |  500U |       1000U |              10U |           2U |                   0U |          2U |                  4U |               false | Fatal error raised |
+ * |       13 | redcty_kCheckCodeMax |  500U |       1000U |              64U |           2U |                   0U |          2U |                  0U |               false | Fatal error raised |
+ * |       14 | redcty_kCheckCodeE   |  501U |       1000U |              64U |           2U |                   0U |          2U |                  0U |               false | Fatal error raised |
+ * |       15 | redcty_kCheckCodeE   |  500U |       1001U |              64U |           2U |                   0U |          2U |                  0U |               false | Fatal error raised |
+ * |       16 | redcty_kCheckCodeE   |  500U |       1000U |              65U |           2U |                   0U |          2U |                  0U |               false | Fatal error raised |
+ * |       17 | redcty_kCheckCodeE   |  500U |       1000U |              64U |           3U |                   0U |          2U |                  0U |               false | Fatal error raised |
+ * |       18 | redcty_kCheckCodeE   |  500U |       1000U |              64U |           2U |                   1U |          2U |                  0U |               false | Fatal error raised |
+ * |       19 | redcty_kCheckCodeE   |  500U |       1000U |              64U |           2U |                   0U |          3U |                  0U |               false | Fatal error raised |
+ * |       20 | redcty_kCheckCodeE   |  500U |       1000U |              64U |           2U |                   0U |          2U |                  4U |               false | Fatal error raised |
  *
  * @safetyRel   No
  *
@@ -886,6 +890,81 @@ INSTANTIATE_TEST_SUITE_P(
   )
 );
 
+/**
+ * @test        @ID{reddiaTest009} Verify the transport channel lookup with sparse transport channel ids.
+ *
+ * @details     This test verifies that the transport channel lookup table handles sparse and unordered transport channel ids and that a transport
+ *              channel id, which is configured twice, is rejected by the configuration check.
+ *
+ * Test steps:
+ * - create a config with the transport channel ids 3 and 0 on redundancy channel 0 and the transport channel id 1 on redundancy channel 1
+ * - verify that the config is valid and init the module
+ * - call the IsTransportChannelIdValid function for all transport channel ids and verify its return value
+ * - call the GetAssociatedRedundancyChannel function for all transport channel ids and verify the associated redundancy channel and its return value
+ * - call the UpdateRedundancyChannelDiagnostics function for transport channel id 0 and verify that the message received flag of the second transport channel is set
+ * - configure the transport channel id 3 also on redundancy channel 1 and verify that the config is not valid
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(reddiaTest, reddiaTest009VerifySparseTransportChannelLookup)
+{
+  // test config with sparse and unordered transport channel ids
+  redcty_RedundancyLayerConfiguration config = default_config;
+  config.redundancy_channel_configurations[0].num_transport_channels = 2U;
+  config.redundancy_channel_configurations[0].transport_channel_ids[0] = 3U;
+  config.redundancy_channel_configurations[0].transport_channel_ids[1] = 0U;
+  config.redundancy_channel_configurations[1].num_transport_channels = 1U;
+  config.redundancy_channel_configurations[1].transport_channel_ids[0] = 1U;
+
+  // expect no fatal error and the timer value call of the diagnostics update
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+  EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillOnce(Return(0U));
+
+  // verify the config and init the module
+  EXPECT_TRUE(reddia_IsConfigurationValid(&config));
+  EXPECT_NO_THROW(reddia_InitRedundancyLayerDiagnostics(&config));
+
+  // verify the transport channel lookup
+  EXPECT_TRUE(reddia_IsTransportChannelIdValid(0U, 0U));
+  EXPECT_FALSE(reddia_IsTransportChannelIdValid(0U, 1U));
+  EXPECT_FALSE(reddia_IsTransportChannelIdValid(0U, 2U));
+  EXPECT_TRUE(reddia_IsTransportChannelIdValid(0U, 3U));
+  EXPECT_FALSE(reddia_IsTransportChannelIdValid(0U, UINT32_MAX));
+  EXPECT_FALSE(reddia_IsTransportChannelIdValid(1U, 0U));
+  EXPECT_TRUE(reddia_IsTransportChannelIdValid(1U, 1U));
+  EXPECT_FALSE(reddia_IsTransportChannelIdValid(1U, 2U));
+  EXPECT_FALSE(reddia_IsTransportChannelIdValid(1U, 3U));
+
+  // verify the associated redundancy channels
+  uint32_t red_channel_id = UINT32_MAX;
+  EXPECT_TRUE(reddia_GetAssociatedRedundancyChannel(0U, &red_channel_id));
+  EXPECT_EQ(0U, red_channel_id);
+  EXPECT_TRUE(reddia_GetAssociatedRedundancyChannel(1U, &red_channel_id));
+  EXPECT_EQ(1U, red_channel_id);
+  EXPECT_TRUE(reddia_GetAssociatedRedundancyChannel(3U, &red_channel_id));
+  EXPECT_EQ(0U, red_channel_id);
+  red_channel_id = UINT32_MAX;
+  EXPECT_FALSE(reddia_GetAssociatedRedundancyChannel(2U, &red_channel_id));
+  EXPECT_FALSE(reddia_GetAssociatedRedundancyChannel(UINT32_MAX, &red_channel_id));
+  EXPECT_EQ(UINT32_MAX, red_channel_id);
+
+  // verify the transport channel index of transport channel id 0
+  EXPECT_NO_THROW(reddia_UpdateRedundancyChannelDiagnostics(0U, 0U, 0U));
+  EXPECT_FALSE(reddia_instance->received_messages_timestamps[0][0].message_received_flag[0]);
+  EXPECT_TRUE(reddia_instance->received_messages_timestamps[0][0].message_received_flag[1]);
+
+  // verify that a transport channel id configured twice is not valid
+  config.redundancy_channel_configurations[1].num_transport_channels = 2U;
+  config.redundancy_channel_configurations[1].transport_channel_ids[1] = 3U;
+  EXPECT_FALSE(reddia_IsConfigurationValid(&config));
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
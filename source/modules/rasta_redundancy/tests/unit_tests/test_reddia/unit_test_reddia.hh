@@ -31,6 +31,7 @@
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasys_mock.hh"
 #include "redcor_mock.hh"
+#include "redins_mock.hh"
 #include "rednot_mock.hh"
 #include "test_helper.hh"
 // clang-format on
@@ -53,7 +54,7 @@ using testing::Return;
 #define UT_REDDIA_TR_CHANNEL_ID_MIN 0U              ///< minimum id of transport channel
 #define UT_REDDIA_TR_CHANNEL_ID_MAX 3U              ///< maximum id of transport channel
 #define UT_REDDIA_DFQ_SIZE_MIN 4U                   ///< minimum defer queue size
-#define UT_REDDIA_DFQ_SIZE_MAX 10U                  ///< maximum defer queue size
+#define UT_REDDIA_DFQ_SIZE_MAX 64U                  ///< maximum defer queue size
 #define UT_REDDIA_N_DIAGNOSIS_MIN 10U               ///< minimum diagnosis window size
 #define UT_REDDIA_N_DIAGNOSIS_MAX 1000U             ///< maximum diagnosis window size
 #define UT_REDDIA_T_SEQ_MIN 50U                     ///< minimum time period (in ms) how long a message is buffered
@@ -63,11 +64,7 @@ using testing::Return;
 // Local Variable Definitions
 // -----------------------------------------------------------------------------
 
-extern bool reddia_initialized;                                                 ///< initialization state (local variable)
-extern redcty_RedundancyLayerConfiguration *reddia_redundancy_configuration;    ///< redundancy layer configuration (local variable)
-extern uint32_t reddia_current_n_diagnosis[UT_REDDIA_NUM_OF_RED_CHANNELS_MAX];  ///< current messages in diagnosis window
-extern reddia_ReceivedMessageTimestamp reddia_received_messages_timestamps[RADEF_MAX_NUMBER_OF_RED_CHANNELS][RADEF_MAX_RED_LAYER_N_DIAGNOSIS];               ///< timestamps of received messages
-extern radef_TransportChannelDiagnosticData reddia_transport_channel_diagnostic_data[UT_REDDIA_NUM_OF_RED_CHANNELS_MAX][UT_REDDIA_NUM_OF_TR_CHANNELS_MAX];   ///< transport channel diagnostic data
+extern RADEF_THREAD_LOCAL reddia_InstanceData *reddia_instance;                 ///< data of the selected diagnostics module instance
 
 /**
  * @brief default config for tests
@@ -107,7 +104,9 @@ class reddiaTest : public ::testing::Test
 public:
   reddiaTest() {
     // reset initialization state
-    reddia_initialized = false;
+    reddia_instance->initialized = false;
+    // the notifications are called with the selected RedL instance
+    EXPECT_CALL(redins_mock, redins_GetSelectedInstance()).WillRepeatedly(Return(&test_instance));
   }
   ~reddiaTest() {
   }
@@ -177,8 +176,11 @@ public:
     return config;
   }
 
+  redint_Instance test_instance = {};     ///< RedL instance, which is passed to the notifications
+
   StrictMock<rasysMock> rasys_mock;       ///< mock for the rasta system adapter class
   redcorMock redcor_mock;                 ///< mock for the redundancy core class
+  redinsMock redins_mock;                 ///< mock for the redundancy instances class
   rednotMock rednot_mock;                 ///< mock for the redundancy notification class
 };
 
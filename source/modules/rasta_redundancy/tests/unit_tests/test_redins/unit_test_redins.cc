@@ -0,0 +1,118 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_redins.cc
+ *
+ * @author Nicola Fricker, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Unit test file for the instances module of the redundancy layer.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "unit_test_redins.hh"
+
+// -----------------------------------------------------------------------------
+// Test cases
+// -----------------------------------------------------------------------------
+
+/** @addtogroup red_instances
+ * @{
+ */
+
+/**
+ * @test        @ID{redinsTest001} Verify the create instance function.
+ *
+ * @details     This test verifies that all instances can be created one after another and that no further instance can be created afterwards.
+ *
+ * Test steps:
+ * - verify that no instance is selected
+ * - create all instances and verify the returned pointers and instance indexes
+ * - verify that no instance is available anymore
+ * - call the create instance function again and verify that a fatal error is thrown
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No preconditions for this test case.
+ * @post        All instances are created.
+ *
+ * @testMethod  Functional Test
+
+ */
+TEST_F(redinsTest, redinsTest001VerifyCreateInstanceFunction)
+{
+    std::vector<redint_Instance *> instances;
+
+    EXPECT_EQ(nullptr, redins_GetSelectedInstance());
+
+    for (uint32_t index = 0U; index < RADEF_MAX_NUMBER_OF_RED_INSTANCES; index++)
+    {
+        EXPECT_TRUE(redins_IsInstanceAvailable());
+        redint_Instance *const instance = redins_CreateInstance();
+        ASSERT_NE(nullptr, instance);
+        EXPECT_EQ(index, instance->instance_index);
+        for (redint_Instance *const other_instance : instances)
+        {
+            EXPECT_NE(other_instance, instance);
+        }
+        instances.push_back(instance);
+    }
+    EXPECT_FALSE(redins_IsInstanceAvailable());
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInternalError)).WillOnce(Invoke(this, &redinsTest::invalidArgumentException));
+    EXPECT_THROW(redins_CreateInstance(), std::invalid_argument);
+}
+
+/**
+ * @test        @ID{redinsTest002} Verify the select instance function.
+ *
+ * @details     This test verifies that the select instance function selects the instance in all RedL modules, when the instance changes.
+ *
+ * Test steps:
+ * - call the select instance function with a NULL pointer and verify that a fatal error is thrown
+ * - create all instances
+ * - select every instance and verify that the select instance function of all modules is called with the instance index
+ * - verify that the selected instance is returned
+ * - select the same instance again and verify that no module function is called
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No preconditions for this test case.
+ * @post        The last instance is selected.
+ *
+ * @testMethod  Functional Test
+
+ */
+TEST_F(redinsTest, redinsTest002VerifySelectInstanceFunction)
+{
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &redinsTest::invalidArgumentException));
+    EXPECT_THROW(redins_SelectInstance(nullptr), std::invalid_argument);
+
+    for (uint32_t index = 0U; index < RADEF_MAX_NUMBER_OF_RED_INSTANCES; index++)
+    {
+        redint_Instance *const instance = redins_CreateInstance();
+
+        EXPECT_CALL(redmsg_mock, redmsg_SelectInstance(index)).Times(1);
+        EXPECT_CALL(reddia_mock, reddia_SelectInstance(index)).Times(1);
+        EXPECT_CALL(redrbf_mock, redrbf_SelectInstance(index)).Times(1);
+        EXPECT_CALL(reddfq_mock, reddfq_SelectInstance(index)).Times(1);
+        EXPECT_CALL(redcor_mock, redcor_SelectInstance(index)).Times(1);
+        EXPECT_CALL(redstm_mock, redstm_SelectInstance(index)).Times(1);
+        redins_SelectInstance(instance);
+        EXPECT_EQ(instance, redins_GetSelectedInstance());
+
+        // selecting the selected instance again does not change anything
+        redins_SelectInstance(instance);
+        EXPECT_EQ(instance, redins_GetSelectedInstance());
+    }
+}
+
+/** @}*/
@@ -0,0 +1,93 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_redins.hh
+ *
+ * @author Nicola Fricker, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Header file for unit tests of the instances module of the redundancy layer.
+ */
+
+#ifndef SOURCE_MODULES_RASTA_REDUNDANCY_TESTS_UNIT_TESTS_TEST_REDINS_UNIT_TEST_REDINS_HH_
+#define SOURCE_MODULES_RASTA_REDUNDANCY_TESTS_UNIT_TESTS_TEST_REDINS_UNIT_TEST_REDINS_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+// clang-format off
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "src/redins_red_instances.h"
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasys_mock.hh"
+#include "redcor_mock.hh"
+#include "reddfq_mock.hh"
+#include "reddia_mock.hh"
+#include "redmsg_mock.hh"
+#include "redrbf_mock.hh"
+#include "redstm_mock.hh"
+// clang-format on
+
+using testing::_;
+using testing::Invoke;
+using testing::StrictMock;
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+extern uint32_t redins_number_of_instances;                           ///< number of created instances
+extern RADEF_THREAD_LOCAL redint_Instance *redins_selected_instance;  ///< pointer to the selected instance
+
+// -----------------------------------------------------------------------------
+// Test class definiton
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test fixture class for the instances module
+ *
+ */
+class redinsTest : public ::testing::Test
+{
+public:
+    redinsTest()
+    {
+        // reset the created and selected instances
+        redins_number_of_instances = 0U;
+        redins_selected_instance = NULL;
+    }
+    ~redinsTest()
+    {
+
+    }
+
+    /**
+    * @brief Throw invalid argument exception
+    * This function is used to throw an invalid argument exception mocked function call action.
+    */
+    void invalidArgumentException(){
+        throw std::invalid_argument("Invalid argument!");
+    }
+
+    StrictMock<rasysMock>   rasys_mock;         ///< mock for the rasta system adapter class
+    StrictMock<redcorMock>  redcor_mock;        ///< mock for the redundancy core class
+    StrictMock<reddfqMock>  reddfq_mock;        ///< mock for the redundancy defer queue class
+    StrictMock<reddiaMock>  reddia_mock;        ///< mock for the redundancy diagnostics class
+    StrictMock<redmsgMock>  redmsg_mock;        ///< mock for the redundancy messages class
+    StrictMock<redrbfMock>  redrbf_mock;        ///< mock for the redundancy received buffer class
+    StrictMock<redstmMock>  redstm_mock;        ///< mock for the redundancy state machine class
+};
+
+#endif  // SOURCE_MODULES_RASTA_REDUNDANCY_TESTS_UNIT_TESTS_TEST_REDINS_UNIT_TEST_REDINS_HH_
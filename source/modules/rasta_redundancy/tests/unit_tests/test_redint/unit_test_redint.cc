@@ -205,7 +205,18 @@ TEST_P(InitTestWithParam, redintTest001VerifyInitFunction)
   }
 
   // perform test
-  EXPECT_EQ(expected_return_code, redint_Init(&default_config));
+  EXPECT_EQ(expected_return_code, redint_Init(&default_config, &instance));
+
+  // check the initialization state and the returned instance
+  if(use_valid_config)
+  {
+    EXPECT_TRUE(test_instance.initialized);
+    EXPECT_EQ(&test_instance, instance);
+  }
+  else
+  {
+    EXPECT_FALSE(test_instance.initialized);
+  }
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -244,10 +255,10 @@ TEST_F(redintTest, redintTest002VerifyInitFunctionCalls)
   EXPECT_CALL(reddfq_mock, reddfq_Init(default_config.number_of_redundancy_channels, default_config.n_defer_queue_size, default_config.t_seq)).Times(1);
 
   // call the init function and verify no error return code
-  EXPECT_EQ(radef_kNoError, redint_Init(&default_config));
+  EXPECT_EQ(radef_kNoError, redint_Init(&default_config, &instance));
 
   // call the init function again and verify already initialized return code
-  EXPECT_EQ(radef_kAlreadyInitialized, redint_Init(&default_config));
+  EXPECT_EQ(radef_kAlreadyInitialized, redint_Init(&default_config, &instance));
 }
 
 /**
@@ -257,10 +268,13 @@ TEST_F(redintTest, redintTest002VerifyInitFunctionCalls)
  *              with a null pointer as argument.
  *
  * Test steps:
+ * - call the redint_Init with invalid configuration pointer and verify return code
+ * - call the redint_Init with invalid instance pointer and verify return code
  * - init module with default config
  * - call the redint_SendMessage with invalid message data pointer and verify return code
  * - call the redint_ReadMessage with invalid message size pointer and verify return code
  * - call the redint_ReadMessage with invalid message buffer pointer and verify return code
+ * - call the redint_GetNextDeadline with invalid time to next deadline pointer and verify return code
  * .
  *
  * @safetyRel   No
@@ -279,7 +293,8 @@ TEST_F(redintTest, redintTest003VerifyNullPointerCheck)
   uint8_t message_buffer            = {};
 
   // perform test for init function
-  EXPECT_EQ(radef_kInvalidParameter, redint_Init((redcty_RedundancyLayerConfiguration *)NULL));
+  EXPECT_EQ(radef_kInvalidParameter, redint_Init((redcty_RedundancyLayerConfiguration *)NULL, &instance));
+  EXPECT_EQ(radef_kInvalidParameter, redint_Init(&default_config, (redint_Instance **)NULL));
 
   // set expectations for init call
   EXPECT_CALL(redcor_mock, redcor_IsConfigurationValid(&default_config)).WillOnce(Return(true));
@@ -289,15 +304,16 @@ TEST_F(redintTest, redintTest003VerifyNullPointerCheck)
   EXPECT_CALL(reddfq_mock, reddfq_Init(default_config.number_of_redundancy_channels, default_config.n_defer_queue_size, default_config.t_seq)).Times(1);
 
   // init module
-  redint_Init(&default_config);
+  redint_Init(&default_config, &instance);
 
   // expect state check before parameter check of sendmessage
   EXPECT_CALL(redstm_mock, redstm_GetChannelState(redundancy_channel_id)).Times(1).WillOnce(Return(redstm_kRedundancyChannelStateUp));
 
   // perform rest of the tests
-  EXPECT_EQ(radef_kInvalidParameter, redint_SendMessage(redundancy_channel_id, message_size, (uint8_t *)NULL));
-  EXPECT_EQ(radef_kInvalidParameter, redint_ReadMessage(redundancy_channel_id, buffer_size, (uint16_t *)NULL, &message_buffer));
-  EXPECT_EQ(radef_kInvalidParameter, redint_ReadMessage(redundancy_channel_id, buffer_size, &message_size, (uint8_t *)NULL));
+  EXPECT_EQ(radef_kInvalidParameter, redint_SendMessage(&test_instance, redundancy_channel_id, message_size, (uint8_t *)NULL));
+  EXPECT_EQ(radef_kInvalidParameter, redint_ReadMessage(&test_instance, redundancy_channel_id, buffer_size, (uint16_t *)NULL, &message_buffer));
+  EXPECT_EQ(radef_kInvalidParameter, redint_ReadMessage(&test_instance, redundancy_channel_id, buffer_size, &message_size, (uint8_t *)NULL));
+  EXPECT_EQ(radef_kInvalidParameter, redint_GetNextDeadline(&test_instance, (uint32_t *)NULL));
 }
 
 /**
@@ -313,6 +329,8 @@ TEST_F(redintTest, redintTest003VerifyNullPointerCheck)
  * - call the redint_SendMessage function without prior initialization and verify return code
  * - call the redint_ReadMessage function without prior initialization and verify return code
  * - call the redint_CheckTimings function without prior initialization and verify return code
+ * - call the redint_GetNextDeadline function without prior initialization and verify return code
+ * - call all functions with a NULL instance and verify return code
  * .
  *
  * @safetyRel   No
@@ -329,14 +347,25 @@ TEST_F(redintTest, redintTest004VerifyInitializationCheck)
   uint16_t message_size             = 0;
   uint16_t buffer_size              = 0;
   uint8_t message_buffer            = {};
+  uint32_t time_to_next_deadline    = 0;
 
   // perform test
-  EXPECT_EQ(radef_kNotInitialized, redint_GetInitializationState());
-  EXPECT_EQ(radef_kNotInitialized, redint_OpenRedundancyChannel(redundancy_channel_id));
-  EXPECT_EQ(radef_kNotInitialized, redint_CloseRedundancyChannel(redundancy_channel_id));
-  EXPECT_EQ(radef_kNotInitialized, redint_SendMessage(redundancy_channel_id, message_size, &message_buffer));
-  EXPECT_EQ(radef_kNotInitialized, redint_ReadMessage(redundancy_channel_id, buffer_size, &message_size, &message_buffer));
-  EXPECT_EQ(radef_kNotInitialized, redint_CheckTimings());
+  EXPECT_EQ(radef_kNotInitialized, redint_GetInitializationState(&test_instance));
+  EXPECT_EQ(radef_kNotInitialized, redint_OpenRedundancyChannel(&test_instance, redundancy_channel_id));
+  EXPECT_EQ(radef_kNotInitialized, redint_CloseRedundancyChannel(&test_instance, redundancy_channel_id));
+  EXPECT_EQ(radef_kNotInitialized, redint_SendMessage(&test_instance, redundancy_channel_id, message_size, &message_buffer));
+  EXPECT_EQ(radef_kNotInitialized, redint_ReadMessage(&test_instance, redundancy_channel_id, buffer_size, &message_size, &message_buffer));
+  EXPECT_EQ(radef_kNotInitialized, redint_CheckTimings(&test_instance));
+  EXPECT_EQ(radef_kNotInitialized, redint_GetNextDeadline(&test_instance, &time_to_next_deadline));
+
+  // perform test with a NULL instance
+  EXPECT_EQ(radef_kNotInitialized, redint_GetInitializationState((redint_Instance *)NULL));
+  EXPECT_EQ(radef_kNotInitialized, redint_OpenRedundancyChannel((redint_Instance *)NULL, redundancy_channel_id));
+  EXPECT_EQ(radef_kNotInitialized, redint_CloseRedundancyChannel((redint_Instance *)NULL, redundancy_channel_id));
+  EXPECT_EQ(radef_kNotInitialized, redint_SendMessage((redint_Instance *)NULL, redundancy_channel_id, message_size, &message_buffer));
+  EXPECT_EQ(radef_kNotInitialized, redint_ReadMessage((redint_Instance *)NULL, redundancy_channel_id, buffer_size, &message_size, &message_buffer));
+  EXPECT_EQ(radef_kNotInitialized, redint_CheckTimings((redint_Instance *)NULL));
+  EXPECT_EQ(radef_kNotInitialized, redint_GetNextDeadline((redint_Instance *)NULL, &time_to_next_deadline));
 }
 
 /**
@@ -378,11 +407,11 @@ TEST_P(GetInitializationStateTestWithParam, redintTest005VerifyGetInitialization
     EXPECT_CALL(reddfq_mock, reddfq_Init(default_config.number_of_redundancy_channels, default_config.n_defer_queue_size, default_config.t_seq)).Times(1);
 
     // init module
-    redint_Init(&default_config);
+    redint_Init(&default_config, &instance);
   }
 
   // perform test
-  EXPECT_EQ(expected_return_code, redint_GetInitializationState());
+  EXPECT_EQ(expected_return_code, redint_GetInitializationState(&test_instance));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -453,10 +482,10 @@ TEST_P(OpenRedundancyChannelTestWithParam, redintTest006VerifyOpenRedundancyChan
   }
 
   // init module
-  redint_Init(&config);
+  redint_Init(&config, &instance);
 
   // perform test
-  EXPECT_EQ(expected_return_code, redint_OpenRedundancyChannel(redundancy_channel_id));
+  EXPECT_EQ(expected_return_code, redint_OpenRedundancyChannel(&test_instance, redundancy_channel_id));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -525,20 +554,20 @@ TEST_P(CloseRedundancyChannelTestWithParam, redintTest007VerifyCloseRedundancyCh
   EXPECT_CALL(reddfq_mock, reddfq_Init(config.number_of_redundancy_channels, config.n_defer_queue_size, config.t_seq)).Times(1);
 
   // init module
-  redint_Init(&config);
+  redint_Init(&config, &instance);
 
   // open redundancy channel if config valid
   if(expected_return_code == radef_kNoError)
   {
     EXPECT_CALL(redstm_mock, redstm_ProcessChannelStateMachine(redundancy_channel_id, redstm_kRedundancyChannelEventOpen)).Times(1);
-    EXPECT_EQ(radef_kNoError, redint_OpenRedundancyChannel(redundancy_channel_id));
+    EXPECT_EQ(radef_kNoError, redint_OpenRedundancyChannel(&test_instance, redundancy_channel_id));
 
     // expect state machine call on closing
     EXPECT_CALL(redstm_mock, redstm_ProcessChannelStateMachine(redundancy_channel_id, redstm_kRedundancyChannelEventClose)).Times(1);
   }
 
   // perform test
-  EXPECT_EQ(expected_return_code, redint_CloseRedundancyChannel(redundancy_channel_id));
+  EXPECT_EQ(expected_return_code, redint_CloseRedundancyChannel(&test_instance, redundancy_channel_id));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -614,7 +643,7 @@ TEST_P(SendMessageTestWithParam, redintTest008VerifySendMessage)
   EXPECT_CALL(reddfq_mock, reddfq_Init(config.number_of_redundancy_channels, config.n_defer_queue_size, config.t_seq)).Times(1);
 
   // init module
-  redint_Init(&config);
+  redint_Init(&config, &instance);
 
   if(channel_state_up)
   {
@@ -633,7 +662,7 @@ TEST_P(SendMessageTestWithParam, redintTest008VerifySendMessage)
   }
 
   // perform test
-  EXPECT_EQ(expected_return_code, redint_SendMessage(redundancy_channel_id, message_size, &message_data));
+  EXPECT_EQ(expected_return_code, redint_SendMessage(&test_instance, redundancy_channel_id, message_size, &message_data));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -719,10 +748,10 @@ TEST_P(ReadMessageTestWithParam, redintTest009VerifyReadMessage)
   }
 
   // init module
-  redint_Init(&config);
+  redint_Init(&config, &instance);
 
   // perform test
-  EXPECT_EQ(expected_return_code, redint_ReadMessage(redundancy_channel_id, buffer_size, &message_size, &buffer));
+  EXPECT_EQ(expected_return_code, redint_ReadMessage(&test_instance, redundancy_channel_id, buffer_size, &message_size, &buffer));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -29,6 +29,7 @@
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasys_mock.hh"
 #include "redcor_mock.hh"
+#include "redins_mock.hh"
 #include "reddfq_mock.hh"
 #include "redrbf_mock.hh"
 #include "redmsg_mock.hh"
@@ -43,6 +44,9 @@ using testing::Return;
 using testing::Invoke;
 using testing::InSequence;
 using testing::Throw;
+using testing::DoAll;
+using testing::SetArgPointee;
+using testing::SetArrayArgument;
 
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
@@ -90,7 +94,6 @@ typedef struct {
 // -----------------------------------------------------------------------------
 
 extern uint8_t test_red_message_data_u8[UT_REDINT_MSG_LEN_MAX];
-extern radef_RaStaReturnCode redint_initialization_state;            ///< initialization state (local variable)
 
 /**
  * @brief default config for tests
@@ -138,8 +141,10 @@ class redintTest : public ::testing::Test
 public:
   redintTest()
   {
-    // reset initialization state
-    redint_initialization_state = radef_kNotInitialized;
+    // the test instance is available as long as it is not initialized
+    EXPECT_CALL(redins_mock, redins_IsInstanceAvailable()).WillRepeatedly(Invoke([this]() { return !test_instance.initialized; }));
+    EXPECT_CALL(redins_mock, redins_CreateInstance()).WillRepeatedly(Return(&test_instance));
+    EXPECT_CALL(redins_mock, redins_SelectInstance(&test_instance)).Times(testing::AnyNumber());
   }
 
   ~redintTest()
@@ -204,9 +209,14 @@ public:
     return config;
   }
 
+  redint_Instance test_instance = {};  ///< RedL instance returned by the mocked redins_CreateInstance function
+  redint_Instance *instance = nullptr;  ///< RedL instance returned by the init function
+
   StrictMock<rasysMock> rasys_mock;  ///< mock for the rasta system adapter class
+  redinsMock redins_mock;            ///< mock for the redundancy instances class
   reddfqMock reddfq_mock;            ///< mock for the redundancy defer queue class
   redcorMock redcor_mock;            ///< mock for the redundancy core class
+  redmsgMock redmsg_mock;            ///< mock for the redundancy messages class
   redrbfMock redrbf_mock;            ///< mock for the redundancy received buffer class
   redtriMock redtri_mock;            ///< mock for the redundancy transport interface
   redstmMock redstm_mock;            ///< mock for the redundancy state machine class
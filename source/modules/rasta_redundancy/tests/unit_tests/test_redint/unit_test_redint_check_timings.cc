@@ -91,6 +91,65 @@ class CheckTimingsTestWithParam :   public redintTest, public testing::WithParam
   bool message_read_but_still_pending          = std::get<12>(GetParam());       ///< indicates if a message was not read correctly
 };
 
+/**
+ * @brief Test class for the received message polling with a simulated received buffer and defer queue
+ *
+ * Every processed message uses a received buffer entry, a defer queue entry or no entry according to its type.
+ *
+ * Parameter order:
+ * - Free received buffer entries (uint16_t)
+ * - Used defer queue entries (uint32_t)
+ * - Types of the pending messages in the read order, 'i' in sequence, 'o' out of sequence, 'd' duplicated (const char *)
+ * - Expected number of read messages (uint16_t)
+ * .
+ */
+class ReceivedMessagesPollingTestWithParam :   public redintTest, public testing::WithParamInterface<std::tuple<uint16_t, uint32_t, const char *, uint16_t>>
+{
+  public:
+  uint16_t free_bfr_entries                    = std::get<0>(GetParam());        ///< amount of free buffer entries
+  uint32_t used_dfq_entries                    = std::get<1>(GetParam());        ///< amount of used defer queue entries
+  std::string message_types                    = std::get<2>(GetParam());        ///< types of the pending messages in the read order
+  uint16_t expected_read_messages              = std::get<3>(GetParam());        ///< expected amount of read messages
+  bool tr_channel_pending[UT_REDINT_TRANSPORT_CHANNEL_NUM_MAX] = {true, true};   ///< message pending flags of the transport channels
+  std::vector<uint32_t> read_tr_channel_ids;                                     ///< transport channel ids of the read messages in the read order
+  std::vector<uint32_t> written_tr_channel_ids;                                  ///< transport channel ids of the processed messages in the processing order
+  std::vector<uint8_t> written_message_indices;                                  ///< indices of the processed messages in the processing order
+
+  /**
+   * @brief Read the next pending message into the message buffer, the first message byte is set to the message index
+   */
+  radef_RaStaReturnCode ReadMessage(redint_Instance *, const uint32_t transport_channel_id, const uint16_t, uint16_t *message_size, uint8_t *message_buffer)
+  {
+    radef_RaStaReturnCode return_code = radef_kNoMessageReceived;
+    if (read_tr_channel_ids.size() < message_types.size())
+    {
+      *message_size = UT_REDINT_MSG_LEN_MIN;
+      message_buffer[0] = (uint8_t)read_tr_channel_ids.size();
+      read_tr_channel_ids.push_back(transport_channel_id);
+      return_code = radef_kNoError;
+    }
+    return return_code;
+  }
+
+  /**
+   * @brief Write a checked message to the input buffer and use a received buffer or defer queue entry according to the message type
+   */
+  void WriteCheckedMessageToInputBuffer(const uint32_t, const uint32_t transport_channel_id, const bool, const redtyp_RedundancyMessage *received_message)
+  {
+    const uint8_t message_index = received_message->message[0];
+    written_tr_channel_ids.push_back(transport_channel_id);
+    written_message_indices.push_back(message_index);
+    if (message_types[message_index] == 'i')
+    {
+      free_bfr_entries--;
+    }
+    else if (message_types[message_index] == 'o')
+    {
+      used_dfq_entries++;
+    }
+  }
+};
+
 // -----------------------------------------------------------------------------
 // Test Cases
 // -----------------------------------------------------------------------------
@@ -110,9 +169,11 @@ class CheckTimingsTestWithParam :   public redintTest, public testing::WithParam
  * - set expectations if state up
  *   - set buffer and queue entries and pending messages according to parameter
  *   - set expectations to add message for every pending message as long as free entry available
- *   - set expectations if channel timeout
+ *   - set expectations to check the check codes of the read messages in a batch and process them, when the batch is full and after the polling
+ *   - set expectations if channel timeout (timeout reported once, then no more timeout)
  * - set expectations if state closed
  *   - read every pending message and clear its flag
+ * - set expectations for the expired defer timers of all channels in state up with a defer queue timeout
  * - init module
  * - call CheckTimings function and expect radef_kNoError as return value
  * .
@@ -203,8 +264,15 @@ TEST_P(CheckTimingsTestWithParam, redintTest010VerifyCheckTimings)
     // set messages pending according to parameter
     uint16_t pending_messages = channels[i].pending_messages;
 
-    // return states from parameter
-    EXPECT_CALL(redstm_mock, redstm_GetChannelState(channels[i].channel_id)).WillOnce(Return(channels[i].state));
+    // return states from parameter (the state of a channel with a defer queue timeout is checked again before every timeout check)
+    if((channels[i].state == redstm_kRedundancyChannelStateUp) && channels[i].dfq_timeout)
+    {
+      EXPECT_CALL(redstm_mock, redstm_GetChannelState(channels[i].channel_id)).Times(3).WillRepeatedly(Return(channels[i].state));
+    }
+    else
+    {
+      EXPECT_CALL(redstm_mock, redstm_GetChannelState(channels[i].channel_id)).WillOnce(Return(channels[i].state));
+    }
 
     if(channels[i].state == redstm_kRedundancyChannelStateUp)
     {
@@ -226,6 +294,21 @@ TEST_P(CheckTimingsTestWithParam, redintTest010VerifyCheckTimings)
           EXPECT_CALL(redcor_mock, redcor_GetMessagePendingFlag(channels[i].channel_id, _)).Times(2).WillRepeatedly(Return(false));
         }
 
+        // the read messages are checked and processed in batches of REDINS_POLLING_BATCH_SIZE messages and after the polling
+        const radef_RaStaReturnCode check_code_results[REDINS_POLLING_BATCH_SIZE] = {radef_kNoError, radef_kNoError, radef_kNoError, radef_kNoError};
+        uint16_t read_messages = 0;
+        auto expect_process_read_messages = [&]() {
+          EXPECT_CALL(redmsg_mock, redmsg_CheckMessageCrcBatch(read_messages, test_instance.polling_messages, _))
+              .WillOnce(SetArrayArgument<2>(check_code_results, check_code_results + read_messages));
+          for (uint16_t message_index = 0; message_index < read_messages; message_index++)
+          {
+            EXPECT_CALL(redcor_mock, redcor_WriteCheckedMessageToInputBuffer(channels[i].channel_id, _, true, &test_instance.polling_messages[message_index]));
+            EXPECT_CALL(redstm_mock, redstm_ProcessChannelStateMachine(_, redstm_kRedundancyChannelEventReceiveData));
+            EXPECT_CALL(redcor_mock, redcor_ClearInputBufferMessagePendingFlag(_));
+          }
+          read_messages = 0;
+        };
+
         while (free_buffer_entries > used_defer_queue_entries)
         {
 
@@ -242,14 +325,16 @@ TEST_P(CheckTimingsTestWithParam, redintTest010VerifyCheckTimings)
 
             if(!message_read_but_still_pending && free_buffer_entries > 1)
             {
-              EXPECT_CALL(redtri_mock, redtri_ReadMessage(_, _, _, _)).WillOnce(Return(radef_kNoError));
-              EXPECT_CALL(redcor_mock, redcor_WriteReceivedMessageToInputBuffer(_, _, _));
-              EXPECT_CALL(redstm_mock, redstm_ProcessChannelStateMachine(_, redstm_kRedundancyChannelEventReceiveData));
-              EXPECT_CALL(redcor_mock, redcor_ClearInputBufferMessagePendingFlag(_));
+              EXPECT_CALL(redtri_mock, redtri_ReadMessage(&test_instance, _, _, _, _)).WillOnce(Return(radef_kNoError));
+              read_messages++;
+              if (read_messages >= REDINS_POLLING_BATCH_SIZE)
+              {
+                expect_process_read_messages();
+              }
             }
             else
             {
-              EXPECT_CALL(redtri_mock, redtri_ReadMessage(_, _, _, _)).WillOnce(Return(radef_kNoMessageReceived));
+              EXPECT_CALL(redtri_mock, redtri_ReadMessage(&test_instance, _, _, _, _)).WillOnce(Return(radef_kNoMessageReceived));
               EXPECT_CALL(redcor_mock, redcor_ClearMessagePendingFlag(channels[i].channel_id, _));
             }
           }
@@ -270,14 +355,19 @@ TEST_P(CheckTimingsTestWithParam, redintTest010VerifyCheckTimings)
           pending_messages--;
         }
 
+        if (read_messages > 0)
+        {
+          expect_process_read_messages();
+        }
+
         used_defer_queue_entries++;
         free_buffer_entries--;
       }
 
-      // expect calls for channel timeout
-      EXPECT_CALL(reddfq_mock, reddfq_IsTimeout(channels[i].channel_id)).WillRepeatedly(Return(channels[i].dfq_timeout));
+      // expect calls for channel timeout, the timeout is checked until it is no longer reported
       if (channels[i].dfq_timeout)
       {
+        EXPECT_CALL(reddfq_mock, reddfq_IsTimeout(channels[i].channel_id)).WillOnce(Return(true)).WillOnce(Return(false));
         EXPECT_CALL(redstm_mock, redstm_ProcessChannelStateMachine(channels[i].channel_id, redstm_kRedundancyChannelEventDeferTimeout)).Times(1);
       }
     }
@@ -307,8 +397,8 @@ TEST_P(CheckTimingsTestWithParam, redintTest010VerifyCheckTimings)
             break;
           }
 
-          EXPECT_CALL(redtri_mock, redtri_ReadMessage(_, _, _, _)).WillOnce(Return(radef_kNoError));
-          EXPECT_CALL(redtri_mock, redtri_ReadMessage(_, _, _, _)).WillOnce(Return(radef_kNoMessageReceived));
+          EXPECT_CALL(redtri_mock, redtri_ReadMessage(&test_instance, _, _, _, _)).WillOnce(Return(radef_kNoError));
+          EXPECT_CALL(redtri_mock, redtri_ReadMessage(&test_instance, _, _, _, _)).WillOnce(Return(radef_kNoMessageReceived));
           EXPECT_CALL(redcor_mock, redcor_ClearMessagePendingFlag(channels[i].channel_id, _));
 
           pending_messages--;
@@ -318,11 +408,24 @@ TEST_P(CheckTimingsTestWithParam, redintTest010VerifyCheckTimings)
     }
   }
 
+  // expect the channels with a defer queue timeout to be returned with an expired defer timer
+  {
+    InSequence s;
+    for(uint16_t i = 0; i < configured_redundancy_channels; i++ )
+    {
+      if((channels[i].state == redstm_kRedundancyChannelStateUp) && channels[i].dfq_timeout)
+      {
+        EXPECT_CALL(reddfq_mock, reddfq_GetExpiredChannel(_)).WillOnce(DoAll(SetArgPointee<0>(channels[i].channel_id), Return(true)));
+      }
+    }
+    EXPECT_CALL(reddfq_mock, reddfq_GetExpiredChannel(_)).WillOnce(Return(false));
+  }
+
   // init module
-  redint_Init(&config);
+  redint_Init(&config, &instance);
 
   // perform test
-  EXPECT_EQ(radef_kNoError, redint_CheckTimings());
+  EXPECT_EQ(radef_kNoError, redint_CheckTimings(&test_instance));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -360,6 +463,242 @@ INSTANTIATE_TEST_SUITE_P(
   )
 );
 
+/**
+ * @test        @ID{redintTest012} Verify the CheckTimings function with several timed out messages.
+ *
+ * @details     This test verifies that the CheckTimings function delivers all timed out messages of the redundancy channels with an expired defer timer
+ *              within one call.
+ *
+ * Test steps:
+ * - init module with two redundancy channels in state up and without pending messages
+ * - set the defer queue module to return the expired defer timer of channel 1 first and then the one of channel 0
+ * - set the defer queue module to report one timed out message on channel 1 and two timed out messages on channel 0
+ * - call CheckTimings function and expect radef_kNoError as return value
+ * - verify that one defer timeout event is processed on channel 1 followed by two defer timeout events on channel 0
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redintTest, redintTest012VerifyCheckTimingsSeveralTimedOutMessages)
+{
+  // test variables
+  const uint32_t first_expired_channel_id = UT_REDINT_REDUNDANCY_CHANNEL_ID_MAX;   // channel with one timed out message
+  const uint32_t second_expired_channel_id = UT_REDINT_REDUNDANCY_CHANNEL_ID_MIN;  // channel with two timed out messages
+
+  redcty_RedundancyLayerConfiguration config = CreateConfig(
+    default_config.check_code_type,
+    default_config.t_seq,
+    default_config.n_diagnosis,
+    default_config.n_defer_queue_size,
+    UT_REDINT_REDUNDANCY_CHANNEL_NUM_MAX,
+    UT_REDINT_REDUNDANCY_CHANNEL_ID_MIN,
+    UT_REDINT_TRANSPORT_CHANNEL_NUM_MAX,
+    UT_REDINT_REDUNDANCY_CHANNEL_ID_MIN
+  );
+
+  // Set init call expectations
+  EXPECT_CALL(redcor_mock, redcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(redcor_mock, redcor_Init(&config)).Times(1);
+  EXPECT_CALL(redstm_mock, redstm_Init(config.number_of_redundancy_channels)).Times(1);
+  EXPECT_CALL(redrbf_mock, redrbf_Init(config.number_of_redundancy_channels)).Times(1);
+  EXPECT_CALL(reddfq_mock, reddfq_Init(config.number_of_redundancy_channels, config.n_defer_queue_size, config.t_seq)).Times(1);
+
+  // both channels are up and have no pending messages
+  EXPECT_CALL(redstm_mock, redstm_GetChannelState(_)).WillRepeatedly(Return(redstm_kRedundancyChannelStateUp));
+  EXPECT_CALL(redrbf_mock, redrbf_GetFreeBufferEntries(_)).Times(UT_REDINT_REDUNDANCY_CHANNEL_NUM_MAX).WillRepeatedly(Return(0U));
+  EXPECT_CALL(reddfq_mock, reddfq_GetUsedEntries(_)).Times(UT_REDINT_REDUNDANCY_CHANNEL_NUM_MAX).WillRepeatedly(Return(0U));
+  EXPECT_CALL(redcor_mock, redcor_GetMessagePendingFlag(_, _)).Times(2 * UT_REDINT_REDUNDANCY_CHANNEL_NUM_MAX).WillRepeatedly(Return(false));
+
+  // expect the defer timeout events in the order of the expired defer timers, all timed out messages of a channel are delivered before the next channel
+  {
+    InSequence s;
+    EXPECT_CALL(reddfq_mock, reddfq_GetExpiredChannel(_)).WillOnce(DoAll(SetArgPointee<0>(first_expired_channel_id), Return(true)));
+    EXPECT_CALL(reddfq_mock, reddfq_IsTimeout(first_expired_channel_id)).WillOnce(Return(true));
+    EXPECT_CALL(redstm_mock, redstm_ProcessChannelStateMachine(first_expired_channel_id, redstm_kRedundancyChannelEventDeferTimeout)).Times(1);
+    EXPECT_CALL(reddfq_mock, reddfq_IsTimeout(first_expired_channel_id)).WillOnce(Return(false));
+
+    EXPECT_CALL(reddfq_mock, reddfq_GetExpiredChannel(_)).WillOnce(DoAll(SetArgPointee<0>(second_expired_channel_id), Return(true)));
+    EXPECT_CALL(reddfq_mock, reddfq_IsTimeout(second_expired_channel_id)).WillOnce(Return(true));
+    EXPECT_CALL(redstm_mock, redstm_ProcessChannelStateMachine(second_expired_channel_id, redstm_kRedundancyChannelEventDeferTimeout)).Times(1);
+    EXPECT_CALL(reddfq_mock, reddfq_IsTimeout(second_expired_channel_id)).WillOnce(Return(true));
+    EXPECT_CALL(redstm_mock, redstm_ProcessChannelStateMachine(second_expired_channel_id, redstm_kRedundancyChannelEventDeferTimeout)).Times(1);
+    EXPECT_CALL(reddfq_mock, reddfq_IsTimeout(second_expired_channel_id)).WillOnce(Return(false));
+
+    EXPECT_CALL(reddfq_mock, reddfq_GetExpiredChannel(_)).WillOnce(Return(false));
+  }
+
+  // init module
+  redint_Init(&config, &instance);
+
+  // perform test
+  EXPECT_EQ(radef_kNoError, redint_CheckTimings(&test_instance));
+}
+
+/**
+ * @test        @ID{redintTest013} Verify the received message polling of the CheckTimings function.
+ *
+ * @details     This test verifies that the received message polling, which processes the read messages in batches, reads the same messages as a polling
+ *              which processes every message immediately, when the received buffer or the defer queue gets full. It also verifies that the messages are
+ *              processed in the read order.
+ *
+ * Test steps:
+ * - init module with one redundancy channel in state up
+ * - simulate the free received buffer entries and used defer queue entries according to the types of the processed messages
+ * - call CheckTimings function and expect radef_kNoError as return value
+ * - verify the number of read messages
+ * - verify that the read messages are processed in the read order with the transport channel they are read from
+ * .
+ *
+ * @testParameter
+ * - Free bfr entries: Number of free buffer entries (messages)
+ * - Used dfq entries: Number of used defer queue entries (messages)
+ * - Message types: Types of the pending messages in the read order, i: in sequence, o: out of sequence, d: duplicated
+ * - Read messages: Expected number of read messages
+ * .
+ * | Test Run | Test config                                           ||| Expected values                      ||
+ * |----------|------------------|------------------|---------------|---------------|----------------------|
+ * |          | Free bfr entries | Used dfq entries | Message types | Read messages | Test Result          |
+ * | 0        | 0U               | 0U               | i             | 0U            | Normal operation     |
+ * | 1        | 2U               | 0U               | iiiiii        | 2U            | Received buffer full |
+ * | 2        | 6U               | 0U               | iiiiiiii      | 6U            | Received buffer full |
+ * | 3        | 5U               | 2U               | oooooo        | 3U            | Defer queue full     |
+ * | 4        | 4U               | 0U               | ooiooi        | 4U            | Defer queue full     |
+ * | 5        | 20U              | 0U               | oioooi        | 6U            | Normal operation     |
+ * | 6        | 2U               | 0U               | ididdidi      | 3U            | Received buffer full |
+ * | 7        | 3U               | 1U               | dddddd        | 6U            | Normal operation     |
+ * | 8        | 3U               | 0U               | ododoi        | 5U            | Defer queue full     |
+ *
+ * @safetyRel   No
+ *
+ * @pre         This is a value-parametrized test case which needs instantiation with defined values.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_P(ReceivedMessagesPollingTestWithParam, redintTest013VerifyReceivedMessagesPolling)
+{
+  // test variables
+  const uint32_t red_channel_id = UT_REDINT_REDUNDANCY_CHANNEL_ID_MIN;
+
+  redcty_RedundancyLayerConfiguration config = CreateConfig(
+    default_config.check_code_type,
+    default_config.t_seq,
+    default_config.n_diagnosis,
+    default_config.n_defer_queue_size,
+    UT_REDINT_REDUNDANCY_CHANNEL_NUM_MIN,
+    UT_REDINT_REDUNDANCY_CHANNEL_ID_MIN,
+    UT_REDINT_TRANSPORT_CHANNEL_NUM_MAX,
+    UT_REDINT_REDUNDANCY_CHANNEL_ID_MIN
+  );
+
+  // Set init call expectations
+  EXPECT_CALL(redcor_mock, redcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(redcor_mock, redcor_Init(&config)).Times(1);
+  EXPECT_CALL(redstm_mock, redstm_Init(config.number_of_redundancy_channels)).Times(1);
+  EXPECT_CALL(redrbf_mock, redrbf_Init(config.number_of_redundancy_channels)).Times(1);
+  EXPECT_CALL(reddfq_mock, reddfq_Init(config.number_of_redundancy_channels, config.n_defer_queue_size, config.t_seq)).Times(1);
+
+  // simulate the transport channels, the received buffer and the defer queue
+  EXPECT_CALL(redstm_mock, redstm_GetChannelState(red_channel_id)).WillRepeatedly(Return(redstm_kRedundancyChannelStateUp));
+  EXPECT_CALL(redrbf_mock, redrbf_GetFreeBufferEntries(red_channel_id)).WillRepeatedly(Invoke([this](const uint32_t) { return free_bfr_entries; }));
+  EXPECT_CALL(reddfq_mock, reddfq_GetUsedEntries(red_channel_id)).WillRepeatedly(Invoke([this](const uint32_t) { return used_dfq_entries; }));
+  EXPECT_CALL(redcor_mock, redcor_GetMessagePendingFlag(red_channel_id, _))
+      .WillRepeatedly(Invoke([this](const uint32_t, const uint32_t tr_channel_id) { return tr_channel_pending[tr_channel_id]; }));
+  EXPECT_CALL(redcor_mock, redcor_ClearMessagePendingFlag(red_channel_id, _))
+      .WillRepeatedly(Invoke([this](const uint32_t, const uint32_t tr_channel_id) { tr_channel_pending[tr_channel_id] = false; }));
+  EXPECT_CALL(redtri_mock, redtri_ReadMessage(&test_instance, _, _, _, _)).WillRepeatedly(Invoke(this, &ReceivedMessagesPollingTestWithParam::ReadMessage));
+  EXPECT_CALL(redmsg_mock, redmsg_CheckMessageCrcBatch(_, test_instance.polling_messages, _))
+      .WillRepeatedly(Invoke([](const uint16_t number_of_messages, const redtyp_RedundancyMessage *, radef_RaStaReturnCode *return_codes) {
+        std::fill(return_codes, return_codes + number_of_messages, radef_kNoError);
+      }));
+  EXPECT_CALL(redcor_mock, redcor_WriteCheckedMessageToInputBuffer(red_channel_id, _, true, _))
+      .WillRepeatedly(Invoke(this, &ReceivedMessagesPollingTestWithParam::WriteCheckedMessageToInputBuffer));
+  EXPECT_CALL(redstm_mock, redstm_ProcessChannelStateMachine(red_channel_id, redstm_kRedundancyChannelEventReceiveData)).Times(expected_read_messages);
+  EXPECT_CALL(redcor_mock, redcor_ClearInputBufferMessagePendingFlag(red_channel_id)).Times(expected_read_messages);
+  EXPECT_CALL(reddfq_mock, reddfq_GetExpiredChannel(_)).WillOnce(Return(false));
+
+  // init module
+  redint_Init(&config, &instance);
+
+  // perform test
+  EXPECT_EQ(radef_kNoError, redint_CheckTimings(&test_instance));
+
+  // verify the read messages and their processing order
+  EXPECT_EQ(expected_read_messages, read_tr_channel_ids.size());
+  EXPECT_EQ(read_tr_channel_ids, written_tr_channel_ids);
+  ASSERT_EQ(expected_read_messages, written_message_indices.size());
+  for (uint8_t message_index = 0U; message_index < expected_read_messages; message_index++)
+  {
+    EXPECT_EQ(message_index, written_message_indices[message_index]);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  verifyReceivedMessagesPolling,
+  ReceivedMessagesPollingTestWithParam,
+  ::testing::Values(
+    std::make_tuple(0U, 0U, "i", 0U),
+    std::make_tuple(2U, 0U, "iiiiii", 2U),
+    std::make_tuple(6U, 0U, "iiiiiiii", 6U),
+    std::make_tuple(5U, 2U, "oooooo", 3U),
+    std::make_tuple(4U, 0U, "ooiooi", 4U),
+    std::make_tuple(20U, 0U, "oioooi", 6U),
+    std::make_tuple(2U, 0U, "ididdidi", 3U),
+    std::make_tuple(3U, 1U, "dddddd", 6U),
+    std::make_tuple(3U, 0U, "ododoi", 5U)
+  )
+);
+
+/**
+ * @test        @ID{redintTest011} Verify the GetNextDeadline function.
+ *
+ * @details     This test verifies the GetNextDeadline function
+ *
+ * Test steps:
+ * - init module with default config
+ * - set the defer queue module to return a running defer timer and verify that its time to the next deadline is returned
+ * - set the defer queue module to return no running defer timer and verify that UINT32_MAX is returned
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redintTest, redintTest011VerifyGetNextDeadline)
+{
+  // test variables
+  const uint32_t expected_time_to_next_deadline = 42U;  // time to next deadline returned by the defer queue module
+  uint32_t time_to_next_deadline = 0U;
+
+  // Set init call expectations
+  EXPECT_CALL(redcor_mock, redcor_IsConfigurationValid(&default_config)).WillOnce(Return(true));
+  EXPECT_CALL(redcor_mock, redcor_Init(&default_config)).Times(1);
+  EXPECT_CALL(redstm_mock, redstm_Init(default_config.number_of_redundancy_channels)).Times(1);
+  EXPECT_CALL(redrbf_mock, redrbf_Init(default_config.number_of_redundancy_channels)).Times(1);
+  EXPECT_CALL(reddfq_mock, reddfq_Init(default_config.number_of_redundancy_channels, default_config.n_defer_queue_size, default_config.t_seq)).Times(1);
+
+  // init module
+  redint_Init(&default_config, &instance);
+
+  // running defer timer
+  EXPECT_CALL(reddfq_mock, reddfq_GetTimeToNextDeadline(_)).WillOnce(DoAll(SetArgPointee<0>(expected_time_to_next_deadline), Return(true)));
+  EXPECT_EQ(radef_kNoError, redint_GetNextDeadline(&test_instance, &time_to_next_deadline));
+  EXPECT_EQ(expected_time_to_next_deadline, time_to_next_deadline);
+
+  // no running defer timer
+  EXPECT_CALL(reddfq_mock, reddfq_GetTimeToNextDeadline(_)).WillOnce(Return(false));
+  EXPECT_EQ(radef_kNoError, redint_GetNextDeadline(&test_instance, &time_to_next_deadline));
+  EXPECT_EQ(UINT32_MAX, time_to_next_deadline);
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
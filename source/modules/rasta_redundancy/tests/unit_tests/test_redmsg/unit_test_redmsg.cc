@@ -213,14 +213,14 @@ TEST_P(InitTestWithParam, redmsgTest001VerifyInitFunction)
   else
   {
     // Expect mock call to init redcrc where checkcode gets set
-    EXPECT_CALL(redcrc_mock, redcrc_Init(_)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
+    EXPECT_CALL(redcrc_mock, redcrc_Init(_, _)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
 
     // call the init function and verify if parameter are set correctly
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
     EXPECT_NO_THROW(redmsg_Init(configured_checkcode_type));
 
-    EXPECT_EQ(redmsg_check_code_type, configured_checkcode_type);
-    EXPECT_TRUE(redmsg_initialized);
+    EXPECT_EQ(redmsg_instance->check_code_type, configured_checkcode_type);
+    EXPECT_TRUE(redmsg_instance->initialized);
   }
 }
 
@@ -261,8 +261,8 @@ TEST_F(redmsgTest, redmsgTest002VerifyInitFunctionCalls)
   // expect fatal error function
   EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kAlreadyInitialized)).WillOnce(Invoke(this, &redmsgTest::invalidArgumentException));
 
-  // expect crc init call on first init
-  EXPECT_CALL(redcrc_mock, redcrc_Init(check_code)).Times(1);
+  // expect crc init call with the engine of the module on first init
+  EXPECT_CALL(redcrc_mock, redcrc_Init(&redmsg_instance->crc_engine, check_code)).Times(1);
 
   // call the init function and verify that it completes successful
   EXPECT_NO_THROW(redmsg_Init(check_code));
@@ -299,7 +299,7 @@ TEST_F(redmsgTest, redmsgTest003VerifyNullPointerCheck)
   const uint8_t nbr_of_function_calls = 6U;        // number of function calls
 
   // Expect mock call to init redcrc where checkcode gets set
-  EXPECT_CALL(redcrc_mock, redcrc_Init(_)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
+  EXPECT_CALL(redcrc_mock, redcrc_Init(_, _)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
 
   EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(nbr_of_function_calls)
     .WillRepeatedly(Invoke(this, &redmsgTest::invalidArgumentException));
@@ -344,8 +344,7 @@ TEST_F(redmsgTest, redmsgTest003VerifyNullPointerCheck)
 TEST_F(redmsgTest, redmsgTest004VerifyInitializationCheck)
 {
   const uint8_t nbr_of_function_calls = 4U;        // number of function calls
-  extern bool redmsg_initialized;
-  redmsg_initialized = false;
+  redmsg_instance->initialized = false;
 
   // set test variables
   const uint32_t sequence_number = 0U;
@@ -429,7 +428,7 @@ TEST_P(CreateMsgWithParam, redmsgTest005VerifyCreateMessage)
   }
 
   // Expect mock call to init redcrc where checkcode gets set
-  EXPECT_CALL(redcrc_mock, redcrc_Init(_)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
+  EXPECT_CALL(redcrc_mock, redcrc_Init(_, _)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
 
   // init the module
   redmsg_Init(check_code_type);
@@ -455,11 +454,11 @@ TEST_P(CreateMsgWithParam, redmsgTest005VerifyCreateMessage)
         check_code_type != redcty_kCheckCodeMin &&
         check_code_type != redcty_kCheckCodeMax)
     {
-      EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc(message_size_no_crc, _, _)).Times(1);
+      EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc(&redmsg_instance->crc_engine, message_size_no_crc, _, _)).Times(1);
     }
     else
     {
-      EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc(_, _, _)).Times(0);
+      EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc(_, _, _, _)).Times(0);
     }
 
     // set expectations
@@ -573,7 +572,7 @@ TEST_P(CheckMsgCrcWithParam, redmsgTest006VerifyCheckMsgCrc)
   setDataInBuffer_u16(&message.message, expected_message_size, expected_message_length_pos);
 
   // Expect mock call to init redcrc where checkcode gets set
-  EXPECT_CALL(redcrc_mock, redcrc_Init(_)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
+  EXPECT_CALL(redcrc_mock, redcrc_Init(_, _)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
 
   // init the module
   redmsg_Init(check_code_type);
@@ -605,16 +604,16 @@ TEST_P(CheckMsgCrcWithParam, redmsgTest006VerifyCheckMsgCrc)
     {
       if (!expect_correct_crc)
       {
-        EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc((message.message_size - crc_length), _, _)).Times(1).WillOnce(SetArgPointee<2>(wrong_message_crc));
+        EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc(&redmsg_instance->crc_engine, (message.message_size - crc_length), _, _)).Times(1).WillOnce(SetArgPointee<3>(wrong_message_crc));
       }
       else
       {
-        EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc((message.message_size - crc_length), _, _)).Times(1).WillOnce(SetArgPointee<2>(message_crc));
+        EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc(&redmsg_instance->crc_engine, (message.message_size - crc_length), _, _)).Times(1).WillOnce(SetArgPointee<3>(message_crc));
       }
     }
     else
     {
-      EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc(_, _, _)).Times(0);
+      EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc(_, _, _, _)).Times(0);
     }
 
     // set expectations
@@ -701,7 +700,7 @@ TEST_P(getMsgSequenceNumber, redmsgTest007VerifyGetMsgSeq)
   }
 
   // Expect mock call to init redcrc where checkcode gets set
-  EXPECT_CALL(redcrc_mock, redcrc_Init(_)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
+  EXPECT_CALL(redcrc_mock, redcrc_Init(_, _)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
 
   // init the module
   redmsg_Init(redcty_kCheckCodeA);
@@ -805,7 +804,7 @@ TEST_P(getMsgPayload, redmsgTest008VerifyGetMsgPayload)
   }
 
   // Expect mock call to init redcrc where checkcode gets set
-  EXPECT_CALL(redcrc_mock, redcrc_Init(_)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
+  EXPECT_CALL(redcrc_mock, redcrc_Init(_, _)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
 
   // init the module
   redmsg_Init(check_code_type);
@@ -846,6 +845,186 @@ INSTANTIATE_TEST_SUITE_P(
   )
 );
 
+/**
+ * @test        @ID{redmsgTest009} Verify the input parameter check of the checkMessageCrcBatch function
+ *
+ * @details     This test verifies that the fatal error function is executed whenever the checkMessageCrcBatch function
+ *              is called without proper initialization of the module or with invalid parameters.
+ *
+ * Test steps:
+ * - call the CheckMessageCrcBatch function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - init module
+ * - call the CheckMessageCrcBatch function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the CheckMessageCrcBatch function with invalid return code pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the CheckMessageCrcBatch function with zero messages and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the CheckMessageCrcBatch function with a message with too small message size and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the CheckMessageCrcBatch function with a message with a message size not matching the stored message length and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - verify that no CRC is calculated
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redmsgTest, redmsgTest009VerifyCheckMsgCrcBatchParameterCheck)
+{
+  const uint16_t nbr_of_messages = 2U;             // number of messages
+  const uint8_t nbr_of_function_calls = 5U;        // number of function calls
+  const uint16_t message_size = UT_REDMSG_MESSAGE_LEN_MIN + UT_REDMSG_CHECK_CODE_MAX_LEN;
+
+  // set test variables
+  redtyp_RedundancyMessage messages[nbr_of_messages] = {};
+  radef_RaStaReturnCode return_codes[nbr_of_messages] = {};
+
+  for (uint16_t i = 0U; i < nbr_of_messages; i++)
+  {
+    messages[i].message_size = message_size;
+    setDataInBuffer_u16(&messages[i].message, message_size, expected_message_length_pos);
+  }
+
+  // set expectations
+  EXPECT_CALL(redcrc_mock, redcrc_Init(_, _)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
+  EXPECT_CALL(redcrc_mock, redcrc_CalculateCrcBatch(_, _, _)).Times(0);
+  EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kNotInitialized)).WillOnce(Invoke(this, &redmsgTest::invalidArgumentException));
+  EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter))
+    .Times(nbr_of_function_calls)
+    .WillRepeatedly(Invoke(this, &redmsgTest::invalidArgumentException));
+
+  // perform test
+  EXPECT_THROW(redmsg_CheckMessageCrcBatch(nbr_of_messages, messages, return_codes), std::invalid_argument);
+
+  // init module
+  redmsg_Init(redcty_kCheckCodeB);
+
+  EXPECT_THROW(redmsg_CheckMessageCrcBatch(nbr_of_messages, (redtyp_RedundancyMessage *)NULL, return_codes), std::invalid_argument);
+  EXPECT_THROW(redmsg_CheckMessageCrcBatch(nbr_of_messages, messages, (radef_RaStaReturnCode *)NULL), std::invalid_argument);
+  EXPECT_THROW(redmsg_CheckMessageCrcBatch(0U, messages, return_codes), std::invalid_argument);
+
+  messages[1].message_size = UT_REDMSG_MESSAGE_LEN_MIN - 1U;
+  EXPECT_THROW(redmsg_CheckMessageCrcBatch(nbr_of_messages, messages, return_codes), std::invalid_argument);
+
+  messages[1].message_size = message_size + 1U;
+  EXPECT_THROW(redmsg_CheckMessageCrcBatch(nbr_of_messages, messages, return_codes), std::invalid_argument);
+}
+
+/**
+ * @test        @ID{redmsgTest010} Verify the checkMessageCrcBatch function
+ *
+ * @details     This test verifies that the checkMessageCrcBatch function calculates the check codes of several messages
+ *              with the redcrc_CalculateCrcBatch function and returns the same result per message as the checkMessageCrc function.
+ *
+ * Test steps:
+ * - for every check code type
+ *   - initialize the module
+ *   - setup messages with different payload sizes, every third message with a wrong check code
+ *   - expect the CRCs of the messages without check code to be calculated in batches of at most 8 messages
+ *   - call the CheckMessageCrcBatch function
+ *   - verify the return code of every message and compare it with the return code of the CheckMessageCrc function
+ *   .
+ * - for check code type A, verify that no CRC is calculated and that all messages are valid
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redmsgTest, redmsgTest010VerifyCheckMsgCrcBatch)
+{
+  const uint16_t nbr_of_messages = 10U;            // number of messages, not a multiple of the batch size
+  const uint16_t crc_batch_size = 8U;              // maximum number of messages per CRC batch
+  const uint32_t crc_offset = 1000U;               // calculated CRC is the size of the data without check code plus this offset
+  const redcty_CheckCodeType check_code_types[] = {redcty_kCheckCodeA, redcty_kCheckCodeB, redcty_kCheckCodeC, redcty_kCheckCodeD, redcty_kCheckCodeE};
+
+  for (const redcty_CheckCodeType check_code_type : check_code_types)
+  {
+    uint16_t crc_length = UT_REDMSG_CHECK_CODE_NONE_LEN;
+    switch (check_code_type)
+    {
+      case redcty_kCheckCodeB:
+      case redcty_kCheckCodeC:
+        crc_length = UT_REDMSG_CHECK_CODE_MAX_LEN;
+        break;
+      case redcty_kCheckCodeD:
+      case redcty_kCheckCodeE:
+        crc_length = UT_REDMSG_CHECK_CODE_HALF_LEN;
+        break;
+      default:
+        break;
+    }
+
+    // test variables
+    redtyp_RedundancyMessage messages[nbr_of_messages] = {};
+    radef_RaStaReturnCode return_codes[nbr_of_messages] = {};
+
+    // Expect mock call to init redcrc where checkcode gets set
+    redmsg_instance->initialized = false;
+    EXPECT_CALL(redcrc_mock, redcrc_Init(_, _)).WillOnce(Invoke(this, &redmsgTest::crc_Init));
+    redmsg_Init(check_code_type);
+
+    for (uint16_t i = 0U; i < nbr_of_messages; i++)
+    {
+      const uint16_t payload_size = UT_REDMSG_DATA_LEN_MIN + (i * 97U);
+      const uint16_t data_size = UT_REDMSG_HEADER_SIZE + payload_size;
+      const uint32_t message_crc = ((i % 3U) == 2U) ? (data_size + crc_offset + 1U) : (data_size + crc_offset);
+
+      messages[i].message_size = data_size + crc_length;
+      setDataInBuffer_u16(&messages[i].message, messages[i].message_size, expected_message_length_pos);
+      if (crc_length == UT_REDMSG_CHECK_CODE_MAX_LEN)
+      {
+        setDataInBuffer_u32(&messages[i].message, message_crc, data_size);
+      }
+      else if (crc_length == UT_REDMSG_CHECK_CODE_HALF_LEN)
+      {
+        setDataInBuffer_u16(&messages[i].message, (uint16_t)message_crc, data_size);
+      }
+    }
+
+    // set mock expectations
+    auto calculate_crcs = [crc_offset](const redcrc_CrcEngine * crc_engine, const uint16_t number_of_entries, const redcrc_CrcBatchEntry * entries)
+    {
+      for (uint16_t i = 0U; i < number_of_entries; i++)
+      {
+        *entries[i].calculated_crc = entries[i].data_size + crc_offset;
+      }
+    };
+    auto calculate_crc = [crc_offset](const redcrc_CrcEngine * crc_engine, const uint16_t data_size, const uint8_t * data_buffer, uint32_t * calculated_crc)
+    {
+      *calculated_crc = data_size + crc_offset;
+    };
+
+    if (check_code_type != redcty_kCheckCodeA)
+    {
+      InSequence s;
+      EXPECT_CALL(redcrc_mock, redcrc_CalculateCrcBatch(&redmsg_instance->crc_engine, crc_batch_size, _)).WillOnce(Invoke(calculate_crcs));
+      EXPECT_CALL(redcrc_mock, redcrc_CalculateCrcBatch(&redmsg_instance->crc_engine, (nbr_of_messages - crc_batch_size), _)).WillOnce(Invoke(calculate_crcs));
+      EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc(&redmsg_instance->crc_engine, _, _, _)).Times(nbr_of_messages).WillRepeatedly(Invoke(calculate_crc));
+    }
+    else
+    {
+      EXPECT_CALL(redcrc_mock, redcrc_CalculateCrcBatch(_, _, _)).Times(0);
+      EXPECT_CALL(redcrc_mock, redcrc_CalculateCrc(_, _, _, _)).Times(0);
+    }
+    EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+    // call the function and verify the output
+    redmsg_CheckMessageCrcBatch(nbr_of_messages, messages, return_codes);
+
+    for (uint16_t i = 0U; i < nbr_of_messages; i++)
+    {
+      const radef_RaStaReturnCode expected_return_code =
+          ((check_code_type != redcty_kCheckCodeA) && ((i % 3U) == 2U)) ? radef_kInvalidMessageCrc : radef_kNoError;
+      EXPECT_EQ(expected_return_code, return_codes[i]) << "check code type: " << check_code_type << ", message: " << i;
+      EXPECT_EQ(redmsg_CheckMessageCrc(&messages[i]), return_codes[i]) << "check code type: " << check_code_type << ", message: " << i;
+    }
+  }
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -55,8 +55,7 @@ using testing::Invoke;
 // -----------------------------------------------------------------------------
 
 extern uint8_t test_red_payload_data_u8[UT_REDMSG_DATA_LEN_MAX];
-extern bool redmsg_initialized;                                                 ///< initialization state (local variable)
-extern redcty_CheckCodeType redmsg_check_code_type;                             ///< configured checkcode type
+extern RADEF_THREAD_LOCAL redmsg_InstanceData *redmsg_instance;                 ///< data of the selected messages module instance
 
 // -----------------------------------------------------------------------------
 // Test class definiton
@@ -71,7 +70,7 @@ class redmsgTest : public ::testing::Test
 public:
   redmsgTest() {
     // reset initialization state
-    redmsg_initialized = false;
+    redmsg_instance->initialized = false;
   }
   ~redmsgTest() {
   }
@@ -84,9 +83,9 @@ public:
     * @brief Set crc check code type
     * This function sets the given checkcode type
     */
-  void crc_Init(const redcty_CheckCodeType configured_check_code_type)
+  void crc_Init(redcrc_CrcEngine * crc_engine, const redcty_CheckCodeType configured_check_code_type)
   {
-    redmsg_check_code_type = configured_check_code_type;
+    redmsg_instance->check_code_type = configured_check_code_type;
   }
 
   /**
@@ -198,7 +198,6 @@ class GetFreeBufferEntriesTestWithParam :   public redrbfTest,
  */
 TEST_P(InitTestWithParam, redrbfTest001VerifyInitFunction)
 {
-  extern uint32_t redrbf_number_of_red_channels;
 
   if (expect_fatal_error)
   {
@@ -212,8 +211,8 @@ TEST_P(InitTestWithParam, redrbfTest001VerifyInitFunction)
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
     EXPECT_NO_THROW(redrbf_Init(configured_channels));
 
-    EXPECT_EQ(redrbf_number_of_red_channels, configured_channels);
-    EXPECT_TRUE(redrbf_initialized);
+    EXPECT_EQ(redrbf_instance->number_of_red_channels, configured_channels);
+    EXPECT_TRUE(redrbf_instance->initialized);
   }
 }
 
@@ -279,7 +278,7 @@ TEST_P(InitBufferTestWithParam, redrbfTest002VerifyInitBufferFunction)
   else
   {
     // add a message to the buffer to increment buffer size
-    EXPECT_CALL(rednot_mock, rednot_MessageReceivedNotification(channel_id)).Times(1);
+    EXPECT_CALL(rednot_mock, rednot_MessageReceivedNotification(&test_instance, channel_id)).Times(1);
 
     // Expect no error to be thrown
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
@@ -432,7 +431,7 @@ TEST_P(AddToBufferTestWithParam, redrbfTest004VerifyAddToBufferFunction)
   }
   else
   {
-    redrbf_initialized = true;
+    redrbf_instance->initialized = true;
   }
 
   if (error != radef_kNoError)
@@ -447,7 +446,7 @@ TEST_P(AddToBufferTestWithParam, redrbfTest004VerifyAddToBufferFunction)
     EXPECT_EQ((UT_REDRBF_N_SEND_MAX - exp_buffer_length + 1), redrbf_GetFreeBufferEntries(channel_id));
 
     // expect the message received notification to be sent and no error thrown
-    EXPECT_CALL(rednot_mock, rednot_MessageReceivedNotification(channel_id)).Times(1);
+    EXPECT_CALL(rednot_mock, rednot_MessageReceivedNotification(&test_instance, channel_id)).Times(1);
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
 
     // call the AddToBuffer function
@@ -559,7 +558,6 @@ INSTANTIATE_TEST_SUITE_P(
  */
 TEST_P(ReadFromBufferTestWithParam, redrbfTest005VerifyReadFromBufferFunction)
 {
-  extern uint32_t redrbf_number_of_red_channels;
 
   // redtyp_RedundancyMessagePayload read_payload = {0U, {}};                                      // payload read from the buffer
   uint32_t expected_free_buffer_entries_before_read = RADEF_MAX_N_SEND_MAX - messages_to_add;      // expected free entries in buffer before reading messages
@@ -595,8 +593,8 @@ TEST_P(ReadFromBufferTestWithParam, redrbfTest005VerifyReadFromBufferFunction)
   redrbf_Init(UT_REDRBF_MAX_NUM_OF_RED_CHANNELS);
 
   // verify initialization
-  EXPECT_EQ(redrbf_initialized, true);
-  EXPECT_EQ(redrbf_number_of_red_channels, UT_REDRBF_MAX_NUM_OF_RED_CHANNELS);
+  EXPECT_EQ(redrbf_instance->initialized, true);
+  EXPECT_EQ(redrbf_instance->number_of_red_channels, UT_REDRBF_MAX_NUM_OF_RED_CHANNELS);
 
   if (exp_retval == radef_kInvalidParameter)
   {
@@ -609,7 +607,7 @@ TEST_P(ReadFromBufferTestWithParam, redrbfTest005VerifyReadFromBufferFunction)
     for (uint16_t i = 0U; i < messages_to_add; i++)
     {
       // add a message to the buffer
-      EXPECT_CALL(rednot_mock, rednot_MessageReceivedNotification(channel_id)).Times(1);
+      EXPECT_CALL(rednot_mock, rednot_MessageReceivedNotification(&test_instance, channel_id)).Times(1);
       redrbf_AddToBuffer(channel_id, &payload);
     }
 
@@ -716,7 +714,7 @@ TEST_P(GetFreeBufferEntriesTestWithParam, redrbfTest006VerifyGetFreeBufferEntrie
     for(uint16_t i = 0U; i < messages_to_add; i++)
     {
       // add a message to the buffer
-      EXPECT_CALL(rednot_mock, rednot_MessageReceivedNotification(channel_id)).Times(1);
+      EXPECT_CALL(rednot_mock, rednot_MessageReceivedNotification(&test_instance, channel_id)).Times(1);
       redrbf_AddToBuffer(channel_id, &payload);
     }
 
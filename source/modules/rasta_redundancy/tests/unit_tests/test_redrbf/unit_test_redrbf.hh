@@ -28,11 +28,13 @@
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasys_mock.hh"
 #include "test_helper.hh"
+#include "redins_mock.hh"
 #include "rednot_mock.hh"
 
 using testing::NaggyMock;
 using testing::StrictMock;
 using testing::_;
+using testing::Return;
 
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
@@ -56,7 +58,7 @@ using testing::_;
 
 extern uint8_t test_red_payload_data_u8[UT_REDRBF_DATA_LEN_MAX];
 
-extern bool redrbf_initialized;                            ///< initialization state (local variable)
+extern RADEF_THREAD_LOCAL redrbf_InstanceData *redrbf_instance;               ///< data of the selected received buffer module instance
 
 // -----------------------------------------------------------------------------
 // Global Const Declarations
@@ -80,7 +82,9 @@ public:
   redrbfTest()
   {
     // reset initialization state
-    redrbf_initialized = false;
+    redrbf_instance->initialized = false;
+    // the notifications are called with the selected RedL instance
+    EXPECT_CALL(redins_mock, redins_GetSelectedInstance()).WillRepeatedly(Return(&test_instance));
   }
   ~redrbfTest()
   {
@@ -95,7 +99,10 @@ public:
     throw std::invalid_argument("Invalid argument!");
   }
 
+  redint_Instance test_instance = {};      ///< RedL instance, which is passed to the notifications
+
   StrictMock<rasysMock>   rasys_mock;      ///< mock for the rasta system adapter class
+  NaggyMock<redinsMock>   redins_mock;     ///< mock for the redundancy instances class
   NaggyMock<rednotMock>   rednot_mock;     ///< mock for the redundancy notifications class
 };
 
@@ -0,0 +1,270 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_redrng.cc
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Unit test file for the transport ingress rings module of the redundancy layer.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "unit_test_redrng.hh"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Test Class Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Test Cases
+// -----------------------------------------------------------------------------
+
+/**
+ * @test        @ID{redrngTest001} Verify the message order of an ingress ring
+ *
+ * @details     This test verifies that the messages pushed into an ingress ring are read in the same order and with the same size and data.
+ *
+ * Test steps:
+ * - verify that an empty ring returns radef_kNoMessageReceived
+ * - push messages with different sizes on two transport channels
+ * - read the messages and verify the order, the size and the data of every message
+ * - verify that the rings are empty afterwards
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redrngTest, redrngTest001VerifyMessageOrder)
+{
+  const uint16_t message_sizes[] = {UT_REDRNG_MSG_LEN_MIN, 100U, UT_REDRNG_MSG_LEN_MAX};
+  uint8_t message_buffer[UT_REDRNG_MSG_LEN_MAX] = {};
+  uint16_t message_size = 0U;
+
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0U);
+
+  EXPECT_EQ(radef_kNoMessageReceived, redrng_ReadMessage(&test_instance, 0U, UT_REDRNG_MSG_LEN_MAX, &message_size, message_buffer));
+
+  for (uint32_t index = 0U; index < 3U; ++index) {
+    EXPECT_TRUE(redrng_PushMessage(&test_instance, 0U, message_sizes[index], &test_message_data[index]));
+    EXPECT_TRUE(redrng_PushMessage(&test_instance, UT_REDRNG_TR_CHANNEL_ID_MAX, message_sizes[2U - index], &test_message_data[2U - index]));
+  }
+
+  for (uint32_t index = 0U; index < 3U; ++index) {
+    EXPECT_EQ(radef_kNoError, redrng_ReadMessage(&test_instance, 0U, UT_REDRNG_MSG_LEN_MAX, &message_size, message_buffer));
+    EXPECT_EQ(message_size, message_sizes[index]);
+    EXPECT_EQ(0, memcmp(message_buffer, &test_message_data[index], message_size));
+
+    EXPECT_EQ(radef_kNoError, redrng_ReadMessage(&test_instance, UT_REDRNG_TR_CHANNEL_ID_MAX, UT_REDRNG_MSG_LEN_MAX, &message_size, message_buffer));
+    EXPECT_EQ(message_size, message_sizes[2U - index]);
+    EXPECT_EQ(0, memcmp(message_buffer, &test_message_data[2U - index], message_size));
+  }
+
+  EXPECT_EQ(radef_kNoMessageReceived, redrng_ReadMessage(&test_instance, 0U, UT_REDRNG_MSG_LEN_MAX, &message_size, message_buffer));
+  EXPECT_EQ(radef_kNoMessageReceived, redrng_ReadMessage(&test_instance, UT_REDRNG_TR_CHANNEL_ID_MAX, UT_REDRNG_MSG_LEN_MAX, &message_size, message_buffer));
+}
+
+/**
+ * @test        @ID{redrngTest002} Verify a full ingress ring
+ *
+ * @details     This test verifies that a full ingress ring rejects further messages and accepts them again after a message is read, also when the
+ *              ring indices wrap around the ring size. It also verifies that the rejected messages are counted as dropped messages of the transport
+ *              channel.
+ *
+ * Test steps:
+ * - repeat several times:
+ *   - fill the ring with RADEF_TRANSPORT_INGRESS_RING_SIZE messages and verify that no message is dropped
+ *   - push further messages, verify that they are rejected and that they are taken once as dropped messages of this transport channel only
+ *   - read one message and verify that a further push is accepted
+ *   - read all messages and verify that they are read in the pushed order
+ * - push a further message into the full ring, initialize the rings and verify that the dropped message is no longer counted
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redrngTest, redrngTest002VerifyFullRing)
+{
+  uint8_t message_buffer[UT_REDRNG_MSG_LEN_MAX] = {};
+  uint16_t message_size = 0U;
+
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0U);
+
+  for (uint32_t cycle = 0U; cycle < 3U; ++cycle) {
+    for (uint32_t index = 0U; index < RADEF_TRANSPORT_INGRESS_RING_SIZE; ++index) {
+      EXPECT_TRUE(redrng_PushMessage(&test_instance, 1U, UT_REDRNG_MSG_LEN_MIN, &test_message_data[index]));
+    }
+    EXPECT_EQ(0U, redrng_TakeDroppedMessages(&test_instance, 1U));
+    for (uint32_t dropped = 0U; dropped <= cycle; ++dropped) {
+      EXPECT_FALSE(redrng_PushMessage(&test_instance, 1U, UT_REDRNG_MSG_LEN_MIN, &test_message_data[RADEF_TRANSPORT_INGRESS_RING_SIZE]));
+    }
+    EXPECT_EQ(0U, redrng_TakeDroppedMessages(&test_instance, 0U));
+    EXPECT_EQ(cycle + 1U, redrng_TakeDroppedMessages(&test_instance, 1U));
+    EXPECT_EQ(0U, redrng_TakeDroppedMessages(&test_instance, 1U));
+
+    EXPECT_EQ(radef_kNoError, redrng_ReadMessage(&test_instance, 1U, UT_REDRNG_MSG_LEN_MAX, &message_size, message_buffer));
+    EXPECT_EQ(0, memcmp(message_buffer, &test_message_data[0U], message_size));
+    EXPECT_TRUE(redrng_PushMessage(&test_instance, 1U, UT_REDRNG_MSG_LEN_MIN, &test_message_data[RADEF_TRANSPORT_INGRESS_RING_SIZE]));
+
+    for (uint32_t index = 1U; index <= RADEF_TRANSPORT_INGRESS_RING_SIZE; ++index) {
+      EXPECT_EQ(radef_kNoError, redrng_ReadMessage(&test_instance, 1U, UT_REDRNG_MSG_LEN_MAX, &message_size, message_buffer));
+      EXPECT_EQ(message_size, UT_REDRNG_MSG_LEN_MIN);
+      EXPECT_EQ(0, memcmp(message_buffer, &test_message_data[index], message_size));
+    }
+    EXPECT_EQ(radef_kNoMessageReceived, redrng_ReadMessage(&test_instance, 1U, UT_REDRNG_MSG_LEN_MAX, &message_size, message_buffer));
+  }
+
+  for (uint32_t index = 0U; index <= RADEF_TRANSPORT_INGRESS_RING_SIZE; ++index) {
+    (void)redrng_PushMessage(&test_instance, 1U, UT_REDRNG_MSG_LEN_MIN, &test_message_data[index]);
+  }
+  redrng_Init(&test_instance);
+  EXPECT_EQ(0U, redrng_TakeDroppedMessages(&test_instance, 1U));
+}
+
+/**
+ * @test        @ID{redrngTest003} Verify the take over of the pending transport channels
+ *
+ * @details     This test verifies that the transport channels with pushed messages are taken over into the message pending flags of the core
+ *              module exactly once.
+ *
+ * Test steps:
+ * - push messages on the first and the last transport channel
+ * - take the pending transport channels and verify that the message pending flag is set for both transport channels
+ * - take the pending transport channels again and verify that no message pending flag is set
+ * - fill the ring of a transport channel, push a further message and verify that the transport channel is taken over also for the rejected message
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redrngTest, redrngTest003VerifyTakePendingTransportChannels)
+{
+  EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0U);
+
+  EXPECT_TRUE(redrng_PushMessage(&test_instance, UT_REDRNG_TR_CHANNEL_ID_MAX, UT_REDRNG_MSG_LEN_MIN, test_message_data));
+  EXPECT_TRUE(redrng_PushMessage(&test_instance, 0U, UT_REDRNG_MSG_LEN_MIN, test_message_data));
+  EXPECT_TRUE(redrng_PushMessage(&test_instance, 0U, UT_REDRNG_MSG_LEN_MIN, test_message_data));
+
+  {
+    InSequence s;
+    EXPECT_CALL(redcor_mock, redcor_GetAssociatedRedundancyChannel(0U, _)).WillOnce(SetArgPointee<1>(0U));
+    EXPECT_CALL(redcor_mock, redcor_SetMessagePendingFlag(0U, 0U)).Times(1U);
+    EXPECT_CALL(redcor_mock, redcor_GetAssociatedRedundancyChannel(UT_REDRNG_TR_CHANNEL_ID_MAX, _))
+        .WillOnce(SetArgPointee<1>(RADEF_MAX_NUMBER_OF_RED_CHANNELS - 1U));
+    EXPECT_CALL(redcor_mock, redcor_SetMessagePendingFlag(RADEF_MAX_NUMBER_OF_RED_CHANNELS - 1U, UT_REDRNG_TR_CHANNEL_ID_MAX)).Times(1U);
+  }
+  redrng_TakePendingTransportChannels(&test_instance);
+  testing::Mock::VerifyAndClearExpectations(&redcor_mock);
+
+  EXPECT_CALL(redcor_mock, redcor_GetAssociatedRedundancyChannel(_, _)).Times(0U);
+  EXPECT_CALL(redcor_mock, redcor_SetMessagePendingFlag(_, _)).Times(0U);
+  redrng_TakePendingTransportChannels(&test_instance);
+  testing::Mock::VerifyAndClearExpectations(&redcor_mock);
+
+  for (uint32_t index = 0U; index < RADEF_TRANSPORT_INGRESS_RING_SIZE; ++index) {
+    EXPECT_TRUE(redrng_PushMessage(&test_instance, 1U, UT_REDRNG_MSG_LEN_MIN, test_message_data));
+  }
+  EXPECT_CALL(redcor_mock, redcor_GetAssociatedRedundancyChannel(1U, _)).WillOnce(SetArgPointee<1>(0U));
+  EXPECT_CALL(redcor_mock, redcor_SetMessagePendingFlag(0U, 1U)).Times(1U);
+  redrng_TakePendingTransportChannels(&test_instance);
+  testing::Mock::VerifyAndClearExpectations(&redcor_mock);
+
+  EXPECT_FALSE(redrng_PushMessage(&test_instance, 1U, UT_REDRNG_MSG_LEN_MIN, test_message_data));
+  EXPECT_CALL(redcor_mock, redcor_GetAssociatedRedundancyChannel(1U, _)).WillOnce(SetArgPointee<1>(0U));
+  EXPECT_CALL(redcor_mock, redcor_SetMessagePendingFlag(0U, 1U)).Times(1U);
+  redrng_TakePendingTransportChannels(&test_instance);
+}
+
+/**
+ * @test        @ID{redrngTest004} Verify the parameter checks
+ *
+ * @details     This test verifies that the fatal error function is executed whenever a function is called with an invalid parameter.
+ *
+ * Test steps:
+ * - call the functions with a null pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the functions with an invalid transport channel id and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the push function with an invalid message size and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the read function with a too small buffer and verify that a fatal error with error code radef_kInvalidBufferSize gets thrown
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redrngTest, redrngTest004VerifyParameterChecks)
+{
+  uint8_t message_buffer[UT_REDRNG_MSG_LEN_MAX] = {};
+  uint16_t message_size = 0U;
+
+  EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(12U).WillRepeatedly(Invoke(this, &redrngTest::invalidArgumentException));
+
+  EXPECT_THROW(redrng_Init(nullptr), std::invalid_argument);
+  EXPECT_THROW(redrng_TakePendingTransportChannels(nullptr), std::invalid_argument);
+
+  EXPECT_THROW(redrng_PushMessage(nullptr, 0U, UT_REDRNG_MSG_LEN_MIN, test_message_data), std::invalid_argument);
+  EXPECT_THROW(redrng_PushMessage(&test_instance, UT_REDRNG_TR_CHANNEL_ID_MAX + 1U, UT_REDRNG_MSG_LEN_MIN, test_message_data), std::invalid_argument);
+  EXPECT_THROW(redrng_PushMessage(&test_instance, 0U, UT_REDRNG_MSG_LEN_MIN - 1U, test_message_data), std::invalid_argument);
+  EXPECT_THROW(redrng_PushMessage(&test_instance, 0U, UT_REDRNG_MSG_LEN_MIN, nullptr), std::invalid_argument);
+
+  EXPECT_THROW(redrng_ReadMessage(nullptr, 0U, UT_REDRNG_MSG_LEN_MAX, &message_size, message_buffer), std::invalid_argument);
+  EXPECT_THROW(redrng_ReadMessage(&test_instance, UT_REDRNG_TR_CHANNEL_ID_MAX + 1U, UT_REDRNG_MSG_LEN_MAX, &message_size, message_buffer),
+               std::invalid_argument);
+  EXPECT_THROW(redrng_ReadMessage(&test_instance, 0U, UT_REDRNG_MSG_LEN_MAX, nullptr, message_buffer), std::invalid_argument);
+  EXPECT_THROW(redrng_ReadMessage(&test_instance, 0U, UT_REDRNG_MSG_LEN_MAX, &message_size, nullptr), std::invalid_argument);
+
+  EXPECT_THROW(redrng_TakeDroppedMessages(nullptr, 0U), std::invalid_argument);
+  EXPECT_THROW(redrng_TakeDroppedMessages(&test_instance, UT_REDRNG_TR_CHANNEL_ID_MAX + 1U), std::invalid_argument);
+
+  EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidBufferSize)).WillOnce(Invoke(this, &redrngTest::invalidArgumentException));
+  EXPECT_TRUE(redrng_PushMessage(&test_instance, 0U, 100U, test_message_data));
+  EXPECT_THROW(redrng_ReadMessage(&test_instance, 0U, 99U, &message_size, message_buffer), std::invalid_argument);
+}
@@ -0,0 +1,103 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_redrng.hh
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Header file for unit tests of the transport ingress rings module of the redundancy layer.
+ */
+
+#ifndef SOURCE_MODULES_RASTA_REDUNDANCY_TESTS_UNIT_TESTS_TEST_REDRNG_UNIT_TEST_REDRNG_HH_
+#define SOURCE_MODULES_RASTA_REDUNDANCY_TESTS_UNIT_TESTS_TEST_REDRNG_UNIT_TEST_REDRNG_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+// clang-format off
+#include <cstring>
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "src/redrng_red_ingress_rings.h"
+#include "src/redins_red_instances.h"
+#include "rasta_common/raas_rasta_assert.h"
+#include "rasys_mock.hh"
+#include "redcor_mock.hh"
+// clang-format on
+
+using testing::_;
+using testing::SetArgPointee;
+using testing::Invoke;
+using testing::InSequence;
+
+// -----------------------------------------------------------------------------
+// Global Macro Definitions
+// -----------------------------------------------------------------------------
+
+#define UT_REDRNG_MSG_LEN_MAX 1113U                                        ///< maximum value for message length
+#define UT_REDRNG_MSG_LEN_MIN 36U                                          ///< minimum value for message length
+#define UT_REDRNG_TR_CHANNEL_ID_MAX ((RADEF_MAX_NUMBER_OF_RED_CHANNELS * RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS) - 1U)  ///< maximum transport channel id
+
+// -----------------------------------------------------------------------------
+// Global Type Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Variable Declarations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Const Declarations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Prototypes
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Test Class Definition
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test fixture class for the transport ingress rings module
+ *
+ */
+class redrngTest : public ::testing::Test
+{
+public:
+  redrngTest()
+  {
+    test_instance.instance_index = 0U;
+    redrng_Init(&test_instance);
+
+    for (uint16_t index = 0U; index < UT_REDRNG_MSG_LEN_MAX; ++index) {
+      test_message_data[index] = (uint8_t)index;
+    }
+  }
+
+  ~redrngTest()
+  {
+
+  }
+
+  /**
+   * @brief Throw invalid argument exception
+   * This function is used to throw an invalid argument exception mocked function call action.
+   */
+  void invalidArgumentException(){
+    throw std::invalid_argument("Invalid argument!");
+  }
+
+  redint_Instance test_instance = {};                   ///< RedL instance used by the tests
+  uint8_t test_message_data[UT_REDRNG_MSG_LEN_MAX];     ///< message data pushed by the tests
+  rasysMock rasys_mock;                                 ///< mock for the rasta system adapter class
+  redcorMock redcor_mock;                               ///< mock for the redundancy core module class
+};
+
+#endif  // SOURCE_MODULES_RASTA_REDUNDANCY_TESTS_UNIT_TESTS_TEST_REDRNG_UNIT_TEST_REDRNG_HH_
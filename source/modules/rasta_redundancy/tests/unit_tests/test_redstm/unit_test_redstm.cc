@@ -174,7 +174,6 @@ class StateUpTestWithParam :   public redstmTest,
  */
 TEST_P(InitTestWithParam, redstmTest001VerifyInitFunction)
 {
-  extern uint32_t redstm_number_of_red_channels;
 
   // perform test
   if(expect_fatal_error)
@@ -189,8 +188,8 @@ TEST_P(InitTestWithParam, redstmTest001VerifyInitFunction)
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
     EXPECT_NO_THROW(redstm_Init(configured_channels));
 
-    EXPECT_EQ(redstm_number_of_red_channels, configured_channels);
-    EXPECT_TRUE(redstm_initialized);
+    EXPECT_EQ(redstm_instance->number_of_red_channels, configured_channels);
+    EXPECT_TRUE(redstm_instance->initialized);
   }
 }
 
@@ -516,8 +515,7 @@ INSTANTIATE_TEST_SUITE_P(
 
 void InitModuleAndSetState(uint32_t channel_id, redstm_RedundancyChannelStates state)
 {
-  extern redstm_RedundancyChannelStates redstm_redundancy_channel_states[RADEF_MAX_NUMBER_OF_RED_CHANNELS];
 
   redstm_Init(UT_REDSTM_MIN_NUMBER_OF_RED_CHANNELS);
-  redstm_redundancy_channel_states[channel_id] = state;
+  redstm_instance->redundancy_channel_states[channel_id] = state;
 }
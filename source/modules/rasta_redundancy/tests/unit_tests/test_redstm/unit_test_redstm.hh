@@ -52,7 +52,7 @@ using testing::SetArgPointee;
 // Global Variable Declarations
 // -----------------------------------------------------------------------------
 
-extern bool redstm_initialized;             ///< initialization state (local variable)
+extern RADEF_THREAD_LOCAL redstm_InstanceData *redstm_instance;  ///< data of the selected state machine module instance
 
 // -----------------------------------------------------------------------------
 // Global Const Declarations
@@ -76,7 +76,7 @@ public:
   redstmTest()
   {
     // reset initialization state
-    redstm_initialized = false;
+    redstm_instance->initialized = false;
   }
   ~redstmTest()
   {
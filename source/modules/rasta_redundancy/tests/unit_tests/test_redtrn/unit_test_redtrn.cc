@@ -91,6 +91,7 @@ class MessageReceivedNotificationTestWithParam :  public redtrnTest,
  *
  * Test steps:
  * - set expectations for function calls according to parameter when no error expected
+ *   - Select the passed instance
  *   - Set associated redundancy channel id
  *   - Set return value for state machine call
  *   - Call for core module clear message pending flag when no message received (given from parameter)
@@ -137,6 +138,9 @@ TEST_P(MessageReceivedNotificationTestWithParam, redtrnTest001VerifyMessageRecei
 {
   if(!expect_fatal_error)
   {
+    // the instance gets selected after the parameter check
+    EXPECT_CALL(redins_mock, redins_SelectInstance(&test_instance)).Times(1);
+
     // set associated redundancy channel to given parameter
     EXPECT_CALL(redcor_mock, redcor_GetAssociatedRedundancyChannel(transport_channel_id, _)).WillOnce(SetArgPointee<1>(associated_red_channel));
 
@@ -156,7 +160,7 @@ TEST_P(MessageReceivedNotificationTestWithParam, redtrnTest001VerifyMessageRecei
 
       if(free_buffer_entries > used_defer_queue_entries)
       {
-        EXPECT_CALL(redtri_mock, redtri_ReadMessage(transport_channel_id, _, _, _)).WillOnce(Return(read_message_function_call_result));
+        EXPECT_CALL(redtri_mock, redtri_ReadMessage(&test_instance, transport_channel_id, _, _, _)).WillOnce(Return(read_message_function_call_result));
 
         // if no error occurred while reading message, message gets written to input buffer, state machine gets updated and pending flag will be cleared
         if(read_message_function_call_result == radef_kNoError)
@@ -176,7 +180,7 @@ TEST_P(MessageReceivedNotificationTestWithParam, redtrnTest001VerifyMessageRecei
     else
     {
       // if the associated redundancy is not in the up state, the message is read and discarded.
-      EXPECT_CALL(redtri_mock, redtri_ReadMessage(transport_channel_id, _, _, _)).WillOnce(Return(read_message_function_call_result));
+      EXPECT_CALL(redtri_mock, redtri_ReadMessage(&test_instance, transport_channel_id, _, _, _)).WillOnce(Return(read_message_function_call_result));
     }
   }
 
@@ -185,13 +189,13 @@ TEST_P(MessageReceivedNotificationTestWithParam, redtrnTest001VerifyMessageRecei
   {
     // call the MessageReceivedNotification function and expect a fatal error
     EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &redtrnTest::invalidArgumentException));
-    EXPECT_THROW(redtrn_MessageReceivedNotification(transport_channel_id), std::invalid_argument);
+    EXPECT_THROW(redtrn_MessageReceivedNotification(&test_instance, transport_channel_id), std::invalid_argument);
   }
   else
   {
     // call the MessageReceivedNotification function and verify if parameter are set correctly
     EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
-    EXPECT_NO_THROW(redtrn_MessageReceivedNotification(transport_channel_id));
+    EXPECT_NO_THROW(redtrn_MessageReceivedNotification(&test_instance, transport_channel_id));
   }
 }
 
@@ -211,6 +215,30 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple((UT_REDTRN_TR_CHANNEL_ID_MAX + 1), UT_REDTRN_RED_CHANNEL_ID_MAX, redstm_kRedundancyChannelStateUp, UT_REDTRN_BFR_ENTRIES_MAX, UT_REDTRN_DFQ_ENTRIES_MIN, radef_kNoError, true)
   ));
 
+/**
+ * @test        @ID{redtrnTest002} Verify the instance check of the MessageReceivedNotification function.
+ *
+ * @details     This test verifies that the MessageReceivedNotification function throws a fatal error, if it is called with a NULL instance.
+ *
+ * Test steps:
+ * - Expect a radef_kInvalidParameter fatal error
+ * - Call the MessageReceivedNotification function with a NULL instance
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ */
+TEST_F(redtrnTest, redtrnTest002VerifyInstanceCheck)
+{
+  // call the MessageReceivedNotification function and expect a fatal error
+  EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &redtrnTest::invalidArgumentException));
+  EXPECT_THROW(redtrn_MessageReceivedNotification((redint_Instance *)NULL, UT_REDTRN_TR_CHANNEL_ID_MIN), std::invalid_argument);
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -30,6 +30,7 @@
 #include "rasys_mock.hh"
 #include "redcor_mock.hh"
 #include "reddfq_mock.hh"
+#include "redins_mock.hh"
 #include "redrbf_mock.hh"
 #include "redstm_mock.hh"
 #include "redtri_mock.hh"
@@ -83,7 +84,10 @@ public:
     throw std::invalid_argument("Invalid argument!");
   }
 
+  redint_Instance test_instance = {};     ///< RedL instance, which is passed to the notification function
+
   StrictMock<rasysMock> rasys_mock;       ///< mock for the rasta system adapter class
+  redinsMock redins_mock;                 ///< mock for the redundancy instances class
   redcorMock redcor_mock;                 ///< mock for the redundancy core class
   redrbfMock redrbf_mock;                 ///< mock for the redundancy received buffer class
   reddfqMock reddfq_mock;                 ///< mock for the redundancy defer queue class
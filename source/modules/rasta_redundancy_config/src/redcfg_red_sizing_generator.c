@@ -0,0 +1,143 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redcfg_red_sizing_generator.c
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Generator of the RaSTA redundancy layer sizing header.
+ *
+ * This host tool is built together with the redundancy layer configuration (redcfg_red_config.c) and writes the sizing header redcfg_red_sizing.h. The sizing
+ * header defines the build time dimensions of the redundancy layer storage with exactly the values needed by the configuration:
+ *
+ *   redcfg_red_sizing_generator <output file>
+ *
+ * The tool is compiled with the number of redundancy channels limited only by the uint16_t timer ids (65535), so that every configuration the stack can run
+ * with is read.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdio.h>
+
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_redundancy/redcty_red_config_types.h"
+#include "rasta_redundancy_config/redcfg_red_config.h"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+#ifdef RADEF_CONFIGURATION_SIZING
+#error "The sizing generator must not be built with the generated sizing"
+#endif
+
+// -----------------------------------------------------------------------------
+// Local Constant Definitions
+// -----------------------------------------------------------------------------
+
+static const uint32_t kSequenceNumberRangeCheckFactor = 10U;  ///< Factor for the sequence number range of the defer queue (see redcor_red_core.c)
+
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Return the smallest power of two, which is greater or equal than a value.
+ *
+ * @param [in] value Value. Valid range: 1 <= value <= 2^31.
+ * @return Smallest power of two >= value.
+ */
+static uint32_t NextPowerOfTwo(const uint32_t value);
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    (void)fprintf(stderr, "usage: %s <output file>\n", argv[0]);
+    return 1;
+  }
+
+  const redcty_RedundancyLayerConfiguration* const kConfiguration = &redundancy_layer_configuration;
+  if ((kConfiguration->number_of_redundancy_channels == 0U) || (kConfiguration->number_of_redundancy_channels > RADEF_MAX_NUMBER_OF_RED_CHANNELS) ||
+      (kConfiguration->n_defer_queue_size == 0U) || (kConfiguration->n_diagnosis == 0U)) {
+    (void)fprintf(stderr, "%s: invalid redundancy layer configuration\n", argv[0]);
+    return 1;
+  }
+
+  // The transport channel ids must be smaller than the number of redundancy channels times the number of transport channels per redundancy channel
+  uint32_t transport_channels = 1U;
+  uint32_t transport_channel_id_limit = 1U;
+  for (uint32_t red_channel_index = 0U; red_channel_index < kConfiguration->number_of_redundancy_channels; ++red_channel_index) {
+    const redcty_RedundancyChannelConfiguration* const kChannel = &kConfiguration->redundancy_channel_configurations[red_channel_index];
+    if (kChannel->num_transport_channels > RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS) {
+      (void)fprintf(stderr, "%s: invalid redundancy layer configuration\n", argv[0]);
+      return 1;
+    }
+    if (kChannel->num_transport_channels > transport_channels) {
+      transport_channels = kChannel->num_transport_channels;
+    }
+    for (uint32_t tr_channel_index = 0U; tr_channel_index < kChannel->num_transport_channels; ++tr_channel_index) {
+      if (kChannel->transport_channel_ids[tr_channel_index] >= transport_channel_id_limit) {
+        transport_channel_id_limit = kChannel->transport_channel_ids[tr_channel_index] + 1U;
+      }
+    }
+  }
+  const uint32_t kRedChannels = kConfiguration->number_of_redundancy_channels;
+  if ((kRedChannels * transport_channels) < transport_channel_id_limit) {
+    transport_channels = (transport_channel_id_limit + kRedChannels - 1U) / kRedChannels;
+  }
+
+  FILE* const output_file = fopen(argv[1], "w");
+  if (output_file == NULL) {
+    (void)fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[1]);
+    return 1;
+  }
+
+  (void)fprintf(output_file,
+                "/**\n"
+                " * @file redcfg_red_sizing.h\n"
+                " *\n"
+                " * @brief Sizing of the RaSTA redundancy layer storage for the redundancy layer configuration.\n"
+                " *\n"
+                " * This file is generated by redcfg_red_sizing_generator from redcfg_red_config.c, do not edit it manually.\n"
+                " */\n"
+                "#ifndef REDCFG_RED_SIZING_H_\n"
+                "#define REDCFG_RED_SIZING_H_\n"
+                "\n");
+  (void)fprintf(output_file, "#ifndef RADEF_MAX_NUMBER_OF_RED_CHANNELS\n#define RADEF_MAX_NUMBER_OF_RED_CHANNELS (%luU)\n#endif\n\n",
+                (unsigned long)kRedChannels);
+  (void)fprintf(output_file, "#ifndef RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS\n#define RADEF_MAX_NUMBER_OF_TRANSPORT_CHANNELS (%luU)\n#endif\n\n",
+                (unsigned long)transport_channels);
+  (void)fprintf(output_file, "#ifndef RADEF_MAX_DEFER_QUEUE_SIZE\n#define RADEF_MAX_DEFER_QUEUE_SIZE (%luU)\n#endif\n\n",
+                (unsigned long)kConfiguration->n_defer_queue_size);
+  (void)fprintf(output_file, "#ifndef RADEF_DEFER_QUEUE_INDEX_SIZE\n#define RADEF_DEFER_QUEUE_INDEX_SIZE (%luU)\n#endif\n\n",
+                (unsigned long)NextPowerOfTwo(kSequenceNumberRangeCheckFactor * kConfiguration->n_defer_queue_size));
+  (void)fprintf(output_file, "#ifndef RADEF_MAX_RED_LAYER_N_DIAGNOSIS\n#define RADEF_MAX_RED_LAYER_N_DIAGNOSIS (%luU)\n#endif\n\n",
+                (unsigned long)kConfiguration->n_diagnosis);
+  (void)fprintf(output_file, "#endif  // REDCFG_RED_SIZING_H_\n");
+
+  return (fclose(output_file) == 0) ? 0 : 1;
+}
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
+
+static uint32_t NextPowerOfTwo(const uint32_t value) {
+  uint32_t power_of_two = 1U;
+
+  while (power_of_two < value) {
+    power_of_two <<= 1U;
+  }
+
+  return power_of_two;
+}
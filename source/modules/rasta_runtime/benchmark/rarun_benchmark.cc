@@ -0,0 +1,402 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file rarun_benchmark.cc
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Throughput benchmark of the RaSTA runtime.
+ *
+ * The benchmark runs a number of shards with one SafRetL instance each. Every instance has two connections, which are looped back to each other by the
+ * adapter of the benchmark, so that no RedL and no network is needed. The shard handler sends data messages on the first connection and reads them on the
+ * second one. The benchmark measures the number of received messages per second with the requested number of workers. Without a number of workers (or with
+ * 0 workers), the benchmark runs a scaling series with 1, 2, 4 ... ::RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS workers and reports the speedup against one worker,
+ * which shows how the runtime scales with the number of cores. Every run of the series is done in a new process of the benchmark, since the runtime can
+ * only be initialized once.
+ *
+ * Usage: rarun_benchmark [number_of_workers [duration_in_ms]]
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/rasys_rasta_system_adapter.h"
+#include "rasta_redundancy/redint_red_interface.h"
+#include "rasta_runtime/rarun_rasta_runtime.h"
+#include "rasta_safety_retransmission/sradin_sr_adapter_interface.h"
+#include "rasta_safety_retransmission/sradno_sr_adapter_notifications.h"
+#include "rasta_safety_retransmission/srapi_sr_api.h"
+#include "rasta_safety_retransmission/srnot_sr_notifications.h"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Number of shards of the benchmark.
+ */
+#define NUMBER_OF_SHARDS (RADEF_MAX_NUMBER_OF_SR_INSTANCES)
+
+/**
+ * @brief Number of connections of every shard.
+ */
+#define NUMBER_OF_CONNECTIONS (2U)
+
+/**
+ * @brief Payload size of the data messages [bytes].
+ */
+#define PAYLOAD_SIZE (64U)
+
+/**
+ * @brief Number of send buffer entries, which are not used for data messages [entries].
+ */
+#define SEND_BUFFER_RESERVE (4U)
+
+/**
+ * @brief Time to establish the connections before the measurement starts [ms].
+ */
+#define WARM_UP_DURATION (500U)
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+namespace {
+
+/**
+ * @brief Loopback channels and statistics of a shard. Only accessed by the worker servicing the shard.
+ */
+struct Shard {
+  srapi_Instance *instance = nullptr;                                           ///< SafRetL instance of the shard
+  std::array<std::deque<std::vector<uint8_t>>, NUMBER_OF_CONNECTIONS> queues;  ///< Messages waiting on every redundancy channel
+  std::atomic<uint64_t> received_messages{0U};                                  ///< Number of received data messages, also read by the main thread
+};
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+std::array<Shard, NUMBER_OF_SHARDS> shards;                                                ///< Shards of the benchmark
+std::array<srcty_SafetyRetransmissionConfiguration, NUMBER_OF_SHARDS> sr_configurations;  ///< SafRetL configurations
+const std::chrono::steady_clock::time_point kStartTime = std::chrono::steady_clock::now();  ///< Reference time of the timer
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Find the shard of a SafRetL instance.
+ */
+Shard &GetShard(const srapi_Instance *const instance) {
+  for (Shard &shard : shards) {
+    if (shard.instance == instance) {
+      return shard;
+    }
+  }
+  std::fprintf(stderr, "Unknown SafRetL instance\n");
+  std::abort();
+}
+
+/**
+ * @brief Initialize the SafRetL instance of a shard and open its connections.
+ */
+void InitShard(const uint32_t shard_id) {
+  srcty_SafetyRetransmissionConfiguration &configuration = sr_configurations[shard_id];
+  std::memset(&configuration, 0, sizeof(configuration));
+  configuration.rasta_network_id = 1U;
+  configuration.t_max = 1800U;
+  configuration.t_h = 300U;
+  configuration.safety_code_type = srcty_kSafetyCodeTypeLowerMd4;
+  configuration.m_w_a = 10U;
+  configuration.n_send_max = 20U;
+  configuration.n_max_packet = 1U;
+  configuration.n_diag_window = 5000U;
+  configuration.number_of_connections = NUMBER_OF_CONNECTIONS;
+  configuration.connection_configurations[0U] = {0U, 0x61U, 0x62U};
+  configuration.connection_configurations[1U] = {1U, 0x62U, 0x61U};
+  configuration.md4_initial_value = {0x67452301U, 0xEFCDAB89U, 0x98BADCFEU, 0x10325476U};
+  for (uint32_t index = 0U; index < RADEF_DIAGNOSTIC_TIMING_DISTRIBUTION_ARRAY_SIZE; ++index) {
+    configuration.diag_timing_distr_intervals[index] = (index + 1U) * 300U;
+  }
+
+  uint32_t connection_memory_size = 0U;
+  if (srapi_GetConnectionMemorySize(NUMBER_OF_CONNECTIONS, &connection_memory_size) != radef_kNoError) {
+    std::abort();
+  }
+  // Allocated once for the whole run of the benchmark
+  void *const connection_memory = std::calloc(1U, connection_memory_size + SRATY_CONNECTION_MEMORY_ALIGNMENT);
+  const uintptr_t kAlignedAddress = (reinterpret_cast<uintptr_t>(connection_memory) + SRATY_CONNECTION_MEMORY_ALIGNMENT - 1U) &
+                                    ~static_cast<uintptr_t>(SRATY_CONNECTION_MEMORY_ALIGNMENT - 1U);
+  if (srapi_Init(&configuration, reinterpret_cast<void *>(kAlignedAddress), connection_memory_size, &shards[shard_id].instance) != radef_kNoError) {
+    std::fprintf(stderr, "SafRetL initialization of shard %u failed\n", shard_id);
+    std::abort();
+  }
+
+  uint32_t connection_id = 0U;
+  srapi_OpenConnection(shards[shard_id].instance, 0x61U, 0x62U, 1U, &connection_id);
+  srapi_OpenConnection(shards[shard_id].instance, 0x62U, 0x61U, 1U, &connection_id);
+}
+
+/**
+ * @brief Shard handler, which delivers the looped back messages, sends data on the first connection and reads it on the second connection.
+ */
+void ShardHandler(const uint32_t shard_id, srapi_Instance *const sr_instance) {
+  Shard &shard = shards[shard_id];
+
+  for (uint32_t channel = 0U; channel < NUMBER_OF_CONNECTIONS; ++channel) {
+    if (!shard.queues[channel].empty()) {
+      sradno_MessageReceivedNotification(sr_instance, channel);
+    }
+  }
+
+  sraty_ConnectionStates state = sraty_kConnectionNotInitialized;
+  sraty_BufferUtilisation buffer_utilisation = {};
+  uint16_t opposite_buffer_size = 0U;
+  if ((srapi_GetConnectionState(sr_instance, 0U, &state, &buffer_utilisation, &opposite_buffer_size) == radef_kNoError) && (state == sraty_kConnectionUp)) {
+    // Some send buffer entries are left free for heartbeats and retransmissions
+    const uint8_t kPayload[PAYLOAD_SIZE] = {0U};
+    for (uint16_t entry = SEND_BUFFER_RESERVE; entry < buffer_utilisation.send_buffer_free; ++entry) {
+      srapi_SendData(sr_instance, 0U, sizeof(kPayload), kPayload);
+    }
+  }
+
+  uint8_t buffer[RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE];
+  uint16_t message_size = 0U;
+  while (srapi_ReadData(sr_instance, 1U, sizeof(buffer), &message_size, buffer) == radef_kNoError) {
+    shard.received_messages.fetch_add(1U, std::memory_order_relaxed);
+  }
+}
+
+/**
+ * @brief Get the number of received data messages of all shards.
+ */
+uint64_t GetReceivedMessages() {
+  uint64_t received_messages = 0U;
+  for (const Shard &shard : shards) {
+    received_messages += shard.received_messages.load(std::memory_order_relaxed);
+  }
+  return received_messages;
+}
+
+/**
+ * @brief Run the shards with a number of workers and measure the number of received messages per second.
+ */
+double MeasureThroughput(const uint32_t number_of_workers, const uint32_t duration) {
+  static rarun_RuntimeConfiguration configuration = {};
+  configuration.number_of_workers = number_of_workers;
+  configuration.number_of_shards = NUMBER_OF_SHARDS;
+  configuration.service_period = 10U;
+  for (uint32_t shard_id = 0U; shard_id < NUMBER_OF_SHARDS; ++shard_id) {
+    configuration.shards[shard_id] = {shards[shard_id].instance, nullptr, ShardHandler};
+  }
+  if (rarun_Init(&configuration) != radef_kNoError) {
+    std::fprintf(stderr, "Invalid number of workers, valid range: 1 .. %u\n", RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS);
+    std::exit(EXIT_FAILURE);
+  }
+
+  std::atomic<bool> running(true);
+  std::vector<std::thread> workers;
+  for (uint32_t worker_id = 0U; worker_id < number_of_workers; ++worker_id) {
+    workers.emplace_back([worker_id, &running]() {
+      uint32_t serviced_shards = 0U;
+      while (running.load()) {
+        if (rarun_RunWorker(worker_id, &serviced_shards) != radef_kNoError) {
+          std::abort();
+        }
+      }
+    });
+  }
+
+  // The connections are established before measuring
+  std::this_thread::sleep_for(std::chrono::milliseconds(WARM_UP_DURATION));
+  const uint64_t kReceivedBefore = GetReceivedMessages();
+  const std::chrono::steady_clock::time_point kBegin = std::chrono::steady_clock::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(duration));
+  const uint64_t kReceivedAfter = GetReceivedMessages();
+  const double kSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - kBegin).count();
+
+  running.store(false);
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+
+  return static_cast<double>(kReceivedAfter - kReceivedBefore) / kSeconds;
+}
+
+/**
+ * @brief Print the number of shards, which every worker owns at the end of a run.
+ */
+void PrintShardDistribution(const uint32_t number_of_workers) {
+  for (uint32_t worker_id = 0U; worker_id < number_of_workers; ++worker_id) {
+    uint32_t number_of_shards = 0U;
+    rarun_GetNumberOfShards(worker_id, &number_of_shards);
+    std::printf("worker %u: %u shards\n", worker_id, number_of_shards);
+  }
+}
+
+/**
+ * @brief Run the benchmark with a number of workers in a new process and get the number of received messages per second.
+ */
+double RunProcess(const char *const program, const uint32_t number_of_workers, const uint32_t duration) {
+  char command[512];
+  std::snprintf(command, sizeof(command), "\"%s\" %u %u", program, number_of_workers, duration);
+  FILE *const output = popen(command, "r");
+  if (output == nullptr) {
+    std::fprintf(stderr, "Run with %u workers failed\n", number_of_workers);
+    std::exit(EXIT_FAILURE);
+  }
+
+  double throughput = 0.0;
+  char line[256];
+  while (std::fgets(line, sizeof(line), output) != nullptr) {
+    const char *const kResult = std::strstr(line, "received messages/s: ");
+    if (kResult != nullptr) {
+      throughput = std::strtod(kResult + std::strlen("received messages/s: "), nullptr);
+    }
+  }
+  if (pclose(output) != 0) {
+    std::fprintf(stderr, "Run with %u workers failed\n", number_of_workers);
+    std::exit(EXIT_FAILURE);
+  }
+  return throughput;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// Adapter, notification and system adapter functions of the benchmark
+// -----------------------------------------------------------------------------
+
+extern "C" {
+
+void sradin_Init(void) {}
+
+void sradin_OpenRedundancyChannel(srapi_Instance *const instance, const uint32_t redundancy_channel_id) {
+  (void)instance;
+  (void)redundancy_channel_id;
+}
+
+void sradin_CloseRedundancyChannel(srapi_Instance *const instance, const uint32_t redundancy_channel_id) {
+  (void)instance;
+  (void)redundancy_channel_id;
+}
+
+void sradin_SendMessage(srapi_Instance *const instance, const uint32_t redundancy_channel_id, const uint16_t message_size, const uint8_t *const message_data) {
+  // Loop back to the other connection of the shard, the notification is delivered by the shard handler
+  GetShard(instance).queues[redundancy_channel_id ^ 1U].emplace_back(message_data, message_data + message_size);
+}
+
+radef_RaStaReturnCode sradin_ReadMessage(srapi_Instance *const instance, const uint32_t redundancy_channel_id, const uint16_t buffer_size,
+                                         uint16_t *const message_size, uint8_t *const message_buffer) {
+  std::deque<std::vector<uint8_t>> &queue = GetShard(instance).queues[redundancy_channel_id];
+  if (queue.empty() || (queue.front().size() > buffer_size)) {
+    return radef_kNoMessageReceived;
+  }
+  *message_size = static_cast<uint16_t>(queue.front().size());
+  std::memcpy(message_buffer, queue.front().data(), queue.front().size());
+  queue.pop_front();
+  return radef_kNoError;
+}
+
+void srnot_MessageReceivedNotification(srapi_Instance *const instance, const uint32_t connection_id) {
+  (void)instance;
+  (void)connection_id;
+}
+
+void srnot_ConnectionStateNotification(srapi_Instance *const instance, const uint32_t connection_id, const sraty_ConnectionStates connection_state,
+                                       const sraty_BufferUtilisation buffer_utilisation, const uint16_t opposite_buffer_size,
+                                       const sraty_DiscReason disconnect_reason, const uint16_t detailed_disconnect_reason) {
+  (void)instance;
+  (void)connection_id;
+  (void)connection_state;
+  (void)buffer_utilisation;
+  (void)opposite_buffer_size;
+  (void)disconnect_reason;
+  (void)detailed_disconnect_reason;
+}
+
+void srnot_SrDiagnosticNotification(srapi_Instance *const instance, const uint32_t connection_id,
+                                    const sraty_ConnectionDiagnosticData connection_diagnostic_data) {
+  (void)instance;
+  (void)connection_id;
+  (void)connection_diagnostic_data;
+}
+
+void srnot_RedDiagnosticNotification(srapi_Instance *const instance, const uint32_t connection_id,
+                                     const sraty_RedundancyChannelDiagnosticData redundancy_channel_diagnostic_data) {
+  (void)instance;
+  (void)connection_id;
+  (void)redundancy_channel_diagnostic_data;
+}
+
+radef_RaStaReturnCode redint_CheckTimings(redint_Instance *const instance) {
+  // The shards of the benchmark have no RedL instance
+  (void)instance;
+  std::abort();
+}
+
+uint32_t rasys_GetTimerValue(void) {
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - kStartTime).count());
+}
+
+uint32_t rasys_GetTimerGranularity(void) {
+  return 1U;
+}
+
+uint32_t rasys_GetRandomNumber(void) {
+  return 0x5A5A5A5AU;
+}
+
+void rasys_FatalError(const radef_RaStaReturnCode error_reason) {
+  std::fprintf(stderr, "Fatal error %d\n", static_cast<int>(error_reason));
+  std::abort();
+}
+}
+
+// -----------------------------------------------------------------------------
+// Main
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+  const uint32_t kNumberOfWorkers = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 0U;
+  const uint32_t kDuration = (argc > 2) ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 2000U;
+
+  if (kNumberOfWorkers != 0U) {
+    for (uint32_t shard_id = 0U; shard_id < NUMBER_OF_SHARDS; ++shard_id) {
+      InitShard(shard_id);
+    }
+    const double kThroughput = MeasureThroughput(kNumberOfWorkers, kDuration);
+    std::printf("workers: %u, shards: %u, hardware threads: %u, received messages/s: %.0f\n", kNumberOfWorkers, NUMBER_OF_SHARDS,
+                std::thread::hardware_concurrency(), kThroughput);
+    PrintShardDistribution(kNumberOfWorkers);
+  } else {
+    // Scaling series, the speedup is relative to the run with one worker
+    std::printf("shards: %u, hardware threads: %u\n", NUMBER_OF_SHARDS, std::thread::hardware_concurrency());
+    std::printf("%8s %20s %8s\n", "workers", "received messages/s", "speedup");
+    double single_worker_throughput = 0.0;
+    for (uint32_t number_of_workers = 1U; number_of_workers <= RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS; number_of_workers *= 2U) {
+      const double kThroughput = RunProcess(argv[0], number_of_workers, kDuration);
+      if (number_of_workers == 1U) {
+        single_worker_throughput = kThroughput;
+      }
+      std::printf("%8u %20.0f %8.2f\n", number_of_workers, kThroughput, (single_worker_throughput > 0.0) ? (kThroughput / single_worker_throughput) : 0.0);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file rarun_rasta_runtime.h
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @addtogroup runtime
+ * @{
+ *
+ * @brief Interface of RaSTA runtime.
+ *
+ * The runtime services several independent stack instances (shards) with a number of worker threads. Every shard consists of a SafRetL instance and
+ * optionally a RedL instance, which carry a part of the connections of the application. The threads are created by the application, which calls
+ * ::rarun_RunWorker periodically in every worker thread. Every shard is owned by one worker at a time. The shards are distributed round robin to the workers
+ * at the initialization. A worker, which has serviced its own shards, steals the shard of another worker, which is the longest behind the configured
+ * service period. So the load is rebalanced, if the connections cause a different effort in the shards or if a worker thread is blocked. A stolen shard is
+ * not stolen again within two service periods, so that it does not bounce between the workers.
+ *
+ * With more than one worker or more than one instance, the stack must be built with ::RADEF_MULTI_THREADED, so that every worker thread selects its instances
+ * independently. All instances must be initialized before the worker threads are started. All calls of the SafRetL and RedL API for the instances of a shard
+ * must be done in the shard handler, which is called by the worker servicing the shard. The same applies to the notifications and the adapter functions, which
+ * are called during the servicing of the shard. The debug logger is shared by all instances and must not be used by several workers.
+ */
+#ifndef RARUN_RASTA_RUNTIME_H_
+#define RARUN_RASTA_RUNTIME_H_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <stdint.h>
+
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_redundancy/redint_red_interface.h"
+#include "rasta_safety_retransmission/sraty_sr_api_types.h"
+
+// -----------------------------------------------------------------------------
+// Global Macro Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Type Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Application function, which is called every time a shard is serviced.
+ *
+ * The function is called by the worker servicing the shard, after the timings of the instances of the shard are checked. The application reads and sends the
+ * data of the connections of the shard in this function.
+ *
+ * @param [in] shard_id Shard identification. Valid range: 0 <= value < number of shards.
+ * @param [in] sr_instance Pointer to the SafRetL instance of the shard.
+ */
+typedef void (*rarun_ShardHandler)(const uint32_t shard_id, srapi_Instance* const sr_instance);
+
+/**
+ * @brief Struct for the configuration of a shard.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  srapi_Instance* sr_instance;    ///< Pointer to the SafRetL instance returned by ::srapi_Init.
+  redint_Instance* red_instance;  ///< Pointer to the RedL instance returned by ::redint_Init. NULL, if the shard has no RedL instance of its own.
+  rarun_ShardHandler handler;     ///< Application function called when the shard is serviced. NULL, if no function is called.
+} rarun_ShardConfiguration;
+
+/**
+ * @brief Struct for the configuration of the runtime.
+ */
+typedef struct {
+  uint32_t number_of_workers;  ///< Number of workers. Valid range: 1 <= value <= ::RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS.
+  uint32_t number_of_shards;   ///< Number of shards. Valid range: 1 <= value <= ::RADEF_MAX_NUMBER_OF_SR_INSTANCES.
+  uint32_t service_period;     ///< Period in which every shard must be serviced [ms]. A shard, which is not serviced in time, can be stolen.
+  rarun_ShardConfiguration shards[RADEF_MAX_NUMBER_OF_SR_INSTANCES];  ///< Configuration of the shards.
+} rarun_RuntimeConfiguration;
+//lint -restore
+
+// -----------------------------------------------------------------------------
+// Global Const Declarations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Prototypes
+// -----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Initialize the runtime.
+ *
+ * This function checks the configuration and distributes the shards round robin to the workers. It must be called once, before the worker threads are
+ * started.
+ *
+ * @param [in] runtime_configuration Pointer to the runtime configuration. The configuration must stay valid as long as the runtime is used. If the pointer is
+ * NULL, a ::radef_kInvalidParameter error is returned.
+ * @return ::radef_kNoError -> successful initialization
+ * @return ::radef_kInvalidParameter -> invalid parameter
+ * @return ::radef_kInvalidConfiguration -> invalid number of workers or shards, or a shard without SafRetL instance
+ * @return ::radef_kAlreadyInitialized -> runtime already initialized
+ */
+radef_RaStaReturnCode rarun_Init(const rarun_RuntimeConfiguration* const runtime_configuration);
+
+/**
+ * @brief Run one scheduling round of a worker.
+ *
+ * This function services all shards owned by the worker. Servicing a shard means:
+ * - check the timings of the RedL instance with ::redint_CheckTimings, if the shard has a RedL instance
+ * - check the timings of the SafRetL instance with ::srapi_CheckTimings
+ * - call the shard handler, if it is configured
+ * .
+ * Afterwards, the worker steals at most one shard of another worker, which was not serviced within the service period. If several shards are behind,
+ * the one with the oldest servicing is stolen. A shard, which was stolen within the last two service periods or which is serviced by another worker at the
+ * moment, is skipped. The stolen shard is serviced immediately and stays with the worker until it is stolen again.
+ *
+ * @remark This function must be called periodically by the thread of the worker, in an interval smaller than the service period.
+ *
+ * @param [in] worker_id Worker identification. Valid range: 0 <= value < number of workers. For any other value a ::radef_kInvalidParameter error is returned.
+ * @param [out] serviced_shards Number of shards serviced in this round. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
+ * @return ::radef_kNoError -> successful operation
+ * @return ::radef_kNotInitialized -> runtime not initialized
+ * @return ::radef_kInvalidParameter -> invalid parameter
+ * @return Error code returned by ::redint_CheckTimings or ::srapi_CheckTimings, the round is stopped at the first error
+ */
+radef_RaStaReturnCode rarun_RunWorker(const uint32_t worker_id, uint32_t* const serviced_shards);
+
+/**
+ * @brief Get the number of shards owned by a worker.
+ *
+ * @param [in] worker_id Worker identification. Valid range: 0 <= value < number of workers. For any other value a ::radef_kInvalidParameter error is returned.
+ * @param [out] number_of_shards Number of shards owned by the worker. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
+ * @return ::radef_kNoError -> successful operation
+ * @return ::radef_kNotInitialized -> runtime not initialized
+ * @return ::radef_kInvalidParameter -> invalid parameter
+ */
+radef_RaStaReturnCode rarun_GetNumberOfShards(const uint32_t worker_id, uint32_t* const number_of_shards);
+
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+#endif  // RARUN_RASTA_RUNTIME_H_
@@ -0,0 +1,301 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file rarun_rasta_runtime.c
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Implementation of RaSTA runtime.
+ *
+ * The shard ownership and the worker loads are shared between the worker threads and are only accessed with C11 atomic operations. A worker takes the busy
+ * flag of a shard before servicing it, so that a shard is never serviced by two workers at the same time, also not directly after it was stolen.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "rasta_runtime/rarun_rasta_runtime.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/rasys_rasta_system_adapter.h"
+#include "rasta_redundancy/redint_red_interface.h"
+#include "rasta_safety_retransmission/srapi_sr_api.h"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+#if RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS < 1U
+#error "RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS must be at least 1"
+#endif
+
+#if (RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS > 1U) && !defined(RADEF_MULTI_THREADED)
+#error "More than one runtime worker needs the stack to be built with RADEF_MULTI_THREADED"
+#endif
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Struct for the scheduling data of a shard.
+ */
+typedef struct {
+  atomic_uint owner;              ///< Worker identification of the owner of the shard
+  atomic_bool busy;               ///< True, while a worker services the shard
+  atomic_uint last_service_time;  ///< Timer value at the end of the last servicing of the shard [ms]
+  atomic_uint last_steal_time;    ///< Timer value at which the shard was stolen the last time [ms]
+} ShardData;
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Initialization state of the module. True, if the module is initialized.
+ */
+PRIVATE bool rarun_initialized = false;
+
+/**
+ * @brief Pointer to the runtime configuration.
+ */
+PRIVATE const rarun_RuntimeConfiguration* rarun_configuration = NULL;
+
+/**
+ * @brief Scheduling data of the shards.
+ */
+PRIVATE ShardData rarun_shards[RADEF_MAX_NUMBER_OF_SR_INSTANCES];
+
+/**
+ * @brief Number of shards owned by every worker.
+ */
+PRIVATE atomic_uint rarun_worker_loads[RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS];
+
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+/** @addtogroup runtime
+ * @{
+ */
+
+/**
+ * @brief Check the runtime configuration.
+ *
+ * @param [in] runtime_configuration Pointer to the runtime configuration.
+ * @return true -> the configuration is valid
+ * @return false -> the configuration is not valid
+ */
+static bool IsConfigurationValid(const rarun_RuntimeConfiguration* const runtime_configuration);
+
+/**
+ * @brief Service a shard, if it is owned by the worker and not serviced by another worker.
+ *
+ * @param [in] worker_id Worker identification.
+ * @param [in] shard_id Shard identification.
+ * @param [out] serviced True, if the shard was serviced.
+ * @return Error code of the timing checks of the shard instances.
+ */
+static radef_RaStaReturnCode ServiceShard(const uint32_t worker_id, const uint32_t shard_id, bool* const serviced);
+
+/**
+ * @brief Steal the shard of another worker, which is the longest behind its service period.
+ *
+ * A shard is stolen, if it was not serviced within the service period and if it was not stolen within the last ::kStealCooldownPeriods service periods.
+ *
+ * @param [in] worker_id Worker identification of the stealing worker.
+ * @param [out] shard_id Shard identification of the stolen shard.
+ * @return true -> a shard was stolen
+ * @return false -> no shard to steal found
+ */
+static bool StealShard(const uint32_t worker_id, uint32_t* const shard_id);
+
+/** @}*/
+
+// -----------------------------------------------------------------------------
+// Local Constant Definitions
+// -----------------------------------------------------------------------------
+
+static const uint32_t kStealCooldownPeriods = 2U;  ///< Number of service periods after a steal, in which a shard is not stolen again
+
+// -----------------------------------------------------------------------------
+// Global Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+
+radef_RaStaReturnCode rarun_Init(const rarun_RuntimeConfiguration* const runtime_configuration) {
+  radef_RaStaReturnCode ret = radef_kNoError;
+
+  // Input parameter check
+  if (runtime_configuration == NULL) {
+    ret = radef_kInvalidParameter;
+  } else if (rarun_initialized) {
+    ret = radef_kAlreadyInitialized;
+  } else if (!IsConfigurationValid(runtime_configuration)) {
+    ret = radef_kInvalidConfiguration;
+  } else {
+    rarun_configuration = runtime_configuration;
+    const uint32_t kCurrentTime = rasys_GetTimerValue();
+    // The shards are handled as stolen before the cooldown, so that they can be stolen directly after the initialization
+    const uint32_t kInitialStealTime = kCurrentTime - (kStealCooldownPeriods * rarun_configuration->service_period);  // Unsigned integer wrap around allowed
+
+    for (uint32_t worker_id = 0U; worker_id < RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS; ++worker_id) {
+      atomic_init(&rarun_worker_loads[worker_id], 0U);
+    }
+    for (uint32_t shard_id = 0U; shard_id < rarun_configuration->number_of_shards; ++shard_id) {
+      const uint32_t kOwner = shard_id % rarun_configuration->number_of_workers;
+      atomic_init(&rarun_shards[shard_id].owner, kOwner);
+      atomic_init(&rarun_shards[shard_id].busy, false);
+      atomic_init(&rarun_shards[shard_id].last_service_time, kCurrentTime);
+      atomic_init(&rarun_shards[shard_id].last_steal_time, kInitialStealTime);
+      atomic_fetch_add(&rarun_worker_loads[kOwner], 1U);
+    }
+    rarun_initialized = true;
+  }
+
+  return ret;
+}
+
+radef_RaStaReturnCode rarun_RunWorker(const uint32_t worker_id, uint32_t* const serviced_shards) {
+  radef_RaStaReturnCode ret = radef_kNoError;
+
+  if (!rarun_initialized) {
+    ret = radef_kNotInitialized;
+  } else if ((worker_id >= rarun_configuration->number_of_workers) || (serviced_shards == NULL)) {
+    // Input parameter check
+    ret = radef_kInvalidParameter;
+  } else {
+    uint32_t number_of_serviced_shards = 0U;
+    bool serviced = false;
+
+    // Service the own shards
+    for (uint32_t shard_id = 0U; (shard_id < rarun_configuration->number_of_shards) && (ret == radef_kNoError); ++shard_id) {
+      ret = ServiceShard(worker_id, shard_id, &serviced);
+      if (serviced) {
+        ++number_of_serviced_shards;
+      }
+    }
+
+    // Steal a shard, which is behind its service period
+    uint32_t stolen_shard_id = 0U;
+    if ((ret == radef_kNoError) && StealShard(worker_id, &stolen_shard_id)) {
+      ret = ServiceShard(worker_id, stolen_shard_id, &serviced);
+      if (serviced) {
+        ++number_of_serviced_shards;
+      }
+    }
+
+    *serviced_shards = number_of_serviced_shards;
+  }
+
+  return ret;
+}
+
+radef_RaStaReturnCode rarun_GetNumberOfShards(const uint32_t worker_id, uint32_t* const number_of_shards) {
+  radef_RaStaReturnCode ret = radef_kNoError;
+
+  if (!rarun_initialized) {
+    ret = radef_kNotInitialized;
+  } else if ((worker_id >= rarun_configuration->number_of_workers) || (number_of_shards == NULL)) {
+    // Input parameter check
+    ret = radef_kInvalidParameter;
+  } else {
+    *number_of_shards = atomic_load(&rarun_worker_loads[worker_id]);
+  }
+
+  return ret;
+}
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
+
+static bool IsConfigurationValid(const rarun_RuntimeConfiguration* const runtime_configuration) {
+  bool valid = (runtime_configuration->number_of_workers >= 1U) && (runtime_configuration->number_of_workers <= RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS) &&
+               (runtime_configuration->number_of_shards >= 1U) && (runtime_configuration->number_of_shards <= RADEF_MAX_NUMBER_OF_SR_INSTANCES);
+
+  for (uint32_t shard_id = 0U; valid && (shard_id < runtime_configuration->number_of_shards); ++shard_id) {
+    valid = (runtime_configuration->shards[shard_id].sr_instance != NULL);
+  }
+
+  return valid;
+}
+
+static radef_RaStaReturnCode ServiceShard(const uint32_t worker_id, const uint32_t shard_id, bool* const serviced) {
+  radef_RaStaReturnCode ret = radef_kNoError;
+  ShardData* const shard = &rarun_shards[shard_id];
+
+  *serviced = false;
+  if ((atomic_load(&shard->owner) == worker_id) && !atomic_exchange(&shard->busy, true)) {
+    // Check the owner again, because the shard could have been stolen before the busy flag was taken
+    if (atomic_load(&shard->owner) == worker_id) {
+      const rarun_ShardConfiguration* const kShardConfiguration = &rarun_configuration->shards[shard_id];
+
+      if (kShardConfiguration->red_instance != NULL) {
+        ret = redint_CheckTimings(kShardConfiguration->red_instance);
+      }
+      if (ret == radef_kNoError) {
+        ret = srapi_CheckTimings(kShardConfiguration->sr_instance);
+      }
+      if ((ret == radef_kNoError) && (kShardConfiguration->handler != NULL)) {
+        kShardConfiguration->handler(shard_id, kShardConfiguration->sr_instance);
+      }
+
+      atomic_store(&shard->last_service_time, rasys_GetTimerValue());
+      *serviced = true;
+    }
+    atomic_store(&shard->busy, false);
+  }
+
+  return ret;
+}
+
+static bool StealShard(const uint32_t worker_id, uint32_t* const shard_id) {
+  bool stolen = false;
+  const uint32_t kCurrentTime = rasys_GetTimerValue();
+  const uint32_t kStealCooldown = kStealCooldownPeriods * rarun_configuration->service_period;
+
+  // Search the shard of another worker, which is the longest behind its service period. The loads of the workers are not compared, because with evenly
+  // distributed shards a blocked worker would never lose its shards. The cooldown after a steal prevents a shard from bouncing between the workers.
+  bool candidate_found = false;
+  uint32_t candidate_index = 0U;
+  uint32_t candidate_owner = 0U;
+  uint32_t candidate_overdue_time = 0U;
+  for (uint32_t index = 0U; index < rarun_configuration->number_of_shards; ++index) {
+    ShardData* const shard = &rarun_shards[index];
+    const uint32_t kOwner = atomic_load(&shard->owner);
+    const uint32_t kOverdueTime = kCurrentTime - atomic_load(&shard->last_service_time);  // Unsigned integer wrap around allowed in this calculation
+    const bool kCooledDown = (kCurrentTime - atomic_load(&shard->last_steal_time)) >= kStealCooldown;
+
+    if ((kOwner != worker_id) && (kOverdueTime > rarun_configuration->service_period) && kCooledDown && !atomic_load(&shard->busy) &&
+        (!candidate_found || (kOverdueTime > candidate_overdue_time))) {
+      candidate_found = true;
+      candidate_index = index;
+      candidate_owner = kOwner;
+      candidate_overdue_time = kOverdueTime;
+    }
+  }
+
+  // The shard is not stolen, if its owner changed in the meantime
+  if (candidate_found && atomic_compare_exchange_strong(&rarun_shards[candidate_index].owner, &candidate_owner, worker_id)) {
+    atomic_store(&rarun_shards[candidate_index].last_steal_time, kCurrentTime);
+    atomic_fetch_sub(&rarun_worker_loads[candidate_owner], 1U);
+    atomic_fetch_add(&rarun_worker_loads[worker_id], 1U);
+    *shard_id = candidate_index;
+    stolen = true;
+  }
+
+  return stolen;
+}
@@ -0,0 +1,48 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redint_mock.cc
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock source file for the redint module
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "redint_mock.hh"
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+redintMock * redintMock::instance = NULL;
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+redintMock::redintMock() {
+  instance = this;
+}
+
+redintMock::~redintMock() {
+  instance = NULL;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+extern "C" {
+
+  radef_RaStaReturnCode redint_CheckTimings(redint_Instance *const instance){
+    if(redintMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return redintMock::getInstance()->redint_CheckTimings(instance);
+  }
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -0,0 +1,59 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file redint_mock.hh
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock header file for the redint module
+ */
+
+#ifndef SOURCE_MODULES_RASTA_RUNTIME_TESTS_MOCKS_REDINT_MOCK_HH_
+#define SOURCE_MODULES_RASTA_RUNTIME_TESTS_MOCKS_REDINT_MOCK_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "gmock/gmock.h"
+#include "rasta_redundancy/redint_red_interface.h"
+
+// -----------------------------------------------------------------------------
+// Mock class
+// -----------------------------------------------------------------------------
+/**
+ * @brief Mock class for the rasta redint class
+ */
+class redintMock {
+private:
+  static redintMock *instance;  ///< redintMock instance
+
+public:
+  /**
+  * @brief redintMock constructor
+  */
+  redintMock();
+  /**
+  * @brief redintMock destructor
+  */
+  virtual ~redintMock();
+
+  /**
+  * @brief Mock Method object for the redint_CheckTimings function
+  */
+  MOCK_METHOD(radef_RaStaReturnCode, redint_CheckTimings, (redint_Instance *const instance));
+
+  /**
+  * @brief Get the Instance object
+  *
+  * @return redintMock*
+  */
+  static redintMock *getInstance() {
+    return instance;
+  }
+};
+
+#endif // SOURCE_MODULES_RASTA_RUNTIME_TESTS_MOCKS_REDINT_MOCK_HH_
@@ -0,0 +1,48 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srapi_mock.cc
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock source file for the srapi module
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "srapi_mock.hh"
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+srapiMock * srapiMock::instance = NULL;
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+srapiMock::srapiMock() {
+  instance = this;
+}
+
+srapiMock::~srapiMock() {
+  instance = NULL;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+extern "C" {
+
+  radef_RaStaReturnCode srapi_CheckTimings(srapi_Instance *const instance){
+    if(srapiMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srapiMock::getInstance()->srapi_CheckTimings(instance);
+  }
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -0,0 +1,59 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srapi_mock.hh
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock header file for the srapi module
+ */
+
+#ifndef SOURCE_MODULES_RASTA_RUNTIME_TESTS_MOCKS_SRAPI_MOCK_HH_
+#define SOURCE_MODULES_RASTA_RUNTIME_TESTS_MOCKS_SRAPI_MOCK_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "gmock/gmock.h"
+#include "rasta_safety_retransmission/srapi_sr_api.h"
+
+// -----------------------------------------------------------------------------
+// Mock class
+// -----------------------------------------------------------------------------
+/**
+ * @brief Mock class for the rasta srapi class
+ */
+class srapiMock {
+private:
+  static srapiMock *instance;  ///< srapiMock instance
+
+public:
+  /**
+  * @brief srapiMock constructor
+  */
+  srapiMock();
+  /**
+  * @brief srapiMock destructor
+  */
+  virtual ~srapiMock();
+
+  /**
+  * @brief Mock Method object for the srapi_CheckTimings function
+  */
+  MOCK_METHOD(radef_RaStaReturnCode, srapi_CheckTimings, (srapi_Instance *const instance));
+
+  /**
+  * @brief Get the Instance object
+  *
+  * @return srapiMock*
+  */
+  static srapiMock *getInstance() {
+    return instance;
+  }
+};
+
+#endif // SOURCE_MODULES_RASTA_RUNTIME_TESTS_MOCKS_SRAPI_MOCK_HH_
@@ -0,0 +1,338 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_rarun.cc
+ *
+ * @author Nicola Fricker, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Unit test file for the runtime module.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "unit_test_rarun.hh"
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+std::vector<uint32_t> serviced_shard_ids;
+
+// -----------------------------------------------------------------------------
+// Test cases
+// -----------------------------------------------------------------------------
+
+/** @addtogroup runtime
+ * @{
+ */
+
+/**
+ * @test        @ID{rarunTest001} Verify the init function.
+ *
+ * @details     This test verifies the parameter and configuration checks of the init function and the round robin distribution of the shards.
+ *
+ * Test steps:
+ * - verify that the worker functions return a not initialized error before the initialization
+ * - call the init function with a NULL pointer and verify the invalid parameter error
+ * - call the init function with an invalid number of workers, an invalid number of shards and a shard without SafRetL instance and verify the invalid
+ *   configuration error
+ * - initialize the runtime and verify that the shards are distributed round robin to the workers
+ * - call the init function again and verify the already initialized error
+ * - call the get number of shards function with invalid parameters and verify the invalid parameter error
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No preconditions for this test case.
+ * @post        The runtime is initialized.
+ *
+ * @testMethod  Functional Test
+
+ */
+TEST_F(rarunTest, rarunTest001VerifyInitFunction)
+{
+    uint32_t number_of_shards = 0U;
+    uint32_t serviced_shards = 0U;
+
+    EXPECT_EQ(radef_kNotInitialized, rarun_GetNumberOfShards(0U, &number_of_shards));
+    EXPECT_EQ(radef_kNotInitialized, rarun_RunWorker(0U, &serviced_shards));
+
+    EXPECT_EQ(radef_kInvalidParameter, rarun_Init(nullptr));
+
+    configuration.number_of_workers = 0U;
+    EXPECT_EQ(radef_kInvalidConfiguration, rarun_Init(&configuration));
+    configuration.number_of_workers = RADEF_MAX_NUMBER_OF_RUNTIME_WORKERS + 1U;
+    EXPECT_EQ(radef_kInvalidConfiguration, rarun_Init(&configuration));
+    configuration.number_of_workers = 2U;
+
+    configuration.number_of_shards = 0U;
+    EXPECT_EQ(radef_kInvalidConfiguration, rarun_Init(&configuration));
+    configuration.number_of_shards = RADEF_MAX_NUMBER_OF_SR_INSTANCES + 1U;
+    EXPECT_EQ(radef_kInvalidConfiguration, rarun_Init(&configuration));
+    configuration.number_of_shards = 3U;
+
+    configuration.shards[2].sr_instance = nullptr;
+    EXPECT_EQ(radef_kInvalidConfiguration, rarun_Init(&configuration));
+    configuration.shards[2].sr_instance = GetSrInstance(2U);
+
+    // the SafRetL instance of an unused shard is not checked
+    configuration.shards[3].sr_instance = nullptr;
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillOnce(Return(0U));
+    EXPECT_EQ(radef_kNoError, rarun_Init(&configuration));
+
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(0U, &number_of_shards));
+    EXPECT_EQ(2U, number_of_shards);
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(1U, &number_of_shards));
+    EXPECT_EQ(1U, number_of_shards);
+
+    EXPECT_EQ(radef_kAlreadyInitialized, rarun_Init(&configuration));
+
+    EXPECT_EQ(radef_kInvalidParameter, rarun_GetNumberOfShards(2U, &number_of_shards));
+    EXPECT_EQ(radef_kInvalidParameter, rarun_GetNumberOfShards(0U, nullptr));
+}
+
+/**
+ * @test        @ID{rarunTest002} Verify the run worker function.
+ *
+ * @details     This test verifies that a worker services its own shards within the service period.
+ *
+ * Test steps:
+ * - initialize the runtime
+ * - call the run worker function with invalid parameters and verify the invalid parameter error
+ * - run the first worker and verify that the timings of its two shards are checked
+ * - run the second worker and verify that the timings of the RedL and the SafRetL instance of its shard are checked and the shard handler is called
+ * - verify that no shard was stolen
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No preconditions for this test case.
+ * @post        The runtime is initialized.
+ *
+ * @testMethod  Functional Test
+
+ */
+TEST_F(rarunTest, rarunTest002VerifyRunWorkerFunction)
+{
+    uint32_t serviced_shards = 0U;
+    uint32_t number_of_shards = 0U;
+
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillRepeatedly(Return(10U));
+    EXPECT_EQ(radef_kNoError, rarun_Init(&configuration));
+
+    EXPECT_EQ(radef_kInvalidParameter, rarun_RunWorker(2U, &serviced_shards));
+    EXPECT_EQ(radef_kInvalidParameter, rarun_RunWorker(0U, nullptr));
+
+    {
+        InSequence s;
+        EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(0U))).WillOnce(Return(radef_kNoError));
+        EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(2U))).WillOnce(Return(radef_kNoError));
+    }
+    EXPECT_EQ(radef_kNoError, rarun_RunWorker(0U, &serviced_shards));
+    EXPECT_EQ(2U, serviced_shards);
+    EXPECT_TRUE(serviced_shard_ids.empty());
+
+    {
+        InSequence s;
+        EXPECT_CALL(redint_mock, redint_CheckTimings(GetRedInstance(1U))).WillOnce(Return(radef_kNoError));
+        EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(1U))).WillOnce(Return(radef_kNoError));
+    }
+    EXPECT_EQ(radef_kNoError, rarun_RunWorker(1U, &serviced_shards));
+    EXPECT_EQ(1U, serviced_shards);
+    EXPECT_EQ(std::vector<uint32_t>({1U}), serviced_shard_ids);
+
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(0U, &number_of_shards));
+    EXPECT_EQ(2U, number_of_shards);
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(1U, &number_of_shards));
+    EXPECT_EQ(1U, number_of_shards);
+}
+
+/**
+ * @test        @ID{rarunTest003} Verify the error handling of the run worker function.
+ *
+ * @details     This test verifies that the run worker function stops at the first error of the timing checks and returns it.
+ *
+ * Test steps:
+ * - initialize the runtime
+ * - let the RedL timing check of the second worker fail and verify that the SafRetL timing check and the shard handler are not called
+ * - let the SafRetL timing check of the first shard of the first worker fail and verify that the second shard is not serviced
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No preconditions for this test case.
+ * @post        The runtime is initialized.
+ *
+ * @testMethod  Functional Test
+
+ */
+TEST_F(rarunTest, rarunTest003VerifyRunWorkerErrorHandling)
+{
+    uint32_t serviced_shards = 0U;
+
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillRepeatedly(Return(10U));
+    EXPECT_EQ(radef_kNoError, rarun_Init(&configuration));
+
+    EXPECT_CALL(redint_mock, redint_CheckTimings(GetRedInstance(1U))).WillOnce(Return(radef_kNotInitialized));
+    EXPECT_EQ(radef_kNotInitialized, rarun_RunWorker(1U, &serviced_shards));
+    EXPECT_EQ(1U, serviced_shards);
+    EXPECT_TRUE(serviced_shard_ids.empty());
+
+    EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(0U))).WillOnce(Return(radef_kNotInitialized));
+    EXPECT_EQ(radef_kNotInitialized, rarun_RunWorker(0U, &serviced_shards));
+    EXPECT_EQ(1U, serviced_shards);
+}
+
+/**
+ * @test        @ID{rarunTest004} Verify the shard stealing.
+ *
+ * @details     This test verifies that a worker steals the shard, which is the longest behind the service period, from another worker.
+ *
+ * Test steps:
+ * - initialize the runtime at time 0
+ * - run the second worker after the service period and verify that it services its own shard and steals the first shard of the first worker
+ * - verify the number of shards of both workers
+ * - run the first worker and verify that it services its remaining shard only, because no shard is behind the service period
+ * - run the second worker exactly one service period after the servicing of the remaining shard of the first worker and verify that it services its
+ *   two shards, but does not steal the shard of the first worker, which is not behind the service period
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No preconditions for this test case.
+ * @post        The runtime is initialized.
+ *
+ * @testMethod  Functional Test
+
+ */
+TEST_F(rarunTest, rarunTest004VerifyShardStealing)
+{
+    uint32_t serviced_shards = 0U;
+    uint32_t number_of_shards = 0U;
+
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillOnce(Return(0U));
+    EXPECT_EQ(radef_kNoError, rarun_Init(&configuration));
+
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillRepeatedly(Return(kServicePeriod + 50U));
+    {
+        InSequence s;
+        EXPECT_CALL(redint_mock, redint_CheckTimings(GetRedInstance(1U))).WillOnce(Return(radef_kNoError));
+        EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(1U))).WillOnce(Return(radef_kNoError));
+        EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(0U))).WillOnce(Return(radef_kNoError));
+    }
+    EXPECT_EQ(radef_kNoError, rarun_RunWorker(1U, &serviced_shards));
+    EXPECT_EQ(2U, serviced_shards);
+
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(0U, &number_of_shards));
+    EXPECT_EQ(1U, number_of_shards);
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(1U, &number_of_shards));
+    EXPECT_EQ(2U, number_of_shards);
+
+    EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(2U))).WillOnce(Return(radef_kNoError));
+    EXPECT_EQ(radef_kNoError, rarun_RunWorker(0U, &serviced_shards));
+    EXPECT_EQ(1U, serviced_shards);
+
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillRepeatedly(Return((2U * kServicePeriod) + 50U));
+    {
+        InSequence s;
+        EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(0U))).WillOnce(Return(radef_kNoError));
+        EXPECT_CALL(redint_mock, redint_CheckTimings(GetRedInstance(1U))).WillOnce(Return(radef_kNoError));
+        EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(1U))).WillOnce(Return(radef_kNoError));
+    }
+    EXPECT_EQ(radef_kNoError, rarun_RunWorker(1U, &serviced_shards));
+    EXPECT_EQ(2U, serviced_shards);
+    EXPECT_EQ(std::vector<uint32_t>({1U, 1U}), serviced_shard_ids);
+
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(0U, &number_of_shards));
+    EXPECT_EQ(1U, number_of_shards);
+}
+
+/**
+ * @test        @ID{rarunTest005} Verify the shard stealing from a worker with as many shards.
+ *
+ * @details     This test verifies that a shard, which was not serviced within the service period, is stolen from a worker with as many shards as the own
+ *              worker and that the stolen shard is not stolen back within the cooldown of two service periods.
+ *
+ * Test steps:
+ * - initialize the runtime with two workers and two shards at time 0
+ * - run the first worker after the service period and verify that it services its own shard and steals the shard of the second worker
+ * - run the first worker again and let the timing check of its first shard fail, so that the stolen shard falls behind the service period
+ * - run the second worker within the cooldown and verify that it services no shard, because the stolen shard is not stolen back
+ * - run the second worker after the cooldown and verify that it steals the shard, which is still behind the service period
+ * - verify the number of shards of both workers after every run
+ * .
+ *
+ * @safetyRel   No
+ *
+ * @pre         No preconditions for this test case.
+ * @post        The runtime is initialized.
+ *
+ * @testMethod  Functional Test
+
+ */
+TEST_F(rarunTest, rarunTest005VerifyStealingFromEqualWorker)
+{
+    uint32_t serviced_shards = 0U;
+    uint32_t number_of_shards = 0U;
+    const uint32_t kStealTime = kServicePeriod + 50U;  // time at which the shard of the second worker is stolen
+
+    configuration.number_of_shards = 2U;
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillOnce(Return(0U));
+    EXPECT_EQ(radef_kNoError, rarun_Init(&configuration));
+
+    // the shard of the second worker is behind the service period and stolen, although both workers own one shard
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillRepeatedly(Return(kStealTime));
+    {
+        InSequence s;
+        EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(0U))).WillOnce(Return(radef_kNoError));
+        EXPECT_CALL(redint_mock, redint_CheckTimings(GetRedInstance(1U))).WillOnce(Return(radef_kNoError));
+        EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(1U))).WillOnce(Return(radef_kNoError));
+    }
+    EXPECT_EQ(radef_kNoError, rarun_RunWorker(0U, &serviced_shards));
+    EXPECT_EQ(2U, serviced_shards);
+
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(0U, &number_of_shards));
+    EXPECT_EQ(2U, number_of_shards);
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(1U, &number_of_shards));
+    EXPECT_EQ(0U, number_of_shards);
+
+    // the first worker stops its round at an error, so that the stolen shard falls behind the service period
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillRepeatedly(Return(kStealTime + kServicePeriod));
+    EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(0U))).WillOnce(Return(radef_kNotInitialized));
+    EXPECT_EQ(radef_kNotInitialized, rarun_RunWorker(0U, &serviced_shards));
+    EXPECT_EQ(1U, serviced_shards);
+
+    // the stolen shard is behind the service period, but it is not stolen back within the cooldown
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillRepeatedly(Return(kStealTime + (2U * kServicePeriod) - 1U));
+    EXPECT_EQ(radef_kNoError, rarun_RunWorker(1U, &serviced_shards));
+    EXPECT_EQ(0U, serviced_shards);
+
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(0U, &number_of_shards));
+    EXPECT_EQ(2U, number_of_shards);
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(1U, &number_of_shards));
+    EXPECT_EQ(0U, number_of_shards);
+
+    // after the cooldown the shard, which is still behind the service period, is stolen again
+    EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillRepeatedly(Return(kStealTime + (2U * kServicePeriod)));
+    {
+        InSequence s;
+        EXPECT_CALL(redint_mock, redint_CheckTimings(GetRedInstance(1U))).WillOnce(Return(radef_kNoError));
+        EXPECT_CALL(srapi_mock, srapi_CheckTimings(GetSrInstance(1U))).WillOnce(Return(radef_kNoError));
+    }
+    EXPECT_EQ(radef_kNoError, rarun_RunWorker(1U, &serviced_shards));
+    EXPECT_EQ(1U, serviced_shards);
+    EXPECT_EQ(std::vector<uint32_t>({1U, 1U}), serviced_shard_ids);
+
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(0U, &number_of_shards));
+    EXPECT_EQ(1U, number_of_shards);
+    EXPECT_EQ(radef_kNoError, rarun_GetNumberOfShards(1U, &number_of_shards));
+    EXPECT_EQ(1U, number_of_shards);
+}
+
+/** @}*/
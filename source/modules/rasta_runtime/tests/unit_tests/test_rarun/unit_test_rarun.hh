@@ -0,0 +1,134 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_rarun.hh
+ *
+ * @author Nicola Fricker, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Header file for unit tests of the runtime module.
+ */
+
+#ifndef SOURCE_MODULES_RASTA_RUNTIME_TESTS_UNIT_TESTS_TEST_RARUN_UNIT_TEST_RARUN_HH_
+#define SOURCE_MODULES_RASTA_RUNTIME_TESTS_UNIT_TESTS_TEST_RARUN_UNIT_TEST_RARUN_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+// clang-format off
+#include <vector>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "rasta_runtime/rarun_rasta_runtime.h"
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasys_mock.hh"
+#include "redint_mock.hh"
+#include "srapi_mock.hh"
+// clang-format on
+
+using testing::_;
+using testing::InSequence;
+using testing::Return;
+using testing::StrictMock;
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+extern bool rarun_initialized;  ///< initialization state of the runtime
+
+/**
+ * @brief Shards serviced by the shard handler, in the order of the handler calls
+ */
+extern std::vector<uint32_t> serviced_shard_ids;
+
+// -----------------------------------------------------------------------------
+// Test class definiton
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test fixture class for the runtime module
+ *
+ */
+class rarunTest : public ::testing::Test
+{
+public:
+    rarunTest()
+    {
+        // reset the initialization state and the handler calls
+        rarun_initialized = false;
+        serviced_shard_ids.clear();
+
+        // configuration with two workers and three shards, only the second shard has a RedL instance and a handler
+        configuration.number_of_workers = 2U;
+        configuration.number_of_shards = 3U;
+        configuration.service_period = kServicePeriod;
+        for (uint32_t shard_id = 0U; shard_id < RADEF_MAX_NUMBER_OF_SR_INSTANCES; shard_id++)
+        {
+            configuration.shards[shard_id].sr_instance = GetSrInstance(shard_id);
+            configuration.shards[shard_id].red_instance = nullptr;
+            configuration.shards[shard_id].handler = nullptr;
+        }
+        configuration.shards[1].red_instance = GetRedInstance(1U);
+        configuration.shards[1].handler = ShardHandler;
+    }
+    ~rarunTest()
+    {
+
+    }
+
+    /**
+    * @brief Get a SafRetL instance pointer for a shard
+    * The instances are never dereferenced by the runtime, so the address of a dummy variable is used.
+    *
+    * @param shard_id shard identification
+    * @return SafRetL instance pointer
+    */
+    srapi_Instance *GetSrInstance(const uint32_t shard_id)
+    {
+        return reinterpret_cast<srapi_Instance *>(&sr_instances[shard_id]);
+    }
+
+    /**
+    * @brief Get a RedL instance pointer for a shard
+    *
+    * @param shard_id shard identification
+    * @return RedL instance pointer
+    */
+    redint_Instance *GetRedInstance(const uint32_t shard_id)
+    {
+        return reinterpret_cast<redint_Instance *>(&red_instances[shard_id]);
+    }
+
+    /**
+    * @brief Shard handler, which records the serviced shard
+    *
+    * @param shard_id shard identification
+    * @param sr_instance SafRetL instance of the shard
+    */
+    static void ShardHandler(const uint32_t shard_id, srapi_Instance *const sr_instance)
+    {
+        (void)sr_instance;
+        serviced_shard_ids.push_back(shard_id);
+    }
+
+    static const uint32_t kServicePeriod = 100U;                 ///< service period of the test configuration [ms]
+
+    uint32_t sr_instances[RADEF_MAX_NUMBER_OF_SR_INSTANCES];    ///< dummy SafRetL instances
+    uint32_t red_instances[RADEF_MAX_NUMBER_OF_SR_INSTANCES];   ///< dummy RedL instances
+    rarun_RuntimeConfiguration configuration = {};              ///< runtime configuration
+
+    StrictMock<rasysMock>   rasys_mock;         ///< mock for the rasta system adapter class
+    StrictMock<redintMock>  redint_mock;        ///< mock for the redundancy interface class
+    StrictMock<srapiMock>   srapi_mock;         ///< mock for the safety and retransmission api class
+};
+
+#endif  // SOURCE_MODULES_RASTA_RUNTIME_TESTS_UNIT_TESTS_TEST_RARUN_UNIT_TEST_RARUN_HH_
@@ -0,0 +1,336 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srapi_benchmark.cc
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Load benchmark of the safety and retransmission layer with the maximum number of connections.
+ *
+ * The benchmark initializes one SafRetL instance with ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS connections (5000 in the benchmark build). The connections
+ * are looped back in pairs by the adapter of the benchmark, so that no RedL and no network is needed. The benchmark measures the time of ::srapi_Init, the
+ * time to establish all connections, the time of a ::srapi_CheckTimings call with all connections up and without traffic (timing loop), and the time per
+ * data message, when every client connection sends data to its server connection (send loop). For meaningful results, the benchmark must be built with
+ * CMAKE_BUILD_TYPE=Release.
+ *
+ * Usage: srapi_benchmark [duration_in_ms]
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/rasys_rasta_system_adapter.h"
+#include "rasta_safety_retransmission/sradin_sr_adapter_interface.h"
+#include "rasta_safety_retransmission/sradno_sr_adapter_notifications.h"
+#include "rasta_safety_retransmission/srapi_sr_api.h"
+#include "rasta_safety_retransmission/srnot_sr_notifications.h"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Number of connections of the benchmark, every client connection is looped back to the following server connection.
+ */
+#define NUMBER_OF_CONNECTIONS (RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)
+
+/**
+ * @brief Payload size of the data messages [bytes].
+ */
+#define PAYLOAD_SIZE (64U)
+
+/**
+ * @brief Maximum time to establish all connections [ms].
+ */
+#define CONNECTION_TIMEOUT (5000U)
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+srcty_SafetyRetransmissionConfiguration sr_configuration;                                  ///< SafRetL configuration
+srapi_Instance *sr_instance = nullptr;                                                     ///< SafRetL instance of the benchmark
+std::vector<std::deque<std::vector<uint8_t>>> queues(NUMBER_OF_CONNECTIONS);              ///< Messages waiting on every redundancy channel
+std::vector<uint32_t> notified_channels;                                                   ///< Redundancy channels with a not yet notified message
+uint32_t connections_up = 0U;                                                              ///< Number of connections in the state up
+const std::chrono::steady_clock::time_point kStartTime = std::chrono::steady_clock::now();  ///< Reference time of the timer
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Get the sender id of a connection, the receiver id is the sender id of the looped back connection.
+ */
+uint32_t GetSenderId(const uint32_t connection_id) {
+  return connection_id + 1U;
+}
+
+/**
+ * @brief Get the elapsed time since a time point [us].
+ */
+double GetMicroseconds(const std::chrono::steady_clock::time_point begin) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+}
+
+/**
+ * @brief Initialize the SafRetL instance with all connections.
+ */
+void Init() {
+  std::memset(&sr_configuration, 0, sizeof(sr_configuration));
+  sr_configuration.rasta_network_id = 1U;
+  sr_configuration.t_max = 1800U;
+  sr_configuration.t_h = 300U;
+  sr_configuration.safety_code_type = srcty_kSafetyCodeTypeLowerMd4;
+  sr_configuration.m_w_a = 2U;
+  sr_configuration.n_send_max = 3U;
+  sr_configuration.n_max_packet = 1U;
+  sr_configuration.n_diag_window = 5000U;
+  sr_configuration.number_of_connections = NUMBER_OF_CONNECTIONS;
+  for (uint32_t connection_id = 0U; connection_id < NUMBER_OF_CONNECTIONS; ++connection_id) {
+    sr_configuration.connection_configurations[connection_id] = {connection_id, GetSenderId(connection_id), GetSenderId(connection_id ^ 1U)};
+  }
+  sr_configuration.md4_initial_value = {0x67452301U, 0xEFCDAB89U, 0x98BADCFEU, 0x10325476U};
+  for (uint32_t index = 0U; index < RADEF_DIAGNOSTIC_TIMING_DISTRIBUTION_ARRAY_SIZE; ++index) {
+    sr_configuration.diag_timing_distr_intervals[index] = (index + 1U) * 300U;
+  }
+
+  const std::chrono::steady_clock::time_point kBegin = std::chrono::steady_clock::now();
+  uint32_t connection_memory_size = 0U;
+  if (srapi_GetConnectionMemorySize(NUMBER_OF_CONNECTIONS, &connection_memory_size) != radef_kNoError) {
+    std::fprintf(stderr, "Connection memory size of %u connections not available\n", NUMBER_OF_CONNECTIONS);
+    std::exit(EXIT_FAILURE);
+  }
+  // Allocated once for the whole run of the benchmark
+  void *const connection_memory = std::calloc(1U, connection_memory_size + SRATY_CONNECTION_MEMORY_ALIGNMENT);
+  const uintptr_t kAlignedAddress = (reinterpret_cast<uintptr_t>(connection_memory) + SRATY_CONNECTION_MEMORY_ALIGNMENT - 1U) &
+                                    ~static_cast<uintptr_t>(SRATY_CONNECTION_MEMORY_ALIGNMENT - 1U);
+  if (srapi_Init(&sr_configuration, reinterpret_cast<void *>(kAlignedAddress), connection_memory_size, &sr_instance) != radef_kNoError) {
+    std::fprintf(stderr, "SafRetL initialization with %u connections failed\n", NUMBER_OF_CONNECTIONS);
+    std::exit(EXIT_FAILURE);
+  }
+  std::printf("connections: %u, connection memory: %u bytes, init: %.0f us\n", NUMBER_OF_CONNECTIONS, connection_memory_size, GetMicroseconds(kBegin));
+}
+
+/**
+ * @brief Notify the SafRetL of the looped back messages. The messages sent while notifying are delivered with the next call, like after a network round trip.
+ */
+void DeliverMessages() {
+  std::vector<uint32_t> channels;
+  channels.swap(notified_channels);
+  for (const uint32_t kChannel : channels) {
+    sradno_MessageReceivedNotification(sr_instance, kChannel);
+  }
+}
+
+/**
+ * @brief Open all connections and run the SafRetL, until all connections are up.
+ */
+void EstablishConnections() {
+  const std::chrono::steady_clock::time_point kBegin = std::chrono::steady_clock::now();
+  for (uint32_t connection_id = 0U; connection_id < NUMBER_OF_CONNECTIONS; ++connection_id) {
+    uint32_t opened_connection_id = 0U;
+    if (srapi_OpenConnection(sr_instance, GetSenderId(connection_id), GetSenderId(connection_id ^ 1U), 1U, &opened_connection_id) != radef_kNoError) {
+      std::fprintf(stderr, "Opening connection %u failed\n", connection_id);
+      std::exit(EXIT_FAILURE);
+    }
+  }
+
+  const std::chrono::steady_clock::time_point kTimeout = kBegin + std::chrono::milliseconds(CONNECTION_TIMEOUT);
+  while (connections_up < NUMBER_OF_CONNECTIONS) {
+    DeliverMessages();
+    srapi_CheckTimings(sr_instance);
+    if (std::chrono::steady_clock::now() > kTimeout) {
+      std::fprintf(stderr, "Only %u of %u connections established\n", connections_up, NUMBER_OF_CONNECTIONS);
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  std::printf("connection establishment: %.0f us\n", GetMicroseconds(kBegin));
+}
+
+/**
+ * @brief Run the timing loop without traffic and measure the time of a check timings call.
+ */
+void MeasureTimingLoop(const uint32_t duration) {
+  uint64_t number_of_calls = 0U;
+  const std::chrono::steady_clock::time_point kBegin = std::chrono::steady_clock::now();
+  const std::chrono::steady_clock::time_point kEnd = kBegin + std::chrono::milliseconds(duration);
+  while (std::chrono::steady_clock::now() < kEnd) {
+    // The heartbeats are looped back as well
+    DeliverMessages();
+    srapi_CheckTimings(sr_instance);
+    ++number_of_calls;
+  }
+  const double kMicroseconds = GetMicroseconds(kBegin) / static_cast<double>(number_of_calls);
+  std::printf("timing loop: %.1f us per call, %.1f ns per connection\n", kMicroseconds, (kMicroseconds * 1000.0) / NUMBER_OF_CONNECTIONS);
+}
+
+/**
+ * @brief Run the send loop, in which every client connection sends data messages to its server connection, and measure the time per data message.
+ */
+void MeasureSendLoop(const uint32_t duration) {
+  const uint8_t kPayload[PAYLOAD_SIZE] = {0U};
+  uint8_t buffer[RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE];
+  uint64_t sent_messages = 0U;
+  uint64_t received_messages = 0U;
+
+  const std::chrono::steady_clock::time_point kBegin = std::chrono::steady_clock::now();
+  const std::chrono::steady_clock::time_point kEnd = kBegin + std::chrono::milliseconds(duration);
+  while (std::chrono::steady_clock::now() < kEnd) {
+    for (uint32_t connection_id = 0U; connection_id < NUMBER_OF_CONNECTIONS; connection_id += 2U) {
+      sraty_ConnectionStates state = sraty_kConnectionNotInitialized;
+      sraty_BufferUtilisation buffer_utilisation = {};
+      uint16_t opposite_buffer_size = 0U;
+      srapi_GetConnectionState(sr_instance, connection_id, &state, &buffer_utilisation, &opposite_buffer_size);
+      // The entries needed to receive a retransmission request are left free
+      if ((state == sraty_kConnectionUp) && (buffer_utilisation.send_buffer_free > srcty_kMinFreeEntriesSendBufferForRetr) &&
+          (srapi_SendData(sr_instance, connection_id, sizeof(kPayload), kPayload) == radef_kNoError)) {
+        ++sent_messages;
+      }
+    }
+
+    DeliverMessages();
+    srapi_CheckTimings(sr_instance);
+
+    for (uint32_t connection_id = 1U; connection_id < NUMBER_OF_CONNECTIONS; connection_id += 2U) {
+      uint16_t message_size = 0U;
+      while (srapi_ReadData(sr_instance, connection_id, sizeof(buffer), &message_size, buffer) == radef_kNoError) {
+        ++received_messages;
+      }
+    }
+  }
+  const double kMicroseconds = GetMicroseconds(kBegin);
+  std::printf("send loop: %llu sent, %llu received, %.0f received messages/s, %.1f us per received message\n", static_cast<unsigned long long>(sent_messages),
+              static_cast<unsigned long long>(received_messages), (static_cast<double>(received_messages) * 1.0e6) / kMicroseconds,
+              kMicroseconds / static_cast<double>(received_messages));
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// Adapter, notification and system adapter functions of the benchmark
+// -----------------------------------------------------------------------------
+
+extern "C" {
+
+void sradin_Init(void) {}
+
+void sradin_OpenRedundancyChannel(srapi_Instance *const instance, const uint32_t redundancy_channel_id) {
+  (void)instance;
+  (void)redundancy_channel_id;
+}
+
+void sradin_CloseRedundancyChannel(srapi_Instance *const instance, const uint32_t redundancy_channel_id) {
+  (void)instance;
+  (void)redundancy_channel_id;
+}
+
+void sradin_SendMessage(srapi_Instance *const instance, const uint32_t redundancy_channel_id, const uint16_t message_size, const uint8_t *const message_data) {
+  // Loop back to the other connection of the pair, the notification is delivered by the benchmark loop
+  (void)instance;
+  const uint32_t kChannel = redundancy_channel_id ^ 1U;
+  if (queues[kChannel].empty()) {
+    notified_channels.push_back(kChannel);
+  }
+  queues[kChannel].emplace_back(message_data, message_data + message_size);
+}
+
+radef_RaStaReturnCode sradin_ReadMessage(srapi_Instance *const instance, const uint32_t redundancy_channel_id, const uint16_t buffer_size,
+                                         uint16_t *const message_size, uint8_t *const message_buffer) {
+  (void)instance;
+  std::deque<std::vector<uint8_t>> &queue = queues[redundancy_channel_id];
+  if (queue.empty() || (queue.front().size() > buffer_size)) {
+    return radef_kNoMessageReceived;
+  }
+  *message_size = static_cast<uint16_t>(queue.front().size());
+  std::memcpy(message_buffer, queue.front().data(), queue.front().size());
+  queue.pop_front();
+  return radef_kNoError;
+}
+
+void srnot_MessageReceivedNotification(srapi_Instance *const instance, const uint32_t connection_id) {
+  (void)instance;
+  (void)connection_id;
+}
+
+void srnot_ConnectionStateNotification(srapi_Instance *const instance, const uint32_t connection_id, const sraty_ConnectionStates connection_state,
+                                       const sraty_BufferUtilisation buffer_utilisation, const uint16_t opposite_buffer_size,
+                                       const sraty_DiscReason disconnect_reason, const uint16_t detailed_disconnect_reason) {
+  (void)instance;
+  (void)buffer_utilisation;
+  (void)opposite_buffer_size;
+  (void)detailed_disconnect_reason;
+  if (connection_state == sraty_kConnectionUp) {
+    ++connections_up;
+  } else if (connection_state == sraty_kConnectionClosed) {
+    std::fprintf(stderr, "Connection %u closed, reason %d\n", connection_id, static_cast<int>(disconnect_reason));
+    std::exit(EXIT_FAILURE);
+  } else {
+    // Connection establishment in progress
+  }
+}
+
+void srnot_SrDiagnosticNotification(srapi_Instance *const instance, const uint32_t connection_id,
+                                    const sraty_ConnectionDiagnosticData connection_diagnostic_data) {
+  (void)instance;
+  (void)connection_id;
+  (void)connection_diagnostic_data;
+}
+
+void srnot_RedDiagnosticNotification(srapi_Instance *const instance, const uint32_t connection_id,
+                                     const sraty_RedundancyChannelDiagnosticData redundancy_channel_diagnostic_data) {
+  (void)instance;
+  (void)connection_id;
+  (void)redundancy_channel_diagnostic_data;
+}
+
+uint32_t rasys_GetTimerValue(void) {
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - kStartTime).count());
+}
+
+uint32_t rasys_GetTimerGranularity(void) {
+  return 1U;
+}
+
+uint32_t rasys_GetRandomNumber(void) {
+  return 0x5A5A5A5AU;
+}
+
+void rasys_FatalError(const radef_RaStaReturnCode error_reason) {
+  std::fprintf(stderr, "Fatal error %d\n", static_cast<int>(error_reason));
+  std::abort();
+}
+}
+
+// -----------------------------------------------------------------------------
+// Main
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+  const uint32_t kDuration = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 1000U;
+
+  Init();
+  EstablishConnections();
+  MeasureTimingLoop(kDuration);
+  MeasureSendLoop(kDuration);
+
+  return 0;
+}
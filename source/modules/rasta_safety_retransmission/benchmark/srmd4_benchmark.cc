@@ -0,0 +1,198 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srmd4_benchmark.cc
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Microbenchmark of the MD4 calculation of the safety and retransmission layer.
+ *
+ * The benchmark calculates the MD4 of a group of messages with ::srmd4_CalculateMd4 (one message after the other) and with ::srmd4_CalculateMd4Batch (all
+ * messages of the group at once), for several message sizes from a heartbeat up to a data message with the maximum payload. For every message size, the
+ * time and the TSC cycles (on x86-64) per message byte are reported together with the speedup of the batch calculation. The results of both calculations are
+ * compared, before the measurement starts. The srmd4_benchmark_portable build of the benchmark calculates the batch without the SSE2 lanes. For
+ * meaningful results, the benchmark must be built with CMAKE_BUILD_TYPE=Release.
+ *
+ * Usage: srmd4_benchmark [duration_in_ms]
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/rasys_rasta_system_adapter.h"
+#include "srmd4_sr_md4.h"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Number of messages, whose MD4 is calculated together.
+ */
+#define NUMBER_OF_MESSAGES (8U)
+
+/**
+ * @brief Number of calculations between two reads of the clock.
+ */
+#define CALCULATIONS_PER_CLOCK_READ (64U)
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+namespace {
+
+/**
+ * @brief Result of a measurement.
+ */
+struct Measurement {
+  double nanoseconds_per_byte = 0.0;  ///< Time per message byte [ns]
+  double cycles_per_byte = 0.0;       ///< TSC cycles per message byte, 0 if the TSC is not available
+};
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+const srcty_Md4InitValue kMd4InitialValue = {0x67452301U, 0xEFCDAB89U, 0x98BADCFEU, 0x10325476U};  ///< MD4 initial value of RFC 1320
+const std::array<uint16_t, 6U> kDataSizes = {28U, 64U, 128U, 256U, 512U, 1085U};                   ///< Message sizes without safety code [bytes]
+
+std::array<std::array<uint8_t, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE>, NUMBER_OF_MESSAGES> messages;  ///< Message data
+std::array<srmd4_Md4, NUMBER_OF_MESSAGES> md4s;                                                      ///< Calculated MD4 of every message
+std::array<srmd4_Md4BatchEntry, NUMBER_OF_MESSAGES> batch_entries;                                   ///< Batch entries of all messages
+volatile uint8_t md4_sink = 0U;  ///< Keeps the calculated MD4s alive
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Read the time stamp counter, 0 if not available.
+ */
+uint64_t ReadCycles() {
+#if defined(__x86_64__)
+  return __rdtsc();
+#else
+  return 0U;
+#endif
+}
+
+/**
+ * @brief Calculate the MD4 of all messages one after the other.
+ */
+void CalculateSingle(const uint16_t data_size) {
+  for (uint32_t message = 0U; message < NUMBER_OF_MESSAGES; ++message) {
+    srmd4_CalculateMd4(kMd4InitialValue, data_size, messages[message].data(), &md4s[message]);
+  }
+}
+
+/**
+ * @brief Calculate the MD4 of all messages at once.
+ */
+void CalculateBatch(const uint16_t data_size) {
+  for (uint32_t message = 0U; message < NUMBER_OF_MESSAGES; ++message) {
+    batch_entries[message] = {data_size, messages[message].data(), &md4s[message]};
+  }
+  srmd4_CalculateMd4Batch(kMd4InitialValue, NUMBER_OF_MESSAGES, batch_entries.data());
+}
+
+/**
+ * @brief Verify that the single and the batch calculation calculate the same MD4s.
+ */
+void VerifyBatch(const uint16_t data_size) {
+  std::array<srmd4_Md4, NUMBER_OF_MESSAGES> single_md4s = {};
+  CalculateSingle(data_size);
+  single_md4s = md4s;
+  std::memset(md4s.data(), 0, sizeof(md4s));
+  CalculateBatch(data_size);
+  if (std::memcmp(single_md4s.data(), md4s.data(), sizeof(md4s)) != 0) {
+    std::fprintf(stderr, "MD4 of the batch calculation differs for data size %u\n", data_size);
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+/**
+ * @brief Repeat a calculation of all messages for a duration and measure the time and cycles per message byte.
+ */
+template <typename Calculation>
+Measurement Measure(const Calculation &calculation, const uint16_t data_size, const uint32_t duration) {
+  // Warm up the caches and the branch predictors
+  for (uint32_t calculation_index = 0U; calculation_index < CALCULATIONS_PER_CLOCK_READ; ++calculation_index) {
+    calculation(data_size);
+  }
+
+  uint64_t number_of_calculations = 0U;
+  const std::chrono::steady_clock::time_point kBegin = std::chrono::steady_clock::now();
+  const std::chrono::steady_clock::time_point kEnd = kBegin + std::chrono::milliseconds(duration);
+  const uint64_t kBeginCycles = ReadCycles();
+  std::chrono::steady_clock::time_point now = kBegin;
+  while (now < kEnd) {
+    for (uint32_t calculation_index = 0U; calculation_index < CALCULATIONS_PER_CLOCK_READ; ++calculation_index) {
+      calculation(data_size);
+      md4_sink = static_cast<uint8_t>(md4_sink ^ md4s[0U].md4[0U]);
+    }
+    number_of_calculations += CALCULATIONS_PER_CLOCK_READ;
+    now = std::chrono::steady_clock::now();
+  }
+  const uint64_t kCycles = ReadCycles() - kBeginCycles;
+
+  const double kBytes = static_cast<double>(number_of_calculations) * NUMBER_OF_MESSAGES * data_size;
+  Measurement measurement;
+  measurement.nanoseconds_per_byte = std::chrono::duration<double, std::nano>(now - kBegin).count() / kBytes;
+  measurement.cycles_per_byte = static_cast<double>(kCycles) / kBytes;
+  return measurement;
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// System adapter functions of the benchmark
+// -----------------------------------------------------------------------------
+
+extern "C" {
+void rasys_FatalError(const radef_RaStaReturnCode error_reason) {
+  std::fprintf(stderr, "Fatal error %d\n", static_cast<int>(error_reason));
+  std::abort();
+}
+}
+
+// -----------------------------------------------------------------------------
+// Main
+// -----------------------------------------------------------------------------
+
+int main(int argc, char *argv[]) {
+  const uint32_t kDuration = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 200U;
+
+  for (uint32_t message = 0U; message < NUMBER_OF_MESSAGES; ++message) {
+    for (uint32_t index = 0U; index < messages[message].size(); ++index) {
+      messages[message][index] = static_cast<uint8_t>((message * 31U) + index);
+    }
+  }
+
+  std::printf("messages per calculation: %u\n", NUMBER_OF_MESSAGES);
+  std::printf("%10s %14s %14s %14s %14s %8s\n", "data size", "single ns/B", "single cyc/B", "batch ns/B", "batch cyc/B", "speedup");
+  for (const uint16_t kDataSize : kDataSizes) {
+    VerifyBatch(kDataSize);
+    const Measurement kSingle = Measure(CalculateSingle, kDataSize, kDuration);
+    const Measurement kBatch = Measure(CalculateBatch, kDataSize, kDuration);
+    std::printf("%10u %14.3f %14.3f %14.3f %14.3f %8.2f\n", kDataSize, kSingle.nanoseconds_per_byte, kSingle.cycles_per_byte, kBatch.nanoseconds_per_byte,
+                kBatch.cycles_per_byte, kSingle.nanoseconds_per_byte / kBatch.nanoseconds_per_byte);
+  }
+
+  return 0;
+}
@@ -31,6 +31,7 @@
 #include <stdint.h>
 
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_safety_retransmission/sraty_sr_api_types.h"
 
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
@@ -74,9 +75,11 @@ void sradin_Init(void);
  * @implementsReq{RASW-369} Open Redundancy Channel Function Structure
  * @implementsReq{RASW-367} Redundancy Channel Id
  *
+ * @param [in] instance Handle of the SafRetL instance, which uses the redundancy channel. The SafRetL adapter uses it to map the redundancy channel id to the
+ * redundancy channel of the RedL instance assigned to this SafRetL instance.
  * @param [in] redundancy_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of redundancy channels.
  */
-void sradin_OpenRedundancyChannel(const uint32_t redundancy_channel_id);
+void sradin_OpenRedundancyChannel(srapi_Instance* const instance, const uint32_t redundancy_channel_id);
 
 /**
  * @brief Close a redundancy channel.
@@ -90,9 +93,11 @@ void sradin_OpenRedundancyChannel(const uint32_t redundancy_channel_id);
  * @implementsReq{RASW-368} Close Redundancy Channel Function Structure
  * @implementsReq{RASW-367} Redundancy Channel Id
  *
+ * @param [in] instance Handle of the SafRetL instance, which uses the redundancy channel. The SafRetL adapter uses it to map the redundancy channel id to the
+ * redundancy channel of the RedL instance assigned to this SafRetL instance.
  * @param [in] redundancy_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of redundancy channels.
  */
-void sradin_CloseRedundancyChannel(const uint32_t redundancy_channel_id);
+void sradin_CloseRedundancyChannel(srapi_Instance* const instance, const uint32_t redundancy_channel_id);
 
 /**
  * @brief Send a message over a redundancy channel.
@@ -108,12 +113,14 @@ void sradin_CloseRedundancyChannel(const uint32_t redundancy_channel_id);
  * @implementsReq{RASW-387} Message Size
  * @implementsReq{RASW-385} Message Data
  *
+ * @param [in] instance Handle of the SafRetL instance, which uses the redundancy channel. The SafRetL adapter uses it to map the redundancy channel id to the
+ * redundancy channel of the RedL instance assigned to this SafRetL instance.
  * @param [in] redundancy_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of redundancy channels.
  * @param [in] message_size Size of the message data [bytes]. Valid range: ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE <= value <=
  * ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE.
  * @param [in] message_data Pointer to message data array. For the message data the full value range is valid and usable.
  */
-void sradin_SendMessage(const uint32_t redundancy_channel_id, const uint16_t message_size, const uint8_t* const message_data);
+void sradin_SendMessage(srapi_Instance* const instance, const uint32_t redundancy_channel_id, const uint16_t message_size, const uint8_t* const message_data);
 
 /**
  * @brief Read a received message from a redundancy channel.
@@ -130,6 +137,8 @@ void sradin_SendMessage(const uint32_t redundancy_channel_id, const uint16_t mes
  * @implementsReq{RASW-374} Error Code
  * @implementsReq{RASW-503} Enum RaSta Return Code Usage
  *
+ * @param [in] instance Handle of the SafRetL instance, which uses the redundancy channel. The SafRetL adapter uses it to map the redundancy channel id to the
+ * redundancy channel of the RedL instance assigned to this SafRetL instance.
  * @param [in] redundancy_channel_id Redundancy channel identification. Valid range: 0 <= value < configured number of redundancy channels.
  * @param [in] buffer_size Size of the buffer provided to parameter message_buffer [bytes]. Valid range: ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE <= value <=
  * ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE. Any value in this range can be used, must be large enough to store the received message.
@@ -138,8 +147,8 @@ void sradin_SendMessage(const uint32_t redundancy_channel_id, const uint16_t mes
  * @return radef_kNoError -> successful operation
  * @return radef_kNoMessageReceived -> no message received (used for polling)
  */
-radef_RaStaReturnCode sradin_ReadMessage(const uint32_t redundancy_channel_id, const uint16_t buffer_size, uint16_t* const message_size,
-                                         uint8_t* const message_buffer);
+radef_RaStaReturnCode sradin_ReadMessage(srapi_Instance* const instance, const uint32_t redundancy_channel_id, const uint16_t buffer_size,
+                                         uint16_t* const message_size, uint8_t* const message_buffer);
 
 /** @}*/
 
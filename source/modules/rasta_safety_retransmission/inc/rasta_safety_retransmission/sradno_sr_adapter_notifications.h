@@ -32,6 +32,7 @@
 #include <stdint.h>
 
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_safety_retransmission/sraty_sr_api_types.h"
 
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
@@ -69,11 +70,12 @@ extern "C" {
  * @implementsReq{RASW-747} Message Received Notification Sequence
  * @implementsReq{RASW-769} Received Message Polling Sequence
  *
+ * @param [in] instance Handle of the SafRetL instance, which uses the redundancy channel. If the pointer is NULL, a ::radef_kInvalidParameter is returned.
  * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
  * @return ::radef_kNoError -> successful operation
  * @return ::radef_kInvalidParameter -> invalid parameter
  */
-radef_RaStaReturnCode sradno_MessageReceivedNotification(const uint32_t red_channel_id);
+radef_RaStaReturnCode sradno_MessageReceivedNotification(srapi_Instance *const instance, const uint32_t red_channel_id);
 
 /**
  * @brief Diagnostic notification from the RedL.
@@ -91,13 +93,14 @@ radef_RaStaReturnCode sradno_MessageReceivedNotification(const uint32_t red_chan
  * @implementsReq{RASW-503} Enum RaSta Return Code Usage
  * @implementsReq{RASW-751} Redundancy Diagnostic Notification Sequence
  *
+ * @param [in] instance Handle of the SafRetL instance, which uses the redundancy channel. If the pointer is NULL, a ::radef_kInvalidParameter is returned.
  * @param [in] red_channel_id Redundancy channel identification. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
  * @param [in] tr_channel_id Transport channel identification. The full value range is valid and usable.
  * @param [in] tr_channel_diagnostic_data Transport channel diagnostic data. Structure and valid ranges can be found in ::radef_TransportChannelDiagnosticData.
  * @return ::radef_kNoError -> successful operation
  * @return ::radef_kInvalidParameter -> invalid parameter
  */
-radef_RaStaReturnCode sradno_DiagnosticNotification(const uint32_t red_channel_id, const uint32_t tr_channel_id,
+radef_RaStaReturnCode sradno_DiagnosticNotification(srapi_Instance *const instance, const uint32_t red_channel_id, const uint32_t tr_channel_id,
                                                     const radef_TransportChannelDiagnosticData tr_channel_diagnostic_data);
 
 /** @}*/
@@ -53,12 +53,33 @@
 extern "C" {
 #endif  // __cplusplus
 
+/**
+ * @brief Get the size of the connection memory needed by the SafRetL.
+ *
+ * This function is used to get the size of the connection memory, which must be passed to ::srapi_Init for a number of connections. The per connection data
+ * of all SafRetL modules is allocated from this memory, so that the used memory grows with the configured number of connections. This function can be used
+ * before the initialization of the SafRetL.
+ *
+ * @param [in] number_of_connections Number of configured connections. Valid range: ::srcty_kMinNumberOfRaStaConnections <= value <=
+ * ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS. For any other value a ::radef_kInvalidParameter error is returned.
+ * @param [out] connection_memory_size Pointer to the size of the needed connection memory [bytes]. If the pointer is NULL, a ::radef_kInvalidParameter error
+ * is returned.
+ * @return ::radef_kNoError -> size of the connection memory returned
+ * @return ::radef_kInvalidParameter -> invalid parameter
+ */
+radef_RaStaReturnCode srapi_GetConnectionMemorySize(const uint32_t number_of_connections, uint32_t *const connection_memory_size);
+
 /**
  * @brief Initialize SafRetL.
  *
- * This function is used to initialize the sr_api module. If the sr_api module is already initalized, a ::radef_kAlreadyInitialized error is returned. After
- * checking the configuration for validity, the pointer to the configuration is saved internally. If it is not valid, a radef_kInvalidConfiguration is returned.
- * The configuration is then used to initialize the state machine and the core module.
+ * This function is used to initialize a new SafRetL instance. If all ::RADEF_MAX_NUMBER_OF_SR_INSTANCES instances are already initialized, a
+ * ::radef_kAlreadyInitialized error is returned. After checking the configuration for validity, the pointer to the configuration is saved in the instance. If
+ * it is not valid, a radef_kInvalidConfiguration is returned. The configuration is then used to initialize the state machine and the core module of the
+ * instance. The per connection data of the configured connections is allocated from the connection memory, which is provided by the application and must not
+ * be used otherwise as long as the instance is in use. Every instance needs its own configuration and connection memory. If the share of the message slab
+ * chunks per connection can not take n_send_max messages and the entries kept free for a retransmission, a ::radef_kInvalidParameter is returned, see
+ * ::RADEF_SLAB_NUMBER_OF_LARGE_CHUNKS. The handle of the initialized instance is returned to the application, which passes it to all other SafRetL API
+ * functions.
  *
  * @implementsReq{RASW-544} Init sr_api Function
  * @implementsReq{RASW-267} Initialization Function Structure
@@ -69,32 +90,39 @@ extern "C" {
  *
  * @param [in] safety_retransmission_configuration Pointer to SafRetL configuration. More details about valid configuration can be found
  * directly in ::srcty_SafetyRetransmissionConfiguration. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
+ * @param [in] connection_memory Pointer to the connection memory. The memory must be aligned to ::SRATY_CONNECTION_MEMORY_ALIGNMENT. If the pointer is NULL or
+ * the memory is not aligned, a ::radef_kInvalidParameter error is returned.
+ * @param [in] connection_memory_size Size of the connection memory [bytes]. If the size is smaller than the size returned by ::srapi_GetConnectionMemorySize
+ * for the configured number of connections, a ::radef_kInvalidParameter error is returned.
+ * @param [out] instance Pointer to the handle of the initialized SafRetL instance. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
  * @return ::radef_kNoError -> successful initialized
- * @return ::radef_kAlreadyInitialized -> module already initialized
+ * @return ::radef_kAlreadyInitialized -> all instances already initialized
  * @return ::radef_kInvalidConfiguration -> invalid configuration data
  * @return ::radef_kInvalidParameter -> invalid parameter
  */
-radef_RaStaReturnCode srapi_Init(const srcty_SafetyRetransmissionConfiguration *const safety_retransmission_configuration);
+radef_RaStaReturnCode srapi_Init(const srcty_SafetyRetransmissionConfiguration *const safety_retransmission_configuration, void *const connection_memory,
+                                 const uint32_t connection_memory_size, srapi_Instance **const instance);
 
 /**
  * @brief Get the initialization state of the SafRetL.
  *
- * This function is used to check the initialization state of the sr_api module.
+ * This function is used to check the initialization state of a SafRetL instance.
  *
  * @implementsReq{RASW-545} Get Initialization State Function
  * @implementsReq{RASW-306} Get Initialization State Function Structure
  * @implementsReq{RASW-305} Error Code
  * @implementsReq{RASW-503} Enum RaSta Return Code Usage
  *
+ * @param [in] instance Pointer to the SafRetL instance returned by ::srapi_Init. A NULL pointer is reported as not initialized.
  * @return ::radef_kNoError -> successful initialized
  * @return ::radef_kNotInitialized -> not initialized
  */
-radef_RaStaReturnCode srapi_GetInitializationState(void);
+radef_RaStaReturnCode srapi_GetInitializationState(const srapi_Instance *const instance);
 
 /**
  * @brief Open a RaSTA connection.
  *
- * This function is used to open a specific RaSTA connection. If the sr_api module is not initalized, a ::radef_kNotInitialized error is returned. The network
+ * This function is used to open a specific RaSTA connection. If the instance is not initalized, a ::radef_kNotInitialized error is returned. The network
  * id is checked if it is known in the saved configuration. If it is not known, a ::radef_kInvalidParameter is returned. Afterwards the connection id is
  * obtained by calling the ::srcor_GetConnectionId function. If no valid connection is found, a ::radef_kInvalidParameter is returned. If all tests passed, the
  * ::srstm_ProcessConnectionStateMachine function is called with an ::srtyp_kConnEventOpen event. The connection id is passed to the application via the output
@@ -110,6 +138,8 @@ radef_RaStaReturnCode srapi_GetInitializationState(void);
  * @implementsReq{RASW-503} Enum RaSta Return Code Usage
  * @implementsReq{RASW-737} Open Connection Sequence
  *
+ * @param [in] instance Pointer to the SafRetL instance returned by ::srapi_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
  * @param [in] sender_id RaSTA sender identification. The full value range is valid and usable.
  * @param [in] receiver_id RaSTA receiver identification. The full value range is valid and usable.
  * @param [in] network_id RaSTA network identification. The full value range is valid and usable.
@@ -118,12 +148,13 @@ radef_RaStaReturnCode srapi_GetInitializationState(void);
  * @return ::radef_kNotInitialized -> module not initialized
  * @return ::radef_kInvalidParameter -> invalid parameter
  */
-radef_RaStaReturnCode srapi_OpenConnection(const uint32_t sender_id, const uint32_t receiver_id, const uint32_t network_id, uint32_t *const connection_id);
+radef_RaStaReturnCode srapi_OpenConnection(srapi_Instance *const instance, const uint32_t sender_id, const uint32_t receiver_id, const uint32_t network_id,
+                                           uint32_t *const connection_id);
 
 /**
  * @brief Close a RaSTA connection.
  *
- * This function is used to close a specific RaSTA connection. If the sr_api module is not initalized, a ::radef_kNotInitialized error is returned. If
+ * This function is used to close a specific RaSTA connection. If the instance is not initalized, a ::radef_kNotInitialized error is returned. If
  * initialized, the connection id is checked if it is in a valid range, otherwise a ::radef_kInvalidParameter is returned. If everything is good, the detailed
  * disconnection reason is set with the ::srcor_SetDiscDetailedReason function. Then the ::srstm_ProcessConnectionStateMachine function is called with
  * ::srtyp_kConnEventClose event to close the Rasta connection.
@@ -136,18 +167,20 @@ radef_RaStaReturnCode srapi_OpenConnection(const uint32_t sender_id, const uint3
  * @implementsReq{RASW-503} Enum RaSta Return Code Usage
  * @implementsReq{RASW-739} Close Connection Sequence
  *
+ * @param [in] instance Pointer to the SafRetL instance returned by ::srapi_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
  * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
  * @param [in] detailed_reason Detailed reason for disconnection. The full value range is valid and usable.
  * @return ::radef_kNoError -> successful operation
  * @return ::radef_kNotInitialized -> module not initialized
  * @return ::radef_kInvalidParameter -> invalid parameter
  */
-radef_RaStaReturnCode srapi_CloseConnection(const uint32_t connection_id, const uint16_t detailed_reason);
+radef_RaStaReturnCode srapi_CloseConnection(srapi_Instance *const instance, const uint32_t connection_id, const uint16_t detailed_reason);
 
 /**
  * @brief Send a RaSTA data message.
  *
- * This function is used to send data over a specific RaSTA connection. If the sr_api module is not initalized, a ::radef_kNotInitialized error is returned. If
+ * This function is used to send data over a specific RaSTA connection. If the instance is not initalized, a ::radef_kNotInitialized error is returned. If
  * initialized, the connection id is checked if it is in a valid range, otherwise a ::radef_kInvalidParameter is returned. If the state machine is in closed
  * state, a ::radef_kInvalidOperationInCurrentState is returned, since no data can be send when the connection is closed. If everything is good, it is checked
  * if there are free entries in the send buffer with the ::srsend_GetFreeBufferEntries function. In case the buffer is full, a ::radef_kSendBufferFull error is
@@ -164,6 +197,8 @@ radef_RaStaReturnCode srapi_CloseConnection(const uint32_t connection_id, const
  * @implementsReq{RASW-503} Enum RaSta Return Code Usage
  * @implementsReq{RASW-741} Send Data Sequence
  *
+ * @param [in] instance Pointer to the SafRetL instance returned by ::srapi_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
  * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
  * @param [in] message_size Size of the message data [bytes]. Valid range: ::srcty_kMinSrLayerPayloadDataSize <= value <=
  * ::RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE. If the value is outside this range, a ::radef_kInvalidMessageSize error is returned.
@@ -176,12 +211,13 @@ radef_RaStaReturnCode srapi_CloseConnection(const uint32_t connection_id, const
  * @return ::radef_kSendBufferFull -> send buffer full
  * @return ::radef_kInvalidOperationInCurrentState -> state machine in closed state
  */
-radef_RaStaReturnCode srapi_SendData(const uint32_t connection_id, const uint16_t message_size, const uint8_t *const message_data);
+radef_RaStaReturnCode srapi_SendData(srapi_Instance *const instance, const uint32_t connection_id, const uint16_t message_size,
+                                     const uint8_t *const message_data);
 
 /**
  * @brief Read the data of a received RaSTA message.
  *
- * This function is used to read data from a specific RaSTA connection. If the sr_api module is not initalized, a ::radef_kNotInitialized error is returned. If
+ * This function is used to read data from a specific RaSTA connection. If the instance is not initalized, a ::radef_kNotInitialized error is returned. If
  * initialized, the connection id is checked if it is in a valid range, otherwise a ::radef_kInvalidParameter is returned. If the provided buffer size is not
  * big enough for the next message from the received buffer, a ::radef_kInvalidBufferSize is returned. If everything is good, a message is read with
  * ::srrece_ReadFromBuffer. If no message is available, a ::radef_kNoMessageReceived is returned. Otherwise the received data message is copied into the
@@ -197,6 +233,8 @@ radef_RaStaReturnCode srapi_SendData(const uint32_t connection_id, const uint16_
  * @implementsReq{RASW-503} Enum RaSta Return Code Usage
  * @implementsReq{RASW-743} Read Data Sequence
  *
+ * @param [in] instance Pointer to the SafRetL instance returned by ::srapi_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
  * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
  * @param [in] buffer_size Size of the buffer provided to parameter message_buffer [bytes]. Valid range: ::srcty_kMinSrLayerPayloadDataSize <= value <=
  * ::RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE. Any value in this range can be used, must be large enough to store the received message.
@@ -208,12 +246,64 @@ radef_RaStaReturnCode srapi_SendData(const uint32_t connection_id, const uint16_
  * @return ::radef_kInvalidParameter -> invalid parameter
  * @return ::radef_kInvalidBufferSize -> invalid buffer size
  */
-radef_RaStaReturnCode srapi_ReadData(const uint32_t connection_id, const uint16_t buffer_size, uint16_t *const message_size, uint8_t *const message_buffer);
+radef_RaStaReturnCode srapi_ReadData(srapi_Instance *const instance, const uint32_t connection_id, const uint16_t buffer_size, uint16_t *const message_size,
+                                     uint8_t *const message_buffer);
+
+/**
+ * @brief Peek at the data of a received RaSTA message without copying it.
+ *
+ * This function is used to access the data of the next received message of a specific RaSTA connection in place. If the instance is not initalized, a
+ * ::radef_kNotInitialized error is returned. If initialized, the connection id is checked if it is in a valid range, otherwise a ::radef_kInvalidParameter is
+ * returned. If everything is good, the next message is looked up with ::srrece_PeekFromBuffer. If no message is available, a ::radef_kNoMessageReceived is
+ * returned. Otherwise a read-only pointer to the message data in the received buffer and its size are returned. The message stays in the received buffer
+ * until it is released with ::srapi_ReleaseData, repeated calls return the same message.
+ *
+ * @implementsReq{RASW-549} Read Data Function
+ * @implementsReq{RASW-273} Connection Identification
+ * @implementsReq{RASW-268} Message Size
+ * @implementsReq{RASW-286} Error Code
+ * @implementsReq{RASW-503} Enum RaSta Return Code Usage
+ *
+ * @param [in] instance Pointer to the SafRetL instance returned by ::srapi_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @param [out] message_size Pointer to the size of the received message data [bytes]. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
+ * @param [out] message_data Pointer to the pointer to the received message data. The message data is valid until the message is released with
+ * ::srapi_ReadData or ::srapi_ReleaseData or the connection is closed. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
+ * @return ::radef_kNoError -> successful operation
+ * @return ::radef_kNoMessageReceived -> no message received (used for polling)
+ * @return ::radef_kNotInitialized -> module not initialized
+ * @return ::radef_kInvalidParameter -> invalid parameter
+ */
+radef_RaStaReturnCode srapi_PeekData(srapi_Instance *const instance, const uint32_t connection_id, uint16_t *const message_size,
+                                     const uint8_t **const message_data);
+
+/**
+ * @brief Release the data of a received RaSTA message.
+ *
+ * This function removes the next received message of a specific RaSTA connection from the received buffer, after it was processed in place with
+ * ::srapi_PeekData. If the instance is not initalized, a ::radef_kNotInitialized error is returned. If initialized, the connection id is checked if it is
+ * in a valid range, otherwise a ::radef_kInvalidParameter is returned. If no message is available, a ::radef_kNoMessageReceived is returned.
+ *
+ * @implementsReq{RASW-549} Read Data Function
+ * @implementsReq{RASW-273} Connection Identification
+ * @implementsReq{RASW-286} Error Code
+ * @implementsReq{RASW-503} Enum RaSta Return Code Usage
+ *
+ * @param [in] instance Pointer to the SafRetL instance returned by ::srapi_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @return ::radef_kNoError -> successful operation
+ * @return ::radef_kNoMessageReceived -> no message received
+ * @return ::radef_kNotInitialized -> module not initialized
+ * @return ::radef_kInvalidParameter -> invalid parameter
+ */
+radef_RaStaReturnCode srapi_ReleaseData(srapi_Instance *const instance, const uint32_t connection_id);
 
 /**
  * @brief Get the state of a connection.
  *
- * This function is used to get the connection state of a specific RaSTA connection. If the sr_api module is not initalized, a ::radef_kNotInitialized error is
+ * This function is used to get the connection state of a specific RaSTA connection. If the instance is not initalized, a ::radef_kNotInitialized error is
  * returned. If initialized, the connection id is checked if it is in a valid range, otherwise a ::radef_kInvalidParameter is returned. If everything is good,
  * the connection state is obtained from the state machine with the ::srstm_GetConnectionState function call. With the ::srcor_GetBufferSizeAndUtilisation
  * further information is collected to then be returned to the caller.
@@ -228,6 +318,8 @@ radef_RaStaReturnCode srapi_ReadData(const uint32_t connection_id, const uint16_
  * @implementsReq{RASW-503} Enum RaSta Return Code Usage
  * @implementsReq{RASW-745} Get Connection State Sequence
  *
+ * @param [in] instance Pointer to the SafRetL instance returned by ::srapi_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
  * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
  * @param [out] connection_state State of the connection. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
  * @param [out] buffer_utilisation Struct with own buffer utilisation data. If the pointer is NULL, a ::radef_kInvalidParameter error is returned.
@@ -236,23 +328,26 @@ radef_RaStaReturnCode srapi_ReadData(const uint32_t connection_id, const uint16_
  * @return ::radef_kNotInitialized -> module not initialized
  * @return ::radef_kInvalidParameter -> invalid parameter
  */
-radef_RaStaReturnCode srapi_GetConnectionState(const uint32_t connection_id, sraty_ConnectionStates *const connection_state,
+radef_RaStaReturnCode srapi_GetConnectionState(srapi_Instance *const instance, const uint32_t connection_id, sraty_ConnectionStates *const connection_state,
                                                sraty_BufferUtilisation *const buffer_utilisation, uint16_t *const opposite_buffer_size);
 
 /**
  * @brief Check SafRetL timings.
  *
- * This function is used to check the timings of the SafRetL. If the sr_api module is not initalized, a ::radef_kNotInitialized error is
+ * This function is used to check the timings of the SafRetL. If the instance is not initalized, a ::radef_kNotInitialized error is
  * returned. It must be called periodically. It has 3 main uses:
  * - Received messages polling (read all available messages from the adapter layer and process them in the state machine). Read and process new messages while
  * ::srcor_IsReceivedMsgPendingAndBuffersNotFull check return true.
  * - Send pending messages (send not yet send messages from the send buffer)
- * - Check timings for message timeout & HB interval
+ * - Check timings for message timeout & HB interval of the connections returned by ::srcor_GetExpiredTimerConnection
  *   - Check with ::srcor_IsMessageTimeout if a message timeout occurred. If true, send a ::srtyp_kConnEventTimeout event to the state machine.
  *   - Check with ::srcor_IsHeartbeatInterval if the heartbeat interval elapsed and also if there are not send messages in the send buffer. If true, send a
  * ::srtyp_kConnEventSendHb event to the state machine.
  * .
- * These checks are done for all available connections.
+ * The received messages polling and the sending of pending messages are done for all available connections. The timings are only checked for connections with
+ * an expired message timeout or heartbeat timer, so that the effort of the timing checks depends on the number of expiring timers. The timings are checked
+ * after the received messages polling and the sending of pending messages of all connections. A message which is pending at the call is therefore processed
+ * before the timings of its connection are checked, so that it prevents the message timeout of its connection.
  *
  * @implementsReq{RASW-551} Check Timings Function
  * @implementsReq{RASW-319} Check Timings Function Structure
@@ -264,10 +359,29 @@ radef_RaStaReturnCode srapi_GetConnectionState(const uint32_t connection_id, sra
  *
  * @remark This function must be called periodically, in a appropriate interval related to the configured timings.
  *
+ * @param [in] instance Pointer to the SafRetL instance returned by ::srapi_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
  * @return ::radef_kNoError -> successful operation
  * @return ::radef_kNotInitialized -> module not initialized
  */
-radef_RaStaReturnCode srapi_CheckTimings(void);
+radef_RaStaReturnCode srapi_CheckTimings(srapi_Instance *const instance);
+
+/**
+ * @brief Get the time until the next SafRetL timing deadline.
+ *
+ * This function returns the time until the next message timeout or heartbeat interval of all connections elapses. The application can use it to wait until
+ * ::srapi_CheckTimings must be called again, unless a message is received before. If the instance is not initalized, a ::radef_kNotInitialized error is
+ * returned.
+ *
+ * @param [in] instance Pointer to the SafRetL instance returned by ::srapi_Init. If the pointer is NULL or the instance is not initialized, a
+ * ::radef_kNotInitialized error is returned.
+ * @param [out] time_to_next_deadline Time until the next deadline [ms]. 0 if a deadline is already reached and UINT32_MAX if no timing is running. If the
+ * pointer is NULL, a ::radef_kInvalidParameter error is returned.
+ * @return ::radef_kNoError -> successful operation
+ * @return ::radef_kNotInitialized -> module not initialized
+ * @return ::radef_kInvalidParameter -> invalid parameter
+ */
+radef_RaStaReturnCode srapi_GetNextDeadline(srapi_Instance *const instance, uint32_t *const time_to_next_deadline);
 
 /** @}*/
 
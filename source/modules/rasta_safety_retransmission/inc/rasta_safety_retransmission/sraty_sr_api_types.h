@@ -37,6 +37,13 @@
 // Global Macro Definitions
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Alignment of the connection memory [bytes].
+ *
+ * The connection memory passed to ::srapi_Init must start at an address which is a multiple of this alignment.
+ */
+#define SRATY_CONNECTION_MEMORY_ALIGNMENT (8U)
+
 // -----------------------------------------------------------------------------
 // Global Type Definitions
 // -----------------------------------------------------------------------------
@@ -212,8 +219,23 @@ typedef struct {
    * @implementsReq{RASW-467} T drift2
    */
   uint32_t t_drift2;
+
+  /**
+   * @brief Ndropped [messages]. Number of messages which are dropped on this transport channel because its ingress ring was full. Only counted, if the stack
+   * is built with transport ingress rings (CMake option RASTA_TRANSPORT_INGRESS_RINGS), otherwise always 0. Full value range is valid and usable.
+   */
+  uint32_t n_dropped;
 } sraty_RedundancyChannelDiagnosticData;
 
+/**
+ * @brief Handle of a SafRetL instance.
+ *
+ * Every instance owns the state of an independent SafRetL with its own configuration, connections and connection memory. The handle is returned by
+ * ::srapi_Init and is passed to all other SafRetL API functions, to the adapter interface and to the notification functions. The content of the instance is
+ * private to the SafRetL.
+ */
+typedef struct srapi_Instance srapi_Instance;
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -31,6 +31,7 @@
 #include <stdint.h>
 
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/raslb_rasta_slab.h"
 
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
@@ -58,7 +59,7 @@ typedef enum {
  * @brief Struct for the configuration of a RaSTA connection.
  *
  * This struct contains the configuration of a RaSTA connection, describing the relation between sender id, receiver id & connection id. Sender id and receiver
- * id must be different from each other.
+ * id must be different from each other. Every combination of sender id and receiver id must only be used by one connection.
  *
  * @implementsReq{RASW-423} Struct Connection Configuration Structure
  */
@@ -172,8 +173,9 @@ typedef struct {
   /**
    * @brief Packetization factor
    *
-   * The maximal packetization factor defines how many messages from one application may at maximum be combined to form aSafRetL message. Valid range: value =
-   * ::srcty_kNMaxPacket.
+   * The maximal packetization factor defines how many messages from one application may at maximum be combined to form a SafRetL message. Valid range:
+   * ::srcty_kMinNMaxPacket <= value <= ::srcty_kMaxNMaxPacket and value <= n_send_max, since every packed message needs its own entry in the received
+   * buffer. With a value of 1, no messages are packed.
    *
    * @implementsReq{RASW-440} N maxPacket
    */
@@ -297,10 +299,19 @@ extern const uint16_t srcty_kMinMWA;
 extern const uint16_t srcty_kMaxMWA;
 
 /**
- * @brief Packetization factor (must always be 1!).
+ * @brief Minimum packetization factor (NmaxPacket) [messages].
  */
-//lint -esym(9003, srcty_kNMaxPacket) (global constant definition grouped in one file)
-extern const uint32_t srcty_kNMaxPacket;
+//lint -esym(9003, srcty_kMinNMaxPacket) (global constant definition grouped in one file)
+extern const uint32_t srcty_kMinNMaxPacket;
+
+/**
+ * @brief Maximum packetization factor (NmaxPacket) [messages].
+ *
+ * The number of messages packed into one SafRetL message is additionally limited by ::RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE, since every packed message
+ * needs its own message length field.
+ */
+//lint -esym(9003, srcty_kMaxNMaxPacket) (global constant definition grouped in one file)
+extern const uint32_t srcty_kMaxNMaxPacket;
 
 /**
  * @brief Minimum SafRetL diagnosis window size
@@ -359,11 +370,21 @@ extern const uint32_t srcty_kMinFreeEntriesSendBufferForRetr;
 /**
  * @brief Minimum amount of free entries in the received buffer in case of receiving a message
  *
- * One free entry in the received buffer is needed to receive a new message.
+ * One free entry in the received buffer is needed to receive a new message. Since every message packed into a received data message is stored in its own
+ * entry, this value is multiplied with the number of messages, which the size of the next received message allows to be packed into it (at most the
+ * configured n_max_packet).
  */
 //lint -esym(9003, srcty_kMinFreeEntriesReceivedBufferForReceive) (global constant definition grouped in one file)
 extern const uint32_t srcty_kMinFreeEntriesReceivedBufferForReceive;
 
+/**
+ * @brief Configuration of the message slab, which stores the messages of the send buffers and the payloads of the received buffers of all connections.
+ *
+ * The size classes are defined by the RADEF_SLAB_... build definitions.
+ */
+//lint -esym(9003, srcty_kSlabConfiguration) (global constant definition grouped in one file)
+extern const raslb_SlabConfiguration srcty_kSlabConfiguration;
+
 // -----------------------------------------------------------------------------
 // Global Function Prototypes
 // -----------------------------------------------------------------------------
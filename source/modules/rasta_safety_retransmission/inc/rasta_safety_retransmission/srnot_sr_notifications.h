@@ -58,9 +58,10 @@ extern "C" {
  * @implementsReq{RASW-279} Message Received Notification Structure
  * @implementsReq{RASW-302} Connection Identification
  *
+ * @param [in] instance Handle of the SafRetL instance, which sends the notification.
  * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
  */
-void srnot_MessageReceivedNotification(const uint32_t connection_id);
+void srnot_MessageReceivedNotification(srapi_Instance *const instance, const uint32_t connection_id);
 
 /**
  * @brief SafRetL connection state notification function.
@@ -77,6 +78,7 @@ void srnot_MessageReceivedNotification(const uint32_t connection_id);
  * @implementsReq{RASW-295} Disconnect Reason
  * @implementsReq{RASW-294} Detailed Disconnect Reason
  *
+ * @param [in] instance Handle of the SafRetL instance, which sends the notification.
  * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
  * @param [in] connection_state Current connection state of the SafRetL. Valid range: ::sraty_kConnectionMin <= value < ::sraty_kConnectionMax.
  * @param [in] buffer_utilisation Struct with buffer utilisation data. Structure and valid ranges can be found in ::sraty_BufferUtilisation.
@@ -86,7 +88,7 @@ void srnot_MessageReceivedNotification(const uint32_t connection_id);
  * @param [in] detailed_disconnect_reason Detailed disconnect reason application (only valid if connection state changed to ::sraty_kConnectionClosed). Full
  * value range is valid and usable.
  */
-void srnot_ConnectionStateNotification(const uint32_t connection_id, const sraty_ConnectionStates connection_state,
+void srnot_ConnectionStateNotification(srapi_Instance *const instance, const uint32_t connection_id, const sraty_ConnectionStates connection_state,
                                        const sraty_BufferUtilisation buffer_utilisation, const uint16_t opposite_buffer_size,
                                        const sraty_DiscReason disconnect_reason, const uint16_t detailed_disconnect_reason);
 
@@ -101,10 +103,12 @@ void srnot_ConnectionStateNotification(const uint32_t connection_id, const sraty
  * @implementsReq{RASW-326} Connection Identification
  * @implementsReq{RASW-321} Connection Diagnostic Data
  *
+ * @param [in] instance Handle of the SafRetL instance, which sends the notification.
  * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
  * @param [in] connection_diagnostic_data Diagnostic data of the SafRetL. Structure and valid ranges can be found in ::sraty_ConnectionDiagnosticData.
  */
-void srnot_SrDiagnosticNotification(const uint32_t connection_id, const sraty_ConnectionDiagnosticData connection_diagnostic_data);
+void srnot_SrDiagnosticNotification(srapi_Instance *const instance, const uint32_t connection_id,
+                                    const sraty_ConnectionDiagnosticData connection_diagnostic_data);
 
 /**
  * @brief Forwarded RedL diagnostic data notification function.
@@ -118,11 +122,13 @@ void srnot_SrDiagnosticNotification(const uint32_t connection_id, const sraty_Co
  * @implementsReq{RASW-323} Connection Identification
  * @implementsReq{RASW-315} Redundancy Channel Diagnostic Data
  *
+ * @param [in] instance Handle of the SafRetL instance, which sends the notification.
  * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
  * @param [in] redundancy_channel_diagnostic_data Diagnostic data from the redundancy channel. Structure and valid ranges can be found in
  * ::sraty_RedundancyChannelDiagnosticData.
  */
-void srnot_RedDiagnosticNotification(const uint32_t connection_id, const sraty_RedundancyChannelDiagnosticData redundancy_channel_diagnostic_data);
+void srnot_RedDiagnosticNotification(srapi_Instance *const instance, const uint32_t connection_id,
+                                     const sraty_RedundancyChannelDiagnosticData redundancy_channel_diagnostic_data);
 
 /** @}*/
 
@@ -27,6 +27,7 @@
 #include "rasta_safety_retransmission/srcty_sr_config_types.h"
 #include "rasta_safety_retransmission/srnot_sr_notifications.h"
 #include "srcor_sr_core.h"              // NOLINT(build/include_subdir)
+#include "srins_sr_instances.h"         // NOLINT(build/include_subdir)
 #include "srrece_sr_received_buffer.h"  // NOLINT(build/include_subdir)
 #include "srsend_sr_send_buffer.h"      // NOLINT(build/include_subdir)
 #include "srstm_sr_state_machine.h"     // NOLINT(build/include_subdir)
@@ -60,13 +61,15 @@
 // Global Function Implementations
 // -----------------------------------------------------------------------------
 
-radef_RaStaReturnCode sradno_MessageReceivedNotification(const uint32_t red_channel_id) {
+radef_RaStaReturnCode sradno_MessageReceivedNotification(srapi_Instance *const instance, const uint32_t red_channel_id) {
   radef_RaStaReturnCode ret = radef_kNoError;
 
   const uint32_t kConnectionId = red_channel_id;  // 1:1 mapping between the connection id and redundancy channel id
 
   // Input parameter check
-  if (kConnectionId < RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS) {
+  if ((instance != NULL) && (kConnectionId < RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)) {
+    srins_SelectInstance(instance);
+
     srcor_SetReceivedMessagePendingFlag(kConnectionId);
 
     srtyp_ConnectionEvents connection_event = srtyp_kConnEventNone;
@@ -87,14 +90,16 @@ radef_RaStaReturnCode sradno_MessageReceivedNotification(const uint32_t red_chan
   return ret;
 }
 
-radef_RaStaReturnCode sradno_DiagnosticNotification(const uint32_t red_channel_id, const uint32_t tr_channel_id,
+radef_RaStaReturnCode sradno_DiagnosticNotification(srapi_Instance *const instance, const uint32_t red_channel_id, const uint32_t tr_channel_id,
                                                     const radef_TransportChannelDiagnosticData tr_channel_diagnostic_data) {
   radef_RaStaReturnCode ret = radef_kNoError;
 
   const uint32_t kConnectionId = red_channel_id;  // 1:1 mapping between the connection id and redundancy channel id
 
   // Input parameter check
-  if (kConnectionId < RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS) {
+  if ((instance != NULL) && (kConnectionId < RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)) {
+    srins_SelectInstance(instance);
+
     sraty_RedundancyChannelDiagnosticData red_channel_diag_data;
 
     // Copy and cluster diagnostic data
@@ -103,9 +108,10 @@ radef_RaStaReturnCode sradno_DiagnosticNotification(const uint32_t red_channel_i
     red_channel_diag_data.n_missed = tr_channel_diagnostic_data.n_missed;
     red_channel_diag_data.t_drift = tr_channel_diagnostic_data.t_drift;
     red_channel_diag_data.t_drift2 = tr_channel_diagnostic_data.t_drift2;
+    red_channel_diag_data.n_dropped = tr_channel_diagnostic_data.n_dropped;
 
     // Forward diagnostic data to application
-    srnot_RedDiagnosticNotification(kConnectionId, red_channel_diag_data);
+    srnot_RedDiagnosticNotification(instance, kConnectionId, red_channel_diag_data);
   } else {
     ret = radef_kInvalidParameter;
   }
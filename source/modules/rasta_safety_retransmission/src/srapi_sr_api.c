@@ -27,11 +27,13 @@
 #include "rasta_common/rasys_rasta_system_adapter.h"
 #include "rasta_safety_retransmission/sraty_sr_api_types.h"
 #include "rasta_safety_retransmission/srcty_sr_config_types.h"
-#include "srcor_sr_core.h"              // NOLINT(build/include_subdir)
-#include "srrece_sr_received_buffer.h"  // NOLINT(build/include_subdir)
-#include "srsend_sr_send_buffer.h"      // NOLINT(build/include_subdir)
-#include "srstm_sr_state_machine.h"     // NOLINT(build/include_subdir)
-#include "srtyp_sr_types.h"             // NOLINT(build/include_subdir)
+#include "srcor_sr_core.h"               // NOLINT(build/include_subdir)
+#include "srins_sr_instances.h"          // NOLINT(build/include_subdir)
+#include "srmem_sr_connection_memory.h"  // NOLINT(build/include_subdir)
+#include "srrece_sr_received_buffer.h"   // NOLINT(build/include_subdir)
+#include "srsend_sr_send_buffer.h"       // NOLINT(build/include_subdir)
+#include "srstm_sr_state_machine.h"      // NOLINT(build/include_subdir)
+#include "srtyp_sr_types.h"              // NOLINT(build/include_subdir)
 
 // -----------------------------------------------------------------------------
 // Local Macro Definitions
@@ -45,25 +47,40 @@
 // Local Variable Definitions
 // -----------------------------------------------------------------------------
 
-/**
- * @brief Initialization state of the module.
- * true, if the module is initialized.
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+/** @addtogroup sr_api
+ * @{
  */
-PRIVATE bool srapi_initialized = false;
 
 /**
- * @brief Pointer to SafRetL configuration.
+ * @brief Get the size of the connection memory needed by all SafRetL modules.
+ *
+ * This internal function adds up the connection memory allocated by the state machine module and the core module (including the modules used by the core
+ * module) for a number of connections. The sum is only returned, if it does not exceed UINT32_MAX.
+ *
+ * @param [in] number_of_connections Number of configured connections. Valid range: ::srcty_kMinNumberOfRaStaConnections <= value <=
+ * ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS. For any other value a ::radef_kInvalidParameter fatal error is thrown by the modules.
+ * @param [out] connection_memory_size Pointer to the size of the needed connection memory [bytes]. The pointer must not be NULL.
+ * @return true -> size of the connection memory returned
+ * @return false -> the needed connection memory exceeds UINT32_MAX
  */
-PRIVATE const srcty_SafetyRetransmissionConfiguration *srapi_sr_configuration = NULL;
+static bool GetConnectionMemorySize(const uint32_t number_of_connections, uint32_t *const connection_memory_size);
 
 /**
- * @brief Memory to transfer messages
+ * @brief Select an initialized SafRetL instance.
+ *
+ * This internal function checks, if the instance is initialized, and selects it in all SafRetL modules.
+ *
+ * @param [in] instance Pointer to the SafRetL instance. A NULL pointer is handled like an instance, which is not initialized.
+ * @return true -> the instance is initialized and selected
+ * @return false -> the instance is not initialized
  */
-PRIVATE srtyp_SrMessagePayload srapi_scratch_message_payload;
+static bool SelectInitializedInstance(srapi_Instance *const instance);
 
-// -----------------------------------------------------------------------------
-// Local Function Prototypes
-// -----------------------------------------------------------------------------
+/** @}*/
 
 // -----------------------------------------------------------------------------
 // Local Constant Definitions
@@ -77,47 +94,79 @@ PRIVATE srtyp_SrMessagePayload srapi_scratch_message_payload;
 // Global Function Implementations
 // -----------------------------------------------------------------------------
 
-radef_RaStaReturnCode srapi_Init(const srcty_SafetyRetransmissionConfiguration *const safety_retransmission_configuration) {
+radef_RaStaReturnCode srapi_GetConnectionMemorySize(const uint32_t number_of_connections, uint32_t *const connection_memory_size) {
   radef_RaStaReturnCode ret = radef_kNoError;
 
   // Input parameter check
-  if (safety_retransmission_configuration == NULL) {
+  if (connection_memory_size == NULL) {
+    ret = radef_kInvalidParameter;
+  } else if (!rahlp_IsU32InRange(number_of_connections, srcty_kMinNumberOfRaStaConnections, RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)) {
     ret = radef_kInvalidParameter;
-  } else if (srapi_initialized) {
-    ret = radef_kAlreadyInitialized;
-  } else if (srcor_IsConfigurationValid(safety_retransmission_configuration)) {
-    srapi_sr_configuration = safety_retransmission_configuration;
+  } else if (!GetConnectionMemorySize(number_of_connections, connection_memory_size)) {
+    ret = radef_kInvalidParameter;
+  } else {
+    // Size of the connection memory returned
+  }
 
-    srstm_Init(srapi_sr_configuration->number_of_connections);
-    srcor_Init(srapi_sr_configuration);
-    srapi_initialized = true;
+  return ret;
+}
 
-    ret = srapi_GetInitializationState();
-  } else {
+radef_RaStaReturnCode srapi_Init(const srcty_SafetyRetransmissionConfiguration *const safety_retransmission_configuration, void *const connection_memory,
+                                 const uint32_t connection_memory_size, srapi_Instance **const instance) {
+  radef_RaStaReturnCode ret = radef_kNoError;
+  uint32_t needed_connection_memory_size = 0U;
+
+  // Input parameter check
+  if ((safety_retransmission_configuration == NULL) || (connection_memory == NULL) || (instance == NULL)) {
+    ret = radef_kInvalidParameter;
+  } else if (((uintptr_t)connection_memory & (SRATY_CONNECTION_MEMORY_ALIGNMENT - 1U)) != 0U) {  //lint !e923 (cast is needed to check the alignment)
+    ret = radef_kInvalidParameter;
+  } else if (!srins_IsInstanceAvailable()) {
+    ret = radef_kAlreadyInitialized;  // All instances are already initialized
+  } else if (!srcor_IsConfigurationValid(safety_retransmission_configuration)) {
     ret = radef_kInvalidConfiguration;
+  } else if (!GetConnectionMemorySize(safety_retransmission_configuration->number_of_connections, &needed_connection_memory_size)) {
+    ret = radef_kInvalidParameter;
+  } else if (connection_memory_size < needed_connection_memory_size) {
+    ret = radef_kInvalidParameter;
+  } else if (!srsend_IsChunkShareSufficient(safety_retransmission_configuration->number_of_connections, safety_retransmission_configuration->n_send_max)) {
+    ret = radef_kInvalidParameter;  // The message slab is too small for the send buffers of the configured connections
+  } else {
+    srapi_Instance *const new_instance = srins_CreateInstance();
+    new_instance->sr_configuration = safety_retransmission_configuration;
+    srins_SelectInstance(new_instance);
+
+    srmem_Init(connection_memory, connection_memory_size);
+    srstm_Init(new_instance->sr_configuration->number_of_connections);
+    srcor_Init(new_instance->sr_configuration);
+    new_instance->initialized = true;
+    *instance = new_instance;
+
+    ret = srapi_GetInitializationState(new_instance);
   }
 
   return ret;
 }
 
-radef_RaStaReturnCode srapi_GetInitializationState(void) {
+radef_RaStaReturnCode srapi_GetInitializationState(const srapi_Instance *const instance) {
   radef_RaStaReturnCode ret = radef_kNotInitialized;
 
-  if (srapi_initialized) {
+  if ((instance != NULL) && instance->initialized) {
     ret = radef_kNoError;
   }
   return ret;
 }
 
-radef_RaStaReturnCode srapi_OpenConnection(const uint32_t sender_id, const uint32_t receiver_id, const uint32_t network_id, uint32_t *const connection_id) {
+radef_RaStaReturnCode srapi_OpenConnection(srapi_Instance *const instance, const uint32_t sender_id, const uint32_t receiver_id, const uint32_t network_id,
+                                           uint32_t *const connection_id) {
   radef_RaStaReturnCode ret = radef_kNoError;
 
   // Input parameter check
   if (connection_id == NULL) {
     ret = radef_kInvalidParameter;
-  } else if (!srapi_initialized) {
+  } else if (!SelectInitializedInstance(instance)) {
     ret = radef_kNotInitialized;
-  } else if (network_id == srapi_sr_configuration->rasta_network_id) {
+  } else if (network_id == instance->sr_configuration->rasta_network_id) {
     ret = srcor_GetConnectionId(sender_id, receiver_id, connection_id);
     if (ret == radef_kNoError) {
       srstm_ProcessConnectionStateMachine(*connection_id, srtyp_kConnEventOpen, false, false);
@@ -129,12 +178,12 @@ radef_RaStaReturnCode srapi_OpenConnection(const uint32_t sender_id, const uint3
   return ret;
 }
 
-radef_RaStaReturnCode srapi_CloseConnection(const uint32_t connection_id, const uint16_t detailed_reason) {
+radef_RaStaReturnCode srapi_CloseConnection(srapi_Instance *const instance, const uint32_t connection_id, const uint16_t detailed_reason) {
   radef_RaStaReturnCode ret = radef_kNoError;
 
-  if (!srapi_initialized) {
+  if (!SelectInitializedInstance(instance)) {
     ret = radef_kNotInitialized;
-  } else if (connection_id < srapi_sr_configuration->number_of_connections) {
+  } else if (connection_id < instance->sr_configuration->number_of_connections) {
     srcor_SetDiscDetailedReason(connection_id, detailed_reason);
     srstm_ProcessConnectionStateMachine(connection_id, srtyp_kConnEventClose, false, false);
   } else {
@@ -144,7 +193,8 @@ radef_RaStaReturnCode srapi_CloseConnection(const uint32_t connection_id, const
   return ret;
 }
 
-radef_RaStaReturnCode srapi_SendData(const uint32_t connection_id, const uint16_t message_size, const uint8_t *const message_data) {
+radef_RaStaReturnCode srapi_SendData(srapi_Instance *const instance, const uint32_t connection_id, const uint16_t message_size,
+                                     const uint8_t *const message_data) {
   radef_RaStaReturnCode ret = radef_kNoError;
 
   // Input parameter check
@@ -152,9 +202,9 @@ radef_RaStaReturnCode srapi_SendData(const uint32_t connection_id, const uint16_
     ret = radef_kInvalidParameter;
   } else if (!rahlp_IsU16InRange(message_size, srcty_kMinSrLayerPayloadDataSize, RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE)) {
     ret = radef_kInvalidMessageSize;
-  } else if (!srapi_initialized) {
+  } else if (!SelectInitializedInstance(instance)) {
     ret = radef_kNotInitialized;
-  } else if (connection_id < srapi_sr_configuration->number_of_connections) {
+  } else if (connection_id < instance->sr_configuration->number_of_connections) {
     if (srstm_GetConnectionState(connection_id) == sraty_kConnectionClosed) {
       ret = radef_kInvalidOperationInCurrentState;
     } else {
@@ -172,7 +222,8 @@ radef_RaStaReturnCode srapi_SendData(const uint32_t connection_id, const uint16_
   return ret;
 }
 
-radef_RaStaReturnCode srapi_ReadData(const uint32_t connection_id, const uint16_t buffer_size, uint16_t *const message_size, uint8_t *const message_buffer) {
+radef_RaStaReturnCode srapi_ReadData(srapi_Instance *const instance, const uint32_t connection_id, const uint16_t buffer_size, uint16_t *const message_size,
+                                     uint8_t *const message_buffer) {
   radef_RaStaReturnCode ret = radef_kNoError;
 
   // Input parameter check
@@ -182,19 +233,19 @@ radef_RaStaReturnCode srapi_ReadData(const uint32_t connection_id, const uint16_
     ret = radef_kInvalidParameter;
   } else if (!rahlp_IsU16InRange(buffer_size, srcty_kMinSrLayerPayloadDataSize, RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE)) {
     ret = radef_kInvalidBufferSize;
-  } else if (!srapi_initialized) {
+  } else if (!SelectInitializedInstance(instance)) {
     ret = radef_kNotInitialized;
   } else if (srrece_GetPayloadSizeOfNextMessageToRead(connection_id) > buffer_size) {  // Not enough space to save the next message
     ret = radef_kInvalidBufferSize;
-  } else if (connection_id < srapi_sr_configuration->number_of_connections) {
-    ret = srrece_ReadFromBuffer(connection_id, &srapi_scratch_message_payload);
+  } else if (connection_id < instance->sr_configuration->number_of_connections) {
+    ret = srrece_ReadFromBuffer(connection_id, &instance->scratch_message_payload);
 
     if (ret == radef_kNoError) {
       // Copy message size & data to provided memory
-      *message_size = srapi_scratch_message_payload.payload_size;
+      *message_size = instance->scratch_message_payload.payload_size;
 
       for (uint32_t index = 0U; index < *message_size; ++index) {
-        message_buffer[index] = srapi_scratch_message_payload.payload[index];
+        message_buffer[index] = instance->scratch_message_payload.payload[index];
       }
     }
   } else {
@@ -204,7 +255,49 @@ radef_RaStaReturnCode srapi_ReadData(const uint32_t connection_id, const uint16_
   return ret;
 }
 
-radef_RaStaReturnCode srapi_GetConnectionState(const uint32_t connection_id, sraty_ConnectionStates *const connection_state,
+radef_RaStaReturnCode srapi_PeekData(srapi_Instance *const instance, const uint32_t connection_id, uint16_t *const message_size,
+                                     const uint8_t **const message_data) {
+  radef_RaStaReturnCode ret = radef_kNoError;
+
+  // Input parameter check
+  if (message_size == NULL) {
+    ret = radef_kInvalidParameter;
+  } else if (message_data == NULL) {
+    ret = radef_kInvalidParameter;
+  } else if (!SelectInitializedInstance(instance)) {
+    ret = radef_kNotInitialized;
+  } else if (connection_id < instance->sr_configuration->number_of_connections) {
+    srtyp_SrMessagePayloadView payload_view = {0U, NULL};
+    ret = srrece_PeekFromBuffer(connection_id, &payload_view);
+
+    if (ret == radef_kNoError) {
+      // Hand out the message in the received buffer, no copy is made
+      *message_size = payload_view.payload_size;
+      *message_data = payload_view.payload;
+    }
+  } else {
+    ret = radef_kInvalidParameter;
+  }
+
+  return ret;
+}
+
+radef_RaStaReturnCode srapi_ReleaseData(srapi_Instance *const instance, const uint32_t connection_id) {
+  radef_RaStaReturnCode ret = radef_kNoError;
+
+  // Input parameter check
+  if (!SelectInitializedInstance(instance)) {
+    ret = radef_kNotInitialized;
+  } else if (connection_id < instance->sr_configuration->number_of_connections) {
+    ret = srrece_ReleaseFromBuffer(connection_id);
+  } else {
+    ret = radef_kInvalidParameter;
+  }
+
+  return ret;
+}
+
+radef_RaStaReturnCode srapi_GetConnectionState(srapi_Instance *const instance, const uint32_t connection_id, sraty_ConnectionStates *const connection_state,
                                                sraty_BufferUtilisation *const buffer_utilisation, uint16_t *const opposite_buffer_size) {
   radef_RaStaReturnCode ret = radef_kNoError;
 
@@ -215,9 +308,9 @@ radef_RaStaReturnCode srapi_GetConnectionState(const uint32_t connection_id, sra
     ret = radef_kInvalidParameter;
   } else if (opposite_buffer_size == NULL) {
     ret = radef_kInvalidParameter;
-  } else if (!srapi_initialized) {
+  } else if (!SelectInitializedInstance(instance)) {
     ret = radef_kNotInitialized;
-  } else if (connection_id < srapi_sr_configuration->number_of_connections) {
+  } else if (connection_id < instance->sr_configuration->number_of_connections) {
     *connection_state = srstm_GetConnectionState(connection_id);
     srcor_GetBufferSizeAndUtilisation(connection_id, buffer_utilisation, opposite_buffer_size);
   } else {
@@ -227,11 +320,11 @@ radef_RaStaReturnCode srapi_GetConnectionState(const uint32_t connection_id, sra
   return ret;
 }
 
-radef_RaStaReturnCode srapi_CheckTimings(void) {
+radef_RaStaReturnCode srapi_CheckTimings(srapi_Instance *const instance) {
   radef_RaStaReturnCode ret = radef_kNoError;
 
-  if (srapi_initialized) {
-    for (uint32_t index = 0U; index < srapi_sr_configuration->number_of_connections; ++index) {
+  if (SelectInitializedInstance(instance)) {
+    for (uint32_t index = 0U; index < instance->sr_configuration->number_of_connections; ++index) {
       uint32_t connection_id = index;  // Connection_id always start from 0 and counts upwards
       srtyp_ConnectionEvents connection_event = srtyp_kConnEventNone;
       bool sequence_number_in_seq = false;
@@ -247,8 +340,11 @@ radef_RaStaReturnCode srapi_CheckTimings(void) {
 
       // Send pending messages
       srcor_SendPendingMessages(connection_id);
+    }
 
-      // Check timings
+    // Check timings only for the connections with an expired message timeout or heartbeat timer
+    uint32_t connection_id = 0U;
+    while (srcor_GetExpiredTimerConnection(&connection_id)) {
       if (srcor_IsMessageTimeout(connection_id)) {
         // Message timeout
         srstm_ProcessConnectionStateMachine(connection_id, srtyp_kConnEventTimeout, false, false);
@@ -267,6 +363,47 @@ radef_RaStaReturnCode srapi_CheckTimings(void) {
   return ret;
 }
 
+radef_RaStaReturnCode srapi_GetNextDeadline(srapi_Instance *const instance, uint32_t *const time_to_next_deadline) {
+  radef_RaStaReturnCode ret = radef_kNoError;
+
+  if (!SelectInitializedInstance(instance)) {
+    ret = radef_kNotInitialized;
+  } else if (time_to_next_deadline == NULL) {
+    ret = radef_kInvalidParameter;
+  } else if (!srcor_GetTimeToNextDeadline(time_to_next_deadline)) {
+    *time_to_next_deadline = UINT32_MAX;  // No timer is running
+  } else {
+    // Time to the next deadline returned by the core module
+  }
+
+  return ret;
+}
+
 // -----------------------------------------------------------------------------
 // Local Function Implementations
 // -----------------------------------------------------------------------------
+
+static bool GetConnectionMemorySize(const uint32_t number_of_connections, uint32_t *const connection_memory_size) {
+  // The number of connections is checked by the modules
+  const uint32_t kStateMachineMemorySize = srstm_GetConnectionMemorySize(number_of_connections);
+  const uint32_t kCoreMemorySize = srcor_GetConnectionMemorySize(number_of_connections);
+  bool size_valid = false;
+
+  if (kCoreMemorySize <= (UINT32_MAX - kStateMachineMemorySize)) {
+    *connection_memory_size = kStateMachineMemorySize + kCoreMemorySize;
+    size_valid = true;
+  }
+
+  return size_valid;
+}
+
+static bool SelectInitializedInstance(srapi_Instance *const instance) {
+  bool instance_selected = false;
+
+  if (srapi_GetInitializationState(instance) == radef_kNoError) {
+    srins_SelectInstance(instance);
+    instance_selected = true;
+  }
+
+  return instance_selected;
+}
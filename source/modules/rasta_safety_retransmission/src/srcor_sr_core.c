@@ -27,21 +27,33 @@
 #include "rasta_common/radef_rasta_definitions.h"
 #include "rasta_common/rahlp_rasta_helper.h"
 #include "rasta_common/ralog_rasta_logger.h"
+#include "rasta_common/raslb_rasta_slab.h"
+#include "rasta_common/ratmw_rasta_timer_wheel.h"
 #include "rasta_common/rasys_rasta_system_adapter.h"
 #include "rasta_safety_retransmission/sradin_sr_adapter_interface.h"
 #include "rasta_safety_retransmission/sraty_sr_api_types.h"
 #include "rasta_safety_retransmission/srcty_sr_config_types.h"
 #include "rasta_safety_retransmission/srnot_sr_notifications.h"
-#include "srdia_sr_diagnostics.h"       // NOLINT(build/include_subdir)
-#include "srmsg_sr_messages.h"          // NOLINT(build/include_subdir)
-#include "srrece_sr_received_buffer.h"  // NOLINT(build/include_subdir)
-#include "srsend_sr_send_buffer.h"      // NOLINT(build/include_subdir)
-#include "srtyp_sr_types.h"             // NOLINT(build/include_subdir)
+#include "srdia_sr_diagnostics.h"        // NOLINT(build/include_subdir)
+#include "srins_sr_instances.h"          // NOLINT(build/include_subdir)
+#include "srmem_sr_connection_memory.h"  // NOLINT(build/include_subdir)
+#include "srmsg_sr_messages.h"           // NOLINT(build/include_subdir)
+#include "srrece_sr_received_buffer.h"   // NOLINT(build/include_subdir)
+#include "srsend_sr_send_buffer.h"       // NOLINT(build/include_subdir)
+#include "srtyp_sr_types.h"              // NOLINT(build/include_subdir)
 
 // -----------------------------------------------------------------------------
 // Local Macro Definitions
 // -----------------------------------------------------------------------------
 
+#if ((RADEF_CONNECTION_INDEX_SIZE & (RADEF_CONNECTION_INDEX_SIZE - 1U)) != 0U) || (RADEF_CONNECTION_INDEX_SIZE < (2U * RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS))
+#error "RADEF_CONNECTION_INDEX_SIZE must be a power of two and at least twice RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS"
+#endif
+
+#if (2U * RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS) >= RATMW_NO_TIMER
+#error "The timer wheel can not hold the timers of RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS connections"
+#endif
+
 // -----------------------------------------------------------------------------
 // Local Type Definitions
 // -----------------------------------------------------------------------------
@@ -51,30 +63,22 @@
 // -----------------------------------------------------------------------------
 
 /**
- * @brief Initialization state of the module.
- * true, if the module is initialized.
- */
-PRIVATE bool srcor_initialized = false;
-
-/**
- * @brief Pointer to SafRetL configuration.
+ * @brief Data of all SafRetL core instances.
  */
-PRIVATE const srcty_SafetyRetransmissionConfiguration *srcor_sr_configuration = NULL;
+PRIVATE srcor_InstanceData srcor_instances[RADEF_MAX_NUMBER_OF_SR_INSTANCES];
 
 /**
- * @brief Process data of the rasta connections.
+ * @brief Data of the selected SafRetL core instance.
  */
-PRIVATE srcor_RaStaConnectionData srcor_rasta_connections[RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS];
+PRIVATE RADEF_THREAD_LOCAL srcor_InstanceData *srcor_instance = &srcor_instances[0];
 
 /**
- * @brief Granularity of the system timer [ms].
- */
-PRIVATE uint32_t srcor_timer_granularity = 0U;
-
-/**
- * @brief ID of the sr_core debug logger.
+ * @brief Connection index used to check a configuration for duplicated connections.
+ *
+ * The check of a configuration does not use the index of the selected instance, since this instance can already be running. The configurations are checked at
+ * the initialization of the instances, which must not run concurrently.
  */
-PRIVATE uint16_t srcor_logger_id;  //lint !e551 (static variable is used only in the DEBUG build for the debug logger)
+PRIVATE uint32_t srcor_check_connection_index[RADEF_CONNECTION_INDEX_SIZE];
 
 // -----------------------------------------------------------------------------
 // Local Function Prototypes
@@ -89,7 +93,8 @@ PRIVATE uint16_t srcor_logger_id;  //lint !e551 (static variable is used only in
  *
  * This internal function checks if the connection configurations of a SafRetL configuration are valid. All ranges for the SafRetL connection configurations are
  * described in srcty_SafetyRetransmissionConfiguration::connection_configurations. Additionally, it is checked that the sender id is not identical to the
- * receiver id and the connection identification must match the connection index in the array.
+ * receiver id, that every combination of sender and receiver id is only configured once and the connection identification must match the connection index in
+ * the array. The connection index is built by this check.
  *
  * @implementsReq{RASW-573} Is Configuration Valid Function
  *
@@ -102,6 +107,46 @@ PRIVATE uint16_t srcor_logger_id;  //lint !e551 (static variable is used only in
  */
 static bool CheckConnectionConfigurations(const uint32_t number_of_connections, const srcty_ConnectionConfiguration *const connection_configurations);
 
+/**
+ * @brief Build the connection index
+ *
+ * This internal function clears the given connection index and adds all connection configurations to it. If a combination of sender and receiver id is
+ * found already in the index, the building is stopped.
+ *
+ * @implementsReq{RASW-573} Is Configuration Valid Function
+ * @implementsReq{RASW-568} Get Connection ID Function
+ *
+ * @param [in] number_of_connections Number of configured connections. Valid range of ::srcty_kMinNumberOfRaStaConnections <= value <=
+ * ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
+ * @param [in] connection_configurations Configurations of connections. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [out] connection_index Connection index of ::RADEF_CONNECTION_INDEX_SIZE positions to build. If the pointer is NULL, a ::radef_kInternalError fatal
+ * error is thrown.
+ * @return true, if all connections are added to the index.
+ * @return false, if a combination of sender and receiver id is configured more than once.
+ */
+static bool BuildConnectionIndex(const uint32_t number_of_connections, const srcty_ConnectionConfiguration *const connection_configurations,
+                                 uint32_t *const connection_index);
+
+/**
+ * @brief Find a connection in the connection index
+ *
+ * This internal function searches a connection index for a connection configuration with the given sender and receiver id.
+ *
+ * @implementsReq{RASW-568} Get Connection ID Function
+ *
+ * @param [in] connection_configurations Configurations of connections, which are added to the index. If the pointer is NULL, a ::radef_kInternalError fatal
+ * error is thrown.
+ * @param [in] sender_id Sender ID. The full value range is valid and usable.
+ * @param [in] receiver_id Receiver ID. The full value range is valid and usable.
+ * @param [in] connection_index Connection index to search. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [out] index_position Position of the connection in the index or, if the connection is not found, of the unused position where it would be added. If
+ * the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return true, if the connection is found.
+ * @return false, if the connection is not found.
+ */
+static bool FindConnectionInIndex(const srcty_ConnectionConfiguration *const connection_configurations, const uint32_t sender_id, const uint32_t receiver_id,
+                                  const uint32_t *const connection_index, uint32_t *const index_position);
+
 /**
  * @brief Checks if a message is timeout related or not
  *
@@ -171,13 +216,40 @@ static bool SendPendingMessagesWithFlowControlAllowed(const uint32_t connection_
  */
 static void ReceivedFlowControlCheck(const uint32_t connection_id, const srtyp_SrMessageType message_type);
 
+/**
+ * @brief Read the next message of a connection into the input buffer
+ *
+ * This internal function reads the next message from the redundancy channel into the input buffer with ::sradin_ReadMessage, unless a message is already read
+ * and not yet consumed by ::srcor_ReceiveMessage. If no message is received, the received message pending flag is reset.
+ *
+ * @implementsReq{RASW-580} Receive Message Function
+ *
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @return true, if a read message is in the input buffer.
+ * @return false, if no message is received.
+ */
+static bool ReadNextMessage(const uint32_t connection_id);
+
+/**
+ * @brief Get the maximum number of application messages packed into a read message
+ *
+ * This internal function limits the number of application messages, which a read but not yet checked message can contain, by its message size. Every packed
+ * application message needs at least its message length and ::srcty_kMinSrLayerPayloadDataSize payload bytes behind the message header. Since messages with
+ * more packed application messages than the configured n_max_packet are rejected, the limit is at most n_max_packet.
+ *
+ * @param [in] message_size Size of the read message [bytes]. The full value range is valid and usable.
+ * @return uint32_t Maximum number of packed application messages. Valid range: 0 <= value <= configured n_max_packet.
+ */
+static uint32_t GetMaxNumberOfPackedMessages(const uint16_t message_size);
+
 /**
  * @brief Check the general part of a message
  *
  * This internal functions checks the general part of a message. This contains the MD4, message length, message type and is checked with ::srmsg_CheckMessage.
  * If all checks pass, the message header is extracted using ::srmsg_GetMessageHeader and returned via the output parameter msg_hdr. Additionally the
  * authenticity of the message is then checked. If a check fails, the corresponding error counter is incremented (::srdia_IncSafetyCodeErrorCounter,
- * ::srdia_IncTypeErrorCounter & ::srdia_IncAddressErrorCounter) and false is returned to indicate that a test failed.
+ * ::srdia_IncTypeErrorCounter & ::srdia_IncAddressErrorCounter) and false is returned to indicate that a test failed. A data or retransmitted data message with
+ * more packed messages than the configured n_max_packet is not accepted either, since the received buffer reserves at most n_max_packet entries for it.
  *
  * @implementsReq{RASW-580} Receive Message Function
  *
@@ -314,12 +386,34 @@ static bool CalculateTimeliness(const uint32_t connection_id, const srtyp_SrMess
  */
 static void SetConnectionEvent(const srtyp_SrMessageType message_type, srtyp_ConnectionEvents *const connection_event);
 
+/**
+ * @brief Start a timer of a connection.
+ *
+ * This internal function starts the timer of a connection, so that it expires when the time elapsed since the time stamp reaches the interval. If the interval
+ * is already elapsed at the current time, the timer expires immediately.
+ *
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @param [in] timer Timer of the connection (::kTimeoutTimer or ::kHeartbeatTimer).
+ * @param [in] current_time Current time [ms].
+ * @param [in] time_stamp Time stamp from which the interval is measured [ms].
+ * @param [in] interval Interval after which the timer expires [ms]. Valid range: 0 <= value <= ::RATMW_MAX_DELAY.
+ */
+static void StartConnectionTimer(const uint32_t connection_id, const uint16_t timer, const uint32_t current_time, const uint32_t time_stamp,
+                                 const uint32_t interval);
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
 // Local Constant Definitions
 // -----------------------------------------------------------------------------
 
+static const uint32_t kConnectionIndexMask = RADEF_CONNECTION_INDEX_SIZE - 1U;           ///< Mask for connection index positions
+static const uint32_t kUnusedConnectionIndexPosition = RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS;  ///< Connection id of an unused connection index position
+static const uint32_t kConnectionIndexHashFactor = 0x9E3779B1U;  ///< Factor of the multiplicative hash of the sender and receiver id (golden ratio * 2^32)
+static const uint16_t kTimersPerConnection = 2U;                 ///< Number of timers of a connection in the timer wheel
+static const uint16_t kTimeoutTimer = 0U;                        ///< Timer of a connection for the message timeout (T_i)
+static const uint16_t kHeartbeatTimer = 1U;                      ///< Timer of a connection for the heartbeat interval (T_h)
+
 // -----------------------------------------------------------------------------
 // Global Constant Definitions
 // -----------------------------------------------------------------------------
@@ -355,7 +449,9 @@ bool srcor_IsConfigurationValid(const srcty_SafetyRetransmissionConfiguration *c
     config_valid = false;
   } else if (sr_layer_configuration->m_w_a >= sr_layer_configuration->n_send_max) {
     config_valid = false;
-  } else if (sr_layer_configuration->n_max_packet != srcty_kNMaxPacket) {
+  } else if (!rahlp_IsU32InRange(sr_layer_configuration->n_max_packet, srcty_kMinNMaxPacket, srcty_kMaxNMaxPacket)) {
+    config_valid = false;
+  } else if (sr_layer_configuration->n_max_packet > sr_layer_configuration->n_send_max) {
     config_valid = false;
   } else if (!rahlp_IsU32InRange(sr_layer_configuration->n_diag_window, srcty_kMinNDiagWindow, srcty_kMaxNDiagWindow)) {
     config_valid = false;
@@ -374,67 +470,97 @@ bool srcor_IsConfigurationValid(const srcty_SafetyRetransmissionConfiguration *c
 
 void srcor_Init(const srcty_SafetyRetransmissionConfiguration *const sr_layer_configuration) {
   // Input parameter check
-  raas_AssertTrue(!srcor_initialized, radef_kAlreadyInitialized);
+  raas_AssertTrue(!srcor_instance->initialized, radef_kAlreadyInitialized);
   raas_AssertNotNull(sr_layer_configuration, radef_kInvalidParameter);
   raas_AssertTrue(srcor_IsConfigurationValid(sr_layer_configuration), radef_kInvalidConfiguration);
 
-  srcor_logger_id = ralog_INIT_LOGGER(ralog_kLogLevelNone);
-  ralog_LOG_DEBUG(srcor_logger_id, "SafRetL core init ...\n");
+  srcor_instance->logger_id = ralog_INIT_LOGGER(ralog_kLogLevelNone);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "SafRetL core init ...\n");
 
-  srcor_sr_configuration = sr_layer_configuration;
+  srcor_instance->sr_configuration = sr_layer_configuration;
+  raas_AssertTrue(BuildConnectionIndex(srcor_instance->sr_configuration->number_of_connections, srcor_instance->sr_configuration->connection_configurations,
+                                       srcor_instance->connection_index),
+                  radef_kInvalidConfiguration);
 
-  srcor_timer_granularity = rasys_GetTimerGranularity();
+  srcor_instance->timer_granularity = rasys_GetTimerGranularity();
 
-  srmsg_Init(srcor_sr_configuration->safety_code_type, srcor_sr_configuration->md4_initial_value);
-  srdia_Init(srcor_sr_configuration->number_of_connections, srcor_sr_configuration->t_max, srcor_sr_configuration->n_diag_window,
-             srcor_sr_configuration->diag_timing_distr_intervals);
-  srsend_Init(srcor_sr_configuration->number_of_connections);
-  srrece_Init(srcor_sr_configuration->number_of_connections, srcor_sr_configuration->n_send_max);
+  srmsg_Init(srcor_instance->sr_configuration->safety_code_type, srcor_instance->sr_configuration->md4_initial_value);
+  srdia_Init(srcor_instance->sr_configuration->number_of_connections, srcor_instance->sr_configuration->t_max, srcor_instance->sr_configuration->n_diag_window,
+             srcor_instance->sr_configuration->diag_timing_distr_intervals);
+  raslb_Init(&srcty_kSlabConfiguration);  // The slab is shared by the send and the received buffers of all connections
+  srsend_Init(srcor_instance->sr_configuration->number_of_connections);
+  srrece_Init(srcor_instance->sr_configuration->number_of_connections, srcor_instance->sr_configuration->n_send_max);
 
   // Initialize internal data
-  for (uint16_t index = 0; index < srcor_sr_configuration->number_of_connections; ++index) {
-    srcor_rasta_connections[index].sequence_number_tx = 0U;
-    srcor_rasta_connections[index].sequence_number_rx = 0U;
+  srcor_instance->rasta_connections =
+      (srcor_RaStaConnectionData *)srmem_Allocate(srcor_instance->sr_configuration->number_of_connections * (uint32_t)sizeof(srcor_RaStaConnectionData));
+  for (uint32_t index = 0U; index < srcor_instance->sr_configuration->number_of_connections; ++index) {
+    srcor_instance->rasta_connections[index].sequence_number_tx = 0U;
+    srcor_instance->rasta_connections[index].sequence_number_rx = 0U;
 
-    srcor_rasta_connections[index].confirmed_sequence_number_tx = 0U;
-    srcor_rasta_connections[index].last_send_confirmed_sequence_number_tx = 0U;
-    srcor_rasta_connections[index].confirmed_sequence_number_rx = 0U;
+    srcor_instance->rasta_connections[index].confirmed_sequence_number_tx = 0U;
+    srcor_instance->rasta_connections[index].last_send_confirmed_sequence_number_tx = 0U;
+    srcor_instance->rasta_connections[index].confirmed_sequence_number_rx = 0U;
 
-    srcor_rasta_connections[index].time_stamp_rx = 0U;
-    srcor_rasta_connections[index].confirmed_time_stamp_rx = 0U;
-    srcor_rasta_connections[index].time_stamp_tx = 0U;
+    srcor_instance->rasta_connections[index].time_stamp_rx = 0U;
+    srcor_instance->rasta_connections[index].confirmed_time_stamp_rx = 0U;
+    srcor_instance->rasta_connections[index].time_stamp_tx = 0U;
 
-    srcor_rasta_connections[index].detailed_disconnect_reason = 0U;
-    srcor_rasta_connections[index].opposite_receive_buffer_size =
-        srcor_sr_configuration->n_send_max;  // Initialized with own buffer size, it will be updated with opposite buffer size at connection establishment
+    srcor_instance->rasta_connections[index].detailed_disconnect_reason = 0U;
+    // Initialized with own buffer size, it will be updated with opposite buffer size at connection establishment
+    srcor_instance->rasta_connections[index].opposite_receive_buffer_size = srcor_instance->sr_configuration->n_send_max;
 
-    srcor_rasta_connections[index].received_data_pending = false;
+    srcor_instance->rasta_connections[index].received_data_pending = false;
 
-    srcor_rasta_connections[index].input_buffer.message_in_buffer = false;
-    srcor_rasta_connections[index].temporary_send_buffer.message_in_buffer = false;
+    srcor_instance->rasta_connections[index].input_buffer.message_in_buffer = false;
+    srcor_instance->rasta_connections[index].input_buffer.message_read = false;
+    srcor_instance->rasta_connections[index].temporary_send_buffer.message_in_buffer = false;
 
-    srcor_rasta_connections[index].timer_t_i = 0U;
-    srcor_rasta_connections[index].t_rtd = 0U;
-    srcor_rasta_connections[index].t_alive = 0U;
+    srcor_instance->rasta_connections[index].timer_t_i = 0U;
+    srcor_instance->rasta_connections[index].t_rtd = 0U;
+    srcor_instance->rasta_connections[index].t_alive = 0U;
   }
 
-  srcor_initialized = true;
+  // The timers of a connection are started with the initialization of the connection data
+  const uint16_t kNumberOfTimers = (uint16_t)(srcor_instance->sr_configuration->number_of_connections * kTimersPerConnection);
+  srcor_instance->timers = (ratmw_Timer *)srmem_Allocate((uint32_t)kNumberOfTimers * (uint32_t)sizeof(ratmw_Timer));
+  ratmw_Init(&srcor_instance->timer_wheel, srcor_instance->timers, kNumberOfTimers);
+
+  srcor_instance->initialized = true;
+}
+
+void srcor_SelectInstance(const uint32_t instance_index) {
+  // Input parameter check
+  raas_AssertU32InRange(instance_index, 0U, RADEF_MAX_NUMBER_OF_SR_INSTANCES - 1U, radef_kInvalidParameter);
+
+  srcor_instance = &srcor_instances[instance_index];
+}
+
+uint32_t srcor_GetConnectionMemorySize(const uint32_t configured_connections) {
+  // Input parameter check
+  raas_AssertU32InRange(configured_connections, srcty_kMinNumberOfRaStaConnections, RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, radef_kInvalidParameter);
+
+  // Core data and the data of all modules used by the core module
+  uint32_t connection_memory_size = srmem_GetTableAllocationSize(configured_connections, (uint32_t)sizeof(srcor_RaStaConnectionData));
+  connection_memory_size =
+      srmem_AddAllocationSizes(connection_memory_size, srmem_GetTableAllocationSize(configured_connections * kTimersPerConnection, (uint32_t)sizeof(ratmw_Timer)));
+  connection_memory_size = srmem_AddAllocationSizes(connection_memory_size, srdia_GetConnectionMemorySize(configured_connections));
+  connection_memory_size = srmem_AddAllocationSizes(connection_memory_size, srsend_GetConnectionMemorySize(configured_connections));
+  return srmem_AddAllocationSizes(connection_memory_size, srrece_GetConnectionMemorySize(configured_connections));
 }
 
 radef_RaStaReturnCode srcor_GetConnectionId(const uint32_t sender_id, const uint32_t receiver_id, uint32_t *const connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(connection_id, radef_kInvalidParameter);
 
   radef_RaStaReturnCode ret = radef_kInvalidParameter;
+  uint32_t index_position = 0U;
 
-  for (uint32_t index = 0; index < srcor_sr_configuration->number_of_connections; ++index) {
-    if ((receiver_id == srcor_sr_configuration->connection_configurations[index].receiver_id) &&
-        (sender_id == srcor_sr_configuration->connection_configurations[index].sender_id)) {
-      *connection_id = srcor_sr_configuration->connection_configurations[index].connection_id;
-      ret = radef_kNoError;
-      break;
-    }
+  if (FindConnectionInIndex(srcor_instance->sr_configuration->connection_configurations, sender_id, receiver_id, srcor_instance->connection_index,
+                            &index_position)) {
+    *connection_id = srcor_instance->connection_index[index_position];
+    ret = radef_kNoError;
   }
 
   return ret;
@@ -442,43 +568,50 @@ radef_RaStaReturnCode srcor_GetConnectionId(const uint32_t sender_id, const uint
 
 void srcor_InitRaStaConnData(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Data init. Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Data init. Connection id: %u\n", connection_id);
 
   // Initialize internal data
-  srcor_rasta_connections[connection_id].sequence_number_rx = 0U;
+  srcor_instance->rasta_connections[connection_id].sequence_number_rx = 0U;
 
-  srcor_rasta_connections[connection_id].last_send_confirmed_sequence_number_tx = 0U;
-  srcor_rasta_connections[connection_id].confirmed_sequence_number_rx = 0U;
+  srcor_instance->rasta_connections[connection_id].last_send_confirmed_sequence_number_tx = 0U;
+  srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx = 0U;
 
-  srcor_rasta_connections[connection_id].time_stamp_rx = 0U;
-  srcor_rasta_connections[connection_id].time_stamp_tx = 0U;
+  srcor_instance->rasta_connections[connection_id].time_stamp_rx = 0U;
+  srcor_instance->rasta_connections[connection_id].time_stamp_tx = 0U;
 
-  srcor_rasta_connections[connection_id].detailed_disconnect_reason = 0U;
-  srcor_rasta_connections[connection_id].opposite_receive_buffer_size =
-      srcor_sr_configuration->n_send_max;  // Initialized with own buffer size, it will be updated with opposite buffer size at connection establishment
+  srcor_instance->rasta_connections[connection_id].detailed_disconnect_reason = 0U;
+  // Initialized with own buffer size, it will be updated with opposite buffer size at connection establishment
+  srcor_instance->rasta_connections[connection_id].opposite_receive_buffer_size = srcor_instance->sr_configuration->n_send_max;
 
-  srcor_rasta_connections[connection_id].received_data_pending = false;
+  srcor_instance->rasta_connections[connection_id].received_data_pending = false;
 
-  srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = false;
-  srcor_rasta_connections[connection_id].temporary_send_buffer.message_in_buffer = false;
+  srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = false;
+  srcor_instance->rasta_connections[connection_id].input_buffer.message_read = false;
+  srcor_instance->rasta_connections[connection_id].temporary_send_buffer.message_in_buffer = false;
 
-  srcor_rasta_connections[connection_id].t_rtd = 0U;
-  srcor_rasta_connections[connection_id].t_alive = 0U;
+  srcor_instance->rasta_connections[connection_id].t_rtd = 0U;
+  srcor_instance->rasta_connections[connection_id].t_alive = 0U;
 
   // For client & server: SN_T = random, t_i = t_max
-  srcor_rasta_connections[connection_id].sequence_number_tx = rasys_GetRandomNumber();
-  srcor_rasta_connections[connection_id].timer_t_i = srcor_sr_configuration->t_max;
+  srcor_instance->rasta_connections[connection_id].sequence_number_tx = rasys_GetRandomNumber();
+  srcor_instance->rasta_connections[connection_id].timer_t_i = srcor_instance->sr_configuration->t_max;
 
   // In case of client: CS_T = 0 & CTS_R = Tlocal
-  srcor_rasta_connections[connection_id].confirmed_sequence_number_tx = 0;
+  srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx = 0;
   if (!srcor_IsConnRoleServer(connection_id)) {
-    srcor_rasta_connections[connection_id].confirmed_time_stamp_rx = rasys_GetTimerValue();
+    const uint32_t kCurrentTime = rasys_GetTimerValue();
+    srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx = kCurrentTime;
+    StartConnectionTimer(connection_id, kTimeoutTimer, kCurrentTime, kCurrentTime, srcor_instance->rasta_connections[connection_id].timer_t_i + 1U);
   } else {
-    srcor_rasta_connections[connection_id].confirmed_time_stamp_rx = 0U;
+    // The server waits for a ConnReq, which starts the message timeout
+    srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx = 0U;
+    ratmw_StopTimer(&srcor_instance->timer_wheel, (uint16_t)((connection_id * kTimersPerConnection) + kTimeoutTimer));
   }
+  // The heartbeat timer is started with the first sent message
+  ratmw_StopTimer(&srcor_instance->timer_wheel, (uint16_t)((connection_id * kTimersPerConnection) + kHeartbeatTimer));
 
   // Init related module for this connection
   srdia_InitConnectionDiagnostics(connection_id);
@@ -486,31 +619,38 @@ void srcor_InitRaStaConnData(const uint32_t connection_id) {
   srrece_InitBuffer(connection_id);
 
   const uint32_t kRedChannelId = connection_id;  // 1:1 mapping between the connection id and redundancy channel id
-  sradin_OpenRedundancyChannel(kRedChannelId);
+  sradin_OpenRedundancyChannel(srins_GetSelectedInstance(), kRedChannelId);
 }
 
 void srcor_CloseRedundancyChannel(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
   const uint32_t kRedChannelId = connection_id;  // 1:1 mapping between the connection id and redundancy channel id
-  sradin_CloseRedundancyChannel(kRedChannelId);
+  sradin_CloseRedundancyChannel(srins_GetSelectedInstance(), kRedChannelId);
   srdia_SendDiagnosticNotification(connection_id);
+
+  // A message read ahead is dropped together with the messages of the closed redundancy channel
+  srcor_instance->rasta_connections[connection_id].input_buffer.message_read = false;
+
+  // No timings are checked for a closed connection
+  ratmw_StopTimer(&srcor_instance->timer_wheel, (uint16_t)((connection_id * kTimersPerConnection) + kTimeoutTimer));
+  ratmw_StopTimer(&srcor_instance->timer_wheel, (uint16_t)((connection_id * kTimersPerConnection) + kHeartbeatTimer));
 }
 
 void srcor_ReceiveMessage(const uint32_t connection_id, srtyp_ConnectionEvents *const connection_event, bool *const sequence_number_in_seq,
                           bool *const confirmed_time_stamp_in_seq) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
   raas_AssertNotNull(connection_event, radef_kInvalidParameter);
   raas_AssertNotNull(sequence_number_in_seq, radef_kInvalidParameter);
   raas_AssertNotNull(confirmed_time_stamp_in_seq, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
   bool ok = true;
 
@@ -519,19 +659,16 @@ void srcor_ReceiveMessage(const uint32_t connection_id, srtyp_ConnectionEvents *
   *sequence_number_in_seq = false;
   *confirmed_time_stamp_in_seq = false;
 
-  const uint32_t kRedChannelId = connection_id;  // 1:1 mapping between the connection id and redundancy channel id
-
-  srtyp_SrMessage *const msg = &srcor_rasta_connections[connection_id].input_buffer.message_buffer;
-  srtyp_SrMessageHeader *const msg_hdr = &srcor_rasta_connections[connection_id].input_buffer.message_header;
+  srtyp_SrMessage *const msg = &srcor_instance->rasta_connections[connection_id].input_buffer.message_buffer;
+  srtyp_SrMessageHeader *const msg_hdr = &srcor_instance->rasta_connections[connection_id].input_buffer.message_header;
 
-  radef_RaStaReturnCode ret = sradin_ReadMessage(kRedChannelId, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, &msg->message_size, msg->message);
-  raas_AssertTrue((ret == radef_kNoError) || (ret == radef_kNoMessageReceived),
-                  radef_kInternalError);  // Other return values are not expected for sradin_ReadMessage()
-  if (ret == radef_kNoMessageReceived) {
-    srcor_rasta_connections[connection_id].received_data_pending = false;
+  if (!ReadNextMessage(connection_id)) {
     ok = false;
   }
 
+  // The read message is consumed, also if one of the checks fails
+  srcor_instance->rasta_connections[connection_id].input_buffer.message_read = false;
+
   if (ok) {
     // 1), 2), 3) General message check (MD4, message type, message size, authenticity of message)
     ok = GeneralMessageCheck(connection_id, msg, msg_hdr);
@@ -563,26 +700,26 @@ void srcor_ReceiveMessage(const uint32_t connection_id, srtyp_ConnectionEvents *
     SetConnectionEvent(msg_hdr->message_type, connection_event);
 
     // Indicate that the input_buffer contains a newly received message
-    srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = true;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = true;
 
-    ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u, SN in seq: %B, CSN in seq: %B, connection event: %u\n", connection_id, &sequence_number_in_seq,
-                    &confirmed_time_stamp_in_seq, &connection_event);
+    ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u, SN in seq: %B, CSN in seq: %B, connection event: %u\n", connection_id,
+                    &sequence_number_in_seq, &confirmed_time_stamp_in_seq, &connection_event);
   }
 }
 
 bool srcor_ProcessReceivedMessage(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
   bool timeliness_respected = true;
 
   // Check if message in input buffer
-  raas_AssertTrue(srcor_rasta_connections[connection_id].input_buffer.message_in_buffer, radef_kInternalError);
+  raas_AssertTrue(srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer, radef_kInternalError);
 
-  const srtyp_SrMessageHeader *const msg_header = &srcor_rasta_connections[connection_id].input_buffer.message_header;
+  const srtyp_SrMessageHeader *const msg_header = &srcor_instance->rasta_connections[connection_id].input_buffer.message_header;
 
   // Get current time
   const uint32_t kCurrentTime = rasys_GetTimerValue();
@@ -596,19 +733,19 @@ bool srcor_ProcessReceivedMessage(const uint32_t connection_id) {
   if (timeliness_respected) {
     // Update sequence number & time stamp
     bool confirmed_sequence_number_changed = false;
-    srcor_rasta_connections[connection_id].sequence_number_rx = msg_header->sequence_number + 1U;
-    srcor_rasta_connections[connection_id].confirmed_sequence_number_tx = msg_header->sequence_number;
-    if (srcor_rasta_connections[connection_id].confirmed_sequence_number_rx != msg_header->confirmed_sequence_number) {
-      srcor_rasta_connections[connection_id].confirmed_sequence_number_rx = msg_header->confirmed_sequence_number;
+    srcor_instance->rasta_connections[connection_id].sequence_number_rx = msg_header->sequence_number + 1U;
+    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx = msg_header->sequence_number;
+    if (srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx != msg_header->confirmed_sequence_number) {
+      srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx = msg_header->confirmed_sequence_number;
       confirmed_sequence_number_changed = true;
     }
-    srcor_rasta_connections[connection_id].time_stamp_rx = msg_header->time_stamp;
+    srcor_instance->rasta_connections[connection_id].time_stamp_rx = msg_header->time_stamp;
     if (IsMessageTimeoutRelated(msg_header->message_type)) {
-      srcor_rasta_connections[connection_id].confirmed_time_stamp_rx = msg_header->confirmed_time_stamp;
+      srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx = msg_header->confirmed_time_stamp;
     } else if (msg_header->message_type == srtyp_kSrMessageConnReq) {
       // [3] Set CS_R = SN_T - 1 & CTS_R = T_local
-      srcor_rasta_connections[connection_id].confirmed_sequence_number_rx = srcor_rasta_connections[connection_id].sequence_number_tx - 1U;
-      srcor_rasta_connections[connection_id].confirmed_time_stamp_rx = kCurrentTime;
+      srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx = srcor_instance->rasta_connections[connection_id].sequence_number_tx - 1U;
+      srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx = kCurrentTime;
     } else {
       // Nothing to do here
     }
@@ -616,23 +753,29 @@ bool srcor_ProcessReceivedMessage(const uint32_t connection_id) {
     // Remove confirmed messages from send buffer if confirmed sequence number changed and message type is not ConnReq
     // ConnReq can not confirm anything since its the first message exchanged.
     if (confirmed_sequence_number_changed && (msg_header->message_type != srtyp_kSrMessageConnReq)) {
-      srsend_RemoveFromBuffer(connection_id, srcor_rasta_connections[connection_id].confirmed_sequence_number_rx);
+      srsend_RemoveFromBuffer(connection_id, srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx);
     }
 
     // Handle received ConnReq & ConnResp
     if ((msg_header->message_type == srtyp_kSrMessageConnReq) || (msg_header->message_type == srtyp_kSrMessageConnResp)) {
       // Save received opposite buffer size
       srtyp_ProtocolVersion protocol_version;  // Only needed for srmsg_GetConnMessageData() call to extract opposite buffer size. Value never used.
-      srmsg_GetConnMessageData(&srcor_rasta_connections[connection_id].input_buffer.message_buffer, &protocol_version,
-                               &srcor_rasta_connections[connection_id].opposite_receive_buffer_size);
+      srmsg_GetConnMessageData(&srcor_instance->rasta_connections[connection_id].input_buffer.message_buffer, &protocol_version,
+                               &srcor_instance->rasta_connections[connection_id].opposite_receive_buffer_size);
     }
 
     // Handle received data message
     if ((msg_header->message_type == srtyp_kSrMessageData) || (msg_header->message_type == srtyp_kSrMessageRetrData)) {
-      srmsg_GetDataMessagePayload(&srcor_rasta_connections[connection_id].input_buffer.message_buffer,
-                                  &srcor_rasta_connections[connection_id].scratch_message_payload);
+      srtyp_SrMessagePayloadView payload_view;  // Points directly into the input buffer, the payload is only copied once into the received buffer.
+      const uint16_t kNumberOfPayloads = srmsg_GetNumberOfDataMessagePayloads(&srcor_instance->rasta_connections[connection_id].input_buffer.message_buffer);
+
+      uint16_t payload_offset = 0U;  // Kept over all packed messages, so that every packed message is only visited once
 
-      srrece_AddToBuffer(connection_id, &srcor_rasta_connections[connection_id].scratch_message_payload);
+      // Unpack every packed message into its own received buffer entry
+      for (uint16_t payload_index = 0U; payload_index < kNumberOfPayloads; ++payload_index) {
+        srmsg_GetDataMessagePayloadView(&srcor_instance->rasta_connections[connection_id].input_buffer.message_buffer, &payload_offset, &payload_view);
+        srrece_AddToBuffer(connection_id, &payload_view);
+      }
     }
 
     // 11) Receive flow control
@@ -640,64 +783,72 @@ bool srcor_ProcessReceivedMessage(const uint32_t connection_id) {
 
     // 12) Update connection diagnostics
     if (IsMessageTimeoutRelated(msg_header->message_type)) {
-      srdia_UpdateConnectionDiagnostics(connection_id, srcor_rasta_connections[connection_id].t_rtd, srcor_rasta_connections[connection_id].t_alive);
+      srdia_UpdateConnectionDiagnostics(connection_id, srcor_instance->rasta_connections[connection_id].t_rtd,
+                                        srcor_instance->rasta_connections[connection_id].t_alive);
     }
   }
 
+  // Restart the message timeout, since CTS_R and T_i may have changed
+  StartConnectionTimer(connection_id, kTimeoutTimer, kCurrentTime, srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx,
+                       srcor_instance->rasta_connections[connection_id].timer_t_i + 1U);
+
   // Indicate that there is no longer a message in the input_buffer
-  srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = false;
+  srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = false;
 
   return timeliness_respected;
 }
 
 void srcor_UpdateConfirmedTxSequenceNumber(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
   // Only update sequence number to be confirmed (CS_T) when message in input buffer, not from CheckTimings-function
-  if (srcor_rasta_connections[connection_id].input_buffer.message_in_buffer) {
-    srcor_rasta_connections[connection_id].confirmed_sequence_number_tx = srcor_rasta_connections[connection_id].input_buffer.message_header.sequence_number;
+  if (srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer) {
+    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx =
+        srcor_instance->rasta_connections[connection_id].input_buffer.message_header.sequence_number;
 
     // Reset flag for message in input buffer
-    srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = false;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = false;
 
-    ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u, CS_T: %u\n", connection_id, srcor_rasta_connections[connection_id].confirmed_sequence_number_tx);
+    ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u, CS_T: %u\n", connection_id,
+                    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx);
   }
 }
 
 void srcor_UpdateConfirmedRxSequenceNumber(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
   // Only update last confirmed sequence number (CS_R) when message in input buffer
-  if (srcor_rasta_connections[connection_id].input_buffer.message_in_buffer) {
-    srcor_rasta_connections[connection_id].confirmed_sequence_number_rx =
-        srcor_rasta_connections[connection_id].input_buffer.message_header.confirmed_sequence_number;
+  if (srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer) {
+    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx =
+        srcor_instance->rasta_connections[connection_id].input_buffer.message_header.confirmed_sequence_number;
 
-    srsend_RemoveFromBuffer(connection_id, srcor_rasta_connections[connection_id].confirmed_sequence_number_rx);
+    srsend_RemoveFromBuffer(connection_id, srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx);
 
     // Reset flag for message in input buffer
-    srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = false;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = false;
 
-    ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u, CS_R: %u\n", connection_id, srcor_rasta_connections[connection_id].confirmed_sequence_number_rx);
+    ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u, CS_R: %u\n", connection_id,
+                    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx);
   }
 }
 
 bool srcor_IsProtocolVersionAccepted(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
   bool proto_verion_accepted = true;
 
   // Assert if no message in input buffer to check protocol version
-  raas_AssertTrue(srcor_rasta_connections[connection_id].input_buffer.message_in_buffer, radef_kInternalError);
+  raas_AssertTrue(srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer, radef_kInternalError);
 
   srtyp_ProtocolVersion proto_version;
   uint16_t n_send_max;
-  srmsg_GetConnMessageData(&srcor_rasta_connections[connection_id].input_buffer.message_buffer, &proto_version, &n_send_max);
+  srmsg_GetConnMessageData(&srcor_instance->rasta_connections[connection_id].input_buffer.message_buffer, &proto_version, &n_send_max);
 
   uint32_t index = 0U;
   bool check_ongoing = true;
@@ -716,42 +867,42 @@ bool srcor_IsProtocolVersionAccepted(const uint32_t connection_id) {
     ++index;
   }
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u, proto version accepted: %B\n", connection_id, proto_verion_accepted);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u, proto version accepted: %B\n", connection_id, proto_verion_accepted);
 
   return proto_verion_accepted;
 }
 
 void srcor_SetReceivedMessagePendingFlag(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  srcor_rasta_connections[connection_id].received_data_pending = true;
+  srcor_instance->rasta_connections[connection_id].received_data_pending = true;
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 }
 
 bool srcor_GetReceivedMessagePendingFlag(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u, Receive message pending flag: %B\n", connection_id,
-                  srcor_rasta_connections[connection_id].received_data_pending);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u, Receive message pending flag: %B\n", connection_id,
+                  srcor_instance->rasta_connections[connection_id].received_data_pending);
 
-  return srcor_rasta_connections[connection_id].received_data_pending;
+  return srcor_instance->rasta_connections[connection_id].received_data_pending;
 }
 
 void srcor_WriteMessagePayloadToTemporaryBuffer(const uint32_t connection_id, const uint16_t message_payload_size, const uint8_t *const message_payload) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
   raas_AssertU16InRange(message_payload_size, srcty_kMinSrLayerPayloadDataSize, RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE, radef_kInvalidParameter);
   raas_AssertNotNull(message_payload, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
-  srcor_TemporaryBuffer *const temp_buffer = &srcor_rasta_connections[connection_id].temporary_send_buffer;
+  srcor_TemporaryBuffer *const temp_buffer = &srcor_instance->rasta_connections[connection_id].temporary_send_buffer;
   raas_AssertTrue(!temp_buffer->message_in_buffer, radef_kInternalError);
 
   temp_buffer->message_in_buffer = true;
@@ -763,56 +914,66 @@ void srcor_WriteMessagePayloadToTemporaryBuffer(const uint32_t connection_id, co
 
 void srcor_ClearInputBufferMessagePendingFlag(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
-  srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = false;
+  srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = false;
 }
 
 void srcor_SendDataMessage(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
-  raas_AssertTrue(srcor_rasta_connections[connection_id].temporary_send_buffer.message_in_buffer, radef_kNoMessageToSend);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->rasta_connections[connection_id].temporary_send_buffer.message_in_buffer, radef_kNoMessageToSend);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
-  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_rasta_connections[connection_id].scratch_msg_header_create;
-  srtyp_SrMessage *const msg = &srcor_rasta_connections[connection_id].scratch_message;
+  const srtyp_SrMessagePayload *const kPayload = &srcor_instance->rasta_connections[connection_id].temporary_send_buffer.message_payload_buffer;
 
-  msg_hdr_create->sender_id = srcor_sr_configuration->connection_configurations[connection_id].sender_id;
-  msg_hdr_create->receiver_id = srcor_sr_configuration->connection_configurations[connection_id].receiver_id;
-  msg_hdr_create->sequence_number = GetCurrentSequenceNumberAndIncrementNumber(connection_id);
-  msg_hdr_create->confirmed_time_stamp = srcor_rasta_connections[connection_id].time_stamp_rx;
+  // Pack the message into the last data message, as long as this one is waiting in the send buffer
+  bool payload_packed = false;
+  if (srcor_instance->sr_configuration->n_max_packet > srcty_kMinNMaxPacket) {
+    payload_packed = srsend_AddPayloadToLastMessage(connection_id, srcor_instance->sr_configuration->n_max_packet, kPayload);
+  }
 
-  srmsg_CreateDataMessage(*msg_hdr_create, &srcor_rasta_connections[connection_id].temporary_send_buffer.message_payload_buffer, msg);
+  if (!payload_packed) {
+    srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_instance->rasta_connections[connection_id].scratch_msg_header_create;
+    srtyp_SrMessage *const msg = &srcor_instance->rasta_connections[connection_id].scratch_message;
 
-  srcor_rasta_connections[connection_id].temporary_send_buffer.message_in_buffer = false;
+    msg_hdr_create->sender_id = srcor_instance->sr_configuration->connection_configurations[connection_id].sender_id;
+    msg_hdr_create->receiver_id = srcor_instance->sr_configuration->connection_configurations[connection_id].receiver_id;
+    msg_hdr_create->sequence_number = GetCurrentSequenceNumberAndIncrementNumber(connection_id);
+    msg_hdr_create->confirmed_time_stamp = srcor_instance->rasta_connections[connection_id].time_stamp_rx;
 
-  srsend_AddToBuffer(connection_id, msg);
+    srmsg_CreateDataMessage(*msg_hdr_create, kPayload, msg);
+
+    srsend_AddToBuffer(connection_id, msg);
+  }
+
+  srcor_instance->rasta_connections[connection_id].temporary_send_buffer.message_in_buffer = false;
 
   srcor_SendPendingMessages(connection_id);
 }
 
 void srcor_SendConnReqMessage(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
-  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_rasta_connections[connection_id].scratch_msg_header_create;
-  srtyp_SrMessage *const msg = &srcor_rasta_connections[connection_id].scratch_message;
+  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_instance->rasta_connections[connection_id].scratch_msg_header_create;
+  srtyp_SrMessage *const msg = &srcor_instance->rasta_connections[connection_id].scratch_message;
 
-  msg_hdr_create->sender_id = srcor_sr_configuration->connection_configurations[connection_id].sender_id;
-  msg_hdr_create->receiver_id = srcor_sr_configuration->connection_configurations[connection_id].receiver_id;
+  msg_hdr_create->sender_id = srcor_instance->sr_configuration->connection_configurations[connection_id].sender_id;
+  msg_hdr_create->receiver_id = srcor_instance->sr_configuration->connection_configurations[connection_id].receiver_id;
   msg_hdr_create->sequence_number = GetCurrentSequenceNumberAndIncrementNumber(connection_id);
-  srcor_rasta_connections[connection_id].time_stamp_rx = 0U;  // Set to 0 for ConnRequest
-  msg_hdr_create->confirmed_time_stamp = srcor_rasta_connections[connection_id].time_stamp_rx;
+  srcor_instance->rasta_connections[connection_id].time_stamp_rx = 0U;  // Set to 0 for ConnRequest
+  msg_hdr_create->confirmed_time_stamp = srcor_instance->rasta_connections[connection_id].time_stamp_rx;
 
-  srmsg_CreateConnReqMessage(*msg_hdr_create, srcor_kProtocolVersion, srcor_sr_configuration->n_send_max, msg);
+  srmsg_CreateConnReqMessage(*msg_hdr_create, srcor_kProtocolVersion, srcor_instance->sr_configuration->n_send_max, msg);
 
   srsend_AddToBuffer(connection_id, msg);
 
@@ -821,20 +982,20 @@ void srcor_SendConnReqMessage(const uint32_t connection_id) {
 
 void srcor_SendConnRespMessage(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
-  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_rasta_connections[connection_id].scratch_msg_header_create;
-  srtyp_SrMessage *const msg = &srcor_rasta_connections[connection_id].scratch_message;
+  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_instance->rasta_connections[connection_id].scratch_msg_header_create;
+  srtyp_SrMessage *const msg = &srcor_instance->rasta_connections[connection_id].scratch_message;
 
-  msg_hdr_create->sender_id = srcor_sr_configuration->connection_configurations[connection_id].sender_id;
-  msg_hdr_create->receiver_id = srcor_sr_configuration->connection_configurations[connection_id].receiver_id;
+  msg_hdr_create->sender_id = srcor_instance->sr_configuration->connection_configurations[connection_id].sender_id;
+  msg_hdr_create->receiver_id = srcor_instance->sr_configuration->connection_configurations[connection_id].receiver_id;
   msg_hdr_create->sequence_number = GetCurrentSequenceNumberAndIncrementNumber(connection_id);
-  msg_hdr_create->confirmed_time_stamp = srcor_rasta_connections[connection_id].time_stamp_rx;
+  msg_hdr_create->confirmed_time_stamp = srcor_instance->rasta_connections[connection_id].time_stamp_rx;
 
-  srmsg_CreateConnRespMessage(*msg_hdr_create, srcor_kProtocolVersion, srcor_sr_configuration->n_send_max, msg);
+  srmsg_CreateConnRespMessage(*msg_hdr_create, srcor_kProtocolVersion, srcor_instance->sr_configuration->n_send_max, msg);
 
   srsend_AddToBuffer(connection_id, msg);
 
@@ -843,29 +1004,29 @@ void srcor_SendConnRespMessage(const uint32_t connection_id) {
 
 void srcor_SendDiscReqMessage(const uint32_t connection_id, const sraty_DiscReason disconnect_reason) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
   raas_AssertU32InRange((uint32_t)disconnect_reason, (uint32_t)sraty_kDiscReasonMin, (uint32_t)sraty_kDiscReasonMax - 1U, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
   const uint32_t kRedChannelId = connection_id;  // 1:1 mapping between the connection id and redundancy channel id
-  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_rasta_connections[connection_id].scratch_msg_header_create;
-  srtyp_SrMessage *const msg = &srcor_rasta_connections[connection_id].scratch_message;
+  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_instance->rasta_connections[connection_id].scratch_msg_header_create;
+  srtyp_SrMessage *const msg = &srcor_instance->rasta_connections[connection_id].scratch_message;
 
-  msg_hdr_create->sender_id = srcor_sr_configuration->connection_configurations[connection_id].sender_id;
-  msg_hdr_create->receiver_id = srcor_sr_configuration->connection_configurations[connection_id].receiver_id;
+  msg_hdr_create->sender_id = srcor_instance->sr_configuration->connection_configurations[connection_id].sender_id;
+  msg_hdr_create->receiver_id = srcor_instance->sr_configuration->connection_configurations[connection_id].receiver_id;
   msg_hdr_create->sequence_number = GetCurrentSequenceNumberAndIncrementNumber(connection_id);
-  msg_hdr_create->confirmed_time_stamp = srcor_rasta_connections[connection_id].time_stamp_rx;
+  msg_hdr_create->confirmed_time_stamp = srcor_instance->rasta_connections[connection_id].time_stamp_rx;
 
-  srmsg_CreateDiscReqMessage(*msg_hdr_create, srcor_rasta_connections[connection_id].detailed_disconnect_reason, disconnect_reason, msg);
+  srmsg_CreateDiscReqMessage(*msg_hdr_create, srcor_instance->rasta_connections[connection_id].detailed_disconnect_reason, disconnect_reason, msg);
 
-  srtyp_SrMessageHeaderUpdate *const msg_hdr_update = &srcor_rasta_connections[connection_id].scratch_msg_header_update;
+  srtyp_SrMessageHeaderUpdate *const msg_hdr_update = &srcor_instance->rasta_connections[connection_id].scratch_msg_header_update;
   msg_hdr_update->time_stamp = rasys_GetTimerValue();
-  msg_hdr_update->confirmed_sequence_number = srcor_rasta_connections[connection_id].confirmed_sequence_number_tx;
+  msg_hdr_update->confirmed_sequence_number = srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx;
   srmsg_UpdateMessageHeader(*msg_hdr_update, msg);
 
-  sradin_SendMessage(kRedChannelId, msg->message_size, msg->message);
+  sradin_SendMessage(srins_GetSelectedInstance(), kRedChannelId, msg->message_size, msg->message);
   srsend_InitBuffer(connection_id);  // Reset send buffer of this connection to delete all not send messages
 
   srcor_CloseRedundancyChannel(connection_id);
@@ -873,26 +1034,26 @@ void srcor_SendDiscReqMessage(const uint32_t connection_id, const sraty_DiscReas
 
 void srcor_SetDiscDetailedReason(const uint32_t connection_id, const uint16_t detailed_disconnect_reason) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  srcor_rasta_connections[connection_id].detailed_disconnect_reason = detailed_disconnect_reason;
+  srcor_instance->rasta_connections[connection_id].detailed_disconnect_reason = detailed_disconnect_reason;
 }
 
 void srcor_SendHbMessage(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
-  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_rasta_connections[connection_id].scratch_msg_header_create;
-  srtyp_SrMessage *const msg = &srcor_rasta_connections[connection_id].scratch_message;
+  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_instance->rasta_connections[connection_id].scratch_msg_header_create;
+  srtyp_SrMessage *const msg = &srcor_instance->rasta_connections[connection_id].scratch_message;
 
-  msg_hdr_create->sender_id = srcor_sr_configuration->connection_configurations[connection_id].sender_id;
-  msg_hdr_create->receiver_id = srcor_sr_configuration->connection_configurations[connection_id].receiver_id;
+  msg_hdr_create->sender_id = srcor_instance->sr_configuration->connection_configurations[connection_id].sender_id;
+  msg_hdr_create->receiver_id = srcor_instance->sr_configuration->connection_configurations[connection_id].receiver_id;
   msg_hdr_create->sequence_number = GetCurrentSequenceNumberAndIncrementNumber(connection_id);
-  msg_hdr_create->confirmed_time_stamp = srcor_rasta_connections[connection_id].time_stamp_rx;
+  msg_hdr_create->confirmed_time_stamp = srcor_instance->rasta_connections[connection_id].time_stamp_rx;
 
   srmsg_CreateHeartbeatMessage(*msg_hdr_create, msg);
 
@@ -903,18 +1064,18 @@ void srcor_SendHbMessage(const uint32_t connection_id) {
 
 void srcor_SendRetrReqMessage(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
-  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_rasta_connections[connection_id].scratch_msg_header_create;
-  srtyp_SrMessage *const msg = &srcor_rasta_connections[connection_id].scratch_message;
+  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_instance->rasta_connections[connection_id].scratch_msg_header_create;
+  srtyp_SrMessage *const msg = &srcor_instance->rasta_connections[connection_id].scratch_message;
 
-  msg_hdr_create->sender_id = srcor_sr_configuration->connection_configurations[connection_id].sender_id;
-  msg_hdr_create->receiver_id = srcor_sr_configuration->connection_configurations[connection_id].receiver_id;
+  msg_hdr_create->sender_id = srcor_instance->sr_configuration->connection_configurations[connection_id].sender_id;
+  msg_hdr_create->receiver_id = srcor_instance->sr_configuration->connection_configurations[connection_id].receiver_id;
   msg_hdr_create->sequence_number = GetCurrentSequenceNumberAndIncrementNumber(connection_id);
-  msg_hdr_create->confirmed_time_stamp = srcor_rasta_connections[connection_id].time_stamp_rx;
+  msg_hdr_create->confirmed_time_stamp = srcor_instance->rasta_connections[connection_id].time_stamp_rx;
 
   srmsg_CreateRetrReqMessage(*msg_hdr_create, msg);
 
@@ -925,34 +1086,35 @@ void srcor_SendRetrReqMessage(const uint32_t connection_id) {
 
 void srcor_HandleRetrReq(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
   uint32_t next_sequence_number = GetCurrentSequenceNumberAndIncrementNumber(connection_id);
 
-  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_rasta_connections[connection_id].scratch_msg_header_create;
-  msg_hdr_create->sender_id = srcor_sr_configuration->connection_configurations[connection_id].sender_id;
-  msg_hdr_create->receiver_id = srcor_sr_configuration->connection_configurations[connection_id].receiver_id;
+  srtyp_SrMessageHeaderCreate *const msg_hdr_create = &srcor_instance->rasta_connections[connection_id].scratch_msg_header_create;
+  msg_hdr_create->sender_id = srcor_instance->sr_configuration->connection_configurations[connection_id].sender_id;
+  msg_hdr_create->receiver_id = srcor_instance->sr_configuration->connection_configurations[connection_id].receiver_id;
   msg_hdr_create->sequence_number = next_sequence_number;
-  msg_hdr_create->confirmed_time_stamp = srcor_rasta_connections[connection_id].time_stamp_rx;
+  msg_hdr_create->confirmed_time_stamp = srcor_instance->rasta_connections[connection_id].time_stamp_rx;
 
-  srsend_PrepareBufferForRetr(connection_id, srcor_rasta_connections[connection_id].confirmed_sequence_number_rx, *msg_hdr_create, &next_sequence_number);
+  srsend_PrepareBufferForRetr(connection_id, srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx, *msg_hdr_create,
+                              &next_sequence_number);
 
-  srcor_rasta_connections[connection_id].sequence_number_tx = next_sequence_number;  // Save back current sequence number after reworking send buffer
+  srcor_instance->rasta_connections[connection_id].sequence_number_tx = next_sequence_number;  // Save back current sequence number after reworking send buffer
 }
 
 bool srcor_IsRetrReqSequenceNumberAvailable(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
   bool sequence_number_available = false;
 
-  raas_AssertTrue(srcor_rasta_connections[connection_id].input_buffer.message_in_buffer, radef_kInternalError);
+  raas_AssertTrue(srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer, radef_kInternalError);
 
-  const srtyp_SrMessageHeader *const msg_header = &srcor_rasta_connections[connection_id].input_buffer.message_header;
+  const srtyp_SrMessageHeader *const msg_header = &srcor_instance->rasta_connections[connection_id].input_buffer.message_header;
 
   if (msg_header->message_type == srtyp_kSrMessageRetrReq) {
     // Check if the next sequence number after the last received confirmed sequence number is in buffer
@@ -962,37 +1124,38 @@ bool srcor_IsRetrReqSequenceNumberAvailable(const uint32_t connection_id) {
     }
   }
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u, SN available: %B\n", connection_id, sequence_number_available);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u, SN available: %B\n", connection_id, sequence_number_available);
 
   return sequence_number_available;
 }
 
 bool srcor_IsConnRoleServer(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
   bool is_server = true;
 
-  if (srcor_sr_configuration->connection_configurations[connection_id].sender_id <
-      srcor_sr_configuration->connection_configurations[connection_id].receiver_id) {
+  if (srcor_instance->sr_configuration->connection_configurations[connection_id].sender_id <
+      srcor_instance->sr_configuration->connection_configurations[connection_id].receiver_id) {
     is_server = false;
   }
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u, Is server: %B\n", connection_id, is_server);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u, Is server: %B\n", connection_id, is_server);
 
   return is_server;
 }
 
 bool srcor_IsMessageTimeout(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
   bool msg_timeout = false;
 
   // Unsigned integer wrap around allowed here
-  if ((rasys_GetTimerValue() - srcor_rasta_connections[connection_id].confirmed_time_stamp_rx) > srcor_rasta_connections[connection_id].timer_t_i) {
+  if ((rasys_GetTimerValue() - srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx) >
+      srcor_instance->rasta_connections[connection_id].timer_t_i) {
     msg_timeout = true;
   }
 
@@ -1001,90 +1164,138 @@ bool srcor_IsMessageTimeout(const uint32_t connection_id) {
 
 bool srcor_IsHeartbeatInterval(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
   bool hb_interval = false;
 
   // Unsigned integer wrap around allowed here
-  if ((rasys_GetTimerValue() - srcor_rasta_connections[connection_id].time_stamp_tx) >= srcor_sr_configuration->t_h) {
+  if ((rasys_GetTimerValue() - srcor_instance->rasta_connections[connection_id].time_stamp_tx) >= srcor_instance->sr_configuration->t_h) {
     hb_interval = true;
   }
 
   return hb_interval;
 }
 
+bool srcor_GetExpiredTimerConnection(uint32_t *const connection_id) {
+  // Input parameter check
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertNotNull(connection_id, radef_kInvalidParameter);
+
+  uint16_t timer_id = RATMW_NO_TIMER;
+  const bool kTimerExpired = ratmw_GetExpiredTimer(&srcor_instance->timer_wheel, rasys_GetTimerValue(), &timer_id);
+
+  if (kTimerExpired) {
+    *connection_id = (uint32_t)timer_id / kTimersPerConnection;
+  }
+
+  return kTimerExpired;
+}
+
+bool srcor_GetTimeToNextDeadline(uint32_t *const time_to_next_deadline) {
+  // Input parameter check
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertNotNull(time_to_next_deadline, radef_kInvalidParameter);
+
+  return ratmw_GetTimeToNextDeadline(&srcor_instance->timer_wheel, rasys_GetTimerValue(), time_to_next_deadline);
+}
+
 bool srcor_IsReceivedMsgPendingAndBuffersNotFull(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
   bool ret = srcor_GetReceivedMessagePendingFlag(connection_id);
-  ret = (srrece_GetFreeBufferEntries(connection_id) >= srcty_kMinFreeEntriesReceivedBufferForReceive) && ret;
   ret = (srsend_GetFreeBufferEntries(connection_id) >= srcty_kMinFreeEntriesSendBufferForRetr) && ret;
 
+  if (ret) {
+    // The next message is read ahead, so that the received buffer only needs free entries for the messages packed into it
+    ret = ReadNextMessage(connection_id);
+  }
+
+  if (ret) {
+    const uint32_t kMaxNumberOfPackedMessages =
+        GetMaxNumberOfPackedMessages(srcor_instance->rasta_connections[connection_id].input_buffer.message_buffer.message_size);
+    ret = (srrece_GetFreeBufferEntries(connection_id) >= (srcty_kMinFreeEntriesReceivedBufferForReceive * kMaxNumberOfPackedMessages));
+  }
+
   return ret;
 }
 
 void srcor_SendPendingMessages(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
   uint32_t kRedChannelId = connection_id;  // 1:1 mapping between the connection id and redundancy channel id
 
-  srtyp_SrMessage *const msg = &srcor_rasta_connections[connection_id].scratch_message;
-  srtyp_SrMessageHeader *const msg_hdr = &srcor_rasta_connections[connection_id].scratch_msg_header;
-  srtyp_SrMessageHeaderUpdate *const msg_hdr_update = &srcor_rasta_connections[connection_id].scratch_msg_header_update;
+  srtyp_SrMessageHeader *const msg_hdr = &srcor_instance->rasta_connections[connection_id].scratch_msg_header;
 
-  while (SendPendingMessagesWithFlowControlAllowed(connection_id)) {
-    if (srsend_ReadMessageToSend(connection_id, msg) != radef_kNoError) {
-      rasys_FatalError(radef_kInternalError);  // No message could be read although previously checked if messages are in buffer
-    }
+  uint16_t number_of_messages = 0U;
+  do {
+    // Collect a batch of pending messages, the flow control only depends on the send buffer
+    number_of_messages = 0U;
+    while ((number_of_messages < SRCOR_SEND_BATCH_SIZE) && SendPendingMessagesWithFlowControlAllowed(connection_id)) {
+      srtyp_SrMessage *const msg = &srcor_instance->send_messages[number_of_messages];
+      srtyp_SrMessageHeaderUpdate *const msg_hdr_update = &srcor_instance->send_message_header_updates[number_of_messages];
 
-    // Update current time stamp
-    srcor_rasta_connections[connection_id].time_stamp_tx = rasys_GetTimerValue();
-    msg_hdr_update->time_stamp = srcor_rasta_connections[connection_id].time_stamp_tx;
+      if (srsend_ReadMessageToSend(connection_id, msg) != radef_kNoError) {
+        rasys_FatalError(radef_kInternalError);  // No message could be read although previously checked if messages are in buffer
+      }
 
-    // Update confirmed sequence number CS_T
-    srmsg_GetMessageHeader(msg, msg_hdr);
-    if (msg_hdr->message_type == srtyp_kSrMessageConnReq) {
-      srcor_rasta_connections[connection_id].confirmed_sequence_number_tx = 0;  // For a ConnReq, CS_T must be set to 0
-    }
-    msg_hdr_update->confirmed_sequence_number = srcor_rasta_connections[connection_id].confirmed_sequence_number_tx;
-    srcor_rasta_connections[connection_id].last_send_confirmed_sequence_number_tx =
-        msg_hdr_update->confirmed_sequence_number;  // Backup last send confirmed sequence number
+      // Update current time stamp
+      srcor_instance->rasta_connections[connection_id].time_stamp_tx = rasys_GetTimerValue();
+      msg_hdr_update->time_stamp = srcor_instance->rasta_connections[connection_id].time_stamp_tx;
+      StartConnectionTimer(connection_id, kHeartbeatTimer, srcor_instance->rasta_connections[connection_id].time_stamp_tx,
+                           srcor_instance->rasta_connections[connection_id].time_stamp_tx, srcor_instance->sr_configuration->t_h);
 
-    srmsg_UpdateMessageHeader(*msg_hdr_update, msg);
+      // Update confirmed sequence number CS_T
+      srmsg_GetMessageHeader(msg, msg_hdr);
+      if (msg_hdr->message_type == srtyp_kSrMessageConnReq) {
+        srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx = 0;  // For a ConnReq, CS_T must be set to 0
+      }
+      msg_hdr_update->confirmed_sequence_number = srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx;
+      srcor_instance->rasta_connections[connection_id].last_send_confirmed_sequence_number_tx =
+          msg_hdr_update->confirmed_sequence_number;  // Backup last send confirmed sequence number
 
-    sradin_SendMessage(kRedChannelId, msg->message_size, msg->message);
-  }
+      ++number_of_messages;
+    }
+
+    if (number_of_messages > 0U) {
+      // Calculate the safety codes of all messages of the batch at once and send the messages in order
+      srmsg_UpdateMessageHeaderBatch(number_of_messages, srcor_instance->send_message_header_updates, srcor_instance->send_messages);
+      for (uint16_t message_index = 0U; message_index < number_of_messages; ++message_index) {
+        const srtyp_SrMessage *const kMsg = &srcor_instance->send_messages[message_index];
+        sradin_SendMessage(srins_GetSelectedInstance(), kRedChannelId, kMsg->message_size, kMsg->message);
+      }
+    }
+  } while (number_of_messages == SRCOR_SEND_BATCH_SIZE);
 }
 
 void srcor_SendConnectionStateNotification(const uint32_t connection_id, const sraty_ConnectionStates connection_state,
                                            const sraty_DiscReason disconnect_reason) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
   raas_AssertU32InRange((uint32_t)connection_state, (uint32_t)sraty_kConnectionMin, (uint32_t)sraty_kConnectionMax - 1U, radef_kInvalidParameter);
   raas_AssertU32InRange((uint32_t)disconnect_reason, (uint32_t)sraty_kDiscReasonMin, (uint32_t)sraty_kDiscReasonMax - 1U, radef_kInvalidParameter);
 
-  ralog_LOG_DEBUG(srcor_logger_id, "Connection id: %u\n", connection_id);
+  ralog_LOG_DEBUG(srcor_instance->logger_id, "Connection id: %u\n", connection_id);
 
   // Collect notification data
   sraty_BufferUtilisation buffer_util;
   uint16_t opposite_buffer_size;
   srcor_GetBufferSizeAndUtilisation(connection_id, &buffer_util, &opposite_buffer_size);
 
-  srnot_ConnectionStateNotification(connection_id, connection_state, buffer_util, opposite_buffer_size, disconnect_reason,
-                                    srcor_rasta_connections[connection_id].detailed_disconnect_reason);
+  srnot_ConnectionStateNotification(srins_GetSelectedInstance(), connection_id, connection_state, buffer_util, opposite_buffer_size, disconnect_reason,
+                                    srcor_instance->rasta_connections[connection_id].detailed_disconnect_reason);
 }
 
 void srcor_GetBufferSizeAndUtilisation(const uint32_t connection_id, sraty_BufferUtilisation *const buffer_utilisation, uint16_t *const opposite_buffer_size) {
   // Input parameter check
-  raas_AssertTrue(srcor_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srcor_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInvalidParameter);
   raas_AssertNotNull(buffer_utilisation, radef_kInvalidParameter);
   raas_AssertNotNull(opposite_buffer_size, radef_kInvalidParameter);
 
@@ -1095,7 +1306,7 @@ void srcor_GetBufferSizeAndUtilisation(const uint32_t connection_id, sraty_Buffe
   buffer_utilisation->send_buffer_used = srsend_GetUsedBufferEntries(connection_id);
 
   // Get opposite buffer size
-  *opposite_buffer_size = srcor_rasta_connections[connection_id].opposite_receive_buffer_size;
+  *opposite_buffer_size = srcor_instance->rasta_connections[connection_id].opposite_receive_buffer_size;
 }
 
 // -----------------------------------------------------------------------------
@@ -1120,9 +1331,69 @@ static bool CheckConnectionConfigurations(const uint32_t number_of_connections,
     }
   }
 
+  // Check that every combination of sender and receiver id is only configured once, the index of the instance is only built at the initialization
+  if (connection_config_valid) {
+    connection_config_valid = BuildConnectionIndex(number_of_connections, connection_configurations, srcor_check_connection_index);
+  }
+
   return connection_config_valid;
 }
 
+static bool BuildConnectionIndex(const uint32_t number_of_connections, const srcty_ConnectionConfiguration *const connection_configurations,
+                                 uint32_t *const connection_index) {
+  // Input parameter check
+  raas_AssertU32InRange(number_of_connections, srcty_kMinNumberOfRaStaConnections, RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, radef_kInternalError);
+  raas_AssertNotNull(connection_configurations, radef_kInternalError);
+  raas_AssertNotNull(connection_index, radef_kInternalError);
+
+  bool index_built = true;
+
+  for (uint32_t index_position = 0U; index_position < RADEF_CONNECTION_INDEX_SIZE; ++index_position) {
+    connection_index[index_position] = kUnusedConnectionIndexPosition;
+  }
+
+  for (uint32_t conn_index = 0U; conn_index < number_of_connections; ++conn_index) {
+    uint32_t index_position = 0U;
+
+    if (FindConnectionInIndex(connection_configurations, connection_configurations[conn_index].sender_id, connection_configurations[conn_index].receiver_id,
+                              connection_index, &index_position)) {
+      index_built = false;
+      break;
+    }
+    connection_index[index_position] = conn_index;
+  }
+
+  return index_built;
+}
+
+static bool FindConnectionInIndex(const srcty_ConnectionConfiguration *const connection_configurations, const uint32_t sender_id, const uint32_t receiver_id,
+                                  const uint32_t *const connection_index, uint32_t *const index_position) {
+  // Input parameter check
+  raas_AssertNotNull(connection_configurations, radef_kInternalError);
+  raas_AssertNotNull(connection_index, radef_kInternalError);
+  raas_AssertNotNull(index_position, radef_kInternalError);
+
+  bool connection_found = false;
+
+  // Multiplicative hash of sender and receiver id, the upper bits are folded in since only the lower bits are used as position
+  uint32_t hash = ((sender_id * kConnectionIndexHashFactor) ^ receiver_id) * kConnectionIndexHashFactor;
+  hash ^= (hash >> 16U);
+  uint32_t position = hash & kConnectionIndexMask;
+
+  // The index has always unused positions, so that the search ends at the latest at an unused position
+  while (connection_index[position] != kUnusedConnectionIndexPosition) {
+    const srcty_ConnectionConfiguration *const kConnection = &connection_configurations[connection_index[position]];
+    if ((kConnection->sender_id == sender_id) && (kConnection->receiver_id == receiver_id)) {
+      connection_found = true;
+      break;
+    }
+    position = (position + 1U) & kConnectionIndexMask;
+  }
+  *index_position = position;
+
+  return connection_found;
+}
+
 static bool IsMessageTimeoutRelated(const srtyp_SrMessageType message_type) {
   // Input parameter check
   raas_AssertU32InRange((uint32_t)message_type, (uint32_t)srtyp_kSrMessageMin, (uint32_t)srtyp_kSrMessageMax - 1U, radef_kInternalError);
@@ -1138,25 +1409,25 @@ static bool IsMessageTimeoutRelated(const srtyp_SrMessageType message_type) {
 
 static uint32_t GetCurrentSequenceNumberAndIncrementNumber(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInternalError);
 
-  const uint32_t kCurrentSequenceNumber = srcor_rasta_connections[connection_id].sequence_number_tx;
+  const uint32_t kCurrentSequenceNumber = srcor_instance->rasta_connections[connection_id].sequence_number_tx;
 
   // Increment sequence
-  ++srcor_rasta_connections[connection_id].sequence_number_tx;
+  ++srcor_instance->rasta_connections[connection_id].sequence_number_tx;
 
   return kCurrentSequenceNumber;
 }
 
 static bool SendPendingMessagesWithFlowControlAllowed(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInternalError);
 
   uint16_t not_confirmed_messages = srsend_GetUsedBufferEntries(connection_id);
   not_confirmed_messages -= srsend_GetNumberOfMessagesToSend(connection_id);
 
   bool sending_allowed = (srsend_GetNumberOfMessagesToSend(connection_id) > 0U);
-  sending_allowed = (srcor_rasta_connections[connection_id].opposite_receive_buffer_size > not_confirmed_messages) &&
+  sending_allowed = (srcor_instance->rasta_connections[connection_id].opposite_receive_buffer_size > not_confirmed_messages) &&
                     sending_allowed;  // Flow control, rule 1: Sending allowed, when not confirmed messages in send buffer < opposite N_sendMax
 
   return sending_allowed;
@@ -1164,16 +1435,17 @@ static bool SendPendingMessagesWithFlowControlAllowed(const uint32_t connection_
 
 static void ReceivedFlowControlCheck(const uint32_t connection_id, const srtyp_SrMessageType message_type) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInternalError);
   raas_AssertU32InRange((uint32_t)message_type, (uint32_t)srtyp_kSrMessageMin, (uint32_t)srtyp_kSrMessageMax - 1U, radef_kInternalError);
 
   // Received flow control is only applied for HB, RetrResp, Data & RetrData messages, as for this message types no  message from the opposite side is assumed
   if ((message_type == srtyp_kSrMessageHb) || (message_type == srtyp_kSrMessageRetrResp) || (message_type == srtyp_kSrMessageData) ||
       (message_type == srtyp_kSrMessageRetrData)) {
     uint32_t not_confirmed_sequence_numbers =
-        srcor_rasta_connections[connection_id].confirmed_sequence_number_tx - srcor_rasta_connections[connection_id].last_send_confirmed_sequence_number_tx;
+        srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx -
+        srcor_instance->rasta_connections[connection_id].last_send_confirmed_sequence_number_tx;
 
-    if (not_confirmed_sequence_numbers >= srcor_sr_configuration->m_w_a) {
+    if (not_confirmed_sequence_numbers >= srcor_instance->sr_configuration->m_w_a) {
       if (srsend_GetNumberOfMessagesToSend(connection_id) == 0U) {
         srcor_SendHbMessage(connection_id);  // Send a HB message if no other messages to send to confirm sequence number
       } else {
@@ -1183,9 +1455,47 @@ static void ReceivedFlowControlCheck(const uint32_t connection_id, const srtyp_S
   }
 }
 
+static bool ReadNextMessage(const uint32_t connection_id) {
+  // Input parameter check
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInternalError);
+
+  srcor_InputBuffer *const input_buffer = &srcor_instance->rasta_connections[connection_id].input_buffer;
+
+  if (!input_buffer->message_read) {
+    const uint32_t kRedChannelId = connection_id;  // 1:1 mapping between the connection id and redundancy channel id
+
+    radef_RaStaReturnCode ret = sradin_ReadMessage(srins_GetSelectedInstance(), kRedChannelId, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE,
+                                                   &input_buffer->message_buffer.message_size, input_buffer->message_buffer.message);
+    raas_AssertTrue((ret == radef_kNoError) || (ret == radef_kNoMessageReceived),
+                    radef_kInternalError);  // Other return values are not expected for sradin_ReadMessage()
+    if (ret == radef_kNoMessageReceived) {
+      srcor_instance->rasta_connections[connection_id].received_data_pending = false;
+    } else {
+      input_buffer->message_read = true;
+    }
+  }
+
+  return input_buffer->message_read;
+}
+
+static uint32_t GetMaxNumberOfPackedMessages(const uint16_t message_size) {
+  uint32_t max_number_of_packed_messages = 0U;
+
+  if (message_size > RADEF_SR_LAYER_MESSAGE_HEADER_SIZE) {
+    max_number_of_packed_messages =
+        ((uint32_t)message_size - RADEF_SR_LAYER_MESSAGE_HEADER_SIZE) / (RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE + srcty_kMinSrLayerPayloadDataSize);
+  }
+
+  if (max_number_of_packed_messages > srcor_instance->sr_configuration->n_max_packet) {
+    max_number_of_packed_messages = srcor_instance->sr_configuration->n_max_packet;
+  }
+
+  return max_number_of_packed_messages;
+}
+
 static bool GeneralMessageCheck(const uint32_t connection_id, const srtyp_SrMessage *const msg, srtyp_SrMessageHeader *const msg_hdr) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInternalError);
   raas_AssertNotNull(msg, radef_kInternalError);
   raas_AssertNotNull(msg_hdr, radef_kInternalError);
 
@@ -1208,18 +1518,25 @@ static bool GeneralMessageCheck(const uint32_t connection_id, const srtyp_SrMess
   }
 
   // Check authenticity of message
-  if ((msg_hdr->receiver_id != srcor_sr_configuration->connection_configurations[connection_id].sender_id) ||
-      (msg_hdr->sender_id != srcor_sr_configuration->connection_configurations[connection_id].receiver_id)) {
+  if ((msg_hdr->receiver_id != srcor_instance->sr_configuration->connection_configurations[connection_id].sender_id) ||
+      (msg_hdr->sender_id != srcor_instance->sr_configuration->connection_configurations[connection_id].receiver_id)) {
     srdia_IncAddressErrorCounter(connection_id);
     ok = false;
   }
 
+  // Check number of packed messages
+  if (ok && ((msg_hdr->message_type == srtyp_kSrMessageData) || (msg_hdr->message_type == srtyp_kSrMessageRetrData))) {
+    if (srmsg_GetNumberOfDataMessagePayloads(msg) > srcor_instance->sr_configuration->n_max_packet) {
+      ok = false;
+    }
+  }
+
   return ok;
 }
 
 static bool CheckSequenceNumberRange(const uint32_t connection_id, const srtyp_SrMessageHeader *const msg_hdr) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInternalError);
   raas_AssertNotNull(msg_hdr, radef_kInternalError);
 
   bool ok = false;
@@ -1236,8 +1553,9 @@ static bool CheckSequenceNumberRange(const uint32_t connection_id, const srtyp_S
     case srtyp_kSrMessageHb:       // fall-through
     case srtyp_kSrMessageData:     // fall-through
     case srtyp_kSrMessageRetrData:
-      value_difference = msg_hdr->sequence_number - srcor_rasta_connections[connection_id].sequence_number_rx;  // Unsigned integer wrap around allowed here
-      ok = rahlp_IsU32InRange(value_difference, 0U, 10U * (uint32_t)srcor_sr_configuration->n_send_max);
+      // Unsigned integer wrap around allowed here
+      value_difference = msg_hdr->sequence_number - srcor_instance->rasta_connections[connection_id].sequence_number_rx;
+      ok = rahlp_IsU32InRange(value_difference, 0U, 10U * (uint32_t)srcor_instance->sr_configuration->n_send_max);
       break;
       // no coverage start
     default:
@@ -1251,7 +1569,7 @@ static bool CheckSequenceNumberRange(const uint32_t connection_id, const srtyp_S
 
 static bool CheckSequenceNumber(const uint32_t connection_id, const srtyp_SrMessageHeader *const msg_hdr) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInternalError);
   raas_AssertNotNull(msg_hdr, radef_kInternalError);
 
   bool sequence_number_in_seq = false;
@@ -1267,7 +1585,7 @@ static bool CheckSequenceNumber(const uint32_t connection_id, const srtyp_SrMess
     case srtyp_kSrMessageHb:       // fall-through
     case srtyp_kSrMessageData:     // fall-through
     case srtyp_kSrMessageRetrData:
-      if (msg_hdr->sequence_number == srcor_rasta_connections[connection_id].sequence_number_rx) {
+      if (msg_hdr->sequence_number == srcor_instance->rasta_connections[connection_id].sequence_number_rx) {
         sequence_number_in_seq = true;
       }
       break;
@@ -1288,7 +1606,7 @@ static bool CheckSequenceNumber(const uint32_t connection_id, const srtyp_SrMess
 
 static bool CheckConfirmedSequenceNumber(const uint32_t connection_id, const srtyp_SrMessageHeader *const msg_hdr) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInternalError);
   raas_AssertNotNull(msg_hdr, radef_kInternalError);
 
   bool confirmed_sequence_nbr_in_seq = false;
@@ -1302,7 +1620,7 @@ static bool CheckConfirmedSequenceNumber(const uint32_t connection_id, const srt
       }
       break;
     case srtyp_kSrMessageConnResp:
-      if (msg_hdr->confirmed_sequence_number == (srcor_rasta_connections[connection_id].sequence_number_tx - 1U)) {
+      if (msg_hdr->confirmed_sequence_number == (srcor_instance->rasta_connections[connection_id].sequence_number_tx - 1U)) {
         confirmed_sequence_nbr_in_seq = true;
       }
       break;
@@ -1313,9 +1631,9 @@ static bool CheckConfirmedSequenceNumber(const uint32_t connection_id, const srt
     case srtyp_kSrMessageData:      // fall-through
     case srtyp_kSrMessageRetrData:
       value_difference = msg_hdr->confirmed_sequence_number -
-                         srcor_rasta_connections[connection_id].confirmed_sequence_number_rx;  // Unsigned integer wrap around allowed here
-      max_value_difference = srcor_rasta_connections[connection_id].sequence_number_tx -
-                             (srcor_rasta_connections[connection_id].confirmed_sequence_number_rx - 1U);  // Unsigned integer wrap around allowed here
+                         srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx;  // Unsigned integer wrap around allowed here
+      max_value_difference = srcor_instance->rasta_connections[connection_id].sequence_number_tx -
+                             (srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx - 1U);  // Unsigned integer wrap around allowed here
       confirmed_sequence_nbr_in_seq = rahlp_IsU32InRange(value_difference, 0U, max_value_difference);
       break;
       // no coverage start
@@ -1335,7 +1653,7 @@ static bool CheckConfirmedSequenceNumber(const uint32_t connection_id, const srt
 
 static bool CheckTimeStamp(const uint32_t connection_id, const srtyp_SrMessageHeader *const msg_hdr) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInternalError);
   raas_AssertNotNull(msg_hdr, radef_kInternalError);
 
   bool time_stamp_in_seq = false;
@@ -1352,8 +1670,9 @@ static bool CheckTimeStamp(const uint32_t connection_id, const srtyp_SrMessageHe
     case srtyp_kSrMessageHb:    // fall-through
     case srtyp_kSrMessageData:  // fall-through
     case srtyp_kSrMessageRetrData:
-      difference_time_stamp = msg_hdr->time_stamp - srcor_rasta_connections[connection_id].time_stamp_rx;  // Unsigned integer wrap around allowed here
-      time_stamp_in_seq = rahlp_IsU32InRange(difference_time_stamp, 0U, srcor_sr_configuration->t_max - 1U);
+      // Unsigned integer wrap around allowed here
+      difference_time_stamp = msg_hdr->time_stamp - srcor_instance->rasta_connections[connection_id].time_stamp_rx;
+      time_stamp_in_seq = rahlp_IsU32InRange(difference_time_stamp, 0U, srcor_instance->sr_configuration->t_max - 1U);
       break;
       // no coverage start
     default:
@@ -1367,7 +1686,7 @@ static bool CheckTimeStamp(const uint32_t connection_id, const srtyp_SrMessageHe
 
 static bool CheckConfirmedTimeStamp(const uint32_t connection_id, const srtyp_SrMessageHeader *const msg_hdr) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInternalError);
   raas_AssertNotNull(msg_hdr, radef_kInternalError);
 
   bool confirmed_time_stamp_in_seq = false;
@@ -1384,9 +1703,9 @@ static bool CheckConfirmedTimeStamp(const uint32_t connection_id, const srtyp_Sr
     case srtyp_kSrMessageHb:    // fall-through
     case srtyp_kSrMessageData:  // fall-through
     case srtyp_kSrMessageRetrData:
-      difference_confirmed_time_stamp =
-          msg_hdr->confirmed_time_stamp - srcor_rasta_connections[connection_id].confirmed_time_stamp_rx;  // Unsigned integer wrap around allowed here
-      confirmed_time_stamp_in_seq = rahlp_IsU32InRange(difference_confirmed_time_stamp, 0U, srcor_sr_configuration->t_max - 1U);
+      // Unsigned integer wrap around allowed here
+      difference_confirmed_time_stamp = msg_hdr->confirmed_time_stamp - srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx;
+      confirmed_time_stamp_in_seq = rahlp_IsU32InRange(difference_confirmed_time_stamp, 0U, srcor_instance->sr_configuration->t_max - 1U);
       break;
       // no coverage start
     default:
@@ -1400,23 +1719,24 @@ static bool CheckConfirmedTimeStamp(const uint32_t connection_id, const srtyp_Sr
 
 static bool CalculateTimeliness(const uint32_t connection_id, const srtyp_SrMessageHeader *const msg_hdr, const uint32_t current_time) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srcor_sr_configuration->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srcor_instance->sr_configuration->number_of_connections, radef_kInternalError);
   raas_AssertNotNull(msg_hdr, radef_kInternalError);
 
   bool timeliness_respected = true;
 
   // Calculate T_rtd & T_alive
-  srcor_rasta_connections[connection_id].t_rtd =
-      current_time + srcor_timer_granularity - msg_hdr->confirmed_time_stamp;  // Unsigned integer wrap around allowed here
-  srcor_rasta_connections[connection_id].t_alive =
-      current_time - srcor_rasta_connections[connection_id].confirmed_time_stamp_rx;  // Unsigned integer wrap around allowed here
+  srcor_instance->rasta_connections[connection_id].t_rtd =
+      current_time + srcor_instance->timer_granularity - msg_hdr->confirmed_time_stamp;  // Unsigned integer wrap around allowed here
+  srcor_instance->rasta_connections[connection_id].t_alive =
+      current_time - srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx;  // Unsigned integer wrap around allowed here
 
   // Calculate new timer T_i value
-  if (srcor_sr_configuration->t_max >= srcor_rasta_connections[connection_id].t_rtd) {
-    srcor_rasta_connections[connection_id].timer_t_i = srcor_sr_configuration->t_max - srcor_rasta_connections[connection_id].t_rtd;
+  if (srcor_instance->sr_configuration->t_max >= srcor_instance->rasta_connections[connection_id].t_rtd) {
+    srcor_instance->rasta_connections[connection_id].timer_t_i =
+        srcor_instance->sr_configuration->t_max - srcor_instance->rasta_connections[connection_id].t_rtd;
   } else {
     // Timeliness of messages can no longer be guaranteed
-    srcor_rasta_connections[connection_id].timer_t_i = 0U;
+    srcor_instance->rasta_connections[connection_id].timer_t_i = 0U;
     timeliness_respected = false;
   }
 
@@ -1460,3 +1780,15 @@ static void SetConnectionEvent(const srtyp_SrMessageType message_type, srtyp_Con
       // no coverage end
   }
 }
+
+static void StartConnectionTimer(const uint32_t connection_id, const uint16_t timer, const uint32_t current_time, const uint32_t time_stamp,
+                                 const uint32_t interval) {
+  const uint32_t kElapsedTime = current_time - time_stamp;  // Unsigned integer wrap around allowed here
+  uint32_t delay = 0U;
+
+  if (kElapsedTime < interval) {
+    delay = interval - kElapsedTime;
+  }
+
+  ratmw_StartTimer(&srcor_instance->timer_wheel, (uint16_t)((connection_id * kTimersPerConnection) + timer), current_time, delay);
+}
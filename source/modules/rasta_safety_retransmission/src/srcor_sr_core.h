@@ -41,6 +41,7 @@
 #include <stdint.h>
 
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/ratmw_rasta_timer_wheel.h"
 #include "rasta_safety_retransmission/sraty_sr_api_types.h"
 #include "rasta_safety_retransmission/srcty_sr_config_types.h"
 #include "srtyp_sr_types.h"  // NOLINT(build/include_subdir)
@@ -49,6 +50,8 @@
 // Global Macro Definitions
 // -----------------------------------------------------------------------------
 
+#define SRCOR_SEND_BATCH_SIZE (4U)  ///< Maximum number of pending messages, whose safety codes are calculated at once by ::srcor_SendPendingMessages
+
 // -----------------------------------------------------------------------------
 // Global Type Definitions
 // -----------------------------------------------------------------------------
@@ -59,6 +62,7 @@
 //lint -save -e9045 (structures are defined globally)
 typedef struct {
   bool message_in_buffer;                ///< Flag which indicates, that a new unprocessed message is in the message input buffer.
+  bool message_read;                     ///< Flag which indicates, that the next message is read from the redundancy channel, but not yet checked.
   srtyp_SrMessageHeader message_header;  ///< Message header extracted from message in buffer. Valid range as described in ::srtyp_SrMessageHeader.
   srtyp_SrMessage message_buffer;        ///< Input buffer for newly received message. Valid range as described in ::srtyp_SrMessage.
 } srcor_InputBuffer;
@@ -110,10 +114,36 @@ typedef struct {
   srtyp_SrMessageHeaderUpdate scratch_msg_header_update;  ///< Memory used for message update. Valid range as described in ::srtyp_SrMessageHeader.
   srtyp_SrMessageHeader scratch_msg_header;               ///< Memory used for holding header. Valid range as described in ::srcor_InputBuffer.
   srtyp_SrMessage scratch_message;                        ///< Memory to transfer messages. Valid range as described in ::srtyp_SrMessage.
-  srtyp_SrMessagePayload scratch_message_payload;         ///< Memory to transfer messages payload. Valid range as described in ::srtyp_SrMessagePayload.
 } srcor_RaStaConnectionData;
 //lint -restore
 
+/**
+ * @brief Struct for the data of a SafRetL core instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;                                                 ///< Initialization state of the module. true, if the module is initialized.
+  const srcty_SafetyRetransmissionConfiguration *sr_configuration;  ///< Pointer to SafRetL configuration.
+  srcor_RaStaConnectionData *rasta_connections;                     ///< Process data of the rasta connections, allocated from the connection memory.
+  uint32_t connection_index[RADEF_CONNECTION_INDEX_SIZE];           ///< Index of the connection configurations by sender and receiver id. Every position holds
+                                                                    ///< a connection id or ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS for an unused position. A
+                                                                    ///< connection is stored at the position given by the hash of its sender and receiver id
+                                                                    ///< or, if this position is already used, at the next unused position (open addressing with
+                                                                    ///< linear probing). Since at least half of the positions are unused, a lookup only
+                                                                    ///< inspects a few positions, independent of the number of connections.
+  uint32_t timer_granularity;                                       ///< Granularity of the system timer [ms].
+  ratmw_TimerWheel timer_wheel;                                     ///< Timer wheel with the message timeout and the heartbeat timer of all connections. The
+                                                                    ///< timers of a connection are started whenever the confirmed time stamp rx (CTS_R), the
+                                                                    ///< timer T_i or the last send time stamp (time_stamp_tx) change, so that they expire when
+                                                                    ///< ::srcor_IsMessageTimeout or ::srcor_IsHeartbeatInterval becomes true.
+  ratmw_Timer *timers;                                              ///< Timers of the timer wheel. Allocated from the connection memory with two timers per
+                                                                    ///< connection.
+  srtyp_SrMessage send_messages[SRCOR_SEND_BATCH_SIZE];             ///< Pending messages read from the send buffer, which are updated and sent together.
+  srtyp_SrMessageHeaderUpdate send_message_header_updates[SRCOR_SEND_BATCH_SIZE];  ///< Header updates of the pending messages in send_messages.
+  uint16_t logger_id;                                                              ///< ID of the sr_core debug logger.
+} srcor_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -138,8 +168,12 @@ extern "C" {
  * are done:
  * - received flow control: MWA < NsendMax
  * - sender id != receiver id
+ * - every combination of sender id and receiver id is configured only once
  * .
  *
+ * The check does not change the data of the selected instance, so that it can be called while another instance is running. The connection index used by
+ * ::srcor_GetConnectionId is only built by ::srcor_Init.
+ *
  * @implementsReq{RASW-573} Is Configuration Valid Function
  *
  * @param [in] sr_layer_configuration Pointer to SafRetL configuration. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
@@ -158,7 +192,7 @@ bool srcor_IsConfigurationValid(const srcty_SafetyRetransmissionConfiguration *c
  * - send buffer
  * - receive buffer
  * .
- * Finally, the internal structures are also properly initalized.
+ * Finally, the internal structures are allocated from the connection memory and properly initalized.
  *
  * @pre The core module must not be initialized, otherwise a ::radef_kAlreadyInitialized fatal error is thrown.
  *
@@ -168,11 +202,34 @@ bool srcor_IsConfigurationValid(const srcty_SafetyRetransmissionConfiguration *c
  */
 void srcor_Init(const srcty_SafetyRetransmissionConfiguration *const sr_layer_configuration);
 
+/**
+ * @brief Select the SafRetL core instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the SafRetL core functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_SR_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void srcor_SelectInstance(const uint32_t instance_index);
+
+/**
+ * @brief Get the size of the connection memory used by the core module.
+ *
+ * This function returns the size of the connection memory, which is allocated by ::srcor_Init for the configured connections. This includes the timers of the
+ * connections and the connection memory allocated by the diagnostics, send buffer and receive buffer modules. It can be used before the initialization of the
+ * module.
+ *
+ * @param [in] configured_connections Number of configured RaSTA connections. Valid range: 1 <= value <= ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
+ * @return Size of the used connection memory [bytes].
+ */
+uint32_t srcor_GetConnectionMemorySize(const uint32_t configured_connections);
+
 /**
  * @brief Get the connection identification associated with the specified sender and receiver identification.
  *
- * This function searches in the saved configuration for a matching connection id to the passed pair of sender and receiver id. If a matching entry is found,
- * the connection id is returned via the out parameter. Otherwise a ::radef_kInvalidParameter is returned.
+ * This function searches in the connection index of the saved configuration for a matching connection id to the passed pair of sender and receiver id. The
+ * connection index is a hash table, so that the search time does not depend on the number of configured connections. If a matching entry is found, the
+ * connection id is returned via the out parameter. Otherwise a ::radef_kInvalidParameter is returned.
  *
  * @pre The core module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
@@ -191,7 +248,7 @@ radef_RaStaReturnCode srcor_GetConnectionId(const uint32_t sender_id, const uint
  *
  * This function is used to initialize the core data of a specific connection. This means it initializes SN_T with a random number. In case of client, CS_T is
  * set to 0 and CTS_R is set to the current time. Additionally, the corresponding diagnostic module, send and receive buffer are initalized for this connection
- * and the redundancy channel opened.
+ * and the redundancy channel opened. In case of client, the message timeout timer is started. The heartbeat timer is started with the first sent message.
  *
  * @pre The core module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
@@ -204,8 +261,8 @@ void srcor_InitRaStaConnData(const uint32_t connection_id);
 /**
  * @brief Close the redundancy channel of a rasta connection and send a diagnostic notification
  *
- * This function closes the matching redundancy channel to the passed connection (1:1 mapping between the connection id and redundancy channel id). Finally a
- * diagnostic notification is send to the application layer.
+ * This function closes the matching redundancy channel to the passed connection (1:1 mapping between the connection id and redundancy channel id). Then a
+ * diagnostic notification is send to the application layer. Finally the message timeout and heartbeat timers of the connection are stopped.
  *
  * @pre The core module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
@@ -218,8 +275,9 @@ void srcor_CloseRedundancyChannel(const uint32_t connection_id);
 /**
  * @brief Read and analyze a received SafRetL message.
  *
- * This function receives and checks a message of a dedicated connection. First, a message is read from the SafRetL adapter interface (::sradin_ReadMessage).
- * If ::radef_kNoMessageReceived is returned, the received_data_pending flag is reset and the function finishes. Otherwise a set of checks is now started to
+ * This function receives and checks a message of a dedicated connection. First, a message is read from the SafRetL adapter interface (::sradin_ReadMessage),
+ * unless it was already read ahead by ::srcor_IsReceivedMsgPendingAndBuffersNotFull. If ::radef_kNoMessageReceived is returned, the received_data_pending flag
+ * is reset and the function finishes. Otherwise a set of checks is now started to
  * validate the received message:
  * - general checks are done (::GeneralMessageCheck), stop if check fails
  *   - MD4
@@ -271,7 +329,7 @@ void srcor_ReceiveMessage(const uint32_t connection_id, srtyp_ConnectionEvents *
  * - apply received flow control for timeout related messages (::ReceivedFlowControlCheck)
  * - finally for time-out relevant messages (::IsMessageTimeoutRelated), update connection diagnostics (::srdia_UpdateConnectionDiagnostics)
  * .
- * In all cases, the message in input buffer flag is cleared.
+ * In all cases, the message timeout timer is restarted with the current CTS_R and T_i and the message in input buffer flag is cleared.
  *
  * @pre The core module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
@@ -389,6 +447,9 @@ void srcor_ClearInputBufferMessagePendingFlag(const uint32_t connection_id);
  *
  * This function prepares a new message header that is used to create a new data message with the message saved in the temporary buffer. This message is then
  * added to the send buffer and send with ::srcor_SendPendingMessages. Finally, the flag for a message in the temporary buffer is reset.
+ * If more than one message may be packed into a data message (configured n_max_packet > 1), the message is first packed into the last data message of the
+ * send buffer with ::srsend_AddPayloadToLastMessage. This is possible as long as this data message is not yet sent, e.g. because the flow control is waiting
+ * for a confirmation. Only if the message can't be packed, a new data message is created.
  *
  * @pre The core module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  * @pre A message must be in the temporary send buffer, otherwise a ::radef_kNoMessageToSend fatal error is thrown.
@@ -569,6 +630,33 @@ bool srcor_IsMessageTimeout(const uint32_t connection_id);
  */
 bool srcor_IsHeartbeatInterval(const uint32_t connection_id);
 
+/**
+ * @brief Get a connection with an expired timer.
+ *
+ * This function returns a connection, whose message timeout or heartbeat timer expired since the last call. The message timeout timer expires when
+ * ::srcor_IsMessageTimeout becomes true and the heartbeat timer expires when ::srcor_IsHeartbeatInterval becomes true. Every expiry is returned only once, a
+ * timer is started again when the corresponding time stamps change. A connection is returned twice, if both timers expired.
+ *
+ * @pre The core module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [out] connection_id Pointer to the RaSTA connection identification. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return true, if a connection with an expired timer is returned.
+ * @return false, if no timer expired.
+ */
+bool srcor_GetExpiredTimerConnection(uint32_t *const connection_id);
+
+/**
+ * @brief Get the time until the next message timeout or heartbeat timer of all connections expires.
+ *
+ * @pre The core module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [out] time_to_next_deadline Pointer to the time until the next timer expires [ms]. 0 if a timer already expired. If the pointer is NULL, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ * @return true, if a timer is running or expired.
+ * @return false, if no timer is running.
+ */
+bool srcor_GetTimeToNextDeadline(uint32_t *const time_to_next_deadline);
+
 /**
  * @brief Check if received messages are pending and send & received buffer are not full.
  *
@@ -576,9 +664,12 @@ bool srcor_IsHeartbeatInterval(const uint32_t connection_id);
  * - received messages pending
  * - at least three free entires in send buffer (in worst case of a retransmission of a retransmission, this adds a RetrResp, HB & RetrReq to the send
  * buffer to the already existing data)
- * - at least one free entry in received buffer
+ * - at least one free entry in received buffer for every message which can be packed into the next received message
  * .
- * Returns true if all 3 conditions are true.
+ * Returns true if all 3 conditions are true. To know the size of the next received message, it is read ahead from the SafRetL adapter interface
+ * (::sradin_ReadMessage) and kept in the input buffer for ::srcor_ReceiveMessage. If no message is received, the received_data_pending flag is reset. The
+ * number of messages packed into the next received message is limited by its message size and the configured n_max_packet, so that a short message does not
+ * wait for n_max_packet free entries.
  *
  * @implementsReq{RASW-830} Is Received Message Pending And Buffers Not Full Function
  *
@@ -592,15 +683,19 @@ bool srcor_IsReceivedMsgPendingAndBuffersNotFull(const uint32_t connection_id);
  * @brief Send pending messages from the send buffer, if the flow control allows to send.
  *
  * This function sends available messages from the send buffer, while there are messages in the send buffer and if the flow control allows to send messages
- * (::SendPendingMessagesWithFlowControlAllowed). While this is true, following steps are performed:
+ * (::SendPendingMessagesWithFlowControlAllowed). The messages are processed in batches of up to ::SRCOR_SEND_BATCH_SIZE messages. While the flow control
+ * allows to send, following steps are performed for every message of a batch:
  * - a message is read from the send buffer
- * - last send timestamp (time_stamp_tx) is updated with the current time
+ * - last send timestamp (time_stamp_tx) is updated with the current time and the heartbeat timer is restarted
  * - a ::srtyp_SrMessageHeaderUpdate structure is prepared
  *   - set srcor_RaStaConnectionData::time_stamp_tx as timestamp (TS_PDU)
  *   - in case of a ConnReq message, srcor_RaStaConnectionData::confirmed_sequence_number_tx (CS_T) must be set to 0
  *   - set srcor_RaStaConnectionData::confirmed_sequence_number_tx (CS_T) as confirmed sequence number (CS_PDU)
  *   - srcor_RaStaConnectionData::last_send_confirmed_sequence_number_tx is updated with confirmed sequence number (CS_PDU)
- * - The message is then updated with this ::srtyp_SrMessageHeaderUpdate structure and finally send with ::sradin_SendMessage.
+ *
+ * All messages of the batch are then updated with their ::srtyp_SrMessageHeaderUpdate structures at once with ::srmsg_UpdateMessageHeaderBatch, which
+ * calculates the safety codes together, and finally send in order with ::sradin_SendMessage. Since the flow control only depends on the send buffer, the
+ * messages and header updates of a batch are the same as if every message was updated and sent on its own.
  *
  * @pre The core module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
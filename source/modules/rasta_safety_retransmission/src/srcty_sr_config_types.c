@@ -61,7 +61,9 @@ const uint16_t srcty_kMinMWA = 1U;
 
 const uint16_t srcty_kMaxMWA = 19U;
 
-const uint32_t srcty_kNMaxPacket = 1U;
+const uint32_t srcty_kMinNMaxPacket = 1U;
+
+const uint32_t srcty_kMaxNMaxPacket = 16U;
 
 const uint32_t srcty_kMinNDiagWindow = 100U;
 
@@ -81,6 +83,12 @@ const uint32_t srcty_kMinFreeEntriesSendBufferForRetr = 3U;
 
 const uint32_t srcty_kMinFreeEntriesReceivedBufferForReceive = 1U;
 
+const raslb_SlabConfiguration srcty_kSlabConfiguration = {
+    RADEF_SLAB_MAX_NUMBER_OF_SIZE_CLASSES,
+    {{RADEF_SLAB_SMALL_CHUNK_SIZE, RADEF_SLAB_NUMBER_OF_SMALL_CHUNKS},
+     {RADEF_SLAB_MEDIUM_CHUNK_SIZE, RADEF_SLAB_NUMBER_OF_MEDIUM_CHUNKS},
+     {RADEF_SLAB_LARGE_CHUNK_SIZE, RADEF_SLAB_NUMBER_OF_LARGE_CHUNKS}}};
+
 // -----------------------------------------------------------------------------
 // Global Function Implementations
 // -----------------------------------------------------------------------------
@@ -39,6 +39,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "rasta_common/radef_rasta_definitions.h"
 #include "rasta_safety_retransmission/sraty_sr_api_types.h"
 
 // -----------------------------------------------------------------------------
@@ -59,6 +60,21 @@ typedef struct {
 } srdia_SrConnectionDiagnostics;
 //lint -restore
 
+/**
+ * @brief Struct for the data of a SafRetL diagnostics instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;  ///< Initialization state of the module. true, if the module is initialized.
+  uint32_t number_of_connections;  ///< Number of configured RaSTA connections.
+  uint32_t t_max;  ///< Maximal accepted age of a message [ms].
+  uint32_t n_diag_window;  ///< Configured diagnosis window size [messages].
+  uint32_t diag_timing_distr_intervals[RADEF_DIAGNOSTIC_TIMING_DISTRIBUTION_ARRAY_SIZE];  ///< Diagnostic timing distribution intervals [ms].
+  srdia_SrConnectionDiagnostics *connection_diagnostics;  ///< Diagnostic data for all configured RaSTA connections, allocated from the connection memory.
+  uint16_t logger_id;  ///< ID of the sr_diagnostics debug logger.
+} srdia_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -90,7 +106,8 @@ bool srdia_AreDiagnosticTimingIntervalsValid(const uint32_t t_max, const uint32_
  * @brief Initialize SafRetL diagnostics module.
  *
  * This function is used to initialize the diagnostic data of all connections. It saves the passed maximal age of a message (t_max), diagnostic window size
- * (n_diag_window) and the diagnostic timing distribution intervals. Additionally, ::srdia_InitConnectionDiagnostics is called for all configured connections.
+ * (n_diag_window) and the diagnostic timing distribution intervals and allocates the diagnostic data of the configured connections from the connection memory.
+ * Additionally, ::srdia_InitConnectionDiagnostics is called for all configured connections.
  *
  * @pre The diagnostics module must not be initialized, otherwise a ::radef_kAlreadyInitialized fatal error is thrown.
  *
@@ -103,6 +120,27 @@ bool srdia_AreDiagnosticTimingIntervalsValid(const uint32_t t_max, const uint32_
  */
 void srdia_Init(const uint32_t configured_connections, const uint32_t t_max, const uint32_t n_diag_window, const uint32_t* const diag_timing_distr_intervals);
 
+/**
+ * @brief Select the SafRetL diagnostics instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the SafRetL diagnostics functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_SR_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void srdia_SelectInstance(const uint32_t instance_index);
+
+/**
+ * @brief Get the size of the connection memory used by the diagnostics module.
+ *
+ * This function returns the size of the connection memory, which is allocated by ::srdia_Init for the diagnostic data of the configured connections. It can be
+ * used before the initialization of the module.
+ *
+ * @param [in] configured_connections Number of configured RaSTA connections. Valid range: 1 <= value <= ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
+ * @return Size of the used connection memory [bytes].
+ */
+uint32_t srdia_GetConnectionMemorySize(const uint32_t configured_connections);
+
 /**
  * @brief Initialize the diagnostic data of a dedicated RaSTA connection.
  *
@@ -0,0 +1,128 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srins_sr_instances.c
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Implementation of RaSTA SafRetL instances module.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "srins_sr_instances.h"  // NOLINT(build/include_subdir)
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rasta_common/raas_rasta_assert.h"
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/raslb_rasta_slab.h"
+#include "rasta_safety_retransmission/sraty_sr_api_types.h"
+#include "srcor_sr_core.h"               // NOLINT(build/include_subdir)
+#include "srdia_sr_diagnostics.h"        // NOLINT(build/include_subdir)
+#include "srmem_sr_connection_memory.h"  // NOLINT(build/include_subdir)
+#include "srmsg_sr_messages.h"           // NOLINT(build/include_subdir)
+#include "srrece_sr_received_buffer.h"   // NOLINT(build/include_subdir)
+#include "srsend_sr_send_buffer.h"       // NOLINT(build/include_subdir)
+#include "srstm_sr_state_machine.h"      // NOLINT(build/include_subdir)
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+#if RADEF_MAX_NUMBER_OF_SR_INSTANCES < 1U
+#error "RADEF_MAX_NUMBER_OF_SR_INSTANCES must be at least 1"
+#endif
+
+// Without RADEF_MULTI_THREADED, the instance selection is shared by all threads of the process, so that only a single instance is safe to use
+#if (RADEF_MAX_NUMBER_OF_SR_INSTANCES != 1U) && !defined(RADEF_MULTI_THREADED)
+#error "More than one SafRetL instance needs the stack to be built with RADEF_MULTI_THREADED"
+#endif
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Data of all SafRetL instances.
+ */
+PRIVATE srapi_Instance srins_instances[RADEF_MAX_NUMBER_OF_SR_INSTANCES];
+
+/**
+ * @brief Number of created instances.
+ */
+PRIVATE uint32_t srins_number_of_instances = 0U;
+
+/**
+ * @brief Pointer to the selected instance. NULL, if no instance is selected yet.
+ */
+PRIVATE RADEF_THREAD_LOCAL srapi_Instance *srins_selected_instance = NULL;
+
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+
+bool srins_IsInstanceAvailable(void) {
+  return srins_number_of_instances < RADEF_MAX_NUMBER_OF_SR_INSTANCES;
+}
+
+srapi_Instance *srins_CreateInstance(void) {
+  raas_AssertTrue(srins_IsInstanceAvailable(), radef_kInternalError);
+
+  srapi_Instance *const instance = &srins_instances[srins_number_of_instances];
+  instance->instance_index = srins_number_of_instances;
+  ++srins_number_of_instances;
+
+  return instance;
+}
+
+void srins_SelectInstance(srapi_Instance *const instance) {
+  // Input parameter check
+  raas_AssertNotNull(instance, radef_kInvalidParameter);
+
+  if (instance != srins_selected_instance) {
+    const uint32_t kInstanceIndex = instance->instance_index;
+
+    raslb_SelectInstance(kInstanceIndex);
+    srmem_SelectInstance(kInstanceIndex);
+    srmsg_SelectInstance(kInstanceIndex);
+    srdia_SelectInstance(kInstanceIndex);
+    srsend_SelectInstance(kInstanceIndex);
+    srrece_SelectInstance(kInstanceIndex);
+    srcor_SelectInstance(kInstanceIndex);
+    srstm_SelectInstance(kInstanceIndex);
+
+    srins_selected_instance = instance;
+  }
+}
+
+srapi_Instance *srins_GetSelectedInstance(void) {
+  return srins_selected_instance;
+}
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
@@ -0,0 +1,112 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srins_sr_instances.h
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @addtogroup sr_instances
+ * @{
+ *
+ * @brief Interface of RaSTA SafRetL instances module.
+ *
+ * This module manages the ::RADEF_MAX_NUMBER_OF_SR_INSTANCES SafRetL instances of the process. Every SafRetL module keeps its data separately for every
+ * instance and works on the data of the selected instance. The API and the adapter notification functions select the instance passed by the caller, before
+ * they call any other SafRetL module.
+ *
+ * By default, the selection applies to the whole process, so that the stack supports only one instance. Several instances need the stack to be built with
+ * ::RADEF_MULTI_THREADED, where every thread has its own selection. Different instances can then be serviced by different threads at the same time, as long
+ * as every instance is serviced by only one thread at a time. All instances must be created before the threads are started.
+ */
+#ifndef SRINS_SAFETY_RETRANSMISSION_INSTANCES_H_
+#define SRINS_SAFETY_RETRANSMISSION_INSTANCES_H_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rasta_safety_retransmission/sraty_sr_api_types.h"
+#include "rasta_safety_retransmission/srcty_sr_config_types.h"
+#include "srtyp_sr_types.h"  // NOLINT(build/include_subdir)
+
+// -----------------------------------------------------------------------------
+// Global Macro Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Type Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Struct for the data of a SafRetL instance, which is referenced by the ::srapi_Instance handle.
+ */
+//lint -save -e9045 (structures are defined globally)
+struct srapi_Instance {
+  uint32_t instance_index;                                          ///< Index of the instance data in the SafRetL modules
+  bool initialized;                                                 ///< Initialization state of the instance. true, if the instance is initialized.
+  const srcty_SafetyRetransmissionConfiguration *sr_configuration;  ///< Pointer to SafRetL configuration.
+  srtyp_SrMessagePayload scratch_message_payload;                   ///< Memory to transfer messages
+};
+//lint -restore
+
+// -----------------------------------------------------------------------------
+// Global Const Declarations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Prototypes
+// -----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Check if an instance is available.
+ *
+ * @return true -> an instance is available and can be created with ::srins_CreateInstance
+ * @return false -> all ::RADEF_MAX_NUMBER_OF_SR_INSTANCES instances are already created
+ */
+bool srins_IsInstanceAvailable(void);
+
+/**
+ * @brief Create an instance.
+ *
+ * This function takes the next available instance. The instance is not initialized and none of its data is set, except for the instance index.
+ *
+ * @pre An instance must be available (see ::srins_IsInstanceAvailable), otherwise a ::radef_kInternalError fatal error is thrown.
+ *
+ * @return Pointer to the created instance.
+ */
+srapi_Instance *srins_CreateInstance(void);
+
+/**
+ * @brief Select an instance.
+ *
+ * This function selects the instance in all SafRetL modules, so that all following calls of the SafRetL modules work on the data of this instance.
+ *
+ * @param [in] instance Pointer to an instance created with ::srins_CreateInstance. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ */
+void srins_SelectInstance(srapi_Instance *const instance);
+
+/**
+ * @brief Get the selected instance.
+ *
+ * This function returns the instance selected with ::srins_SelectInstance. The modules pass this instance to the adapter interface and the notification
+ * functions.
+ *
+ * @return Pointer to the selected instance. NULL, if no instance is selected yet.
+ */
+srapi_Instance *srins_GetSelectedInstance(void);
+
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+#endif  // SRINS_SAFETY_RETRANSMISSION_INSTANCES_H_
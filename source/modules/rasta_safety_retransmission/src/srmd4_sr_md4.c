@@ -19,9 +19,11 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/raend_rasta_endian.h"
 #include "rasta_common/ralog_rasta_logger.h"
 #include "rasta_common/rasys_rasta_system_adapter.h"
 #include "rasta_safety_retransmission/srcty_sr_config_types.h"
@@ -32,19 +34,60 @@
 
 #define MD4_INPUT_DATA_BLOCK_SIZE (64U)  ///< Size of a input data block used for the MD4 calculation [bytes]
 #define BYTES_PER_U32 (4U)               ///< Bytes per uint32_t [bytes]
+#define MD4_BATCH_LANES (4U)             ///< Number of data buffers processed in parallel lanes by ::srmd4_CalculateMd4Batch
+#define MD4_BLOCK_WORDS (16U)            ///< Number of Uint32 words of a input data block used for the MD4 calculation [words]
 
-// -----------------------------------------------------------------------------
-// Local Type Definitions
-// -----------------------------------------------------------------------------
+#if (!defined(SRMD4_DISABLE_HARDWARE_MD4) && defined(__SSE2__) && (RAEND_HOST_BIG_ENDIAN == 0))
+/**
+ * @brief Hardware MD4 lanes available: SSE2 instructions, which are enabled for the target of the build.
+ *
+ * The ::MD4_BATCH_LANES lanes fill one 128 bit register. Wider AVX2 registers are not used, since the batches of pending messages are small and eight lanes
+ * would mostly calculate unused lanes. The data block words are loaded directly in the little endian byte order of the host.
+ */
+#define HARDWARE_MD4_SSE2 1
+#else
+#define HARDWARE_MD4_SSE2 0  ///< Hardware MD4 lanes not available: SSE2 instructions
+#endif
+
+#if HARDWARE_MD4_SSE2 != 0
+#include <emmintrin.h>
+
+/**
+ * @brief Rotates the Uint32 words of all lanes left by s bits. s must be a constant, so that the shifts are encoded as immediate values.
+ */
+#define HARDWARE_ROTATE_LEFT(value, s) \
+  _mm_or_si128(_mm_slli_epi32((value), (s)), _mm_srli_epi32((value), 32 - (s)))  //lint !e9026 (function like macro for immediate shift counts)
+
+/**
+ * @brief The MD4 transformation of round 1 for all lanes: a = (a + F(b, c, d) + x) <<< s with F = d ^ (b & (c ^ d)).
+ */
+#define HARDWARE_STEP_F(a, b, c, d, x, s) \
+  (a) = HARDWARE_ROTATE_LEFT(_mm_add_epi32(_mm_add_epi32((a), _mm_xor_si128((d), _mm_and_si128((b), _mm_xor_si128((c), (d))))), (x)), (s))  //lint !e9026
+
+/**
+ * @brief The MD4 transformation of round 2 for all lanes: a = (a + G(b, c, d) + x + ac) <<< s with G = (b & (c | d)) | (c & d) and ac = ::kAc1.
+ */
+#define HARDWARE_STEP_G(a, b, c, d, x, s, ac)                                                                                       \
+  (a) = HARDWARE_ROTATE_LEFT(                                                                                                       \
+      _mm_add_epi32(_mm_add_epi32((a), _mm_or_si128(_mm_and_si128((b), _mm_or_si128((c), (d))), _mm_and_si128((c), (d)))), \
+                    _mm_add_epi32((x), (ac))),                                                                                      \
+      (s))  //lint !e9026
+
+/**
+ * @brief The MD4 transformation of round 3 for all lanes: a = (a + H(b, c, d) + x + ac) <<< s with H = b ^ c ^ d and ac = ::kAc2.
+ */
+#define HARDWARE_STEP_H(a, b, c, d, x, s, ac) \
+  (a) = HARDWARE_ROTATE_LEFT(_mm_add_epi32(_mm_add_epi32((a), _mm_xor_si128(_mm_xor_si128((b), (c)), (d))), _mm_add_epi32((x), (ac))), (s))  //lint !e9026
 
 /**
- * @brief Enum for the selection of the basic MD4 functions.
+ * @brief Selects the Uint32 words of the lanes, whose mask is all ones, from selected and the words of the other lanes from other.
  */
-typedef enum {
-  kMd4FunctionF = 0U,  ///< Basic MD4 function F
-  kMd4FunctionG = 1U,  ///< Basic MD4 function G
-  kMd4FunctionH = 2U   ///< Basic MD4 function H
-} Md4Function;
+#define HARDWARE_SELECT_LANES(mask, selected, other) _mm_or_si128(_mm_and_si128((mask), (selected)), _mm_andnot_si128((mask), (other)))  //lint !e9026
+#endif
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
 
 /**
  * @brief Structure holding the context data for a MD4 calculation.
@@ -57,17 +100,43 @@ typedef struct {
   uint32_t c;                                 ///< C part fo the calculated hash.
   uint32_t d;                                 ///< D part of the calculated hash.
   uint8_t buffer[MD4_INPUT_DATA_BLOCK_SIZE];  ///< Internal buffer for remaining data size < 64 bytes.
-  uint32_t block[MD4_INPUT_DATA_BLOCK_SIZE / BYTES_PER_U32];  ///< Internal 32 bit aligned data block.
 } Md4Context;
 
-// -----------------------------------------------------------------------------
-// Local Variable Definitions
-// -----------------------------------------------------------------------------
+#if HARDWARE_MD4_SSE2 != 0
+/**
+ * @brief Structure holding the input data of one lane of a batched MD4 calculation.
+ */
+typedef struct {
+  const uint8_t *data;                              ///< Pointer to the data blocks which are read directly from the data buffer. NULL for unused lanes.
+  uint32_t number_of_data_blocks;                   ///< Number of complete 64 byte data blocks read directly from the data buffer [blocks].
+  uint32_t number_of_blocks;                        ///< Total number of data blocks including the padding blocks [blocks]. 0 for unused lanes.
+  uint8_t padding[MD4_INPUT_DATA_BLOCK_SIZE * 2U];  ///< Remaining data bytes < 64 bytes, padding and bit counter (one or two data blocks).
+} Md4BatchLane;
 
 /**
- * @brief Context of MD4 calculation.
+ * @brief Structure holding the MD4 state of all lanes of a batched MD4 calculation.
  */
-PRIVATE Md4Context srmd4_context;
+typedef struct {
+  uint32_t a[MD4_BATCH_LANES];  ///< A part of the calculated hash of every lane.
+  uint32_t b[MD4_BATCH_LANES];  ///< B part of the calculated hash of every lane.
+  uint32_t c[MD4_BATCH_LANES];  ///< C part of the calculated hash of every lane.
+  uint32_t d[MD4_BATCH_LANES];  ///< D part of the calculated hash of every lane.
+} Md4BatchState;
+
+/**
+ * @brief Structure holding the MD4 state of all lanes of a batched MD4 calculation in the SSE2 registers.
+ */
+typedef struct {
+  __m128i a;  ///< A part of the calculated hash of every lane.
+  __m128i b;  ///< B part of the calculated hash of every lane.
+  __m128i c;  ///< C part of the calculated hash of every lane.
+  __m128i d;  ///< D part of the calculated hash of every lane.
+} Md4BatchStateHardware;
+#endif
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
 
 // -----------------------------------------------------------------------------
 // Local Function Prototypes
@@ -196,43 +265,140 @@ static uint32_t FunctionG(const uint32_t x, const uint32_t y, const uint32_t z);
 static uint32_t FunctionH(const uint32_t x, const uint32_t y, const uint32_t z);
 
 /**
- * @brief The MD4 transformation function for all three rounds.
+ * @brief The MD4 transformation of round 1, which returns (a + F(b, c, d) + x) <<< s.
  *
  * @implementsReq{RASW-633} Calculate MD4 Function
  *
- * @param [in] md4_function Basic MD4 function used for this step. The values ::kMd4FunctionF, ::kMd4FunctionG, ::kMd4FunctionH are valid and usable. For other
- * values a ::radef_kInternalError fatal error is thrown.
- * @param [inout] a Input/output parameter a. The full value range is valid and usable.
+ * @param [in] a Input parameter a. The full value range is valid and usable.
  * @param [in] b Input parameter b. The full value range is valid and usable.
  * @param [in] c Input parameter c. The full value range is valid and usable.
  * @param [in] d Input parameter d. The full value range is valid and usable.
  * @param [in] x Input parameter x. The full value range is valid and usable.
- * @param [in] s Input parameter s. The full value range is valid and usable.
+ * @param [in] s Input parameter s. Valid range: 1 <= value <= 31.
+ * @return uint32_t The new value of a.
  */
-static void Step(const Md4Function md4_function, uint32_t *const a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t x, const uint32_t s);
+static uint32_t StepF(const uint32_t a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t x, const uint32_t s);
 
 /**
- * @brief Reads 4 input data bytes and stores them in a properly aligned Uint32 value in a MD4 context data block and returns this Uint32 value.
+ * @brief The MD4 transformation of round 2, which returns (a + G(b, c, d) + x + ::kAc1) <<< s.
  *
  * @implementsReq{RASW-633} Calculate MD4 Function
  *
- * @param [in] index_32_bit Index in the MD4 context data block [bytes]. The full value range is valid and usable.
- * @param [in] data Pointer to start of current input data block. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
- * @param [inout] ctx Pointer to the MD4 context data structure. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
- * @return uint32_t Set Uint32 value at given index.
+ * @param [in] a Input parameter a. The full value range is valid and usable.
+ * @param [in] b Input parameter b. The full value range is valid and usable.
+ * @param [in] c Input parameter c. The full value range is valid and usable.
+ * @param [in] d Input parameter d. The full value range is valid and usable.
+ * @param [in] x Input parameter x. The full value range is valid and usable.
+ * @param [in] s Input parameter s. Valid range: 1 <= value <= 31.
+ * @return uint32_t The new value of a.
+ */
+static uint32_t StepG(const uint32_t a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t x, const uint32_t s);
+
+/**
+ * @brief The MD4 transformation of round 3, which returns (a + H(b, c, d) + x + ::kAc2) <<< s.
+ *
+ * @implementsReq{RASW-633} Calculate MD4 Function
+ *
+ * @param [in] a Input parameter a. The full value range is valid and usable.
+ * @param [in] b Input parameter b. The full value range is valid and usable.
+ * @param [in] c Input parameter c. The full value range is valid and usable.
+ * @param [in] d Input parameter d. The full value range is valid and usable.
+ * @param [in] x Input parameter x. The full value range is valid and usable.
+ * @param [in] s Input parameter s. Valid range: 1 <= value <= 31.
+ * @return uint32_t The new value of a.
+ */
+static uint32_t StepH(const uint32_t a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t x, const uint32_t s);
+
+#if HARDWARE_MD4_SSE2 != 0
+/**
+ * @brief Prepares a lane of a batched MD4 calculation for a data buffer.
+ *
+ * The complete 64 byte data blocks are read directly from the data buffer. The remaining data bytes, the padding and the bit counter are written to the
+ * padding blocks of the lane.
+ *
+ * @implementsReq{RASW-633} Calculate MD4 Function
+ *
+ * @param [in] data_size Size of data buffer [bytes]. Valid range: ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE <= value <= (::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE -
+ * ::RADEF_MAX_SR_LAYER_SAFETY_CODE_SIZE).
+ * @param [in] data_buffer Pointer to data buffer. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [out] lane Pointer to the lane to prepare. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ */
+static void PrepareBatchLane(const uint16_t data_size, const uint8_t *const data_buffer, Md4BatchLane *const lane);
+
+/**
+ * @brief Returns a pointer to a 64 byte data block of a lane of a batched MD4 calculation.
+ *
+ * @implementsReq{RASW-633} Calculate MD4 Function
+ *
+ * @param [in] lane Pointer to the lane. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [in] block_index Index of the data block [blocks]. The full value range is valid and usable.
+ * @return const uint8_t* Pointer to the requested data block. ::kZeroDataBlock, if the block index is beyond the last data block of the lane.
+ */
+static const uint8_t *GetBatchLaneBlock(const Md4BatchLane *const lane, const uint32_t block_index);
+
+/**
+ * @brief Inner function for a batched MD4 calculation. Processes the data blocks of all lanes in parallel.
+ *
+ * Lanes with fewer data blocks keep their state unchanged once their last data block is processed. The data blocks are loaded with ::LoadBatchBlockHardware
+ * and the MD4 rounds are calculated with ::Md4RoundsBatchHardware, the state stays in the SSE2 registers for all data blocks.
+ *
+ * @implementsReq{RASW-633} Calculate MD4 Function
+ * @implementsReq{RASW-634} Safety Code
+ *
+ * @param [in] lanes Pointer to an array of ::MD4_BATCH_LANES lanes. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [inout] state Pointer to the MD4 state of all lanes. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ */
+static void Md4BodyBatch(const Md4BatchLane *const lanes, Md4BatchState *const state);
+
+/**
+ * @brief Loads the current data block of all lanes of a batched MD4 calculation into the SSE2 registers.
+ *
+ * Four consecutive Uint32 words of every lane are loaded at once and transposed with the SSE2 unpack instructions, so that every register holds the same
+ * word of all lanes.
+ *
+ * @implementsReq{RASW-633} Calculate MD4 Function
+ *
+ * @param [in] lane_blocks Pointers to the 64 byte data block of every lane. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [out] x Uint32 words of the data block of all lanes. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ */
+static void LoadBatchBlockHardware(const uint8_t *const lane_blocks[MD4_BATCH_LANES], __m128i x[MD4_BLOCK_WORDS]);
+
+/**
+ * @brief Calculates the three MD4 rounds of a data block for all lanes of a batched MD4 calculation with the SSE2 instructions of the CPU.
+ *
+ * The ::MD4_BATCH_LANES lanes are held in one 128 bit register per MD4 state word, so that every MD4 step is calculated for all lanes at once. Only the
+ * rounds are calculated, the addition of the previous state is done by the caller.
+ *
+ * @implementsReq{RASW-633} Calculate MD4 Function
+ *
+ * @param [in] x Uint32 words of the data block of all lanes. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [inout] state Pointer to the MD4 state of all lanes. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ */
+static void Md4RoundsBatchHardware(const __m128i x[MD4_BLOCK_WORDS], Md4BatchStateHardware *const state);
+#endif
+
+#if RAEND_HOST_BIG_ENDIAN
+/**
+ * @brief Helper to read a little-endian Uint32 value from a byte array.
+ *
+ * @implementsReq{RASW-633} Calculate MD4 Function
+ *
+ * @param [in] source Pointer to source byte array. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return uint32_t The read Uint32 value.
  */
-static uint32_t Set(const uint8_t index_32_bit, const uint8_t *const data, Md4Context *const ctx);
+static uint32_t ReadU32FromByteArray(const uint8_t *const source);
+#endif
 
 /**
- * @brief Get a properly aligned Uint32 value from a MD4 context data block.
+ * @brief Rotates a Uint32 value to the left.
  *
  * @implementsReq{RASW-633} Calculate MD4 Function
  *
- * @param [in] index_32_bit Index in the MD4 context data block [bytes]. The full value range is valid and usable.
- * @param [in] ctx Pointer to the MD4 context data structure.  If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
- * @return unit32_t Requested Uint32 value at given index.
+ * @param [in] value Value to rotate. The full value range is valid and usable.
+ * @param [in] s Number of bits to rotate. Valid range: 1 <= value <= 31.
+ * @return uint32_t The rotated value.
  */
-static uint32_t Get(const uint8_t index_32_bit, const Md4Context *const ctx);
+static uint32_t RotateLeft(const uint32_t value, const uint32_t s);
 
 /** @}*/
 
@@ -244,8 +410,11 @@ static const uint32_t kDataBlockSizeBits = 6U;        ///< Number of bits for th
 static const uint32_t kDataBlockSizeBitMask = 0x3FU;  ///< Bits used for masking the size of a data block used for the MD4 calculation
 static const uint32_t kDataBitCountLowIndex = 56U;    ///< Data block index of lower data bit counter [bytes]
 static const uint32_t kDataBitCountHighIndex = 60U;   ///< Data block index of upper data bit counter [bytes]
-static const uint32_t kAc1 = 0x5A827999U;             ///< Constant for ::FunctionG calculation
-static const uint32_t kAc2 = 0x6ED9EBA1U;             ///< Constant for ::FunctionH calculation
+static const uint32_t kAc1 = 0x5A827999U;             ///< Constant for ::StepG calculation
+static const uint32_t kAc2 = 0x6ED9EBA1U;             ///< Constant for ::StepH calculation
+#if HARDWARE_MD4_SSE2 != 0
+static const uint8_t kZeroDataBlock[MD4_INPUT_DATA_BLOCK_SIZE] = {0U};  ///< Data block processed by the completed lanes of a batched MD4 calculation
+#endif
 
 // -----------------------------------------------------------------------------
 // Global Constant Definitions
@@ -262,16 +431,77 @@ void srmd4_CalculateMd4(const srcty_Md4InitValue md4_initial_value, const uint16
   raas_AssertU16InRange(data_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE - RADEF_MAX_SR_LAYER_SAFETY_CODE_SIZE,
                         radef_kInvalidParameter);
 
-  ClearMd4ContextData(&srmd4_context);
+  // The context is a local variable to keep the MD4 calculation re-entrant
+  Md4Context md4_context;
 
-  srmd4_context.a = md4_initial_value.init_a;
-  srmd4_context.b = md4_initial_value.init_b;
-  srmd4_context.c = md4_initial_value.init_c;
-  srmd4_context.d = md4_initial_value.init_d;
+  ClearMd4ContextData(&md4_context);
+
+  md4_context.a = md4_initial_value.init_a;
+  md4_context.b = md4_initial_value.init_b;
+  md4_context.c = md4_initial_value.init_c;
+  md4_context.d = md4_initial_value.init_d;
+
+  Md4Update(&md4_context, data_buffer, data_size);
+
+  Md4Final(&md4_context, calculated_md4->md4);
+}
 
-  Md4Update(&srmd4_context, data_buffer, data_size);
+void srmd4_CalculateMd4Batch(const srcty_Md4InitValue md4_initial_value, const uint16_t number_of_entries, const srmd4_Md4BatchEntry *const entries) {
+  // Input parameter check
+  raas_AssertNotNull(entries, radef_kInvalidParameter);
+  raas_AssertTrue(number_of_entries > 0U, radef_kInvalidParameter);
+
+  for (uint32_t entry_index = 0U; entry_index < number_of_entries; ++entry_index) {
+    raas_AssertNotNull(entries[entry_index].data_buffer, radef_kInvalidParameter);
+    raas_AssertNotNull(entries[entry_index].calculated_md4, radef_kInvalidParameter);
+    raas_AssertU16InRange(entries[entry_index].data_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE,
+                          RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE - RADEF_MAX_SR_LAYER_SAFETY_CODE_SIZE, radef_kInvalidParameter);
+  }
 
-  Md4Final(&srmd4_context, calculated_md4->md4);
+#if HARDWARE_MD4_SSE2 != 0
+  Md4BatchLane lanes[MD4_BATCH_LANES];
+  Md4BatchState state;
+
+  for (uint32_t first_entry_index = 0U; first_entry_index < number_of_entries; first_entry_index += MD4_BATCH_LANES) {
+    for (uint32_t lane = 0U; lane < MD4_BATCH_LANES; ++lane) {
+      const uint32_t entry_index = first_entry_index + lane;
+
+      state.a[lane] = md4_initial_value.init_a;
+      state.b[lane] = md4_initial_value.init_b;
+      state.c[lane] = md4_initial_value.init_c;
+      state.d[lane] = md4_initial_value.init_d;
+
+      if (entry_index < number_of_entries) {
+        PrepareBatchLane(entries[entry_index].data_size, entries[entry_index].data_buffer, &lanes[lane]);
+      } else {
+        // Unused lane
+        lanes[lane].data = NULL;
+        lanes[lane].number_of_data_blocks = 0U;
+        lanes[lane].number_of_blocks = 0U;
+      }
+    }
+
+    Md4BodyBatch(lanes, &state);
+
+    // Write calculated MD4 hashes to results
+    for (uint32_t lane = 0U; lane < MD4_BATCH_LANES; ++lane) {
+      const uint32_t entry_index = first_entry_index + lane;
+
+      if (entry_index < number_of_entries) {
+        uint8_t *const result = entries[entry_index].calculated_md4->md4;
+        WriteU32toByteArray(state.a[lane], &result[0U]);
+        WriteU32toByteArray(state.b[lane], &result[BYTES_PER_U32]);
+        WriteU32toByteArray(state.c[lane], &result[BYTES_PER_U32 * 2U]);
+        WriteU32toByteArray(state.d[lane], &result[BYTES_PER_U32 * 3U]);
+      }
+    }
+  }
+#else
+  // Without the hardware MD4 lanes, the lanes are slower than the MD4 calculation of one data buffer after the other
+  for (uint32_t entry_index = 0U; entry_index < number_of_entries; ++entry_index) {
+    srmd4_CalculateMd4(md4_initial_value, entries[entry_index].data_size, entries[entry_index].data_buffer, entries[entry_index].calculated_md4);
+  }
+#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -291,6 +521,7 @@ static void Md4Body(Md4Context *const ctx, const uint8_t *const data, const uint
   uint32_t a, b, c, d;
   uint32_t saved_a, saved_b, saved_c, saved_d;  // cppcheck-suppress variableScope
 
+  uint32_t x[MD4_INPUT_DATA_BLOCK_SIZE / BYTES_PER_U32];  // little-endian words of the current data block
   uint32_t block_counter = number_of_blocks;
 
   current_data_block = data;
@@ -301,64 +532,73 @@ static void Md4Body(Md4Context *const ctx, const uint8_t *const data, const uint
   d = ctx->d;
 
   while (block_counter > 0U) {
+#if RAEND_HOST_BIG_ENDIAN
+    for (uint32_t index = 0U; index < (MD4_INPUT_DATA_BLOCK_SIZE / BYTES_PER_U32); ++index) {
+      x[index] = ReadU32FromByteArray(&current_data_block[index * BYTES_PER_U32]);
+    }
+#else
+    // The little endian words of the data block are loaded at once, the data block may be unaligned
+    (void)memcpy(x, current_data_block, MD4_INPUT_DATA_BLOCK_SIZE);
+#endif
+
     saved_a = a;
     saved_b = b;
     saved_c = c;
     saved_d = d;
 
     /* Round 1 */
-    Step(kMd4FunctionF, &a, b, c, d, Set(0U, current_data_block, ctx), 3U);
-    Step(kMd4FunctionF, &d, a, b, c, Set(1U, current_data_block, ctx), 7U);
-    Step(kMd4FunctionF, &c, d, a, b, Set(2U, current_data_block, ctx), 11U);
-    Step(kMd4FunctionF, &b, c, d, a, Set(3U, current_data_block, ctx), 19U);
-    Step(kMd4FunctionF, &a, b, c, d, Set(4U, current_data_block, ctx), 3U);
-    Step(kMd4FunctionF, &d, a, b, c, Set(5U, current_data_block, ctx), 7U);
-    Step(kMd4FunctionF, &c, d, a, b, Set(6U, current_data_block, ctx), 11U);
-    Step(kMd4FunctionF, &b, c, d, a, Set(7U, current_data_block, ctx), 19U);
-    Step(kMd4FunctionF, &a, b, c, d, Set(8U, current_data_block, ctx), 3U);
-    Step(kMd4FunctionF, &d, a, b, c, Set(9U, current_data_block, ctx), 7U);
-    Step(kMd4FunctionF, &c, d, a, b, Set(10U, current_data_block, ctx), 11U);
-    Step(kMd4FunctionF, &b, c, d, a, Set(11U, current_data_block, ctx), 19U);
-    Step(kMd4FunctionF, &a, b, c, d, Set(12U, current_data_block, ctx), 3U);
-    Step(kMd4FunctionF, &d, a, b, c, Set(13U, current_data_block, ctx), 7U);
-    Step(kMd4FunctionF, &c, d, a, b, Set(14U, current_data_block, ctx), 11U);
-    Step(kMd4FunctionF, &b, c, d, a, Set(15U, current_data_block, ctx), 19U);
+    a = StepF(a, b, c, d, x[0U], 3U);
+    d = StepF(d, a, b, c, x[1U], 7U);
+    c = StepF(c, d, a, b, x[2U], 11U);
+    b = StepF(b, c, d, a, x[3U], 19U);
+    a = StepF(a, b, c, d, x[4U], 3U);
+    d = StepF(d, a, b, c, x[5U], 7U);
+    c = StepF(c, d, a, b, x[6U], 11U);
+    b = StepF(b, c, d, a, x[7U], 19U);
+    a = StepF(a, b, c, d, x[8U], 3U);
+    d = StepF(d, a, b, c, x[9U], 7U);
+    c = StepF(c, d, a, b, x[10U], 11U);
+    b = StepF(b, c, d, a, x[11U], 19U);
+    a = StepF(a, b, c, d, x[12U], 3U);
+    d = StepF(d, a, b, c, x[13U], 7U);
+    c = StepF(c, d, a, b, x[14U], 11U);
+    b = StepF(b, c, d, a, x[15U], 19U);
 
     /* Round 2 */
-    Step(kMd4FunctionG, &a, b, c, d, Get(0U, ctx) + kAc1, 3U);
-    Step(kMd4FunctionG, &d, a, b, c, Get(4U, ctx) + kAc1, 5U);
-    Step(kMd4FunctionG, &c, d, a, b, Get(8U, ctx) + kAc1, 9U);
-    Step(kMd4FunctionG, &b, c, d, a, Get(12U, ctx) + kAc1, 13U);
-    Step(kMd4FunctionG, &a, b, c, d, Get(1U, ctx) + kAc1, 3U);
-    Step(kMd4FunctionG, &d, a, b, c, Get(5U, ctx) + kAc1, 5U);
-    Step(kMd4FunctionG, &c, d, a, b, Get(9U, ctx) + kAc1, 9U);
-    Step(kMd4FunctionG, &b, c, d, a, Get(13U, ctx) + kAc1, 13U);
-    Step(kMd4FunctionG, &a, b, c, d, Get(2U, ctx) + kAc1, 3U);
-    Step(kMd4FunctionG, &d, a, b, c, Get(6U, ctx) + kAc1, 5U);
-    Step(kMd4FunctionG, &c, d, a, b, Get(10U, ctx) + kAc1, 9U);
-    Step(kMd4FunctionG, &b, c, d, a, Get(14U, ctx) + kAc1, 13U);
-    Step(kMd4FunctionG, &a, b, c, d, Get(3U, ctx) + kAc1, 3U);
-    Step(kMd4FunctionG, &d, a, b, c, Get(7U, ctx) + kAc1, 5U);
-    Step(kMd4FunctionG, &c, d, a, b, Get(11U, ctx) + kAc1, 9U);
-    Step(kMd4FunctionG, &b, c, d, a, Get(15U, ctx) + kAc1, 13U);
+    a = StepG(a, b, c, d, x[0U], 3U);
+    d = StepG(d, a, b, c, x[4U], 5U);
+    c = StepG(c, d, a, b, x[8U], 9U);
+    b = StepG(b, c, d, a, x[12U], 13U);
+    a = StepG(a, b, c, d, x[1U], 3U);
+    d = StepG(d, a, b, c, x[5U], 5U);
+    c = StepG(c, d, a, b, x[9U], 9U);
+    b = StepG(b, c, d, a, x[13U], 13U);
+    a = StepG(a, b, c, d, x[2U], 3U);
+    d = StepG(d, a, b, c, x[6U], 5U);
+    c = StepG(c, d, a, b, x[10U], 9U);
+    b = StepG(b, c, d, a, x[14U], 13U);
+    a = StepG(a, b, c, d, x[3U], 3U);
+    d = StepG(d, a, b, c, x[7U], 5U);
+    c = StepG(c, d, a, b, x[11U], 9U);
+    b = StepG(b, c, d, a, x[15U], 13U);
 
     /* Round 3 */
-    Step(kMd4FunctionH, &a, b, c, d, Get(0U, ctx) + kAc2, 3U);
-    Step(kMd4FunctionH, &d, a, b, c, Get(8U, ctx) + kAc2, 9U);
-    Step(kMd4FunctionH, &c, d, a, b, Get(4U, ctx) + kAc2, 11U);
-    Step(kMd4FunctionH, &b, c, d, a, Get(12U, ctx) + kAc2, 15U);
-    Step(kMd4FunctionH, &a, b, c, d, Get(2U, ctx) + kAc2, 3U);
-    Step(kMd4FunctionH, &d, a, b, c, Get(10U, ctx) + kAc2, 9U);
-    Step(kMd4FunctionH, &c, d, a, b, Get(6U, ctx) + kAc2, 11U);
-    Step(kMd4FunctionH, &b, c, d, a, Get(14U, ctx) + kAc2, 15U);
-    Step(kMd4FunctionH, &a, b, c, d, Get(1U, ctx) + kAc2, 3U);
-    Step(kMd4FunctionH, &d, a, b, c, Get(9U, ctx) + kAc2, 9U);
-    Step(kMd4FunctionH, &c, d, a, b, Get(5U, ctx) + kAc2, 11U);
-    Step(kMd4FunctionH, &b, c, d, a, Get(13U, ctx) + kAc2, 15U);
-    Step(kMd4FunctionH, &a, b, c, d, Get(3U, ctx) + kAc2, 3U);
-    Step(kMd4FunctionH, &d, a, b, c, Get(11U, ctx) + kAc2, 9U);
-    Step(kMd4FunctionH, &c, d, a, b, Get(7U, ctx) + kAc2, 11U);
-    Step(kMd4FunctionH, &b, c, d, a, Get(15U, ctx) + kAc2, 15U);
+    a = StepH(a, b, c, d, x[0U], 3U);
+    d = StepH(d, a, b, c, x[8U], 9U);
+    c = StepH(c, d, a, b, x[4U], 11U);
+    b = StepH(b, c, d, a, x[12U], 15U);
+    a = StepH(a, b, c, d, x[2U], 3U);
+    d = StepH(d, a, b, c, x[10U], 9U);
+    c = StepH(c, d, a, b, x[6U], 11U);
+    b = StepH(b, c, d, a, x[14U], 15U);
+    a = StepH(a, b, c, d, x[1U], 3U);
+    d = StepH(d, a, b, c, x[9U], 9U);
+    c = StepH(c, d, a, b, x[5U], 11U);
+    b = StepH(b, c, d, a, x[13U], 15U);
+    a = StepH(a, b, c, d, x[3U], 3U);
+    d = StepH(d, a, b, c, x[11U], 9U);
+    c = StepH(c, d, a, b, x[7U], 11U);
+    b = StepH(b, c, d, a, x[15U], 15U);
 
     a += saved_a;
     b += saved_b;
@@ -413,7 +653,9 @@ static void Md4Final(Md4Context *ctx, uint8_t *result) {
 
   if (unused_buffer_bytes < (BYTES_PER_U32 * 2U)) {
     // not enough space to add the bit counters to the buffer of this data block
-    SetContextBuffer(0U, unused_buffer_bytes, used_buffer_bytes, ctx);  // Set remaining padding bits of this data block to 0
+    if (unused_buffer_bytes > 0U) {
+      SetContextBuffer(0U, unused_buffer_bytes, used_buffer_bytes, ctx);  // Set remaining padding bits of this data block to 0
+    }
     Md4Body(ctx, ctx->buffer, 1U);                                      // Perform an additional MD4 calculation of this data block
     used_buffer_bytes = 0U;
     unused_buffer_bytes = MD4_INPUT_DATA_BLOCK_SIZE;
@@ -479,10 +721,6 @@ static void ClearMd4ContextData(Md4Context *const md4_context) {
   md4_context->bit_count_high = 0U;
 
   SetContextBuffer(0U, MD4_INPUT_DATA_BLOCK_SIZE, 0U, md4_context);
-
-  for (uint32_t index = 0U; index < (MD4_INPUT_DATA_BLOCK_SIZE / BYTES_PER_U32); ++index) {
-    md4_context->block[index] = 0U;
-  }
 }
 
 static void WriteU32toByteArray(const uint32_t source, uint8_t *const destination) {
@@ -507,41 +745,218 @@ static uint32_t FunctionH(const uint32_t x, const uint32_t y, const uint32_t z)
   return (x ^ y ^ z);
 }
 
-static void Step(const Md4Function md4_function, uint32_t *const a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t x, const uint32_t s) {
+static uint32_t StepF(const uint32_t a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t x, const uint32_t s) {
+  return RotateLeft(a + FunctionF(b, c, d) + x, s);
+}
+
+static uint32_t StepG(const uint32_t a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t x, const uint32_t s) {
+  return RotateLeft(a + FunctionG(b, c, d) + x + kAc1, s);
+}
+
+static uint32_t StepH(const uint32_t a, const uint32_t b, const uint32_t c, const uint32_t d, const uint32_t x, const uint32_t s) {
+  return RotateLeft(a + FunctionH(b, c, d) + x + kAc2, s);
+}
+
+#if HARDWARE_MD4_SSE2 != 0
+static void PrepareBatchLane(const uint16_t data_size, const uint8_t *const data_buffer, Md4BatchLane *const lane) {
   // Input parameter check
-  raas_AssertNotNull(a, radef_kInternalError);
-
-  switch (md4_function) {
-    case kMd4FunctionF:
-      *a += (FunctionF(b, c, d) + x);
-      break;
-    case kMd4FunctionG:
-      *a += (FunctionG(b, c, d) + x);
-      break;
-    case kMd4FunctionH:
-      *a += (FunctionH(b, c, d) + x);
-      break;
-      // no coverage start
-    default:
-      rasys_FatalError(radef_kInternalError);
-      break;
-      // no coverage end
+  raas_AssertNotNull(data_buffer, radef_kInternalError);
+  raas_AssertNotNull(lane, radef_kInternalError);
+
+  const uint32_t remaining_data_bytes = (uint32_t)data_size & kDataBlockSizeBitMask;
+  uint32_t padding_size = MD4_INPUT_DATA_BLOCK_SIZE;
+
+  if ((MD4_INPUT_DATA_BLOCK_SIZE - remaining_data_bytes) <= (BYTES_PER_U32 * 2U)) {
+    // not enough space to add the first padding bit and the bit counters to this data block
+    padding_size = MD4_INPUT_DATA_BLOCK_SIZE * 2U;
   }
-  *a = ((*a << s) | ((*a & 0xFFFFFFFFU) >> (32U - s)));
+
+  lane->data = data_buffer;
+  lane->number_of_data_blocks = (uint32_t)data_size >> kDataBlockSizeBits;
+  lane->number_of_blocks = lane->number_of_data_blocks + (padding_size / MD4_INPUT_DATA_BLOCK_SIZE);
+
+  (void)memcpy(lane->padding, &data_buffer[lane->number_of_data_blocks * MD4_INPUT_DATA_BLOCK_SIZE], remaining_data_bytes);
+  (void)memset(&lane->padding[remaining_data_bytes], 0, padding_size - remaining_data_bytes);
+
+  lane->padding[remaining_data_bytes] = 0x80U;  // Set the first padding bit to 1
+
+  // Multiply data size by 8 and write lower 32 bits of the bit counter to the buffer, the upper 32 bits are always 0
+  WriteU32toByteArray((uint32_t)data_size << 3U, &lane->padding[padding_size - (BYTES_PER_U32 * 2U)]);
 }
 
-static uint32_t Set(const uint8_t index_32_bit, const uint8_t *const data, Md4Context *const ctx) {
+static const uint8_t *GetBatchLaneBlock(const Md4BatchLane *const lane, const uint32_t block_index) {
   // Input parameter check
-  raas_AssertNotNull(data, radef_kInternalError);
-  raas_AssertNotNull(ctx, radef_kInternalError);
+  raas_AssertNotNull(lane, radef_kInternalError);
 
-  return ctx->block[index_32_bit] = (uint32_t)data[index_32_bit * BYTES_PER_U32] | ((uint32_t)data[(index_32_bit * BYTES_PER_U32) + 1U] << 8U) |
-                                    ((uint32_t)data[(index_32_bit * BYTES_PER_U32) + 2U] << 16U) | ((uint32_t)data[(index_32_bit * BYTES_PER_U32) + 3U] << 24U);
+  const uint8_t *block = kZeroDataBlock;
+
+  if (block_index < lane->number_of_data_blocks) {
+    block = &lane->data[block_index * MD4_INPUT_DATA_BLOCK_SIZE];
+  } else if (block_index < lane->number_of_blocks) {
+    block = &lane->padding[(block_index - lane->number_of_data_blocks) * MD4_INPUT_DATA_BLOCK_SIZE];
+  } else {
+    // Lane already completed, it is processed with zeros and its result is discarded
+  }
+
+  return block;
 }
 
-static uint32_t Get(const uint8_t index_32_bit, const Md4Context *const ctx) {
+static void Md4BodyBatch(const Md4BatchLane *const lanes, Md4BatchState *const state) {
   // Input parameter check
-  raas_AssertNotNull(ctx, radef_kInternalError);
+  raas_AssertNotNull(lanes, radef_kInternalError);
+  raas_AssertNotNull(state, radef_kInternalError);
+
+  const uint8_t *lane_blocks[MD4_BATCH_LANES];
+  uint32_t max_number_of_blocks = 0U;
+
+  for (uint32_t lane = 0U; lane < MD4_BATCH_LANES; ++lane) {
+    if (lanes[lane].number_of_blocks > max_number_of_blocks) {
+      max_number_of_blocks = lanes[lane].number_of_blocks;
+    }
+  }
+
+  __m128i x[MD4_BLOCK_WORDS];
+  Md4BatchStateHardware lane_state;
+  Md4BatchStateHardware saved_state;
+  // The number of blocks is at most 18, so that the signed compare of the SSE2 instructions selects the lanes which are not completed
+  const __m128i kNumberOfBlocks = _mm_setr_epi32((int32_t)lanes[0U].number_of_blocks, (int32_t)lanes[1U].number_of_blocks,
+                                                 (int32_t)lanes[2U].number_of_blocks, (int32_t)lanes[3U].number_of_blocks);
+
+  lane_state.a = _mm_loadu_si128((const __m128i *)state->a);
+  lane_state.b = _mm_loadu_si128((const __m128i *)state->b);
+  lane_state.c = _mm_loadu_si128((const __m128i *)state->c);
+  lane_state.d = _mm_loadu_si128((const __m128i *)state->d);
+
+  for (uint32_t block_index = 0U; block_index < max_number_of_blocks; ++block_index) {
+    for (uint32_t lane = 0U; lane < MD4_BATCH_LANES; ++lane) {
+      lane_blocks[lane] = GetBatchLaneBlock(&lanes[lane], block_index);
+    }
+    LoadBatchBlockHardware(lane_blocks, x);
+
+    saved_state = lane_state;
+
+    Md4RoundsBatchHardware(x, &lane_state);
+
+    // Add the previous state to the lanes which are not completed, completed lanes restore their state
+    const __m128i kActiveLanes = _mm_cmpgt_epi32(kNumberOfBlocks, _mm_set1_epi32((int32_t)block_index));
+    lane_state.a = HARDWARE_SELECT_LANES(kActiveLanes, _mm_add_epi32(lane_state.a, saved_state.a), saved_state.a);
+    lane_state.b = HARDWARE_SELECT_LANES(kActiveLanes, _mm_add_epi32(lane_state.b, saved_state.b), saved_state.b);
+    lane_state.c = HARDWARE_SELECT_LANES(kActiveLanes, _mm_add_epi32(lane_state.c, saved_state.c), saved_state.c);
+    lane_state.d = HARDWARE_SELECT_LANES(kActiveLanes, _mm_add_epi32(lane_state.d, saved_state.d), saved_state.d);
+  }
+
+  _mm_storeu_si128((__m128i *)state->a, lane_state.a);
+  _mm_storeu_si128((__m128i *)state->b, lane_state.b);
+  _mm_storeu_si128((__m128i *)state->c, lane_state.c);
+  _mm_storeu_si128((__m128i *)state->d, lane_state.d);
+}
+
+static void LoadBatchBlockHardware(const uint8_t *const lane_blocks[MD4_BATCH_LANES], __m128i x[MD4_BLOCK_WORDS]) {
+  // Input parameter check
+  raas_AssertNotNull(lane_blocks, radef_kInternalError);
+  raas_AssertNotNull(x, radef_kInternalError);
+
+  for (uint32_t index = 0U; index < MD4_BLOCK_WORDS; index += MD4_BATCH_LANES) {
+    // Words index to index + 3 of every lane
+    const __m128i kLane0 = _mm_loadu_si128((const __m128i *)&lane_blocks[0U][index * BYTES_PER_U32]);
+    const __m128i kLane1 = _mm_loadu_si128((const __m128i *)&lane_blocks[1U][index * BYTES_PER_U32]);
+    const __m128i kLane2 = _mm_loadu_si128((const __m128i *)&lane_blocks[2U][index * BYTES_PER_U32]);
+    const __m128i kLane3 = _mm_loadu_si128((const __m128i *)&lane_blocks[3U][index * BYTES_PER_U32]);
+
+    // Transpose the 4x4 words: the low and high word pairs of lanes 0/1 and 2/3 are interleaved, then the pairs of all lanes are combined
+    const __m128i kLow01 = _mm_unpacklo_epi32(kLane0, kLane1);
+    const __m128i kLow23 = _mm_unpacklo_epi32(kLane2, kLane3);
+    const __m128i kHigh01 = _mm_unpackhi_epi32(kLane0, kLane1);
+    const __m128i kHigh23 = _mm_unpackhi_epi32(kLane2, kLane3);
+    x[index] = _mm_unpacklo_epi64(kLow01, kLow23);
+    x[index + 1U] = _mm_unpackhi_epi64(kLow01, kLow23);
+    x[index + 2U] = _mm_unpacklo_epi64(kHigh01, kHigh23);
+    x[index + 3U] = _mm_unpackhi_epi64(kHigh01, kHigh23);
+  }
+}
+
+static void Md4RoundsBatchHardware(const __m128i x[MD4_BLOCK_WORDS], Md4BatchStateHardware *const state) {
+  // Input parameter check
+  raas_AssertNotNull(x, radef_kInternalError);
+  raas_AssertNotNull(state, radef_kInternalError);
+
+  __m128i a = state->a;
+  __m128i b = state->b;
+  __m128i c = state->c;
+  __m128i d = state->d;
+  const __m128i kAc1Lanes = _mm_set1_epi32((int32_t)kAc1);
+  const __m128i kAc2Lanes = _mm_set1_epi32((int32_t)kAc2);
+
+  /* Round 1 */
+  HARDWARE_STEP_F(a, b, c, d, x[0U], 3);
+  HARDWARE_STEP_F(d, a, b, c, x[1U], 7);
+  HARDWARE_STEP_F(c, d, a, b, x[2U], 11);
+  HARDWARE_STEP_F(b, c, d, a, x[3U], 19);
+  HARDWARE_STEP_F(a, b, c, d, x[4U], 3);
+  HARDWARE_STEP_F(d, a, b, c, x[5U], 7);
+  HARDWARE_STEP_F(c, d, a, b, x[6U], 11);
+  HARDWARE_STEP_F(b, c, d, a, x[7U], 19);
+  HARDWARE_STEP_F(a, b, c, d, x[8U], 3);
+  HARDWARE_STEP_F(d, a, b, c, x[9U], 7);
+  HARDWARE_STEP_F(c, d, a, b, x[10U], 11);
+  HARDWARE_STEP_F(b, c, d, a, x[11U], 19);
+  HARDWARE_STEP_F(a, b, c, d, x[12U], 3);
+  HARDWARE_STEP_F(d, a, b, c, x[13U], 7);
+  HARDWARE_STEP_F(c, d, a, b, x[14U], 11);
+  HARDWARE_STEP_F(b, c, d, a, x[15U], 19);
+
+  /* Round 2 */
+  HARDWARE_STEP_G(a, b, c, d, x[0U], 3, kAc1Lanes);
+  HARDWARE_STEP_G(d, a, b, c, x[4U], 5, kAc1Lanes);
+  HARDWARE_STEP_G(c, d, a, b, x[8U], 9, kAc1Lanes);
+  HARDWARE_STEP_G(b, c, d, a, x[12U], 13, kAc1Lanes);
+  HARDWARE_STEP_G(a, b, c, d, x[1U], 3, kAc1Lanes);
+  HARDWARE_STEP_G(d, a, b, c, x[5U], 5, kAc1Lanes);
+  HARDWARE_STEP_G(c, d, a, b, x[9U], 9, kAc1Lanes);
+  HARDWARE_STEP_G(b, c, d, a, x[13U], 13, kAc1Lanes);
+  HARDWARE_STEP_G(a, b, c, d, x[2U], 3, kAc1Lanes);
+  HARDWARE_STEP_G(d, a, b, c, x[6U], 5, kAc1Lanes);
+  HARDWARE_STEP_G(c, d, a, b, x[10U], 9, kAc1Lanes);
+  HARDWARE_STEP_G(b, c, d, a, x[14U], 13, kAc1Lanes);
+  HARDWARE_STEP_G(a, b, c, d, x[3U], 3, kAc1Lanes);
+  HARDWARE_STEP_G(d, a, b, c, x[7U], 5, kAc1Lanes);
+  HARDWARE_STEP_G(c, d, a, b, x[11U], 9, kAc1Lanes);
+  HARDWARE_STEP_G(b, c, d, a, x[15U], 13, kAc1Lanes);
+
+  /* Round 3 */
+  HARDWARE_STEP_H(a, b, c, d, x[0U], 3, kAc2Lanes);
+  HARDWARE_STEP_H(d, a, b, c, x[8U], 9, kAc2Lanes);
+  HARDWARE_STEP_H(c, d, a, b, x[4U], 11, kAc2Lanes);
+  HARDWARE_STEP_H(b, c, d, a, x[12U], 15, kAc2Lanes);
+  HARDWARE_STEP_H(a, b, c, d, x[2U], 3, kAc2Lanes);
+  HARDWARE_STEP_H(d, a, b, c, x[10U], 9, kAc2Lanes);
+  HARDWARE_STEP_H(c, d, a, b, x[6U], 11, kAc2Lanes);
+  HARDWARE_STEP_H(b, c, d, a, x[14U], 15, kAc2Lanes);
+  HARDWARE_STEP_H(a, b, c, d, x[1U], 3, kAc2Lanes);
+  HARDWARE_STEP_H(d, a, b, c, x[9U], 9, kAc2Lanes);
+  HARDWARE_STEP_H(c, d, a, b, x[5U], 11, kAc2Lanes);
+  HARDWARE_STEP_H(b, c, d, a, x[13U], 15, kAc2Lanes);
+  HARDWARE_STEP_H(a, b, c, d, x[3U], 3, kAc2Lanes);
+  HARDWARE_STEP_H(d, a, b, c, x[11U], 9, kAc2Lanes);
+  HARDWARE_STEP_H(c, d, a, b, x[7U], 11, kAc2Lanes);
+  HARDWARE_STEP_H(b, c, d, a, x[15U], 15, kAc2Lanes);
+
+  state->a = a;
+  state->b = b;
+  state->c = c;
+  state->d = d;
+}
+#endif
+
+#if RAEND_HOST_BIG_ENDIAN
+static uint32_t ReadU32FromByteArray(const uint8_t *const source) {
+  // Input parameter check
+  raas_AssertNotNull(source, radef_kInternalError);
+
+  return (uint32_t)source[0U] | ((uint32_t)source[1U] << 8U) | ((uint32_t)source[2U] << 16U) | ((uint32_t)source[3U] << 24U);
+}
+#endif
 
-  return ctx->block[index_32_bit];
+static uint32_t RotateLeft(const uint32_t value, const uint32_t s) {
+  return ((value << s) | (value >> (32U - s)));
 }
@@ -52,6 +52,18 @@ typedef struct {
   uint8_t md4[RADEF_MAX_SR_LAYER_SAFETY_CODE_SIZE];  ///< Array containing the full MD4 hash
 } srmd4_Md4;
 
+/**
+ * @brief Typedef for one entry of a batched MD4 calculation.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  uint16_t data_size;          ///< Size of data buffer [bytes]. Valid range: ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE <= value <= (::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE -
+                               ///< ::RADEF_MAX_SR_LAYER_SAFETY_CODE_SIZE).
+  const uint8_t *data_buffer;  ///< Pointer to data buffer. NULL is not allowed.
+  srmd4_Md4 *calculated_md4;   ///< Pointer to array for the calculated MD4. NULL is not allowed.
+} srmd4_Md4BatchEntry;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -66,6 +78,8 @@ extern "C" {
 /**
  * @brief Calculate the MD4 of a data buffer.
  *
+ * The function does not use any module data, so it can be called concurrently from several threads.
+ *
  * @implementsReq{RASW-633} Calculate MD4 Function
  * @implementsReq{RASW-634} Safety Code
  *
@@ -78,6 +92,24 @@ extern "C" {
 void srmd4_CalculateMd4(const srcty_Md4InitValue md4_initial_value, const uint16_t data_size, const uint8_t *const data_buffer,
                         srmd4_Md4 *const calculated_md4);
 
+/**
+ * @brief Calculate the MD4 of several independent data buffers at once.
+ *
+ * If the SSE2 instructions are enabled for the target of the build, the data buffers are processed in groups of four parallel lanes, one lane per 32 bit word
+ * of the SSE2 registers. Otherwise the MD4 of the data buffers are calculated one after the other, since the lanes are slower than ::srmd4_CalculateMd4
+ * without vector instructions. Buffers with different sizes can be mixed within a batch. The calculated MD4 of every entry is bit-identical to the result of ::srmd4_CalculateMd4 for the same data buffer. Like
+ * ::srmd4_CalculateMd4, the function does not use any module data and can be called concurrently from several threads.
+ *
+ * @implementsReq{RASW-633} Calculate MD4 Function
+ * @implementsReq{RASW-634} Safety Code
+ *
+ * @param [in] md4_initial_value MD4 initial value. Valid values are defined in ::srcty_Md4InitValue.
+ * @param [in] number_of_entries Number of entries in the entries array. Valid range: 1 <= value. For 0, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] entries Pointer to array of batch entries. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown. The data size and the
+ * pointers of every entry are checked as described in ::srmd4_CalculateMd4, before any MD4 is calculated.
+ */
+void srmd4_CalculateMd4Batch(const srcty_Md4InitValue md4_initial_value, const uint16_t number_of_entries, const srmd4_Md4BatchEntry *const entries);
+
 /** @}*/
 
 #ifdef __cplusplus
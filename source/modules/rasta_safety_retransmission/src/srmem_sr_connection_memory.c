@@ -0,0 +1,136 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srmem_sr_connection_memory.c
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Implementation of RaSTA SafRetL connection memory module.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "srmem_sr_connection_memory.h"  // NOLINT(build/include_subdir)
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rasta_common/raas_rasta_assert.h"
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_safety_retransmission/sraty_sr_api_types.h"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+#if (SRATY_CONNECTION_MEMORY_ALIGNMENT & (SRATY_CONNECTION_MEMORY_ALIGNMENT - 1U)) != 0U
+#error "SRATY_CONNECTION_MEMORY_ALIGNMENT must be a power of two"
+#endif
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Data of all SafRetL connection memory instances.
+ */
+PRIVATE srmem_InstanceData srmem_instances[RADEF_MAX_NUMBER_OF_SR_INSTANCES];
+
+/**
+ * @brief Data of the selected SafRetL connection memory instance.
+ */
+PRIVATE RADEF_THREAD_LOCAL srmem_InstanceData *srmem_instance = &srmem_instances[0];
+
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Constant Definitions
+// -----------------------------------------------------------------------------
+
+static const uint32_t kMaxAllocationSize = UINT32_MAX - SRATY_CONNECTION_MEMORY_ALIGNMENT + 1U;  ///< Maximum size of an allocation [bytes]
+
+// -----------------------------------------------------------------------------
+// Global Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+
+void srmem_Init(void *const connection_memory, const uint32_t connection_memory_size) {
+  // Input parameter check
+  raas_AssertTrue(!srmem_instance->initialized, radef_kAlreadyInitialized);
+  raas_AssertNotNull(connection_memory, radef_kInvalidParameter);
+  raas_AssertTrue(((uintptr_t)connection_memory & (SRATY_CONNECTION_MEMORY_ALIGNMENT - 1U)) == 0U,  //lint !e923 (cast is needed to check the alignment)
+                  radef_kInvalidParameter);
+
+  srmem_instance->connection_memory = (uint8_t *)connection_memory;
+  srmem_instance->connection_memory_size = connection_memory_size;
+  srmem_instance->allocated_size = 0U;
+
+  srmem_instance->initialized = true;
+}
+
+void srmem_SelectInstance(const uint32_t instance_index) {
+  // Input parameter check
+  raas_AssertU32InRange(instance_index, 0U, RADEF_MAX_NUMBER_OF_SR_INSTANCES - 1U, radef_kInvalidParameter);
+
+  srmem_instance = &srmem_instances[instance_index];
+}
+
+void *srmem_Allocate(const uint32_t size) {
+  // Input parameter check
+  raas_AssertTrue(srmem_instance->initialized, radef_kNotInitialized);
+  raas_AssertU32InRange(size, 1U, kMaxAllocationSize, radef_kInvalidParameter);
+
+  const uint32_t kAllocationSize = srmem_GetAllocationSize(size);
+  raas_AssertTrue(kAllocationSize <= (srmem_instance->connection_memory_size - srmem_instance->allocated_size), radef_kInvalidConfiguration);
+
+  uint8_t *const allocated_memory = &srmem_instance->connection_memory[srmem_instance->allocated_size];
+  srmem_instance->allocated_size += kAllocationSize;
+
+  // Clear the allocated memory, so that the tables start in the same state as static data
+  for (uint32_t index = 0U; index < kAllocationSize; ++index) {
+    allocated_memory[index] = 0U;
+  }
+
+  return allocated_memory;
+}
+
+uint32_t srmem_GetAllocationSize(const uint32_t size) {
+  // Input parameter check
+  raas_AssertU32InRange(size, 1U, kMaxAllocationSize, radef_kInvalidParameter);
+
+  return (size + (SRATY_CONNECTION_MEMORY_ALIGNMENT - 1U)) & ~(SRATY_CONNECTION_MEMORY_ALIGNMENT - 1U);
+}
+
+uint32_t srmem_GetTableAllocationSize(const uint32_t number_of_entries, const uint32_t entry_size) {
+  // Input parameter check
+  raas_AssertU32InRange(number_of_entries, 1U, kMaxAllocationSize, radef_kInvalidParameter);
+  raas_AssertU32InRange(entry_size, 1U, kMaxAllocationSize / number_of_entries, radef_kInvalidParameter);
+
+  return srmem_GetAllocationSize(number_of_entries * entry_size);
+}
+
+uint32_t srmem_AddAllocationSizes(const uint32_t allocation_size, const uint32_t additional_allocation_size) {
+  // Input parameter check
+  raas_AssertTrue(additional_allocation_size <= (UINT32_MAX - allocation_size), radef_kInvalidParameter);
+
+  return allocation_size + additional_allocation_size;
+}
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
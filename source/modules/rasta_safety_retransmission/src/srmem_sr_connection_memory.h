@@ -0,0 +1,138 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srmem_sr_connection_memory.h
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @addtogroup sr_connectionMemory
+ * @{
+ *
+ * @brief Interface of RaSTA SafRetL connection memory module.
+ *
+ * This module manages the connection memory, which is provided by the application at the initialization of the SafRetL. The per connection tables of the
+ * SafRetL modules are allocated from this memory at their initialization, so that they are sized with the configured number of connections. The allocations
+ * are taken one after another from the connection memory and are never freed. Every allocation is aligned to ::SRATY_CONNECTION_MEMORY_ALIGNMENT.
+ */
+#ifndef SRMEM_SAFETY_RETRANSMISSION_CONNECTION_MEMORY_H_
+#define SRMEM_SAFETY_RETRANSMISSION_CONNECTION_MEMORY_H_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <stdbool.h>
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Global Macro Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Type Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Struct for the data of a SafRetL connection memory instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;                 ///< Initialization state of the module. true, if the module is initialized.
+  uint8_t *connection_memory;       ///< Pointer to the connection memory.
+  uint32_t connection_memory_size;  ///< Size of the connection memory [bytes].
+  uint32_t allocated_size;          ///< Size of the already allocated connection memory [bytes].
+} srmem_InstanceData;
+//lint -restore
+
+// -----------------------------------------------------------------------------
+// Global Const Declarations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Prototypes
+// -----------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/**
+ * @brief Initialize the SafRetL connection memory module.
+ *
+ * This function saves the connection memory. All of the connection memory is free after the initialization. A fatal error is raised, if this function is
+ * called multiple times.
+ *
+ * @pre The connection memory module must not be initialized, otherwise a ::radef_kAlreadyInitialized fatal error is thrown.
+ *
+ * @param [in] connection_memory Pointer to the connection memory. The memory must be aligned to ::SRATY_CONNECTION_MEMORY_ALIGNMENT. If the pointer is NULL or
+ * the memory is not aligned, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [in] connection_memory_size Size of the connection memory [bytes]. Full value range is valid and usable.
+ */
+void srmem_Init(void *const connection_memory, const uint32_t connection_memory_size);
+
+/**
+ * @brief Select the SafRetL connection memory instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the SafRetL connection memory functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_SR_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void srmem_SelectInstance(const uint32_t instance_index);
+
+/**
+ * @brief Allocate memory from the connection memory.
+ *
+ * This function takes the requested size, rounded up to ::SRATY_CONNECTION_MEMORY_ALIGNMENT, from the free connection memory and sets all bytes of the
+ * allocated memory to 0. If the free connection memory is too small, a ::radef_kInvalidConfiguration fatal error is thrown.
+ *
+ * @pre The connection memory module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @param [in] size Requested size [bytes]. Valid range: 1 <= value <= UINT32_MAX - ::SRATY_CONNECTION_MEMORY_ALIGNMENT + 1.
+ * @return Pointer to the allocated memory.
+ */
+void *srmem_Allocate(const uint32_t size);
+
+/**
+ * @brief Get the size of the connection memory used by an allocation.
+ *
+ * This function returns the requested size rounded up to ::SRATY_CONNECTION_MEMORY_ALIGNMENT. It can be used before the initialization of the module.
+ *
+ * @param [in] size Requested size [bytes]. Valid range: 1 <= value <= UINT32_MAX - ::SRATY_CONNECTION_MEMORY_ALIGNMENT + 1.
+ * @return Size of the connection memory used by the allocation [bytes].
+ */
+uint32_t srmem_GetAllocationSize(const uint32_t size);
+
+/**
+ * @brief Get the size of the connection memory used by the allocation of a table.
+ *
+ * This function returns the size of a table with the given number of entries, rounded up to ::SRATY_CONNECTION_MEMORY_ALIGNMENT. The size of the table is
+ * checked before it is calculated, so that it can not overflow. It can be used before the initialization of the module.
+ *
+ * @param [in] number_of_entries Number of entries of the table. Valid range: 1 <= value <= UINT32_MAX - ::SRATY_CONNECTION_MEMORY_ALIGNMENT + 1.
+ * @param [in] entry_size Size of an entry of the table [bytes]. Valid range: 1 <= value, with number_of_entries * value <= UINT32_MAX -
+ * ::SRATY_CONNECTION_MEMORY_ALIGNMENT + 1. If the table is bigger, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return Size of the connection memory used by the allocation of the table [bytes].
+ */
+uint32_t srmem_GetTableAllocationSize(const uint32_t number_of_entries, const uint32_t entry_size);
+
+/**
+ * @brief Add two sizes of the connection memory.
+ *
+ * This function adds the sizes of the connection memory used by allocations. It can be used before the initialization of the module.
+ *
+ * @param [in] allocation_size Size of the connection memory [bytes]. Full value range is valid and usable.
+ * @param [in] additional_allocation_size Size of the connection memory to add [bytes]. Valid range: 0 <= value <= UINT32_MAX - allocation_size. If the sum
+ * exceeds UINT32_MAX, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return Sum of the sizes of the connection memory [bytes].
+ */
+uint32_t srmem_AddAllocationSizes(const uint32_t allocation_size, const uint32_t additional_allocation_size);
+
+/** @}*/
+
+#ifdef __cplusplus
+}
+#endif  // __cplusplus
+#endif  // SRMEM_SAFETY_RETRANSMISSION_CONNECTION_MEMORY_H_
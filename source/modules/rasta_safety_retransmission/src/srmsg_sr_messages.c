@@ -24,6 +24,7 @@
 
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_common/raend_rasta_endian.h"
 #include "rasta_common/ralog_rasta_logger.h"
 #include "rasta_common/rasys_rasta_system_adapter.h"
 #include "rasta_safety_retransmission/sraty_sr_api_types.h"
@@ -34,6 +35,8 @@
 // Local Macro Definitions
 // -----------------------------------------------------------------------------
 
+#define MD4_BATCH_SIZE (8U)  ///< Maximum number of messages passed at once to ::srmd4_CalculateMd4Batch
+
 // -----------------------------------------------------------------------------
 // Local Type Definitions
 // -----------------------------------------------------------------------------
@@ -43,20 +46,14 @@
 // -----------------------------------------------------------------------------
 
 /**
- * @brief Initialization state of the module.
- * true, if the module is initialized.
- */
-PRIVATE bool srmsg_initialized = false;
-
-/**
- * @brief Configured safety code type.
+ * @brief Data of all SafRetL messages instances.
  */
-PRIVATE srcty_SafetyCodeType srmsg_safety_code_type;
+PRIVATE srmsg_InstanceData srmsg_instances[RADEF_MAX_NUMBER_OF_SR_INSTANCES];
 
 /**
- * @brief Configured MD4 initial code value.
+ * @brief Data of the selected SafRetL messages instance.
  */
-PRIVATE srcty_Md4InitValue srmsg_md4_initial_value;
+PRIVATE RADEF_THREAD_LOCAL srmsg_InstanceData *srmsg_instance = &srmsg_instances[0];
 
 // -----------------------------------------------------------------------------
 // Local Function Prototypes
@@ -83,7 +80,7 @@ static bool IsMessageTypeValid(srtyp_SrMessageType message_type);
 /**
  * @brief Set a Uint16 at a specific position in a message
  *
- * This internal function sets a Uint16 byte by byte in little endian format at a given position in a message. If the Uint16 doesn't fit inside the message
+ * This internal function sets a Uint16 word in little endian format at a given position in a message. If the Uint16 doesn't fit inside the message
  * (position + Uint16 byte size > message size), a ::radef_kInternalError fatal error message is thrown.
  *
  * @implementsReq{RASW-157} Endian Definition
@@ -94,24 +91,10 @@ static bool IsMessageTypeValid(srtyp_SrMessageType message_type);
  */
 static void SetUint16InMessage(const uint16_t position, const uint16_t data, srtyp_SrMessage *const sr_message);
 
-/**
- * @brief Set a Uint32 at a specific position in a message
- *
- * This internal function sets a Uint32 byte by byte in little endian format at a given position in a message. If the Uint32 doesn't fit inside the message
- * (position + Uint32 byte size > message size), a ::radef_kInternalError fatal error message is thrown.
- *
- * @implementsReq{RASW-157} Endian Definition
- *
- * @param [in] position Position where the variable must be set in the message [bytes].
- * @param [in] data Variable to be set in the provided message.
- * @param [inout] sr_message Pointer to a message, where the variable must be set. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
- */
-static void SetUint32InMessage(const uint16_t position, const uint32_t data, srtyp_SrMessage *const sr_message);
-
 /**
  * @brief Set a Uint64 at a specific position in a message
  *
- * This internal function sets a Uint64 byte by byte in little endian format at a given position in a message. If the Uint64 doesn't fit inside the message
+ * This internal function sets a Uint64 as two Uint32 words in little endian format at a given position in a message. If the Uint64 doesn't fit inside the message
  * (position + Uint64 byte size > message size), a ::radef_kInternalError fatal error message is thrown.
  *
  * @implementsReq{RASW-157} Endian Definition
@@ -146,6 +129,25 @@ static void SetUint64InMessage(const uint16_t position, const uint64_t data, srt
 static void SetMessageHeaderInMessage(const uint16_t message_length, const uint16_t message_type, const srtyp_SrMessageHeaderCreate message_header,
                                       srtyp_SrMessage *const sr_message);
 
+/**
+ * @brief Write the message header data in the data of a message
+ *
+ * This internal function writes the message length, the message type and the message header data in the passed message data. The confirmed sequence number
+ * and the time stamp are set to 0. The message size is not changed, so a stored message can be modified in place.
+ *
+ * @implementsReq{RASW-160} General PDU Message Structure
+ *
+ * @param [in] message_length Message length to set in message [bytes]. The message length is checked if it is in the valid range of
+ * (::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + safety code length) <= value <= ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, otherwise a ::radef_kInternalError fatal
+ * error is thrown.
+ * @param [in] message_type Message type to set in message. Valid range: ::srtyp_kSrMessageMin <= value <= ::srtyp_kSrMessageMax -1.
+ * @param [in] message_header Message header data to set in message.
+ * @param [out] message_data Pointer to the message data with at least message_length bytes. If the pointer is NULL, a ::radef_kInternalError fatal error is
+ * thrown.
+ */
+static void WriteMessageHeader(const uint16_t message_length, const uint16_t message_type, const srtyp_SrMessageHeaderCreate message_header,
+                               uint8_t *const message_data);
+
 /**
  * @brief Set the protocol version in a message
  *
@@ -181,7 +183,7 @@ static void SetPayloadDataInMessage(const uint16_t position, const srtyp_SrMessa
 /**
  * @brief Get a Uint16 from a specific position in a message
  *
- * This internal function extracts a Uint16 byte by byte from a given position in the little endian format message. If the Uint16 extends over the size of
+ * This internal function extracts a Uint16 word from a given position in the little endian format message. If the Uint16 extends over the size of
  * the message from the given start position (position + Uint16 byte size > message size), a ::radef_kInternalError fatal error message is thrown.
  *
  * @implementsReq{RASW-157} Endian Definition
@@ -196,7 +198,7 @@ static uint16_t GetUint16FromMessage(const srtyp_SrMessage *const sr_message, co
 /**
  * @brief Get a Uint32 from a specific position in a message
  *
- * This internal function extracts a Uint32 byte by byte from a given position in the little endian format message. If the Uint32 extends over the size of
+ * This internal function extracts a Uint32 word from a given position in the little endian format message. If the Uint32 extends over the size of
  * the message from the given start position (position + Uint32 byte size > message size), a ::radef_kInternalError fatal error message is thrown.
  *
  * @implementsReq{RASW-157} Endian Definition
@@ -208,6 +210,81 @@ static uint16_t GetUint16FromMessage(const srtyp_SrMessage *const sr_message, co
  */
 static uint32_t GetUint32FromMessage(const srtyp_SrMessage *const sr_message, const uint16_t position);
 
+/**
+ * @brief Write a complete message header in the data of a message
+ *
+ * This internal function writes all fields of the 28 byte message header as whole words in little endian format. The message size is checked once for the
+ * complete header. If the header doesn't fit inside the message (::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE > message size), a ::radef_kInternalError fatal error
+ * message is thrown.
+ *
+ * @implementsReq{RASW-157} Endian Definition
+ * @implementsReq{RASW-160} General PDU Message Structure
+ *
+ * @param [in] message_header Pointer to the message header data to write. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [in] message_size Size of the message data [bytes].
+ * @param [inout] message_data Pointer to the message data, where the header must be written. If the pointer is NULL, a ::radef_kInternalError fatal error is
+ * thrown.
+ */
+static void EncodeMessageHeader(const srtyp_SrMessageHeader *const message_header, const uint16_t message_size, uint8_t *const message_data);
+
+/**
+ * @brief Read a complete message header from a message
+ *
+ * This internal function reads all fields of the 28 byte message header as whole words from the little endian format message. The message size is checked
+ * once for the complete header. If the header extends over the size of the message (::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE > message size), a
+ * ::radef_kInternalError fatal error message is thrown.
+ *
+ * @implementsReq{RASW-157} Endian Definition
+ * @implementsReq{RASW-160} General PDU Message Structure
+ *
+ * @param [in] sr_message Pointer to a message, from where the header must be read. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [out] message_header Pointer to the read message header data. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ */
+static void DecodeMessageHeader(const srtyp_SrMessage *const sr_message, srtyp_SrMessageHeader *const message_header);
+
+/**
+ * @brief Check a view of a data or retransmitted data message
+ *
+ * This internal function checks, that the view points to a data or retransmitted data message with a valid message size, which fits into the memory of the
+ * view. If the check fails, a ::radef_kInvalidParameter fatal error is thrown.
+ *
+ * @implementsReq{RASW-191} Data Message Structure
+ * @implementsReq{RASW-196} Retransmitted Data Message Structure
+ *
+ * @param [in] sr_message Pointer to the message view. If the pointer or the message pointer of the view is NULL, a ::radef_kInvalidParameter fatal error is
+ * thrown.
+ */
+static void AssertDataMessageView(const srtyp_SrMessageView *const sr_message);
+
+/**
+ * @brief Set the updated header data in a message to send
+ *
+ * This internal function checks the message size of a message to send and writes the confirmed sequence number and the time stamp of the header update into
+ * the message. The safety code is not calculated.
+ *
+ * @implementsReq{RASW-630} Update Message Header Function
+ * @implementsReq{RASW-165} Confirmed Sequence Number
+ * @implementsReq{RASW-166} Time Stamp
+ *
+ * @param [in] message_header_update Message header data to update. The full value range is valid and usable.
+ * @param [inout] sr_message Pointer to the message. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown. The message size must be in the
+ * range ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + safety code length <= value <= ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, otherwise a ::radef_kInvalidParameter
+ * fatal error is thrown.
+ */
+static void SetMessageHeaderUpdateInMessage(const srtyp_SrMessageHeaderUpdate message_header_update, srtyp_SrMessage *const sr_message);
+
+/**
+ * @brief Set the calculated safety code in a message to send
+ *
+ * This internal function copies the configured length of the calculated MD4 behind the message data.
+ *
+ * @implementsReq{RASW-168} Safety Code
+ *
+ * @param [in] md4 Pointer to the calculated MD4 of the message data.
+ * @param [inout] sr_message Pointer to the message. The message size must be checked with ::SetMessageHeaderUpdateInMessage before.
+ */
+static void SetSafetyCodeInMessage(const srmd4_Md4 *const md4, srtyp_SrMessage *const sr_message);
+
 /**
  * @brief Get the length of the configured safety code
  *
@@ -219,6 +296,39 @@ static uint32_t GetUint32FromMessage(const srtyp_SrMessage *const sr_message, co
  */
 static uint16_t GetSafetyCodeLength(void);
 
+/**
+ * @brief Get the number of application messages packed into a data message
+ *
+ * This internal function walks through all application messages of a data or retransmitted data message. Every application message consists of its message
+ * length and its payload data. The packing is valid, if the payload size of every application message is in the range ::srcty_kMinSrLayerPayloadDataSize <=
+ * value <= ::RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE and the application messages fill the message exactly up to the safety code.
+ *
+ * @implementsReq{RASW-191} Data Message Structure
+ * @implementsReq{RASW-193} Size of Message Data
+ *
+ * @param [in] sr_message Pointer to a data or retransmitted data message. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown. The message
+ * size must be in the range ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + safety code length <= value <= ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, otherwise a
+ * ::radef_kInternalError fatal error is thrown.
+ * @return uint16_t Number of packed application messages. 0, if the packing of the message is invalid.
+ */
+static uint16_t GetNumberOfPackedPayloads(const srtyp_SrMessage *const sr_message);
+
+/**
+ * @brief Get the payload size of a packed application message in a data message
+ *
+ * This internal function checks, that the message length and the payload data of the application message at the passed position end in front of the safety
+ * code and that the payload size is in the range ::srcty_kMinSrLayerPayloadDataSize <= value <= ::RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE.
+ *
+ * @implementsReq{RASW-191} Data Message Structure
+ * @implementsReq{RASW-193} Size of Message Data
+ *
+ * @param [in] sr_message Pointer to a data or retransmitted data message. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown. The message
+ * size must be in the range ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + safety code length <= value <= ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE.
+ * @param [in] position Start position of the message length of the application message [bytes]. Valid range: ::kMsgPayloadDataSizePosition <= value.
+ * @return uint16_t Payload size of the application message [bytes]. 0, if the application message does not fit into the message.
+ */
+static uint16_t GetPackedPayloadSize(const srtyp_SrMessage *const sr_message, const uint16_t position);
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -235,6 +345,9 @@ static const uint16_t kMinMsgLengthRetrReqResp = 28U;   ///< Minimum message len
 static const uint16_t kMinMsgLengthDiscReq = 32U;       ///< Minimum message length for disconnection request message [byte]
 static const uint16_t kMinMsgLengthHeartbeat = 28U;     ///< Minimum message length for heartbeat message [byte]
 static const uint16_t kMinMsgLengthEmptyDataMsg = 30U;  ///< Minimum message length for an empty data or retransmitted data message [byte]
+static const uint16_t kMaxMsgLengthDataMsg =
+    RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE +
+    RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE;  ///< Maximum message length for a data or retransmitted data message without safety code [byte]
 
 // General Positions
 static const uint16_t kMsgLengthPosition = 0U;                 ///< Start position for message length in PDU message
@@ -271,21 +384,28 @@ static const uint16_t kMsgReasonDisconnectPosition = 30U;  ///< Start position f
 
 void srmsg_Init(const srcty_SafetyCodeType configured_safety_code_type, const srcty_Md4InitValue configured_md4_initial_value) {
   // Input parameter check
-  raas_AssertTrue(!srmsg_initialized, radef_kAlreadyInitialized);
+  raas_AssertTrue(!srmsg_instance->initialized, radef_kAlreadyInitialized);
   raas_AssertU32InRange((uint32_t)configured_safety_code_type, (uint32_t)srcty_kSafetyCodeTypeMin, (uint32_t)(srcty_kSafetyCodeTypeMax)-1U,
                         radef_kInvalidParameter);
 
   // Initialize local variables
-  srmsg_safety_code_type = configured_safety_code_type;
-  srmsg_md4_initial_value = configured_md4_initial_value;
+  srmsg_instance->safety_code_type = configured_safety_code_type;
+  srmsg_instance->md4_initial_value = configured_md4_initial_value;
+
+  srmsg_instance->initialized = true;
+}
+
+void srmsg_SelectInstance(const uint32_t instance_index) {
+  // Input parameter check
+  raas_AssertU32InRange(instance_index, 0U, RADEF_MAX_NUMBER_OF_SR_INSTANCES - 1U, radef_kInvalidParameter);
 
-  srmsg_initialized = true;
+  srmsg_instance = &srmsg_instances[instance_index];
 }
 
 void srmsg_CreateConnReqMessage(const srtyp_SrMessageHeaderCreate message_header, const srtyp_ProtocolVersion protocol_version, const uint16_t n_send_max,
                                 srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertTrue(message_header.confirmed_time_stamp == 0U, radef_kInvalidParameter);  // Confirmed timestamp must be 0
   raas_AssertU16InRange(n_send_max, srcty_kMinNSendMax, RADEF_MAX_N_SEND_MAX, radef_kInvalidParameter);
   for (uint8_t index = 0U; index < SRTYP_PROTOCOL_VERSION_SIZE; ++index) {
@@ -305,7 +425,7 @@ void srmsg_CreateConnReqMessage(const srtyp_SrMessageHeaderCreate message_header
 void srmsg_CreateConnRespMessage(const srtyp_SrMessageHeaderCreate message_header, const srtyp_ProtocolVersion protocol_version, const uint16_t n_send_max,
                                  srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertU16InRange(n_send_max, srcty_kMinNSendMax, RADEF_MAX_N_SEND_MAX, radef_kInvalidParameter);
   for (uint8_t index = 0U; index < SRTYP_PROTOCOL_VERSION_SIZE; ++index) {
     raas_AssertU8InRange(protocol_version.version[index], srcty_kProtocolVersionMinValue, srcty_kProtocolVersionMaxValue, radef_kInvalidParameter);
@@ -324,7 +444,7 @@ void srmsg_CreateConnRespMessage(const srtyp_SrMessageHeaderCreate message_heade
 void srmsg_CreateDataMessage(const srtyp_SrMessageHeaderCreate message_header, const srtyp_SrMessagePayload *const message_payload,
                              srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(message_payload, radef_kInvalidParameter);
   raas_AssertU16InRange(message_payload->payload_size, srcty_kMinSrLayerPayloadDataSize, RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE, radef_kInvalidParameter);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
@@ -341,7 +461,7 @@ void srmsg_CreateDataMessage(const srtyp_SrMessageHeaderCreate message_header, c
 void srmsg_CreateRetrDataMessage(const srtyp_SrMessageHeaderCreate message_header, const srtyp_SrMessagePayload *const message_payload,
                                  srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(message_payload, radef_kInvalidParameter);
   raas_AssertU16InRange(message_payload->payload_size, srcty_kMinSrLayerPayloadDataSize, RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE, radef_kInvalidParameter);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
@@ -355,9 +475,48 @@ void srmsg_CreateRetrDataMessage(const srtyp_SrMessageHeaderCreate message_heade
   SetPayloadDataInMessage(kMsgPayloadDataPosition, message_payload, sr_message);
 }
 
+bool srmsg_AddDataMessagePayload(const srtyp_SrMessagePayloadView *const message_payload, srtyp_SrMessageView *const sr_message) {
+  // Input parameter check
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
+  raas_AssertNotNull(message_payload, radef_kInvalidParameter);
+  raas_AssertNotNull(message_payload->payload, radef_kInvalidParameter);
+  raas_AssertU16InRange(message_payload->payload_size, srcty_kMinSrLayerPayloadDataSize, RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE, radef_kInvalidParameter);
+  AssertDataMessageView(sr_message);
+
+  bool payload_added = false;
+
+  const uint16_t kSafetyCodeLength = GetSafetyCodeLength();
+  const uint16_t kPayloadEndPosition = (uint16_t)(sr_message->message_size - kSafetyCodeLength);
+  const uint16_t kNewMessageSize = (uint16_t)(sr_message->message_size + RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE + message_payload->payload_size);
+  if ((kNewMessageSize <= (kMaxMsgLengthDataMsg + kSafetyCodeLength)) && (kNewMessageSize <= sr_message->buffer_size)) {
+    // Append the application message behind the last one. The safety code is calculated when the message header is updated before sending.
+    raend_StoreUint16(&sr_message->message[kPayloadEndPosition], message_payload->payload_size);
+    const uint16_t kPayloadPosition = (uint16_t)(kPayloadEndPosition + RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE);
+    for (uint16_t index = 0U; index < message_payload->payload_size; ++index) {
+      sr_message->message[kPayloadPosition + index] = message_payload->payload[index];
+    }
+
+    sr_message->message_size = kNewMessageSize;
+    raend_StoreUint16(&sr_message->message[kMsgLengthPosition], kNewMessageSize);
+    payload_added = true;
+  }
+
+  return payload_added;
+}
+
+void srmsg_ConvertDataMessage(const srtyp_SrMessageHeaderCreate message_header, const srtyp_SrMessageType message_type, srtyp_SrMessageView *const sr_message) {
+  // Input parameter check
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue((message_type == srtyp_kSrMessageData) || (message_type == srtyp_kSrMessageRetrData), radef_kInvalidParameter);
+  AssertDataMessageView(sr_message);
+
+  // Only the header is rewritten in place, the message length and the packed application messages stay untouched
+  WriteMessageHeader(sr_message->message_size, (uint16_t)message_type, message_header, sr_message->message);
+}
+
 void srmsg_CreateRetrReqMessage(const srtyp_SrMessageHeaderCreate message_header, srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
 
   // Set message header data
@@ -366,7 +525,7 @@ void srmsg_CreateRetrReqMessage(const srtyp_SrMessageHeaderCreate message_header
 
 void srmsg_CreateRetrRespMessage(const srtyp_SrMessageHeaderCreate message_header, srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
 
   // Set message header data
@@ -375,7 +534,7 @@ void srmsg_CreateRetrRespMessage(const srtyp_SrMessageHeaderCreate message_heade
 
 void srmsg_CreateHeartbeatMessage(const srtyp_SrMessageHeaderCreate message_header, srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
 
   // Set message header data
@@ -385,7 +544,7 @@ void srmsg_CreateHeartbeatMessage(const srtyp_SrMessageHeaderCreate message_head
 void srmsg_CreateDiscReqMessage(const srtyp_SrMessageHeaderCreate message_header, const uint16_t detailed_reason, const sraty_DiscReason reason,
                                 srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertU16InRange((uint16_t)reason, (uint16_t)sraty_kDiscReasonMin, (uint16_t)sraty_kDiscReasonMax - 1U, radef_kInvalidParameter);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
 
@@ -399,33 +558,61 @@ void srmsg_CreateDiscReqMessage(const srtyp_SrMessageHeaderCreate message_header
 
 void srmsg_UpdateMessageHeader(const srtyp_SrMessageHeaderUpdate message_header_update, srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
-  raas_AssertNotNull(sr_message, radef_kInvalidParameter);
-  raas_AssertU16InRange(sr_message->message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + GetSafetyCodeLength(), RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE,
-                        radef_kInvalidParameter);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
 
-  // Set header data in message
-  SetUint32InMessage(kMsgConfirmedSequenceNbrPosition, message_header_update.confirmed_sequence_number, sr_message);
-  SetUint32InMessage(kMsgTimeStampPosition, message_header_update.time_stamp, sr_message);
+  SetMessageHeaderUpdateInMessage(message_header_update, sr_message);
 
   // Calculate md4 with new data if safety code is used
   uint16_t safety_code_length = GetSafetyCodeLength();
   if (safety_code_length > 0U) {
     srmd4_Md4 md4;
     uint16_t message_length_without_safety_code = (uint16_t)(sr_message->message_size - safety_code_length);
-    srmd4_CalculateMd4(srmsg_md4_initial_value, message_length_without_safety_code, sr_message->message, &md4);
+    srmd4_CalculateMd4(srmsg_instance->md4_initial_value, message_length_without_safety_code, sr_message->message, &md4);
+    SetSafetyCodeInMessage(&md4, sr_message);
+  }
+}
 
-    for (uint8_t index = 0U; index < safety_code_length; ++index) {
-      //lint -save -e661 (Out of bounds pointer access is checked by input parameter check)
-      sr_message->message[message_length_without_safety_code + index] = md4.md4[index];
-      //lint -restore
+void srmsg_UpdateMessageHeaderBatch(const uint16_t number_of_messages, const srtyp_SrMessageHeaderUpdate *const message_header_updates,
+                                    srtyp_SrMessage *const sr_messages) {
+  // Input parameter check
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
+  raas_AssertNotNull(message_header_updates, radef_kInvalidParameter);
+  raas_AssertNotNull(sr_messages, radef_kInvalidParameter);
+  raas_AssertTrue(number_of_messages > 0U, radef_kInvalidParameter);
+
+  for (uint32_t message_index = 0U; message_index < number_of_messages; ++message_index) {
+    SetMessageHeaderUpdateInMessage(message_header_updates[message_index], &sr_messages[message_index]);
+  }
+
+  // Calculate md4 with new data if safety code is used
+  const uint16_t safety_code_length = GetSafetyCodeLength();
+  if (safety_code_length > 0U) {
+    srmd4_Md4BatchEntry md4_batch[MD4_BATCH_SIZE];
+    srmd4_Md4 calculated_md4s[MD4_BATCH_SIZE];
+
+    for (uint32_t first_message_index = 0U; first_message_index < number_of_messages; first_message_index += MD4_BATCH_SIZE) {
+      const uint32_t remaining_messages = number_of_messages - first_message_index;
+      const uint16_t batch_size = (uint16_t)((remaining_messages < MD4_BATCH_SIZE) ? remaining_messages : MD4_BATCH_SIZE);
+
+      // Calculate the safety codes of all messages of the batch at once
+      for (uint32_t batch_index = 0U; batch_index < batch_size; ++batch_index) {
+        const srtyp_SrMessage *const kMessage = &sr_messages[first_message_index + batch_index];
+        md4_batch[batch_index].data_size = (uint16_t)(kMessage->message_size - safety_code_length);
+        md4_batch[batch_index].data_buffer = kMessage->message;
+        md4_batch[batch_index].calculated_md4 = &calculated_md4s[batch_index];
+      }
+      srmd4_CalculateMd4Batch(srmsg_instance->md4_initial_value, batch_size, md4_batch);
+
+      for (uint32_t batch_index = 0U; batch_index < batch_size; ++batch_index) {
+        SetSafetyCodeInMessage(&calculated_md4s[batch_index], &sr_messages[first_message_index + batch_index]);
+      }
     }
   }
 }
 
 radef_RaStaReturnCode srmsg_CheckMessage(const srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
   raas_AssertU16InRange(
       sr_message->message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + GetSafetyCodeLength(),
@@ -440,7 +627,7 @@ radef_RaStaReturnCode srmsg_CheckMessage(const srtyp_SrMessage *const sr_message
   if (safety_code_length > 0U) {
     srmd4_Md4 md4;
     uint16_t message_length_without_safety_code = (uint16_t)(sr_message->message_size - safety_code_length);
-    srmd4_CalculateMd4(srmsg_md4_initial_value, message_length_without_safety_code, sr_message->message, &md4);
+    srmd4_CalculateMd4(srmsg_instance->md4_initial_value, message_length_without_safety_code, sr_message->message, &md4);
 
     for (uint8_t index = 0U; index < safety_code_length; ++index) {
       //lint -save -e661 (Out of bounds pointer access is checked by input parameter check)
@@ -470,10 +657,8 @@ radef_RaStaReturnCode srmsg_CheckMessage(const srtyp_SrMessage *const sr_message
       ret = radef_kInvalidMessageSize;
       ok = false;
     } else if ((message_type == srtyp_kSrMessageData) || (message_type == srtyp_kSrMessageRetrData)) {
-      // Extract message payload size
-      const uint16_t kMessagePayloadSize = GetUint16FromMessage(sr_message, kMsgPayloadDataSizePosition);
-      // Check that message payload size is exactly message size - header size - message length size - safety code size
-      if (kMessagePayloadSize != (message_size - (RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE + safety_code_length))) {
+      // Check that the packed application messages fill the message exactly up to the safety code
+      if (GetNumberOfPackedPayloads(sr_message) == 0U) {
         ret = radef_kInvalidMessageSize;
         ok = false;
       }
@@ -502,10 +687,8 @@ radef_RaStaReturnCode srmsg_CheckMessage(const srtyp_SrMessage *const sr_message
         break;
       case srtyp_kSrMessageData:
       case srtyp_kSrMessageRetrData:
-        // Subsequent addition to pass pc lint note 931
-        expected_message_size = kMinMsgLengthEmptyDataMsg;
-        expected_message_size += GetUint16FromMessage(sr_message, kMsgPayloadDataSizePosition);
-        expected_message_size += GetSafetyCodeLength();
+        // Message size is already checked with the packed application messages
+        expected_message_size = message_size;
         break;
         // no coverage start
       default:
@@ -523,26 +706,17 @@ radef_RaStaReturnCode srmsg_CheckMessage(const srtyp_SrMessage *const sr_message
 
 void srmsg_GetMessageHeader(const srtyp_SrMessage *const sr_message, srtyp_SrMessageHeader *const message_header) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
   raas_AssertNotNull(message_header, radef_kInvalidParameter);
 
   // Extract message header data
-  message_header->message_length = GetUint16FromMessage(sr_message, kMsgLengthPosition);
-  //lint -save -e9030 (numeric value from external interface is casted into enum type that has const defined values)
-  message_header->message_type = (srtyp_SrMessageType)GetUint16FromMessage(sr_message, kMsgTypePosition);
-  //lint -restore
-  message_header->receiver_id = GetUint32FromMessage(sr_message, kMsgReceiverPosition);
-  message_header->sender_id = GetUint32FromMessage(sr_message, kMsgSenderPosition);
-  message_header->sequence_number = GetUint32FromMessage(sr_message, kMsgSequenceNbrPosition);
-  message_header->confirmed_sequence_number = GetUint32FromMessage(sr_message, kMsgConfirmedSequenceNbrPosition);
-  message_header->time_stamp = GetUint32FromMessage(sr_message, kMsgTimeStampPosition);
-  message_header->confirmed_time_stamp = GetUint32FromMessage(sr_message, kMsgConfirmedTimeStampPosition);
+  DecodeMessageHeader(sr_message, message_header);
 }
 
 srtyp_SrMessageType srmsg_GetMessageType(const srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
 
   // Extract message type
@@ -553,7 +727,7 @@ srtyp_SrMessageType srmsg_GetMessageType(const srtyp_SrMessage *const sr_message
 
 uint32_t srmsg_GetMessageSequenceNumber(const srtyp_SrMessage *const sr_message) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
 
   // Extract message sequence number
@@ -562,7 +736,7 @@ uint32_t srmsg_GetMessageSequenceNumber(const srtyp_SrMessage *const sr_message)
 
 void srmsg_GetDataMessagePayload(const srtyp_SrMessage *const sr_message, srtyp_SrMessagePayload *const message_payload) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
   raas_AssertNotNull(message_payload, radef_kInvalidParameter);
   //lint -save -e9030 (numeric value from external interface is casted into enum type that has const defined values)
@@ -580,9 +754,54 @@ void srmsg_GetDataMessagePayload(const srtyp_SrMessage *const sr_message, srtyp_
   }
 }
 
+uint16_t srmsg_GetNumberOfDataMessagePayloads(const srtyp_SrMessage *const sr_message) {
+  // Input parameter check
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
+  raas_AssertNotNull(sr_message, radef_kInvalidParameter);
+  raas_AssertU16InRange(sr_message->message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + GetSafetyCodeLength(), RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE,
+                        radef_kInvalidParameter);
+  //lint -save -e9030 (numeric value from external interface is casted into enum type that has const defined values)
+  srtyp_SrMessageType message_type = (srtyp_SrMessageType)GetUint16FromMessage(sr_message, kMsgTypePosition);
+  //lint -restore
+  raas_AssertTrue((message_type == srtyp_kSrMessageData) || (message_type == srtyp_kSrMessageRetrData), radef_kInvalidParameter);
+
+  const uint16_t kNumberOfPayloads = GetNumberOfPackedPayloads(sr_message);
+  raas_AssertTrue(kNumberOfPayloads > 0U, radef_kInvalidParameter);
+
+  return kNumberOfPayloads;
+}
+
+void srmsg_GetDataMessagePayloadView(const srtyp_SrMessage *const sr_message, uint16_t *const payload_offset, srtyp_SrMessagePayloadView *const payload_view) {
+  // Input parameter check
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
+  raas_AssertNotNull(sr_message, radef_kInvalidParameter);
+  raas_AssertNotNull(payload_offset, radef_kInvalidParameter);
+  raas_AssertNotNull(payload_view, radef_kInvalidParameter);
+  raas_AssertU16InRange(sr_message->message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + GetSafetyCodeLength(), RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE,
+                        radef_kInvalidParameter);
+  //lint -save -e9030 (numeric value from external interface is casted into enum type that has const defined values)
+  srtyp_SrMessageType message_type = (srtyp_SrMessageType)GetUint16FromMessage(sr_message, kMsgTypePosition);
+  //lint -restore
+  raas_AssertTrue((message_type == srtyp_kSrMessageData) || (message_type == srtyp_kSrMessageRetrData), radef_kInvalidParameter);
+  raas_AssertTrue(*payload_offset < RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, radef_kInvalidParameter);
+
+  // Only the application message at the offset is checked, so that walking through all packed messages stays linear. An offset behind the last
+  // application message fails this check as well.
+  const uint16_t kPayloadSizePosition = (uint16_t)(kMsgPayloadDataSizePosition + *payload_offset);
+  const uint16_t kPayloadSize = GetPackedPayloadSize(sr_message, kPayloadSizePosition);
+  raas_AssertTrue(kPayloadSize > 0U, radef_kInvalidParameter);
+
+  // Point to message data
+  payload_view->payload_size = kPayloadSize;
+  payload_view->payload = &sr_message->message[kPayloadSizePosition + RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE];
+
+  // Advance to the next application message
+  *payload_offset = (uint16_t)(*payload_offset + RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE + kPayloadSize);
+}
+
 void srmsg_GetConnMessageData(const srtyp_SrMessage *const sr_message, srtyp_ProtocolVersion *const protocol_version, uint16_t *const n_send_max) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
   raas_AssertNotNull(protocol_version, radef_kInvalidParameter);
   raas_AssertNotNull(n_send_max, radef_kInvalidParameter);
@@ -604,7 +823,7 @@ void srmsg_GetConnMessageData(const srtyp_SrMessage *const sr_message, srtyp_Pro
 
 void srmsg_GetDiscMessageData(const srtyp_SrMessage *const sr_message, uint16_t *const detailed_reason, sraty_DiscReason *const reason) {
   // Input parameter check
-  raas_AssertTrue(srmsg_initialized, radef_kNotInitialized);
+  raas_AssertTrue(srmsg_instance->initialized, radef_kNotInitialized);
   raas_AssertNotNull(sr_message, radef_kInvalidParameter);
   raas_AssertNotNull(detailed_reason, radef_kInvalidParameter);
   raas_AssertNotNull(reason, radef_kInvalidParameter);
@@ -655,20 +874,7 @@ static void SetUint16InMessage(const uint16_t position, const uint16_t data, srt
   raas_AssertTrue((position + srcty_kByteCountUint16) <= sr_message->message_size, radef_kInternalError);
 
   // Write variable in message (little endian format)
-  sr_message->message[position + 1U] = (uint8_t)((data >> 8) & 0xFFU);
-  sr_message->message[position] = (uint8_t)(data & 0xFFU);
-}
-
-static void SetUint32InMessage(const uint16_t position, const uint32_t data, srtyp_SrMessage *const sr_message) {
-  // Input parameter check
-  raas_AssertNotNull(sr_message, radef_kInternalError);
-  raas_AssertTrue((position + srcty_kByteCountUint32) <= sr_message->message_size, radef_kInternalError);
-
-  // Write variable in message (little endian format)
-  sr_message->message[position + 3U] = (uint8_t)((data >> 24) & 0xFFU);
-  sr_message->message[position + 2U] = (uint8_t)((data >> 16) & 0xFFU);
-  sr_message->message[position + 1U] = (uint8_t)((data >> 8) & 0xFFU);
-  sr_message->message[position] = (uint8_t)(data & 0xFFU);
+  raend_StoreUint16(&sr_message->message[position], data);
 }
 
 static void SetUint64InMessage(const uint16_t position, const uint64_t data, srtyp_SrMessage *const sr_message) {
@@ -677,35 +883,43 @@ static void SetUint64InMessage(const uint16_t position, const uint64_t data, srt
   raas_AssertTrue((position + srcty_kByteCountUint64) <= sr_message->message_size, radef_kInternalError);
 
   // Write variable in message (little endian format)
-  sr_message->message[position + 7U] = (uint8_t)((data >> 56) & 0xFFU);
-  sr_message->message[position + 6U] = (uint8_t)((data >> 48) & 0xFFU);
-  sr_message->message[position + 5U] = (uint8_t)((data >> 40) & 0xFFU);
-  sr_message->message[position + 4U] = (uint8_t)((data >> 32) & 0xFFU);
-  sr_message->message[position + 3U] = (uint8_t)((data >> 24) & 0xFFU);
-  sr_message->message[position + 2U] = (uint8_t)((data >> 16) & 0xFFU);
-  sr_message->message[position + 1U] = (uint8_t)((data >> 8) & 0xFFU);
-  sr_message->message[position] = (uint8_t)(data & 0xFFU);
+  raend_StoreUint32(&sr_message->message[position], (uint32_t)(data & 0xFFFFFFFFUL));
+  raend_StoreUint32(&sr_message->message[position + srcty_kByteCountUint32], (uint32_t)(data >> 32));
 }
 
 static void SetMessageHeaderInMessage(const uint16_t message_length, const uint16_t message_type, const srtyp_SrMessageHeaderCreate message_header,
                                       srtyp_SrMessage *const sr_message) {
   // Input parameter check
   raas_AssertNotNull(sr_message, radef_kInternalError);
-  raas_AssertU16InRange(message_length, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + GetSafetyCodeLength(), RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
-  raas_AssertU32InRange((uint32_t)message_type, (uint32_t)srtyp_kSrMessageMin, (uint32_t)(srtyp_kSrMessageMax)-1U, radef_kInternalError);
 
   // Set message size
   sr_message->message_size = message_length;
 
   // Write message header in message
-  SetUint16InMessage(kMsgLengthPosition, message_length, sr_message);
-  SetUint16InMessage(kMsgTypePosition, message_type, sr_message);
-  SetUint32InMessage(kMsgReceiverPosition, message_header.receiver_id, sr_message);
-  SetUint32InMessage(kMsgSenderPosition, message_header.sender_id, sr_message);
-  SetUint32InMessage(kMsgSequenceNbrPosition, message_header.sequence_number, sr_message);
-  SetUint32InMessage(kMsgConfirmedSequenceNbrPosition, 0U, sr_message);  // Set to 0 for initialization, must be updated by core class before sending
-  SetUint32InMessage(kMsgTimeStampPosition, 0U, sr_message);             // Set to 0 for initialization, must be updated by core class before sending
-  SetUint32InMessage(kMsgConfirmedTimeStampPosition, message_header.confirmed_time_stamp, sr_message);
+  WriteMessageHeader(message_length, message_type, message_header, sr_message->message);
+}
+
+static void WriteMessageHeader(const uint16_t message_length, const uint16_t message_type, const srtyp_SrMessageHeaderCreate message_header,
+                               uint8_t *const message_data) {
+  // Input parameter check
+  raas_AssertNotNull(message_data, radef_kInternalError);
+  raas_AssertU16InRange(message_length, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + GetSafetyCodeLength(), RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
+  raas_AssertU32InRange((uint32_t)message_type, (uint32_t)srtyp_kSrMessageMin, (uint32_t)(srtyp_kSrMessageMax)-1U, radef_kInternalError);
+
+  // Write message header in message
+  //lint -save -e9030 (message type is checked to be inside the enum range above)
+  const srtyp_SrMessageHeader kMessageHeader = {
+      message_length,
+      (srtyp_SrMessageType)message_type,
+      message_header.receiver_id,
+      message_header.sender_id,
+      message_header.sequence_number,
+      0U,  // Confirmed sequence number set to 0 for initialization, must be updated by core class before sending
+      0U,  // Time stamp set to 0 for initialization, must be updated by core class before sending
+      message_header.confirmed_time_stamp,
+  };
+  //lint -restore
+  EncodeMessageHeader(&kMessageHeader, message_length, message_data);
 }
 
 static void SetProtocolVersionInMessage(const srtyp_ProtocolVersion protocol_version, srtyp_SrMessage *const sr_message) {
@@ -740,12 +954,7 @@ static uint16_t GetUint16FromMessage(const srtyp_SrMessage *const sr_message, co
   raas_AssertTrue((position + srcty_kByteCountUint16) <= sr_message->message_size, radef_kInternalError);
 
   // Get variable from message (little endian format)
-  uint16_t data = 0U;
-  for (uint16_t index = 0U; index < srcty_kByteCountUint16; ++index) {
-    data += (uint16_t)sr_message->message[position + index] << (index * 8U);
-  }
-
-  return data;
+  return raend_LoadUint16(&sr_message->message[position]);
 }
 
 static uint32_t GetUint32FromMessage(const srtyp_SrMessage *const sr_message, const uint16_t position) {
@@ -754,18 +963,86 @@ static uint32_t GetUint32FromMessage(const srtyp_SrMessage *const sr_message, co
   raas_AssertTrue((position + srcty_kByteCountUint32) <= sr_message->message_size, radef_kInternalError);
 
   // Get variable from message (little endian format)
-  uint32_t data = 0U;
-  for (uint16_t index = 0U; index < srcty_kByteCountUint32; ++index) {
-    data += (uint32_t)sr_message->message[position + index] << (index * 8U);
-  }
+  return raend_LoadUint32(&sr_message->message[position]);
+}
 
-  return data;
+static void EncodeMessageHeader(const srtyp_SrMessageHeader *const message_header, const uint16_t message_size, uint8_t *const message_data) {
+  // Input parameter check
+  raas_AssertNotNull(message_header, radef_kInternalError);
+  raas_AssertNotNull(message_data, radef_kInternalError);
+  raas_AssertTrue(RADEF_SR_LAYER_MESSAGE_HEADER_SIZE <= message_size, radef_kInternalError);
+
+  // Write message header in message (little endian format)
+  raend_StoreUint16(&message_data[kMsgLengthPosition], message_header->message_length);
+  raend_StoreUint16(&message_data[kMsgTypePosition], (uint16_t)message_header->message_type);
+  raend_StoreUint32(&message_data[kMsgReceiverPosition], message_header->receiver_id);
+  raend_StoreUint32(&message_data[kMsgSenderPosition], message_header->sender_id);
+  raend_StoreUint32(&message_data[kMsgSequenceNbrPosition], message_header->sequence_number);
+  raend_StoreUint32(&message_data[kMsgConfirmedSequenceNbrPosition], message_header->confirmed_sequence_number);
+  raend_StoreUint32(&message_data[kMsgTimeStampPosition], message_header->time_stamp);
+  raend_StoreUint32(&message_data[kMsgConfirmedTimeStampPosition], message_header->confirmed_time_stamp);
+}
+
+static void DecodeMessageHeader(const srtyp_SrMessage *const sr_message, srtyp_SrMessageHeader *const message_header) {
+  // Input parameter check
+  raas_AssertNotNull(sr_message, radef_kInternalError);
+  raas_AssertNotNull(message_header, radef_kInternalError);
+  raas_AssertTrue(RADEF_SR_LAYER_MESSAGE_HEADER_SIZE <= sr_message->message_size, radef_kInternalError);
+
+  // Read message header from message (little endian format)
+  message_header->message_length = raend_LoadUint16(&sr_message->message[kMsgLengthPosition]);
+  //lint -save -e9030 (numeric value from external interface is casted into enum type that has const defined values)
+  message_header->message_type = (srtyp_SrMessageType)raend_LoadUint16(&sr_message->message[kMsgTypePosition]);
+  //lint -restore
+  message_header->receiver_id = raend_LoadUint32(&sr_message->message[kMsgReceiverPosition]);
+  message_header->sender_id = raend_LoadUint32(&sr_message->message[kMsgSenderPosition]);
+  message_header->sequence_number = raend_LoadUint32(&sr_message->message[kMsgSequenceNbrPosition]);
+  message_header->confirmed_sequence_number = raend_LoadUint32(&sr_message->message[kMsgConfirmedSequenceNbrPosition]);
+  message_header->time_stamp = raend_LoadUint32(&sr_message->message[kMsgTimeStampPosition]);
+  message_header->confirmed_time_stamp = raend_LoadUint32(&sr_message->message[kMsgConfirmedTimeStampPosition]);
+}
+
+static void AssertDataMessageView(const srtyp_SrMessageView *const sr_message) {
+  // Input parameter check
+  raas_AssertNotNull(sr_message, radef_kInvalidParameter);
+  raas_AssertNotNull(sr_message->message, radef_kInvalidParameter);
+
+  const uint16_t kSafetyCodeLength = GetSafetyCodeLength();
+  raas_AssertU16InRange(sr_message->message_size, kMinMsgLengthEmptyDataMsg + kSafetyCodeLength, kMaxMsgLengthDataMsg + kSafetyCodeLength,
+                        radef_kInvalidParameter);
+  raas_AssertU16InRange(sr_message->buffer_size, sr_message->message_size, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, radef_kInvalidParameter);
+  //lint -save -e9030 (numeric value from external interface is casted into enum type that has const defined values)
+  const srtyp_SrMessageType kMessageType = (srtyp_SrMessageType)raend_LoadUint16(&sr_message->message[kMsgTypePosition]);
+  //lint -restore
+  raas_AssertTrue((kMessageType == srtyp_kSrMessageData) || (kMessageType == srtyp_kSrMessageRetrData), radef_kInvalidParameter);
+}
+
+static void SetMessageHeaderUpdateInMessage(const srtyp_SrMessageHeaderUpdate message_header_update, srtyp_SrMessage *const sr_message) {
+  // Input parameter check
+  raas_AssertNotNull(sr_message, radef_kInvalidParameter);
+  raas_AssertU16InRange(sr_message->message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + GetSafetyCodeLength(), RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE,
+                        radef_kInvalidParameter);
+
+  // Set header data in message, the message size check above covers the complete header
+  raend_StoreUint32(&sr_message->message[kMsgConfirmedSequenceNbrPosition], message_header_update.confirmed_sequence_number);
+  raend_StoreUint32(&sr_message->message[kMsgTimeStampPosition], message_header_update.time_stamp);
+}
+
+static void SetSafetyCodeInMessage(const srmd4_Md4 *const md4, srtyp_SrMessage *const sr_message) {
+  const uint16_t safety_code_length = GetSafetyCodeLength();
+  const uint16_t message_length_without_safety_code = (uint16_t)(sr_message->message_size - safety_code_length);
+
+  for (uint8_t index = 0U; index < safety_code_length; ++index) {
+    //lint -save -e661 (Out of bounds pointer access is checked by input parameter check)
+    sr_message->message[message_length_without_safety_code + index] = md4->md4[index];
+    //lint -restore
+  }
 }
 
 static uint16_t GetSafetyCodeLength() {
   uint16_t safety_code_length = 0U;
 
-  switch (srmsg_safety_code_type) {
+  switch (srmsg_instance->safety_code_type) {
     case srcty_kSafetyCodeTypeNone:
       safety_code_length = kSafetyCodeNoneLength;
       break;
@@ -784,3 +1061,56 @@ static uint16_t GetSafetyCodeLength() {
 
   return safety_code_length;
 }
+
+static uint16_t GetNumberOfPackedPayloads(const srtyp_SrMessage *const sr_message) {
+  // Input parameter check
+  raas_AssertNotNull(sr_message, radef_kInternalError);
+  raas_AssertU16InRange(sr_message->message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + GetSafetyCodeLength(), RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE,
+                        radef_kInternalError);
+
+  const uint16_t kPayloadEndPosition = (uint16_t)(sr_message->message_size - GetSafetyCodeLength());
+  uint16_t number_of_payloads = 0U;
+  uint16_t position = kMsgPayloadDataSizePosition;
+  bool packing_valid = true;
+
+  while (packing_valid && (position < kPayloadEndPosition)) {
+    const uint16_t kPayloadSize = GetPackedPayloadSize(sr_message, position);
+
+    if (kPayloadSize == 0U) {
+      packing_valid = false;
+    } else {
+      position = (uint16_t)(position + RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE + kPayloadSize);
+      ++number_of_payloads;
+    }
+  }
+
+  if (!packing_valid) {
+    number_of_payloads = 0U;
+  }
+
+  return number_of_payloads;
+}
+
+static uint16_t GetPackedPayloadSize(const srtyp_SrMessage *const sr_message, const uint16_t position) {
+  // Input parameter check
+  raas_AssertNotNull(sr_message, radef_kInternalError);
+  raas_AssertU16InRange(sr_message->message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE + GetSafetyCodeLength(), RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE,
+                        radef_kInternalError);
+  raas_AssertTrue(position >= kMsgPayloadDataSizePosition, radef_kInternalError);
+
+  const uint16_t kPayloadEndPosition = (uint16_t)(sr_message->message_size - GetSafetyCodeLength());
+  uint16_t payload_size = 0U;
+
+  // The message length of the application message must not be cut
+  if ((position < kPayloadEndPosition) && ((uint16_t)(kPayloadEndPosition - position) >= RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE)) {
+    const uint16_t kPayloadPosition = (uint16_t)(position + RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE);
+    payload_size = raend_LoadUint16(&sr_message->message[position]);
+
+    if ((payload_size < srcty_kMinSrLayerPayloadDataSize) || (payload_size > RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE) ||
+        (payload_size > (uint16_t)(kPayloadEndPosition - kPayloadPosition))) {
+      payload_size = 0U;
+    }
+  }
+
+  return payload_size;
+}
@@ -50,6 +50,17 @@
 // Global Type Definitions
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Struct for the data of a SafRetL messages instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;                       ///< Initialization state of the module. true, if the module is initialized.
+  srcty_SafetyCodeType safety_code_type;  ///< Configured safety code type.
+  srcty_Md4InitValue md4_initial_value;   ///< Configured MD4 initial code value.
+} srmsg_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -76,6 +87,16 @@ extern "C" {
  */
 void srmsg_Init(const srcty_SafetyCodeType configured_safety_code_type, const srcty_Md4InitValue configured_md4_initial_value);
 
+/**
+ * @brief Select the SafRetL messages instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the SafRetL messages functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_SR_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void srmsg_SelectInstance(const uint32_t instance_index);
+
 /**
  * @brief Create a new SafRetL connection request message.
  *
@@ -181,6 +202,53 @@ void srmsg_CreateDataMessage(const srtyp_SrMessageHeaderCreate message_header, c
 void srmsg_CreateRetrDataMessage(const srtyp_SrMessageHeaderCreate message_header, const srtyp_SrMessagePayload *const message_payload,
                                  srtyp_SrMessage *const sr_message);
 
+/**
+ * @brief Pack an additional application message into a SafRetL data or retransmitted data message.
+ *
+ * This function appends the passed application message (message length and payload data) behind the last application message of a data or retransmitted
+ * data message and updates the message length. The message is modified in place in the memory of the view. If the extended message would exceed the maximum
+ * message size or the memory of the view, the message is not changed and false is returned. The safety code is not calculated, this is done by
+ * ::srmsg_UpdateMessageHeader before sending.
+ *
+ * @pre The messages module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @implementsReq{RASW-191} Data Message Structure
+ * @implementsReq{RASW-192} Message Length
+ * @implementsReq{RASW-193} Size of Message Data
+ *
+ * @param [in] message_payload Pointer to a view of the application message payload. If the pointer or the payload pointer of the view is NULL, a
+ * ::radef_kInvalidParameter fatal error is thrown. For the message payload the full value range is valid and usable, the message payload size has a valid
+ * range of ::srcty_kMinSrLayerPayloadDataSize <= value <= ::RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE.
+ * @param [inout] sr_message Pointer to a view of a data or retransmitted data message created with ::srmsg_CreateDataMessage or ::srmsg_CreateRetrDataMessage.
+ * If the pointer or the message pointer of the view is NULL, the message is an other message type or the message size does not fit into the memory of the
+ * view, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return true, if the application message is packed into the message.
+ * @return false, if the application message doesn't fit into the message.
+ */
+bool srmsg_AddDataMessagePayload(const srtyp_SrMessagePayloadView *const message_payload, srtyp_SrMessageView *const sr_message);
+
+/**
+ * @brief Convert a stored SafRetL data or retransmitted data message into a data or retransmitted data message with a new header.
+ *
+ * This function overwrites the message type and the header data (::srtyp_SrMessageHeaderCreate containing sender ID, receiver ID, sequence number and
+ * confirmed time stamp) of an existing data or retransmitted data message. The message length and all packed application messages are kept, so the payload is
+ * not copied, the header is overwritten in place in the memory of the view. The confirmed sequence number and the time stamp are reset and the safety code is
+ * not calculated, this is done by ::srmsg_UpdateMessageHeader before sending.
+ *
+ * @pre The messages module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @implementsReq{RASW-191} Data Message Structure
+ * @implementsReq{RASW-196} Retransmitted Data Message Structure
+ *
+ * @param [in] message_header Message header data to set in the message. For all sub-parameters of the header, the full value range is valid and usable.
+ * @param [in] message_type New message type. Valid values: ::srtyp_kSrMessageData and ::srtyp_kSrMessageRetrData, a ::radef_kInvalidParameter fatal error is
+ * thrown otherwise.
+ * @param [inout] sr_message Pointer to a view of a data or retransmitted data message created with ::srmsg_CreateDataMessage or ::srmsg_CreateRetrDataMessage.
+ * If the pointer or the message pointer of the view is NULL, the message is an other message type or the message size does not fit into the memory of the
+ * view, a ::radef_kInvalidParameter fatal error is thrown.
+ */
+void srmsg_ConvertDataMessage(const srtyp_SrMessageHeaderCreate message_header, const srtyp_SrMessageType message_type, srtyp_SrMessageView *const sr_message);
+
 /**
  * @brief Create a new SafRetL retransmission request message.
  *
@@ -283,6 +351,31 @@ void srmsg_CreateDiscReqMessage(const srtyp_SrMessageHeaderCreate message_header
  */
 void srmsg_UpdateMessageHeader(const srtyp_SrMessageHeaderUpdate message_header_update, srtyp_SrMessage *const sr_message);
 
+/**
+ * @brief Update the headers of several SafRetL messages and calculate their safety codes at once to prepare the messages for sending.
+ *
+ * This function updates the header data of every provided SafRetL message like ::srmsg_UpdateMessageHeader, but calculates the safety codes of the messages
+ * together with ::srmd4_CalculateMd4Batch. The result of every message is identical to the result of ::srmsg_UpdateMessageHeader for the same message and
+ * header update. All messages are checked as described in ::srmsg_UpdateMessageHeader, before any safety code is calculated.
+ *
+ * @pre The messages module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @implementsReq{RASW-630} Update Message Header Function
+ * @implementsReq{RASW-164} Sequence Number
+ * @implementsReq{RASW-165} Confirmed Sequence Number
+ * @implementsReq{RASW-166} Time Stamp
+ * @implementsReq{RASW-168} Safety Code
+ *
+ * @param [in] number_of_messages Number of messages in the sr_messages array. Valid range: 1 <= value. For 0, a ::radef_kInvalidParameter fatal error is
+ * thrown.
+ * @param [in] message_header_updates Pointer to array of number_of_messages header updates, one per message. If the pointer is NULL, a
+ * ::radef_kInvalidParameter fatal error is thrown. For all sub-parameters of the ::srtyp_SrMessageHeaderUpdate structure, the full value range is valid and
+ * usable.
+ * @param [inout] sr_messages Pointer to array of number_of_messages messages. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ */
+void srmsg_UpdateMessageHeaderBatch(const uint16_t number_of_messages, const srtyp_SrMessageHeaderUpdate *const message_header_updates,
+                                    srtyp_SrMessage *const sr_messages);
+
 /**
  * @brief Check MD4, message type and message size of a SafRetL PDU message.
  *
@@ -290,8 +383,10 @@ void srmsg_UpdateMessageHeader(const srtyp_SrMessageHeaderUpdate message_header_
  * - Safety code (if it is configured). The Safety code inside the message must be identical to the calculated one.
  * - Message type. The message type must match to one of the known ::srtyp_SrMessageType enum entries.
  * - Message size. The message size must match the expected size following the set message type.
- * - In case of Data/RetrData: Message payload data must match related to the passed message size (message payload size = message size -
- * ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE - ::RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE - safety code length).
+ * - In case of Data/RetrData: The packed application messages must match related to the passed message size. Every application message consists of its
+ * message length (::RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE) and its payload data with a payload size in the range of
+ * ::srcty_kMinSrLayerPayloadDataSize <= value <= ::RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE. The application messages must fill the message exactly from
+ * ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE up to the safety code.
  * .
  * All tests must be successful for a message to be valid.
  *
@@ -366,7 +461,8 @@ uint32_t srmsg_GetMessageSequenceNumber(const srtyp_SrMessage *const sr_message)
  * @brief Get the payload of a SafRetL data or retransmitted data message.
  *
  * This function extracts the message payload size & data from a passed ::srtyp_kSrMessageData or ::srtyp_kSrMessageRetrData message. If the message contains
- * more data then allowed (::RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE), a ::radef_kInvalidParameter fatal error is thrown.
+ * more data then allowed (::RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE), a ::radef_kInvalidParameter fatal error is thrown. If several application messages are
+ * packed into the message, the first one is extracted.
  *
  * @pre The messages module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
@@ -382,6 +478,46 @@ uint32_t srmsg_GetMessageSequenceNumber(const srtyp_SrMessage *const sr_message)
  */
 void srmsg_GetDataMessagePayload(const srtyp_SrMessage *const sr_message, srtyp_SrMessagePayload *const message_payload);
 
+/**
+ * @brief Get the number of application messages packed into a SafRetL data or retransmitted data message.
+ *
+ * @pre The messages module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @implementsReq{RASW-191} Data Message Structure
+ * @implementsReq{RASW-193} Size of Message Data
+ *
+ * @param [in] sr_message Pointer to a memory block containing a message. If the pointer is NULL, the message is an other message type then
+ * ::srtyp_kSrMessageData or ::srtyp_kSrMessageRetrData or the packing of the application messages is invalid (see ::srmsg_CheckMessage), a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ * @return uint16_t Number of packed application messages. Valid range: 1 <= value.
+ */
+uint16_t srmsg_GetNumberOfDataMessagePayloads(const srtyp_SrMessage *const sr_message);
+
+/**
+ * @brief Get a read-only view of the payload of an application message packed into a SafRetL data or retransmitted data message.
+ *
+ * Instead of copying the payload like ::srmsg_GetDataMessagePayload, this function returns the payload size and a pointer to the payload of the application
+ * message at the passed offset inside the passed message. The offset is then advanced to the next application message, so that the caller walks through all
+ * packed application messages by keeping the offset, starting with 0 and calling this function ::srmsg_GetNumberOfDataMessagePayloads times. Only the
+ * application message at the offset is checked, the packing of the whole message is checked by ::srmsg_GetNumberOfDataMessagePayloads. The view is only
+ * valid as long as the message is not modified.
+ *
+ * @pre The messages module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @implementsReq{RASW-626} Get Data Message Payload Function
+ * @implementsReq{RASW-193} Size of Message Data
+ * @implementsReq{RASW-194} Data Message
+ *
+ * @param [in] sr_message Pointer to a memory block containing a message. If the pointer is NULL or the message is an other message type then
+ * ::srtyp_kSrMessageData or ::srtyp_kSrMessageRetrData, a ::radef_kInvalidParameter fatal error is thrown.
+ * @param [inout] payload_offset Pointer to the offset of the application message in the message data [bytes], 0 for the first application message. It is
+ * advanced to the next application message. If the pointer is NULL or no valid application message starts at the offset, a ::radef_kInvalidParameter fatal
+ * error is thrown.
+ * @param [out] payload_view Pointer to the payload view, which is set to the payload inside the passed message. If the pointer is NULL, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void srmsg_GetDataMessagePayloadView(const srtyp_SrMessage *const sr_message, uint16_t *const payload_offset, srtyp_SrMessagePayloadView *const payload_view);
+
 /**
  * @brief Get the data of a SafRetL connection request or connection response message.
  *
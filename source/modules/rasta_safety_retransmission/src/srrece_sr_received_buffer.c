@@ -24,54 +24,40 @@
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasta_common/radef_rasta_definitions.h"
 #include "rasta_common/ralog_rasta_logger.h"
+#include "rasta_common/raslb_rasta_slab.h"
 #include "rasta_common/rasys_rasta_system_adapter.h"
 #include "rasta_safety_retransmission/srcty_sr_config_types.h"
 #include "rasta_safety_retransmission/srnot_sr_notifications.h"
-#include "srtyp_sr_types.h"  // NOLINT(build/include_subdir)
+#include "srins_sr_instances.h"          // NOLINT(build/include_subdir)
+#include "srmem_sr_connection_memory.h"  // NOLINT(build/include_subdir)
+#include "srtyp_sr_types.h"              // NOLINT(build/include_subdir)
 
 // -----------------------------------------------------------------------------
 // Local Macro Definitions
 // -----------------------------------------------------------------------------
 
+#if ((RADEF_RECEIVED_BUFFER_SIZE & (RADEF_RECEIVED_BUFFER_SIZE - 1U)) != 0U) || (RADEF_RECEIVED_BUFFER_SIZE < RADEF_MAX_N_SEND_MAX) || \
+    (RADEF_RECEIVED_BUFFER_SIZE > 32768U)
+#error "RADEF_RECEIVED_BUFFER_SIZE must be a power of two, at least RADEF_MAX_N_SEND_MAX and at most 32768"
+#endif
+
 // -----------------------------------------------------------------------------
 // Local Type Definitions
 // -----------------------------------------------------------------------------
 
-/**
- * @brief Struct for SafRetL received messages payload buffer.
- */
-typedef struct {
-  uint16_t read_idx;       ///< buffer read index (next message to read)
-  uint16_t write_idx;      ///< buffer write index (next message to write)
-  uint16_t used_elements;  ///< current amount of used elements in the buffer
-  srtyp_SrMessagePayload
-      buffer[RADEF_MAX_N_SEND_MAX];  ///< buffer with the payload of correctly received messages, waiting for the read from the application layer
-} SrReceivedBuffer;
-
 // -----------------------------------------------------------------------------
 // Local Variable Definitions
 // -----------------------------------------------------------------------------
 
 /**
- * @brief Initialization state of the module.
- * true, if the module is initialized.
- */
-PRIVATE bool srrece_initialized = false;
-
-/**
- * @brief Number of configured RaSTA connections.
- */
-PRIVATE uint32_t srrece_number_of_connections = 0U;
-
-/**
- * @brief Configured receive buffer size [messages].
+ * @brief Data of all SafRetL received buffer instances.
  */
-PRIVATE uint16_t srrece_n_send_max = 0U;
+PRIVATE srrece_InstanceData srrece_instances[RADEF_MAX_NUMBER_OF_SR_INSTANCES];
 
 /**
- * @brief Received buffers for all RaSTA connections.
+ * @brief Data of the selected SafRetL received buffer instance.
  */
-PRIVATE SrReceivedBuffer srrece_received_buffers[RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS];
+PRIVATE RADEF_THREAD_LOCAL srrece_InstanceData* srrece_instance = &srrece_instances[0];
 
 // -----------------------------------------------------------------------------
 // Local Function Prototypes
@@ -84,8 +70,8 @@ PRIVATE SrReceivedBuffer srrece_received_buffers[RADEF_MAX_NUMBER_OF_RASTA_CONNE
 /**
  * @brief Increment a received buffer index by a increment value and handle overflow.
  *
- * This internal function increments a passed buffer index by a specified increment and handles a possible overflow by exceeding the maximum buffer size
- * ::srrece_n_send_max. In case of an overflow, the index is set to 0.
+ * This internal function increments a passed buffer index by a specified increment and handles a possible overflow by exceeding the buffer size
+ * ::RADEF_RECEIVED_BUFFER_SIZE. Since the buffer size is a power of two, the overflow is handled by masking the index.
  *
  * @implementsReq{RASW-608} Add to Buffer Function
  * @implementsReq{RASW-613} Read from Buffer Function
@@ -95,13 +81,26 @@ PRIVATE SrReceivedBuffer srrece_received_buffers[RADEF_MAX_NUMBER_OF_RASTA_CONNE
  */
 static void IncrementReceivedBufferIndexAndHandleOverflow(uint16_t* const bufferIndex, const uint16_t increment);
 
+/**
+ * @brief Remove the oldest message payload from the received buffer.
+ *
+ * This internal function frees the slab chunk of the oldest message payload in the received buffer of a connection, resets the buffer element and updates
+ * the read index and the used entries. The buffer must not be empty, otherwise a ::radef_kInternalError fatal error is thrown.
+ *
+ * @implementsReq{RASW-613} Read from Buffer Function
+ *
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ */
+static void RemoveOldestPayload(const uint32_t connection_id);
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
 // Local Constant Definitions
 // -----------------------------------------------------------------------------
 
-static const uint16_t kIndexIncrement = 1U;  ///< Increment value for received buffer indexes
+static const uint16_t kIndexIncrement = 1U;                                ///< Increment value for received buffer indexes
+static const uint16_t kIndexMask = (uint16_t)(RADEF_RECEIVED_BUFFER_SIZE - 1U);  ///< Mask for received buffer indexes
 
 // -----------------------------------------------------------------------------
 // Global Constant Definitions
@@ -113,81 +112,155 @@ static const uint16_t kIndexIncrement = 1U;  ///< Increment value for received b
 
 void srrece_Init(const uint32_t configured_connections, const uint16_t configured_n_send_max) {
   // Input parameter check
-  raas_AssertTrue(!srrece_initialized, radef_kAlreadyInitialized);
+  raas_AssertTrue(!srrece_instance->initialized, radef_kAlreadyInitialized);
   raas_AssertU32InRange(configured_connections, srcty_kMinNumberOfRaStaConnections, RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, radef_kInvalidParameter);
   raas_AssertU16InRange(configured_n_send_max, srcty_kMinNSendMax, RADEF_MAX_N_SEND_MAX, radef_kInvalidParameter);
 
-  srrece_number_of_connections = configured_connections;
-  srrece_n_send_max = configured_n_send_max;
+  srrece_instance->number_of_connections = configured_connections;
+  srrece_instance->n_send_max = configured_n_send_max;
+  srrece_instance->received_buffers = (srrece_ReceivedBuffer*)srmem_Allocate(configured_connections * (uint32_t)sizeof(srrece_ReceivedBuffer));
+
+  // Mark all buffer elements as empty, so that no slab chunk is freed by the initialization of the buffers
+  for (uint32_t connection_index = 0U; connection_index < srrece_instance->number_of_connections; ++connection_index) {
+    for (uint16_t index = 0U; index < RADEF_RECEIVED_BUFFER_SIZE; ++index) {
+      srrece_instance->received_buffers[connection_index].buffer[index].chunk_handle = RASLB_INVALID_CHUNK_HANDLE;
+    }
+  }
 
-  srrece_initialized = true;
+  srrece_instance->initialized = true;
 
   // Init buffers for all configured connections
-  for (uint32_t index = 0U; index < srrece_number_of_connections; ++index) {
+  for (uint32_t index = 0U; index < srrece_instance->number_of_connections; ++index) {
     srrece_InitBuffer(index);
   }
 }
 
+void srrece_SelectInstance(const uint32_t instance_index) {
+  // Input parameter check
+  raas_AssertU32InRange(instance_index, 0U, RADEF_MAX_NUMBER_OF_SR_INSTANCES - 1U, radef_kInvalidParameter);
+
+  srrece_instance = &srrece_instances[instance_index];
+}
+
+uint32_t srrece_GetConnectionMemorySize(const uint32_t configured_connections) {
+  // Input parameter check
+  raas_AssertU32InRange(configured_connections, srcty_kMinNumberOfRaStaConnections, RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, radef_kInvalidParameter);
+
+  return srmem_GetTableAllocationSize(configured_connections, (uint32_t)sizeof(srrece_ReceivedBuffer));
+}
+
 void srrece_InitBuffer(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srrece_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srrece_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srrece_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srrece_instance->number_of_connections, radef_kInvalidParameter);
 
   // Init buffer for specified connection id
-  srrece_received_buffers[connection_id].read_idx = 0U;
-  srrece_received_buffers[connection_id].write_idx = 0U;
-  srrece_received_buffers[connection_id].used_elements = 0U;
+  srrece_instance->received_buffers[connection_id].read_idx = 0U;
+  srrece_instance->received_buffers[connection_id].write_idx = 0U;
+  srrece_instance->received_buffers[connection_id].used_elements = 0U;
+
+  // Free the slab chunk and reset payload size of every element in the buffer of this connection
+  for (uint16_t index = 0U; index < RADEF_RECEIVED_BUFFER_SIZE; ++index) {
+    srrece_ReceivedPayload* const buffer_element = &srrece_instance->received_buffers[connection_id].buffer[index];
 
-  // Reset payload size of every element in the buffer of this connection
-  for (uint16_t index = 0U; index < RADEF_MAX_N_SEND_MAX; ++index) {
-    srrece_received_buffers[connection_id].buffer[index].payload_size = 0U;
+    if (buffer_element->chunk_handle != RASLB_INVALID_CHUNK_HANDLE) {
+      raslb_FreeChunk(buffer_element->chunk_handle);
+      buffer_element->chunk_handle = RASLB_INVALID_CHUNK_HANDLE;
+    }
+    buffer_element->payload_size = 0U;
   }
 }
 
-void srrece_AddToBuffer(const uint32_t connection_id, const srtyp_SrMessagePayload* const message_payload) {
+void srrece_AddToBuffer(const uint32_t connection_id, const srtyp_SrMessagePayloadView* const message_payload) {
   // Input parameter check
-  raas_AssertTrue(srrece_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srrece_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srrece_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srrece_instance->number_of_connections, radef_kInvalidParameter);
   raas_AssertNotNull(message_payload, radef_kInvalidParameter);
+  raas_AssertNotNull(message_payload->payload, radef_kInvalidParameter);
   raas_AssertU16InRange(message_payload->payload_size, srcty_kMinSrLayerPayloadDataSize, RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE, radef_kInvalidParameter);
 
-  raas_AssertTrue(srrece_received_buffers[connection_id].used_elements < srrece_n_send_max, radef_kReceiveBufferFull);
+  raas_AssertTrue(srrece_instance->received_buffers[connection_id].used_elements < srrece_instance->n_send_max, radef_kReceiveBufferFull);
 
   // Add message to buffer
-  srtyp_SrMessagePayload* const buffer_element = &srrece_received_buffers[connection_id].buffer[srrece_received_buffers[connection_id].write_idx];
+  srrece_ReceivedPayload* const buffer_element =
+      &srrece_instance->received_buffers[connection_id].buffer[srrece_instance->received_buffers[connection_id].write_idx];
+  raas_AssertTrue(raslb_AllocateChunk(message_payload->payload_size, &buffer_element->chunk_handle), radef_kReceiveBufferFull);
 
+  uint8_t* const chunk_data = raslb_GetChunkData(buffer_element->chunk_handle);
   buffer_element->payload_size = message_payload->payload_size;
   for (uint16_t index = 0U; index < message_payload->payload_size; ++index) {
-    buffer_element->payload[index] = message_payload->payload[index];
+    chunk_data[index] = message_payload->payload[index];
   }
 
-  ++srrece_received_buffers[connection_id].used_elements;
-  IncrementReceivedBufferIndexAndHandleOverflow(&srrece_received_buffers[connection_id].write_idx, kIndexIncrement);
+  ++srrece_instance->received_buffers[connection_id].used_elements;
+  IncrementReceivedBufferIndexAndHandleOverflow(&srrece_instance->received_buffers[connection_id].write_idx, kIndexIncrement);
 
   // Send notification to application layer
-  srnot_MessageReceivedNotification(connection_id);
+  srnot_MessageReceivedNotification(srins_GetSelectedInstance(), connection_id);
 }
 
 radef_RaStaReturnCode srrece_ReadFromBuffer(const uint32_t connection_id, srtyp_SrMessagePayload* const message_payload) {
   // Input parameter check
-  raas_AssertTrue(srrece_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srrece_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srrece_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srrece_instance->number_of_connections, radef_kInvalidParameter);
   raas_AssertNotNull(message_payload, radef_kInvalidParameter);
 
   radef_RaStaReturnCode ret = radef_kNoError;
 
   // Read message from buffer
-  if (srrece_received_buffers[connection_id].used_elements > 0U) {
-    const srtyp_SrMessagePayload* const buffer_element = &srrece_received_buffers[connection_id].buffer[srrece_received_buffers[connection_id].read_idx];
-    raas_AssertU16InRange(buffer_element->payload_size, srcty_kMinSrLayerPayloadDataSize, RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE, radef_kInternalError);
+  if (srrece_instance->received_buffers[connection_id].used_elements > 0U) {
+    const srrece_ReceivedPayload* const kBufferElement =
+        &srrece_instance->received_buffers[connection_id].buffer[srrece_instance->received_buffers[connection_id].read_idx];
+    raas_AssertU16InRange(kBufferElement->payload_size, srcty_kMinSrLayerPayloadDataSize, RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE, radef_kInternalError);
 
-    message_payload->payload_size = buffer_element->payload_size;
+    const uint8_t* const kChunkData = raslb_GetChunkData(kBufferElement->chunk_handle);
+    message_payload->payload_size = kBufferElement->payload_size;
     for (uint16_t index = 0U; index < message_payload->payload_size; ++index) {
-      message_payload->payload[index] = buffer_element->payload[index];
+      message_payload->payload[index] = kChunkData[index];
     }
 
-    --srrece_received_buffers[connection_id].used_elements;
-    IncrementReceivedBufferIndexAndHandleOverflow(&srrece_received_buffers[connection_id].read_idx, kIndexIncrement);
+    RemoveOldestPayload(connection_id);
+  } else {
+    // Buffer is empty
+    ret = radef_kNoMessageReceived;
+  }
+
+  return ret;
+}
+
+radef_RaStaReturnCode srrece_PeekFromBuffer(const uint32_t connection_id, srtyp_SrMessagePayloadView* const message_payload) {
+  // Input parameter check
+  raas_AssertTrue(srrece_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srrece_instance->number_of_connections, radef_kInvalidParameter);
+  raas_AssertNotNull(message_payload, radef_kInvalidParameter);
+
+  radef_RaStaReturnCode ret = radef_kNoError;
+
+  // Point to the oldest message in the buffer, it stays in its slab chunk until it is released
+  if (srrece_instance->received_buffers[connection_id].used_elements > 0U) {
+    const srrece_ReceivedPayload* const kBufferElement =
+        &srrece_instance->received_buffers[connection_id].buffer[srrece_instance->received_buffers[connection_id].read_idx];
+    raas_AssertU16InRange(kBufferElement->payload_size, srcty_kMinSrLayerPayloadDataSize, RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE, radef_kInternalError);
+
+    message_payload->payload_size = kBufferElement->payload_size;
+    message_payload->payload = raslb_GetChunkData(kBufferElement->chunk_handle);
+  } else {
+    // Buffer is empty
+    ret = radef_kNoMessageReceived;
+  }
+
+  return ret;
+}
+
+radef_RaStaReturnCode srrece_ReleaseFromBuffer(const uint32_t connection_id) {
+  // Input parameter check
+  raas_AssertTrue(srrece_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srrece_instance->number_of_connections, radef_kInvalidParameter);
+
+  radef_RaStaReturnCode ret = radef_kNoError;
+
+  if (srrece_instance->received_buffers[connection_id].used_elements > 0U) {
+    RemoveOldestPayload(connection_id);
   } else {
     // Buffer is empty
     ret = radef_kNoMessageReceived;
@@ -198,13 +271,13 @@ radef_RaStaReturnCode srrece_ReadFromBuffer(const uint32_t connection_id, srtyp_
 
 uint32_t srrece_GetPayloadSizeOfNextMessageToRead(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srrece_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srrece_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srrece_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srrece_instance->number_of_connections, radef_kInvalidParameter);
 
   uint32_t next_payload_size = 0U;
 
-  if (srrece_received_buffers[connection_id].used_elements > 0U) {
-    next_payload_size = srrece_received_buffers[connection_id].buffer[srrece_received_buffers[connection_id].read_idx].payload_size;
+  if (srrece_instance->received_buffers[connection_id].used_elements > 0U) {
+    next_payload_size = srrece_instance->received_buffers[connection_id].buffer[srrece_instance->received_buffers[connection_id].read_idx].payload_size;
   }
 
   return next_payload_size;
@@ -212,20 +285,28 @@ uint32_t srrece_GetPayloadSizeOfNextMessageToRead(const uint32_t connection_id)
 
 uint16_t srrece_GetFreeBufferEntries(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srrece_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srrece_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srrece_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srrece_instance->number_of_connections, radef_kInvalidParameter);
+
+  raas_AssertTrue(srrece_instance->n_send_max >= srrece_instance->received_buffers[connection_id].used_elements, radef_kInternalError);
 
-  raas_AssertTrue(srrece_n_send_max >= srrece_received_buffers[connection_id].used_elements, radef_kInternalError);
+  uint16_t free_entries = (uint16_t)(srrece_instance->n_send_max - srrece_instance->received_buffers[connection_id].used_elements);
+
+  // Every free entry must be able to take a payload of maximum size, so the entries are limited by the free slab chunks of this size
+  const uint16_t kFreeChunks = raslb_GetNumberOfFreeChunks(RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE);
+  if (kFreeChunks < free_entries) {
+    free_entries = kFreeChunks;
+  }
 
-  return (uint16_t)(srrece_n_send_max - srrece_received_buffers[connection_id].used_elements);
+  return free_entries;
 }
 
 uint16_t srrece_GetUsedBufferEntries(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srrece_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srrece_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srrece_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srrece_instance->number_of_connections, radef_kInvalidParameter);
 
-  return srrece_received_buffers[connection_id].used_elements;
+  return srrece_instance->received_buffers[connection_id].used_elements;
 }
 
 // -----------------------------------------------------------------------------
@@ -236,10 +317,20 @@ static void IncrementReceivedBufferIndexAndHandleOverflow(uint16_t* const buffer
   // Input parameter check
   raas_AssertNotNull(bufferIndex, radef_kInternalError);
 
-  *bufferIndex += increment;
+  // Manage index overflow, the buffer size is a power of two
+  *bufferIndex = (uint16_t)((uint32_t)(*bufferIndex + increment) & kIndexMask);
+}
 
-  // Manage index overflow
-  if (*bufferIndex >= srrece_n_send_max) {
-    *bufferIndex = 0U;
-  }
+static void RemoveOldestPayload(const uint32_t connection_id) {
+  raas_AssertTrue(srrece_instance->received_buffers[connection_id].used_elements > 0U, radef_kInternalError);
+
+  // Give the slab chunk back for other messages
+  srrece_ReceivedPayload* const buffer_element =
+      &srrece_instance->received_buffers[connection_id].buffer[srrece_instance->received_buffers[connection_id].read_idx];
+  raslb_FreeChunk(buffer_element->chunk_handle);
+  buffer_element->chunk_handle = RASLB_INVALID_CHUNK_HANDLE;
+  buffer_element->payload_size = 0U;
+
+  --srrece_instance->received_buffers[connection_id].used_elements;
+  IncrementReceivedBufferIndexAndHandleOverflow(&srrece_instance->received_buffers[connection_id].read_idx, kIndexIncrement);
 }
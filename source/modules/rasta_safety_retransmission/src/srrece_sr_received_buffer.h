@@ -42,6 +42,46 @@
 // Global Type Definitions
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Struct for a SafRetL received message payload.
+ *
+ * The payload data is stored in a chunk of the message slab.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  uint16_t payload_size;  ///< payload size [bytes], 0 for an empty element
+  uint16_t chunk_handle;  ///< handle of the slab chunk with the payload data, ::RASLB_INVALID_CHUNK_HANDLE for an empty element
+} srrece_ReceivedPayload;
+//lint -restore
+
+/**
+ * @brief Struct for SafRetL received messages payload buffer.
+ *
+ * The buffer has ::RADEF_RECEIVED_BUFFER_SIZE entries, but only the configured receive buffer size ::srrece_InstanceData::n_send_max of them are used at the
+ * same time.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  uint16_t read_idx;       ///< buffer read index (next message to read)
+  uint16_t write_idx;      ///< buffer write index (next message to write)
+  uint16_t used_elements;  ///< current amount of used elements in the buffer
+  srrece_ReceivedPayload
+      buffer[RADEF_RECEIVED_BUFFER_SIZE];  ///< buffer with the payload of correctly received messages, waiting for the read from the application layer
+} srrece_ReceivedBuffer;
+//lint -restore
+
+/**
+ * @brief Struct for the data of a SafRetL received buffer instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;                         ///< Initialization state of the module. true, if the module is initialized.
+  uint32_t number_of_connections;           ///< Number of configured RaSTA connections.
+  uint16_t n_send_max;                      ///< Configured receive buffer size [messages].
+  srrece_ReceivedBuffer* received_buffers;  ///< Received buffers for all configured RaSTA connections, allocated from the connection memory.
+} srrece_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -56,9 +96,9 @@ extern "C" {
 /**
  * @brief Initialize the SafRetL received buffer module.
  *
- * This function is used to initialize the received buffer module. It saves the passed number of connections and the configured size of the buffer (NsendMax).
- * For all configured connections, the ::srrece_InitBuffer function is called to properly initialize the buffer for all configured connections. A fatal error is
- * raised, if this function is called multiple times.
+ * This function is used to initialize the received buffer module. It saves the passed number of connections and the configured size of the buffer (NsendMax)
+ * and allocates the received buffers of the configured connections from the connection memory. For all configured connections, the ::srrece_InitBuffer
+ * function is called to properly initialize the buffer for all configured connections. A fatal error is raised, if this function is called multiple times.
  *
  * @pre The received buffer module must not be initialized, otherwise a ::radef_kAlreadyInitialized fatal error is thrown.
  *
@@ -69,6 +109,27 @@ extern "C" {
  */
 void srrece_Init(const uint32_t configured_connections, const uint16_t configured_n_send_max);
 
+/**
+ * @brief Select the SafRetL received buffer instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the SafRetL received buffer functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_SR_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void srrece_SelectInstance(const uint32_t instance_index);
+
+/**
+ * @brief Get the size of the connection memory used by the received buffer module.
+ *
+ * This function returns the size of the connection memory, which is allocated by ::srrece_Init for the received buffers of the configured connections. It can
+ * be used before the initialization of the module.
+ *
+ * @param [in] configured_connections Number of configured RaSTA connections. Valid range: 1 <= value <= ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
+ * @return Size of the used connection memory [bytes].
+ */
+uint32_t srrece_GetConnectionMemorySize(const uint32_t configured_connections);
+
 /**
  * @brief Initialize the received buffer of a dedicated RaSTA connection.
  *
@@ -86,19 +147,20 @@ void srrece_InitBuffer(const uint32_t connection_id);
 /**
  * @brief Add a SafRetL message to the received buffer of a dedicated RaSTA connection. A fatal error is raised, if the buffer is full.
  *
- * When there is free space in the buffer, a SafRetL message is added to the buffer. If the buffer is full, a ::radef_kReceiveBufferFull fatal error message
- * is thrown. After adding the message to the buffer, the position pointer and used entries are updated.
+ * When there is free space in the buffer, a SafRetL message is added to the buffer. If the buffer is full or no slab chunk is available for the message, a
+ * ::radef_kReceiveBufferFull fatal error message is thrown. After adding the message to the buffer, the position pointer and used entries are updated.
  *
  * @pre The received buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
  * @implementsReq{RASW-608} Add to Buffer Function
  *
  * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
- * @param [in] message_payload Pointer to message payload structure that must be added to the buffer. If the pointer is NULL, a ::radef_kInvalidParameter fatal
- * error is thrown. For the message payload the full value range is valid and usable, the message payload size has a valid range of
+ * @param [in] message_payload Pointer to a read-only view of the message payload that must be added to the buffer, e.g. pointing directly into the received
+ * message. The payload is copied into the buffer. If the pointer or the payload pointer of the view is NULL, a ::radef_kInvalidParameter fatal error is
+ * thrown. For the message payload the full value range is valid and usable, the message payload size has a valid range of
  * ::srcty_kMinSrLayerPayloadDataSize <= value <= ::RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE.
  */
-void srrece_AddToBuffer(const uint32_t connection_id, const srtyp_SrMessagePayload* const message_payload);
+void srrece_AddToBuffer(const uint32_t connection_id, const srtyp_SrMessagePayloadView* const message_payload);
 
 /**
  * @brief Read and remove a SafRetL message payload from the received buffer of a dedicated RaSTA connection.
@@ -118,6 +180,41 @@ void srrece_AddToBuffer(const uint32_t connection_id, const srtyp_SrMessagePaylo
  */
 radef_RaStaReturnCode srrece_ReadFromBuffer(const uint32_t connection_id, srtyp_SrMessagePayload* const message_payload);
 
+/**
+ * @brief Get a read-only view of the oldest SafRetL message payload in the received buffer of a dedicated RaSTA connection.
+ *
+ * When there are messages in the buffer, the passed view is set to the oldest SafRetL message payload and a ::radef_kNoError returned. The payload is not
+ * copied and stays in the buffer until it is removed with ::srrece_ReleaseFromBuffer. If the buffer is empty, a ::radef_kNoMessageReceived is returned.
+ *
+ * @pre The received buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @implementsReq{RASW-613} Read from Buffer Function
+ *
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @param [out] message_payload Pointer to the view, which is set to the message payload in the buffer. The view is valid until the payload is removed from
+ * the buffer. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown.
+ * @return radef_kNoError -> View set to the oldest message payload in the buffer.
+ * @return radef_kNoMessageReceived -> No message payload in the buffer.
+ */
+radef_RaStaReturnCode srrece_PeekFromBuffer(const uint32_t connection_id, srtyp_SrMessagePayloadView* const message_payload);
+
+/**
+ * @brief Remove the oldest SafRetL message payload from the received buffer of a dedicated RaSTA connection.
+ *
+ * When there are messages in the buffer, the oldest SafRetL message payload is removed from the buffer, the position pointers & used entries are updated and
+ * a ::radef_kNoError returned. A view of this payload from ::srrece_PeekFromBuffer is no longer valid afterwards. If the buffer is empty, a
+ * ::radef_kNoMessageReceived is returned.
+ *
+ * @pre The received buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @implementsReq{RASW-613} Read from Buffer Function
+ *
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @return radef_kNoError -> Message payload successfully removed from the buffer.
+ * @return radef_kNoMessageReceived -> No message payload in the buffer.
+ */
+radef_RaStaReturnCode srrece_ReleaseFromBuffer(const uint32_t connection_id);
+
 /**
  * @brief Get the payload size of the next message that is read from a dedicated RaSTA connection.
  *
@@ -136,7 +233,8 @@ uint32_t srrece_GetPayloadSizeOfNextMessageToRead(const uint32_t connection_id);
 /**
  * @brief Get the number of free buffer entries.
  *
- * This function returns the amount of free entires in the received buffer of a given connection.
+ * This function returns the amount of free entires in the received buffer of a given connection. Since the payloads are stored in the message slab, which
+ * is shared by all connections, the free entries are limited by the number of free slab chunks for a payload of maximum size.
  *
  * @pre The received buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
@@ -23,69 +23,39 @@
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasta_common/radef_rasta_definitions.h"
 #include "rasta_common/ralog_rasta_logger.h"
+#include "rasta_common/raslb_rasta_slab.h"
 #include "rasta_common/rasys_rasta_system_adapter.h"
 #include "rasta_safety_retransmission/srcty_sr_config_types.h"
-#include "srmsg_sr_messages.h"  // NOLINT(build/include_subdir)
-#include "srtyp_sr_types.h"     // NOLINT(build/include_subdir)
+#include "srmem_sr_connection_memory.h"  // NOLINT(build/include_subdir)
+#include "srmsg_sr_messages.h"           // NOLINT(build/include_subdir)
+#include "srtyp_sr_types.h"              // NOLINT(build/include_subdir)
 
 // -----------------------------------------------------------------------------
 // Local Macro Definitions
 // -----------------------------------------------------------------------------
 
+#if ((RADEF_SEND_BUFFER_INDEX_SIZE & (RADEF_SEND_BUFFER_INDEX_SIZE - 1U)) != 0U) || (RADEF_SEND_BUFFER_INDEX_SIZE < (2U * RADEF_SEND_BUFFER_SIZE)) || \
+    (RADEF_SEND_BUFFER_INDEX_SIZE > 32768U)
+#error "RADEF_SEND_BUFFER_INDEX_SIZE must be a power of two, at least twice RADEF_SEND_BUFFER_SIZE and at most 32768"
+#endif
+
 // -----------------------------------------------------------------------------
 // Local Type Definitions
 // -----------------------------------------------------------------------------
-/**
- * @brief Struct for SafRetL send message.
- */
-typedef struct {
-  bool already_sent;        ///< was this message already sent (used for retransmission)
-  srtyp_SrMessage message;  ///< message
-} SrSendMessage;
-
-/**
- * @brief Struct for SafRetL send messages buffer.
- */
-typedef struct {
-  uint16_t remove_idx;                           ///< buffer remove index (next confirmed message to remove form the buffer)
-  uint16_t read_idx;                             ///< buffer read index (next message to transmit or re-transmit)
-  uint16_t write_idx;                            ///< buffer write index (next new message to write to the buffer)
-  uint16_t used_elements;                        ///< current amount of elements in the buffer
-  uint16_t not_sent_elements;                    ///< current amount of not sent elements in the buffer
-  SrSendMessage buffer[RADEF_SEND_BUFFER_SIZE];  ///< buffer with the messages, waiting for to be send
-} SrSendBuffer;
 
 // -----------------------------------------------------------------------------
 // Local Variable Definitions
 // -----------------------------------------------------------------------------
 
 /**
- * @brief Initialization state of the module.
- * true, if the module is initialized.
+ * @brief Data of all SafRetL send buffer instances.
  */
-PRIVATE bool srsend_initialized = false;
+PRIVATE srsend_InstanceData srsend_instances[RADEF_MAX_NUMBER_OF_SR_INSTANCES];
 
 /**
- * @brief Number of configured RaSTA connections.
+ * @brief Data of the selected SafRetL send buffer instance.
  */
-PRIVATE uint32_t srsend_number_of_connections = 0U;
-
-/**
- * @brief Send buffers for all RaSTA connections.
- *
- * This array contains a buffer for every RaSTA connection and additionally a temporary buffer for the preparation of the send buffer for a retransmission.
- */
-PRIVATE SrSendBuffer srsend_send_buffers[RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS + 1U];
-
-/**
- * @brief Memory to transfer and create messages. Valid range as described in ::srtyp_SrMessage.
- */
-PRIVATE srtyp_SrMessage scratch_message;
-
-/**
- * @brief Memory to transfer and create messages payload. Valid range as described in ::srtyp_SrMessagePayload.
- */
-PRIVATE srtyp_SrMessagePayload scratch_message_payload;
+PRIVATE RADEF_THREAD_LOCAL srsend_InstanceData* srsend_instance = &srsend_instances[0];
 
 // -----------------------------------------------------------------------------
 // Local Function Prototypes
@@ -98,111 +68,181 @@ PRIVATE srtyp_SrMessagePayload scratch_message_payload;
 /**
  * @brief Initialize the send buffer of a dedicated RaSTA connection.
  *
- * This function initializes the buffer of a given RaSTA connection. It resets all properties of the buffer (read, write, remove index and used entries) and
- * also sets the message length of all elements in the buffer to 0 and clears the already sent flag.  This also lets you initialize the temporary buffer
- * that sits at the end of the array after the normal connection buffer elements.
+ * This function initializes the buffer of a given RaSTA connection. It resets all properties of the buffer (read, write, remove index and used entries),
+ * releases all message slots, frees the slab chunks of all stored messages and also sets the message length of all elements in the buffer to 0 and clears the
+ * already sent flag.
  *
  * @pre The send buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
  * @implementsReq{RASW-601} Init Buffer Function
  *
- * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value <= configured number of connections. (Also includes temporary buffer
- * element).
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
  */
 static void InitBuffer(const uint32_t connection_id);
 
 /**
  * @brief Add a SafRetL message to the send buffer of a dedicated RaSTA connection.
  *
- * When there is free space in the buffer, a SafRetL message is added to the buffer. If the buffer is full, a ::radef_kSendBufferFull fatal error message
- * is thrown. After adding the message to the buffer, the position index and used entires are updated. This also lets you add a element to the temporary
- * buffer that sits at the end of the array after the normal connection buffer elements.
+ * When there is free space in the buffer, a SafRetL message is added to the buffer. If the buffer is full or no slab chunk is available for the message, a
+ * ::radef_kSendBufferFull fatal error message is thrown. After adding the message to the buffer, the position index and used entires are updated.
  *
  * @pre The send buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
  * @implementsReq{RASW-596} Add to Buffer Function
  *
- * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value <= configured number of connections (Also includes temporary buffer
- * element).
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
  * @param [in] message Pointer to SafRetL message structure that must be added to the buffer. If the pointer is NULL, a ::radef_kInternalError fatal error is
- * thrown. For the message payload the full value range is valid and usable, the message size has a valid range of ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE <=
+ * thrown. For the message payload the full value range is valid and usable, the message size has a valid range of ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE <=
  * value <= ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE.
  */
 static void AddToBuffer(const uint32_t connection_id, const srtyp_SrMessage* const message);
 
 /**
- * @brief Copy the temporary buffer into a connection buffer
+ * @brief Get the element at a position of the send buffer of a dedicated RaSTA connection
  *
- * This internal function initializes the buffer of a connection and then copies the temporary buffer, which was prepared in advance for a retransmission, into
- * this empty connection buffer.
+ * This internal function resolves the message slot of the passed buffer position and returns the element stored in this slot. If no message slot is assigned
+ * to the position, a ::radef_kInternalError fatal error is thrown.
  *
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @param [in] buffer_index Buffer position. Valid range: 0 <= value < ::RADEF_SEND_BUFFER_INDEX_SIZE.
+ * @return Pointer to the buffer element.
+ */
+static srsend_SendMessage* GetBufferElement(const uint32_t connection_id, const uint16_t buffer_index);
+
+/**
+ * @brief Store a message in a buffer element
+ *
+ * This internal function stores the message data in a slab chunk of the buffer element and updates the message size, the sequence number, the message type
+ * and the number of packed application messages of the element. The chunk of the element is reused, if it is big enough. Otherwise a new chunk is allocated
+ * and the old one is freed. If no chunk is available, the buffer element is not changed.
+ *
+ * @implementsReq{RASW-596} Add to Buffer Function
  * @implementsReq{RASW-603} Prepare Buffer for Retransmission Function
  *
- * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @param [inout] buffer_element Pointer to the buffer element. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [in] message Pointer to the message to store. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return true -> message stored
+ * @return false -> no slab chunk available for the message
  */
-static void CopyTempBufferIntoConnectionBuffer(const uint32_t connection_id);
+static bool StoreMessage(srsend_SendMessage* const buffer_element, const srtyp_SrMessage* const message);
 
 /**
- * @brief Create a new Data message and add it to the temporary buffer
+ * @brief Load a message from a buffer element
  *
- * This internal function creates a new Data message based on the passed Data message. It is then added to the temporary buffer and the sequence number in the
- * header is incremented.
+ * This internal function copies the message data from the slab chunk of the buffer element to the passed message.
  *
+ * @implementsReq{RASW-604} Read Message to Send Function
  * @implementsReq{RASW-603} Prepare Buffer for Retransmission Function
  *
- * @param [in] sr_message Pointer to the input data or retrData message. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
- * @param [inout] new_msg_header Pointer to the header data to create a new message. The header contains also the current sequence number from which the new
- * message must continue and which at the end of the function will be incremented by one. If the pointer is NULL, a ::radef_kInternalError fatal error is
- * thrown.
+ * @param [in] buffer_element Pointer to the buffer element. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [out] message Pointer to the message. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
  */
-static void CreateNewDataMsgAndAddToTempBuffer(const srtyp_SrMessage* const sr_message, srtyp_SrMessageHeaderCreate* const new_msg_header);
+static void LoadMessage(const srsend_SendMessage* const buffer_element, srtyp_SrMessage* const message);
 
 /**
- * @brief Create a new RetrData message and add it to the temporary buffer
+ * @brief Get a view of the message of a buffer element
  *
- * This internal function creates a new RetrData message based on the passed Data or RetrData message. It is then added to the temporary buffer and the sequence
- * number in the header is incremented.
+ * This internal function returns a view of the message in the slab chunk of the buffer element, so that the message can be modified in place.
  *
+ * @implementsReq{RASW-596} Add to Buffer Function
  * @implementsReq{RASW-603} Prepare Buffer for Retransmission Function
  *
- * @param [in] sr_message Pointer to the input data or retrData message. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
- * @param [inout] new_msg_header Pointer to the header data to create a new message. The header contains also the current sequence number from which the new
- * message must continue and which at the end of the function will be incremented by one. If the pointer is NULL, a ::radef_kInternalError fatal error is
- * thrown.
+ * @param [in] buffer_element Pointer to the buffer element. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [out] message_view Pointer to the message view. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ */
+static void GetMessageView(const srsend_SendMessage* const buffer_element, srtyp_SrMessageView* const message_view);
+
+/**
+ * @brief Pack a message payload into the data message of a buffer element
+ *
+ * This internal function appends the payload in place to the data message in the slab chunk of the buffer element. If the extended message does not fit into
+ * the chunk, the message is first moved to a bigger chunk. If no bigger chunk is available or the extended message would exceed the maximum message size,
+ * the buffer element is not changed.
+ *
+ * @implementsReq{RASW-596} Add to Buffer Function
+ *
+ * @param [inout] buffer_element Pointer to the buffer element with a data message. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @param [in] message_payload Pointer to the message payload to pack. If the pointer is NULL, a ::radef_kInternalError fatal error is thrown.
+ * @return true -> payload packed into the message
+ * @return false -> payload not packed
  */
-static void CreateNewRetrDataMsgAndAddToTempBuffer(const srtyp_SrMessage* const sr_message, srtyp_SrMessageHeaderCreate* const new_msg_header);
+static bool AddPayloadToStoredMessage(srsend_SendMessage* const buffer_element, const srtyp_SrMessagePayload* const message_payload);
 
 /**
- * @brief Create a new heartbeat message and add it to the temporary buffer
+ * @brief Assign a free message slot to a buffer position
  *
- * This internal function creates a new heartbeat message. It is then added to the temporary buffer and the sequence number in the header is incremented.
+ * This internal function takes a message slot from the free slot stack and assigns it to the passed buffer position. If no message slot is free, a
+ * ::radef_kSendBufferFull fatal error is thrown.
+ *
+ * @implementsReq{RASW-596} Add to Buffer Function
+ * @implementsReq{RASW-603} Prepare Buffer for Retransmission Function
+ *
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @param [in] buffer_index Buffer position. Valid range: 0 <= value < ::RADEF_SEND_BUFFER_INDEX_SIZE.
+ * @return Pointer to the buffer element of the assigned message slot.
+ */
+static srsend_SendMessage* AssignFreeMessageSlot(const uint32_t connection_id, const uint16_t buffer_index);
+
+/**
+ * @brief Release the message slot of a buffer position
+ *
+ * This internal function frees the slab chunk of the buffer element of the passed buffer position, resets the element, puts its message slot back on the
+ * free slot stack and marks the position as unused.
+ *
+ * @implementsReq{RASW-603} Prepare Buffer for Retransmission Function
+ * @implementsReq{RASW-605} Remove from Buffer Function
+ *
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @param [in] buffer_index Buffer position. Valid range: 0 <= value < ::RADEF_SEND_BUFFER_INDEX_SIZE.
+ */
+static void ReleaseMessageSlot(const uint32_t connection_id, const uint16_t buffer_index);
+
+/**
+ * @brief Convert a stored Data or RetrData message for the retransmission and move it to its new buffer position
+ *
+ * This internal function overwrites the header and the message type of the Data or RetrData message at the read position. The message payload stays in its
+ * slab chunk, only the message slot is moved from the read to the write position. The write position and the sequence number in the header are
+ * incremented.
  *
  * @implementsReq{RASW-603} Prepare Buffer for Retransmission Function
  *
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @param [in] message_type New message type. Valid values: ::srtyp_kSrMessageData and ::srtyp_kSrMessageRetrData.
+ * @param [in] read_index Buffer position of the stored message. Valid range: 0 <= value < ::RADEF_SEND_BUFFER_INDEX_SIZE.
+ * @param [inout] write_index Pointer to the buffer position where the converted message must be placed. If the pointer is NULL, a ::radef_kInternalError
+ * fatal error is thrown.
  * @param [inout] new_msg_header Pointer to the header data to create a new message. The header contains also the current sequence number from which the new
  * message must continue and which at the end of the function will be incremented by one. If the pointer is NULL, a ::radef_kInternalError fatal error is
  * thrown.
  */
-static void CreateNewHbMsgAndAddToTempBuffer(srtyp_SrMessageHeaderCreate* const new_msg_header);
+static void ConvertDataMsgInBuffer(const uint32_t connection_id, const srtyp_SrMessageType message_type, const uint16_t read_index,
+                                   uint16_t* const write_index, srtyp_SrMessageHeaderCreate* const new_msg_header);
 
 /**
- * @brief Create a new RetrReq message and add it to the temporary buffer
+ * @brief Create a new message without payload directly in the send buffer
  *
- * This internal function creates a new RetrReq message. It is then added to the temporary buffer and the sequence number in the header is incremented.
+ * This internal function assigns a free message slot to the write position and creates a new RetrResp, HB or RetrReq message in it. If no slab chunk is
+ * available for the message, a ::radef_kSendBufferFull fatal error is thrown. The write position and the sequence number in the header are incremented.
  *
  * @implementsReq{RASW-603} Prepare Buffer for Retransmission Function
  *
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @param [in] message_type Type of the message to create. Valid values: ::srtyp_kSrMessageRetrResp, ::srtyp_kSrMessageHb and ::srtyp_kSrMessageRetrReq, a
+ * ::radef_kInternalError fatal error is thrown otherwise.
+ * @param [inout] write_index Pointer to the buffer position where the message must be created. If the pointer is NULL, a ::radef_kInternalError fatal error
+ * is thrown.
  * @param [inout] new_msg_header Pointer to the header data to create a new message. The header contains also the current sequence number from which the new
  * message must continue and which at the end of the function will be incremented by one. If the pointer is NULL, a ::radef_kInternalError fatal error is
  * thrown.
  */
-static void CreateNewRetrReqMsgAndAddToTempBuffer(srtyp_SrMessageHeaderCreate* const new_msg_header);
+static void CreateNewMsgInBuffer(const uint32_t connection_id, const srtyp_SrMessageType message_type, uint16_t* const write_index,
+                                 srtyp_SrMessageHeaderCreate* const new_msg_header);
 
 /**
  * @brief Increment a send buffer index by a increment value and handle overflow.
  *
- * This internal function increments a passed buffer index by a specified increment and handles a possible overflow by exceeding the maximum buffer size
- * ::RADEF_SEND_BUFFER_SIZE. In case of an overflow, the maximum value is subtracted from the index.
+ * This internal function increments a passed buffer index by a specified increment and handles a possible overflow by exceeding the number of buffer
+ * positions ::RADEF_SEND_BUFFER_INDEX_SIZE. Since the number of positions is a power of two, the overflow is handled by masking the index.
  *
  * @implementsReq{RASW-604} Read Message to Send Function
  * @implementsReq{RASW-603} Prepare Buffer for Retransmission Function
@@ -213,13 +253,32 @@ static void CreateNewRetrReqMsgAndAddToTempBuffer(srtyp_SrMessageHeaderCreate* c
  */
 static void IncrementSendBufferIndexAndHandleOverflow(uint16_t* const bufferIndex, const uint16_t increment);
 
+/**
+ * @brief Get the share of the slab chunks for the send buffer of one connection
+ *
+ * This internal function shares the slab chunks for messages of maximum size between the send buffers of all connections. The slab provides
+ * ::RADEF_SEND_BUFFER_SIZE + ::RADEF_MAX_N_SEND_MAX chunks per connection, of which the send buffer uses ::RADEF_SEND_BUFFER_SIZE.
+ *
+ * @implementsReq{RASW-600} Init sr_send_buffer Function
+ *
+ * @param [in] configured_connections Number of configured RaSTA connections. Valid range: 1 <= value <= ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
+ * @param [in] slab_chunks Number of slab chunks for messages of maximum size. The full value range is valid and usable.
+ * @return Number of slab chunks, which the send buffer of one connection may use. Valid range: 0 <= value <= ::RADEF_SEND_BUFFER_SIZE.
+ */
+static uint16_t GetConnectionChunkShare(const uint32_t configured_connections, const uint32_t slab_chunks);
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
 // Local Constant Definitions
 // -----------------------------------------------------------------------------
 
-static const uint16_t kIndexIncrement = 1U;  ///< Increment value for send buffer indexes
+static const uint16_t kIndexIncrement = 1U;                                  ///< Increment value for send buffer indexes
+static const uint16_t kIndexMask = (uint16_t)(RADEF_SEND_BUFFER_INDEX_SIZE - 1U);  ///< Mask for send buffer indexes
+static const uint16_t kUnusedSlot = RADEF_SEND_BUFFER_SIZE;                  ///< Message slot of an unused buffer position
+static const uint16_t kMaxInsertedRetrMessages =
+    2U;  ///< Maximum number of messages inserted in addition to the stored messages for a retransmission (RetrResp and HB in front of a RetrReq)
+static const uint16_t kMinConnectionChunkShare = 1U;  ///< Minimum number of slab chunks, which the send buffer of one connection must be able to use
 
 // -----------------------------------------------------------------------------
 // Global Constant Definitions
@@ -231,60 +290,126 @@ static const uint16_t kIndexIncrement = 1U;  ///< Increment value for send buffe
 
 void srsend_Init(const uint32_t configured_connections) {
   // Input parameter check
-  raas_AssertTrue(!srsend_initialized, radef_kAlreadyInitialized);
+  raas_AssertTrue(!srsend_instance->initialized, radef_kAlreadyInitialized);
   raas_AssertU32InRange(configured_connections, srcty_kMinNumberOfRaStaConnections, RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, radef_kInvalidParameter);
 
-  srsend_number_of_connections = configured_connections;
+  srsend_instance->number_of_connections = configured_connections;
+  srsend_instance->send_buffers = (srsend_SendBuffer*)srmem_Allocate(configured_connections * (uint32_t)sizeof(srsend_SendBuffer));
+
+  // Share the slab chunks for messages of maximum size between the send buffers of all connections
+  srsend_instance->connection_chunk_share = GetConnectionChunkShare(configured_connections, raslb_GetNumberOfFreeChunks(RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE));
+  raas_AssertTrue(srsend_instance->connection_chunk_share >= kMinConnectionChunkShare, radef_kInvalidParameter);
+
+  // Mark all buffer elements as empty, so that no slab chunk is freed by the initialization of the buffers
+  for (uint32_t connection_index = 0U; connection_index < srsend_instance->number_of_connections; ++connection_index) {
+    for (uint16_t index = 0U; index < RADEF_SEND_BUFFER_SIZE; ++index) {
+      srsend_instance->send_buffers[connection_index].buffer[index].chunk_handle = RASLB_INVALID_CHUNK_HANDLE;
+    }
+  }
 
-  srsend_initialized = true;
+  srsend_instance->initialized = true;
 
   // Init buffers for all configured connections
-  for (uint32_t index = 0U; index < srsend_number_of_connections; ++index) {
+  for (uint32_t index = 0U; index < srsend_instance->number_of_connections; ++index) {
     srsend_InitBuffer(index);
   }
 }
 
+void srsend_SelectInstance(const uint32_t instance_index) {
+  // Input parameter check
+  raas_AssertU32InRange(instance_index, 0U, RADEF_MAX_NUMBER_OF_SR_INSTANCES - 1U, radef_kInvalidParameter);
+
+  srsend_instance = &srsend_instances[instance_index];
+}
+
+uint32_t srsend_GetConnectionMemorySize(const uint32_t configured_connections) {
+  // Input parameter check
+  raas_AssertU32InRange(configured_connections, srcty_kMinNumberOfRaStaConnections, RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, radef_kInvalidParameter);
+
+  return srmem_GetTableAllocationSize(configured_connections, (uint32_t)sizeof(srsend_SendBuffer));
+}
+
+bool srsend_IsChunkShareSufficient(const uint32_t configured_connections, const uint16_t n_send_max) {
+  // Input parameter check
+  raas_AssertU32InRange(configured_connections, srcty_kMinNumberOfRaStaConnections, RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, radef_kInvalidParameter);
+  raas_AssertU16InRange(n_send_max, srcty_kMinNSendMax, RADEF_MAX_N_SEND_MAX, radef_kInvalidParameter);
+
+  // The same chunks are shared by srsend_Init, after the slab is initialized with this configuration
+  uint32_t slab_chunks = 0U;
+  for (uint16_t class_index = 0U; class_index < srcty_kSlabConfiguration.number_of_size_classes; ++class_index) {
+    if (srcty_kSlabConfiguration.size_classes[class_index].chunk_size >= RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE) {
+      slab_chunks += srcty_kSlabConfiguration.size_classes[class_index].number_of_chunks;
+    }
+  }
+
+  // A connection must be able to send a full window and to insert the messages of a retransmission. The share is at most the buffer size.
+  uint32_t needed_chunk_share = (uint32_t)n_send_max + srcty_kMinFreeEntriesSendBufferForRetr;
+  if (needed_chunk_share > RADEF_SEND_BUFFER_SIZE) {
+    needed_chunk_share = RADEF_SEND_BUFFER_SIZE;
+  }
+
+  return GetConnectionChunkShare(configured_connections, slab_chunks) >= needed_chunk_share;
+}
+
 void srsend_InitBuffer(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srsend_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srsend_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srsend_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInvalidParameter);
 
   InitBuffer(connection_id);
 }
 
 void srsend_AddToBuffer(const uint32_t connection_id, const srtyp_SrMessage* const message) {
   // Input parameter check
-  raas_AssertTrue(srsend_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srsend_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srsend_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInvalidParameter);
   raas_AssertNotNull(message, radef_kInvalidParameter);
   raas_AssertU16InRange(message->message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, radef_kInvalidParameter);
 
   AddToBuffer(connection_id, message);
 }
 
+bool srsend_AddPayloadToLastMessage(const uint32_t connection_id, const uint32_t max_number_of_payloads, const srtyp_SrMessagePayload* const message_payload) {
+  // Input parameter check
+  raas_AssertTrue(srsend_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInvalidParameter);
+  raas_AssertU32InRange(max_number_of_payloads, srcty_kMinNMaxPacket, srcty_kMaxNMaxPacket, radef_kInvalidParameter);
+  raas_AssertNotNull(message_payload, radef_kInvalidParameter);
+  raas_AssertU16InRange(message_payload->payload_size, srcty_kMinSrLayerPayloadDataSize, RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE, radef_kInvalidParameter);
+
+  bool payload_added = false;
+
+  // Only the last message can be extended and only as long as it is not yet sent
+  if (srsend_instance->send_buffers[connection_id].not_sent_elements > 0U) {
+    uint16_t last_index = srsend_instance->send_buffers[connection_id].write_idx;
+    IncrementSendBufferIndexAndHandleOverflow(&last_index, kIndexMask);  // Adding the mask decrements the index by one
+    srsend_SendMessage* const buffer_element = GetBufferElement(connection_id, last_index);
+
+    if ((buffer_element->message_type == srtyp_kSrMessageData) && (buffer_element->number_of_payloads < max_number_of_payloads)) {
+      payload_added = AddPayloadToStoredMessage(buffer_element, message_payload);
+    }
+  }
+
+  return payload_added;
+}
+
 radef_RaStaReturnCode srsend_ReadMessageToSend(const uint32_t connection_id, srtyp_SrMessage* const message) {
   // Input parameter check
-  raas_AssertTrue(srsend_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srsend_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srsend_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInvalidParameter);
   raas_AssertNotNull(message, radef_kInvalidParameter);
 
   radef_RaStaReturnCode ret = radef_kNoError;
 
   // Read message from buffer
-  if (srsend_send_buffers[connection_id].not_sent_elements > 0U) {
-    const SrSendMessage* const kBufferElement = &srsend_send_buffers[connection_id].buffer[srsend_send_buffers[connection_id].read_idx];
-
-    raas_AssertU16InRange(kBufferElement->message.message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE,
-                          radef_kInternalError);  // Check if message size is in valid range
-    message->message_size = kBufferElement->message.message_size;
+  if (srsend_instance->send_buffers[connection_id].not_sent_elements > 0U) {
+    srsend_SendMessage* const buffer_element = GetBufferElement(connection_id, srsend_instance->send_buffers[connection_id].read_idx);
 
-    for (uint32_t index = 0U; index < message->message_size; ++index) {
-      message->message[index] = kBufferElement->message.message[index];
-    }
-    srsend_send_buffers[connection_id].buffer[srsend_send_buffers[connection_id].read_idx].already_sent = true;
+    LoadMessage(buffer_element, message);
+    buffer_element->already_sent = true;
 
-    IncrementSendBufferIndexAndHandleOverflow(&srsend_send_buffers[connection_id].read_idx, kIndexIncrement);
-    --srsend_send_buffers[connection_id].not_sent_elements;
+    IncrementSendBufferIndexAndHandleOverflow(&srsend_instance->send_buffers[connection_id].read_idx, kIndexIncrement);
+    --srsend_instance->send_buffers[connection_id].not_sent_elements;
 
   } else {
     // Buffer is empty
@@ -297,42 +422,43 @@ radef_RaStaReturnCode srsend_ReadMessageToSend(const uint32_t connection_id, srt
 void srsend_PrepareBufferForRetr(const uint32_t connection_id, const uint32_t sequence_number_for_retransmission,
                                  const srtyp_SrMessageHeaderCreate message_header, uint32_t* const new_current_sequence_number) {
   // Input parameter check
-  raas_AssertTrue(srsend_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srsend_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srsend_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInvalidParameter);
   raas_AssertNotNull(new_current_sequence_number, radef_kInvalidParameter);
 
   srtyp_SrMessageHeaderCreate new_msg_header = message_header;
   uint32_t retr_sequence_number = sequence_number_for_retransmission;
 
-  raas_AssertTrue(srsend_send_buffers[connection_id].used_elements != 0U, radef_kInvalidSequenceNumber);
+  const uint16_t kStoredElements = srsend_instance->send_buffers[connection_id].used_elements;
+  raas_AssertTrue(kStoredElements != 0U, radef_kInvalidSequenceNumber);
+  raas_AssertTrue((RADEF_SEND_BUFFER_SIZE - kStoredElements) >= kMaxInsertedRetrMessages, radef_kSendBufferFull);
 
   bool retr_end_reached = false;
 
-  // Prepare temporary retransmission buffer
-  const uint32_t kRetrBufferId = srsend_number_of_connections;
-  InitBuffer(kRetrBufferId);
+  // The buffer is rebuilt in place. The new messages are placed in the positions behind the stored messages, which are at least twice the buffer size, so
+  // no stored message is overwritten before it is processed. Only the message slots are moved between the positions.
+  uint16_t read_index = srsend_instance->send_buffers[connection_id].remove_idx;
+  uint16_t write_index = srsend_instance->send_buffers[connection_id].write_idx;
+  const uint16_t kFirstIndex = write_index;
 
   // Create retransmission response
-  srmsg_CreateRetrRespMessage(new_msg_header, &scratch_message);
-  AddToBuffer(kRetrBufferId, &scratch_message);
-  ++new_msg_header.sequence_number;
+  CreateNewMsgInBuffer(connection_id, srtyp_kSrMessageRetrResp, &write_index, &new_msg_header);
 
-  // Copy messages and transform data & retrData messages
-  for (uint16_t index = 0U; index < srsend_send_buffers[connection_id].used_elements; ++index) {
-    uint16_t element_index = srsend_send_buffers[connection_id].remove_idx;
-    IncrementSendBufferIndexAndHandleOverflow(&element_index, index);
+  // Convert data & retrData messages and drop all other already sent messages
+  for (uint16_t index = 0U; index < kStoredElements; ++index) {
+    const srsend_SendMessage* const kBufferElement = GetBufferElement(connection_id, read_index);
 
     ++retr_sequence_number;  // Unsigned integer wrap around is allowed here.
-    raas_AssertTrue(srmsg_GetMessageSequenceNumber(&srsend_send_buffers[connection_id].buffer[element_index].message) == retr_sequence_number,
-                    radef_kInvalidSequenceNumber);
+    raas_AssertTrue(kBufferElement->sequence_number == retr_sequence_number, radef_kInvalidSequenceNumber);
 
-    srtyp_SrMessageType current_message_type = srmsg_GetMessageType(&srsend_send_buffers[connection_id].buffer[element_index].message);
+    srtyp_SrMessageType current_message_type = kBufferElement->message_type;
 
-    if (srsend_send_buffers[connection_id].buffer[element_index].already_sent) {
+    if (kBufferElement->already_sent) {
       if ((current_message_type == srtyp_kSrMessageData) || (current_message_type == srtyp_kSrMessageRetrData)) {
-        CreateNewRetrDataMsgAndAddToTempBuffer(&srsend_send_buffers[connection_id].buffer[element_index].message, &new_msg_header);
+        ConvertDataMsgInBuffer(connection_id, srtyp_kSrMessageRetrData, read_index, &write_index, &new_msg_header);
       } else {
         // Messages with other message types are dropped
+        ReleaseMessageSlot(connection_id, read_index);
       }
     } else {
       // While still RetrData is available, add it for retransmission. As soon as an other message type (only RetrReq & Data messages under normal
@@ -340,34 +466,46 @@ void srsend_PrepareBufferForRetr(const uint32_t connection_id, const uint32_t se
       if (current_message_type == srtyp_kSrMessageRetrData) {
         raas_AssertTrue(!retr_end_reached, radef_kInternalError);  // RetrData no longer allowed when retr_end reached
 
-        CreateNewRetrDataMsgAndAddToTempBuffer(&srsend_send_buffers[connection_id].buffer[element_index].message, &new_msg_header);
+        ConvertDataMsgInBuffer(connection_id, srtyp_kSrMessageRetrData, read_index, &write_index, &new_msg_header);
       } else if (current_message_type == srtyp_kSrMessageData) {
         if (!retr_end_reached) {
           retr_end_reached = true;
         }
 
-        CreateNewDataMsgAndAddToTempBuffer(&srsend_send_buffers[connection_id].buffer[element_index].message, &new_msg_header);
+        ConvertDataMsgInBuffer(connection_id, srtyp_kSrMessageData, read_index, &write_index, &new_msg_header);
       } else if (current_message_type == srtyp_kSrMessageRetrReq) {
+        ReleaseMessageSlot(connection_id, read_index);  // The RetrReq message is created again with a new sequence number
         if (!retr_end_reached) {
-          CreateNewHbMsgAndAddToTempBuffer(&new_msg_header);
+          CreateNewMsgInBuffer(connection_id, srtyp_kSrMessageHb, &write_index, &new_msg_header);
           retr_end_reached = true;
         }
-        CreateNewRetrReqMsgAndAddToTempBuffer(&new_msg_header);
+        CreateNewMsgInBuffer(connection_id, srtyp_kSrMessageRetrReq, &write_index, &new_msg_header);
       } else if (current_message_type == srtyp_kSrMessageHb) {
         // HB messages are dropped
+        ReleaseMessageSlot(connection_id, read_index);
       } else {
         // Messages with other message types are not allowed
         rasys_FatalError(radef_kInternalError);
       }
     }
+
+    IncrementSendBufferIndexAndHandleOverflow(&read_index, kIndexIncrement);
   }
 
   // Add HB msg to finish retransmission if still running
   if (!retr_end_reached) {
-    CreateNewHbMsgAndAddToTempBuffer(&new_msg_header);
+    CreateNewMsgInBuffer(connection_id, srtyp_kSrMessageHb, &write_index, &new_msg_header);
   }
 
-  CopyTempBufferIntoConnectionBuffer(connection_id);
+  // Update the buffer properties, all messages of the rebuilt buffer must be sent. Every message of the rebuilt buffer got its own sequence number.
+  const uint32_t kCreatedMessages = new_msg_header.sequence_number - message_header.sequence_number;  // Unsigned integer wrap around is allowed here.
+  raas_AssertTrue(kCreatedMessages <= (uint32_t)(kStoredElements + kMaxInsertedRetrMessages), radef_kInternalError);
+  const uint16_t kRetrElements = (uint16_t)kCreatedMessages;
+  srsend_instance->send_buffers[connection_id].remove_idx = kFirstIndex;
+  srsend_instance->send_buffers[connection_id].read_idx = kFirstIndex;
+  srsend_instance->send_buffers[connection_id].write_idx = write_index;
+  srsend_instance->send_buffers[connection_id].used_elements = kRetrElements;
+  srsend_instance->send_buffers[connection_id].not_sent_elements = kRetrElements;
 
   // Set new current sequence number
   *new_current_sequence_number = new_msg_header.sequence_number;
@@ -375,18 +513,22 @@ void srsend_PrepareBufferForRetr(const uint32_t connection_id, const uint32_t se
 
 radef_RaStaReturnCode srsend_IsSequenceNumberInBuffer(const uint32_t connection_id, const uint32_t sequence_number) {
   // Input parameter check
-  raas_AssertTrue(srsend_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srsend_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srsend_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInvalidParameter);
 
   radef_RaStaReturnCode ret = radef_kInvalidSequenceNumber;
 
-  if (srsend_send_buffers[connection_id].used_elements != 0U) {
-    for (uint16_t index = 0U; index < srsend_send_buffers[connection_id].used_elements; ++index) {
-      uint16_t element_index = (uint16_t)(srsend_send_buffers[connection_id].remove_idx + index) % RADEF_SEND_BUFFER_SIZE;
+  if (srsend_instance->send_buffers[connection_id].used_elements != 0U) {
+    // The messages have consecutive sequence numbers, so the position of the message follows from the sequence number of the oldest message
+    const uint32_t kOldestSequenceNumber = GetBufferElement(connection_id, srsend_instance->send_buffers[connection_id].remove_idx)->sequence_number;
+    const uint32_t kSequenceNumberOffset = sequence_number - kOldestSequenceNumber;  // Unsigned integer wrap around is allowed here.
+
+    if (kSequenceNumberOffset < srsend_instance->send_buffers[connection_id].used_elements) {
+      uint16_t element_index = srsend_instance->send_buffers[connection_id].remove_idx;
+      IncrementSendBufferIndexAndHandleOverflow(&element_index, (uint16_t)kSequenceNumberOffset);
 
-      if (srmsg_GetMessageSequenceNumber(&srsend_send_buffers[connection_id].buffer[element_index].message) == sequence_number) {
+      if (GetBufferElement(connection_id, element_index)->sequence_number == sequence_number) {
         ret = radef_kNoError;
-        break;  // End for-loop when message with matching sequence number is found
       }
     }
   }
@@ -396,38 +538,30 @@ radef_RaStaReturnCode srsend_IsSequenceNumberInBuffer(const uint32_t connection_
 
 void srsend_RemoveFromBuffer(const uint32_t connection_id, const uint32_t confirmed_sequence_number) {
   // Input parameter check
-  raas_AssertTrue(srsend_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srsend_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srsend_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInvalidParameter);
 
-  if (srsend_send_buffers[connection_id].used_elements != 0U) {  // When no messages in buffer, nothing can be confirmed
-    uint16_t already_send_elements = (uint16_t)(srsend_send_buffers[connection_id].used_elements - srsend_send_buffers[connection_id].not_sent_elements);
+  if (srsend_instance->send_buffers[connection_id].used_elements != 0U) {  // When no messages in buffer, nothing can be confirmed
+    uint16_t already_send_elements =
+        (uint16_t)(srsend_instance->send_buffers[connection_id].used_elements - srsend_instance->send_buffers[connection_id].not_sent_elements);
     raas_AssertTrue(already_send_elements <= RADEF_SEND_BUFFER_SIZE, radef_kInternalError);
 
-    while (srsend_send_buffers[connection_id].used_elements > srsend_send_buffers[connection_id].not_sent_elements) {
-      bool finish_loop = false;
-      uint16_t element_index = srsend_send_buffers[connection_id].remove_idx;  // If elements are removed, the remove index is updated every loop iteration
-
-      // Get sequence number difference. Care about sequence number overflow
-      uint32_t current_sequence_nbr = srmsg_GetMessageSequenceNumber(&srsend_send_buffers[connection_id].buffer[element_index].message);
-      uint32_t sequence_number_difference = confirmed_sequence_number - current_sequence_nbr;  // Unsigned integer wrap around is allowed here.
-
-      if (sequence_number_difference < RADEF_SEND_BUFFER_SIZE) {
-        srsend_send_buffers[connection_id].buffer[element_index].already_sent = false;
-        srsend_send_buffers[connection_id].buffer[element_index].message.message_size = 0U;
+    // Get sequence number difference to the oldest message. Care about sequence number overflow
+    const uint32_t kOldestSequenceNumber = GetBufferElement(connection_id, srsend_instance->send_buffers[connection_id].remove_idx)->sequence_number;
+    const uint32_t kSequenceNumberDifference = confirmed_sequence_number - kOldestSequenceNumber;  // Unsigned integer wrap around is allowed here.
 
-        --srsend_send_buffers[connection_id].used_elements;
-        IncrementSendBufferIndexAndHandleOverflow(&srsend_send_buffers[connection_id].remove_idx, kIndexIncrement);
-
-        // Stop loop if confirmed sequence number is found
-        if (current_sequence_nbr == confirmed_sequence_number) {
-          finish_loop = true;
-        }
-      } else {
-        finish_loop = true;  // Stop loop when newer sequence number is found
+    if (kSequenceNumberDifference < RADEF_SEND_BUFFER_SIZE) {  // Nothing to remove when the confirmed sequence number is older than the oldest message
+      // The messages have consecutive sequence numbers, all messages up to the confirmed one are removed, but only if they are already sent
+      uint16_t confirmed_elements = (uint16_t)(kSequenceNumberDifference + 1U);
+      if (confirmed_elements > already_send_elements) {
+        confirmed_elements = already_send_elements;
       }
 
-      if (finish_loop) {
-        break;
+      for (uint16_t index = 0U; index < confirmed_elements; ++index) {
+        ReleaseMessageSlot(connection_id, srsend_instance->send_buffers[connection_id].remove_idx);
+
+        --srsend_instance->send_buffers[connection_id].used_elements;
+        IncrementSendBufferIndexAndHandleOverflow(&srsend_instance->send_buffers[connection_id].remove_idx, kIndexIncrement);
       }
     }
   }
@@ -435,27 +569,39 @@ void srsend_RemoveFromBuffer(const uint32_t connection_id, const uint32_t confir
 
 uint16_t srsend_GetFreeBufferEntries(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srsend_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srsend_number_of_connections, radef_kInvalidParameter);
-  raas_AssertTrue(RADEF_SEND_BUFFER_SIZE >= srsend_send_buffers[connection_id].used_elements, radef_kInternalError);
+  raas_AssertTrue(srsend_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(RADEF_SEND_BUFFER_SIZE >= srsend_instance->send_buffers[connection_id].used_elements, radef_kInternalError);
+
+  // The used entries of a connection are limited to its share of the slab chunks, which is at most the buffer size
+  uint16_t free_entries = 0U;
+  if (srsend_instance->send_buffers[connection_id].used_elements < srsend_instance->connection_chunk_share) {
+    free_entries = (uint16_t)(srsend_instance->connection_chunk_share - srsend_instance->send_buffers[connection_id].used_elements);
+  }
 
-  return (RADEF_SEND_BUFFER_SIZE - srsend_send_buffers[connection_id].used_elements);
+  // Every free entry must be able to take a message of maximum size, so the entries are limited by the free slab chunks of this size
+  const uint16_t kFreeChunks = raslb_GetNumberOfFreeChunks(RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE);
+  if (kFreeChunks < free_entries) {
+    free_entries = kFreeChunks;
+  }
+
+  return free_entries;
 }
 
 uint16_t srsend_GetUsedBufferEntries(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srsend_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srsend_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srsend_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInvalidParameter);
 
-  return srsend_send_buffers[connection_id].used_elements;
+  return srsend_instance->send_buffers[connection_id].used_elements;
 }
 
 uint16_t srsend_GetNumberOfMessagesToSend(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srsend_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srsend_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srsend_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInvalidParameter);
 
-  return srsend_send_buffers[connection_id].not_sent_elements;
+  return srsend_instance->send_buffers[connection_id].not_sent_elements;
 }
 
 // -----------------------------------------------------------------------------
@@ -464,132 +610,258 @@ uint16_t srsend_GetNumberOfMessagesToSend(const uint32_t connection_id) {
 
 static void InitBuffer(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(connection_id <= srsend_number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInternalError);
+
+  // Free the slab chunks of all stored messages
+  for (uint16_t index = 0U; index < RADEF_SEND_BUFFER_SIZE; ++index) {
+    if (srsend_instance->send_buffers[connection_id].buffer[index].chunk_handle != RASLB_INVALID_CHUNK_HANDLE) {
+      raslb_FreeChunk(srsend_instance->send_buffers[connection_id].buffer[index].chunk_handle);
+      srsend_instance->send_buffers[connection_id].buffer[index].chunk_handle = RASLB_INVALID_CHUNK_HANDLE;
+    }
+  }
 
   // Init buffer for specified connection id
-  srsend_send_buffers[connection_id].read_idx = 0U;
-  srsend_send_buffers[connection_id].write_idx = 0U;
-  srsend_send_buffers[connection_id].remove_idx = 0U;
-  srsend_send_buffers[connection_id].used_elements = 0U;
-  srsend_send_buffers[connection_id].not_sent_elements = 0U;
-
-  // Reset message size and send flag of every element in the buffer of this connection
-  for (uint16_t index = 0U; index < RADEF_MAX_N_SEND_MAX; ++index) {
-    srsend_send_buffers[connection_id].buffer[index].already_sent = false;
-    srsend_send_buffers[connection_id].buffer[index].message.message_size = 0U;
+  srsend_instance->send_buffers[connection_id].read_idx = 0U;
+  srsend_instance->send_buffers[connection_id].write_idx = 0U;
+  srsend_instance->send_buffers[connection_id].remove_idx = 0U;
+  srsend_instance->send_buffers[connection_id].used_elements = 0U;
+  srsend_instance->send_buffers[connection_id].not_sent_elements = 0U;
+  srsend_instance->send_buffers[connection_id].free_slots = RADEF_SEND_BUFFER_SIZE;
+
+  // Reset all buffer positions to unused
+  for (uint16_t index = 0U; index < RADEF_SEND_BUFFER_INDEX_SIZE; ++index) {
+    srsend_instance->send_buffers[connection_id].slot[index] = kUnusedSlot;
+  }
+
+  // Release all message slots and reset message size and send flag of every element in the buffer of this connection
+  for (uint16_t index = 0U; index < RADEF_SEND_BUFFER_SIZE; ++index) {
+    srsend_instance->send_buffers[connection_id].free_slot_stack[index] = (uint16_t)(RADEF_SEND_BUFFER_SIZE - 1U - index);
+    srsend_instance->send_buffers[connection_id].buffer[index].already_sent = false;
+    srsend_instance->send_buffers[connection_id].buffer[index].message_size = 0U;
   }
 }
 
 static void AddToBuffer(const uint32_t connection_id, const srtyp_SrMessage* const message) {
   // Input parameter check
-  raas_AssertTrue(connection_id <= srsend_number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInternalError);
   raas_AssertNotNull(message, radef_kInternalError);
   raas_AssertU16InRange(message->message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
 
-  raas_AssertTrue(srsend_send_buffers[connection_id].used_elements < RADEF_SEND_BUFFER_SIZE, radef_kSendBufferFull);
+  raas_AssertTrue(srsend_instance->send_buffers[connection_id].used_elements < RADEF_SEND_BUFFER_SIZE, radef_kSendBufferFull);
 
   // Add message to buffer
-  SrSendMessage* const buffer_element = &srsend_send_buffers[connection_id].buffer[srsend_send_buffers[connection_id].write_idx];
+  srsend_SendMessage* const buffer_element = AssignFreeMessageSlot(connection_id, srsend_instance->send_buffers[connection_id].write_idx);
 
-  buffer_element->message.message_size = message->message_size;
-  for (uint32_t i = 0U; i < message->message_size; ++i) {
-    buffer_element->message.message[i] = message->message[i];
-  }
-  srsend_send_buffers[connection_id].buffer[srsend_send_buffers[connection_id].write_idx].already_sent = false;
+  raas_AssertTrue(StoreMessage(buffer_element, message), radef_kSendBufferFull);
+  buffer_element->already_sent = false;
 
-  ++srsend_send_buffers[connection_id].used_elements;
-  ++srsend_send_buffers[connection_id].not_sent_elements;
-  IncrementSendBufferIndexAndHandleOverflow(&srsend_send_buffers[connection_id].write_idx, kIndexIncrement);
+  ++srsend_instance->send_buffers[connection_id].used_elements;
+  ++srsend_instance->send_buffers[connection_id].not_sent_elements;
+  IncrementSendBufferIndexAndHandleOverflow(&srsend_instance->send_buffers[connection_id].write_idx, kIndexIncrement);
 }
 
-static void CopyTempBufferIntoConnectionBuffer(const uint32_t connection_id) {
+static srsend_SendMessage* GetBufferElement(const uint32_t connection_id, const uint16_t buffer_index) {
   // Input parameter check
-  raas_AssertTrue(connection_id <= srsend_number_of_connections, radef_kInternalError);
-  raas_AssertTrue(srsend_send_buffers[connection_id].used_elements < RADEF_SEND_BUFFER_SIZE, radef_kInternalError);
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(buffer_index < RADEF_SEND_BUFFER_INDEX_SIZE, radef_kInternalError);
 
-  // Reset send buffer of the connection
-  InitBuffer(connection_id);
+  const uint16_t kSlot = srsend_instance->send_buffers[connection_id].slot[buffer_index];
+  raas_AssertTrue(kSlot < RADEF_SEND_BUFFER_SIZE, radef_kInternalError);
+
+  return &srsend_instance->send_buffers[connection_id].buffer[kSlot];
+}
+
+static bool StoreMessage(srsend_SendMessage* const buffer_element, const srtyp_SrMessage* const message) {
+  // Input parameter check
+  raas_AssertNotNull(buffer_element, radef_kInternalError);
+  raas_AssertNotNull(message, radef_kInternalError);
+  raas_AssertU16InRange(message->message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
 
-  // Copy temp buffer back to send buffer
-  const uint32_t kRetrBufferId = srsend_number_of_connections;
-  srsend_send_buffers[connection_id].read_idx = srsend_send_buffers[kRetrBufferId].read_idx;
-  srsend_send_buffers[connection_id].remove_idx = srsend_send_buffers[kRetrBufferId].remove_idx;
-  srsend_send_buffers[connection_id].write_idx = srsend_send_buffers[kRetrBufferId].write_idx;
-  srsend_send_buffers[connection_id].used_elements = srsend_send_buffers[kRetrBufferId].used_elements;
-  srsend_send_buffers[connection_id].not_sent_elements = srsend_send_buffers[kRetrBufferId].not_sent_elements;
-
-  // Copy messages and transform data & retrData messages
-  for (uint16_t index = 0U; index < srsend_send_buffers[connection_id].used_elements; ++index) {
-    uint16_t element_index = srsend_send_buffers[connection_id].remove_idx;
-    IncrementSendBufferIndexAndHandleOverflow(&element_index, index);
-
-    raas_AssertU16InRange(srsend_send_buffers[kRetrBufferId].buffer[element_index].message.message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE,
-                          RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, radef_kInternalError);
-
-    srsend_send_buffers[connection_id].buffer[element_index].already_sent = srsend_send_buffers[kRetrBufferId].buffer[element_index].already_sent;
-    srsend_send_buffers[connection_id].buffer[element_index].message.message_size =
-        srsend_send_buffers[kRetrBufferId].buffer[element_index].message.message_size;
-
-    for (uint16_t msg_index = 0U; msg_index < srsend_send_buffers[connection_id].buffer[element_index].message.message_size; ++msg_index) {
-      srsend_send_buffers[connection_id].buffer[element_index].message.message[msg_index] =
-          srsend_send_buffers[kRetrBufferId].buffer[element_index].message.message[msg_index];
+  bool message_stored = true;
+  uint16_t chunk_handle = buffer_element->chunk_handle;
+
+  // Allocate a new chunk, if the message does not fit into the chunk of the element
+  if ((chunk_handle == RASLB_INVALID_CHUNK_HANDLE) || (raslb_GetChunkSize(chunk_handle) < message->message_size)) {
+    message_stored = raslb_AllocateChunk(message->message_size, &chunk_handle);
+
+    if (message_stored && (buffer_element->chunk_handle != RASLB_INVALID_CHUNK_HANDLE)) {
+      raslb_FreeChunk(buffer_element->chunk_handle);
+    }
+  }
+
+  if (message_stored) {
+    uint8_t* const chunk_data = raslb_GetChunkData(chunk_handle);
+    for (uint16_t index = 0U; index < message->message_size; ++index) {
+      chunk_data[index] = message->message[index];
+    }
+
+    buffer_element->chunk_handle = chunk_handle;
+    buffer_element->message_size = message->message_size;
+    buffer_element->sequence_number = srmsg_GetMessageSequenceNumber(message);
+    buffer_element->message_type = srmsg_GetMessageType(message);
+    // Data messages are added with one application message, further ones are only packed with srsend_AddPayloadToLastMessage
+    buffer_element->number_of_payloads = 0U;
+    if ((buffer_element->message_type == srtyp_kSrMessageData) || (buffer_element->message_type == srtyp_kSrMessageRetrData)) {
+      buffer_element->number_of_payloads = 1U;
     }
   }
+
+  return message_stored;
 }
 
-static void CreateNewDataMsgAndAddToTempBuffer(const srtyp_SrMessage* const sr_message, srtyp_SrMessageHeaderCreate* const new_msg_header) {
+static void LoadMessage(const srsend_SendMessage* const buffer_element, srtyp_SrMessage* const message) {
   // Input parameter check
-  raas_AssertNotNull(new_msg_header, radef_kInternalError);
-  raas_AssertNotNull(sr_message, radef_kInternalError);
+  raas_AssertNotNull(buffer_element, radef_kInternalError);
+  raas_AssertNotNull(message, radef_kInternalError);
+  raas_AssertU16InRange(buffer_element->message_size, RADEF_SR_LAYER_MESSAGE_HEADER_SIZE, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE,
+                        radef_kInternalError);  // Check if message size is in valid range
 
-  // Extract msg data and create new retrData msg
-  srmsg_GetDataMessagePayload(sr_message, &scratch_message_payload);
-  srmsg_CreateDataMessage(*new_msg_header, &scratch_message_payload, &scratch_message);
+  const uint8_t* const kChunkData = raslb_GetChunkData(buffer_element->chunk_handle);
 
-  // Add retrData msg to temp buffer
-  const uint32_t kRetrBufferId = srsend_number_of_connections;
-  AddToBuffer(kRetrBufferId, &scratch_message);
-  ++new_msg_header->sequence_number;
+  message->message_size = buffer_element->message_size;
+  for (uint16_t index = 0U; index < message->message_size; ++index) {
+    message->message[index] = kChunkData[index];
+  }
 }
 
-static void CreateNewRetrDataMsgAndAddToTempBuffer(const srtyp_SrMessage* const sr_message, srtyp_SrMessageHeaderCreate* const new_msg_header) {
+static void GetMessageView(const srsend_SendMessage* const buffer_element, srtyp_SrMessageView* const message_view) {
   // Input parameter check
-  raas_AssertNotNull(new_msg_header, radef_kInternalError);
-  raas_AssertNotNull(sr_message, radef_kInternalError);
+  raas_AssertNotNull(buffer_element, radef_kInternalError);
+  raas_AssertNotNull(message_view, radef_kInternalError);
 
-  // Extract msg data and create new retrData msg
-  srmsg_GetDataMessagePayload(sr_message, &scratch_message_payload);
-  srmsg_CreateRetrDataMessage(*new_msg_header, &scratch_message_payload, &scratch_message);
+  message_view->message_size = buffer_element->message_size;
+  message_view->buffer_size = raslb_GetChunkSize(buffer_element->chunk_handle);
+  message_view->message = raslb_GetChunkData(buffer_element->chunk_handle);
+}
 
-  // Add retrData msg to temp buffer
-  const uint32_t kRetrBufferId = srsend_number_of_connections;
-  AddToBuffer(kRetrBufferId, &scratch_message);
-  ++new_msg_header->sequence_number;
+static bool AddPayloadToStoredMessage(srsend_SendMessage* const buffer_element, const srtyp_SrMessagePayload* const message_payload) {
+  // Input parameter check
+  raas_AssertNotNull(buffer_element, radef_kInternalError);
+  raas_AssertNotNull(message_payload, radef_kInternalError);
+
+  bool chunk_available = true;
+
+  // Move the message to a bigger chunk, if the extended message does not fit into its chunk. The message size limit is checked when packing the payload.
+  const uint32_t kNewMessageSize = (uint32_t)buffer_element->message_size + RADEF_SR_LAYER_APPLICATION_MESSAGE_LENGTH_SIZE + message_payload->payload_size;
+  if ((kNewMessageSize <= RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE) && (kNewMessageSize > raslb_GetChunkSize(buffer_element->chunk_handle))) {
+    uint16_t chunk_handle = RASLB_INVALID_CHUNK_HANDLE;
+    chunk_available = raslb_AllocateChunk((uint16_t)kNewMessageSize, &chunk_handle);
+
+    if (chunk_available) {
+      const uint8_t* const kOldChunkData = raslb_GetChunkData(buffer_element->chunk_handle);
+      uint8_t* const chunk_data = raslb_GetChunkData(chunk_handle);
+      for (uint16_t index = 0U; index < buffer_element->message_size; ++index) {
+        chunk_data[index] = kOldChunkData[index];
+      }
+
+      raslb_FreeChunk(buffer_element->chunk_handle);
+      buffer_element->chunk_handle = chunk_handle;
+    }
+  }
+
+  bool payload_added = false;
+  if (chunk_available) {
+    const srtyp_SrMessagePayloadView kPayloadView = {message_payload->payload_size, message_payload->payload};
+    srtyp_SrMessageView message_view;
+    GetMessageView(buffer_element, &message_view);
+
+    payload_added = srmsg_AddDataMessagePayload(&kPayloadView, &message_view);
+    if (payload_added) {
+      buffer_element->message_size = message_view.message_size;
+      ++buffer_element->number_of_payloads;
+    }
+  }
+
+  return payload_added;
+}
+
+static srsend_SendMessage* AssignFreeMessageSlot(const uint32_t connection_id, const uint16_t buffer_index) {
+  // Input parameter check
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(buffer_index < RADEF_SEND_BUFFER_INDEX_SIZE, radef_kInternalError);
+  raas_AssertTrue(srsend_instance->send_buffers[connection_id].slot[buffer_index] == kUnusedSlot, radef_kInternalError);
+
+  raas_AssertTrue(srsend_instance->send_buffers[connection_id].free_slots > 0U, radef_kSendBufferFull);
+
+  // Take the message slot from the top of the free slot stack
+  --srsend_instance->send_buffers[connection_id].free_slots;
+  srsend_instance->send_buffers[connection_id].slot[buffer_index] =
+      srsend_instance->send_buffers[connection_id].free_slot_stack[srsend_instance->send_buffers[connection_id].free_slots];
+
+  return GetBufferElement(connection_id, buffer_index);
 }
 
-static void CreateNewHbMsgAndAddToTempBuffer(srtyp_SrMessageHeaderCreate* const new_msg_header) {
+static void ReleaseMessageSlot(const uint32_t connection_id, const uint16_t buffer_index) {
   // Input parameter check
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(buffer_index < RADEF_SEND_BUFFER_INDEX_SIZE, radef_kInternalError);
+  raas_AssertTrue(srsend_instance->send_buffers[connection_id].free_slots < RADEF_SEND_BUFFER_SIZE, radef_kInternalError);
+
+  srsend_SendMessage* const buffer_element = GetBufferElement(connection_id, buffer_index);
+  raslb_FreeChunk(buffer_element->chunk_handle);
+  buffer_element->chunk_handle = RASLB_INVALID_CHUNK_HANDLE;
+  buffer_element->already_sent = false;
+  buffer_element->message_size = 0U;
+
+  // Put the message slot back on the free slot stack
+  srsend_instance->send_buffers[connection_id].free_slot_stack[srsend_instance->send_buffers[connection_id].free_slots] =
+      srsend_instance->send_buffers[connection_id].slot[buffer_index];
+  ++srsend_instance->send_buffers[connection_id].free_slots;
+  srsend_instance->send_buffers[connection_id].slot[buffer_index] = kUnusedSlot;
+}
+
+static void ConvertDataMsgInBuffer(const uint32_t connection_id, const srtyp_SrMessageType message_type, const uint16_t read_index,
+                                   uint16_t* const write_index, srtyp_SrMessageHeaderCreate* const new_msg_header) {
+  // Input parameter check
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(read_index < RADEF_SEND_BUFFER_INDEX_SIZE, radef_kInternalError);
+  raas_AssertNotNull(write_index, radef_kInternalError);
+  raas_AssertTrue(*write_index < RADEF_SEND_BUFFER_INDEX_SIZE, radef_kInternalError);
+  raas_AssertTrue(srsend_instance->send_buffers[connection_id].slot[*write_index] == kUnusedSlot, radef_kInternalError);
   raas_AssertNotNull(new_msg_header, radef_kInternalError);
 
-  // Create new HB msg
-  srmsg_CreateHeartbeatMessage(*new_msg_header, &scratch_message);
+  // Set new header in place in the slab chunk of the stored message, the message size does not change
+  srsend_SendMessage* const buffer_element = GetBufferElement(connection_id, read_index);
+  srtyp_SrMessageView message_view;
+  GetMessageView(buffer_element, &message_view);
+  srmsg_ConvertDataMessage(*new_msg_header, message_type, &message_view);
+  buffer_element->sequence_number = new_msg_header->sequence_number;
+  buffer_element->message_type = message_type;
+  buffer_element->already_sent = false;
+
+  // Move the message slot to the write position
+  srsend_instance->send_buffers[connection_id].slot[*write_index] = srsend_instance->send_buffers[connection_id].slot[read_index];
+  srsend_instance->send_buffers[connection_id].slot[read_index] = kUnusedSlot;
 
-  // Add HB msg to temp buffer
-  const uint32_t kRetrBufferId = srsend_number_of_connections;
-  AddToBuffer(kRetrBufferId, &scratch_message);
+  IncrementSendBufferIndexAndHandleOverflow(write_index, kIndexIncrement);
   ++new_msg_header->sequence_number;
 }
 
-static void CreateNewRetrReqMsgAndAddToTempBuffer(srtyp_SrMessageHeaderCreate* const new_msg_header) {
+static void CreateNewMsgInBuffer(const uint32_t connection_id, const srtyp_SrMessageType message_type, uint16_t* const write_index,
+                                 srtyp_SrMessageHeaderCreate* const new_msg_header) {
   // Input parameter check
+  raas_AssertTrue(connection_id < srsend_instance->number_of_connections, radef_kInternalError);
+  raas_AssertNotNull(write_index, radef_kInternalError);
+  raas_AssertTrue(*write_index < RADEF_SEND_BUFFER_INDEX_SIZE, radef_kInternalError);
   raas_AssertNotNull(new_msg_header, radef_kInternalError);
 
-  // Create new retrReq msg
-  srmsg_CreateRetrReqMessage(*new_msg_header, &scratch_message);
+  if (message_type == srtyp_kSrMessageRetrResp) {
+    srmsg_CreateRetrRespMessage(*new_msg_header, &srsend_instance->scratch_message);
+  } else if (message_type == srtyp_kSrMessageHb) {
+    srmsg_CreateHeartbeatMessage(*new_msg_header, &srsend_instance->scratch_message);
+  } else if (message_type == srtyp_kSrMessageRetrReq) {
+    srmsg_CreateRetrReqMessage(*new_msg_header, &srsend_instance->scratch_message);
+  } else {
+    // Messages with other message types are not created for a retransmission
+    rasys_FatalError(radef_kInternalError);
+  }
+
+  // Store the message in a free message slot at the write position
+  srsend_SendMessage* const buffer_element = AssignFreeMessageSlot(connection_id, *write_index);
+  raas_AssertTrue(StoreMessage(buffer_element, &srsend_instance->scratch_message), radef_kSendBufferFull);
+  buffer_element->already_sent = false;
 
-  // Add retrReq msg to temp buffer
-  const uint32_t kRetrBufferId = srsend_number_of_connections;
-  AddToBuffer(kRetrBufferId, &scratch_message);
+  IncrementSendBufferIndexAndHandleOverflow(write_index, kIndexIncrement);
   ++new_msg_header->sequence_number;
 }
 
@@ -597,10 +869,16 @@ static void IncrementSendBufferIndexAndHandleOverflow(uint16_t* const bufferInde
   // Input parameter check
   raas_AssertNotNull(bufferIndex, radef_kInternalError);
 
-  *bufferIndex += increment;
+  // Manage index overflow, the number of buffer positions is a power of two
+  *bufferIndex = (uint16_t)((uint32_t)(*bufferIndex + increment) & kIndexMask);
+}
 
-  // Manage index overflow
-  if (*bufferIndex >= RADEF_SEND_BUFFER_SIZE) {
-    *bufferIndex -= RADEF_SEND_BUFFER_SIZE;
+static uint16_t GetConnectionChunkShare(const uint32_t configured_connections, const uint32_t slab_chunks) {
+  const uint64_t kChunksPerConnection = (uint64_t)configured_connections * (RADEF_SEND_BUFFER_SIZE + RADEF_MAX_N_SEND_MAX);
+  uint64_t chunk_share = ((uint64_t)slab_chunks * RADEF_SEND_BUFFER_SIZE) / kChunksPerConnection;
+  if (chunk_share > RADEF_SEND_BUFFER_SIZE) {
+    chunk_share = RADEF_SEND_BUFFER_SIZE;
   }
+
+  return (uint16_t)chunk_share;
 }
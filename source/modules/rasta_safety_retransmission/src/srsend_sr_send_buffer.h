@@ -41,6 +41,57 @@
 // Global Type Definitions
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Struct for SafRetL send message.
+ *
+ * The message data is stored in a chunk of the message slab. The sequence number and the message type are kept in the element, so that the buffer can be
+ * managed without reading the message data.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool already_sent;                 ///< was this message already sent (used for retransmission)
+  uint16_t message_size;             ///< used message size [bytes], 0 for an empty element
+  uint16_t chunk_handle;             ///< handle of the slab chunk with the message data, ::RASLB_INVALID_CHUNK_HANDLE for an empty element
+  uint32_t sequence_number;          ///< sequence number of the message
+  srtyp_SrMessageType message_type;  ///< message type of the message
+  uint16_t number_of_payloads;       ///< number of packed application messages of a data or retransmitted data message, 0 for other message types
+} srsend_SendMessage;
+//lint -restore
+
+/**
+ * @brief Struct for SafRetL send messages buffer.
+ *
+ * The buffer indexes address the positions of a ring with ::RADEF_SEND_BUFFER_INDEX_SIZE positions. Since the messages in the buffer have consecutive sequence
+ * numbers, the position of a message follows directly from the difference of its sequence number to the one of the oldest message. Every used position
+ * refers to one of the ::RADEF_SEND_BUFFER_SIZE message slots, so that messages can be moved for a retransmission without copying them.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  uint16_t remove_idx;                                ///< buffer remove index (next confirmed message to remove form the buffer)
+  uint16_t read_idx;                                  ///< buffer read index (next message to transmit or re-transmit)
+  uint16_t write_idx;                                 ///< buffer write index (next new message to write to the buffer)
+  uint16_t used_elements;                             ///< current amount of elements in the buffer
+  uint16_t not_sent_elements;                         ///< current amount of not sent elements in the buffer
+  uint16_t free_slots;                                ///< current amount of free message slots
+  uint16_t free_slot_stack[RADEF_SEND_BUFFER_SIZE];   ///< stack with the numbers of the free message slots
+  uint16_t slot[RADEF_SEND_BUFFER_INDEX_SIZE];        ///< message slot of every buffer position (::RADEF_SEND_BUFFER_SIZE for an unused position)
+  srsend_SendMessage buffer[RADEF_SEND_BUFFER_SIZE];  ///< message slots with the messages, waiting for to be send
+} srsend_SendBuffer;
+//lint -restore
+
+/**
+ * @brief Struct for the data of a SafRetL send buffer instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;                 ///< Initialization state of the module. true, if the module is initialized.
+  uint32_t number_of_connections;   ///< Number of configured RaSTA connections.
+  uint16_t connection_chunk_share;  ///< Number of slab chunks for messages of maximum size, which the send buffer of one connection may use.
+  srsend_SendBuffer* send_buffers;  ///< Send buffers for all configured RaSTA connections, allocated from the connection memory.
+  srtyp_SrMessage scratch_message;  ///< Scratch message to create a message before it is stored in the slab.
+} srsend_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -55,11 +106,16 @@ extern "C" {
 /**
  * @brief Initialize all data of the SafRetL send buffer module.
  *
- * This function is used to initialize the send buffer module. It saves the passed number of connections. For all configured connections, the
- * ::srsend_InitBuffer function is called to properly initialize the buffer for all configured connections. A fatal error is raised, if this function is called
- * multiple times.
+ * This function is used to initialize the send buffer module. It saves the passed number of connections and allocates the send buffers of the configured
+ * connections from the connection memory. For all configured connections, the ::srsend_InitBuffer function is called to properly initialize the buffer for all
+ * configured connections. A fatal error is raised, if this function is called multiple times.
+ * The message slab is sized with ::RADEF_SEND_BUFFER_SIZE + ::RADEF_MAX_N_SEND_MAX chunks for messages of maximum size per connection, of which the send
+ * buffer uses ::RADEF_SEND_BUFFER_SIZE. Every connection gets the same share of the chunks of the slab for its send buffer, at most ::RADEF_SEND_BUFFER_SIZE
+ * chunks. If the share is less than one chunk, a ::radef_kInvalidParameter fatal error is thrown. A configuration is checked with
+ * ::srsend_IsChunkShareSufficient before the initialization.
  *
  * @pre The send buffer module must not be initialized, otherwise a ::radef_kAlreadyInitialized fatal error is thrown.
+ * @pre The message slab must be initialized and all its chunks must be free.
  *
  * @implementsReq{RASW-600} Init sr_send_buffer Function
  *
@@ -67,6 +123,44 @@ extern "C" {
  */
 void srsend_Init(const uint32_t configured_connections);
 
+/**
+ * @brief Select the SafRetL send buffer instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the SafRetL send buffer functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_SR_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void srsend_SelectInstance(const uint32_t instance_index);
+
+/**
+ * @brief Get the size of the connection memory used by the send buffer module.
+ *
+ * This function returns the size of the connection memory, which is allocated by ::srsend_Init for the send buffers of the configured connections. It can be
+ * used before the initialization of the module.
+ *
+ * @param [in] configured_connections Number of configured RaSTA connections. Valid range: 1 <= value <= ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
+ * @return Size of the used connection memory [bytes].
+ */
+uint32_t srsend_GetConnectionMemorySize(const uint32_t configured_connections);
+
+/**
+ * @brief Check if the share of the slab chunks per connection is sufficient for a configuration.
+ *
+ * This function returns, if the share of the slab chunks, which ::srsend_Init gives the send buffer of every connection, can take a full send window of
+ * n_send_max messages and the ::srcty_kMinFreeEntriesSendBufferForRetr entries, which are kept free for a retransmission. Since the share is at most
+ * ::RADEF_SEND_BUFFER_SIZE, a share of ::RADEF_SEND_BUFFER_SIZE chunks is always sufficient. The share is calculated from ::srcty_kSlabConfiguration, so this
+ * function can be used before the initialization of the module. A build with many connections must define ::RADEF_SLAB_NUMBER_OF_LARGE_CHUNKS accordingly.
+ *
+ * @implementsReq{RASW-600} Init sr_send_buffer Function
+ *
+ * @param [in] configured_connections Number of configured RaSTA connections. Valid range: 1 <= value <= ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
+ * @param [in] n_send_max Configured maximum number of unconfirmed messages. Valid range: ::srcty_kMinNSendMax <= value <= ::RADEF_MAX_N_SEND_MAX.
+ * @return true -> the share of the slab chunks is sufficient
+ * @return false -> the share of the slab chunks is too small for the configuration
+ */
+bool srsend_IsChunkShareSufficient(const uint32_t configured_connections, const uint16_t n_send_max);
+
 /**
  * @brief Initialize the send buffer of a dedicated RaSTA connection.
  *
@@ -84,10 +178,12 @@ void srsend_InitBuffer(const uint32_t connection_id);
 /**
  * @brief Add a SafRetL message to the send buffer of a dedicated RaSTA connection.
  *
- * When there is free space in the buffer, a SafRetL message is added to the buffer. If the buffer is full, a ::radef_kSendBufferFull fatal error message
- * is thrown. After adding the message to the buffer, the position index and used entires are updated.
+ * When there is free space in the buffer, a SafRetL message is added to the buffer. If the buffer is full or no slab chunk is available for the message, a
+ * ::radef_kSendBufferFull fatal error message is thrown. After adding the message to the buffer, the position index and used entires are updated.
  *
  * @pre The send buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ * @pre A data or retransmitted data message must contain one application message. Further application messages are packed with
+ * ::srsend_AddPayloadToLastMessage.
  *
  * @implementsReq{RASW-596} Add to Buffer Function
  *
@@ -98,6 +194,27 @@ void srsend_InitBuffer(const uint32_t connection_id);
  */
 void srsend_AddToBuffer(const uint32_t connection_id, const srtyp_SrMessage* const message);
 
+/**
+ * @brief Pack a message payload into the last not yet sent data message of a dedicated RaSTA connection.
+ *
+ * If the last message in the send buffer is a not yet sent ::srtyp_kSrMessageData message, which contains less than the passed maximum number of packed
+ * application messages and still has enough space left, the passed payload is appended to this message and true is returned. In all other cases the send
+ * buffer is not changed and false is returned. The caller must then create a new data message and add it with ::srsend_AddToBuffer.
+ *
+ * @pre The send buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ *
+ * @implementsReq{RASW-596} Add to Buffer Function
+ *
+ * @param [in] connection_id RaSTA connection identification. Valid range: 0 <= value < configured number of connections.
+ * @param [in] max_number_of_payloads Maximum number of application messages packed into one data message (configured n_max_packet). Valid range:
+ * ::srcty_kMinNMaxPacket <= value <= ::srcty_kMaxNMaxPacket.
+ * @param [in] message_payload Pointer to the message payload to pack. If the pointer is NULL, a ::radef_kInvalidParameter fatal error is thrown. The payload
+ * size has a valid range of ::srcty_kMinSrLayerPayloadDataSize <= value <= ::RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE.
+ * @return true -> payload packed into the last not yet sent data message
+ * @return false -> payload not packed, no suitable message in the send buffer
+ */
+bool srsend_AddPayloadToLastMessage(const uint32_t connection_id, const uint32_t max_number_of_payloads, const srtyp_SrMessagePayload* const message_payload);
+
 /**
  * @brief Read a SafRetL message from the send buffer of a dedicated RaSTA connection.
  *
@@ -128,8 +245,10 @@ radef_RaStaReturnCode srsend_ReadMessageToSend(const uint32_t connection_id, srt
  * - the remaining not yet send messages can be added to the buffer. (HB messages must be filtered from beeing send. Only RetrReq and Data are valid, other
  * message types should not be in the buffer anymore)
  * .
+ * The buffer is rebuilt in place: Data & RetrData messages keep their payload and only get a new header, the new messages are created directly in the buffer.
  *
  * @pre The send buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
+ * @pre At least two buffer entries must be free for the RetrResp and a HB message, otherwise a ::radef_kSendBufferFull fatal error is thrown.
  * @pre All messages before and the requested sequence number must be confirmed before calling this method.
  * @pre Sequence number for retransmission must be in the buffer, otherwise a ::radef_kInvalidSequenceNumber fatal error is thrown.
  * @pre It is assumed, that the buffer elements are in proper order with ascending sequence number and without gaps in the sequence numbers.
@@ -151,7 +270,8 @@ void srsend_PrepareBufferForRetr(const uint32_t connection_id, const uint32_t se
  * @brief Checks if a message with a specific sequence number is in the send buffer.
  *
  * This function checks if a specific sequence number is present in the send buffer of a given RaSTA connection and returns ::radef_kNoError if the number is
- * found or ::radef_kInvalidSequenceNumber if its not found.
+ * found or ::radef_kInvalidSequenceNumber if its not found. The buffer position is derived from the difference to the sequence number of the oldest message,
+ * so the buffer is not searched.
  *
  * @pre The send buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
@@ -168,7 +288,7 @@ radef_RaStaReturnCode srsend_IsSequenceNumberInBuffer(const uint32_t connection_
  * @brief Remove confirmed SafRetL messages from the send buffer from a defined sequence number.
  *
  * This function removes the message with a specific sequence number and all previous messages from the send buffer of a dedicated RaSTA connection. If the
- * passed sequence number or its predecessors are not found, nothing is done.
+ * passed sequence number or its predecessors are not found, nothing is done. Only messages which are already sent are removed.
  *
  * @pre The send buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  * @pre Ascending sequence number order of buffer elements is guaranteed by ::srsend_AddToBuffer and ::srsend_PrepareBufferForRetr.
@@ -183,7 +303,10 @@ void srsend_RemoveFromBuffer(const uint32_t connection_id, const uint32_t confir
 /**
  * @brief Get the number of free buffer entries.
  *
- * This function returns the amount of free entires in the send buffer of a given connection.
+ * This function returns the amount of free entires in the send buffer of a given connection. Since the messages are stored in the message slab, which is
+ * shared by all connections, the free entries are limited by the number of free slab chunks for a message of maximum size. To prevent a single connection
+ * from using up the slab chunks of all other connections, the used and free entries of a connection are further limited to its share of the slab chunks (see
+ * ::srsend_Init).
  *
  * @pre The send buffer module must be initialized, otherwise a ::radef_kNotInitialized fatal error is thrown.
  *
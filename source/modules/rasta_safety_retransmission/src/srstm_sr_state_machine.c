@@ -25,8 +25,9 @@
 #include "rasta_common/ralog_rasta_logger.h"
 #include "rasta_common/rasys_rasta_system_adapter.h"
 #include "rasta_safety_retransmission/sraty_sr_api_types.h"
-#include "srcor_sr_core.h"   // NOLINT(build/include_subdir)
-#include "srtyp_sr_types.h"  // NOLINT(build/include_subdir)
+#include "srcor_sr_core.h"               // NOLINT(build/include_subdir)
+#include "srmem_sr_connection_memory.h"  // NOLINT(build/include_subdir)
+#include "srtyp_sr_types.h"              // NOLINT(build/include_subdir)
 
 // -----------------------------------------------------------------------------
 // Local Macro Definitions
@@ -41,25 +42,14 @@
 // -----------------------------------------------------------------------------
 
 /**
- * @brief Initialization state of the module.
- * true, if the module is initialized.
+ * @brief Data of all SafRetL state machine instances.
  */
-PRIVATE bool srstm_initialized = false;
+PRIVATE srstm_InstanceData srstm_instances[RADEF_MAX_NUMBER_OF_SR_INSTANCES];
 
 /**
- * @brief Number of configured RaSTA connections.
+ * @brief Data of the selected SafRetL state machine instance.
  */
-PRIVATE uint32_t srstm_number_of_connections = 0U;
-
-/**
- * @brief State machine states of the RaSTA connections.
- */
-PRIVATE sraty_ConnectionStates srstm_connection_states[RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS];
-
-/**
- * @brief Old state machine states of the RaSTA connections.
- */
-PRIVATE sraty_ConnectionStates srstm_connection_states_old[RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS];
+PRIVATE RADEF_THREAD_LOCAL srstm_InstanceData *srstm_instance = &srstm_instances[0];
 
 // -----------------------------------------------------------------------------
 // Local Function Prototypes
@@ -303,28 +293,46 @@ static void UpdateConnectionStateWithDiscReason(const uint32_t connection_id, co
 
 void srstm_Init(const uint32_t configured_connections) {
   // Input parameter check
-  raas_AssertTrue(!srstm_initialized, radef_kAlreadyInitialized);
+  raas_AssertTrue(!srstm_instance->initialized, radef_kAlreadyInitialized);
   raas_AssertU32InRange(configured_connections, 1, RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, radef_kInvalidParameter);
 
-  srstm_number_of_connections = configured_connections;
-  for (uint32_t index = 0U; index < RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS; ++index) {
-    srstm_connection_states[index] = sraty_kConnectionClosed;
-    srstm_connection_states_old[index] = sraty_kConnectionClosed;
+  srstm_instance->number_of_connections = configured_connections;
+  srstm_instance->connection_states = (sraty_ConnectionStates *)srmem_Allocate(configured_connections * (uint32_t)sizeof(sraty_ConnectionStates));
+  srstm_instance->connection_states_old = (sraty_ConnectionStates *)srmem_Allocate(configured_connections * (uint32_t)sizeof(sraty_ConnectionStates));
+  for (uint32_t index = 0U; index < srstm_instance->number_of_connections; ++index) {
+    srstm_instance->connection_states[index] = sraty_kConnectionClosed;
+    srstm_instance->connection_states_old[index] = sraty_kConnectionClosed;
   }
-  srstm_initialized = true;
+  srstm_instance->initialized = true;
+}
+
+void srstm_SelectInstance(const uint32_t instance_index) {
+  // Input parameter check
+  raas_AssertU32InRange(instance_index, 0U, RADEF_MAX_NUMBER_OF_SR_INSTANCES - 1U, radef_kInvalidParameter);
+
+  srstm_instance = &srstm_instances[instance_index];
+}
+
+uint32_t srstm_GetConnectionMemorySize(const uint32_t configured_connections) {
+  // Input parameter check
+  raas_AssertU32InRange(configured_connections, 1, RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, radef_kInvalidParameter);
+
+  // Current and old states of all configured connections
+  const uint32_t kStatesSize = srmem_GetTableAllocationSize(configured_connections, (uint32_t)sizeof(sraty_ConnectionStates));
+  return srmem_AddAllocationSizes(kStatesSize, kStatesSize);
 }
 
 void srstm_ProcessConnectionStateMachine(const uint32_t connection_id, const srtyp_ConnectionEvents event, const bool sequence_number_in_seq,
                                          const bool confirmed_time_stamp_in_seq) {
   // Input parameter check
-  raas_AssertTrue(srstm_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srstm_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInvalidParameter);
   raas_AssertU16InRange((uint16_t)event, (uint16_t)srtyp_kConnEventMin, (uint16_t)srtyp_kConnEventMax - 1U, radef_kInvalidParameter);
 
   // Save current state
-  srstm_connection_states_old[connection_id] = srstm_connection_states[connection_id];
+  srstm_instance->connection_states_old[connection_id] = srstm_instance->connection_states[connection_id];
 
-  switch (srstm_connection_states[connection_id]) {
+  switch (srstm_instance->connection_states[connection_id]) {
     case sraty_kConnectionClosed:
       ProcessStateClosedEvents(connection_id, event);
       break;
@@ -354,10 +362,10 @@ void srstm_ProcessConnectionStateMachine(const uint32_t connection_id, const srt
 
 sraty_ConnectionStates srstm_GetConnectionState(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(srstm_initialized, radef_kNotInitialized);
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInvalidParameter);
+  raas_AssertTrue(srstm_instance->initialized, radef_kNotInitialized);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInvalidParameter);
 
-  return srstm_connection_states[connection_id];
+  return srstm_instance->connection_states[connection_id];
 }
 
 // -----------------------------------------------------------------------------
@@ -366,8 +374,8 @@ sraty_ConnectionStates srstm_GetConnectionState(const uint32_t connection_id) {
 
 static void ProcessStateClosedEvents(const uint32_t connection_id, const srtyp_ConnectionEvents event) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
-  raas_AssertTrue(srstm_connection_states[connection_id] == sraty_kConnectionClosed, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(srstm_instance->connection_states[connection_id] == sraty_kConnectionClosed, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)event, (uint16_t)srtyp_kConnEventMin, (uint16_t)srtyp_kConnEventMax - 1U, radef_kInternalError);
 
   switch (event) {
@@ -405,8 +413,8 @@ static void ProcessStateClosedEvents(const uint32_t connection_id, const srtyp_C
 
 static void ProcessStateDownEvents(const uint32_t connection_id, const srtyp_ConnectionEvents event) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
-  raas_AssertTrue(srstm_connection_states[connection_id] == sraty_kConnectionDown, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(srstm_instance->connection_states[connection_id] == sraty_kConnectionDown, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)event, (uint16_t)srtyp_kConnEventMin, (uint16_t)srtyp_kConnEventMax - 1U, radef_kInternalError);
 
   switch (event) {
@@ -448,8 +456,8 @@ static void ProcessStateDownEvents(const uint32_t connection_id, const srtyp_Con
 static void ProcessStateStartEvents(const uint32_t connection_id, const srtyp_ConnectionEvents event, const bool sequence_number_in_seq,
                                     const bool confirmed_time_stamp_in_seq) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
-  raas_AssertTrue(srstm_connection_states[connection_id] == sraty_kConnectionStart, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(srstm_instance->connection_states[connection_id] == sraty_kConnectionStart, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)event, (uint16_t)srtyp_kConnEventMin, (uint16_t)srtyp_kConnEventMax - 1U, radef_kInternalError);
 
   switch (event) {
@@ -528,8 +536,8 @@ static void ProcessStateStartEvents(const uint32_t connection_id, const srtyp_Co
 static void ProcessStateUpEvents(const uint32_t connection_id, const srtyp_ConnectionEvents event, const bool sequence_number_in_seq,
                                  const bool confirmed_time_stamp_in_seq) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
-  raas_AssertTrue(srstm_connection_states[connection_id] == sraty_kConnectionUp, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(srstm_instance->connection_states[connection_id] == sraty_kConnectionUp, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)event, (uint16_t)srtyp_kConnEventMin, (uint16_t)srtyp_kConnEventMax - 1U, radef_kInternalError);
 
   switch (event) {
@@ -603,8 +611,8 @@ static void ProcessStateUpEvents(const uint32_t connection_id, const srtyp_Conne
 
 static void ProcessStateRetransRequestEvents(const uint32_t connection_id, const srtyp_ConnectionEvents event, const bool sequence_number_in_seq) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
-  raas_AssertTrue(srstm_connection_states[connection_id] == sraty_kConnectionRetransRequest, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(srstm_instance->connection_states[connection_id] == sraty_kConnectionRetransRequest, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)event, (uint16_t)srtyp_kConnEventMin, (uint16_t)srtyp_kConnEventMax - 1U, radef_kInternalError);
 
   switch (event) {
@@ -669,8 +677,8 @@ static void ProcessStateRetransRequestEvents(const uint32_t connection_id, const
 static void ProcessStateRetransRunningEvents(const uint32_t connection_id, const srtyp_ConnectionEvents event, const bool sequence_number_in_seq,
                                              const bool confirmed_time_stamp_in_seq) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
-  raas_AssertTrue(srstm_connection_states[connection_id] == sraty_kConnectionRetransRunning, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
+  raas_AssertTrue(srstm_instance->connection_states[connection_id] == sraty_kConnectionRetransRunning, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)event, (uint16_t)srtyp_kConnEventMin, (uint16_t)srtyp_kConnEventMax - 1U, radef_kInternalError);
 
   switch (event) {
@@ -744,7 +752,7 @@ static void ProcessStateRetransRunningEvents(const uint32_t connection_id, const
 
 static bool ProcessReceivedMessage(const uint32_t connection_id) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
 
   const bool kTimelinessRespected = srcor_ProcessReceivedMessage(connection_id);  // [3] Regular processing of the message received
   if (!kTimelinessRespected) {
@@ -756,7 +764,7 @@ static bool ProcessReceivedMessage(const uint32_t connection_id) {
 
 static void CloseConnection(const uint32_t connection_id, const sraty_DiscReason disconnect_reason, const bool is_incoming_message) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)disconnect_reason, (uint16_t)sraty_kDiscReasonMin, (uint16_t)sraty_kDiscReasonMax - 1U, radef_kInternalError);
 
   if (is_incoming_message) {
@@ -769,7 +777,7 @@ static void CloseConnection(const uint32_t connection_id, const sraty_DiscReason
 
 static void CloseRedundancyChannel(const uint32_t connection_id, const bool is_incoming_message) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
 
   if (is_incoming_message) {
     srcor_UpdateConfirmedTxSequenceNumber(connection_id);  // [1] Set CS_T = SN_PDU for incoming messages
@@ -782,7 +790,7 @@ static void CloseRedundancyChannel(const uint32_t connection_id, const bool is_i
 
 static void StartRetransmission(const uint32_t connection_id, const sraty_ConnectionStates new_state, bool retransmission_requested) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)new_state, (uint16_t)sraty_kConnectionMin, (uint16_t)sraty_kConnectionMax - 1U, radef_kInternalError);
 
   srcor_UpdateConfirmedRxSequenceNumber(connection_id);  // [4] Further event treatment (CR_R = CS_PDU)
@@ -795,7 +803,7 @@ static void StartRetransmission(const uint32_t connection_id, const sraty_Connec
 
 static void UpdateConnectionState(const uint32_t connection_id, const sraty_ConnectionStates new_state) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)new_state, (uint16_t)sraty_kConnectionMin, (uint16_t)sraty_kConnectionMax - 1U, radef_kInternalError);
 
   UpdateConnectionStateWithDiscReason(connection_id, new_state, sraty_kDiscReasonNotInUse);
@@ -804,12 +812,12 @@ static void UpdateConnectionState(const uint32_t connection_id, const sraty_Conn
 static void UpdateConnectionStateWithDiscReason(const uint32_t connection_id, const sraty_ConnectionStates new_state,
                                                 const sraty_DiscReason disconnect_reason) {
   // Input parameter check
-  raas_AssertTrue(connection_id < srstm_number_of_connections, radef_kInternalError);
+  raas_AssertTrue(connection_id < srstm_instance->number_of_connections, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)new_state, (uint16_t)sraty_kConnectionMin, (uint16_t)sraty_kConnectionMax - 1U, radef_kInternalError);
   raas_AssertU16InRange((uint16_t)disconnect_reason, (uint16_t)sraty_kDiscReasonMin, (uint16_t)sraty_kDiscReasonMax - 1U, radef_kInternalError);
 
-  if (new_state != srstm_connection_states_old[connection_id]) {
-    srstm_connection_states[connection_id] = new_state;
-    srcor_SendConnectionStateNotification(connection_id, srstm_connection_states[connection_id], disconnect_reason);
+  if (new_state != srstm_instance->connection_states_old[connection_id]) {
+    srstm_instance->connection_states[connection_id] = new_state;
+    srcor_SendConnectionStateNotification(connection_id, srstm_instance->connection_states[connection_id], disconnect_reason);
   }
 }
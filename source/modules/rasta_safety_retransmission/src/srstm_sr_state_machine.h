@@ -46,6 +46,18 @@
 // Global Type Definitions
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief Struct for the data of a SafRetL state machine instance.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  bool initialized;                               ///< Initialization state of the module. true, if the module is initialized.
+  uint32_t number_of_connections;                 ///< Number of configured RaSTA connections.
+  sraty_ConnectionStates *connection_states;      ///< State machine states of the RaSTA connections, allocated from the connection memory.
+  sraty_ConnectionStates *connection_states_old;  ///< Old state machine states of the RaSTA connections, allocated from the connection memory.
+} srstm_InstanceData;
+//lint -restore
+
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -60,8 +72,8 @@ extern "C" {
 /**
  * @brief Initialize SafRetL state machine module.
  *
- * This function is used to initialize the state machine module. It saves the passed number of configured connections. A fatal error is raised, if this
- * function is called multiple times.
+ * This function is used to initialize the state machine module. It saves the passed number of configured connections and allocates the states of the
+ * configured connections from the connection memory. A fatal error is raised, if this function is called multiple times.
  *
  * @pre The state machine module must not be initialized, otherwise a ::radef_kAlreadyInitialized fatal error is thrown.
  *
@@ -71,6 +83,27 @@ extern "C" {
  */
 void srstm_Init(const uint32_t configured_connections);
 
+/**
+ * @brief Select the SafRetL state machine instance.
+ *
+ * This function selects the instance, whose data is used by all following calls of the SafRetL state machine functions.
+ *
+ * @param [in] instance_index Index of the instance. Valid range: 0 <= value < ::RADEF_MAX_NUMBER_OF_SR_INSTANCES. If the value is outside this range, a
+ * ::radef_kInvalidParameter fatal error is thrown.
+ */
+void srstm_SelectInstance(const uint32_t instance_index);
+
+/**
+ * @brief Get the size of the connection memory used by the state machine module.
+ *
+ * This function returns the size of the connection memory, which is allocated by ::srstm_Init for the states of the configured connections. It can be used
+ * before the initialization of the module.
+ *
+ * @param [in] configured_connections Number of configured RaSTA connections. Valid range: 1 <= value <= ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
+ * @return Size of the used connection memory [bytes].
+ */
+uint32_t srstm_GetConnectionMemorySize(const uint32_t configured_connections);
+
 /**
  * @brief Process RaSTA connection state machine.
  *
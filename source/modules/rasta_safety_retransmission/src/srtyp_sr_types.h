@@ -146,6 +146,33 @@ typedef struct {
 } srtyp_SrMessagePayload;
 //lint -restore
 
+/**
+ * @brief Typedef for a read-only view of a SafRetL PDU message payload.
+ *
+ * The view does not own the payload data, it points directly into the payload area of a ::srtyp_SrMessage. The view is only valid as long as the message it
+ * points into is not modified.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  uint16_t payload_size;   ///< Used payload size [bytes]. Valid range: ::srcty_kMinSrLayerPayloadDataSize <= value <= RADEF_MAX_SR_LAYER_PAYLOAD_DATA_SIZE.
+  const uint8_t *payload;  ///< Pointer to the first payload byte. For the message payload the full value range is valid and usable.
+} srtyp_SrMessagePayloadView;
+//lint -restore
+
+/**
+ * @brief Typedef for a view of a SafRetL PDU message stored outside of a ::srtyp_SrMessage.
+ *
+ * The view does not own the message data, it points directly into the memory of a stored message, e.g. a slab chunk of the send buffer. It allows to modify
+ * a stored message in place, without copying it into a ::srtyp_SrMessage.
+ */
+//lint -save -e9045 (structures are defined globally)
+typedef struct {
+  uint16_t message_size;  ///< Used message size [bytes]. Valid range: ::RADEF_SR_LAYER_MESSAGE_HEADER_SIZE <= value <= buffer_size.
+  uint16_t buffer_size;   ///< Size of the memory the view points to [bytes]. Valid range: message_size <= value <= ::RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE.
+  uint8_t *message;       ///< Pointer to the first message byte. For the message data the full value range is valid and usable.
+} srtyp_SrMessageView;
+//lint -restore
+
 /**
  * @brief Typedef for RaSTA protocol version array.
  */
@@ -41,23 +41,23 @@ extern "C" {
     ASSERT_NE(sradinMock::getInstance(), nullptr) << "Mock object not initialized!";
     sradinMock::getInstance()->sradin_Init();
   }
-  void sradin_OpenRedundancyChannel(const uint32_t redundancy_channel_id){
+  void sradin_OpenRedundancyChannel(srapi_Instance *const instance, const uint32_t redundancy_channel_id){
     ASSERT_NE(sradinMock::getInstance(), nullptr) << "Mock object not initialized!";
-    sradinMock::getInstance()->sradin_OpenRedundancyChannel(redundancy_channel_id);
+    sradinMock::getInstance()->sradin_OpenRedundancyChannel(instance, redundancy_channel_id);
   }
-  void sradin_CloseRedundancyChannel(const uint32_t redundancy_channel_id){
+  void sradin_CloseRedundancyChannel(srapi_Instance *const instance, const uint32_t redundancy_channel_id){
     ASSERT_NE(sradinMock::getInstance(), nullptr) << "Mock object not initialized!";
-    sradinMock::getInstance()->sradin_CloseRedundancyChannel(redundancy_channel_id);
+    sradinMock::getInstance()->sradin_CloseRedundancyChannel(instance, redundancy_channel_id);
   }
-  void sradin_SendMessage(const uint32_t redundancy_channel_id, const uint16_t message_size, const uint8_t * message_data){
+  void sradin_SendMessage(srapi_Instance *const instance, const uint32_t redundancy_channel_id, const uint16_t message_size, const uint8_t * message_data){
     ASSERT_NE(sradinMock::getInstance(), nullptr) << "Mock object not initialized!";
-    sradinMock::getInstance()->sradin_SendMessage(redundancy_channel_id, message_size, message_data);
+    sradinMock::getInstance()->sradin_SendMessage(instance, redundancy_channel_id, message_size, message_data);
   }
-  radef_RaStaReturnCode sradin_ReadMessage(const uint32_t redundancy_channel_id, const uint16_t buffer_size, uint16_t * message_size, uint8_t * message_buffer){
+  radef_RaStaReturnCode sradin_ReadMessage(srapi_Instance *const instance, const uint32_t redundancy_channel_id, const uint16_t buffer_size, uint16_t * message_size, uint8_t * message_buffer){
     if(sradinMock::getInstance() == nullptr) {
       ADD_FAILURE() << "Mock object not initialized!";
     }
-    return sradinMock::getInstance()->sradin_ReadMessage(redundancy_channel_id, buffer_size, message_size, message_buffer);
+    return sradinMock::getInstance()->sradin_ReadMessage(instance, redundancy_channel_id, buffer_size, message_size, message_buffer);
   }
 }
 
@@ -20,6 +20,7 @@
 // -----------------------------------------------------------------------------
 #include "gmock/gmock.h"
 #include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_safety_retransmission/sraty_sr_api_types.h"
 
 // -----------------------------------------------------------------------------
 // Mock class
@@ -49,22 +50,22 @@ public:
   /**
   * @brief Mock Method object for the sradin_OpenRedundancyChannel function
   */
-  MOCK_METHOD(void, sradin_OpenRedundancyChannel, (const uint32_t redundancy_channel_id));
+  MOCK_METHOD(void, sradin_OpenRedundancyChannel, (srapi_Instance * instance, const uint32_t redundancy_channel_id));
 
   /**
   * @brief Mock Method object for the sradin_CloseRedundancyChannel function
   */
-  MOCK_METHOD(void, sradin_CloseRedundancyChannel, (const uint32_t redundancy_channel_id));
+  MOCK_METHOD(void, sradin_CloseRedundancyChannel, (srapi_Instance * instance, const uint32_t redundancy_channel_id));
 
   /**
   * @brief Mock Method object for the sradin_SendMessage function
   */
-  MOCK_METHOD(void, sradin_SendMessage, (const uint32_t redundancy_channel_id, const uint16_t message_size, const uint8_t * message_data));
+  MOCK_METHOD(void, sradin_SendMessage, (srapi_Instance * instance, const uint32_t redundancy_channel_id, const uint16_t message_size, const uint8_t * message_data));
 
   /**
   * @brief Mock Method object for the sradin_ReadMessage function
   */
-  MOCK_METHOD(radef_RaStaReturnCode, sradin_ReadMessage, (const uint32_t redundancy_channel_id, const uint16_t buffer_size, uint16_t * message_size, uint8_t * message_buffer));
+  MOCK_METHOD(radef_RaStaReturnCode, sradin_ReadMessage, (srapi_Instance * instance, const uint32_t redundancy_channel_id, const uint16_t buffer_size, uint16_t * message_size, uint8_t * message_buffer));
 
   /**
   * @brief Get the Instance object
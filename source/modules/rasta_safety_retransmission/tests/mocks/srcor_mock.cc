@@ -47,6 +47,12 @@ extern "C" {
     ASSERT_NE(srcorMock::getInstance(), nullptr) << "Mock object not initialized!";
     srcorMock::getInstance()->srcor_Init(sr_layer_configuration);
   }
+  uint32_t srcor_GetConnectionMemorySize(const uint32_t configured_connections){
+    if(srcorMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srcorMock::getInstance()->srcor_GetConnectionMemorySize(configured_connections);
+  }
   radef_RaStaReturnCode srcor_GetConnectionId(const uint32_t sender_id, const uint32_t receiver_id, uint32_t * connection_id){
     if(srcorMock::getInstance() == nullptr) {
       ADD_FAILURE() << "Mock object not initialized!";
@@ -159,6 +165,18 @@ extern "C" {
     }
     return srcorMock::getInstance()->srcor_IsHeartbeatInterval(connection_id);
   }
+  bool srcor_GetExpiredTimerConnection(uint32_t *const connection_id){
+    if(srcorMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srcorMock::getInstance()->srcor_GetExpiredTimerConnection(connection_id);
+  }
+  bool srcor_GetTimeToNextDeadline(uint32_t *const time_to_next_deadline){
+    if(srcorMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srcorMock::getInstance()->srcor_GetTimeToNextDeadline(time_to_next_deadline);
+  }
   bool srcor_IsReceivedMsgPendingAndBuffersNotFull(const uint32_t connection_id){
     if(srcorMock::getInstance() == nullptr) {
       ADD_FAILURE() << "Mock object not initialized!";
@@ -177,6 +195,10 @@ extern "C" {
     ASSERT_NE(srcorMock::getInstance(), nullptr) << "Mock object not initialized!";
     srcorMock::getInstance()->srcor_GetBufferSizeAndUtilisation(connection_id, buffer_utilisation, opposite_buffer_size);
   }
+  void srcor_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(srcorMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srcorMock::getInstance()->srcor_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -54,6 +54,11 @@ public:
   */
   MOCK_METHOD(void, srcor_Init, (const srcty_SafetyRetransmissionConfiguration * sr_layer_configuration));
 
+  /**
+  * @brief Mock Method object for the srcor_GetConnectionMemorySize function
+  */
+  MOCK_METHOD(uint32_t, srcor_GetConnectionMemorySize, (const uint32_t configured_connections));
+
   /**
   * @brief Mock Method object for the srcor_GetConnectionId function
   */
@@ -174,6 +179,16 @@ public:
   */
   MOCK_METHOD(bool, srcor_IsHeartbeatInterval, (const uint32_t connection_id));
 
+  /**
+  * @brief Mock Method object for the srcor_GetExpiredTimerConnection function
+  */
+  MOCK_METHOD(bool, srcor_GetExpiredTimerConnection, (uint32_t *const connection_id));
+
+  /**
+  * @brief Mock Method object for the srcor_GetTimeToNextDeadline function
+  */
+  MOCK_METHOD(bool, srcor_GetTimeToNextDeadline, (uint32_t *const time_to_next_deadline));
+
   /**
   * @brief Mock Method object for the srcor_IsReceivedMsgPendingAndBuffersNotFull function
   */
@@ -194,6 +209,11 @@ public:
   */
   MOCK_METHOD(void, srcor_GetBufferSizeAndUtilisation, (const uint32_t connection_id, sraty_BufferUtilisation * buffer_utilisation, uint16_t * opposite_buffer_size));
 
+  /**
+  * @brief Mock Method object for the srcor_SelectInstance function
+  */
+  MOCK_METHOD(void, srcor_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
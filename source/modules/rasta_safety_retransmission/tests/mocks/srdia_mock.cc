@@ -47,6 +47,12 @@ extern "C" {
     ASSERT_NE(srdiaMock::getInstance(), nullptr) << "Mock object not initialized!";
     srdiaMock::getInstance()->srdia_Init(configured_connections, t_max, n_diag_window, diag_timing_distr_intervals);
   }
+  uint32_t srdia_GetConnectionMemorySize(const uint32_t configured_connections){
+    if(srdiaMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srdiaMock::getInstance()->srdia_GetConnectionMemorySize(configured_connections);
+  }
   void srdia_InitConnectionDiagnostics(const uint32_t connection_id){
     ASSERT_NE(srdiaMock::getInstance(), nullptr) << "Mock object not initialized!";
     srdiaMock::getInstance()->srdia_InitConnectionDiagnostics(connection_id);
@@ -79,6 +85,10 @@ extern "C" {
     ASSERT_NE(srdiaMock::getInstance(), nullptr) << "Mock object not initialized!";
     srdiaMock::getInstance()->srdia_SendDiagnosticNotification(connection_id);
   }
+  void srdia_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(srdiaMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srdiaMock::getInstance()->srdia_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -51,6 +51,11 @@ public:
   */
   MOCK_METHOD(void, srdia_Init, (const uint32_t configured_connections, const uint32_t t_max, const uint32_t n_diag_window, const uint32_t * diag_timing_distr_intervals));
 
+  /**
+  * @brief Mock Method object for the srdia_GetConnectionMemorySize function
+  */
+  MOCK_METHOD(uint32_t, srdia_GetConnectionMemorySize, (const uint32_t configured_connections));
+
   /**
   * @brief Mock Method object for the srdia_InitConnectionDiagnostics function
   */
@@ -91,6 +96,11 @@ public:
   */
   MOCK_METHOD(void, srdia_SendDiagnosticNotification, (const uint32_t connection_id));
 
+  /**
+  * @brief Mock Method object for the srdia_SelectInstance function
+  */
+  MOCK_METHOD(void, srdia_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
@@ -0,0 +1,67 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srins_mock.cc
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version fe457be274667230cc30cc95371dedfe439bab25
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock source file for the srins module
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "srins_mock.hh"
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+srinsMock * srinsMock::instance = NULL;
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+srinsMock::srinsMock() {
+  instance = this;
+}
+
+srinsMock::~srinsMock() {
+  instance = NULL;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+extern "C" {
+
+  bool srins_IsInstanceAvailable(void){
+    if(srinsMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srinsMock::getInstance()->srins_IsInstanceAvailable();
+  }
+
+  srapi_Instance * srins_CreateInstance(void){
+    if(srinsMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srinsMock::getInstance()->srins_CreateInstance();
+  }
+
+  void srins_SelectInstance(srapi_Instance *const instance){
+    ASSERT_NE(srinsMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srinsMock::getInstance()->srins_SelectInstance(instance);
+  }
+
+  srapi_Instance * srins_GetSelectedInstance(void){
+    if(srinsMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srinsMock::getInstance()->srins_GetSelectedInstance();
+  }
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -0,0 +1,74 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srins_mock.hh
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version fe457be274667230cc30cc95371dedfe439bab25
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock header file for the srins module
+ */
+
+#ifndef SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_MOCKS_SRINS_MOCK_HH_
+#define SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_MOCKS_SRINS_MOCK_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "gmock/gmock.h"
+#include "srins_sr_instances.h"
+
+// -----------------------------------------------------------------------------
+// Mock class
+// -----------------------------------------------------------------------------
+/**
+ * @brief Mock class for the rasta srins class
+ */
+class srinsMock {
+private:
+  static srinsMock *instance;  ///< srinsMock instance
+
+public:
+  /**
+  * @brief srinsMock constructor
+  */
+  srinsMock();
+  /**
+  * @brief srinsMock destructor
+  */
+  virtual ~srinsMock();
+
+  /**
+  * @brief Mock Method object for the srins_IsInstanceAvailable function
+  */
+  MOCK_METHOD(bool, srins_IsInstanceAvailable, ());
+
+  /**
+  * @brief Mock Method object for the srins_CreateInstance function
+  */
+  MOCK_METHOD(srapi_Instance *, srins_CreateInstance, ());
+
+  /**
+  * @brief Mock Method object for the srins_SelectInstance function
+  */
+  MOCK_METHOD(void, srins_SelectInstance, (srapi_Instance * instance));
+
+  /**
+  * @brief Mock Method object for the srins_GetSelectedInstance function
+  */
+  MOCK_METHOD(srapi_Instance *, srins_GetSelectedInstance, ());
+
+  /**
+  * @brief Get the Instance object
+  *
+  * @return srinsMock*
+  */
+  static srinsMock *getInstance() {
+    return instance;
+  }
+};
+
+#endif // SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_MOCKS_SRINS_MOCK_HH_
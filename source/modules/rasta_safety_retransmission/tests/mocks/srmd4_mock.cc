@@ -41,6 +41,11 @@ extern "C" {
     ASSERT_NE(srmd4Mock::getInstance(), nullptr) << "Mock object not initialized!";
     srmd4Mock::getInstance()->srmd4_CalculateMd4(md4_initial_value, data_size, data_buffer, calculated_md4);
   }
+
+  void srmd4_CalculateMd4Batch(const srcty_Md4InitValue md4_initial_value, const uint16_t number_of_entries, const srmd4_Md4BatchEntry * entries){
+    ASSERT_NE(srmd4Mock::getInstance(), nullptr) << "Mock object not initialized!";
+    srmd4Mock::getInstance()->srmd4_CalculateMd4Batch(md4_initial_value, number_of_entries, entries);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -48,6 +48,11 @@ public:
   */
   MOCK_METHOD(void, srmd4_CalculateMd4, (const srcty_Md4InitValue md4_initial_value, const uint16_t data_size, const uint8_t * data_buffer, srmd4_Md4 * calculated_md4));
 
+  /**
+  * @brief Mock Method object for the srmd4_CalculateMd4Batch function
+  */
+  MOCK_METHOD(void, srmd4_CalculateMd4Batch, (const srcty_Md4InitValue md4_initial_value, const uint16_t number_of_entries, const srmd4_Md4BatchEntry * entries));
+
   /**
   * @brief Get the Instance object
   *
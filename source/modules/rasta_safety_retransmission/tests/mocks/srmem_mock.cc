@@ -0,0 +1,79 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srmem_mock.cc
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version fe457be274667230cc30cc95371dedfe439bab25
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock source file for the srmem module
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "srmem_mock.hh"
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+srmemMock * srmemMock::instance = NULL;
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+srmemMock::srmemMock() {
+  instance = this;
+}
+
+srmemMock::~srmemMock() {
+  instance = NULL;
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+extern "C" {
+
+  void srmem_Init(void * connection_memory, const uint32_t connection_memory_size){
+    ASSERT_NE(srmemMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srmemMock::getInstance()->srmem_Init(connection_memory, connection_memory_size);
+  }
+
+  void * srmem_Allocate(const uint32_t size){
+    if(srmemMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srmemMock::getInstance()->srmem_Allocate(size);
+  }
+
+  uint32_t srmem_GetAllocationSize(const uint32_t size){
+    if(srmemMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srmemMock::getInstance()->srmem_GetAllocationSize(size);
+  }
+
+  uint32_t srmem_GetTableAllocationSize(const uint32_t number_of_entries, const uint32_t entry_size){
+    if(srmemMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srmemMock::getInstance()->srmem_GetTableAllocationSize(number_of_entries, entry_size);
+  }
+
+  uint32_t srmem_AddAllocationSizes(const uint32_t allocation_size, const uint32_t additional_allocation_size){
+    if(srmemMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srmemMock::getInstance()->srmem_AddAllocationSizes(allocation_size, additional_allocation_size);
+  }
+
+  void srmem_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(srmemMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srmemMock::getInstance()->srmem_SelectInstance(instance_index);
+  }
+}
+
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
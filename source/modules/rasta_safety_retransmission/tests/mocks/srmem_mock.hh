@@ -0,0 +1,84 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srmem_mock.hh
+ *
+ * @author TST, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version fe457be274667230cc30cc95371dedfe439bab25
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Mock header file for the srmem module
+ */
+
+#ifndef SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_MOCKS_SRMEM_MOCK_HH_
+#define SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_MOCKS_SRMEM_MOCK_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include "gmock/gmock.h"
+#include "srmem_sr_connection_memory.h"
+
+// -----------------------------------------------------------------------------
+// Mock class
+// -----------------------------------------------------------------------------
+/**
+ * @brief Mock class for the rasta srmem class
+ */
+class srmemMock {
+private:
+  static srmemMock *instance;  ///< srmemMock instance
+
+public:
+  /**
+  * @brief srmemMock constructor
+  */
+  srmemMock();
+  /**
+  * @brief srmemMock destructor
+  */
+  virtual ~srmemMock();
+
+  /**
+  * @brief Mock Method object for the srmem_Init function
+  */
+  MOCK_METHOD(void, srmem_Init, (void * connection_memory, const uint32_t connection_memory_size));
+
+  /**
+  * @brief Mock Method object for the srmem_Allocate function
+  */
+  MOCK_METHOD(void *, srmem_Allocate, (const uint32_t size));
+
+  /**
+  * @brief Mock Method object for the srmem_GetAllocationSize function
+  */
+  MOCK_METHOD(uint32_t, srmem_GetAllocationSize, (const uint32_t size));
+
+  /**
+  * @brief Mock Method object for the srmem_GetTableAllocationSize function
+  */
+  MOCK_METHOD(uint32_t, srmem_GetTableAllocationSize, (const uint32_t number_of_entries, const uint32_t entry_size));
+
+  /**
+  * @brief Mock Method object for the srmem_AddAllocationSizes function
+  */
+  MOCK_METHOD(uint32_t, srmem_AddAllocationSizes, (const uint32_t allocation_size, const uint32_t additional_allocation_size));
+
+  /**
+  * @brief Mock Method object for the srmem_SelectInstance function
+  */
+  MOCK_METHOD(void, srmem_SelectInstance, (const uint32_t instance_index));
+
+  /**
+  * @brief Get the Instance object
+  *
+  * @return srmemMock*
+  */
+  static srmemMock *getInstance() {
+    return instance;
+  }
+};
+
+#endif // SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_MOCKS_SRMEM_MOCK_HH_
@@ -57,6 +57,16 @@ extern "C" {
     ASSERT_NE(srmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
     srmsgMock::getInstance()->srmsg_CreateRetrDataMessage(message_header, message_payload, sr_message);
   }
+  bool srmsg_AddDataMessagePayload(const srtyp_SrMessagePayloadView * message_payload, srtyp_SrMessageView * sr_message){
+    if(srmsgMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srmsgMock::getInstance()->srmsg_AddDataMessagePayload(message_payload, sr_message);
+  }
+  void srmsg_ConvertDataMessage(const srtyp_SrMessageHeaderCreate message_header, const srtyp_SrMessageType message_type, srtyp_SrMessageView * sr_message){
+    ASSERT_NE(srmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srmsgMock::getInstance()->srmsg_ConvertDataMessage(message_header, message_type, sr_message);
+  }
   void srmsg_CreateRetrReqMessage(const srtyp_SrMessageHeaderCreate message_header, srtyp_SrMessage * sr_message){
     ASSERT_NE(srmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
     srmsgMock::getInstance()->srmsg_CreateRetrReqMessage(message_header, sr_message);
@@ -77,6 +87,10 @@ extern "C" {
     ASSERT_NE(srmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
     srmsgMock::getInstance()->srmsg_UpdateMessageHeader(message_header_update, sr_message);
   }
+  void srmsg_UpdateMessageHeaderBatch(const uint16_t number_of_messages, const srtyp_SrMessageHeaderUpdate * message_header_updates, srtyp_SrMessage * sr_messages){
+    ASSERT_NE(srmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srmsgMock::getInstance()->srmsg_UpdateMessageHeaderBatch(number_of_messages, message_header_updates, sr_messages);
+  }
   radef_RaStaReturnCode srmsg_CheckMessage(const srtyp_SrMessage * sr_message){
     if(srmsgMock::getInstance() == nullptr) {
       ADD_FAILURE() << "Mock object not initialized!";
@@ -103,6 +117,16 @@ extern "C" {
     ASSERT_NE(srmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
     srmsgMock::getInstance()->srmsg_GetDataMessagePayload(sr_message, message_payload);
   }
+  uint16_t srmsg_GetNumberOfDataMessagePayloads(const srtyp_SrMessage * sr_message){
+    if(srmsgMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srmsgMock::getInstance()->srmsg_GetNumberOfDataMessagePayloads(sr_message);
+  }
+  void srmsg_GetDataMessagePayloadView(const srtyp_SrMessage * sr_message, uint16_t * payload_offset, srtyp_SrMessagePayloadView * payload_view){
+    ASSERT_NE(srmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srmsgMock::getInstance()->srmsg_GetDataMessagePayloadView(sr_message, payload_offset, payload_view);
+  }
   void srmsg_GetConnMessageData(const srtyp_SrMessage * sr_message, srtyp_ProtocolVersion * protocol_version, uint16_t * n_send_max){
     ASSERT_NE(srmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
     srmsgMock::getInstance()->srmsg_GetConnMessageData(sr_message, protocol_version, n_send_max);
@@ -111,6 +135,10 @@ extern "C" {
     ASSERT_NE(srmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
     srmsgMock::getInstance()->srmsg_GetDiscMessageData(sr_message, detailed_reason, reason);
   }
+  void srmsg_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(srmsgMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srmsgMock::getInstance()->srmsg_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -69,6 +69,16 @@ public:
   */
   MOCK_METHOD(void, srmsg_CreateRetrDataMessage, (const srtyp_SrMessageHeaderCreate message_header, const srtyp_SrMessagePayload * message_payload, srtyp_SrMessage * sr_message));
 
+  /**
+  * @brief Mock Method object for the srmsg_AddDataMessagePayload function
+  */
+  MOCK_METHOD(bool, srmsg_AddDataMessagePayload, (const srtyp_SrMessagePayloadView * message_payload, srtyp_SrMessageView * sr_message));
+
+  /**
+  * @brief Mock Method object for the srmsg_ConvertDataMessage function
+  */
+  MOCK_METHOD(void, srmsg_ConvertDataMessage, (const srtyp_SrMessageHeaderCreate message_header, const srtyp_SrMessageType message_type, srtyp_SrMessageView * sr_message));
+
   /**
   * @brief Mock Method object for the srmsg_CreateRetrReqMessage function
   */
@@ -94,6 +104,11 @@ public:
   */
   MOCK_METHOD(void, srmsg_UpdateMessageHeader, (const srtyp_SrMessageHeaderUpdate message_header_update, srtyp_SrMessage * sr_message));
 
+  /**
+  * @brief Mock Method object for the srmsg_UpdateMessageHeaderBatch function
+  */
+  MOCK_METHOD(void, srmsg_UpdateMessageHeaderBatch, (const uint16_t number_of_messages, const srtyp_SrMessageHeaderUpdate * message_header_updates, srtyp_SrMessage * sr_messages));
+
   /**
   * @brief Mock Method object for the srmsg_CheckMessage function
   */
@@ -119,6 +134,16 @@ public:
   */
   MOCK_METHOD(void, srmsg_GetDataMessagePayload, (const srtyp_SrMessage * sr_message, srtyp_SrMessagePayload * message_payload));
 
+  /**
+  * @brief Mock Method object for the srmsg_GetNumberOfDataMessagePayloads function
+  */
+  MOCK_METHOD(uint16_t, srmsg_GetNumberOfDataMessagePayloads, (const srtyp_SrMessage * sr_message));
+
+  /**
+  * @brief Mock Method object for the srmsg_GetDataMessagePayloadView function
+  */
+  MOCK_METHOD(void, srmsg_GetDataMessagePayloadView, (const srtyp_SrMessage * sr_message, uint16_t * payload_offset, srtyp_SrMessagePayloadView * payload_view));
+
   /**
   * @brief Mock Method object for the srmsg_GetConnMessageData function
   */
@@ -129,6 +154,11 @@ public:
   */
   MOCK_METHOD(void, srmsg_GetDiscMessageData, (const srtyp_SrMessage * sr_message, uint16_t * detailed_reason, sraty_DiscReason * reason));
 
+  /**
+  * @brief Mock Method object for the srmsg_SelectInstance function
+  */
+  MOCK_METHOD(void, srmsg_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
@@ -37,21 +37,21 @@ srnotMock::~srnotMock() {
 
 extern "C" {
 
-  void srnot_MessageReceivedNotification(const uint32_t connection_id){
+  void srnot_MessageReceivedNotification(srapi_Instance *const instance, const uint32_t connection_id){
     ASSERT_NE(srnotMock::getInstance(), nullptr) << "Mock object not initialized!";
-    srnotMock::getInstance()->srnot_MessageReceivedNotification(connection_id);
+    srnotMock::getInstance()->srnot_MessageReceivedNotification(instance, connection_id);
   }
-  void srnot_ConnectionStateNotification(const uint32_t connection_id, const sraty_ConnectionStates connection_state, const sraty_BufferUtilisation buffer_utilisation, const uint16_t opposite_buffer_size, const sraty_DiscReason disconnect_reason, const uint16_t detailed_disconnect_reason){
+  void srnot_ConnectionStateNotification(srapi_Instance *const instance, const uint32_t connection_id, const sraty_ConnectionStates connection_state, const sraty_BufferUtilisation buffer_utilisation, const uint16_t opposite_buffer_size, const sraty_DiscReason disconnect_reason, const uint16_t detailed_disconnect_reason){
     ASSERT_NE(srnotMock::getInstance(), nullptr) << "Mock object not initialized!";
-    srnotMock::getInstance()->srnot_ConnectionStateNotification(connection_id, connection_state, buffer_utilisation, opposite_buffer_size, disconnect_reason, detailed_disconnect_reason);
+    srnotMock::getInstance()->srnot_ConnectionStateNotification(instance, connection_id, connection_state, buffer_utilisation, opposite_buffer_size, disconnect_reason, detailed_disconnect_reason);
   }
-  void srnot_SrDiagnosticNotification(const uint32_t connection_id, const sraty_ConnectionDiagnosticData connection_diagnostic_data){
+  void srnot_SrDiagnosticNotification(srapi_Instance *const instance, const uint32_t connection_id, const sraty_ConnectionDiagnosticData connection_diagnostic_data){
     ASSERT_NE(srnotMock::getInstance(), nullptr) << "Mock object not initialized!";
-    srnotMock::getInstance()->srnot_SrDiagnosticNotification(connection_id, connection_diagnostic_data);
+    srnotMock::getInstance()->srnot_SrDiagnosticNotification(instance, connection_id, connection_diagnostic_data);
   }
-  void srnot_RedDiagnosticNotification(const uint32_t connection_id, const sraty_RedundancyChannelDiagnosticData redundancy_channel_diagnostic_data){
+  void srnot_RedDiagnosticNotification(srapi_Instance *const instance, const uint32_t connection_id, const sraty_RedundancyChannelDiagnosticData redundancy_channel_diagnostic_data){
     ASSERT_NE(srnotMock::getInstance(), nullptr) << "Mock object not initialized!";
-    srnotMock::getInstance()->srnot_RedDiagnosticNotification(connection_id, redundancy_channel_diagnostic_data);
+    srnotMock::getInstance()->srnot_RedDiagnosticNotification(instance, connection_id, redundancy_channel_diagnostic_data);
   }
 }
 
@@ -44,22 +44,22 @@ public:
   /**
   * @brief Mock Method object for the srnot_MessageReceivedNotification function
   */
-  MOCK_METHOD(void, srnot_MessageReceivedNotification, (const uint32_t connection_id));
+  MOCK_METHOD(void, srnot_MessageReceivedNotification, (srapi_Instance * instance, const uint32_t connection_id));
 
   /**
   * @brief Mock Method object for the srnot_ConnectionStateNotification function
   */
-  MOCK_METHOD(void, srnot_ConnectionStateNotification, (const uint32_t connection_id, const sraty_ConnectionStates connection_state, const sraty_BufferUtilisation buffer_utilisation, const uint16_t opposite_buffer_size, const sraty_DiscReason disconnect_reason, const uint16_t detailed_disconnect_reason));
+  MOCK_METHOD(void, srnot_ConnectionStateNotification, (srapi_Instance * instance, const uint32_t connection_id, const sraty_ConnectionStates connection_state, const sraty_BufferUtilisation buffer_utilisation, const uint16_t opposite_buffer_size, const sraty_DiscReason disconnect_reason, const uint16_t detailed_disconnect_reason));
 
   /**
   * @brief Mock Method object for the srnot_SrDiagnosticNotification function
   */
-  MOCK_METHOD(void, srnot_SrDiagnosticNotification, (const uint32_t connection_id, const sraty_ConnectionDiagnosticData connection_diagnostic_data));
+  MOCK_METHOD(void, srnot_SrDiagnosticNotification, (srapi_Instance * instance, const uint32_t connection_id, const sraty_ConnectionDiagnosticData connection_diagnostic_data));
 
   /**
   * @brief Mock Method object for the srnot_RedDiagnosticNotification function
   */
-  MOCK_METHOD(void, srnot_RedDiagnosticNotification, (const uint32_t connection_id, const sraty_RedundancyChannelDiagnosticData redundancy_channel_diagnostic_data));
+  MOCK_METHOD(void, srnot_RedDiagnosticNotification, (srapi_Instance * instance, const uint32_t connection_id, const sraty_RedundancyChannelDiagnosticData redundancy_channel_diagnostic_data));
 
   /**
   * @brief Get the Instance object
@@ -41,11 +41,17 @@ extern "C" {
     ASSERT_NE(srreceMock::getInstance(), nullptr) << "Mock object not initialized!";
     srreceMock::getInstance()->srrece_Init(configured_connections, configured_n_send_max);
   }
+  uint32_t srrece_GetConnectionMemorySize(const uint32_t configured_connections){
+    if(srreceMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srreceMock::getInstance()->srrece_GetConnectionMemorySize(configured_connections);
+  }
   void srrece_InitBuffer(const uint32_t connection_id){
     ASSERT_NE(srreceMock::getInstance(), nullptr) << "Mock object not initialized!";
     srreceMock::getInstance()->srrece_InitBuffer(connection_id);
   }
-  void srrece_AddToBuffer(const uint32_t connection_id, const srtyp_SrMessagePayload * message_payload){
+  void srrece_AddToBuffer(const uint32_t connection_id, const srtyp_SrMessagePayloadView * message_payload){
     ASSERT_NE(srreceMock::getInstance(), nullptr) << "Mock object not initialized!";
     srreceMock::getInstance()->srrece_AddToBuffer(connection_id, message_payload);
   }
@@ -55,6 +61,18 @@ extern "C" {
     }
     return srreceMock::getInstance()->srrece_ReadFromBuffer(connection_id, message_payload);
   }
+  radef_RaStaReturnCode srrece_PeekFromBuffer(const uint32_t connection_id, srtyp_SrMessagePayloadView * message_payload){
+    if(srreceMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srreceMock::getInstance()->srrece_PeekFromBuffer(connection_id, message_payload);
+  }
+  radef_RaStaReturnCode srrece_ReleaseFromBuffer(const uint32_t connection_id){
+    if(srreceMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srreceMock::getInstance()->srrece_ReleaseFromBuffer(connection_id);
+  }
   uint32_t srrece_GetPayloadSizeOfNextMessageToRead(const uint32_t connection_id){
     if(srreceMock::getInstance() == nullptr) {
       ADD_FAILURE() << "Mock object not initialized!";
@@ -73,6 +91,10 @@ extern "C" {
     }
     return srreceMock::getInstance()->srrece_GetUsedBufferEntries(connection_id);
   }
+  void srrece_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(srreceMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srreceMock::getInstance()->srrece_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
@@ -46,6 +46,11 @@ public:
   */
   MOCK_METHOD(void, srrece_Init, (const uint32_t configured_connections, const uint16_t configured_n_send_max));
 
+  /**
+  * @brief Mock Method object for the srrece_GetConnectionMemorySize function
+  */
+  MOCK_METHOD(uint32_t, srrece_GetConnectionMemorySize, (const uint32_t configured_connections));
+
   /**
   * @brief Mock Method object for the srrece_InitBuffer function
   */
@@ -54,13 +59,23 @@ public:
   /**
   * @brief Mock Method object for the srrece_AddToBuffer function
   */
-  MOCK_METHOD(void, srrece_AddToBuffer, (const uint32_t connection_id, const srtyp_SrMessagePayload * message_payload));
+  MOCK_METHOD(void, srrece_AddToBuffer, (const uint32_t connection_id, const srtyp_SrMessagePayloadView * message_payload));
 
   /**
   * @brief Mock Method object for the srrece_ReadFromBuffer function
   */
   MOCK_METHOD(radef_RaStaReturnCode, srrece_ReadFromBuffer, (const uint32_t connection_id, srtyp_SrMessagePayload * message_payload));
 
+  /**
+  * @brief Mock Method object for the srrece_PeekFromBuffer function
+  */
+  MOCK_METHOD(radef_RaStaReturnCode, srrece_PeekFromBuffer, (const uint32_t connection_id, srtyp_SrMessagePayloadView * message_payload));
+
+  /**
+  * @brief Mock Method object for the srrece_ReleaseFromBuffer function
+  */
+  MOCK_METHOD(radef_RaStaReturnCode, srrece_ReleaseFromBuffer, (const uint32_t connection_id));
+
   /**
   * @brief Mock Method object for the srrece_GetPayloadSizeOfNextMessageToRead function
   */
@@ -76,6 +91,11 @@ public:
   */
   MOCK_METHOD(uint16_t, srrece_GetUsedBufferEntries, (const uint32_t connection_id));
 
+  /**
+  * @brief Mock Method object for the srrece_SelectInstance function
+  */
+  MOCK_METHOD(void, srrece_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
@@ -41,6 +41,18 @@ extern "C" {
     ASSERT_NE(srsendMock::getInstance(), nullptr) << "Mock object not initialized!";
     srsendMock::getInstance()->srsend_Init(configured_connections);
   }
+  uint32_t srsend_GetConnectionMemorySize(const uint32_t configured_connections){
+    if(srsendMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srsendMock::getInstance()->srsend_GetConnectionMemorySize(configured_connections);
+  }
+  bool srsend_IsChunkShareSufficient(const uint32_t configured_connections, const uint16_t n_send_max){
+    if(srsendMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srsendMock::getInstance()->srsend_IsChunkShareSufficient(configured_connections, n_send_max);
+  }
   void srsend_InitBuffer(const uint32_t connection_id){
     ASSERT_NE(srsendMock::getInstance(), nullptr) << "Mock object not initialized!";
     srsendMock::getInstance()->srsend_InitBuffer(connection_id);
@@ -49,6 +61,12 @@ extern "C" {
     ASSERT_NE(srsendMock::getInstance(), nullptr) << "Mock object not initialized!";
     srsendMock::getInstance()->srsend_AddToBuffer(connection_id, message);
   }
+  bool srsend_AddPayloadToLastMessage(const uint32_t connection_id, const uint32_t max_number_of_payloads, const srtyp_SrMessagePayload * message_payload){
+    if(srsendMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srsendMock::getInstance()->srsend_AddPayloadToLastMessage(connection_id, max_number_of_payloads, message_payload);
+  }
   radef_RaStaReturnCode srsend_ReadMessageToSend(const uint32_t connection_id, srtyp_SrMessage * message){
     if(srsendMock::getInstance() == nullptr) {
       ADD_FAILURE() << "Mock object not initialized!";
@@ -87,6 +105,10 @@ extern "C" {
     }
     return srsendMock::getInstance()->srsend_GetNumberOfMessagesToSend(connection_id);
   }
+  void srsend_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(srsendMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srsendMock::getInstance()->srsend_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
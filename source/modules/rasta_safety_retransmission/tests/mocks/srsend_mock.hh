@@ -46,6 +46,16 @@ public:
   */
   MOCK_METHOD(void, srsend_Init, (const uint32_t configured_connections));
 
+  /**
+  * @brief Mock Method object for the srsend_GetConnectionMemorySize function
+  */
+  MOCK_METHOD(uint32_t, srsend_GetConnectionMemorySize, (const uint32_t configured_connections));
+
+  /**
+  * @brief Mock Method object for the srsend_IsChunkShareSufficient function
+  */
+  MOCK_METHOD(bool, srsend_IsChunkShareSufficient, (const uint32_t configured_connections, const uint16_t n_send_max));
+
   /**
   * @brief Mock Method object for the srsend_InitBuffer function
   */
@@ -56,6 +66,11 @@ public:
   */
   MOCK_METHOD(void, srsend_AddToBuffer, (const uint32_t connection_id, const srtyp_SrMessage * message));
 
+  /**
+  * @brief Mock Method object for the srsend_AddPayloadToLastMessage function
+  */
+  MOCK_METHOD(bool, srsend_AddPayloadToLastMessage, (const uint32_t connection_id, const uint32_t max_number_of_payloads, const srtyp_SrMessagePayload * message_payload));
+
   /**
   * @brief Mock Method object for the srsend_ReadMessageToSend function
   */
@@ -91,6 +106,11 @@ public:
   */
   MOCK_METHOD(uint16_t, srsend_GetNumberOfMessagesToSend, (const uint32_t connection_id));
 
+  /**
+  * @brief Mock Method object for the srsend_SelectInstance function
+  */
+  MOCK_METHOD(void, srsend_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
@@ -41,6 +41,12 @@ extern "C" {
     ASSERT_NE(srstmMock::getInstance(), nullptr) << "Mock object not initialized!";
     srstmMock::getInstance()->srstm_Init(configured_connections);
   }
+  uint32_t srstm_GetConnectionMemorySize(const uint32_t configured_connections){
+    if(srstmMock::getInstance() == nullptr) {
+      ADD_FAILURE() << "Mock object not initialized!";
+    }
+    return srstmMock::getInstance()->srstm_GetConnectionMemorySize(configured_connections);
+  }
   void srstm_ProcessConnectionStateMachine(const uint32_t connection_id, const srtyp_ConnectionEvents event, const bool sequence_number_in_seq, const bool confirmed_time_stamp_in_seq){
     ASSERT_NE(srstmMock::getInstance(), nullptr) << "Mock object not initialized!";
     srstmMock::getInstance()->srstm_ProcessConnectionStateMachine(connection_id, event, sequence_number_in_seq, confirmed_time_stamp_in_seq);
@@ -51,6 +57,10 @@ extern "C" {
     }
     return srstmMock::getInstance()->srstm_GetConnectionState(connection_id);
   }
+  void srstm_SelectInstance(const uint32_t instance_index){
+    ASSERT_NE(srstmMock::getInstance(), nullptr) << "Mock object not initialized!";
+    srstmMock::getInstance()->srstm_SelectInstance(instance_index);
+  }
 }
 
 #endif /* DOXYGEN_SHOULD_SKIP_THIS */
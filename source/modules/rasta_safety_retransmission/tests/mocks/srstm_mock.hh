@@ -47,6 +47,11 @@ public:
   */
   MOCK_METHOD(void, srstm_Init, (const uint32_t configured_connections));
 
+  /**
+  * @brief Mock Method object for the srstm_GetConnectionMemorySize function
+  */
+  MOCK_METHOD(uint32_t, srstm_GetConnectionMemorySize, (const uint32_t configured_connections));
+
   /**
   * @brief Mock Method object for the srstm_ProcessConnectionStateMachine function
   */
@@ -57,6 +62,11 @@ public:
   */
   MOCK_METHOD(sraty_ConnectionStates, srstm_GetConnectionState, (const uint32_t connection_id));
 
+  /**
+  * @brief Mock Method object for the srstm_SelectInstance function
+  */
+  MOCK_METHOD(void, srstm_SelectInstance, (const uint32_t instance_index));
+
   /**
   * @brief Get the Instance object
   *
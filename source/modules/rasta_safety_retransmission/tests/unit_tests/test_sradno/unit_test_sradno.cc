@@ -50,8 +50,8 @@ using ::testing::SetArgPointee;
  * @brief Custom matcher to check equality of transport channel diagnostic data
  */
 MATCHER_P(EqRedDiagData, other, "Equality matcher for type radef_TransportChannelDiagnosticData") {
-    return std::tie(arg.n_diagnosis, arg.n_missed, arg.t_drift, arg.t_drift2)
-        == std::tie(other.n_diagnosis, other.n_missed, other.t_drift, other.t_drift2);
+    return std::tie(arg.n_diagnosis, arg.n_missed, arg.t_drift, arg.t_drift2, arg.n_dropped)
+        == std::tie(other.n_diagnosis, other.n_missed, other.t_drift, other.t_drift2, other.n_dropped);
 }
 
 // -----------------------------------------------------------------------------
@@ -113,11 +113,12 @@ public:
  * - n_missed (uint32_t)
  * - t_drift (uint32_t)
  * - t_drift2 (uint32_t)
+ * - n_dropped (uint32_t)
  * - exp_return_value (radef_RaStaReturnCode)
  * .
  */
 class DiagnosticNotificationTestWithParam : public sradnoTest,
-    public testing::WithParamInterface<std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, radef_RaStaReturnCode>> {
+    public testing::WithParamInterface<std::tuple<uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, radef_RaStaReturnCode>> {
 public:
   const uint32_t red_channel_id = std::get<0>(GetParam()); ///< red channel ID
   const uint32_t tr_channel_id = std::get<1>(GetParam()); ///< tr channel ID
@@ -125,7 +126,8 @@ public:
   const uint32_t n_missed = std::get<3>(GetParam()); ///< N missed
   const uint32_t t_drift = std::get<4>(GetParam()); ///< T drift
   const uint32_t t_drift2 = std::get<5>(GetParam()); ///< T drift2
-  const radef_RaStaReturnCode exp_return_value = std::get<6>(GetParam()); ///< expected return value
+  const uint32_t n_dropped = std::get<6>(GetParam()); ///< N dropped
+  const radef_RaStaReturnCode exp_return_value = std::get<7>(GetParam()); ///< expected return value
 };
 
 // -----------------------------------------------------------------------------
@@ -145,6 +147,7 @@ public:
  *
  * Test steps:
  * - Set expectations
+ *  - srins_SelectInstance is called once with the passed instance
  *  - srcor_SetReceivedMessagePendingFlag is called once (before loop)
  *  - srcor_GetReceivedMessagePendingFlag is called for every message received,
  *    or once if no message was received
@@ -211,6 +214,7 @@ TEST_P(MessageReceiveNotificationTestWithParam, sradnoTest001VerifyMessageReceiv
   }
 
   if (radef_kNoError == exp_return_value) {
+    EXPECT_CALL(srins_mock, srins_SelectInstance(&test_instance)).Times(1);
     EXPECT_CALL(srcor_mock, srcor_SetReceivedMessagePendingFlag(connection_id))
         .Times(1)
     ;
@@ -251,7 +255,7 @@ TEST_P(MessageReceiveNotificationTestWithParam, sradnoTest001VerifyMessageReceiv
   }
 
   // perform test /////////////////////////////////
-  EXPECT_EQ(exp_return_value, sradno_MessageReceivedNotification(red_channel_id));
+  EXPECT_EQ(exp_return_value, sradno_MessageReceivedNotification(&test_instance, red_channel_id));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -302,7 +306,8 @@ INSTANTIATE_TEST_SUITE_P(
  *
  * Test steps:
  * - Set expectations:
- *  - srnot_RedDiagnosticNotification is called once (with the defined params)
+ *  - srins_SelectInstance is called once with the passed instance
+ *  - srnot_RedDiagnosticNotification is called once (with the passed instance and the defined params)
  * - Call sradno_DiagnosticNotification and verify the return value
  * .
  *
@@ -313,24 +318,27 @@ INSTANTIATE_TEST_SUITE_P(
  * - N missed: Number of messages which are not received on this transport channel within Tseq from the first reception on an other transport channel
  * - T drift: Sum of the delays of received messages in relation to the fastest transport channel
  * - T drift2: Sum of the squares of the delays of received messages in relation to the fastest transport channel
+ * - N dropped: Number of messages which are dropped on this transport channel because its ingress ring was full
  * - return value: The expected function return value
  * .
- * | Test Run | Input parameter                                                                 |||||| Expected values                           ||
- * |----------|-----------------|---------------|-------------|------------|------------|------------|-------------------------|------------------|
- * |          | red. channel Id | tr channel Id | N diagnosis | N missed   | T drift    | T drift2   | return value            | Test Result      |
- * | 0        | 0               | 2             | 3           | 4          | 5          | 6          | radef_kNoError          | Normal operation |
- * | 1        | 1               | 2             | 3           | 4          | 5          | 6          | radef_kNoError          | Normal operation |
- * | 2        | 2               | 2             | 3           | 4          | 5          | 6          | radef_kInvalidParameter | Normal operation |
- * | 3        | 1               | 0             | 3           | 4          | 5          | 6          | radef_kNoError          | Normal operation |
- * | 4        | 1               | 0xffffffff    | 3           | 4          | 5          | 6          | radef_kNoError          | Normal operation |
- * | 5        | 1               | 2             | 0           | 4          | 5          | 6          | radef_kNoError          | Normal operation |
- * | 6        | 1               | 2             | 0xffffffff  | 4          | 5          | 6          | radef_kNoError          | Normal operation |
- * | 7        | 1               | 2             | 3           | 0          | 5          | 6          | radef_kNoError          | Normal operation |
- * | 8        | 1               | 2             | 3           | 0xffffffff | 5          | 6          | radef_kNoError          | Normal operation |
- * | 9        | 1               | 2             | 3           | 4          | 0          | 6          | radef_kNoError          | Normal operation |
- * | 10       | 1               | 2             | 3           | 4          | 0xffffffff | 6          | radef_kNoError          | Normal operation |
- * | 11       | 1               | 2             | 3           | 4          | 5          | 0          | radef_kNoError          | Normal operation |
- * | 12       | 1               | 2             | 3           | 4          | 5          | 0xffffffff | radef_kNoError          | Normal operation |
+ * | Test Run | Input parameter                                                                               ||||||| Expected values                           ||
+ * |----------|-----------------|---------------|-------------|------------|------------|------------|------------|-------------------------|------------------|
+ * |          | red. channel Id | tr channel Id | N diagnosis | N missed   | T drift    | T drift2   | N dropped  | return value            | Test Result      |
+ * | 0        | 0               | 2             | 3           | 4          | 5          | 6          | 7          | radef_kNoError          | Normal operation |
+ * | 1        | 1               | 2             | 3           | 4          | 5          | 6          | 7          | radef_kNoError          | Normal operation |
+ * | 2        | 2               | 2             | 3           | 4          | 5          | 6          | 7          | radef_kInvalidParameter | Normal operation |
+ * | 3        | 1               | 0             | 3           | 4          | 5          | 6          | 7          | radef_kNoError          | Normal operation |
+ * | 4        | 1               | 0xffffffff    | 3           | 4          | 5          | 6          | 7          | radef_kNoError          | Normal operation |
+ * | 5        | 1               | 2             | 0           | 4          | 5          | 6          | 7          | radef_kNoError          | Normal operation |
+ * | 6        | 1               | 2             | 0xffffffff  | 4          | 5          | 6          | 7          | radef_kNoError          | Normal operation |
+ * | 7        | 1               | 2             | 3           | 0          | 5          | 6          | 7          | radef_kNoError          | Normal operation |
+ * | 8        | 1               | 2             | 3           | 0xffffffff | 5          | 6          | 7          | radef_kNoError          | Normal operation |
+ * | 9        | 1               | 2             | 3           | 4          | 0          | 6          | 7          | radef_kNoError          | Normal operation |
+ * | 10       | 1               | 2             | 3           | 4          | 0xffffffff | 6          | 7          | radef_kNoError          | Normal operation |
+ * | 11       | 1               | 2             | 3           | 4          | 5          | 0          | 7          | radef_kNoError          | Normal operation |
+ * | 12       | 1               | 2             | 3           | 4          | 5          | 0xffffffff | 7          | radef_kNoError          | Normal operation |
+ * | 13       | 1               | 2             | 3           | 4          | 5          | 6          | 0          | radef_kNoError          | Normal operation |
+ * | 14       | 1               | 2             | 3           | 4          | 5          | 6          | 0xffffffff | radef_kNoError          | Normal operation |
  *
  * @safetyRel   Yes
  *
@@ -368,10 +376,12 @@ TEST_P(DiagnosticNotificationTestWithParam, sradnoTest002VerifyDiagnosticNotific
       .n_diagnosis = n_diagnosis,
       .n_missed = n_missed,
       .t_drift = t_drift,
-      .t_drift2 = t_drift2
+      .t_drift2 = t_drift2,
+      .n_dropped = n_dropped
   };
   if (radef_kNoError == exp_return_value) {
-    EXPECT_CALL(srnot_mock, srnot_RedDiagnosticNotification(connection_id, EqRedDiagData(expected_red_diag_data)))
+    EXPECT_CALL(srins_mock, srins_SelectInstance(&test_instance)).Times(1);
+    EXPECT_CALL(srnot_mock, srnot_RedDiagnosticNotification(&test_instance, connection_id, EqRedDiagData(expected_red_diag_data)))
       .Times(1);
   }
 
@@ -381,9 +391,10 @@ TEST_P(DiagnosticNotificationTestWithParam, sradnoTest002VerifyDiagnosticNotific
       .n_missed = n_missed,
       .t_drift = t_drift,
       .t_drift2 = t_drift2,
+      .n_dropped = n_dropped,
   };
 
-  EXPECT_EQ(exp_return_value, sradno_DiagnosticNotification(red_channel_id, tr_channel_id, tr_channel_diagnostic_data));
+  EXPECT_EQ(exp_return_value, sradno_DiagnosticNotification(&test_instance, red_channel_id, tr_channel_id, tr_channel_diagnostic_data));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -396,30 +407,66 @@ INSTANTIATE_TEST_SUITE_P(
 //                    |           |           |           n_missed
 //                    |           |           |           |           t_drift
 //                    |           |           |           |           |           t_drift2
-//                    |           |           |           |           |           |           exp_return_value
-//                    |           |           |           |           |           |           |
+//                    |           |           |           |           |           |           n_dropped
+//                    |           |           |           |           |           |           |           exp_return_value
+//                    |           |           |           |           |           |           |           |
       // vary red_channel_id
-      std::make_tuple(0U,         2U,         3U,         4U,         5U,         6U,         radef_kNoError),
-      std::make_tuple(1U,         2U,         3U,         4U,         5U,         6U,         radef_kNoError),
-      std::make_tuple(2U,         2U,         3U,         4U,         5U,         6U,         radef_kInvalidParameter),
+      std::make_tuple(0U,         2U,         3U,         4U,         5U,         6U,         7U,         radef_kNoError),
+      std::make_tuple(1U,         2U,         3U,         4U,         5U,         6U,         7U,         radef_kNoError),
+      std::make_tuple(2U,         2U,         3U,         4U,         5U,         6U,         7U,         radef_kInvalidParameter),
       // vary tr_channel_id
-      std::make_tuple(1U,         0U,         3U,         4U,         5U,         6U,         radef_kNoError),
-      std::make_tuple(1U,         UINT32_MAX, 3U,         4U,         5U,         6U,         radef_kNoError),
+      std::make_tuple(1U,         0U,         3U,         4U,         5U,         6U,         7U,         radef_kNoError),
+      std::make_tuple(1U,         UINT32_MAX, 3U,         4U,         5U,         6U,         7U,         radef_kNoError),
       // vary n_diagnosis
-      std::make_tuple(1U,         2U,         0U,         4U,         5U,         6U,         radef_kNoError),
-      std::make_tuple(1U,         2U,         UINT32_MAX, 4U,         5U,         6U,         radef_kNoError),
+      std::make_tuple(1U,         2U,         0U,         4U,         5U,         6U,         7U,         radef_kNoError),
+      std::make_tuple(1U,         2U,         UINT32_MAX, 4U,         5U,         6U,         7U,         radef_kNoError),
       // vary n_missed
-      std::make_tuple(1U,         2U,         3U,         0U,         5U,         6U,         radef_kNoError),
-      std::make_tuple(1U,         2U,         3U,         UINT32_MAX, 5U,         6U,         radef_kNoError),
+      std::make_tuple(1U,         2U,         3U,         0U,         5U,         6U,         7U,         radef_kNoError),
+      std::make_tuple(1U,         2U,         3U,         UINT32_MAX, 5U,         6U,         7U,         radef_kNoError),
       // vary t_drift
-      std::make_tuple(1U,         2U,         3U,         4U,         0U,         6U,         radef_kNoError),
-      std::make_tuple(1U,         2U,         3U,         4U,         UINT32_MAX, 6U,         radef_kNoError),
+      std::make_tuple(1U,         2U,         3U,         4U,         0U,         6U,         7U,         radef_kNoError),
+      std::make_tuple(1U,         2U,         3U,         4U,         UINT32_MAX, 6U,         7U,         radef_kNoError),
       // vary t_drift2
-      std::make_tuple(1U,         2U,         3U,         4U,         5U,         0U,         radef_kNoError),
-      std::make_tuple(1U,         2U,         3U,         4U,         5U,         UINT32_MAX, radef_kNoError)
+      std::make_tuple(1U,         2U,         3U,         4U,         5U,         0U,         7U,         radef_kNoError),
+      std::make_tuple(1U,         2U,         3U,         4U,         5U,         UINT32_MAX, 7U,         radef_kNoError),
+      // vary n_dropped
+      std::make_tuple(1U,         2U,         3U,         4U,         5U,         6U,         0U,         radef_kNoError),
+      std::make_tuple(1U,         2U,         3U,         4U,         5U,         6U,         UINT32_MAX, radef_kNoError)
   )
 );
 
+/**
+ * @test        @ID{sradnoTest003} Verify the instance check of the notification functions
+ *
+ * @details     This test verifies that the notification functions return an InvalidParameter
+ *              error, if they are called with a NULL instance.
+ *
+ * Test steps:
+ * - Call sradno_MessageReceivedNotification with a NULL instance and verify the return value
+ * - Call sradno_DiagnosticNotification with a NULL instance and verify the return value
+ * - Verify that no other module is called
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-655} Message Received Notification
+ * @verifyReq{RASW-656} Diagnostic Notification
+ * @verifyReq{RASW-900} Error Code
+ * @verifyReq{RASW-901} Error Code
+ */
+TEST_F(sradnoTest, sradnoTest003VerifyInstanceCheck) {
+  const radef_TransportChannelDiagnosticData tr_channel_diagnostic_data = {};
+
+  // the strict mocks verify that no other module is called
+  EXPECT_EQ(radef_kInvalidParameter, sradno_MessageReceivedNotification((srapi_Instance *)NULL, 0U));
+  EXPECT_EQ(radef_kInvalidParameter, sradno_DiagnosticNotification((srapi_Instance *)NULL, 0U, 0U, tr_channel_diagnostic_data));
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
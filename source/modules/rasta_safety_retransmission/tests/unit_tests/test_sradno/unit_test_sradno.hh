@@ -23,6 +23,7 @@
 #include "gmock/gmock.h"
 #include "rasys_mock.hh"
 #include "srcor_mock.hh"
+#include "srins_mock.hh"
 #include "srnot_mock.hh"
 #include "srrece_mock.hh"
 #include "srsend_mock.hh"
@@ -78,8 +79,11 @@ public:
     throw std::invalid_argument("Invalid argument!");
   }
 
+  srapi_Instance test_instance = {};  ///< SafRetL instance passed to the notification functions
+
   StrictMock<rasysMock> rasys_mock; ///< mock for the rasta system adapter class
   StrictMock<srcorMock> srcor_mock; ///< mock for the rasta safety and retransmission core class
+  StrictMock<srinsMock> srins_mock; ///< mock for the rasta safety and retransmission instances class
   StrictMock<srnotMock> srnot_mock; ///< mock for the rasta safety and retransmission notifications class
   StrictMock<srreceMock> srrece_mock; ///< mock for the rasta safety and retransmission received buffer class
   StrictMock<srsendMock> srsend_mock; ///< mock for the rasta safety and retransmission send buffer class
@@ -84,7 +84,7 @@ class InitTestWithParam : public srapiTest,
  *
  * Test steps:
  * - expect a call to the IsConfigurationValid function and return true or false
- * - expect the initialization of srstm and srcor if the config is valid
+ * - expect the initialization of srmem, srstm and srcor if the config is valid
  * - call the Init function and verify the return value
  * - verify that the initialization state is set correctly
  * .
@@ -137,19 +137,23 @@ TEST_P(InitTestWithParam, srapiTest001VerifyInitFunction) {
 
   // expect state machine and core module to be initialized if config is valid
   if (is_config_valid) {
+    EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(configured_connections)).WillOnce(Return(0U));
+    EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(configured_connections)).WillOnce(Return(0U));
+    EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
     EXPECT_CALL(srstm_mock, srstm_Init(configured_connections)).Times(1);
     EXPECT_CALL(srcor_mock, srcor_Init(&config)).Times(1);
   }
 
   // call the init function and verify the return value
-  EXPECT_EQ(return_code, srapi_Init(&config));
+  EXPECT_EQ(return_code, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
 
-  // check the initialization state
+  // check the initialization state and the returned instance
   if (is_config_valid) {
-    EXPECT_TRUE(srapi_initialized);
+    EXPECT_TRUE(test_instance.initialized);
+    EXPECT_EQ(&test_instance, instance);
   }
   else {
-    EXPECT_FALSE(srapi_initialized);
+    EXPECT_FALSE(test_instance.initialized);
   }
 }
 
@@ -186,12 +190,15 @@ TEST_F(srapiTest, srapiTest002VerifyInitFunctionCalls) {
 
   // call the init function and verify that it completes successfully
   EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&dummy_config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
   EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
   EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
-  EXPECT_EQ(radef_kNoError, srapi_Init(&dummy_config));
+  EXPECT_EQ(radef_kNoError, srapi_Init(&dummy_config, connection_memory, sizeof(connection_memory), &instance));
 
   // call the init function again and verify that the return value is set to AlreadyInitialized
-  EXPECT_EQ(radef_kAlreadyInitialized, srapi_Init(&dummy_config));
+  EXPECT_EQ(radef_kAlreadyInitialized, srapi_Init(&dummy_config, connection_memory, sizeof(connection_memory), &instance));
 }
 
 /**
@@ -203,6 +210,8 @@ TEST_F(srapiTest, srapiTest002VerifyInitFunctionCalls) {
  * Test steps:
  * - initialize the module
  * - call the Init function with invalid configuration pointer and check the return value
+ * - call the Init function with invalid connection memory pointer and check the return value
+ * - call the Init function with invalid instance pointer and check the return value
  * - call the OpenConnection function with invalid connection_id pointer and check the return value
  * - call the SendData function with invalid data pointer and check the return value
  * - call the ReadData function with invalid message_size pointer and check the return value
@@ -243,19 +252,24 @@ TEST_F(srapiTest, srapiTest003VerifyNullPointerCheck) {
 
   // initialize the module
   EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&dummy_config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
   EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
   EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
-  EXPECT_EQ(radef_kNoError, srapi_Init(&dummy_config));
+  EXPECT_EQ(radef_kNoError, srapi_Init(&dummy_config, connection_memory, sizeof(connection_memory), &instance));
 
   // call the functions
-  EXPECT_EQ(radef_kInvalidParameter, srapi_Init((srcty_SafetyRetransmissionConfiguration *)NULL));
-  EXPECT_EQ(radef_kInvalidParameter, srapi_OpenConnection(sender_id, receiver_id, network_id, (uint32_t *)NULL));
-  EXPECT_EQ(radef_kInvalidParameter, srapi_SendData(connection_id, message_size, (uint8_t *)NULL));
-  EXPECT_EQ(radef_kInvalidParameter, srapi_ReadData(connection_id, buffer_size, (uint16_t *)NULL, &message_buffer));
-  EXPECT_EQ(radef_kInvalidParameter, srapi_ReadData(connection_id, buffer_size, &message_size, (uint8_t *)NULL));
-  EXPECT_EQ(radef_kInvalidParameter, srapi_GetConnectionState(connection_id, (sraty_ConnectionStates *)NULL, &buffer_utilisation, &buffer_size));
-  EXPECT_EQ(radef_kInvalidParameter, srapi_GetConnectionState(connection_id, &state, (sraty_BufferUtilisation *)NULL, &buffer_size));
-  EXPECT_EQ(radef_kInvalidParameter, srapi_GetConnectionState(connection_id, &state, &buffer_utilisation, (uint16_t *)NULL));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_Init((srcty_SafetyRetransmissionConfiguration *)NULL, connection_memory, sizeof(connection_memory), &instance));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_Init(&dummy_config, NULL, sizeof(connection_memory), &instance));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_Init(&dummy_config, connection_memory, sizeof(connection_memory), (srapi_Instance **)NULL));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_OpenConnection(&test_instance, sender_id, receiver_id, network_id, (uint32_t *)NULL));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_SendData(&test_instance, connection_id, message_size, (uint8_t *)NULL));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_ReadData(&test_instance, connection_id, buffer_size, (uint16_t *)NULL, &message_buffer));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_ReadData(&test_instance, connection_id, buffer_size, &message_size, (uint8_t *)NULL));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_GetConnectionState(&test_instance, connection_id, (sraty_ConnectionStates *)NULL, &buffer_utilisation, &buffer_size));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_GetConnectionState(&test_instance, connection_id, &state, (sraty_BufferUtilisation *)NULL, &buffer_size));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_GetConnectionState(&test_instance, connection_id, &state, &buffer_utilisation, (uint16_t *)NULL));
 }
 
 /**
@@ -271,6 +285,7 @@ TEST_F(srapiTest, srapiTest003VerifyNullPointerCheck) {
  * - call the ReadData function without prior initialization and verify that NotInitialized is returned
  * - call the GetConnectionState function without prior initialization and verify that NotInitialized is returned
  * - call the CheckTimings function without prior initialization and verify that NotInitialized is returned
+ * - call all functions with a NULL instance and verify that NotInitialized is returned
  * .
  *
  * @safetyRel   Yes
@@ -301,12 +316,21 @@ TEST_F(srapiTest, srapiTest004VerifyInitializationCheck) {
   sraty_BufferUtilisation buffer_utilisation = {};
 
   // call the functions without initializing the module
-  EXPECT_EQ(radef_kNotInitialized, srapi_OpenConnection(sender_id, receiver_id, network_id, &connection_id));
-  EXPECT_EQ(radef_kNotInitialized, srapi_CloseConnection(connection_id, detailed_reason));
-  EXPECT_EQ(radef_kNotInitialized, srapi_SendData(connection_id, message_size, &message_buffer));
-  EXPECT_EQ(radef_kNotInitialized, srapi_ReadData(connection_id, buffer_size, &message_size, &message_buffer));
-  EXPECT_EQ(radef_kNotInitialized, srapi_GetConnectionState(connection_id, &state, &buffer_utilisation, &buffer_size));
-  EXPECT_EQ(radef_kNotInitialized, srapi_CheckTimings());
+  EXPECT_EQ(radef_kNotInitialized, srapi_OpenConnection(&test_instance, sender_id, receiver_id, network_id, &connection_id));
+  EXPECT_EQ(radef_kNotInitialized, srapi_CloseConnection(&test_instance, connection_id, detailed_reason));
+  EXPECT_EQ(radef_kNotInitialized, srapi_SendData(&test_instance, connection_id, message_size, &message_buffer));
+  EXPECT_EQ(radef_kNotInitialized, srapi_ReadData(&test_instance, connection_id, buffer_size, &message_size, &message_buffer));
+  EXPECT_EQ(radef_kNotInitialized, srapi_GetConnectionState(&test_instance, connection_id, &state, &buffer_utilisation, &buffer_size));
+  EXPECT_EQ(radef_kNotInitialized, srapi_CheckTimings(&test_instance));
+
+  // call the functions with a NULL instance
+  EXPECT_EQ(radef_kNotInitialized, srapi_OpenConnection((srapi_Instance *)NULL, sender_id, receiver_id, network_id, &connection_id));
+  EXPECT_EQ(radef_kNotInitialized, srapi_CloseConnection((srapi_Instance *)NULL, connection_id, detailed_reason));
+  EXPECT_EQ(radef_kNotInitialized, srapi_SendData((srapi_Instance *)NULL, connection_id, message_size, &message_buffer));
+  EXPECT_EQ(radef_kNotInitialized, srapi_ReadData((srapi_Instance *)NULL, connection_id, buffer_size, &message_size, &message_buffer));
+  EXPECT_EQ(radef_kNotInitialized, srapi_GetConnectionState((srapi_Instance *)NULL, connection_id, &state, &buffer_utilisation, &buffer_size));
+  EXPECT_EQ(radef_kNotInitialized, srapi_CheckTimings((srapi_Instance *)NULL));
+  EXPECT_EQ(radef_kNotInitialized, srapi_GetInitializationState((srapi_Instance *)NULL));
 }
 
 /**
@@ -337,16 +361,173 @@ TEST_F(srapiTest, srapiTest005VerifyGetInitializationState) {
   const srcty_SafetyRetransmissionConfiguration dummy_config = {};
 
   // call the GetInitializationState function without prior initialization and verify that it returns NotInitialized
-  EXPECT_EQ(radef_kNotInitialized, srapi_GetInitializationState());
+  EXPECT_EQ(radef_kNotInitialized, srapi_GetInitializationState(&test_instance));
 
   // initialize the module
   EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&dummy_config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
   EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
   EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
-  EXPECT_EQ(radef_kNoError, srapi_Init(&dummy_config));
+  EXPECT_EQ(radef_kNoError, srapi_Init(&dummy_config, connection_memory, sizeof(connection_memory), &instance));
 
   // call the GetInitializationState function again and verify that it returns NoError
-  EXPECT_EQ(radef_kNoError, srapi_GetInitializationState());
+  EXPECT_EQ(radef_kNoError, srapi_GetInitializationState(&test_instance));
+}
+
+/**
+ * @test        @ID{srapiTest014} Verify GetConnectionMemorySize
+ *
+ * @details     This test verifies the GetConnectionMemorySize function of the srapi module
+ *
+ * Test steps:
+ * - call the GetConnectionMemorySize function with invalid connection_memory_size pointer and verify that InvalidParameter is returned
+ * - call the GetConnectionMemorySize function with a number of connections out of range and verify that InvalidParameter is returned
+ * - expect the size calls of srstm and srcor for the minimum and maximum number of connections
+ * - call the GetConnectionMemorySize function and verify that the sum of the module sizes is returned
+ * - call the GetConnectionMemorySize function with module sizes, whose sum exceeds UINT32_MAX, and verify that InvalidParameter is returned
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-520} Error Handling
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srapiTest, srapiTest014VerifyGetConnectionMemorySize) {
+  uint32_t connection_memory_size = 0U;
+
+  // invalid parameters
+  EXPECT_EQ(radef_kInvalidParameter, srapi_GetConnectionMemorySize(1U, (uint32_t *)NULL));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_GetConnectionMemorySize(0U, &connection_memory_size));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS + 1U, &connection_memory_size));
+  EXPECT_EQ(0U, connection_memory_size);
+
+  // minimum number of connections
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(1U)).WillOnce(Return(16U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(1U)).WillOnce(Return(1000U));
+  EXPECT_EQ(radef_kNoError, srapi_GetConnectionMemorySize(1U, &connection_memory_size));
+  EXPECT_EQ(1016U, connection_memory_size);
+
+  // maximum number of connections
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)).WillOnce(Return(32U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)).WillOnce(Return(2000U));
+  EXPECT_EQ(radef_kNoError, srapi_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, &connection_memory_size));
+  EXPECT_EQ(2032U, connection_memory_size);
+
+  // sum of the module sizes at the limit of a 32 bit value
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)).WillOnce(Return(64U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)).WillOnce(Return(UINT32_MAX - 64U));
+  EXPECT_EQ(radef_kNoError, srapi_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, &connection_memory_size));
+  EXPECT_EQ(UINT32_MAX, connection_memory_size);
+
+  // sum of the module sizes exceeds a 32 bit value
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)).WillOnce(Return(64U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)).WillOnce(Return(UINT32_MAX - 63U));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, &connection_memory_size));
+  EXPECT_EQ(UINT32_MAX, connection_memory_size);
+}
+
+/**
+ * @test        @ID{srapiTest015} Verify the connection memory checks of the init function
+ *
+ * @details     This test verifies that the init function rejects a connection memory, which is not aligned or too small.
+ *
+ * Test steps:
+ * - call the Init function with a not aligned connection memory and verify that InvalidParameter is returned
+ * - call the Init function with a too small connection memory and verify that InvalidParameter is returned
+ * - call the Init function with a needed connection memory, which exceeds UINT32_MAX, and verify that InvalidParameter is returned
+ * - call the Init function with a connection memory of exactly the needed size and verify that it completes successfully
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-544} Init sr_api Function
+ * @verifyReq{RASW-520} Error Handling
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srapiTest, srapiTest015VerifyInitConnectionMemoryCheck) {
+  const srcty_SafetyRetransmissionConfiguration dummy_config = {};
+  uint8_t *const connection_memory_bytes = (uint8_t *)connection_memory;
+
+  // not aligned connection memory
+  EXPECT_EQ(radef_kInvalidParameter, srapi_Init(&dummy_config, &connection_memory_bytes[1], sizeof(connection_memory) - 1U, &instance));
+  EXPECT_FALSE(test_instance.initialized);
+
+  // needed connection memory exceeds a 32 bit value
+  EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&dummy_config)).WillRepeatedly(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(UINT32_MAX));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(UINT32_MAX));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_Init(&dummy_config, connection_memory, UINT32_MAX, &instance));
+  EXPECT_FALSE(test_instance.initialized);
+
+  // too small connection memory
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillRepeatedly(Return(16U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillRepeatedly(Return(32U));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_Init(&dummy_config, connection_memory, 47U, &instance));
+  EXPECT_FALSE(test_instance.initialized);
+
+  // connection memory of exactly the needed size
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, 48U)).Times(1);
+  EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
+  EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
+  EXPECT_EQ(radef_kNoError, srapi_Init(&dummy_config, connection_memory, 48U, &instance));
+  EXPECT_TRUE(test_instance.initialized);
+}
+
+/**
+ * @test        @ID{srapiTest017} Verify the message slab check of the init function
+ *
+ * @details     This test verifies that the init function rejects a configuration, for which the share of the message slab chunks per connection is too small.
+ *
+ * Test steps:
+ * - call the Init function with a configuration, whose chunk share is not sufficient, and verify that InvalidParameter is returned
+ * - verify that the number of connections and n_send_max of the configuration are checked
+ * - call the Init function with a sufficient chunk share and verify that it completes successfully
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-544} Init sr_api Function
+ * @verifyReq{RASW-520} Error Handling
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srapiTest, srapiTest017VerifyInitMessageSlabCheck) {
+  srcty_SafetyRetransmissionConfiguration config = {};
+  config.number_of_connections = RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS;
+  config.n_send_max = RADEF_MAX_N_SEND_MAX;
+
+  EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&config)).WillRepeatedly(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillRepeatedly(Return(16U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillRepeatedly(Return(32U));
+
+  // chunk share too small
+  EXPECT_CALL(srsend_mock, srsend_IsChunkShareSufficient(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, RADEF_MAX_N_SEND_MAX)).WillOnce(Return(false));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
+  EXPECT_FALSE(test_instance.initialized);
+
+  // sufficient chunk share
+  EXPECT_CALL(srsend_mock, srsend_IsChunkShareSufficient(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, RADEF_MAX_N_SEND_MAX)).WillOnce(Return(true));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
+  EXPECT_CALL(srstm_mock, srstm_Init(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)).Times(1);
+  EXPECT_CALL(srcor_mock, srcor_Init(&config)).Times(1);
+  EXPECT_EQ(radef_kNoError, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
+  EXPECT_TRUE(test_instance.initialized);
 }
 
 /** @}*/
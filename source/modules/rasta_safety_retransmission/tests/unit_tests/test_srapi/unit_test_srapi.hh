@@ -28,12 +28,15 @@
 #include "inc/rasta_safety_retransmission/srapi_sr_api.h"
 #include "src/srstm_sr_state_machine.h"
 #include "srcor_sr_core.h"
+#include "srmem_sr_connection_memory.h"
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasys_mock.hh"
 #include "srcor_mock.hh"
+#include "srmem_mock.hh"
 #include "srstm_mock.hh"
 #include "srsend_mock.hh"
 #include "srrece_mock.hh"
+#include "srins_mock.hh"
 // clang-format on
 
 using testing::NaggyMock;
@@ -57,6 +60,7 @@ using testing::DoAll;
 #define UT_SRAPI_DATA_LEN_MIN 1U        ///< minimum value for payload data length
 #define UT_SRAPI_DATA_LEN_MAX 1055U     ///< maximum value for payload data length
 #define UT_SRAPI_NSENDMAX_MAX 20        ///< maximum value for nSendMax (buffer size)
+#define UT_SRAPI_CONNECTION_MEMORY_SIZE 64  ///< size of the connection memory [bytes]
 
 // -----------------------------------------------------------------------------
 // Global Type Definitions
@@ -68,8 +72,6 @@ using testing::DoAll;
 
 extern uint8_t test_payload_data_u8[UT_SRAPI_DATA_LEN_MAX];
 
-extern bool srapi_initialized;                            ///< initialization state (local variable)
-
 // -----------------------------------------------------------------------------
 // Global Const Declarations
 // -----------------------------------------------------------------------------
@@ -90,8 +92,12 @@ class srapiTest : public ::testing::Test
 {
 public:
   srapiTest() {
-    // reset initialization state
-    srapi_initialized = false;
+    // the test instance is available as long as it is not initialized
+    EXPECT_CALL(srins_mock, srins_IsInstanceAvailable()).WillRepeatedly(Invoke([this]() { return !test_instance.initialized; }));
+    EXPECT_CALL(srins_mock, srins_CreateInstance()).WillRepeatedly(Return(&test_instance));
+    EXPECT_CALL(srins_mock, srins_SelectInstance(&test_instance)).Times(testing::AnyNumber());
+    // the message slab is sufficient for the configurations of the tests
+    EXPECT_CALL(srsend_mock, srsend_IsChunkShareSufficient(_, _)).WillRepeatedly(Return(true));
   }
   ~srapiTest() {
   }
@@ -250,11 +256,17 @@ public:
     throw std::invalid_argument("Invalid argument!");
   }
 
+  uint64_t connection_memory[UT_SRAPI_CONNECTION_MEMORY_SIZE / sizeof(uint64_t)];  ///< connection memory passed to the init function
+  srapi_Instance test_instance = {};                ///< SafRetL instance returned by the mocked srins_CreateInstance function
+  srapi_Instance *instance = nullptr;               ///< SafRetL instance returned by the init function
+
   StrictMock<rasysMock>   rasys_mock;     ///< mock for the rasta system adapter class
   NaggyMock<srcorMock>    srcor_mock;     ///< mock for the rasta safety and retransmission core class
+  NaggyMock<srmemMock>    srmem_mock;     ///< mock for the rasta safety and retransmission connection memory class
   NaggyMock<srstmMock>    srstm_mock;     ///< mock for the rasta safety and retransmission state machine class
   NaggyMock<srsendMock>   srsend_mock;    ///< mock for the rasta safety and retransmission send buffer class
   NaggyMock<srreceMock>   srrece_mock;    ///< mock for the rasta safety and retransmission received buffer class
+  NaggyMock<srinsMock>    srins_mock;     ///< mock for the rasta safety and retransmission instances class
 };
 
 #endif  // SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_UNIT_TESTS_TEST_SRAPI_UNIT_TEST_SRAPI_HH_
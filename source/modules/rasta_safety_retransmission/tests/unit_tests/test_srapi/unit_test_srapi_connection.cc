@@ -195,9 +195,12 @@ TEST_P(OpenConnectionTestWithParam, srapiTest006VerifyOpenConnectionFunction) {
 
   // initialize the module
   EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
   EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
   EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
-  EXPECT_EQ(radef_kNoError, srapi_Init(&config));
+  EXPECT_EQ(radef_kNoError, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
 
   // set expectations on GetConnectionId and ProcessConnectionStateMachine
   if (network_id == conf_network_id) {
@@ -209,7 +212,7 @@ TEST_P(OpenConnectionTestWithParam, srapiTest006VerifyOpenConnectionFunction) {
   }
 
   // call the OpenConnection function and verify the return value
-  EXPECT_EQ(return_code, srapi_OpenConnection(sender_id, receiver_id, network_id, &connection_id));
+  EXPECT_EQ(return_code, srapi_OpenConnection(&test_instance, sender_id, receiver_id, network_id, &connection_id));
   EXPECT_EQ(connection_id, exp_connection_id);
 }
 
@@ -290,9 +293,12 @@ TEST_P(CloseConnectionTestWithParam, srapiTest007VerifyCloseConnectionFunction)
 
   // initialize the module
   EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
   EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
   EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
-  EXPECT_EQ(radef_kNoError, srapi_Init(&config));
+  EXPECT_EQ(radef_kNoError, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
 
   // set expectations on SetDiscDetailedReason and ProcessConnectionStateMachine
   if (connection_id < n_max_conn) {
@@ -301,7 +307,7 @@ TEST_P(CloseConnectionTestWithParam, srapiTest007VerifyCloseConnectionFunction)
   }
 
   // call the CloseConnection function and verify the return value
-  EXPECT_EQ(return_code, srapi_CloseConnection(connection_id, detailed_reason));
+  EXPECT_EQ(return_code, srapi_CloseConnection(&test_instance, connection_id, detailed_reason));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -394,9 +400,12 @@ TEST_P(GetConnectionStateTestWithParam, srapiTest008VerifyGetConnectionStateFunc
 
   // initialize the module
   EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
   EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
   EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
-  EXPECT_EQ(radef_kNoError, srapi_Init(&config));
+  EXPECT_EQ(radef_kNoError, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
 
   // set expectations on SetDiscDetailedReason and ProcessConnectionStateMachine
   if (connection_id < n_max_conn) {
@@ -405,7 +414,7 @@ TEST_P(GetConnectionStateTestWithParam, srapiTest008VerifyGetConnectionStateFunc
   }
 
   // call the GetConnectionState function and verify the return value
-  EXPECT_EQ(return_code, srapi_GetConnectionState(connection_id, &returned_state, &buffer_utilisation, &opposite_buffer_size));
+  EXPECT_EQ(return_code, srapi_GetConnectionState(&test_instance, connection_id, &returned_state, &buffer_utilisation, &opposite_buffer_size));
 
   // verify the state returned
   EXPECT_EQ(returned_state, exp_state);
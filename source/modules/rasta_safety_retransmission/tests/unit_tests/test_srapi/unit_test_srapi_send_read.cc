@@ -181,9 +181,12 @@ TEST_P(SendDataTestWithParam, srapiTest009VerifySendDataFunction) {
 
   // initialize the module
   EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
   EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
   EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
-  EXPECT_EQ(radef_kNoError, srapi_Init(&config));
+  EXPECT_EQ(radef_kNoError, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
 
   // set expectations on srsend_GetFreeBufferEntries, srcor_WriteMessagePayloadToTemporaryBuffer and srstm_ProcessConnectionStateMachine
   if ((connection_id < n_max_conn) &&
@@ -200,7 +203,7 @@ TEST_P(SendDataTestWithParam, srapiTest009VerifySendDataFunction) {
   }
 
   // call the SendData function and verify the return value
-  EXPECT_EQ(return_code, srapi_SendData(connection_id, message_size, test_data_ptr));
+  EXPECT_EQ(return_code, srapi_SendData(&test_instance, connection_id, message_size, test_data_ptr));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -296,9 +299,12 @@ TEST_P(ReadDataTestWithParam, srapiTest010VerifyReadDataFunction)
 
   // initialize the module
   EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
   EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
   EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
-  EXPECT_EQ(radef_kNoError, srapi_Init(&config));
+  EXPECT_EQ(radef_kNoError, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
 
   // set expectations on srrece_GetPayloadSizeOfNextMessageToRead and srrece_ReadFromBuffer
   if ((buffer_size >= UT_SRAPI_DATA_LEN_MIN) && (buffer_size <= UT_SRAPI_DATA_LEN_MAX)) {
@@ -310,7 +316,7 @@ TEST_P(ReadDataTestWithParam, srapiTest010VerifyReadDataFunction)
   }
 
   // call the ReadData function and verify the return value
-  EXPECT_EQ(return_code, srapi_ReadData(connection_id, buffer_size, &message_size, message_data));
+  EXPECT_EQ(return_code, srapi_ReadData(&test_instance, connection_id, buffer_size, &message_size, message_data));
 
   // verify the data
   if (radef_kNoError == return_code) {
@@ -337,6 +343,151 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(UT_SRAPI_MAX_NUM_CONN, 0, UT_SRAPI_DATA_LEN_MIN, test_payload_data_u8, (UT_SRAPI_DATA_LEN_MIN + 1), radef_kInvalidBufferSize)
   ));
 
+/**
+ * @test        @ID{srapiTest012} Verify the PeekData function of the srapi module
+ *
+ * @details     This test verifies that the PeekData function hands out the message in the received buffer without copying it.
+ *
+ * Test steps:
+ * - call the PeekData function before the initialization and verify the return value
+ * - create a SafetyRetransmissionConfiguration with two connections and initialize the module with this configuration
+ * - call the PeekData function with NULL pointers and an invalid connection id and verify the return value
+ * - set the mock function call expectation on the srrece_PeekFromBuffer function and return no message
+ * - call the PeekData function and verify the return value
+ * - set the mock function call expectation on the srrece_PeekFromBuffer function and provide a view of the test data
+ * - call the PeekData function and verify that the message size and the data pointer of the view are returned
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-549} Read Data Function
+ * @verifyReq{RASW-273} Connection Identification
+ * @verifyReq{RASW-268} Message Size
+ * @verifyReq{RASW-286} Error Code
+ * @verifyReq{RASW-503} Enum RaSta Return Code Usage
+ */
+TEST_F(srapiTest, srapiTest012VerifyPeekDataFunction)
+{
+  // test variables
+  uint16_t message_size = 0;
+  const uint8_t * message_data = nullptr;
+  const srtyp_SrMessagePayloadView payload_view = {UT_SRAPI_DATA_LEN_MAX, test_payload_data_u8};
+
+  // create fake configuration
+  const srcty_SafetyRetransmissionConfiguration config = {
+    0,
+    0,
+    0,
+    srcty_kSafetyCodeTypeLowerMd4,
+    0,
+    0,
+    0,
+    0,
+    UT_SRAPI_MAX_NUM_CONN,
+    {0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0}
+  };
+
+  // call the function without initialization
+  EXPECT_EQ(radef_kNotInitialized, srapi_PeekData(&test_instance, 0, &message_size, &message_data));
+
+  // initialize the module
+  EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
+  EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
+  EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
+  EXPECT_EQ(radef_kNoError, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
+
+  // invalid parameters
+  EXPECT_EQ(radef_kInvalidParameter, srapi_PeekData(&test_instance, 0, nullptr, &message_data));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_PeekData(&test_instance, 0, &message_size, nullptr));
+  EXPECT_EQ(radef_kInvalidParameter, srapi_PeekData(&test_instance, UT_SRAPI_MAX_NUM_CONN, &message_size, &message_data));
+
+  // no message received
+  EXPECT_CALL(srrece_mock, srrece_PeekFromBuffer(1, _)).WillOnce(Return(radef_kNoMessageReceived));
+  EXPECT_EQ(radef_kNoMessageReceived, srapi_PeekData(&test_instance, 1, &message_size, &message_data));
+  EXPECT_EQ(message_size, 0);
+  EXPECT_EQ(message_data, nullptr);
+
+  // message received, the data pointer of the view is handed out
+  EXPECT_CALL(srrece_mock, srrece_PeekFromBuffer(1, _)).WillOnce(DoAll(SetArgPointee<1>(payload_view), Return(radef_kNoError)));
+  EXPECT_EQ(radef_kNoError, srapi_PeekData(&test_instance, 1, &message_size, &message_data));
+  EXPECT_EQ(message_size, UT_SRAPI_DATA_LEN_MAX);
+  EXPECT_EQ(message_data, test_payload_data_u8);
+}
+
+/**
+ * @test        @ID{srapiTest013} Verify the ReleaseData function of the srapi module
+ *
+ * @details     This test verifies that the ReleaseData function removes the next message from the received buffer.
+ *
+ * Test steps:
+ * - call the ReleaseData function before the initialization and verify the return value
+ * - create a SafetyRetransmissionConfiguration with two connections and initialize the module with this configuration
+ * - call the ReleaseData function with an invalid connection id and verify the return value
+ * - set the mock function call expectation on the srrece_ReleaseFromBuffer function with the given return values
+ * - call the ReleaseData function and verify that the return value of srrece_ReleaseFromBuffer is returned
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-549} Read Data Function
+ * @verifyReq{RASW-273} Connection Identification
+ * @verifyReq{RASW-286} Error Code
+ * @verifyReq{RASW-503} Enum RaSta Return Code Usage
+ */
+TEST_F(srapiTest, srapiTest013VerifyReleaseDataFunction)
+{
+  // create fake configuration
+  const srcty_SafetyRetransmissionConfiguration config = {
+    0,
+    0,
+    0,
+    srcty_kSafetyCodeTypeLowerMd4,
+    0,
+    0,
+    0,
+    0,
+    UT_SRAPI_MAX_NUM_CONN,
+    {0, 0, 0},
+    {0, 0, 0, 0},
+    {0, 0, 0, 0}
+  };
+
+  // call the function without initialization
+  EXPECT_EQ(radef_kNotInitialized, srapi_ReleaseData(&test_instance, 0));
+
+  // initialize the module
+  EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
+  EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
+  EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
+  EXPECT_EQ(radef_kNoError, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
+
+  // invalid connection id
+  EXPECT_EQ(radef_kInvalidParameter, srapi_ReleaseData(&test_instance, UT_SRAPI_MAX_NUM_CONN));
+
+  // release a message and release from an empty buffer
+  EXPECT_CALL(srrece_mock, srrece_ReleaseFromBuffer(1)).WillOnce(Return(radef_kNoError)).WillOnce(Return(radef_kNoMessageReceived));
+  EXPECT_EQ(radef_kNoError, srapi_ReleaseData(&test_instance, 1));
+  EXPECT_EQ(radef_kNoMessageReceived, srapi_ReleaseData(&test_instance, 1));
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -118,6 +118,7 @@ class CheckTimingsTestWithParam : public srapiTest,
  * - set the mock function call expectation on the ReceiveMessage function and set ConnectionEvent, sn_in_seq and cts_in seq according to the test parameter
  * - set the mock function call expectation on the ProcessConnectionStateMachine and verify ConnectionEvent, sn_in_seq and cts_in seq
  * - set the mock function call expectation on the SendPendingMessages function and verify the data
+ * - set the mock function call expectation on the GetExpiredTimerConnection function and return the connections 0 and 1 as connections with an expired timer
  * - set the mock function call expectation on the IsMessageTimeout function and return true or false according to the test parameter
  * - expect the ProcessConnectionStateMachine function to be called with event set to Timeout if isMessageTimeout is true
  * - set the mock function call expectations on the GetNumberOfMessagesToSend and IsHeartbeatInterval functions and return the values according to the test parameter
@@ -201,9 +202,12 @@ TEST_P(CheckTimingsTestWithParam, srapiTest011VerifyCheckTimingsFunction) {
 
   // initialize the module
   EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
   EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
   EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
-  EXPECT_EQ(radef_kNoError, srapi_Init(&config));
+  EXPECT_EQ(radef_kNoError, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
 
   // number of rounds (get minimum of available messages and free read buffer space)
   uint8_t rounds_id0 = std::min(id0_msg_available, id0_rbuf_free);
@@ -260,6 +264,14 @@ TEST_P(CheckTimingsTestWithParam, srapiTest011VerifyCheckTimingsFunction) {
   EXPECT_CALL(srcor_mock, srcor_SendPendingMessages(UT_SRAPI_CONN_IDX_0)).Times(1);
   EXPECT_CALL(srcor_mock, srcor_SendPendingMessages(UT_SRAPI_CONN_IDX_1)).Times(1);
 
+  // both connections have an expired timer
+  {
+    InSequence s3;
+    EXPECT_CALL(srcor_mock, srcor_GetExpiredTimerConnection(_)).WillOnce(DoAll(SetArgPointee<0>(UT_SRAPI_CONN_IDX_0), Return(true)));
+    EXPECT_CALL(srcor_mock, srcor_GetExpiredTimerConnection(_)).WillOnce(DoAll(SetArgPointee<0>(UT_SRAPI_CONN_IDX_1), Return(true)));
+    EXPECT_CALL(srcor_mock, srcor_GetExpiredTimerConnection(_)).WillOnce(Return(false));
+  }
+
   // expect calls for IsMessageTimeout (ID0)
   EXPECT_CALL(srcor_mock, srcor_IsMessageTimeout(UT_SRAPI_CONN_IDX_0)).WillOnce(Return(id0_is_msg_timeout));
   // if a message timeout occurred, handle it
@@ -303,7 +315,7 @@ TEST_P(CheckTimingsTestWithParam, srapiTest011VerifyCheckTimingsFunction) {
   }
 
   // call the CheckTimings function and verify the return value
-  EXPECT_EQ(radef_kNoError, srapi_CheckTimings());
+  EXPECT_EQ(radef_kNoError, srapi_CheckTimings(&test_instance));
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -340,6 +352,161 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(1, 20, 20, true, 0, false, 1, 20, 20, true, 0, false, srtyp_kConnEventNone, false, false)
   ));
 
+/**
+ * @test        @ID{srapiTest018} Verify the order of the CheckTimings function with a timeout and a pending message in the same call
+ *
+ * @details     This test verifies that the CheckTimings function processes the pending messages and sends the pending messages of all connections, before
+ *              it checks the timings of the connections with an expired timer. A pending message prevents the message timeout of its connection, the
+ *              connection without pending message times out.
+ *
+ * Test steps:
+ * - create a SafetyRetransmissionConfiguration with two connections and initialize the module with this configuration
+ * - expect in sequence:
+ *   - connection 0: one pending message, which is received and processed in the state machine, and the sending of the pending messages
+ *   - connection 1: no pending message and the sending of the pending messages
+ *   - the expired timer of connection 0, for which no message timeout and no heartbeat interval is returned, since the received message restarted the timer
+ *   - the expired timer of connection 1, for which a message timeout is returned and processed in the state machine
+ *   - no further expired timer
+ * - call the CheckTimings function and verify the return value
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-551} Check Timings Function
+ * @verifyReq{RASW-319} Check Timings Function Structure
+ */
+TEST_F(srapiTest, srapiTest018VerifyCheckTimingsTimeoutAndPendingMessage) {
+  // create fake configuration
+  const srcty_SafetyRetransmissionConfiguration config = {
+    0,
+    0,
+    0,
+    srcty_kSafetyCodeTypeLowerMd4,
+    0,
+    0,
+    0,
+    0,
+    UT_SRAPI_MAX_NUM_CONN,
+    {{UT_SRAPI_CONN_IDX_0, 0, 0}, {UT_SRAPI_CONN_IDX_1, 0, 0}}, // two connections, ID=0 and ID=1
+    {0, 0, 0, 0},
+    {0, 0, 0, 0}
+  };
+
+  // initialize the module
+  EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
+  EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
+  EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
+  EXPECT_EQ(radef_kNoError, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
+
+  {
+    InSequence s;
+
+    // connection 0: pending message received and processed, then the pending messages are sent
+    EXPECT_CALL(srcor_mock, srcor_IsReceivedMsgPendingAndBuffersNotFull(UT_SRAPI_CONN_IDX_0)).WillOnce(Return(true));
+    EXPECT_CALL(srcor_mock, srcor_ReceiveMessage(UT_SRAPI_CONN_IDX_0, _, _, _))
+      .WillOnce(DoAll(SetArgPointee<1>(srtyp_kConnEventDataReceived), SetArgPointee<2>(true), SetArgPointee<3>(true)));
+    EXPECT_CALL(srstm_mock, srstm_ProcessConnectionStateMachine(UT_SRAPI_CONN_IDX_0, srtyp_kConnEventDataReceived, true, true)).Times(1);
+    EXPECT_CALL(srcor_mock, srcor_IsReceivedMsgPendingAndBuffersNotFull(UT_SRAPI_CONN_IDX_0)).WillOnce(Return(false));
+    EXPECT_CALL(srcor_mock, srcor_SendPendingMessages(UT_SRAPI_CONN_IDX_0)).Times(1);
+
+    // connection 1: no pending message
+    EXPECT_CALL(srcor_mock, srcor_IsReceivedMsgPendingAndBuffersNotFull(UT_SRAPI_CONN_IDX_1)).WillOnce(Return(false));
+    EXPECT_CALL(srcor_mock, srcor_SendPendingMessages(UT_SRAPI_CONN_IDX_1)).Times(1);
+
+    // connection 0: the timer expired before the call, but the received message prevents the message timeout
+    EXPECT_CALL(srcor_mock, srcor_GetExpiredTimerConnection(_)).WillOnce(DoAll(SetArgPointee<0>(UT_SRAPI_CONN_IDX_0), Return(true)));
+    EXPECT_CALL(srcor_mock, srcor_IsMessageTimeout(UT_SRAPI_CONN_IDX_0)).WillOnce(Return(false));
+    EXPECT_CALL(srsend_mock, srsend_GetNumberOfMessagesToSend(UT_SRAPI_CONN_IDX_0)).WillOnce(Return(0U));
+    EXPECT_CALL(srcor_mock, srcor_IsHeartbeatInterval(UT_SRAPI_CONN_IDX_0)).WillOnce(Return(false));
+
+    // connection 1: message timeout
+    EXPECT_CALL(srcor_mock, srcor_GetExpiredTimerConnection(_)).WillOnce(DoAll(SetArgPointee<0>(UT_SRAPI_CONN_IDX_1), Return(true)));
+    EXPECT_CALL(srcor_mock, srcor_IsMessageTimeout(UT_SRAPI_CONN_IDX_1)).WillOnce(Return(true));
+    EXPECT_CALL(srstm_mock, srstm_ProcessConnectionStateMachine(UT_SRAPI_CONN_IDX_1, srtyp_kConnEventTimeout, false, false)).Times(1);
+
+    EXPECT_CALL(srcor_mock, srcor_GetExpiredTimerConnection(_)).WillOnce(Return(false));
+  }
+
+  // call the CheckTimings function and verify the return value
+  EXPECT_EQ(radef_kNoError, srapi_CheckTimings(&test_instance));
+}
+
+/**
+ * @test        @ID{srapiTest016} Verify the GetNextDeadline function of the srapi module
+ *
+ * @details     This test verifies the behaviour of the GetNextDeadline function.
+ *
+ * Test steps:
+ * - call the GetNextDeadline function without prior initialization and verify that NotInitialized is returned
+ * - create a SafetyRetransmissionConfiguration and initialize the module with this configuration
+ * - call the GetNextDeadline function with a NULL pointer and verify that InvalidParameter is returned
+ * - expect the GetTimeToNextDeadline function of the core module to return a running timer and verify the returned time until the next deadline
+ * - expect the GetTimeToNextDeadline function of the core module to return no running timer and verify that UINT32_MAX is returned
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-317} Error Code
+ * @verifyReq{RASW-503} Enum RaSta Return Code Usage
+ */
+TEST_F(srapiTest, srapiTest016VerifyGetNextDeadlineFunction) {
+  // create fake configuration
+  const srcty_SafetyRetransmissionConfiguration config = {
+    0,
+    0,
+    0,
+    srcty_kSafetyCodeTypeLowerMd4,
+    0,
+    0,
+    0,
+    0,
+    UT_SRAPI_MAX_NUM_CONN,
+    {{UT_SRAPI_CONN_IDX_0, 0, 0}, {UT_SRAPI_CONN_IDX_1, 0, 0}}, // two connections, ID=0 and ID=1
+    {0, 0, 0, 0},
+    {0, 0, 0, 0}
+  };
+  const uint32_t time_to_deadline = 42U;
+  uint32_t time_to_next_deadline = 0U;
+
+  // not initialized
+  EXPECT_EQ(radef_kNotInitialized, srapi_GetNextDeadline(&test_instance, &time_to_next_deadline));
+
+  // initialize the module
+  EXPECT_CALL(srcor_mock, srcor_IsConfigurationValid(&config)).WillOnce(Return(true));
+  EXPECT_CALL(srstm_mock, srstm_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srcor_mock, srcor_GetConnectionMemorySize(_)).WillOnce(Return(0U));
+  EXPECT_CALL(srmem_mock, srmem_Init(connection_memory, sizeof(connection_memory))).Times(1);
+  EXPECT_CALL(srstm_mock, srstm_Init(_)).Times(1);
+  EXPECT_CALL(srcor_mock, srcor_Init(_)).Times(1);
+  EXPECT_EQ(radef_kNoError, srapi_Init(&config, connection_memory, sizeof(connection_memory), &instance));
+
+  // NULL pointer
+  EXPECT_EQ(radef_kInvalidParameter, srapi_GetNextDeadline(&test_instance, nullptr));
+
+  // running timer
+  EXPECT_CALL(srcor_mock, srcor_GetTimeToNextDeadline(_)).WillOnce(DoAll(SetArgPointee<0>(time_to_deadline), Return(true)));
+  EXPECT_EQ(radef_kNoError, srapi_GetNextDeadline(&test_instance, &time_to_next_deadline));
+  EXPECT_EQ(time_to_deadline, time_to_next_deadline);
+
+  // no running timer
+  EXPECT_CALL(srcor_mock, srcor_GetTimeToNextDeadline(_)).WillOnce(Return(false));
+  EXPECT_EQ(radef_kNoError, srapi_GetNextDeadline(&test_instance, &time_to_next_deadline));
+  EXPECT_EQ(UINT32_MAX, time_to_next_deadline);
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -156,7 +156,7 @@ TEST_P(InitTestWithParam, srcorTest002VerifyInitFunction)
     EXPECT_NO_THROW(srcor_Init(&default_config));
 
     // check initialization state
-    EXPECT_TRUE(srcor_initialized);
+    EXPECT_TRUE(srcor_instance->initialized);
   }
   else
   {
@@ -165,7 +165,7 @@ TEST_P(InitTestWithParam, srcorTest002VerifyInitFunction)
     EXPECT_THROW(srcor_Init(&invalid_test_config), std::invalid_argument);
 
     // check initialization state
-    EXPECT_FALSE(srcor_initialized);
+    EXPECT_FALSE(srcor_instance->initialized);
   }
 }
 
@@ -235,6 +235,8 @@ TEST_F(srcorTest, srcorTest003VerifyInitFunctionCalls)
  * - call the srcor_WriteMessagePayloadToTemporaryBuffer function with invalid message payload pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srcor_GetBufferSizeAndUtilisation function with invalid buffer utilization pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srcor_GetBufferSizeAndUtilisation function with invalid buffer size pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srcor_GetExpiredTimerConnection function with invalid connection id pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srcor_GetTimeToNextDeadline function with invalid time pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * .
  *
  * @safetyRel   Yes
@@ -259,7 +261,7 @@ TEST_F(srcorTest, srcorTest003VerifyInitFunctionCalls)
  */
 TEST_F(srcorTest, srcorTest004VerifyNullPointerCheck)
 {
-  uint8_t nbr_of_function_calls = 9U;        // number of function calls
+  uint8_t nbr_of_function_calls = 11U;       // number of function calls
 
   // test variables
   uint32_t sender_id = 0U;
@@ -300,6 +302,8 @@ TEST_F(srcorTest, srcorTest004VerifyNullPointerCheck)
   EXPECT_THROW(srcor_WriteMessagePayloadToTemporaryBuffer(connection_id, message_payload_size, (uint8_t *)NULL), std::invalid_argument);
   EXPECT_THROW(srcor_GetBufferSizeAndUtilisation(connection_id, (sraty_BufferUtilisation *)NULL, &opposite_buffer_size), std::invalid_argument);
   EXPECT_THROW(srcor_GetBufferSizeAndUtilisation(connection_id, &buffer_utilisation, (uint16_t *)NULL), std::invalid_argument);
+  EXPECT_THROW(srcor_GetExpiredTimerConnection((uint32_t *)NULL), std::invalid_argument);
+  EXPECT_THROW(srcor_GetTimeToNextDeadline((uint32_t *)NULL), std::invalid_argument);
 }
 
 /**
@@ -333,6 +337,8 @@ TEST_F(srcorTest, srcorTest004VerifyNullPointerCheck)
  * - call the IsConnRoleServer function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the IsMessageTimeout function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the IsHeartbeatInterval function and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - call the GetExpiredTimerConnection function and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - call the GetTimeToNextDeadline function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the SendPendingMessages function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the SendConnectionStateNotification function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the GetBufferSizeAndUtilisation function and verify that a fatal error with error code radef_kNotInitialized gets thrown
@@ -380,12 +386,13 @@ TEST_F(srcorTest, srcorTest004VerifyNullPointerCheck)
  */
 TEST_F(srcorTest, srcorTest005VerifyInitializationCheck)
 {
-  uint8_t nbr_of_function_calls = 27U;      // number of function calls
+  uint8_t nbr_of_function_calls = 29U;      // number of function calls
 
   // Test variables
   uint32_t sender_id = 0U;
   uint32_t receiver_id = 0U;
   uint32_t connection_id = 0U;
+  uint32_t time_to_next_deadline = 0U;
   uint32_t message_payload_size = 0U;
   uint16_t opposite_buffer_size = 0U;
   uint16_t detailed_disconnect_reason = 0U;
@@ -427,6 +434,8 @@ TEST_F(srcorTest, srcorTest005VerifyInitializationCheck)
   EXPECT_THROW(srcor_IsConnRoleServer(connection_id), std::invalid_argument);
   EXPECT_THROW(srcor_IsMessageTimeout(connection_id), std::invalid_argument);
   EXPECT_THROW(srcor_IsHeartbeatInterval(connection_id), std::invalid_argument);
+  EXPECT_THROW(srcor_GetExpiredTimerConnection(&connection_id), std::invalid_argument);
+  EXPECT_THROW(srcor_GetTimeToNextDeadline(&time_to_next_deadline), std::invalid_argument);
   EXPECT_THROW(srcor_SendPendingMessages(connection_id), std::invalid_argument);
   EXPECT_THROW(srcor_SendConnectionStateNotification(connection_id, connection_state, disconnect_reason), std::invalid_argument);
   EXPECT_THROW(srcor_GetBufferSizeAndUtilisation(connection_id, &buffer_utilisation, &opposite_buffer_size), std::invalid_argument);
@@ -524,13 +533,13 @@ TEST_P(InitRastaConnDataTestWithParam, srcorTest006VerifyInitRastaConnDataFuncti
     EXPECT_CALL(srdia_mock, srdia_InitConnectionDiagnostics(connection_id));
     EXPECT_CALL(srsend_mock, srsend_InitBuffer(connection_id));
     EXPECT_CALL(srrece_mock, srrece_InitBuffer(connection_id));
-    EXPECT_CALL(sradin_mock, sradin_OpenRedundancyChannel(connection_id)); // connection and redundancy channel are the same (1:1 mapping)
+    EXPECT_CALL(sradin_mock, sradin_OpenRedundancyChannel(&test_instance, connection_id)); // connection and redundancy channel are the same (1:1 mapping)
 
     // set sender and receiver id
     test_config.connection_configurations[connection_id].sender_id = sender_id;
     test_config.connection_configurations[connection_id].receiver_id = receiver_id;
 
-    srcor_rasta_connections[connection_id].confirmed_sequence_number_tx = 123; // set to any value to verify if reset when not in server role
+    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx = 123; // set to any value to verify if reset when not in server role
   }
 
   // call the init function
@@ -546,14 +555,14 @@ TEST_P(InitRastaConnDataTestWithParam, srcorTest006VerifyInitRastaConnDataFuncti
     EXPECT_NO_THROW(srcor_InitRaStaConnData(connection_id));
 
     // verify: SN_T set to random number and, t_i to configured t_max
-    ASSERT_EQ(srcor_rasta_connections[connection_id].sequence_number_tx, random_number);
-    ASSERT_EQ(srcor_rasta_connections[connection_id].timer_t_i, test_config.t_max);
+    ASSERT_EQ(srcor_instance->rasta_connections[connection_id].sequence_number_tx, random_number);
+    ASSERT_EQ(srcor_instance->rasta_connections[connection_id].timer_t_i, test_config.t_max);
 
     if(!is_conn_role_server)
     {
       // verify CS_T is set to 0 and CTS_R to current time
-      EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_sequence_number_tx, 0);
-      EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_time_stamp_rx, timer_value);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx, 0);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx, timer_value);
     }
   }
 }
@@ -572,6 +581,147 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, (UT_SRCOR_CONNECTION_ID_MAX + 1), false, radef_kInvalidParameter)
   ));
 
+/**
+ * @test        @ID{srcorTest035} Verify the GetConnectionMemorySize function
+ *
+ * @details     This test verifies that the GetConnectionMemorySize function returns the size of the connection memory
+ *              used by the core module, the timers of the connections and by the diagnostics, send buffer and received buffer modules.
+ *
+ * Test steps:
+ * - call the GetConnectionMemorySize function with an invalid number of connections and expect a fatal error
+ * - for the minimum and maximum number of connections:
+ *   - expect the GetConnectionMemorySize calls of the srdia, srsend and srrece modules
+ *   - verify that the returned size is the sum of the core data size, the timer size and the module sizes
+ * - expect module sizes, whose sum exceeds UINT32_MAX, and verify that a fatal error is thrown
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-571} Init sr_core Function
+ */
+TEST_F(srcorTest, srcorTest035VerifyGetConnectionMemorySize) {
+  const uint32_t srdia_size = 8U;     // connection memory size of the srdia module
+  const uint32_t srsend_size = 16U;   // connection memory size of the srsend module
+  const uint32_t srrece_size = 32U;   // connection memory size of the srrece module
+
+  // invalid number of connections
+  EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(2).WillRepeatedly(Invoke(this, &srcorTest::invalidArgumentException));
+  EXPECT_THROW(srcor_GetConnectionMemorySize(UT_SRCOR_CONNECTION_NUM_MIN - 1U), std::invalid_argument);
+  EXPECT_THROW(srcor_GetConnectionMemorySize(UT_SRCOR_CONNECTION_NUM_MAX + 1U), std::invalid_argument);
+
+  for (uint32_t configured_connections = UT_SRCOR_CONNECTION_NUM_MIN; configured_connections <= UT_SRCOR_CONNECTION_NUM_MAX; ++configured_connections) {
+    EXPECT_CALL(srdia_mock, srdia_GetConnectionMemorySize(configured_connections)).WillOnce(Return(srdia_size));
+    EXPECT_CALL(srsend_mock, srsend_GetConnectionMemorySize(configured_connections)).WillOnce(Return(srsend_size));
+    EXPECT_CALL(srrece_mock, srrece_GetConnectionMemorySize(configured_connections)).WillOnce(Return(srrece_size));
+
+    EXPECT_EQ(srmem_GetAllocationSize(configured_connections * sizeof(srcor_RaStaConnectionData)) +
+                  srmem_GetAllocationSize(configured_connections * 2U * sizeof(ratmw_Timer)) + srdia_size + srsend_size + srrece_size,
+              srcor_GetConnectionMemorySize(configured_connections));
+  }
+
+  // sum of the sizes exceeds a 32 bit value
+  EXPECT_CALL(srdia_mock, srdia_GetConnectionMemorySize(UT_SRCOR_CONNECTION_NUM_MAX)).WillOnce(Return(srdia_size));
+  EXPECT_CALL(srsend_mock, srsend_GetConnectionMemorySize(UT_SRCOR_CONNECTION_NUM_MAX)).WillOnce(Return(srsend_size));
+  EXPECT_CALL(srrece_mock, srrece_GetConnectionMemorySize(UT_SRCOR_CONNECTION_NUM_MAX)).WillOnce(Return(UINT32_MAX - srsend_size));
+  EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &srcorTest::invalidArgumentException));
+  EXPECT_THROW(srcor_GetConnectionMemorySize(UT_SRCOR_CONNECTION_NUM_MAX), std::invalid_argument);
+}
+
+/**
+ * @test        @ID{srcorTest037} Verify the message timeout timer
+ *
+ * @details     This test verifies that the InitRaStaConnData function starts the message timeout timer of a connection in client role, that
+ *              the GetTimeToNextDeadline and GetExpiredTimerConnection functions report this timer and that the CloseRedundancyChannel
+ *              function stops it.
+ *
+ * Test steps:
+ * - Create a config with two connections, connection 0 in client role and connection 1 in server role
+ * - Initialize the module
+ * - Call the InitRaStaConnData function for both connections at time 1000
+ * - call the GetTimeToNextDeadline function and verify that the time to the next deadline is Tmax + 1
+ * - call the GetExpiredTimerConnection function at time 1000 + Tmax and verify that no timer is expired
+ * - call the GetExpiredTimerConnection function at time 1000 + Tmax + 1 and verify that connection 0 is returned
+ * - call the GetExpiredTimerConnection function again and verify that the expiry is returned only once
+ * - Call the InitRaStaConnData function for connection 0 at time 2000 and close its redundancy channel
+ * - call the GetTimeToNextDeadline function and verify that no timer is running
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-572} Init RaSTA Connection Data Function
+ * @verifyReq{RASW-531} Get Timer Value Function
+ */
+TEST_F(srcorTest, srcorTest037VerifyMessageTimeoutTimer)
+{
+  // test variables
+  srcty_SafetyRetransmissionConfiguration test_config = default_config;
+  test_config.number_of_connections = UT_SRCOR_CONNECTION_NUM_MAX;
+  const uint32_t start_time = 1000U;    // time of the first connection data initialization
+  const uint32_t restart_time = 2000U;  // time of the second connection data initialization
+  uint32_t connection_id = 0U;
+  uint32_t time_to_next_deadline = 0U;
+
+  // The communication partner with the higher value is server, the one with the lower value client.
+  test_config.connection_configurations[0].sender_id = 0U;
+  test_config.connection_configurations[0].receiver_id = 1U;
+  test_config.connection_configurations[1].sender_id = 2U;
+  test_config.connection_configurations[1].receiver_id = 1U;
+
+  // set expectations for init module
+  EXPECT_CALL(srdia_mock, srdia_AreDiagnosticTimingIntervalsValid(_, _)).WillOnce(Return(true));
+  EXPECT_CALL(rasys_mock, rasys_GetTimerGranularity()).Times(1);
+  EXPECT_CALL(srmsg_mock, srmsg_Init(test_config.safety_code_type, _)).Times(1);
+  EXPECT_CALL(srdia_mock, srdia_Init(test_config.number_of_connections, test_config.t_max, test_config.n_diag_window, test_config.diag_timing_distr_intervals)).Times(1);
+  EXPECT_CALL(srsend_mock, srsend_Init(test_config.number_of_connections)).Times(1);
+  EXPECT_CALL(srrece_mock, srrece_Init(test_config.number_of_connections, test_config.n_send_max)).Times(1);
+
+  // set expectations for the connection data initializations and the timer functions
+  EXPECT_CALL(rasys_mock, rasys_GetRandomNumber()).Times(3).WillRepeatedly(Return(0U));
+  EXPECT_CALL(srdia_mock, srdia_InitConnectionDiagnostics(_)).Times(3);
+  EXPECT_CALL(srsend_mock, srsend_InitBuffer(_)).Times(3);
+  EXPECT_CALL(srrece_mock, srrece_InitBuffer(_)).Times(3);
+  EXPECT_CALL(sradin_mock, sradin_OpenRedundancyChannel(&test_instance, _)).Times(3);
+  EXPECT_CALL(sradin_mock, sradin_CloseRedundancyChannel(&test_instance, 0U)).Times(1);
+  EXPECT_CALL(srdia_mock, srdia_SendDiagnosticNotification(0U)).Times(1);
+  EXPECT_CALL(rasys_mock, rasys_GetTimerValue())
+      .WillOnce(Return(start_time))
+      .WillOnce(Return(start_time))
+      .WillOnce(Return(start_time + test_config.t_max))
+      .WillOnce(Return(start_time + test_config.t_max + 1U))
+      .WillOnce(Return(start_time + test_config.t_max + 1U))
+      .WillOnce(Return(restart_time))
+      .WillOnce(Return(restart_time));
+
+  EXPECT_NO_THROW(srcor_Init(&test_config));
+  EXPECT_NO_THROW(srcor_InitRaStaConnData(0U));
+  EXPECT_NO_THROW(srcor_InitRaStaConnData(1U));
+
+  // only the timeout timer of the client connection is running
+  EXPECT_TRUE(srcor_GetTimeToNextDeadline(&time_to_next_deadline));
+  EXPECT_EQ(time_to_next_deadline, test_config.t_max + 1U);
+
+  // timer expires when the message timeout is detected
+  EXPECT_FALSE(srcor_GetExpiredTimerConnection(&connection_id));
+  EXPECT_TRUE(srcor_GetExpiredTimerConnection(&connection_id));
+  EXPECT_EQ(connection_id, 0U);
+  EXPECT_FALSE(srcor_GetExpiredTimerConnection(&connection_id));
+
+  // closing the redundancy channel stops the restarted timer
+  EXPECT_NO_THROW(srcor_InitRaStaConnData(0U));
+  EXPECT_NO_THROW(srcor_CloseRedundancyChannel(0U));
+  EXPECT_FALSE(srcor_GetTimeToNextDeadline(&time_to_next_deadline));
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
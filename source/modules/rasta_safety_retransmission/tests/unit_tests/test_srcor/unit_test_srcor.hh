@@ -27,11 +27,15 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "src/srcor_sr_core.h"
+#include "src/srmem_sr_connection_memory.h"
 #include "rasta_common/raas_rasta_assert.h"
+#include "rasta_common/ratmw_rasta_timer_wheel.h"
 #include "test_helper.hh"
 #include "rasys_mock.hh"
+#include "raslb_mock.hh"
 #include "srmsg_mock.hh"
 #include "srdia_mock.hh"
+#include "srins_mock.hh"
 #include "srsend_mock.hh"
 #include "srrece_mock.hh"
 #include "sradin_mock.hh"
@@ -42,6 +46,7 @@ using testing::NaggyMock;
 using testing::StrictMock;
 using testing::_;
 using testing::SetArgPointee;
+using testing::Pointee;
 using testing::SetArgReferee;
 using testing::SetArrayArgument;
 using testing::SaveArg;
@@ -62,14 +67,19 @@ using testing::Throw;
 #define UT_SRCOR_PAYLOAD_LEN_MIN                        1U         ///< minimum length of data message payload
 #define UT_SRCOR_PAYLOAD_LEN_MAX                        1055U      ///< maximum length of data message payload
 #define UT_SRCOR_MESSAGE_LEN_MAX                        1101U      ///< maximum message length
+#define UT_SRCOR_MESSAGE_LEN_HEADER                     28U        ///< message length of a message header without safety code
+#define UT_SRCOR_MESSAGE_LEN_HB                         36U        ///< message length of a heartbeat message with lower MD4 safety code
 #define UT_SRCOR_SEND_BUFFER_SIZE_MAX                   20U        ///< maximum size of send buffer [messages]
 #define UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND          3          ///< minimum free send buffer entries to send [messages]
 #define UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX                20U        ///< maximum size of receive buffer [messages]
 #define UT_SRCOR_RECEIVE_MIN_FREE_ENTRIES_TO_RECEIVE    1          ///< minimum free receive buffer entries for receive [messages]
 #define UT_SRCOR_NSENDMAX_MAX                           20U        ///< maximum value for nSendMax (buffer size)
+#define UT_SRCOR_N_MAX_PACKET_MIN                       1U         ///< minimum value for n_max_packet
+#define UT_SRCOR_N_MAX_PACKET_MAX                       16U        ///< maximum value for n_max_packet
 #define UT_SRCOR_HB_MIN                                 300U       ///< minimum heartbeat period
 #define UT_SRCOR_HB_MAX                                 750U       ///< maximum heartbeat period
 #define UT_SRCOR_TIMER_GRANULARITY                      1          ///< timer granularity
+#define UT_SRCOR_CONNECTION_MEMORY_SIZE                 65536U     ///< size of the connection memory [bytes]
 
 #define UT_SRCOR_SEQ_RANGE_MAX UT_SRCOR_NSENDMAX_MAX * 10U        ///< max range that the seq nbr still accepted
 
@@ -81,10 +91,10 @@ using testing::Throw;
 // Global Variable Declarations
 // -----------------------------------------------------------------------------
 
-extern bool srcor_initialized;                                                      ///< initialization state (module local variable)
+extern RADEF_THREAD_LOCAL srcor_InstanceData *srcor_instance;                       ///< data of the selected core module instance
 extern uint8_t test_payload_data_u8[UT_SRCOR_PAYLOAD_LEN_MAX];                      ///< test payload data
 extern uint8_t test_message_data_u8[UT_SRCOR_MESSAGE_LEN_MAX];                      ///< test message data
-extern srcor_RaStaConnectionData srcor_rasta_connections[UT_SRCOR_CONNECTION_NUM_MAX];    ///< rasta connection data
+extern RADEF_THREAD_LOCAL srmem_InstanceData *srmem_instance;                       ///< data of the selected connection memory module instance
 
 /**
  * @brief default config for tests
@@ -148,7 +158,12 @@ class srcorTest : public ::testing::Test
 public:
   srcorTest() {
     // reset initialization state
-    srcor_initialized = false;
+    srcor_instance->initialized = false;
+    srmem_instance->initialized = false;
+    // initialize connection memory module
+    srmem_Init(connection_memory, sizeof(connection_memory));
+    // the adapter interface and the notifications are called with the selected SafRetL instance
+    EXPECT_CALL(srins_mock, srins_GetSelectedInstance()).WillRepeatedly(Return(&test_instance));
   }
   ~srcorTest() {
   }
@@ -237,9 +252,14 @@ public:
     return data;
   }
 
+  uint64_t connection_memory[UT_SRCOR_CONNECTION_MEMORY_SIZE / sizeof(uint64_t)];  ///< connection memory for the rasta connection data
+  srapi_Instance test_instance = {};  ///< SafRetL instance, which is passed to the adapter interface and the notifications
+
   StrictMock<rasysMock>   rasys_mock;     ///< mock for the rasta system adapter class
+  NaggyMock<raslbMock>    raslb_mock;     ///< mock for the rasta message slab class
   NaggyMock<srmsgMock>    srmsg_mock;     ///< mock for the rasta safety and retransmission messages class
   NaggyMock<srdiaMock>    srdia_mock;     ///< mock for the rasta safety and retransmission diagnostics class
+  NaggyMock<srinsMock>    srins_mock;     ///< mock for the rasta safety and retransmission instances class
   NaggyMock<srsendMock>   srsend_mock;    ///< mock for the rasta safety and retransmission send buffer class
   NaggyMock<srreceMock>   srrece_mock;    ///< mock for the rasta safety and retransmission received buffer class
   NaggyMock<sradinMock>   sradin_mock;    ///< mock for the rasta safety and retransmission adapter interface class
@@ -51,7 +51,7 @@ const uint32_t m_w_a_min = 1;             ///< max. value for m_w_a
 const uint32_t m_w_a_max = 19;            ///< min. value for m_w_a
 
 const uint32_t n_max_packet_min = 1;      ///< max. value for n_max_packet
-const uint32_t n_max_packet_max = 1;      ///< min. value for n_max_packet
+const uint32_t n_max_packet_max = 16;     ///< min. value for n_max_packet
 
 const uint32_t n_diag_win_min = 100;      ///< max. value for n_diag_window
 const uint32_t n_diag_win_max = 10000;    ///< min. value for n_diag_window
@@ -183,13 +183,14 @@ class IsConfigValidTestWithParam :  public srcorTest,
  * | 23       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 1      | 0, 0, 1              | 1, 0, 1                   | True             | True              | Normal Operation |
  * | 24       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 0      | 0, 0, 1              | 1, 0, 1                   | True             | False             | Normal Operation |
  * | 25       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 3      | 0, 0, 1              | 1, 0, 1                   | True             | False             | Normal Operation |
- * | 26       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 2      | 0, 0, 1              | 1, 0, 1                   | True             | True              | Normal Operation |
+ * | 26       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 2      | 0, 0, 1              | 1, 1, 0                   | True             | True              | Normal Operation |
  * | 27       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 2      | 1, 0, 1              | 1, 0, 1                   | True             | False             | Normal Operation |
  * | 28       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 2      | 0, 0, 1              | 2, 0, 1                   | True             | False             | Normal Operation |
  * | 29       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 2      | 0, 0, 0              | 1, 0, 1                   | True             | False             | Normal Operation |
  * | 30       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 2      | 0, 0, 1              | 1, 0, 0                   | True             | False             | Normal Operation |
  * | 31       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 2      | 0, 0, 1              | 1, 0xfffffffe, 0xffffffff | True             | True              | Normal Operation |
  * | 32       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 2      | 0, 0, 1              | 1, 0, 1                   | False            | False             | Normal Operation |
+ * | 33       | 2000  | 750 | FullMd4     | 1     | 20       | 1          | 10000       | 2      | 0, 0, 1              | 1, 0, 1                   | True             | False             | Normal Operation |
  *
  * @safetyRel   Yes
  *
@@ -243,6 +244,7 @@ TEST_P(IsConfigValidTestWithParam, srcorTest001VerifyIsConfigurationValidFunctio
         ((n_send_max_min <= n_send_max) && (n_send_max <= n_send_max_max)) &&
         (m_w_a < n_send_max) &&
         ((n_max_packet_min <= n_max_packet) && (n_max_packet <= n_max_packet_max)) &&
+        (n_max_packet <= n_send_max) &&
         ((n_diag_win_min <= n_diag_window) && (n_diag_window <= n_diag_win_max)) &&
         ((n_conn_min <= n_connections) && (n_connections <= n_conn_max)) )
   {
@@ -307,6 +309,10 @@ INSTANTIATE_TEST_SUITE_P(
                         n_conn_min, 0, 0, 1, 1, 0, 1, true, false),
         std::make_tuple(t_max_max, t_h_max, srcty_kSafetyCodeTypeFullMd4, m_w_a_max, n_send_max_max, n_max_packet_max, n_diag_win_min,
                         n_conn_min, 0, 0, 1, 1, 0, 1, true, true),
+        std::make_tuple(t_max_max, t_h_max, srcty_kSafetyCodeTypeFullMd4, m_w_a_min, n_send_max_min, n_send_max_min, n_diag_win_min,
+                        n_conn_min, 0, 0, 1, 1, 0, 1, true, true),
+        std::make_tuple(t_max_max, t_h_max, srcty_kSafetyCodeTypeFullMd4, m_w_a_min, n_send_max_min, (n_send_max_min + 1), n_diag_win_min,
+                        n_conn_min, 0, 0, 1, 1, 0, 1, true, false),
         // check n_diag_win
         std::make_tuple(t_max_max, t_h_max, srcty_kSafetyCodeTypeFullMd4, m_w_a_max, n_send_max_max, n_max_packet_max, (n_diag_win_min - 1),
                         n_conn_min, 0, 0, 1, 1, 0, 1, true, false),
@@ -320,7 +326,7 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(t_max_max, t_h_max, srcty_kSafetyCodeTypeFullMd4, m_w_a_max, n_send_max_max, n_max_packet_max, n_diag_win_max,
                         (n_conn_max + 1), 0, 0, 1, 1, 0, 1, true, false),
         std::make_tuple(t_max_max, t_h_max, srcty_kSafetyCodeTypeFullMd4, m_w_a_max, n_send_max_max, n_max_packet_max, n_diag_win_max,
-                        n_conn_max, 0, 0, 1, 1, 0, 1, true, true),
+                        n_conn_max, 0, 0, 1, 1, 1, 0, true, true),
         // check connection ID, receiver ID and sender ID
         std::make_tuple(t_max_max, t_h_max, srcty_kSafetyCodeTypeFullMd4, m_w_a_max, n_send_max_max, n_max_packet_max, n_diag_win_max,
                         n_conn_max, 1, 0, 1, 1, 0, 1, true, false),
@@ -334,7 +340,10 @@ INSTANTIATE_TEST_SUITE_P(
                         n_conn_max, 0, 0, 1, 1, (UINT32_MAX - 1), UINT32_MAX, true, true),
         // check diag_timing_distr_intervals
         std::make_tuple(t_max_max, t_h_max, srcty_kSafetyCodeTypeFullMd4, m_w_a_max, n_send_max_max, n_max_packet_max, n_diag_win_max,
-                        n_conn_max, 0, 0, 1, 1, 0, 1, false, false)
+                        n_conn_max, 0, 0, 1, 1, 0, 1, false, false),
+        // check duplicated combination of receiver ID and sender ID
+        std::make_tuple(t_max_max, t_h_max, srcty_kSafetyCodeTypeFullMd4, m_w_a_max, n_send_max_max, n_max_packet_max, n_diag_win_max,
+                        n_conn_max, 0, 0, 1, 1, 0, 1, true, false)
     ));
 
 /** @}*/
@@ -0,0 +1,222 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_srcor_connections.cc
+ *
+ * @author Nicola Fricker, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version fe457be274667230cc30cc95371dedfe439bab25
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Unit test file for the core module of the safety and retransmission layer with a large number of connections.
+ *
+ * This file is built in the gtest_srcor_connections test with a ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS of a gateway.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "unit_test_srcor.hh"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Type Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Config with the maximum number of connections, which is used by the module after its initialization
+ */
+static srcty_SafetyRetransmissionConfiguration max_connections_config;
+
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Constant Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Test Class Definitions
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test class for the tests with the maximum number of connections
+ *
+ * The connection memory of the default test class is replaced by a connection memory for the maximum number of connections.
+ */
+class srcorConnectionsTest : public srcorTest
+{
+public:
+  srcorConnectionsTest() {
+    // The connection memory of the other modules is not needed, since these modules are mocked
+    EXPECT_CALL(srdia_mock, srdia_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)).WillRepeatedly(Return(0U));
+    EXPECT_CALL(srsend_mock, srsend_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)).WillRepeatedly(Return(0U));
+    EXPECT_CALL(srrece_mock, srrece_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS)).WillRepeatedly(Return(0U));
+    large_connection_memory.resize((srcor_GetConnectionMemorySize(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS) / sizeof(uint64_t)) + 1U);
+
+    srmem_instance->initialized = false;
+    srmem_Init(large_connection_memory.data(), (uint32_t)(large_connection_memory.size() * sizeof(uint64_t)));
+
+    // Every connection uses other sender and receiver ids, connection 2 * n and 2 * n + 1 are the two sides of a pair
+    max_connections_config = default_config;
+    max_connections_config.number_of_connections = RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS;
+    for (uint32_t connection_id = 0U; connection_id < RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS; ++connection_id) {
+      max_connections_config.connection_configurations[connection_id].connection_id = connection_id;
+      max_connections_config.connection_configurations[connection_id].sender_id = getSenderId(connection_id);
+      max_connections_config.connection_configurations[connection_id].receiver_id = getSenderId(connection_id ^ 1U);
+    }
+
+    // set expectations for init module
+    EXPECT_CALL(srdia_mock, srdia_AreDiagnosticTimingIntervalsValid(_, _)).WillRepeatedly(Return(true));
+    EXPECT_CALL(rasys_mock, rasys_GetTimerGranularity()).WillRepeatedly(Return(UT_SRCOR_TIMER_GRANULARITY));
+  }
+
+  /**
+   * @brief Get the sender id of a connection
+   *
+   * @param connection_id connection id
+   * @return uint32_t sender id, which is also the receiver id of the other connection of the pair
+   */
+  static uint32_t getSenderId(const uint32_t connection_id) {
+    return (connection_id * 0x10001U) + 1U;
+  }
+
+  std::vector<uint64_t> large_connection_memory;  ///< connection memory for the maximum number of connections
+};
+
+/**
+ * @test        @ID{srcorTest040} Verify the connection index with the maximum number of connections
+ *
+ * @details     This test verifies that the IsConfigurationValid, Init and GetConnectionId functions work with a
+ *              ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS of a gateway.
+ *
+ * Test steps:
+ * - verify that the build uses more connections than the other unit tests
+ * - create a config with the maximum number of connections
+ * - verify that the config is valid
+ * - configure the sender and receiver id of the first connection also for the last connection and verify that the config is invalid
+ * - initialize the module with the valid config
+ * - call the GetConnectionId function for all connections and verify the connection ids
+ * - call the GetConnectionId function with swapped sender and receiver ids of the last pair and verify that the connection ids are swapped
+ * - call the GetConnectionId function for not configured combinations and verify that radef_kInvalidParameter is returned
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         The module is built with a large ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-573} Is Configuration Valid Function
+ * @verifyReq{RASW-571} Init sr_core Function
+ * @verifyReq{RASW-568} Get Connection ID Function
+ */
+TEST_F(srcorConnectionsTest, srcorTest040VerifyConnectionIndexWithMaximumNumberOfConnections)
+{
+  const uint32_t last_connection_id = RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS - 1U;
+  uint32_t connection_id = 0U;
+
+  ASSERT_GT(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS, 1000U);
+
+  // duplicated connection at the end of the config
+  EXPECT_TRUE(srcor_IsConfigurationValid(&max_connections_config));
+  const srcty_ConnectionConfiguration last_connection = max_connections_config.connection_configurations[last_connection_id];
+  max_connections_config.connection_configurations[last_connection_id].sender_id = max_connections_config.connection_configurations[0].sender_id;
+  max_connections_config.connection_configurations[last_connection_id].receiver_id = max_connections_config.connection_configurations[0].receiver_id;
+  EXPECT_FALSE(srcor_IsConfigurationValid(&max_connections_config));
+  max_connections_config.connection_configurations[last_connection_id] = last_connection;
+
+  // initialize the module
+  EXPECT_NO_THROW(srcor_Init(&max_connections_config));
+
+  // configured connections
+  for (uint32_t expected_connection_id = 0U; expected_connection_id < RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS; ++expected_connection_id) {
+    ASSERT_EQ(radef_kNoError, srcor_GetConnectionId(getSenderId(expected_connection_id), getSenderId(expected_connection_id ^ 1U), &connection_id));
+    ASSERT_EQ(expected_connection_id, connection_id);
+  }
+  EXPECT_EQ(radef_kNoError, srcor_GetConnectionId(getSenderId(last_connection_id ^ 1U), getSenderId(last_connection_id), &connection_id));
+  EXPECT_EQ(last_connection_id - 1U, connection_id);
+
+  // not configured connections
+  EXPECT_EQ(radef_kInvalidParameter, srcor_GetConnectionId(getSenderId(0U), getSenderId(2U), &connection_id));
+  EXPECT_EQ(radef_kInvalidParameter, srcor_GetConnectionId(getSenderId(last_connection_id), getSenderId(last_connection_id), &connection_id));
+  EXPECT_EQ(radef_kInvalidParameter, srcor_GetConnectionId(getSenderId(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS), getSenderId(0U), &connection_id));
+}
+
+/**
+ * @test        @ID{srcorTest041} Verify the timers of the last connection with the maximum number of connections
+ *
+ * @details     This test verifies that the timer wheel holds the timers of all connections, when the module is initialized with a
+ *              ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS of a gateway.
+ *
+ * Test steps:
+ * - initialize the module with the maximum number of connections
+ * - call the InitRaStaConnData function for the last connection in client role at time 1000
+ * - call the GetTimeToNextDeadline function and verify that the time to the next deadline is Tmax + 1
+ * - call the GetExpiredTimerConnection function at time 1000 + Tmax + 1 and verify that the last connection is returned
+ * - call the GetExpiredTimerConnection function again and verify that the expiry is returned only once
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         The module is built with a large ::RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-572} Init RaSTA Connection Data Function
+ * @verifyReq{RASW-531} Get Timer Value Function
+ */
+TEST_F(srcorConnectionsTest, srcorTest041VerifyTimersWithMaximumNumberOfConnections)
+{
+  // The communication partner with the higher value is server, the one with the lower value client, so the even connections are clients
+  const uint32_t client_connection_id = RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS - 2U;
+  const uint32_t start_time = 1000U;  // time of the connection data initialization
+  uint32_t connection_id = 0U;
+  uint32_t time_to_next_deadline = 0U;
+
+  // set expectations for the connection data initialization and the timer functions
+  EXPECT_CALL(rasys_mock, rasys_GetRandomNumber()).WillOnce(Return(0U));
+  EXPECT_CALL(srdia_mock, srdia_InitConnectionDiagnostics(client_connection_id)).Times(1);
+  EXPECT_CALL(srsend_mock, srsend_InitBuffer(client_connection_id)).Times(1);
+  EXPECT_CALL(srrece_mock, srrece_InitBuffer(client_connection_id)).Times(1);
+  EXPECT_CALL(sradin_mock, sradin_OpenRedundancyChannel(&test_instance, client_connection_id)).Times(1);
+  EXPECT_CALL(rasys_mock, rasys_GetTimerValue())
+      .WillOnce(Return(start_time))
+      .WillOnce(Return(start_time))
+      .WillOnce(Return(start_time + max_connections_config.t_max + 1U))
+      .WillOnce(Return(start_time + max_connections_config.t_max + 1U));
+
+  EXPECT_NO_THROW(srcor_Init(&max_connections_config));
+  EXPECT_NO_THROW(srcor_InitRaStaConnData(client_connection_id));
+
+  EXPECT_TRUE(srcor_GetTimeToNextDeadline(&time_to_next_deadline));
+  EXPECT_EQ(time_to_next_deadline, max_connections_config.t_max + 1U);
+
+  EXPECT_TRUE(srcor_GetExpiredTimerConnection(&connection_id));
+  EXPECT_EQ(connection_id, client_connection_id);
+  EXPECT_FALSE(srcor_GetExpiredTimerConnection(&connection_id));
+}
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
@@ -257,22 +257,26 @@ class GetBufferSizeAndUtilisationTestWithParam : public srcorTest, public testin
  * - amount of configured connections (uint32_t)
  * - connection id (uint32_t)
  * - set message pending flag (bool)
+ * - configured n_max_packet (uint32_t)
+ * - size of the read message, 0 if no message is received (uint16_t)
  * - free receive buffer entries (uint32_t)
  * - free send buffer entries (uint32_t)
  * - expect return value (bool)
  * - expect fatal error (bool)
  * .
  */
-class IsReceivedMsgPendingAndBuffersNotFullTestWithParam : public srcorTest, public testing::WithParamInterface<std::tuple<uint32_t, uint32_t, bool, uint32_t, uint32_t, bool, bool>>
+class IsReceivedMsgPendingAndBuffersNotFullTestWithParam : public srcorTest, public testing::WithParamInterface<std::tuple<uint32_t, uint32_t, bool, uint32_t, uint16_t, uint32_t, uint32_t, bool, bool>>
 {
   public:
   uint32_t configured_connections =                       std::get<0>(GetParam());    ///< configured connections
   uint32_t connection_id =                                std::get<1>(GetParam());    ///< connection id
   bool message_pending_flag_set =                         std::get<2>(GetParam());    ///< set message pending flag
-  uint32_t free_receive_buffer_entries =                  std::get<3>(GetParam());    ///< free receive buffer entries
-  uint32_t free_send_buffer_entries =                     std::get<4>(GetParam());    ///< free send buffer entries
-  bool expect_return_value =                              std::get<5>(GetParam());    ///< expect return value
-  bool expect_fatal_error =                               std::get<6>(GetParam());    ///< expect fatal error
+  uint32_t n_max_packet =                                 std::get<3>(GetParam());    ///< configured n_max_packet
+  uint16_t read_message_size =                            std::get<4>(GetParam());    ///< size of the read message
+  uint32_t free_receive_buffer_entries =                  std::get<5>(GetParam());    ///< free receive buffer entries
+  uint32_t free_send_buffer_entries =                     std::get<6>(GetParam());    ///< free send buffer entries
+  bool expect_return_value =                              std::get<7>(GetParam());    ///< expect return value
+  bool expect_fatal_error =                               std::get<8>(GetParam());    ///< expect fatal error
 };
 
 // -----------------------------------------------------------------------------
@@ -360,12 +364,12 @@ TEST_P(IsProtocolVersionAcceptedTestWithParam, srcorTest016VerifyIsProtocolVersi
   if(expected_error == radef_kNoError)
   {
     // set message in buffer on connection according to parameter
-    srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = message_in_buffer;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = message_in_buffer;
 
     // set expectations
     if(message_in_buffer)
     {
-      EXPECT_CALL(srmsg_mock, srmsg_GetConnMessageData(&srcor_rasta_connections[connection_id].input_buffer.message_buffer, _, _)).WillOnce(SetArgPointee<1>(message_protocol_version));
+      EXPECT_CALL(srmsg_mock, srmsg_GetConnMessageData(&srcor_instance->rasta_connections[connection_id].input_buffer.message_buffer, _, _)).WillOnce(SetArgPointee<1>(message_protocol_version));
     }
   }
 
@@ -490,12 +494,12 @@ TEST_P(IsRetrReqSequenceNumberAvailableTestWithParam, srcorTest017VerifyIsRetrRe
   if(expected_error == radef_kNoError)
   {
     // set message in buffer on connection according to parameter
-    srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = message_in_buffer;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = message_in_buffer;
 
     // set expectations
     if(message_in_buffer)
     {
-      srcor_rasta_connections[connection_id].input_buffer.message_header = message_header;
+      srcor_instance->rasta_connections[connection_id].input_buffer.message_header = message_header;
       if(message_header.message_type == srtyp_kSrMessageRetrReq)
       {
         EXPECT_CALL(srsend_mock, srsend_IsSequenceNumberInBuffer(connection_id, (message_header.confirmed_sequence_number + 1))).WillOnce(Return(seq_nbr_result));
@@ -571,15 +575,15 @@ INSTANTIATE_TEST_SUITE_P(
  * | 1        | 0U              | 1                      | 0xffffffffU      | 0U                 | 0U               | 0U                 | True                   | radef_kNoError          | Normal operation   |
  * | 2        | 0U              | 1                      | 0U               | 1U                 | 0U               | 0U                 | False                  | radef_kNoError          | Normal operation   |
  * | 3        | 0U              | 1                      | 0U               | 0xffffffffU        | 0U               | 0U                 | False                  | radef_kNoError          | Normal operation   |
- * | 4        | 1U              | 2                      | 1U               | 0U                 | 1U               | 0U                 | True                   | radef_kNoError          | Normal operation   |
- * | 5        | 1U              | 2                      | 0xffffffffU      | 0U                 | 0xffffffffU      | 0U                 | True                   | radef_kNoError          | Normal operation   |
- * | 6        | 1U              | 2                      | 0U               | 1U                 | 0U               | 1U                 | False                  | radef_kNoError          | Normal operation   |
- * | 7        | 1U              | 2                      | 0U               | 0xffffffffU        | 0U               | 0xffffffffU        | False                  | radef_kNoError          | Normal operation   |
+ * | 4        | 1U              | 2                      | 2U               | 0U                 | 1U               | 0U                 | True                   | radef_kNoError          | Normal operation   |
+ * | 5        | 1U              | 2                      | 0xffffffffU      | 1U                 | 0xffffffffU      | 0U                 | True                   | radef_kNoError          | Normal operation   |
+ * | 6        | 1U              | 2                      | 0U               | 2U                 | 0U               | 1U                 | False                  | radef_kNoError          | Normal operation   |
+ * | 7        | 1U              | 2                      | 1U               | 0xffffffffU        | 0U               | 0xffffffffU        | False                  | radef_kNoError          | Normal operation   |
  * | 8        | 0U              | 1                      | 1U               | 0U                 | 1U               | 2U                 | True                   | radef_kNoError          | Normal operation   |
  * | 9        | 1U              | 2                      | 1U               | 2U                 | 1U               | 0U                 | True                   | radef_kNoError          | Normal operation   |
- * | 10       | 0U              | 2                      | 1U               | 0U                 | 1U               | 0U                 | True                   | radef_kNoError          | Normal operation   |
+ * | 10       | 0U              | 2                      | 1U               | 0U                 | 2U               | 0U                 | True                   | radef_kNoError          | Normal operation   |
  * | 11       | 1U              | 1                      | 1U               | 0U                 | 1U               | 0U                 | False                  | radef_kInvalidParameter | Fatal error raised |
- * | 12       | 2U              | 2                      | 1U               | 0U                 | 1U               | 0U                 | False                  | radef_kInvalidParameter | Fatal error raised |
+ * | 12       | 2U              | 2                      | 1U               | 0U                 | 2U               | 0U                 | False                  | radef_kInvalidParameter | Fatal error raised |
  *
  * @safetyRel   Yes
  *
@@ -637,17 +641,17 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN, 0, 1, 0, 0, false, radef_kNoError),
     std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN, 0, UINT32_MAX, 0, 0, false, radef_kNoError),
     // vary sender and client id of connection 2 and call for connection 2
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MAX, 1, 0, 1, 0, true, radef_kNoError),
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MAX, UINT32_MAX,  0, UINT32_MAX, 0, true, radef_kNoError),
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MAX, 0, 1, 0, 1, false, radef_kNoError),
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MAX, 0, UINT32_MAX, 0, UINT32_MAX, false, radef_kNoError),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MAX, 2, 0, 1, 0, true, radef_kNoError),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MAX, UINT32_MAX,  1, UINT32_MAX, 0, true, radef_kNoError),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MAX, 0, 2, 0, 1, false, radef_kNoError),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MAX, 1, UINT32_MAX, 0, UINT32_MAX, false, radef_kNoError),
     // vary sender and receiver on connections
     std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN, 1, 0, 1, 2, true, radef_kNoError),
     std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MAX, 1, 2, 1, 0, true, radef_kNoError),
     // vary connection configuration and connection id
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MIN, 1, 0, 1, 0, true, radef_kNoError),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MIN, 1, 0, 2, 0, true, radef_kNoError),
     std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MAX, 1, 0, 1, 0, false, radef_kInvalidParameter),
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, (UT_SRCOR_CONNECTION_ID_MAX + 1), 1, 0, 1, 0, false, radef_kInvalidParameter)
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, (UT_SRCOR_CONNECTION_ID_MAX + 1), 1, 0, 2, 0, false, radef_kInvalidParameter)
   )
 );
 
@@ -730,8 +734,8 @@ TEST_P(IsMessageTimeoutTestWithParam, srcorTest019VerifyIsMessageTimeoutFunction
   if(expected_error == radef_kNoError)
   {
     // set last confirmed timestamp and timer ti value
-    srcor_rasta_connections[connection_id].confirmed_time_stamp_rx = last_confirmed_timestamp;
-    srcor_rasta_connections[connection_id].timer_t_i = timer_ti;
+    srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx = last_confirmed_timestamp;
+    srcor_instance->rasta_connections[connection_id].timer_t_i = timer_ti;
   }
 
   // perform the test
@@ -848,7 +852,7 @@ TEST_P(IsHeartbeatIntervalTestWithParam, srcorTest020VerifyIsHeartbeatIntervalFu
   if(expected_error == radef_kNoError)
   {
     // set last confirmed timestamp and timer ti value
-    srcor_rasta_connections[connection_id].time_stamp_tx = last_timestamp_sent;
+    srcor_instance->rasta_connections[connection_id].time_stamp_tx = last_timestamp_sent;
   }
 
   // perform the test
@@ -997,6 +1001,218 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, 0, 1, 2, 3, 2, 1, UT_SRCOR_CONNECTION_ID_MIN , radef_kInvalidParameter)
   ));
 
+/**
+ * @test        @ID{srcorTest036} Verify the connection index of the GetConnectionId function
+ *
+ * @details     This test verifies that the GetConnectionId function finds every configured connection for many
+ *              combinations of sender and receiver ids, also if the connections share a position of the
+ *              connection index.
+ *
+ * Test steps:
+ * - for a set of sender ids spread over the full value range:
+ *   - create a config with two connections, where the second connection uses the sender and receiver id of the first connection swapped
+ *   - initialize the module
+ *   - call the GetConnectionId function for both connections and verify the connection ids
+ *   - call the GetConnectionId function for not configured combinations and verify that radef_kInvalidParameter is returned
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-571} Init sr_core Function
+ * @verifyReq{RASW-568} Get Connection ID Function
+ */
+TEST_F(srcorTest, srcorTest036VerifyGetConnectionIdConnectionIndex)
+{
+  const uint32_t number_of_rounds = 64U;                            // number of tested combinations of sender and receiver ids
+  const uint32_t sender_id_increment = UINT32_MAX / number_of_rounds; // increment of the sender id per round
+  srcty_SafetyRetransmissionConfiguration test_config = default_config;
+  uint32_t connection_id = 0U;
+
+  // set expectations for init module
+  EXPECT_CALL(srdia_mock, srdia_AreDiagnosticTimingIntervalsValid(_, _)).WillRepeatedly(Return(true));
+  EXPECT_CALL(rasys_mock, rasys_GetTimerGranularity()).WillRepeatedly(Return(UT_SRCOR_TIMER_GRANULARITY));
+
+  for (uint32_t round = 0U; round < number_of_rounds; round++)
+  {
+    const uint32_t sender_id = round * sender_id_increment;
+    const uint32_t receiver_id = sender_id + 1U;
+
+    test_config.number_of_connections = UT_SRCOR_CONNECTION_NUM_MAX;
+    test_config.connection_configurations[0].sender_id = sender_id;
+    test_config.connection_configurations[0].receiver_id = receiver_id;
+    test_config.connection_configurations[1].sender_id = receiver_id;
+    test_config.connection_configurations[1].receiver_id = sender_id;
+
+    // initialize the module
+    srcor_instance->initialized = false;
+    srmem_instance->initialized = false;
+    srmem_Init(connection_memory, sizeof(connection_memory));
+    EXPECT_NO_THROW(srcor_Init(&test_config));
+
+    // configured connections
+    EXPECT_EQ(radef_kNoError, srcor_GetConnectionId(sender_id, receiver_id, &connection_id));
+    EXPECT_EQ(UT_SRCOR_CONNECTION_ID_MIN, connection_id);
+    EXPECT_EQ(radef_kNoError, srcor_GetConnectionId(receiver_id, sender_id, &connection_id));
+    EXPECT_EQ(UT_SRCOR_CONNECTION_ID_MAX, connection_id);
+
+    // not configured connections
+    EXPECT_EQ(radef_kInvalidParameter, srcor_GetConnectionId(sender_id, sender_id, &connection_id));
+    EXPECT_EQ(radef_kInvalidParameter, srcor_GetConnectionId(receiver_id, (receiver_id + 1U), &connection_id));
+    EXPECT_EQ(radef_kInvalidParameter, srcor_GetConnectionId((sender_id - 1U), sender_id, &connection_id));
+  }
+}
+
+/**
+ * @test        @ID{srcorTest038} Verify that the IsConfigurationValid function does not change the connection index
+ *
+ * @details     This test verifies that checking a further configuration does not change the connection index of an
+ *              initialized module, which is used by the GetConnectionId function.
+ *
+ * Test steps:
+ * - initialize the module with a config of two connections
+ * - check a valid and an invalid config with other sender and receiver ids
+ * - call the GetConnectionId function and verify that the configured connections are still found
+ * - call the GetConnectionId function and verify that the connections of the checked configs are not found
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-573} Is Configuration Valid Function
+ * @verifyReq{RASW-568} Get Connection ID Function
+ */
+TEST_F(srcorTest, srcorTest038VerifyIsConfigurationValidKeepsConnectionIndex)
+{
+  srcty_SafetyRetransmissionConfiguration other_config = default_config;
+  srcty_SafetyRetransmissionConfiguration duplicated_config = default_config;
+  uint32_t connection_id = 0U;
+
+  // set expectations for init module
+  EXPECT_CALL(srdia_mock, srdia_AreDiagnosticTimingIntervalsValid(_, _)).WillRepeatedly(Return(true));
+  EXPECT_CALL(rasys_mock, rasys_GetTimerGranularity()).WillRepeatedly(Return(UT_SRCOR_TIMER_GRANULARITY));
+
+  // initialize the module
+  EXPECT_NO_THROW(srcor_Init(&default_config));
+
+  // check configs with other sender and receiver ids
+  other_config.connection_configurations[0].sender_id = default_config.connection_configurations[0].sender_id + 100U;
+  other_config.connection_configurations[0].receiver_id = default_config.connection_configurations[0].receiver_id + 100U;
+  other_config.connection_configurations[1].sender_id = default_config.connection_configurations[1].sender_id + 100U;
+  other_config.connection_configurations[1].receiver_id = default_config.connection_configurations[1].receiver_id + 100U;
+  EXPECT_TRUE(srcor_IsConfigurationValid(&other_config));
+
+  duplicated_config.connection_configurations[0] = other_config.connection_configurations[0];
+  duplicated_config.connection_configurations[1] = other_config.connection_configurations[0];
+  duplicated_config.connection_configurations[1].connection_id = UT_SRCOR_CONNECTION_ID_MAX;
+  EXPECT_FALSE(srcor_IsConfigurationValid(&duplicated_config));
+
+  // configured connections are still found
+  EXPECT_EQ(radef_kNoError, srcor_GetConnectionId(default_config.connection_configurations[0].sender_id,
+                                                  default_config.connection_configurations[0].receiver_id, &connection_id));
+  EXPECT_EQ(UT_SRCOR_CONNECTION_ID_MIN, connection_id);
+  EXPECT_EQ(radef_kNoError, srcor_GetConnectionId(default_config.connection_configurations[1].sender_id,
+                                                  default_config.connection_configurations[1].receiver_id, &connection_id));
+  EXPECT_EQ(UT_SRCOR_CONNECTION_ID_MAX, connection_id);
+
+  // connections of the checked configs are not found
+  EXPECT_EQ(radef_kInvalidParameter, srcor_GetConnectionId(other_config.connection_configurations[0].sender_id,
+                                                           other_config.connection_configurations[0].receiver_id, &connection_id));
+  EXPECT_EQ(radef_kInvalidParameter, srcor_GetConnectionId(other_config.connection_configurations[1].sender_id,
+                                                           other_config.connection_configurations[1].receiver_id, &connection_id));
+}
+
+/**
+ * @test        @ID{srcorTest039} Verify the connection index of two instances
+ *
+ * @details     This test verifies that the initialization of a second instance does not change the connection index
+ *              of the first instance, also if the configuration of the second instance is checked while the first
+ *              instance is selected, like srapi_Init does.
+ *
+ * Test steps:
+ * - select the first instance and initialize it with the default config
+ * - check the config of the second instance with other sender and receiver ids while the first instance is selected
+ * - select the second instance and initialize it with its config
+ * - select the first instance and verify with the GetConnectionId function that only its connections are found
+ * - select the second instance and verify with the GetConnectionId function that only its connections are found
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         The module is built with at least two SafRetL instances.
+ * @post        The first instance is selected.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-571} Init sr_core Function
+ * @verifyReq{RASW-568} Get Connection ID Function
+ */
+TEST_F(srcorTest, srcorTest039VerifyConnectionIndexOfTwoInstances)
+{
+  static uint64_t second_connection_memory[UT_SRCOR_CONNECTION_MEMORY_SIZE / sizeof(uint64_t)];
+  srcty_SafetyRetransmissionConfiguration second_config = default_config;
+  uint32_t connection_id = 0U;
+
+  ASSERT_GE(RADEF_MAX_NUMBER_OF_SR_INSTANCES, 2U);
+
+  second_config.connection_configurations[0].sender_id = 0x71U;
+  second_config.connection_configurations[0].receiver_id = 0x72U;
+  second_config.connection_configurations[1].sender_id = 5U;
+  second_config.connection_configurations[1].receiver_id = 7U;
+
+  // set expectations for init module
+  EXPECT_CALL(srdia_mock, srdia_AreDiagnosticTimingIntervalsValid(_, _)).WillRepeatedly(Return(true));
+  EXPECT_CALL(rasys_mock, rasys_GetTimerGranularity()).WillRepeatedly(Return(UT_SRCOR_TIMER_GRANULARITY));
+
+  // initialize the first instance
+  srcor_SelectInstance(0U);
+  srmem_SelectInstance(0U);
+  EXPECT_NO_THROW(srcor_Init(&default_config));
+
+  // check the config of the second instance while the first instance is selected and initialize the second instance
+  EXPECT_TRUE(srcor_IsConfigurationValid(&second_config));
+  srcor_SelectInstance(1U);
+  srmem_SelectInstance(1U);
+  srcor_instance->initialized = false;
+  srmem_instance->initialized = false;
+  srmem_Init(second_connection_memory, sizeof(second_connection_memory));
+  EXPECT_NO_THROW(srcor_Init(&second_config));
+
+  // only the connections of the first instance are found in the first instance
+  srcor_SelectInstance(0U);
+  srmem_SelectInstance(0U);
+  for (uint32_t index = 0U; index < default_config.number_of_connections; ++index) {
+    EXPECT_EQ(radef_kNoError, srcor_GetConnectionId(default_config.connection_configurations[index].sender_id,
+                                                    default_config.connection_configurations[index].receiver_id, &connection_id));
+    EXPECT_EQ(index, connection_id);
+    EXPECT_EQ(radef_kInvalidParameter, srcor_GetConnectionId(second_config.connection_configurations[index].sender_id,
+                                                             second_config.connection_configurations[index].receiver_id, &connection_id));
+  }
+
+  // only the connections of the second instance are found in the second instance
+  srcor_SelectInstance(1U);
+  srmem_SelectInstance(1U);
+  for (uint32_t index = 0U; index < second_config.number_of_connections; ++index) {
+    EXPECT_EQ(radef_kNoError, srcor_GetConnectionId(second_config.connection_configurations[index].sender_id,
+                                                    second_config.connection_configurations[index].receiver_id, &connection_id));
+    EXPECT_EQ(index, connection_id);
+    EXPECT_EQ(radef_kInvalidParameter, srcor_GetConnectionId(default_config.connection_configurations[index].sender_id,
+                                                             default_config.connection_configurations[index].receiver_id, &connection_id));
+  }
+
+  // the other tests use the first instance
+  srcor_SelectInstance(0U);
+  srmem_SelectInstance(0U);
+}
+
 /**
  * @test        @ID{srcorTest022} Verify the GetReceivedMessagePendingFlag function
  *
@@ -1061,7 +1277,7 @@ TEST_P(GetReceivedMessagePendingFlagTestWithParam, srcorTest022VerifyGetReceived
   if(!expect_fatal_error)
   {
     // set flag according to test parameter
-    srcor_rasta_connections[connection_id].received_data_pending = set_flag;
+    srcor_instance->rasta_connections[connection_id].received_data_pending = set_flag;
   }
 
   // execute the test
@@ -1075,7 +1291,7 @@ TEST_P(GetReceivedMessagePendingFlagTestWithParam, srcorTest022VerifyGetReceived
     EXPECT_NO_THROW(srcor_GetReceivedMessagePendingFlag(connection_id));
 
     // verify pending flag
-    EXPECT_EQ(set_flag, srcor_rasta_connections[connection_id].received_data_pending);
+    EXPECT_EQ(set_flag, srcor_instance->rasta_connections[connection_id].received_data_pending);
   }
 }
 
@@ -1179,7 +1395,7 @@ TEST_P(GetBufferSizeAndUtilisationTestWithParam, srcorTest023VerifyGetBufferSize
   if(!expect_fatal_error)
   {
     // set opposite buffer size
-    srcor_rasta_connections[connection_id].opposite_receive_buffer_size = opposite_buffer_size_to_return;
+    srcor_instance->rasta_connections[connection_id].opposite_receive_buffer_size = opposite_buffer_size_to_return;
   }
 
   // execute the test
@@ -1217,39 +1433,50 @@ INSTANTIATE_TEST_SUITE_P(
  * @test        @ID{srcorTest033} Verify the IsReceivedMsgPendingAndBuffersNotFull function
  *
  * @details     This test verifies the IsReceivedMsgPendingAndBuffersNotFull function of the rasta safety and
- *              retransmission layer core module.
+ *              retransmission layer core module. The next message is only read ahead, if a message is pending and the send buffer
+ *              is not full. The free receive buffer entries are then needed for the messages, which can be packed into the read message.
  *
  * Test steps:
- * - Create a config with given amount of connections according test parameter
+ * - Create a config with given amount of connections and n_max_packet according test parameter
  * - Set return values for Receive and Send buffer call according test parameter
  * - Init the module
  * - Expect a radef_kInvalidParameter when fatal error gets thrown
- * - Call the IsReceivedMsgPendingAndBuffersNotFull function and verify the return value
+ * - Expect the read of the next message, if a message is pending and the send buffer is not full
+ * - Call the IsReceivedMsgPendingAndBuffersNotFull function twice and verify the return value and that the message is only read once
+ * - Verify that the message pending flag is reset, if no message is received
  * .
  *
  * @testParameter
  * - Connection id: RaSTA connection identification
  * - Configured connections: Number of configured connections
  * - Set pending flag: Indicates if pending flag gets set before srcor_IsReceivedMsgPendingAndBuffersNotFull function call
+ * - N max packet: Configured n_max_packet
+ * - Read msg size: Size of the message returned by sradin_ReadMessage, 0 if radef_kNoMessageReceived is returned
  * - Free receive bfr entries: Configured return value from srrece_GetFreeBufferEntries function call
  * - Free send bfr entries: Configured return value from srsend_GetFreeBufferEntries function call
  * - Exp. return value: Expected return value from srcor_IsReceivedMsgPendingAndBuffersNotFull function call
  * - Expect fatal error: Indicates if a fatal error is expected
  * .
- * | Test Run | Input parameter | Test config                                                                               |||| Expected values                                           |||
- * |----------|-----------------|------------------------|------------------|--------------------------|-----------------------|-------------------|--------------------|--------------------|
- * |          | Connection id   | Configured connections | Set pending flag | Free receive bfr entries | Free send bfr entries | Exp. return value | Expect fatal error | Test Result        |
- * | 0        | 0               | 1                      | false            | 0                        | 0                     | false             | false              | Normal operation   |
- * | 1        | 0               | 1                      | true             | 0                        | 0                     | false             | false              | Normal operation   |
- * | 2        | 0               | 1                      | false            | 1                        | 3                     | false             | false              | Normal operation   |
- * | 3        | 0               | 1                      | true             | 1                        | 0                     | false             | false              | Normal operation   |
- * | 4        | 0               | 1                      | true             | 0                        | 3                     | false             | false              | Normal operation   |
- * | 5        | 0               | 1                      | true             | 1                        | 3                     | true              | false              | Normal operation   |
- * | 6        | 0               | 1                      | true             | 20                       | 20                    | true              | false              | Normal operation   |
- * | 7        | 1               | 1                      | true             | 20                       | 20                    | false             | true               | Fatal error raised |
- * | 8        | 0               | 2                      | true             | 20                       | 20                    | true              | false              | Normal operation   |
- * | 9        | 1               | 2                      | true             | 20                       | 20                    | true              | false              | Normal operation   |
- * | 10       | 2               | 2                      | true             | 20                       | 20                    | false             | true               | Fatal error raised |
+ * | Test Run | Input parameter | Test config                                                                                                               |||||| Expected values                                           |||
+ * |----------|-----------------|------------------------|------------------|--------------|---------------|--------------------------|-----------------------|-------------------|--------------------|--------------------|
+ * |          | Connection id   | Configured connections | Set pending flag | N max packet | Read msg size | Free receive bfr entries | Free send bfr entries | Exp. return value | Expect fatal error | Test Result        |
+ * | 0        | 0               | 1                      | false            | 1            | 36            | 0                        | 0                     | false             | false              | Normal operation   |
+ * | 1        | 0               | 1                      | true             | 1            | 36            | 0                        | 0                     | false             | false              | Normal operation   |
+ * | 2        | 0               | 1                      | false            | 1            | 36            | 1                        | 3                     | false             | false              | Normal operation   |
+ * | 3        | 0               | 1                      | true             | 1            | 36            | 1                        | 0                     | false             | false              | Normal operation   |
+ * | 4        | 0               | 1                      | true             | 1            | 36            | 0                        | 3                     | false             | false              | Normal operation   |
+ * | 5        | 0               | 1                      | true             | 1            | 36            | 1                        | 3                     | true              | false              | Normal operation   |
+ * | 6        | 0               | 1                      | true             | 1            | 36            | 20                       | 20                    | true              | false              | Normal operation   |
+ * | 7        | 0               | 1                      | true             | 1            | 0             | 20                       | 20                    | false             | false              | Normal operation   |
+ * | 8        | 0               | 1                      | true             | 16           | 28            | 0                        | 3                     | true              | false              | Normal operation   |
+ * | 9        | 0               | 1                      | true             | 16           | 36            | 1                        | 3                     | false             | false              | Normal operation   |
+ * | 10       | 0               | 1                      | true             | 16           | 36            | 2                        | 3                     | true              | false              | Normal operation   |
+ * | 11       | 0               | 1                      | true             | 16           | 1101          | 15                       | 3                     | false             | false              | Normal operation   |
+ * | 12       | 0               | 1                      | true             | 16           | 1101          | 16                       | 3                     | true              | false              | Normal operation   |
+ * | 13       | 1               | 1                      | true             | 1            | 36            | 20                       | 20                    | false             | true               | Fatal error raised |
+ * | 14       | 0               | 2                      | true             | 1            | 36            | 20                       | 20                    | true              | false              | Normal operation   |
+ * | 15       | 1               | 2                      | true             | 1            | 36            | 20                       | 20                    | true              | false              | Normal operation   |
+ * | 16       | 2               | 2                      | true             | 1            | 36            | 20                       | 20                    | false             | true               | Fatal error raised |
  *
  * @safetyRel   Yes
  *
@@ -1259,6 +1486,7 @@ INSTANTIATE_TEST_SUITE_P(
  * @testMethod  Functional Test
  *
  * @verifyReq{RASW-571} Init sr_core Function
+ * @verifyReq{RASW-580} Receive Message Function
  * @verifyReq{RASW-830} Is Received Message Pending And Buffers Not Full Function
  */
 TEST_P(IsReceivedMsgPendingAndBuffersNotFullTestWithParam, srcorTest033VerifyIsReceivedMsgPendingAndBuffersNotFullFunction)
@@ -1266,6 +1494,9 @@ TEST_P(IsReceivedMsgPendingAndBuffersNotFullTestWithParam, srcorTest033VerifyIsR
   // test variables
   srcty_SafetyRetransmissionConfiguration test_config = default_config;
   test_config.number_of_connections = configured_connections;
+  test_config.n_max_packet = n_max_packet;
+  const bool expect_read = message_pending_flag_set && (free_send_buffer_entries >= UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND);
+  const bool expect_message_read = expect_read && (read_message_size > 0U);
 
   // set expectations for init module
   EXPECT_CALL(srdia_mock, srdia_AreDiagnosticTimingIntervalsValid(_, _)).WillOnce(Return(true));
@@ -1277,8 +1508,24 @@ TEST_P(IsReceivedMsgPendingAndBuffersNotFullTestWithParam, srcorTest033VerifyIsR
 
   if(!expect_fatal_error)
   {
-    EXPECT_CALL(srrece_mock, srrece_GetFreeBufferEntries(connection_id)).WillOnce(Return(free_receive_buffer_entries));
-    EXPECT_CALL(srsend_mock, srsend_GetFreeBufferEntries(connection_id)).WillOnce(Return(free_send_buffer_entries));
+    uint32_t red_channel_id = connection_id; // 1:1 mapping
+
+    EXPECT_CALL(srsend_mock, srsend_GetFreeBufferEntries(connection_id)).Times(2).WillRepeatedly(Return(free_send_buffer_entries));
+    if(expect_message_read)
+    {
+      // the message is read only once and kept for the second call
+      EXPECT_CALL(sradin_mock, sradin_ReadMessage(&test_instance, red_channel_id, _, _, _)).WillOnce(DoAll(SetArgPointee<3>(read_message_size), Return(radef_kNoError)));
+      EXPECT_CALL(srrece_mock, srrece_GetFreeBufferEntries(connection_id)).Times(2).WillRepeatedly(Return(free_receive_buffer_entries));
+    }
+    else if(expect_read)
+    {
+      // no message received, the second call finds the reset message pending flag
+      EXPECT_CALL(sradin_mock, sradin_ReadMessage(&test_instance, red_channel_id, _, _, _)).WillOnce(Return(radef_kNoMessageReceived));
+    }
+    else
+    {
+      EXPECT_CALL(sradin_mock, sradin_ReadMessage(_, _, _, _, _)).Times(0);
+    }
   }
 
   // call the init function
@@ -1299,6 +1546,8 @@ TEST_P(IsReceivedMsgPendingAndBuffersNotFullTestWithParam, srcorTest033VerifyIsR
     }
 
     EXPECT_EQ(expect_return_value, srcor_IsReceivedMsgPendingAndBuffersNotFull(connection_id));
+    EXPECT_EQ(expect_return_value, srcor_IsReceivedMsgPendingAndBuffersNotFull(connection_id));
+    EXPECT_EQ(message_pending_flag_set && (!expect_read || expect_message_read), srcor_GetReceivedMessagePendingFlag(connection_id));
   }
 }
 
@@ -1307,22 +1556,101 @@ INSTANTIATE_TEST_SUITE_P(
   IsReceivedMsgPendingAndBuffersNotFullTestWithParam,
   ::testing::Values(
     // vary set pending flag
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       false, 0,                                            0,                                      false, false),
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  0,                                            0,                                      false, false),
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       false, UT_SRCOR_RECEIVE_MIN_FREE_ENTRIES_TO_RECEIVE, UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND, false, false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       false, UT_SRCOR_N_MAX_PACKET_MIN, UT_SRCOR_MESSAGE_LEN_HB,    0,                                            0,                                      false, false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MIN, UT_SRCOR_MESSAGE_LEN_HB,    0,                                            0,                                      false, false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       false, UT_SRCOR_N_MAX_PACKET_MIN, UT_SRCOR_MESSAGE_LEN_HB,    UT_SRCOR_RECEIVE_MIN_FREE_ENTRIES_TO_RECEIVE, UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND, false, false),
     // vary free receive buffer size
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_RECEIVE_MIN_FREE_ENTRIES_TO_RECEIVE, 0,                                      false, false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MIN, UT_SRCOR_MESSAGE_LEN_HB,    UT_SRCOR_RECEIVE_MIN_FREE_ENTRIES_TO_RECEIVE, 0,                                      false, false),
     // vary free send buffer size
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  0,                                            UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND, false, false),
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_RECEIVE_MIN_FREE_ENTRIES_TO_RECEIVE, UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND, true,  false),
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX,             UT_SRCOR_SEND_BUFFER_SIZE_MAX,          true,  false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MIN, UT_SRCOR_MESSAGE_LEN_HB,    0,                                            UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND, false, false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MIN, UT_SRCOR_MESSAGE_LEN_HB,    UT_SRCOR_RECEIVE_MIN_FREE_ENTRIES_TO_RECEIVE, UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND, true,  false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MIN, UT_SRCOR_MESSAGE_LEN_HB,    UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX,             UT_SRCOR_SEND_BUFFER_SIZE_MAX,          true,  false),
+    // no message received
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MIN, 0,                          UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX,             UT_SRCOR_SEND_BUFFER_SIZE_MAX,          false, false),
+    // vary read message size, the free receive buffer entries are only needed for the messages which fit into the read message
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MAX, UT_SRCOR_MESSAGE_LEN_HEADER, 0,                                            UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND, true,  false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MAX, UT_SRCOR_MESSAGE_LEN_HB,    1,                                            UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND, false, false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MAX, UT_SRCOR_MESSAGE_LEN_HB,    2,                                            UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND, true,  false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MAX, UT_SRCOR_MESSAGE_LEN_MAX,   (UT_SRCOR_N_MAX_PACKET_MAX - 1),              UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND, false, false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MAX, UT_SRCOR_MESSAGE_LEN_MAX,   UT_SRCOR_N_MAX_PACKET_MAX,                    UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND, true,  false),
     // vary connections and connection id
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MAX,       true,  UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX,             UT_SRCOR_SEND_BUFFER_SIZE_MAX,          false, true),
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX,             UT_SRCOR_SEND_BUFFER_SIZE_MAX,          true,  false),
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MAX,       true,  UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX,             UT_SRCOR_SEND_BUFFER_SIZE_MAX,          true,  false),
-    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, (UT_SRCOR_CONNECTION_ID_MAX + 1), true,  UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX,             UT_SRCOR_SEND_BUFFER_SIZE_MAX,          false, true)
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MIN, UT_SRCOR_CONNECTION_ID_MAX,       true,  UT_SRCOR_N_MAX_PACKET_MIN, UT_SRCOR_MESSAGE_LEN_HB,    UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX,             UT_SRCOR_SEND_BUFFER_SIZE_MAX,          false, true),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MIN,       true,  UT_SRCOR_N_MAX_PACKET_MIN, UT_SRCOR_MESSAGE_LEN_HB,    UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX,             UT_SRCOR_SEND_BUFFER_SIZE_MAX,          true,  false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, UT_SRCOR_CONNECTION_ID_MAX,       true,  UT_SRCOR_N_MAX_PACKET_MIN, UT_SRCOR_MESSAGE_LEN_HB,    UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX,             UT_SRCOR_SEND_BUFFER_SIZE_MAX,          true,  false),
+    std::make_tuple(UT_SRCOR_CONNECTION_NUM_MAX, (UT_SRCOR_CONNECTION_ID_MAX + 1), true,  UT_SRCOR_N_MAX_PACKET_MIN, UT_SRCOR_MESSAGE_LEN_HB,    UT_SRCOR_RECEIVE_BUFFER_SIZE_MAX,             UT_SRCOR_SEND_BUFFER_SIZE_MAX,          false, true)
   ));
 
+/**
+ * @test        @ID{srcorTest042} Verify that the ReceiveMessage function uses the message read ahead
+ *
+ * @details     This test verifies that the ReceiveMessage function of the rasta safety and retransmission layer core module checks the
+ *              message read ahead by the IsReceivedMsgPendingAndBuffersNotFull function instead of reading another one, and that the
+ *              next ReceiveMessage call reads the next message again.
+ *
+ * Test steps:
+ * - Init the module with the default config
+ * - Set the message pending flag and call the IsReceivedMsgPendingAndBuffersNotFull function, which reads the next message
+ * - Call the ReceiveMessage function and verify that the message read ahead is checked without another read (safety code check fails)
+ * - Call the ReceiveMessage function again and verify that the next message is read
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-580} Receive Message Function
+ * @verifyReq{RASW-830} Is Received Message Pending And Buffers Not Full Function
+ */
+TEST_F(srcorTest, srcorTest042VerifyReceiveMessageUsesMessageReadAhead)
+{
+  // test variables
+  const uint32_t connection_id = UT_SRCOR_CONNECTION_ID_MIN;
+  const uint32_t red_channel_id = connection_id; // 1:1 mapping
+  srtyp_ConnectionEvents connection_event = srtyp_kConnEventNone;
+  bool sequence_number_in_seq = false;
+  bool confirmed_time_stamp_in_seq = false;
+
+  // set expectations for init module
+  EXPECT_CALL(srdia_mock, srdia_AreDiagnosticTimingIntervalsValid(_, _)).WillOnce(Return(true));
+  EXPECT_CALL(rasys_mock, rasys_GetTimerGranularity()).Times(1);
+  EXPECT_CALL(srmsg_mock, srmsg_Init(_, _)).Times(1);
+  EXPECT_CALL(srdia_mock, srdia_Init(_, _, _, _)).Times(1);
+  EXPECT_CALL(srsend_mock, srsend_Init(_)).Times(1);
+  EXPECT_CALL(srrece_mock, srrece_Init(_, _)).Times(1);
+  EXPECT_NO_THROW(srcor_Init(&default_config));
+
+  {
+    InSequence s;
+
+    // read ahead
+    EXPECT_CALL(srsend_mock, srsend_GetFreeBufferEntries(connection_id)).WillOnce(Return(UT_SRCOR_SEND_MIN_FREE_ENTRIES_TO_SEND));
+    EXPECT_CALL(sradin_mock, sradin_ReadMessage(&test_instance, red_channel_id, _, _, _)).WillOnce(DoAll(SetArgPointee<3>(UT_SRCOR_MESSAGE_LEN_HB), Return(radef_kNoError)));
+    EXPECT_CALL(srrece_mock, srrece_GetFreeBufferEntries(connection_id)).WillOnce(Return(UT_SRCOR_RECEIVE_MIN_FREE_ENTRIES_TO_RECEIVE));
+
+    // receive of the message read ahead
+    EXPECT_CALL(srmsg_mock, srmsg_CheckMessage(_)).WillOnce(Return(radef_kInvalidMessageMd4));
+    EXPECT_CALL(srdia_mock, srdia_IncSafetyCodeErrorCounter(connection_id));
+    EXPECT_CALL(srdia_mock, srdia_IncAddressErrorCounter(connection_id));  // no header is extracted from the rejected message
+
+    // receive of the next message
+    EXPECT_CALL(sradin_mock, sradin_ReadMessage(&test_instance, red_channel_id, _, _, _)).WillOnce(Return(radef_kNoMessageReceived));
+  }
+
+  srcor_SetReceivedMessagePendingFlag(connection_id);
+  EXPECT_TRUE(srcor_IsReceivedMsgPendingAndBuffersNotFull(connection_id));
+
+  srcor_ReceiveMessage(connection_id, &connection_event, &sequence_number_in_seq, &confirmed_time_stamp_in_seq);
+  EXPECT_EQ(srtyp_kConnEventNone, connection_event);
+  EXPECT_TRUE(srcor_GetReceivedMessagePendingFlag(connection_id));
+
+  srcor_ReceiveMessage(connection_id, &connection_event, &sequence_number_in_seq, &confirmed_time_stamp_in_seq);
+  EXPECT_EQ(srtyp_kConnEventNone, connection_event);
+  EXPECT_FALSE(srcor_GetReceivedMessagePendingFlag(connection_id));
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
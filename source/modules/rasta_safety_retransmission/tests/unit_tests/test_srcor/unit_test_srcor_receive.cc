@@ -377,7 +377,7 @@ TEST_P(ReceiveMessageTestWithParam, srcorTest030ReceiveMessageFunction)
     uint32_t red_channel_id = connection_id; // 1:1 mapping
 
     // set expect call for reading message and set created message as pointer
-    EXPECT_CALL(sradin_mock, sradin_ReadMessage(red_channel_id, _, _, _)).WillOnce(DoAll(SetArrayArgument<3>(message_buffer, message_buffer + buffer_size), Return(read_msg_return_value)));
+    EXPECT_CALL(sradin_mock, sradin_ReadMessage(&test_instance, red_channel_id, _, _, _)).WillOnce(DoAll(SetArrayArgument<4>(message_buffer, message_buffer + buffer_size), Return(read_msg_return_value)));
 
     if(read_msg_return_value != radef_kNoMessageReceived && read_msg_return_value != radef_kInternalError)
     {
@@ -390,6 +390,12 @@ TEST_P(ReceiveMessageTestWithParam, srcorTest030ReceiveMessageFunction)
             EXPECT_CALL(srmsg_mock, srmsg_GetMessageHeader(_, _)).WillOnce((Invoke(this, &srcorTest::getMessageHeader)));
           if(message_authentic)
           {
+            if ((message_type == srtyp_kSrMessageData) || (message_type == srtyp_kSrMessageRetrData))
+            {
+              // number of packed messages check, one message per data message
+              EXPECT_CALL(srmsg_mock, srmsg_GetNumberOfDataMessagePayloads(_)).WillRepeatedly(Return(1U));
+            }
+
             // if CheckSequenceNumberRange check
             if(seq_nbr_in_range)
             {
@@ -447,11 +453,11 @@ TEST_P(ReceiveMessageTestWithParam, srcorTest030ReceiveMessageFunction)
   if(expected_error == radef_kNoError)
   {
     // set next expect receive and send seq nbr and confirmed timestamp rx
-    srcor_rasta_connections[connection_id].sequence_number_rx = configured_seq_nbr_rx;
-    srcor_rasta_connections[connection_id].sequence_number_tx = configured_seq_number_tx;
-    srcor_rasta_connections[connection_id].confirmed_sequence_number_rx = configured_confirmed_seq_nr_rx;
-    srcor_rasta_connections[connection_id].confirmed_time_stamp_rx = configured_confirmed_timestamp_rx;
-    srcor_rasta_connections[connection_id].time_stamp_rx = configured_timestamp_rx;
+    srcor_instance->rasta_connections[connection_id].sequence_number_rx = configured_seq_nbr_rx;
+    srcor_instance->rasta_connections[connection_id].sequence_number_tx = configured_seq_number_tx;
+    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx = configured_confirmed_seq_nr_rx;
+    srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx = configured_confirmed_timestamp_rx;
+    srcor_instance->rasta_connections[connection_id].time_stamp_rx = configured_timestamp_rx;
   }
 
   // perform the test
@@ -471,27 +477,27 @@ TEST_P(ReceiveMessageTestWithParam, srcorTest030ReceiveMessageFunction)
     if(msg_checks_passed)
     {
       // verify message header in input buffer
-      ASSERT_EQ(srcor_rasta_connections[connection_id].input_buffer.message_header.confirmed_sequence_number, message_confirmed_seq_nbr);
-      ASSERT_EQ(srcor_rasta_connections[connection_id].input_buffer.message_header.confirmed_time_stamp, message_confirmed_timestamp);
-      ASSERT_EQ(srcor_rasta_connections[connection_id].input_buffer.message_header.message_length, message_length);
-      ASSERT_EQ(srcor_rasta_connections[connection_id].input_buffer.message_header.message_type, message_type);
-      ASSERT_EQ(srcor_rasta_connections[connection_id].input_buffer.message_header.receiver_id, message_receiver_id);
-      ASSERT_EQ(srcor_rasta_connections[connection_id].input_buffer.message_header.sender_id, message_sender_id);
-      ASSERT_EQ(srcor_rasta_connections[connection_id].input_buffer.message_header.sequence_number, message_seq_nbr);
-      ASSERT_EQ(srcor_rasta_connections[connection_id].input_buffer.message_header.time_stamp, message_timestamp);
+      ASSERT_EQ(srcor_instance->rasta_connections[connection_id].input_buffer.message_header.confirmed_sequence_number, message_confirmed_seq_nbr);
+      ASSERT_EQ(srcor_instance->rasta_connections[connection_id].input_buffer.message_header.confirmed_time_stamp, message_confirmed_timestamp);
+      ASSERT_EQ(srcor_instance->rasta_connections[connection_id].input_buffer.message_header.message_length, message_length);
+      ASSERT_EQ(srcor_instance->rasta_connections[connection_id].input_buffer.message_header.message_type, message_type);
+      ASSERT_EQ(srcor_instance->rasta_connections[connection_id].input_buffer.message_header.receiver_id, message_receiver_id);
+      ASSERT_EQ(srcor_instance->rasta_connections[connection_id].input_buffer.message_header.sender_id, message_sender_id);
+      ASSERT_EQ(srcor_instance->rasta_connections[connection_id].input_buffer.message_header.sequence_number, message_seq_nbr);
+      ASSERT_EQ(srcor_instance->rasta_connections[connection_id].input_buffer.message_header.time_stamp, message_timestamp);
 
       // verify message in buffer
-      ASSERT_TRUE(srcor_rasta_connections[connection_id].input_buffer.message_in_buffer);
+      ASSERT_TRUE(srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer);
     }
     else
     {
       // verify message not in buffer
-      ASSERT_FALSE(srcor_rasta_connections[connection_id].input_buffer.message_in_buffer);
+      ASSERT_FALSE(srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer);
 
       if(read_msg_return_value == radef_kNoMessageReceived)
       {
         // verify no received data pending when no message received
-        ASSERT_FALSE(srcor_rasta_connections[connection_id].received_data_pending);
+        ASSERT_FALSE(srcor_instance->rasta_connections[connection_id].received_data_pending);
       }
     }
   }
@@ -676,11 +682,11 @@ TEST_P(HandleRetrReqTestWithParam, srcorTest031VerifyHandleRetrReqFunction)
   if(!expect_fatal_error)
   {
     // set seq nbr tx to verify in header
-    srcor_rasta_connections[connection_id].sequence_number_tx = seq_nr_tx;
-    srcor_rasta_connections[connection_id].time_stamp_rx = confirmed_time_stamp;
+    srcor_instance->rasta_connections[connection_id].sequence_number_tx = seq_nr_tx;
+    srcor_instance->rasta_connections[connection_id].time_stamp_rx = confirmed_time_stamp;
 
     // set confirmed seq nbr
-    srcor_rasta_connections[connection_id].confirmed_sequence_number_rx = confirmed_seq_nr;
+    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx = confirmed_seq_nr;
   }
 
   // execute the test
@@ -694,7 +700,7 @@ TEST_P(HandleRetrReqTestWithParam, srcorTest031VerifyHandleRetrReqFunction)
     EXPECT_NO_THROW(srcor_HandleRetrReq(connection_id));
 
     // verify seq number tx gets updated with seq nr from srsend_PrepareBufferForRetr call
-    EXPECT_EQ(srcor_rasta_connections[connection_id].sequence_number_tx, last_seq_nr_in_bfr);
+    EXPECT_EQ(srcor_instance->rasta_connections[connection_id].sequence_number_tx, last_seq_nr_in_bfr);
 
     // verify header from srsend_PrepareBufferForRetr call
     EXPECT_EQ(message_header_to_verify.sender_id, test_config.connection_configurations[connection_id].sender_id);
@@ -894,7 +900,8 @@ TEST_P(ProcessReceivedMessageTestWithParam, srcorTest032VerifyProcessReceivedMes
       if ((message_type == srtyp_kSrMessageData) || (message_type == srtyp_kSrMessageRetrData))
       {
         // Expect to handle received data message
-        EXPECT_CALL(srmsg_mock, srmsg_GetDataMessagePayload(_, _));
+        EXPECT_CALL(srmsg_mock, srmsg_GetNumberOfDataMessagePayloads(_)).WillOnce(Return(1U));
+        EXPECT_CALL(srmsg_mock, srmsg_GetDataMessagePayloadView(_, Pointee(0U), _));
         EXPECT_CALL(srrece_mock, srrece_AddToBuffer(connection_id, _));
       }
 
@@ -940,14 +947,14 @@ TEST_P(ProcessReceivedMessageTestWithParam, srcorTest032VerifyProcessReceivedMes
   {
     if(message_type != message_timeout_related)
     {
-      srcor_rasta_connections[connection_id].timer_t_i = configured_timer_ti_value;
+      srcor_instance->rasta_connections[connection_id].timer_t_i = configured_timer_ti_value;
     }
 
     // set confirmed sequence number rx, last send confirmed seq nr_tx, message in buffer flag and message header according to test parameter
-    srcor_rasta_connections[connection_id].confirmed_sequence_number_rx = configured_confirmed_seq_nr_rx;
-    srcor_rasta_connections[connection_id].last_send_confirmed_sequence_number_tx = configured_last_send_confirmed_seq_nr_tx;
-    srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = message_in_buffer;
-    srcor_rasta_connections[connection_id].input_buffer.message_header = message_header;
+    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx = configured_confirmed_seq_nr_rx;
+    srcor_instance->rasta_connections[connection_id].last_send_confirmed_sequence_number_tx = configured_last_send_confirmed_seq_nr_tx;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = message_in_buffer;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_header = message_header;
   }
 
   // execute the test
@@ -963,31 +970,31 @@ TEST_P(ProcessReceivedMessageTestWithParam, srcorTest032VerifyProcessReceivedMes
     if(expect_timeliness_respected)
     {
       // verify sequence number & time stamp update
-      EXPECT_EQ(srcor_rasta_connections[connection_id].sequence_number_rx, message_header.sequence_number + 1U);
-      EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_sequence_number_tx, message_header.sequence_number);
-      EXPECT_EQ(srcor_rasta_connections[connection_id].time_stamp_rx, message_header.time_stamp);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].sequence_number_rx, message_header.sequence_number + 1U);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx, message_header.sequence_number);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].time_stamp_rx, message_header.time_stamp);
 
       if(message_timeout_related)
       {
         // verify confirmed timestamp rx set from message
-        EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_time_stamp_rx, message_header.confirmed_time_stamp);
-        EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_sequence_number_rx, message_header.confirmed_sequence_number);
+        EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx, message_header.confirmed_time_stamp);
+        EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx, message_header.confirmed_sequence_number);
       }
       else if (message_type == srtyp_kSrMessageConnReq)
       {
         // verify confirmed rx and confirmed timestamp set at connection request
-        EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_time_stamp_rx, timer_value);
-        EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_sequence_number_rx, (srcor_rasta_connections[connection_id].sequence_number_tx - 1));
+        EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_time_stamp_rx, timer_value);
+        EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx, (srcor_instance->rasta_connections[connection_id].sequence_number_tx - 1));
       }
       else if((message_type != srtyp_kSrMessageConnReq) && confirmed_sequence_number_changed)
       {
         // verify confirmed sequence nbr changed
-        EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_sequence_number_rx, message_header.confirmed_sequence_number);
+        EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx, message_header.confirmed_sequence_number);
       }
     }
 
     // verify message in buffer flag cleared
-    EXPECT_FALSE(srcor_rasta_connections[connection_id].input_buffer.message_in_buffer);
+    EXPECT_FALSE(srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer);
   }
 }
 
@@ -107,6 +107,21 @@ class SendDataMessageTestWithParam : public srcorTest, public testing::WithParam
   radef_RaStaReturnCode expected_error =                  std::get<4>(GetParam());    ///< expected error
 };
 
+/**
+ * @brief Test class for value-parametrized SendDataMessage tests with message packing
+ *
+ * Parameter order:
+ * - configured n_max_packet (uint32_t)
+ * - return value of srsend_AddPayloadToLastMessage function (bool)
+ * .
+ */
+class SendPackedDataMessageTestWithParam : public srcorTest, public testing::WithParamInterface<std::tuple<uint32_t, bool>>
+{
+  public:
+  uint32_t n_max_packet =                                 std::get<0>(GetParam());    ///< configured n_max_packet
+  bool payload_packed =                                   std::get<1>(GetParam());    ///< return value of srsend_AddPayloadToLastMessage function
+};
+
 /**
  * @brief Test class for value-parametrized SendConnReqMessage tests
  *
@@ -246,7 +261,8 @@ class WriteMessagePayloadToTemporaryBufferTestWithParam : public srcorTest, publ
  * - Set confirmed seq nbr to verify if in header
  * - Set expectations
  *   - For allow message to send check (used buffer entries and messages to send parameter)
- *   - If message can be send -> For Reading message, get and update message header and send message call with message content check
+ *   - If message can be send -> For Reading message and get message header
+ *   - For every batch of up to SRCOR_SEND_BATCH_SIZE messages -> For update message headers of the batch and send message calls with message content check
  * - Call function with given connection ID
  * - Verify timestamp and confirmed sequence number in header
  * - Verify time stamp tx and last send confirmed sequence number
@@ -315,7 +331,7 @@ TEST_P(SendPendingMessagesTestWithParam, srcorTest007VerifySendPendingMessagesFu
   srtyp_SrMessageHeader message_header =                  {0, message_type, 0, 0, 0, 0, 0, 0};
   srtyp_SrMessage message =                               {UT_SRCOR_MESSAGE_LEN_MAX, {}};
   uint16_t messages_to_send_count =                       messages_to_send;
-  uint32_t timer_values[messages_to_send] =               {};
+  uint32_t timer_values[messages_to_send + 1] =           {};
   uint32_t confirmed_seq_number =                         10;
 
   // parameter values to check
@@ -342,53 +358,77 @@ TEST_P(SendPendingMessagesTestWithParam, srcorTest007VerifySendPendingMessagesFu
   if(expected_error != radef_kInvalidParameter)
   {
     // set last confirmed seq nbr
-    srcor_rasta_connections[connection_id].confirmed_sequence_number_tx = confirmed_seq_number;
+    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx = confirmed_seq_number;
   }
 
   // set expectations
   if(expected_error == radef_kNoError || read_message_result != radef_kNoError)
   {
     InSequence s;
-    for (uint16_t i = 0; i <= messages_to_send; i++)
+    uint16_t message_index = 0U;
+    bool batch_full = true;
+    bool read_failed = false;
+    while (batch_full && !read_failed)
     {
-      // expect calls for allow message to send check. srsend_GetNumberOfMessagesToSend gets called two times
-      EXPECT_CALL(srsend_mock, srsend_GetUsedBufferEntries(connection_id)).WillOnce(Return(used_buffer_entries));
-      EXPECT_CALL(srsend_mock, srsend_GetNumberOfMessagesToSend(connection_id)).Times(2).WillRepeatedly(Return(messages_to_send_count));
+      uint16_t batch_messages = 0U;
+      while (batch_messages < SRCOR_SEND_BATCH_SIZE)
+      {
+        // expect calls for allow message to send check. srsend_GetNumberOfMessagesToSend gets called two times
+        EXPECT_CALL(srsend_mock, srsend_GetUsedBufferEntries(connection_id)).WillOnce(Return(used_buffer_entries));
+        EXPECT_CALL(srsend_mock, srsend_GetNumberOfMessagesToSend(connection_id)).Times(2).WillRepeatedly(Return(messages_to_send_count));
 
-      // calculate not confirmed messages (used buffer entries - messages to send)
-      uint16_t not_confirmed_messages = used_buffer_entries;
-      not_confirmed_messages -= messages_to_send_count;
+        // calculate not confirmed messages (used buffer entries - messages to send)
+        uint16_t not_confirmed_messages = used_buffer_entries;
+        not_confirmed_messages -= messages_to_send_count;
 
-      // check if allowed to send message
-      if(messages_to_send_count > 0 && opposite_receive_buffer_size > not_confirmed_messages)
-      {
-        if(read_message_result == radef_kNoError)
+        // check if allowed to send message
+        if(messages_to_send_count > 0 && opposite_receive_buffer_size > not_confirmed_messages)
         {
-          // expect calls for sending message
-          EXPECT_CALL(srsend_mock, srsend_ReadMessageToSend(connection_id, _)).WillOnce(DoAll(SetArgPointee<1>(message), Return(read_message_result)));
-          EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillOnce(Return(timer_values[i]));
-          EXPECT_CALL(srmsg_mock, srmsg_GetMessageHeader(_, _)).WillOnce(SetArgPointee<1>(message_header));
-          EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeader(_, _)).WillOnce(SaveArg<0>(&message_header_updates[i]));
-          EXPECT_CALL(sradin_mock, sradin_SendMessage(_, UT_SRCOR_MESSAGE_LEN_MAX, _)).WillOnce(SaveArg<2>(&message_data));
+          if(read_message_result == radef_kNoError)
+          {
+            // expect calls for reading message and preparing the header update
+            EXPECT_CALL(srsend_mock, srsend_ReadMessageToSend(connection_id, _)).WillOnce(DoAll(SetArgPointee<1>(message), Return(read_message_result)));
+            EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillOnce(Return(timer_values[message_index]));
+            EXPECT_CALL(srmsg_mock, srmsg_GetMessageHeader(_, _)).WillOnce(SetArgPointee<1>(message_header));
+          }
+          else
+          {
+            EXPECT_CALL(srsend_mock, srsend_ReadMessageToSend(connection_id, _)).WillOnce(Return(read_message_result));
+            // internal error gets thrown when no message could be read although previously checked if messages are in buffer
+            read_failed = true;
+            break;
+          }
+
+          // decrement messages to send count for srsend_GetNumberOfMessagesToSend call return value
+          messages_to_send_count--;
+
+          // increment timer value for next message
+          timer_values[message_index + 1] = timer_values[message_index] + 5;
+          message_index++;
+          batch_messages++;
         }
         else
         {
-          EXPECT_CALL(srsend_mock, srsend_ReadMessageToSend(connection_id, _)).WillOnce(Return(read_message_result));
-          // internal error gets thrown when no message could be read although previously checked if messages are in buffer
+          // message not allowed to send anymore
           break;
         }
-
-        // decrement messages to send count for srsend_GetNumberOfMessagesToSend call return value
-        messages_to_send_count--;
-
-        // increment timer value for next message
-        timer_values[i + 1] = timer_values[i] + 5;
       }
-      else
+
+      if(!read_failed && batch_messages > 0)
       {
-        // message not allowed to send anymore
-        break;
+        // expect calls for updating the message headers of the batch at once and sending the messages
+        const uint16_t first_message_index = message_index - batch_messages;
+        EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeaderBatch(batch_messages, _, _))
+          .WillOnce(Invoke([&message_header_updates, first_message_index](const uint16_t number_of_messages, const srtyp_SrMessageHeaderUpdate * updates, srtyp_SrMessage * sr_messages) {
+            for (uint16_t i = 0U; i < number_of_messages; i++)
+            {
+              EXPECT_EQ(sr_messages[i].message_size, UT_SRCOR_MESSAGE_LEN_MAX);
+              message_header_updates[first_message_index + i] = updates[i];
+            }
+          }));
+        EXPECT_CALL(sradin_mock, sradin_SendMessage(&test_instance, _, UT_SRCOR_MESSAGE_LEN_MAX, _)).Times(batch_messages).WillRepeatedly(SaveArg<3>(&message_data));
       }
+      batch_full = (batch_messages == SRCOR_SEND_BATCH_SIZE);
     }
   }
 
@@ -427,10 +467,10 @@ TEST_P(SendPendingMessagesTestWithParam, srcorTest007VerifySendPendingMessagesFu
       }
 
       // verify time stamp tx
-      EXPECT_EQ(srcor_rasta_connections[connection_id].time_stamp_tx, timer_values[messages_to_send - 1]);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].time_stamp_tx, timer_values[messages_to_send - 1]);
 
       // verify last send confirmed sequence number
-      EXPECT_EQ(srcor_rasta_connections[connection_id].last_send_confirmed_sequence_number_tx, message_header_updates[messages_to_send - 1].confirmed_sequence_number);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].last_send_confirmed_sequence_number_tx, message_header_updates[messages_to_send - 1].confirmed_sequence_number);
     }
   }
 }
@@ -549,10 +589,10 @@ TEST_P(SendDataMessageTestWithParam, srcorTest008VerifySendDataMessageFunction)
   if(expected_error != radef_kInvalidParameter)
   {
     // set current seq number on connection
-    srcor_rasta_connections[connection_id].sequence_number_tx = sequence_number;
+    srcor_instance->rasta_connections[connection_id].sequence_number_tx = sequence_number;
 
     // set timestamp rx to verify in header
-    srcor_rasta_connections[connection_id].time_stamp_rx = time_stamp_rx;
+    srcor_instance->rasta_connections[connection_id].time_stamp_rx = time_stamp_rx;
 
     if(write_message_to_temporary_buffer)
     {
@@ -579,8 +619,8 @@ TEST_P(SendDataMessageTestWithParam, srcorTest008VerifySendDataMessageFunction)
     EXPECT_CALL(srsend_mock, srsend_ReadMessageToSend(connection_id, _)).WillOnce(Return(radef_kNoError));
     EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).Times(1);
     EXPECT_CALL(srmsg_mock, srmsg_GetMessageHeader(_, _)).Times(1);
-    EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeader(_, _)).Times(1);
-    EXPECT_CALL(sradin_mock, sradin_SendMessage(_, _, _)).Times(1);
+    EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeaderBatch(1, _, _)).Times(1);
+    EXPECT_CALL(sradin_mock, sradin_SendMessage(&test_instance, _, _, _)).Times(1);
   }
 
   // perform the test
@@ -597,10 +637,10 @@ TEST_P(SendDataMessageTestWithParam, srcorTest008VerifySendDataMessageFunction)
     EXPECT_EQ(default_config.connection_configurations[connection_id].sender_id, message_header.sender_id);
     EXPECT_EQ(default_config.connection_configurations[connection_id].receiver_id, message_header.receiver_id);
     EXPECT_EQ(sequence_number, message_header.sequence_number);
-    EXPECT_EQ(srcor_rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
+    EXPECT_EQ(srcor_instance->rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
 
     // verify seq number gets incremented for next message
-    EXPECT_EQ(sequence_number + 1, srcor_rasta_connections[connection_id].sequence_number_tx);
+    EXPECT_EQ(sequence_number + 1, srcor_instance->rasta_connections[connection_id].sequence_number_tx);
   }
 }
 
@@ -621,6 +661,122 @@ INSTANTIATE_TEST_SUITE_P(
   )
 );
 
+/**
+ * @test        @ID{srcorTest034} Verify the SendDataMessage function with message packing
+ *
+ * @details     This test verifies that the SendDataMessage function of the rasta safety and
+ *              retransmission layer core module packs a message into the last data message
+ *              of the send buffer if message packing is configured.
+ *
+ * Test steps:
+ * - Create a config with the given n_max_packet (from parameter)
+ * - Initialize the module
+ * - Write message payload to temporary buffer
+ * - Set expectations
+ *   - For packing the payload into the last message, only if n_max_packet greater than 1
+ *   - For create and add message to buffer, only if payload not packed
+ * - Call the function
+ * - Verify that sequence number TX is only incremented if a new data message is created
+ * - Verify that the temporary buffer is empty
+ * .
+ *
+ * @testParameter
+ * - n_max_packet: Configured maximum number of messages packed into one data message
+ * - Payload packed: Return value of srsend_AddPayloadToLastMessage function
+ * .
+ * | Test Run | Test config                   || Expected values                                |
+ * |----------|--------------|-----------------|------------------------|------------------|
+ * |          | n_max_packet | Payload packed  | New data message       | Test Result      |
+ * | 0        | 1U           | false           | true                   | Normal operation |
+ * | 1        | 2U           | false           | true                   | Normal operation |
+ * | 2        | 2U           | true            | false                  | Normal operation |
+ * | 3        | 16U          | true            | false                  | Normal operation |
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-584} Send Data Message Function
+ * @verifyReq{RASW-593} Write Message Payload to Temporary Buffer Function
+ */
+TEST_P(SendPackedDataMessageTestWithParam, srcorTest034VerifySendDataMessagePacking)
+{
+  // test variables
+  srcty_SafetyRetransmissionConfiguration test_config =     default_config;
+  test_config.n_max_packet =                                n_max_packet;
+  const uint32_t connection_id =                            UT_SRCOR_CONNECTION_ID_MIN;
+  const uint32_t sequence_number =                          10U;
+  uint16_t payload_size =                                   UT_SRCOR_PAYLOAD_LEN_MIN;
+  uint8_t message_payload[UT_SRCOR_PAYLOAD_LEN_MIN] =       {};
+
+  // expect calls for init core module
+  EXPECT_CALL(srdia_mock, srdia_AreDiagnosticTimingIntervalsValid(_, _)).WillOnce(Return(true));
+  EXPECT_CALL(rasys_mock, rasys_GetTimerGranularity()).Times(1);
+  EXPECT_CALL(srmsg_mock, srmsg_Init(_, _)).Times(1);
+  EXPECT_CALL(srdia_mock, srdia_Init(_, _, _, _)).Times(1);
+  EXPECT_CALL(srsend_mock, srsend_Init(_)).Times(1);
+  EXPECT_CALL(srrece_mock, srrece_Init(_, _)).Times(1);
+
+  // initialize the module
+  srcor_Init(&test_config);
+  srcor_instance->rasta_connections[connection_id].sequence_number_tx = sequence_number;
+  srcor_WriteMessagePayloadToTemporaryBuffer(connection_id, payload_size, message_payload);
+
+  // set expectations
+  if(n_max_packet > 1U)
+  {
+    EXPECT_CALL(srsend_mock, srsend_AddPayloadToLastMessage(connection_id, n_max_packet,
+                                                            &srcor_instance->rasta_connections[connection_id].temporary_send_buffer.message_payload_buffer))
+      .WillOnce(Return(payload_packed));
+  }
+  else
+  {
+    EXPECT_CALL(srsend_mock, srsend_AddPayloadToLastMessage(_, _, _)).Times(0);
+  }
+
+  if(payload_packed)
+  {
+    EXPECT_CALL(srmsg_mock, srmsg_CreateDataMessage(_, _, _)).Times(0);
+    EXPECT_CALL(srsend_mock, srsend_AddToBuffer(_, _)).Times(0);
+  }
+  else
+  {
+    EXPECT_CALL(srmsg_mock, srmsg_CreateDataMessage(_, _, _)).Times(1);
+    EXPECT_CALL(srsend_mock, srsend_AddToBuffer(connection_id, _)).Times(1);
+  }
+
+  // no message allowed to send
+  EXPECT_CALL(srsend_mock, srsend_GetNumberOfMessagesToSend(connection_id)).WillRepeatedly(Return(0));
+
+  // perform the test
+  EXPECT_NO_THROW(srcor_SendDataMessage(connection_id));
+
+  // verify seq number only gets incremented for a new message
+  if(payload_packed)
+  {
+    EXPECT_EQ(sequence_number, srcor_instance->rasta_connections[connection_id].sequence_number_tx);
+  }
+  else
+  {
+    EXPECT_EQ(sequence_number + 1U, srcor_instance->rasta_connections[connection_id].sequence_number_tx);
+  }
+  EXPECT_FALSE(srcor_instance->rasta_connections[connection_id].temporary_send_buffer.message_in_buffer);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  verifySendDataMessagePacking,
+  SendPackedDataMessageTestWithParam,
+  ::testing::Values(
+    std::make_tuple(1U, false),
+    std::make_tuple(2U, false),
+    std::make_tuple(2U, true),
+    std::make_tuple(16U, true)
+  )
+);
+
 /**
  * @test        @ID{srcorTest010} Verify the SendConnReqMessage function
  *
@@ -700,7 +856,7 @@ TEST_P(SendConnReqMessageTestWithParam, srcorTest010VerifySendConnReqMessageFunc
   if(expected_error == radef_kNoError)
   {
     // set to any value > 0 to check if reset
-    srcor_rasta_connections[connection_id].time_stamp_rx = 100U;
+    srcor_instance->rasta_connections[connection_id].time_stamp_rx = 100U;
 
     EXPECT_CALL(srmsg_mock, srmsg_CreateConnReqMessage(_, _, test_config.n_send_max, _)).WillOnce(DoAll(SaveArg<0>(&message_header),SaveArg<1>(&protocol_version)));
     EXPECT_CALL(srsend_mock, srsend_AddToBuffer(connection_id, _)).Times(1);
@@ -718,8 +874,8 @@ TEST_P(SendConnReqMessageTestWithParam, srcorTest010VerifySendConnReqMessageFunc
     EXPECT_CALL(srsend_mock, srsend_ReadMessageToSend(connection_id, _)).WillOnce(Return(radef_kNoError));
     EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).Times(1);
     EXPECT_CALL(srmsg_mock, srmsg_GetMessageHeader(_, _)).Times(1);
-    EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeader(_, _)).Times(1);
-    EXPECT_CALL(sradin_mock, sradin_SendMessage(_, _, _)).Times(1);
+    EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeaderBatch(1, _, _)).Times(1);
+    EXPECT_CALL(sradin_mock, sradin_SendMessage(&test_instance, _, _, _)).Times(1);
   }
 
   // perform the test
@@ -736,11 +892,11 @@ TEST_P(SendConnReqMessageTestWithParam, srcorTest010VerifySendConnReqMessageFunc
     EXPECT_EQ(default_config.connection_configurations[connection_id].sender_id, message_header.sender_id);
     EXPECT_EQ(default_config.connection_configurations[connection_id].receiver_id, message_header.receiver_id);
     EXPECT_EQ(0U, message_header.sequence_number);
-    EXPECT_EQ(0U, srcor_rasta_connections[connection_id].time_stamp_rx);
-    EXPECT_EQ(srcor_rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
+    EXPECT_EQ(0U, srcor_instance->rasta_connections[connection_id].time_stamp_rx);
+    EXPECT_EQ(srcor_instance->rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
 
     // verify seq number tx gets incremented for next message
-    EXPECT_EQ(1, srcor_rasta_connections[connection_id].sequence_number_tx);
+    EXPECT_EQ(1, srcor_instance->rasta_connections[connection_id].sequence_number_tx);
 
     // verify protocol version
     for(uint16_t i = 0; i < 4; i ++)
@@ -841,8 +997,8 @@ TEST_P(SendConnRespMessageTestWithParam, srcorTest009VerifySendConnRespMessageFu
   if(expected_error == radef_kNoError)
   {
     // set timestamp and seq nbr to verify in header
-    srcor_rasta_connections[connection_id].time_stamp_rx = confirmed_timestamp;
-    srcor_rasta_connections[connection_id].sequence_number_tx = sequence_number;
+    srcor_instance->rasta_connections[connection_id].time_stamp_rx = confirmed_timestamp;
+    srcor_instance->rasta_connections[connection_id].sequence_number_tx = sequence_number;
 
     EXPECT_CALL(srmsg_mock, srmsg_CreateConnRespMessage(_, _, test_config.n_send_max, _)).WillOnce(SaveArg<0>(&message_header));
     EXPECT_CALL(srsend_mock, srsend_AddToBuffer(connection_id, _)).Times(1);
@@ -860,8 +1016,8 @@ TEST_P(SendConnRespMessageTestWithParam, srcorTest009VerifySendConnRespMessageFu
     EXPECT_CALL(srsend_mock, srsend_ReadMessageToSend(connection_id, _)).WillOnce(Return(radef_kNoError));
     EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).Times(1);
     EXPECT_CALL(srmsg_mock, srmsg_GetMessageHeader(_, _)).Times(1);
-    EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeader(_, _)).Times(1);
-    EXPECT_CALL(sradin_mock, sradin_SendMessage(_, _, _)).Times(1);
+    EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeaderBatch(1, _, _)).Times(1);
+    EXPECT_CALL(sradin_mock, sradin_SendMessage(&test_instance, _, _, _)).Times(1);
   }
 
   // perform the test
@@ -878,10 +1034,10 @@ TEST_P(SendConnRespMessageTestWithParam, srcorTest009VerifySendConnRespMessageFu
     EXPECT_EQ(default_config.connection_configurations[connection_id].sender_id, message_header.sender_id);
     EXPECT_EQ(default_config.connection_configurations[connection_id].receiver_id, message_header.receiver_id);
     EXPECT_EQ(sequence_number, message_header.sequence_number);
-    EXPECT_EQ(srcor_rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
+    EXPECT_EQ(srcor_instance->rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
 
     // verify seq number gets incremented for next message
-    EXPECT_EQ(sequence_number + 1, srcor_rasta_connections[connection_id].sequence_number_tx);
+    EXPECT_EQ(sequence_number + 1, srcor_instance->rasta_connections[connection_id].sequence_number_tx);
   }
 }
 
@@ -1002,9 +1158,9 @@ TEST_P(SendDiscReqMessageTestWithParam, srcorTest011VerifySendDiscReqMessageFunc
   if(expected_error == radef_kNoError)
   {
     // set confirmed timestamp and current and last confirmed seq number on connection
-    srcor_rasta_connections[connection_id].time_stamp_rx = timestamp;
-    srcor_rasta_connections[connection_id].sequence_number_tx = sequence_number;
-    srcor_rasta_connections[connection_id].confirmed_sequence_number_tx = confirmed_sequence_number;
+    srcor_instance->rasta_connections[connection_id].time_stamp_rx = timestamp;
+    srcor_instance->rasta_connections[connection_id].sequence_number_tx = sequence_number;
+    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx = confirmed_sequence_number;
 
     // set disconnect reason to verify in call
     EXPECT_NO_THROW(srcor_SetDiscDetailedReason(connection_id, detailed_disc_reason));
@@ -1012,13 +1168,13 @@ TEST_P(SendDiscReqMessageTestWithParam, srcorTest011VerifySendDiscReqMessageFunc
     EXPECT_CALL(srmsg_mock, srmsg_CreateDiscReqMessage(_, detailed_disc_reason, disconnect_reason, _)).WillOnce(SaveArg<0>(&message_header));
     EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).WillOnce(Return(timer_value));
     EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeader(_, _)).WillOnce(SaveArg<0>(&message_header_update));
-    EXPECT_CALL(sradin_mock, sradin_SendMessage(connection_id, _, _)).Times(1);
+    EXPECT_CALL(sradin_mock, sradin_SendMessage(&test_instance, connection_id, _, _)).Times(1);
 
     // expect buffer to be reset
     EXPECT_CALL(srsend_mock, srsend_InitBuffer(connection_id)).Times(1);
 
     // expect channel to be closed (1:1 mapping connection and redundancy channel id)
-    EXPECT_CALL(sradin_mock, sradin_CloseRedundancyChannel(connection_id)).Times(1);
+    EXPECT_CALL(sradin_mock, sradin_CloseRedundancyChannel(&test_instance, connection_id)).Times(1);
     // expect diagnostics notification to be sent at closing channel
     EXPECT_CALL(srdia_mock, srdia_SendDiagnosticNotification(connection_id)).Times(1);
   }
@@ -1037,14 +1193,14 @@ TEST_P(SendDiscReqMessageTestWithParam, srcorTest011VerifySendDiscReqMessageFunc
     EXPECT_EQ(default_config.connection_configurations[connection_id].sender_id, message_header.sender_id);
     EXPECT_EQ(default_config.connection_configurations[connection_id].receiver_id, message_header.receiver_id);
     EXPECT_EQ(sequence_number, message_header.sequence_number);
-    EXPECT_EQ(srcor_rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
+    EXPECT_EQ(srcor_instance->rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
 
     // verify message header update
-    EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_sequence_number_tx, message_header_update.confirmed_sequence_number);
+    EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx, message_header_update.confirmed_sequence_number);
     EXPECT_EQ(timer_value, message_header_update.time_stamp);
 
     // verify seq number gets incremented for next message
-    EXPECT_EQ(sequence_number + 1, srcor_rasta_connections[connection_id].sequence_number_tx);
+    EXPECT_EQ(sequence_number + 1, srcor_instance->rasta_connections[connection_id].sequence_number_tx);
   }
 }
 
@@ -1151,8 +1307,8 @@ TEST_P(SendHbMessageTestWithParam, srcorTest012VerifySendHbMessageFunction)
   if(expected_error == radef_kNoError)
   {
     // set timestamp and seq nbr to verify in header
-    srcor_rasta_connections[connection_id].time_stamp_rx = confirmed_timestamp;
-    srcor_rasta_connections[connection_id].sequence_number_tx = sequence_number;
+    srcor_instance->rasta_connections[connection_id].time_stamp_rx = confirmed_timestamp;
+    srcor_instance->rasta_connections[connection_id].sequence_number_tx = sequence_number;
 
     EXPECT_CALL(srmsg_mock, srmsg_CreateHeartbeatMessage(_, _)).WillOnce(SaveArg<0>(&message_header));
     EXPECT_CALL(srsend_mock, srsend_AddToBuffer(connection_id, _)).Times(1);
@@ -1170,8 +1326,8 @@ TEST_P(SendHbMessageTestWithParam, srcorTest012VerifySendHbMessageFunction)
     EXPECT_CALL(srsend_mock, srsend_ReadMessageToSend(connection_id, _)).WillOnce(Return(radef_kNoError));
     EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).Times(1);
     EXPECT_CALL(srmsg_mock, srmsg_GetMessageHeader(_, _)).Times(1);
-    EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeader(_, _)).Times(1);
-    EXPECT_CALL(sradin_mock, sradin_SendMessage(_, _, _)).Times(1);
+    EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeaderBatch(1, _, _)).Times(1);
+    EXPECT_CALL(sradin_mock, sradin_SendMessage(&test_instance, _, _, _)).Times(1);
   }
 
   // perform the test
@@ -1188,10 +1344,10 @@ TEST_P(SendHbMessageTestWithParam, srcorTest012VerifySendHbMessageFunction)
     EXPECT_EQ(default_config.connection_configurations[connection_id].sender_id, message_header.sender_id);
     EXPECT_EQ(default_config.connection_configurations[connection_id].receiver_id, message_header.receiver_id);
     EXPECT_EQ(sequence_number, message_header.sequence_number);
-    EXPECT_EQ(srcor_rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
+    EXPECT_EQ(srcor_instance->rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
 
     // verify seq number gets incremented for next message
-    EXPECT_EQ(sequence_number + 1, srcor_rasta_connections[connection_id].sequence_number_tx);
+    EXPECT_EQ(sequence_number + 1, srcor_instance->rasta_connections[connection_id].sequence_number_tx);
   }
 }
 
@@ -1287,8 +1443,8 @@ TEST_P(SendRetrReqMessageTestWithParam, srcorTest013VerifySendRetrReqMessageFunc
   if(expected_error == radef_kNoError)
   {
     // set timestamp and seq nbr to verify in header
-    srcor_rasta_connections[connection_id].time_stamp_rx = confirmed_timestamp;
-    srcor_rasta_connections[connection_id].sequence_number_tx = sequence_number;
+    srcor_instance->rasta_connections[connection_id].time_stamp_rx = confirmed_timestamp;
+    srcor_instance->rasta_connections[connection_id].sequence_number_tx = sequence_number;
 
     EXPECT_CALL(srmsg_mock, srmsg_CreateRetrReqMessage(_, _)).WillOnce(SaveArg<0>(&message_header));
     EXPECT_CALL(srsend_mock, srsend_AddToBuffer(connection_id, _)).Times(1);
@@ -1306,8 +1462,8 @@ TEST_P(SendRetrReqMessageTestWithParam, srcorTest013VerifySendRetrReqMessageFunc
     EXPECT_CALL(srsend_mock, srsend_ReadMessageToSend(connection_id, _)).WillOnce(Return(radef_kNoError));
     EXPECT_CALL(rasys_mock, rasys_GetTimerValue()).Times(1);
     EXPECT_CALL(srmsg_mock, srmsg_GetMessageHeader(_, _)).Times(1);
-    EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeader(_, _)).Times(1);
-    EXPECT_CALL(sradin_mock, sradin_SendMessage(_, _, _)).Times(1);
+    EXPECT_CALL(srmsg_mock, srmsg_UpdateMessageHeaderBatch(1, _, _)).Times(1);
+    EXPECT_CALL(sradin_mock, sradin_SendMessage(&test_instance, _, _, _)).Times(1);
   }
 
   // perform the test
@@ -1324,10 +1480,10 @@ TEST_P(SendRetrReqMessageTestWithParam, srcorTest013VerifySendRetrReqMessageFunc
     EXPECT_EQ(default_config.connection_configurations[connection_id].sender_id, message_header.sender_id);
     EXPECT_EQ(default_config.connection_configurations[connection_id].receiver_id, message_header.receiver_id);
     EXPECT_EQ(sequence_number, message_header.sequence_number);
-    EXPECT_EQ(srcor_rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
+    EXPECT_EQ(srcor_instance->rasta_connections[connection_id].time_stamp_rx, message_header.confirmed_time_stamp);
 
     // verify seq number gets incremented for next message
-    EXPECT_EQ(sequence_number + 1, srcor_rasta_connections[connection_id].sequence_number_tx);
+    EXPECT_EQ(sequence_number + 1, srcor_instance->rasta_connections[connection_id].sequence_number_tx);
   }
 }
 
@@ -1469,8 +1625,8 @@ TEST_P(SendConnectionStateNotificationTestWithParam, srcorTest014VerifySendConne
     EXPECT_CALL(srsend_mock, srsend_GetFreeBufferEntries(connection_id)).WillOnce(Return(buffer_utilisation.send_buffer_free));
     EXPECT_CALL(srsend_mock, srsend_GetUsedBufferEntries(connection_id)).WillOnce(Return(buffer_utilisation.send_buffer_used));
 
-    EXPECT_CALL(srnot_mock, srnot_ConnectionStateNotification(connection_id, connection_state, _,
-      opposite_buffer_size, disconnect_reason, detailed_disconnect_reason)).WillOnce(SaveArg<2>(&buffer_utilisation_to_check));
+    EXPECT_CALL(srnot_mock, srnot_ConnectionStateNotification(&test_instance, connection_id, connection_state, _,
+      opposite_buffer_size, disconnect_reason, detailed_disconnect_reason)).WillOnce(SaveArg<3>(&buffer_utilisation_to_check));
   }
 
   // perform the test
@@ -1597,7 +1753,7 @@ TEST_P(WriteMessagePayloadToTemporaryBufferTestWithParam, srcorTest015VerifyWrit
   if(expected_error != radef_kInvalidParameter)
   {
     // set message in buffer according test parameter
-    srcor_rasta_connections[connection_id].temporary_send_buffer.message_in_buffer = message_in_buffer;
+    srcor_instance->rasta_connections[connection_id].temporary_send_buffer.message_in_buffer = message_in_buffer;
   }
 
   // execute the test
@@ -1611,12 +1767,12 @@ TEST_P(WriteMessagePayloadToTemporaryBufferTestWithParam, srcorTest015VerifyWrit
     EXPECT_NO_THROW(srcor_WriteMessagePayloadToTemporaryBuffer(connection_id, message_payload_size, &message_payload[0]));
 
     // verify buffer data
-    EXPECT_TRUE(srcor_rasta_connections[connection_id].temporary_send_buffer.message_in_buffer);
-    EXPECT_EQ(srcor_rasta_connections[connection_id].temporary_send_buffer.message_payload_buffer.payload_size, message_payload_size);
+    EXPECT_TRUE(srcor_instance->rasta_connections[connection_id].temporary_send_buffer.message_in_buffer);
+    EXPECT_EQ(srcor_instance->rasta_connections[connection_id].temporary_send_buffer.message_payload_buffer.payload_size, message_payload_size);
 
     for(uint16_t i = 0; i < message_payload_size; i++)
     {
-      EXPECT_EQ(srcor_rasta_connections[connection_id].temporary_send_buffer.message_payload_buffer.payload[i], test_payload_data_u8[i]);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].temporary_send_buffer.message_payload_buffer.payload[i], test_payload_data_u8[i]);
     }
   }
 }
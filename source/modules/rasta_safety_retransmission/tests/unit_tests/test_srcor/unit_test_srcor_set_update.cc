@@ -205,7 +205,7 @@ TEST_P(CloseRedundancyChannelTestWithParam, srcorTest024VerifyCloseRedundancyCha
   // expect calls for adapter interface and diagnostics module
   if(!expect_fatal_error)
   {
-    EXPECT_CALL(sradin_mock, sradin_CloseRedundancyChannel(expected_channel_id));
+    EXPECT_CALL(sradin_mock, sradin_CloseRedundancyChannel(&test_instance, expected_channel_id));
     EXPECT_CALL(srdia_mock, srdia_SendDiagnosticNotification(connection_id));
   }
 
@@ -314,13 +314,13 @@ TEST_P(UpdateConfirmedTxSequenceNumberTestWithParam, srcorTest025VerifyUpdateCon
   if(!expect_fatal_error)
   {
     // give seq nbr a value to verify if updated
-    srcor_rasta_connections[connection_id].confirmed_sequence_number_tx = previous_seq_nbr;
+    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx = previous_seq_nbr;
 
     // set message in buffer property to test parameter
-    srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = message_in_input_buffer;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = message_in_input_buffer;
 
     // set given seq nbr to msg header in input buffer
-    srcor_rasta_connections[connection_id].input_buffer.message_header.sequence_number = seq_nbr;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_header.sequence_number = seq_nbr;
   }
 
   // execute the test
@@ -336,15 +336,15 @@ TEST_P(UpdateConfirmedTxSequenceNumberTestWithParam, srcorTest025VerifyUpdateCon
     // verify seq nbr
     if(message_in_input_buffer)
     {
-      EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_sequence_number_tx, seq_nbr);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx, seq_nbr);
     }
     else
     {
-      EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_sequence_number_tx, previous_seq_nbr);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_tx, previous_seq_nbr);
     }
 
     // verify message in buffer flag
-    EXPECT_FALSE(srcor_rasta_connections[connection_id].input_buffer.message_in_buffer);
+    EXPECT_FALSE(srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer);
   }
 }
 
@@ -435,13 +435,13 @@ TEST_P(UpdateConfirmedRxSequenceNumberTestWithParam, srcorTest026VerifyUpdateCon
   if(!expect_fatal_error)
   {
     // give seq nbr a value to verify if updated
-    srcor_rasta_connections[connection_id].confirmed_sequence_number_rx = previous_seq_nbr;
+    srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx = previous_seq_nbr;
 
     // set message in buffer property to test parameter
-    srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = message_in_input_buffer;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = message_in_input_buffer;
 
     // set given seq nbr to msg header in input buffer
-    srcor_rasta_connections[connection_id].input_buffer.message_header.confirmed_sequence_number = seq_nbr;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_header.confirmed_sequence_number = seq_nbr;
 
     if(message_in_input_buffer)
     {
@@ -462,15 +462,15 @@ TEST_P(UpdateConfirmedRxSequenceNumberTestWithParam, srcorTest026VerifyUpdateCon
     // verify seq nbr
     if(message_in_input_buffer)
     {
-      EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_sequence_number_rx, seq_nbr);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx, seq_nbr);
     }
     else
     {
-      EXPECT_EQ(srcor_rasta_connections[connection_id].confirmed_sequence_number_rx, previous_seq_nbr);
+      EXPECT_EQ(srcor_instance->rasta_connections[connection_id].confirmed_sequence_number_rx, previous_seq_nbr);
     }
 
     // verify message in buffer flag
-    EXPECT_FALSE(srcor_rasta_connections[connection_id].input_buffer.message_in_buffer);
+    EXPECT_FALSE(srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer);
   }
 }
 
@@ -552,7 +552,7 @@ TEST_P(SetReceivedMessagePendingFlagTestWithParam, srcorTest027VerifySetReceived
   if(!expect_fatal_error)
   {
     // set message pending flag to false
-    srcor_rasta_connections[connection_id].received_data_pending = false;
+    srcor_instance->rasta_connections[connection_id].received_data_pending = false;
   }
 
   // execute the test
@@ -566,7 +566,7 @@ TEST_P(SetReceivedMessagePendingFlagTestWithParam, srcorTest027VerifySetReceived
     EXPECT_NO_THROW(srcor_SetReceivedMessagePendingFlag(connection_id));
 
     // verify pending flag true
-    EXPECT_TRUE(srcor_rasta_connections[connection_id].received_data_pending);
+    EXPECT_TRUE(srcor_instance->rasta_connections[connection_id].received_data_pending);
   }
 }
 
@@ -644,7 +644,7 @@ TEST_P(ClearInputBufferMessagePendingFlagTestWithParam, srcorTest028VerifyClearI
   if(!expect_fatal_error)
   {
     // set message in buffer flag to true
-    srcor_rasta_connections[connection_id].input_buffer.message_in_buffer = true;
+    srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer = true;
   }
 
   // execute the test
@@ -658,7 +658,7 @@ TEST_P(ClearInputBufferMessagePendingFlagTestWithParam, srcorTest028VerifyClearI
     EXPECT_NO_THROW(srcor_ClearInputBufferMessagePendingFlag(connection_id));
 
     // verify input buffer message pending flag reset
-    EXPECT_FALSE(srcor_rasta_connections[connection_id].input_buffer.message_in_buffer);
+    EXPECT_FALSE(srcor_instance->rasta_connections[connection_id].input_buffer.message_in_buffer);
   }
 }
 
@@ -746,7 +746,7 @@ TEST_P(SetDiscDetailedReasonTestWithParam, srcorTest029VerifySetDiscDetailedReas
     EXPECT_NO_THROW(srcor_SetDiscDetailedReason(connection_id, disc_detailed_reason));
 
     // verify disc detailed reason set correctly
-    EXPECT_EQ(disc_detailed_reason, srcor_rasta_connections[connection_id].detailed_disconnect_reason);
+    EXPECT_EQ(disc_detailed_reason, srcor_instance->rasta_connections[connection_id].detailed_disconnect_reason);
   }
 }
 
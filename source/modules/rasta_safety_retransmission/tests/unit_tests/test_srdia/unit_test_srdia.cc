@@ -233,15 +233,12 @@ TEST_P(InitTestWithParam, srdiaTest001VerifyInitFunction) {
     EXPECT_THROW(srdia_Init(configured_connections, configured_t_max, configured_n_diag_window, diag_timings_distribution_intervals), std::invalid_argument);
   }
   else {
-    extern uint32_t srdia_number_of_connections;
-    extern uint32_t srdia_n_diag_window;
-
     // call the init function and verify if parameter are set correctly
     EXPECT_NO_THROW(srdia_Init(configured_connections, configured_t_max, configured_n_diag_window, diag_timings_distribution_intervals));
 
-    EXPECT_EQ(srdia_number_of_connections, configured_connections);
-    EXPECT_EQ(srdia_n_diag_window, configured_n_diag_window);
-    EXPECT_TRUE(srdia_initialized);
+    EXPECT_EQ(srdia_instance->number_of_connections, configured_connections);
+    EXPECT_EQ(srdia_instance->n_diag_window, configured_n_diag_window);
+    EXPECT_TRUE(srdia_instance->initialized);
   }
 }
 
@@ -337,9 +334,9 @@ TEST_P(InitConnectionDiagnosticsTestWithParam, srdiaTest002VerifyInitConnectionD
     ;
   }
   else {
-    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(configured_connection_id, _))
-        .WillOnce(SaveArg<1>(&diag_noti))
-        .WillOnce(SaveArg<1>(&diag_noti))
+    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(&test_instance, configured_connection_id, _))
+        .WillOnce(SaveArg<2>(&diag_noti))
+        .WillOnce(SaveArg<2>(&diag_noti))
     ;
   }
 
@@ -660,14 +657,14 @@ TEST_P(UpdateConnectionDiagnosticsTestWithParam, srdiaTest010VerifyUpdateConnect
   {
     if(expect_diagnosis_window_overflow)
     {
-      EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(configured_connection_id, _)).Times(2)
-        .WillRepeatedly(SaveArg<1>(&diag_noti))
+      EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(&test_instance, configured_connection_id, _)).Times(2)
+        .WillRepeatedly(SaveArg<2>(&diag_noti))
       ;
     }
     else
     {
-      EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(configured_connection_id, _))
-        .WillOnce(SaveArg<1>(&diag_noti))
+      EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(&test_instance, configured_connection_id, _))
+        .WillOnce(SaveArg<2>(&diag_noti))
       ;
     }
   }
@@ -822,8 +819,8 @@ TEST_P(SendDiagnosticNotificationTestWithParam, srdiaTest011VerifySendDiagnostic
     ;
   }
   else {
-    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(clipped_connection_id, _))
-        .WillOnce(SaveArg<1>(&diag_noti))
+    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(&test_instance, clipped_connection_id, _))
+        .WillOnce(SaveArg<2>(&diag_noti))
     ;
   }
 
@@ -839,16 +836,16 @@ TEST_P(SendDiagnosticNotificationTestWithParam, srdiaTest011VerifySendDiagnostic
   }
   else {
     // Set data to connection diagnostics
-    srdia_connection_diagnostics[configured_connection_id].message_counter = 1U;
-    srdia_connection_diagnostics[configured_connection_id].diagnostic_data.ec_safety = 1U;
-    srdia_connection_diagnostics[configured_connection_id].diagnostic_data.ec_address = 1U;
-    srdia_connection_diagnostics[configured_connection_id].diagnostic_data.ec_type = 1U;
-    srdia_connection_diagnostics[configured_connection_id].diagnostic_data.ec_sn = 1U;
-    srdia_connection_diagnostics[configured_connection_id].diagnostic_data.ec_csn = 1U;
+    srdia_instance->connection_diagnostics[configured_connection_id].message_counter = 1U;
+    srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.ec_safety = 1U;
+    srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.ec_address = 1U;
+    srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.ec_type = 1U;
+    srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.ec_sn = 1U;
+    srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.ec_csn = 1U;
 
     for (uint32_t index = 0U; index < UT_SRDIA_DIAG_TIMINGS_DIST_INTERVALS; ++index) {
-      srdia_connection_diagnostics[configured_connection_id].diagnostic_data.t_alive_distribution[index] = 1U;
-      srdia_connection_diagnostics[configured_connection_id].diagnostic_data.t_rtd_distribution[index] = 1U;
+      srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.t_alive_distribution[index] = 1U;
+      srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.t_rtd_distribution[index] = 1U;
     }
 
     EXPECT_NO_THROW(srdia_SendDiagnosticNotification(configured_connection_id));
@@ -871,16 +868,16 @@ TEST_P(SendDiagnosticNotificationTestWithParam, srdiaTest011VerifySendDiagnostic
     EXPECT_EQ(diag_noti.t_alive_distribution[4], 1U);
 
     // Verify diagnostic data reset
-    EXPECT_EQ(srdia_connection_diagnostics[configured_connection_id].message_counter, 0U);
-    EXPECT_EQ(srdia_connection_diagnostics[configured_connection_id].diagnostic_data.ec_safety, 0U);
-    EXPECT_EQ(srdia_connection_diagnostics[configured_connection_id].diagnostic_data.ec_address, 0U);
-    EXPECT_EQ(srdia_connection_diagnostics[configured_connection_id].diagnostic_data.ec_type, 0U);
-    EXPECT_EQ(srdia_connection_diagnostics[configured_connection_id].diagnostic_data.ec_sn, 0U);
-    EXPECT_EQ(srdia_connection_diagnostics[configured_connection_id].diagnostic_data.ec_csn, 0U);
+    EXPECT_EQ(srdia_instance->connection_diagnostics[configured_connection_id].message_counter, 0U);
+    EXPECT_EQ(srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.ec_safety, 0U);
+    EXPECT_EQ(srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.ec_address, 0U);
+    EXPECT_EQ(srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.ec_type, 0U);
+    EXPECT_EQ(srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.ec_sn, 0U);
+    EXPECT_EQ(srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.ec_csn, 0U);
 
     for (uint32_t index = 0U; index < UT_SRDIA_DIAG_TIMINGS_DIST_INTERVALS; ++index) {
-      EXPECT_EQ(srdia_connection_diagnostics[configured_connection_id].diagnostic_data.t_alive_distribution[index], 0U);
-      EXPECT_EQ(srdia_connection_diagnostics[configured_connection_id].diagnostic_data.t_rtd_distribution[index], 0U);
+      EXPECT_EQ(srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.t_alive_distribution[index], 0U);
+      EXPECT_EQ(srdia_instance->connection_diagnostics[configured_connection_id].diagnostic_data.t_rtd_distribution[index], 0U);
     }
   }
 }
@@ -1028,6 +1025,50 @@ TEST_F(srdiaTest, srdiaTest013VerifyNullPointerCheck) {
   EXPECT_THROW(srdia_AreDiagnosticTimingIntervalsValid(UT_SRDIA_T_MAX, (uint32_t *)NULL), std::invalid_argument);
 }
 
+/**
+ * @test        @ID{srdiaTest014} Verify the GetConnectionMemorySize function
+ *
+ * @details     This test verifies that the GetConnectionMemorySize function returns the size of the connection memory
+ *              which is allocated by the init function.
+ *
+ * Test steps:
+ * - call the GetConnectionMemorySize function with an invalid number of connections and expect a fatal error
+ * - for the minimum and maximum number of connections:
+ *   - reset the connection memory module
+ *   - call the init function and verify that the allocated connection memory matches the returned size
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-642} Init sr_diagnostics Function
+ */
+TEST_F(srdiaTest, srdiaTest014VerifyGetConnectionMemorySize) {
+  // set expectations /////////////////////////////
+  EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter))
+      .Times(2)
+      .WillRepeatedly(Invoke(this, &srdiaTest::invalidArgumentException))
+  ;
+
+  // perform test /////////////////////////////////
+  EXPECT_THROW(srdia_GetConnectionMemorySize(UT_SRDIA_CONFIGURED_CONNECTIONS_MIN - 1U), std::invalid_argument);
+  EXPECT_THROW(srdia_GetConnectionMemorySize(UT_SRDIA_CONFIGURED_CONNECTIONS_MAX + 1U), std::invalid_argument);
+
+  for (uint32_t configured_connections = UT_SRDIA_CONFIGURED_CONNECTIONS_MIN; configured_connections <= UT_SRDIA_CONFIGURED_CONNECTIONS_MAX; ++configured_connections) {
+    srdia_instance->initialized = false;
+    srmem_instance->initialized = false;
+    srmem_Init(connection_memory, sizeof(connection_memory));
+
+    srdia_Init(configured_connections, UT_SRDIA_T_MAX, UT_SRDIA_N_DIAG_WINDOW_MAX, diag_timings_distribution_intervals);
+    EXPECT_EQ(srdia_GetConnectionMemorySize(configured_connections), srmem_instance->allocated_size);
+    EXPECT_EQ(0U, (srmem_instance->allocated_size % SRATY_CONNECTION_MEMORY_ALIGNMENT));
+  }
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -23,11 +23,14 @@
 #include "gmock/gmock.h"
 #include "rasys_mock.hh"
 #include "srdia_sr_diagnostics.h"
+#include "srmem_sr_connection_memory.h"
 #include "rasta_safety_retransmission/sraty_sr_api_types.h"
+#include "srins_mock.hh"
 #include "srnot_mock.hh"
 
 using testing::NaggyMock;
 using testing::StrictMock;
+using testing::Return;
 
 // -----------------------------------------------------------------------------
 // Global Macro Definitions
@@ -40,6 +43,7 @@ using testing::StrictMock;
 #define UT_SRDIA_N_DIAG_WINDOW_MAX 10000U          ///< max size of diagnostic window
 #define UT_SRDIA_T_MIN 750U                        ///< tmax min value
 #define UT_SRDIA_T_MAX 2000U                       ///< tmax max value
+#define UT_SRDIA_CONNECTION_MEMORY_SIZE 4096U      ///< size of the connection memory [bytes]
 
 // -----------------------------------------------------------------------------
 // Global Type Definitions
@@ -49,8 +53,8 @@ using testing::StrictMock;
 // Global Variable Declarations
 // -----------------------------------------------------------------------------
 
-extern bool srdia_initialized; ///< initialization state (local variable)
-extern srdia_SrConnectionDiagnostics srdia_connection_diagnostics[UT_SRDIA_CONFIGURED_CONNECTIONS_MAX]; ///< connection diagnostics data
+extern RADEF_THREAD_LOCAL srdia_InstanceData *srdia_instance; ///< data of the selected diagnostics module instance
+extern RADEF_THREAD_LOCAL srmem_InstanceData *srmem_instance; ///< data of the selected connection memory module instance
 
 // -----------------------------------------------------------------------------
 // Global Const Declarations
@@ -73,7 +77,12 @@ class srdiaTest: public ::testing::Test
 public:
   srdiaTest() {
     // reset initialisation state
-    srdia_initialized = false;
+    srdia_instance->initialized = false;
+    srmem_instance->initialized = false;
+    // initialize connection memory module
+    srmem_Init(connection_memory, sizeof(connection_memory));
+    // the notifications are called with the selected SafRetL instance
+    EXPECT_CALL(srins_mock, srins_GetSelectedInstance()).WillRepeatedly(Return(&test_instance));
   }
 
   ~srdiaTest() {
@@ -101,7 +110,11 @@ public:
     distribution_interval_4
   }; ///< default diagnostics intervals from config
 
+  uint64_t connection_memory[UT_SRDIA_CONNECTION_MEMORY_SIZE / sizeof(uint64_t)]; ///< connection memory for the diagnostic data
+  srapi_Instance test_instance = {}; ///< SafRetL instance, which is passed to the notifications
+
   StrictMock<rasysMock> rasys_mock; ///< mock for the rasta system adapter class
+  NaggyMock<srinsMock> srins_mock; ///< mock for the rasta safety and retransmission instances class
   NaggyMock<srnotMock> srnot_mock; ///< mock for the rasta safety and retransmission notifications class
 };
 
@@ -131,8 +131,8 @@ TEST_P(IncXyzErrorCounterTestWithParam, srdiaTest005VerifyIncSafetyCodeErrorCoun
     ;
   }
   else {
-    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(configured_connection_id, _))
-        .WillOnce(SaveArg<1>(&diag_noti))
+    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(&test_instance, configured_connection_id, _))
+        .WillOnce(SaveArg<2>(&diag_noti))
     ;
   }
 
@@ -207,8 +207,8 @@ TEST_P(IncXyzErrorCounterTestWithParam, srdiaTest006VerifyIncAddressErrorCounter
     ;
   }
   else {
-    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(configured_connection_id, _))
-        .WillOnce(SaveArg<1>(&diag_noti))
+    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(&test_instance, configured_connection_id, _))
+        .WillOnce(SaveArg<2>(&diag_noti))
     ;
   }
 
@@ -283,8 +283,8 @@ TEST_P(IncXyzErrorCounterTestWithParam, srdiaTest007VerifyIncTypeErrorCounterFun
     ;
   }
   else {
-    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(configured_connection_id, _))
-        .WillOnce(SaveArg<1>(&diag_noti))
+    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(&test_instance, configured_connection_id, _))
+        .WillOnce(SaveArg<2>(&diag_noti))
     ;
   }
 
@@ -359,8 +359,8 @@ TEST_P(IncXyzErrorCounterTestWithParam, srdiaTest008VerifyIncSequenceNumberError
     ;
   }
   else {
-    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(configured_connection_id, _))
-        .WillOnce(SaveArg<1>(&diag_noti))
+    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(&test_instance, configured_connection_id, _))
+        .WillOnce(SaveArg<2>(&diag_noti))
     ;
   }
 
@@ -435,8 +435,8 @@ TEST_P(IncXyzErrorCounterTestWithParam, srdiaTest009VerifyIncConfirmedSequenceNu
     ;
   }
   else {
-    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(configured_connection_id, _))
-        .WillOnce(SaveArg<1>(&diag_noti))
+    EXPECT_CALL(srnot_mock, srnot_SrDiagnosticNotification(&test_instance, configured_connection_id, _))
+        .WillOnce(SaveArg<2>(&diag_noti))
     ;
   }
 
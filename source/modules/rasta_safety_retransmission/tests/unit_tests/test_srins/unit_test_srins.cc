@@ -0,0 +1,122 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_srins.cc
+ *
+ * @author Martin Kuhn, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Unit test file for the instances module of the safety and retransmission layer.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "unit_test_srins.hh"
+
+// -----------------------------------------------------------------------------
+// Test cases
+// -----------------------------------------------------------------------------
+
+/** @addtogroup sr_instances
+ * @{
+ */
+
+/**
+ * @test        @ID{srinsTest001} Verify the create instance function.
+ *
+ * @details     This test verifies that all instances can be created one after another and that no further instance can be created afterwards.
+ *
+ * Test steps:
+ * - verify that no instance is selected
+ * - create all instances and verify the returned pointers and instance indexes
+ * - verify that no instance is available anymore
+ * - call the create instance function again and verify that a fatal error is thrown
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        All instances are created.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srinsTest, srinsTest001VerifyCreateInstanceFunction)
+{
+    std::vector<srapi_Instance *> instances;
+
+    EXPECT_EQ(nullptr, srins_GetSelectedInstance());
+
+    for (uint32_t index = 0U; index < RADEF_MAX_NUMBER_OF_SR_INSTANCES; index++)
+    {
+        EXPECT_TRUE(srins_IsInstanceAvailable());
+        srapi_Instance *const instance = srins_CreateInstance();
+        ASSERT_NE(nullptr, instance);
+        EXPECT_EQ(index, instance->instance_index);
+        for (srapi_Instance *const other_instance : instances)
+        {
+            EXPECT_NE(other_instance, instance);
+        }
+        instances.push_back(instance);
+    }
+    EXPECT_FALSE(srins_IsInstanceAvailable());
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInternalError)).WillOnce(Invoke(this, &srinsTest::invalidArgumentException));
+    EXPECT_THROW(srins_CreateInstance(), std::invalid_argument);
+}
+
+/**
+ * @test        @ID{srinsTest002} Verify the select instance function.
+ *
+ * @details     This test verifies that the select instance function selects the instance in all SafRetL modules, when the instance changes.
+ *
+ * Test steps:
+ * - call the select instance function with a NULL pointer and verify that a fatal error is thrown
+ * - create all instances
+ * - select every instance and verify that the select instance function of all modules is called with the instance index
+ * - verify that the selected instance is returned
+ * - select the same instance again and verify that no module function is called
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        The last instance is selected.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srinsTest, srinsTest002VerifySelectInstanceFunction)
+{
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &srinsTest::invalidArgumentException));
+    EXPECT_THROW(srins_SelectInstance(nullptr), std::invalid_argument);
+
+    for (uint32_t index = 0U; index < RADEF_MAX_NUMBER_OF_SR_INSTANCES; index++)
+    {
+        srapi_Instance *const instance = srins_CreateInstance();
+
+        EXPECT_CALL(raslb_mock, raslb_SelectInstance(index)).Times(1);
+        EXPECT_CALL(srmem_mock, srmem_SelectInstance(index)).Times(1);
+        EXPECT_CALL(srmsg_mock, srmsg_SelectInstance(index)).Times(1);
+        EXPECT_CALL(srdia_mock, srdia_SelectInstance(index)).Times(1);
+        EXPECT_CALL(srsend_mock, srsend_SelectInstance(index)).Times(1);
+        EXPECT_CALL(srrece_mock, srrece_SelectInstance(index)).Times(1);
+        EXPECT_CALL(srcor_mock, srcor_SelectInstance(index)).Times(1);
+        EXPECT_CALL(srstm_mock, srstm_SelectInstance(index)).Times(1);
+        srins_SelectInstance(instance);
+        EXPECT_EQ(instance, srins_GetSelectedInstance());
+
+        // selecting the selected instance again does not change anything
+        srins_SelectInstance(instance);
+        EXPECT_EQ(instance, srins_GetSelectedInstance());
+    }
+}
+
+/** @}*/
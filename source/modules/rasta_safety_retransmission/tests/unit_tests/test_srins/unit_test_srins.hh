@@ -0,0 +1,97 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_srins.hh
+ *
+ * @author Martin Kuhn, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Header file for unit tests of the instances module of the safety and retransmission layer.
+ */
+
+#ifndef SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_UNIT_TESTS_TEST_SRINS_UNIT_TEST_SRINS_HH_
+#define SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_UNIT_TESTS_TEST_SRINS_UNIT_TEST_SRINS_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+// clang-format off
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "src/srins_sr_instances.h"
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasys_mock.hh"
+#include "raslb_mock.hh"
+#include "srcor_mock.hh"
+#include "srdia_mock.hh"
+#include "srmem_mock.hh"
+#include "srmsg_mock.hh"
+#include "srrece_mock.hh"
+#include "srsend_mock.hh"
+#include "srstm_mock.hh"
+// clang-format on
+
+using testing::_;
+using testing::Invoke;
+using testing::StrictMock;
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+extern uint32_t srins_number_of_instances;                          ///< number of created instances
+extern RADEF_THREAD_LOCAL srapi_Instance *srins_selected_instance;  ///< pointer to the selected instance
+
+// -----------------------------------------------------------------------------
+// Test class definiton
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test fixture class for the instances module
+ *
+ */
+class srinsTest : public ::testing::Test
+{
+public:
+    srinsTest()
+    {
+        // reset the created and selected instances
+        srins_number_of_instances = 0U;
+        srins_selected_instance = NULL;
+    }
+    ~srinsTest()
+    {
+
+    }
+
+    /**
+    * @brief Throw invalid argument exception
+    * This function is used to throw an invalid argument exception mocked function call action.
+    */
+    void invalidArgumentException(){
+        throw std::invalid_argument("Invalid argument!");
+    }
+
+    StrictMock<rasysMock>   rasys_mock;         ///< mock for the rasta system adapter class
+    StrictMock<raslbMock>   raslb_mock;         ///< mock for the rasta slab allocator class
+    StrictMock<srcorMock>   srcor_mock;         ///< mock for the rasta safety and retransmission core class
+    StrictMock<srdiaMock>   srdia_mock;         ///< mock for the rasta safety and retransmission diagnostics class
+    StrictMock<srmemMock>   srmem_mock;         ///< mock for the rasta safety and retransmission connection memory class
+    StrictMock<srmsgMock>   srmsg_mock;         ///< mock for the rasta safety and retransmission messages class
+    StrictMock<srreceMock>  srrece_mock;        ///< mock for the rasta safety and retransmission received buffer class
+    StrictMock<srsendMock>  srsend_mock;        ///< mock for the rasta safety and retransmission send buffer class
+    StrictMock<srstmMock>   srstm_mock;         ///< mock for the rasta safety and retransmission state machine class
+};
+
+#endif  // SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_UNIT_TESTS_TEST_SRINS_UNIT_TEST_SRINS_HH_
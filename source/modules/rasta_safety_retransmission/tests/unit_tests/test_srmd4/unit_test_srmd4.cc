@@ -161,6 +161,7 @@ TEST_F(srmd4Test, srmd4Test001VerifyNullPointerCheck)
  * | 8        | 0x67452301   | 0xefcdab89   | 0x98badcfe   | 0x10325476   | 1085      | test_message_u8_without_safety_code | test_md4_hash                | False            | Normal operation   |
  * | 9        | 0x67452301   | 0xefcdab89   | 0x98badcfe   | 0x10325476   | 28        | example_message                     | example_message_md4_default  | False            | Normal operation   |
  * | 10       | 0xafb16782   | 0x304c59de   | 0x98badcfe   | 0x10325476   | 28        | example_message                     | example_message_md4_modified | False            | Normal operation   |
+ * | 11       | 0            | 0            | 0            | 0            | 63        | test_message_u8_without_safety_code | NULL                         | False            | Normal operation   |
  *
  * @safetyRel   Yes
  *
@@ -216,9 +217,202 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(0, 0, 0, 0, (UT_SRMD4_MSG_LEN_MAX + 1), test_message_u8_without_safety_code, (uint8_t*)NULL, true),
         std::make_tuple(UT_SRMD4_DEF_INITVAL_A, UT_SRMD4_DEF_INITVAL_B, UT_SRMD4_DEF_INITVAL_C, UT_SRMD4_DEF_INITVAL_D, UT_SRMD4_MSG_LEN_MAX, test_message_u8_without_safety_code, test_md4_hash, false),
         std::make_tuple(UT_SRMD4_DEF_INITVAL_A, UT_SRMD4_DEF_INITVAL_B, UT_SRMD4_DEF_INITVAL_C, UT_SRMD4_DEF_INITVAL_D, example_message_length, (uint8_t*)example_message, (uint8_t*)example_message_md4_default, false),
-        std::make_tuple(UT_SRMD4_MOD_INITVAL_A, UT_SRMD4_MOD_INITVAL_B, UT_SRMD4_DEF_INITVAL_C, UT_SRMD4_DEF_INITVAL_D, example_message_length, (uint8_t*)example_message, (uint8_t*)example_message_md4_modified, false)
+        std::make_tuple(UT_SRMD4_MOD_INITVAL_A, UT_SRMD4_MOD_INITVAL_B, UT_SRMD4_DEF_INITVAL_C, UT_SRMD4_DEF_INITVAL_D, example_message_length, (uint8_t*)example_message, (uint8_t*)example_message_md4_modified, false),
+        std::make_tuple(0, 0, 0, 0, 63, test_message_u8_without_safety_code, (uint8_t*)NULL, false)
     ));
 
+/**
+ * @test        @ID{srmd4Test003} Verify the input parameter check of the CalculateMd4Batch function
+ *
+ * @details     This test verifies that the fatal error function is executed whenever the
+ *              CalculateMd4Batch function is called with invalid parameters.
+ *
+ * Test steps:
+ * - call the CalculateMd4Batch function with invalid entries pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the CalculateMd4Batch function with zero entries and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the CalculateMd4Batch function with an entry with invalid data pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the CalculateMd4Batch function with an entry with invalid result pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the CalculateMd4Batch function with an entry with too small data size and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the CalculateMd4Batch function with an entry with too large data size and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-632} Component sr_md4 Overview
+ * @verifyReq{RASW-633} Calculate MD4 Function
+ */
+TEST_F(srmd4Test, srmd4Test003VerifyBatchParameterCheck)
+{
+    const uint16_t nbr_of_entries = 2;          // number of batch entries
+    uint8_t nbr_of_function_calls = 6;          // number of function calls
+
+    // Test variables
+    srcty_Md4InitValue init_values = {};
+    srmd4_Md4 md4_results[nbr_of_entries] = {};
+    srmd4_Md4BatchEntry entries[nbr_of_entries] = {};
+
+    for (uint16_t i = 0; i < nbr_of_entries; i++) {
+        entries[i].data_size = UT_SRMD4_MSG_LEN_MIN;
+        entries[i].data_buffer = test_message_u8_without_safety_code;
+        entries[i].calculated_md4 = &md4_results[i];
+    }
+
+    // expect fatal error function
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter))
+        .Times(nbr_of_function_calls)
+        .WillRepeatedly(Invoke(this, &srmd4Test::invalidArgumentException));
+
+    // call the functions
+    EXPECT_THROW(srmd4_CalculateMd4Batch(init_values, nbr_of_entries, (srmd4_Md4BatchEntry*)NULL), std::invalid_argument);
+    EXPECT_THROW(srmd4_CalculateMd4Batch(init_values, 0, entries), std::invalid_argument);
+
+    entries[1].data_buffer = NULL;
+    EXPECT_THROW(srmd4_CalculateMd4Batch(init_values, nbr_of_entries, entries), std::invalid_argument);
+    entries[1].data_buffer = test_message_u8_without_safety_code;
+
+    entries[1].calculated_md4 = NULL;
+    EXPECT_THROW(srmd4_CalculateMd4Batch(init_values, nbr_of_entries, entries), std::invalid_argument);
+    entries[1].calculated_md4 = &md4_results[1];
+
+    entries[1].data_size = UT_SRMD4_MSG_LEN_MIN - 1;
+    EXPECT_THROW(srmd4_CalculateMd4Batch(init_values, nbr_of_entries, entries), std::invalid_argument);
+
+    entries[1].data_size = UT_SRMD4_MSG_LEN_MAX + 1;
+    EXPECT_THROW(srmd4_CalculateMd4Batch(init_values, nbr_of_entries, entries), std::invalid_argument);
+}
+
+/**
+ * @test        @ID{srmd4Test004} Verify the CalculateMd4Batch function
+ *
+ * @details     This test verifies that the CalculateMd4Batch function calculates the same MD4 hashes
+ *              as the CalculateMd4 function for data buffers of different sizes within one batch.
+ *
+ * Test steps:
+ * - prepare batch entries with data sizes covering one and two padding blocks and the minimum and maximum data size
+ * - call the CalculateMd4 function for every entry to get the reference MD4 hash
+ * - call the CalculateMd4Batch function for a growing number of entries (not a multiple of the lanes as well)
+ * - verify that the MD4 hash of every entry matches the reference MD4 hash
+ * - verify that the MD4 hash of the maximum data size matches the expected test_md4_hash
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-632} Component sr_md4 Overview
+ * @verifyReq{RASW-633} Calculate MD4 Function
+ * @verifyReq{RASW-634} Safety Code
+ */
+TEST_F(srmd4Test, srmd4Test004VerifyMd4BatchCalculation)
+{
+    const uint16_t nbr_of_entries = 11;         // number of batch entries
+    const uint16_t data_sizes[nbr_of_entries] = {UT_SRMD4_MSG_LEN_MAX, UT_SRMD4_MSG_LEN_MIN, 55, 56, 63, 64, 119, 120, 128, 500, 1000};
+
+    // Test variables
+    srcty_Md4InitValue init_values = {UT_SRMD4_DEF_INITVAL_A, UT_SRMD4_DEF_INITVAL_B, UT_SRMD4_DEF_INITVAL_C, UT_SRMD4_DEF_INITVAL_D};
+    srmd4_Md4 expected_results[nbr_of_entries] = {};
+    srmd4_Md4 md4_results[nbr_of_entries] = {};
+    srmd4_Md4BatchEntry entries[nbr_of_entries] = {};
+
+    for (uint16_t i = 0; i < nbr_of_entries; i++) {
+        entries[i].data_size = data_sizes[i];
+        entries[i].data_buffer = test_message_u8_without_safety_code;
+        entries[i].calculated_md4 = &md4_results[i];
+        srmd4_CalculateMd4(init_values, data_sizes[i], test_message_u8_without_safety_code, &expected_results[i]);
+    }
+
+    for (uint16_t batch_size = 1; batch_size <= nbr_of_entries; batch_size++) {
+        std::memset(md4_results, 0, sizeof(md4_results));
+
+        // call the CalculateMd4Batch function
+        EXPECT_NO_THROW(srmd4_CalculateMd4Batch(init_values, batch_size, entries));
+
+        // verify if the calculated md4 hashes match the expectation
+        for (uint16_t i = 0; i < batch_size; i++) {
+            for (uint8_t j = 0; j < UT_SRMD4_MD4_HASH_LEN; j++) {
+                EXPECT_EQ(md4_results[i].md4[j], expected_results[i].md4[j]);
+            }
+        }
+    }
+
+    for (uint8_t j = 0; j < UT_SRMD4_MD4_HASH_LEN; j++) {
+        EXPECT_EQ(md4_results[0].md4[j], test_md4_hash[j]);
+    }
+}
+
+/**
+ * @test        @ID{srmd4Test005} Verify the MD4 padding for data sizes of 63 mod 64
+ *
+ * @details     This test verifies the MD4 calculation for data sizes, where the first padding byte fills up the last data block, so that the bit counters
+ *              must be added in an additional data block. The expected MD4 hashes are calculated according to RFC 1320 for the data bytes 0, 1, 2, ...
+ *
+ * Test steps:
+ * - prepare the data bytes 0, 1, 2, ... (modulo 256)
+ * - call the CalculateMd4 function for the data sizes 63, 127 and 1023 and verify that no fatal error is thrown
+ * - verify that the MD4 hashes match the expected MD4 hashes
+ * - call the CalculateMd4Batch function with the same data sizes and verify that the MD4 hashes match the expected MD4 hashes
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-633} Calculate MD4 Function
+ * @verifyReq{RASW-634} Safety Code
+ */
+TEST_F(srmd4Test, srmd4Test005VerifyMd4PaddingForDataSize63Mod64)
+{
+    const uint16_t nbr_of_entries = 3;          // number of data sizes
+    const uint16_t data_sizes[nbr_of_entries] = {63, 127, 1023};
+    const uint8_t expected_md4[nbr_of_entries][UT_SRMD4_MD4_HASH_LEN] = {
+        {0x54, 0xba, 0x44, 0x72, 0xfc, 0xd0, 0x3e, 0x99, 0xcf, 0x28, 0xf9, 0x0e, 0xed, 0x9f, 0x2a, 0xe0},
+        {0x20, 0x67, 0x88, 0x6d, 0xa4, 0xbd, 0xe1, 0x0a, 0x94, 0xb9, 0x71, 0xcd, 0x74, 0x0b, 0x0a, 0xab},
+        {0xe3, 0x04, 0xfb, 0x4b, 0x9e, 0xc8, 0x20, 0x9d, 0xe2, 0x12, 0x3e, 0xaf, 0x34, 0xf4, 0xd2, 0x26}
+    };
+
+    // Test variables
+    srcty_Md4InitValue init_values = {UT_SRMD4_DEF_INITVAL_A, UT_SRMD4_DEF_INITVAL_B, UT_SRMD4_DEF_INITVAL_C, UT_SRMD4_DEF_INITVAL_D};
+    uint8_t data[UT_SRMD4_MSG_LEN_MAX] = {};
+    srmd4_Md4 md4_results[nbr_of_entries] = {};
+    srmd4_Md4BatchEntry entries[nbr_of_entries] = {};
+
+    for (uint16_t i = 0; i < UT_SRMD4_MSG_LEN_MAX; i++) {
+        data[i] = (uint8_t)i;
+    }
+
+    // call the CalculateMd4 function
+    for (uint16_t i = 0; i < nbr_of_entries; i++) {
+        srmd4_Md4 md4_result = {};
+        EXPECT_NO_THROW(srmd4_CalculateMd4(init_values, data_sizes[i], data, &md4_result));
+        for (uint8_t j = 0; j < UT_SRMD4_MD4_HASH_LEN; j++) {
+            EXPECT_EQ(md4_result.md4[j], expected_md4[i][j]);
+        }
+
+        entries[i].data_size = data_sizes[i];
+        entries[i].data_buffer = data;
+        entries[i].calculated_md4 = &md4_results[i];
+    }
+
+    // call the CalculateMd4Batch function
+    EXPECT_NO_THROW(srmd4_CalculateMd4Batch(init_values, nbr_of_entries, entries));
+    for (uint16_t i = 0; i < nbr_of_entries; i++) {
+        for (uint8_t j = 0; j < UT_SRMD4_MD4_HASH_LEN; j++) {
+            EXPECT_EQ(md4_results[i].md4[j], expected_md4[i][j]);
+        }
+    }
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -22,6 +22,7 @@
 // clang-format off
 #include <vector>
 #include <cmath>
+#include <cstring>
 #include <stdexcept>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -0,0 +1,236 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_srmem.cc
+ *
+ * @author Martin Kuhn, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Unit test file for the connection memory module of the safety and retransmission layer.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include "unit_test_srmem.hh"
+
+// -----------------------------------------------------------------------------
+// Test cases
+// -----------------------------------------------------------------------------
+
+/** @addtogroup sr_connectionMemory
+ * @{
+ */
+
+/**
+ * @test        @ID{srmemTest001} Verify the init function.
+ *
+ * @details     This test verifies that the init function checks the connection memory and the initialization state.
+ *
+ * Test steps:
+ * - call the init function with a NULL pointer and verify that a fatal error is thrown
+ * - call the init function with a not aligned connection memory and verify that a fatal error is thrown
+ * - call the init function with a valid connection memory and verify that the module is initialized
+ * - call the init function again and verify that a fatal error is thrown
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        The connection memory module is initialized.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srmemTest, srmemTest001VerifyInitFunction)
+{
+    uint8_t *const connection_memory_bytes = (uint8_t *)connection_memory;
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(2).WillRepeatedly(Invoke(this, &srmemTest::invalidArgumentException));
+    EXPECT_THROW(srmem_Init(nullptr, sizeof(connection_memory)), std::invalid_argument);
+    EXPECT_THROW(srmem_Init(&connection_memory_bytes[1], sizeof(connection_memory) - 1U), std::invalid_argument);
+    EXPECT_FALSE(srmem_instance->initialized);
+
+    srmem_Init(connection_memory, sizeof(connection_memory));
+    EXPECT_TRUE(srmem_instance->initialized);
+    EXPECT_EQ(0U, srmem_instance->allocated_size);
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kAlreadyInitialized)).WillOnce(Invoke(this, &srmemTest::invalidArgumentException));
+    EXPECT_THROW(srmem_Init(connection_memory, sizeof(connection_memory)), std::invalid_argument);
+}
+
+/**
+ * @test        @ID{srmemTest002} Verify the allocate function.
+ *
+ * @details     This test verifies that the allocations are aligned, cleared and taken one after another from the connection memory.
+ *
+ * Test steps:
+ * - call the allocate function without initialization and verify that a fatal error is thrown
+ * - initialize the module with a connection memory filled with a pattern
+ * - call the allocate function with an invalid size and verify that a fatal error is thrown
+ * - allocate memory with a size which is not a multiple of the alignment and verify the returned pointer and the cleared memory
+ * - allocate the rest of the connection memory and verify the returned pointer
+ * - call the allocate function again and verify that a fatal error is thrown
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        The connection memory is completely allocated.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srmemTest, srmemTest002VerifyAllocateFunction)
+{
+    uint8_t *const connection_memory_bytes = (uint8_t *)connection_memory;
+    const uint32_t first_size = SRATY_CONNECTION_MEMORY_ALIGNMENT + 1U;
+    const uint32_t first_allocation_size = 2U * SRATY_CONNECTION_MEMORY_ALIGNMENT;
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kNotInitialized)).WillOnce(Invoke(this, &srmemTest::invalidArgumentException));
+    EXPECT_THROW(srmem_Allocate(1U), std::invalid_argument);
+
+    // fill the connection memory with a pattern
+    for (uint32_t index = 0U; index < sizeof(connection_memory); index++)
+    {
+        connection_memory_bytes[index] = 0xA5U;
+    }
+    srmem_Init(connection_memory, sizeof(connection_memory));
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &srmemTest::invalidArgumentException));
+    EXPECT_THROW(srmem_Allocate(0U), std::invalid_argument);
+
+    // first allocation is rounded up to the alignment and cleared
+    EXPECT_EQ(connection_memory_bytes, srmem_Allocate(first_size));
+    EXPECT_EQ(first_allocation_size, srmem_instance->allocated_size);
+    for (uint32_t index = 0U; index < first_allocation_size; index++)
+    {
+        EXPECT_EQ(0U, connection_memory_bytes[index]);
+    }
+    EXPECT_EQ(0xA5U, connection_memory_bytes[first_allocation_size]);
+
+    // second allocation takes the rest of the connection memory
+    EXPECT_EQ(&connection_memory_bytes[first_allocation_size], srmem_Allocate(sizeof(connection_memory) - first_allocation_size));
+    EXPECT_EQ(sizeof(connection_memory), srmem_instance->allocated_size);
+
+    // no free connection memory left
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidConfiguration)).WillOnce(Invoke(this, &srmemTest::invalidArgumentException));
+    EXPECT_THROW(srmem_Allocate(1U), std::invalid_argument);
+}
+
+/**
+ * @test        @ID{srmemTest003} Verify the get allocation size function.
+ *
+ * @details     This test verifies that the get allocation size function rounds the size up to the alignment.
+ *
+ * Test steps:
+ * - call the get allocation size function with an invalid size and verify that a fatal error is thrown
+ * - verify the allocation size for sizes around a multiple of the alignment
+ * - verify the allocation size for the maximum size
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srmemTest, srmemTest003VerifyGetAllocationSizeFunction)
+{
+    const uint32_t max_size = UINT32_MAX - SRATY_CONNECTION_MEMORY_ALIGNMENT + 1U;
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(2).WillRepeatedly(Invoke(this, &srmemTest::invalidArgumentException));
+    EXPECT_THROW(srmem_GetAllocationSize(0U), std::invalid_argument);
+    EXPECT_THROW(srmem_GetAllocationSize(max_size + 1U), std::invalid_argument);
+
+    EXPECT_EQ(SRATY_CONNECTION_MEMORY_ALIGNMENT, srmem_GetAllocationSize(1U));
+    EXPECT_EQ(SRATY_CONNECTION_MEMORY_ALIGNMENT, srmem_GetAllocationSize(SRATY_CONNECTION_MEMORY_ALIGNMENT));
+    EXPECT_EQ(2U * SRATY_CONNECTION_MEMORY_ALIGNMENT, srmem_GetAllocationSize(SRATY_CONNECTION_MEMORY_ALIGNMENT + 1U));
+    EXPECT_EQ(max_size, srmem_GetAllocationSize(max_size));
+}
+
+/**
+ * @test        @ID{srmemTest004} Verify the get table allocation size function.
+ *
+ * @details     This test verifies that the get table allocation size function checks the size of the table before it is calculated.
+ *
+ * Test steps:
+ * - call the get table allocation size function with invalid numbers of entries and entry sizes and verify that a fatal error is thrown
+ * - call the get table allocation size function with a table size, which overflows a 32 bit value, and verify that a fatal error is thrown
+ * - verify the allocation size for tables around a multiple of the alignment
+ * - verify the allocation size for the maximum table size
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srmemTest, srmemTest004VerifyGetTableAllocationSizeFunction)
+{
+    const uint32_t max_size = UINT32_MAX - SRATY_CONNECTION_MEMORY_ALIGNMENT + 1U;
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(5).WillRepeatedly(Invoke(this, &srmemTest::invalidArgumentException));
+    EXPECT_THROW(srmem_GetTableAllocationSize(0U, 1U), std::invalid_argument);
+    EXPECT_THROW(srmem_GetTableAllocationSize(1U, 0U), std::invalid_argument);
+    EXPECT_THROW(srmem_GetTableAllocationSize(max_size + 1U, 1U), std::invalid_argument);
+    EXPECT_THROW(srmem_GetTableAllocationSize(1U, max_size + 1U), std::invalid_argument);
+    EXPECT_THROW(srmem_GetTableAllocationSize(0x10000U, 0x10000U), std::invalid_argument);
+
+    EXPECT_EQ(SRATY_CONNECTION_MEMORY_ALIGNMENT, srmem_GetTableAllocationSize(1U, 1U));
+    EXPECT_EQ(2U * SRATY_CONNECTION_MEMORY_ALIGNMENT, srmem_GetTableAllocationSize(SRATY_CONNECTION_MEMORY_ALIGNMENT + 1U, 1U));
+    EXPECT_EQ(5000U * 24U, srmem_GetTableAllocationSize(5000U, 24U));
+    EXPECT_EQ(max_size, srmem_GetTableAllocationSize(max_size / SRATY_CONNECTION_MEMORY_ALIGNMENT, SRATY_CONNECTION_MEMORY_ALIGNMENT));
+    EXPECT_EQ(max_size, srmem_GetTableAllocationSize(1U, max_size));
+}
+
+/**
+ * @test        @ID{srmemTest005} Verify the add allocation sizes function.
+ *
+ * @details     This test verifies that the add allocation sizes function checks the sum of the sizes for an overflow.
+ *
+ * Test steps:
+ * - verify the sum of sizes up to the maximum value
+ * - call the add allocation sizes function with sizes, whose sum overflows a 32 bit value, and verify that a fatal error is thrown
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srmemTest, srmemTest005VerifyAddAllocationSizesFunction)
+{
+    EXPECT_EQ(0U, srmem_AddAllocationSizes(0U, 0U));
+    EXPECT_EQ(96U, srmem_AddAllocationSizes(32U, 64U));
+    EXPECT_EQ(UINT32_MAX, srmem_AddAllocationSizes(UINT32_MAX, 0U));
+    EXPECT_EQ(UINT32_MAX, srmem_AddAllocationSizes(0U, UINT32_MAX));
+    EXPECT_EQ(UINT32_MAX, srmem_AddAllocationSizes(UINT32_MAX - 64U, 64U));
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(2).WillRepeatedly(Invoke(this, &srmemTest::invalidArgumentException));
+    EXPECT_THROW(srmem_AddAllocationSizes(UINT32_MAX, 1U), std::invalid_argument);
+    EXPECT_THROW(srmem_AddAllocationSizes(UINT32_MAX - 63U, 64U), std::invalid_argument);
+}
+
+/** @}*/
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
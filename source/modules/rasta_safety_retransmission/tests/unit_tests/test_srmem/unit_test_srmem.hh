@@ -0,0 +1,83 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file unit_test_srmem.hh
+ *
+ * @author Martin Kuhn, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Header file for unit tests of the connection memory module of the safety and retransmission layer.
+ */
+
+#ifndef SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_UNIT_TESTS_TEST_SRMEM_UNIT_TEST_SRMEM_HH_
+#define SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_UNIT_TESTS_TEST_SRMEM_UNIT_TEST_SRMEM_HH_
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+// clang-format off
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "src/srmem_sr_connection_memory.h"
+#include "rasta_safety_retransmission/sraty_sr_api_types.h"
+#include "rasys_mock.hh"
+// clang-format on
+
+using testing::_;
+using testing::Invoke;
+using testing::StrictMock;
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+#define UT_SRMEM_CONNECTION_MEMORY_SIZE 64      ///< size of the connection memory [bytes]
+
+// -----------------------------------------------------------------------------
+// Local Variable Definitions
+// -----------------------------------------------------------------------------
+
+extern RADEF_THREAD_LOCAL srmem_InstanceData *srmem_instance;      ///< data of the selected connection memory module instance
+
+// -----------------------------------------------------------------------------
+// Test class definiton
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Test fixture class for the connection memory module
+ *
+ */
+class srmemTest : public ::testing::Test
+{
+public:
+    srmemTest()
+    {
+        // reset initialization state
+        srmem_instance->initialized = false;
+    }
+    ~srmemTest()
+    {
+
+    }
+
+    /**
+    * @brief Throw invalid argument exception
+    * This function is used to throw an invalid argument exception mocked function call action.
+    */
+    void invalidArgumentException(){
+        throw std::invalid_argument("Invalid argument!");
+    }
+
+    uint64_t connection_memory[UT_SRMEM_CONNECTION_MEMORY_SIZE / sizeof(uint64_t)];  ///< connection memory
+
+    StrictMock<rasysMock>   rasys_mock;         ///< mock for the rasta system adapter class
+};
+
+#endif  // SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_UNIT_TESTS_TEST_SRMEM_UNIT_TEST_SRMEM_HH_
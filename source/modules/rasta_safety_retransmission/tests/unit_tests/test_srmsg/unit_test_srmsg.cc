@@ -78,11 +78,18 @@ TEST_F(srmsgTest, srmsgTest015VerifyInitFunction)
  * - call the srmsg_CreateDataMessage function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_CreateRetrDataMessage function with invalid payload pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_CreateRetrDataMessage function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srmsg_AddDataMessagePayload function with invalid payload view pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srmsg_AddDataMessagePayload function with invalid payload pointer in the payload view and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srmsg_AddDataMessagePayload function with invalid message view pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srmsg_AddDataMessagePayload function with invalid message pointer in the message view and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srmsg_ConvertDataMessage function with invalid message view pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_CreateRetrReqMessage function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_CreateRetrRespMessage function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_CreateHeartbeatMessage function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_CreateDiscReqMessage function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_UpdateMessageHeader function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srmsg_UpdateMessageHeaderBatch function with invalid header update pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srmsg_UpdateMessageHeaderBatch function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_CheckMessage function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_GetMessageHeader function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_GetMessageHeader function with invalid message header pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
@@ -90,6 +97,10 @@ TEST_F(srmsgTest, srmsgTest015VerifyInitFunction)
  * - call the srmsg_GetMessageSequenceNumber function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_GetDataMessagePayload function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_GetDataMessagePayload function with invalid payload pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srmsg_GetNumberOfDataMessagePayloads function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srmsg_GetDataMessagePayloadView function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srmsg_GetDataMessagePayloadView function with invalid payload offset pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the srmsg_GetDataMessagePayloadView function with invalid payload view pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_GetConnMessageData function with invalid message pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_GetConnMessageData function with invalid protocol version pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the srmsg_GetConnMessageData function with invalid nSendMax pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
@@ -127,7 +138,7 @@ TEST_F(srmsgTest, srmsgTest015VerifyInitFunction)
  */
 TEST_F(srmsgTest, srmsgTest016VerifyNullPointerCheck)
 {
-    uint8_t nbr_of_function_calls = 24;        // number of function calls
+    uint8_t nbr_of_function_calls = 35;        // number of function calls
 
     // Test variables
     srcty_SafetyCodeType safety_code_type = srcty_kSafetyCodeTypeFullMd4;
@@ -136,7 +147,12 @@ TEST_F(srmsgTest, srmsgTest016VerifyNullPointerCheck)
     srtyp_ProtocolVersion protocol_version = {UT_SRMSG_PROT_MIN, UT_SRMSG_PROT_MIN, UT_SRMSG_PROT_MIN, UT_SRMSG_PROT_MIN};
     uint16_t n_send_max = UT_SRMSG_NSENDMAX_MIN;
     srtyp_SrMessagePayload message_payload = {UT_SRMSG_DATA_LEN_MIN, {}};
+    srtyp_SrMessagePayloadView payload_view = {UT_SRMSG_DATA_LEN_MIN, message_payload.payload};
+    uint16_t payload_offset = 0U;
+    srtyp_SrMessagePayloadView invalid_payload_view = {UT_SRMSG_DATA_LEN_MIN, (uint8_t *)NULL};
     srtyp_SrMessage message = {};
+    srtyp_SrMessageView message_view = {0U, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, message.message};
+    srtyp_SrMessageView invalid_message_view = {0U, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, (uint8_t *)NULL};
     sraty_DiscReason reason = sraty_kDiscReasonUserRequest;
     uint16_t detailed_reason = 0;
     srtyp_SrMessageHeaderUpdate message_header_update = {};
@@ -157,11 +173,18 @@ TEST_F(srmsgTest, srmsgTest016VerifyNullPointerCheck)
     EXPECT_THROW(srmsg_CreateDataMessage(message_header_create, &message_payload, (srtyp_SrMessage * )NULL), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateRetrDataMessage(message_header_create, (srtyp_SrMessagePayload *)NULL, &message), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateRetrDataMessage(message_header_create, &message_payload, (srtyp_SrMessage * )NULL), std::invalid_argument);
+    EXPECT_THROW(srmsg_AddDataMessagePayload((srtyp_SrMessagePayloadView *)NULL, &message_view), std::invalid_argument);
+    EXPECT_THROW(srmsg_AddDataMessagePayload(&invalid_payload_view, &message_view), std::invalid_argument);
+    EXPECT_THROW(srmsg_AddDataMessagePayload(&payload_view, (srtyp_SrMessageView *)NULL), std::invalid_argument);
+    EXPECT_THROW(srmsg_AddDataMessagePayload(&payload_view, &invalid_message_view), std::invalid_argument);
+    EXPECT_THROW(srmsg_ConvertDataMessage(message_header_create, srtyp_kSrMessageRetrData, (srtyp_SrMessageView *)NULL), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateRetrReqMessage(message_header_create, (srtyp_SrMessage *)NULL), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateRetrRespMessage(message_header_create, (srtyp_SrMessage *)NULL), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateHeartbeatMessage(message_header_create, (srtyp_SrMessage *)NULL), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateDiscReqMessage(message_header_create, detailed_reason, reason, (srtyp_SrMessage *)NULL), std::invalid_argument);
     EXPECT_THROW(srmsg_UpdateMessageHeader(message_header_update, (srtyp_SrMessage *)NULL), std::invalid_argument);
+    EXPECT_THROW(srmsg_UpdateMessageHeaderBatch(1U, (srtyp_SrMessageHeaderUpdate *)NULL, &message), std::invalid_argument);
+    EXPECT_THROW(srmsg_UpdateMessageHeaderBatch(1U, &message_header_update, (srtyp_SrMessage *)NULL), std::invalid_argument);
     EXPECT_THROW(srmsg_CheckMessage((srtyp_SrMessage *)NULL), std::invalid_argument);
     EXPECT_THROW(srmsg_GetMessageHeader((srtyp_SrMessage *)NULL, &message_header), std::invalid_argument);
     EXPECT_THROW(srmsg_GetMessageHeader(&message, (srtyp_SrMessageHeader *)NULL), std::invalid_argument);
@@ -169,6 +192,10 @@ TEST_F(srmsgTest, srmsgTest016VerifyNullPointerCheck)
     EXPECT_THROW(srmsg_GetMessageSequenceNumber((srtyp_SrMessage *)NULL), std::invalid_argument);
     EXPECT_THROW(srmsg_GetDataMessagePayload((srtyp_SrMessage *)NULL, &message_payload), std::invalid_argument);
     EXPECT_THROW(srmsg_GetDataMessagePayload(&message, (srtyp_SrMessagePayload *)NULL), std::invalid_argument);
+    EXPECT_THROW(srmsg_GetNumberOfDataMessagePayloads((srtyp_SrMessage *)NULL), std::invalid_argument);
+    EXPECT_THROW(srmsg_GetDataMessagePayloadView((srtyp_SrMessage *)NULL, &payload_offset, &payload_view), std::invalid_argument);
+    EXPECT_THROW(srmsg_GetDataMessagePayloadView(&message, (uint16_t *)NULL, &payload_view), std::invalid_argument);
+    EXPECT_THROW(srmsg_GetDataMessagePayloadView(&message, &payload_offset, (srtyp_SrMessagePayloadView *)NULL), std::invalid_argument);
     EXPECT_THROW(srmsg_GetConnMessageData((srtyp_SrMessage *)NULL, &protocol_version, &n_send_max), std::invalid_argument);
     EXPECT_THROW(srmsg_GetConnMessageData(&message, (srtyp_ProtocolVersion *)NULL, &n_send_max), std::invalid_argument);
     EXPECT_THROW(srmsg_GetConnMessageData(&message, &protocol_version, (uint16_t *)NULL), std::invalid_argument);
@@ -188,16 +215,21 @@ TEST_F(srmsgTest, srmsgTest016VerifyNullPointerCheck)
  * - call the CreateConnRespMessage function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the CreateDataMessage function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the CreateRetrDataMessage function and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - call the AddDataMessagePayload function and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - call the ConvertDataMessage function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the CreateRetrReqMessage function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the CreateRetrRespMessage function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the CreateHeartbeatMessage function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the CreateDiscReqMessage function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the UpdateMessageHeader function and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - call the UpdateMessageHeaderBatch function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the CheckMessage function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the GetMessageHeader function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the GetMessageType function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the GetMessageSequenceNumber function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the GetDataMessagePayload function and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - call the GetNumberOfDataMessagePayloads function and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - call the GetDataMessagePayloadView function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the GetConnMessageData function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the GetDiscMessageData function and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * .
@@ -229,14 +261,17 @@ TEST_F(srmsgTest, srmsgTest016VerifyNullPointerCheck)
  */
 TEST_F(srmsgTest, srmsgTest017VerifyInitializationCheck)
 {
-    uint8_t nbr_of_function_calls = 16;         // number of function calls
+    uint8_t nbr_of_function_calls = 21;         // number of function calls
 
     // Test variables
     srtyp_SrMessageHeaderCreate message_header_create = {};
     srtyp_ProtocolVersion protocol_version = {UT_SRMSG_PROT_MIN, UT_SRMSG_PROT_MIN, UT_SRMSG_PROT_MIN, UT_SRMSG_PROT_MIN};
     uint16_t n_send_max = UT_SRMSG_NSENDMAX_MIN;
     srtyp_SrMessagePayload message_payload = {UT_SRMSG_DATA_LEN_MIN, {}};
+    srtyp_SrMessagePayloadView payload_view = {};
+    uint16_t payload_offset = 0U;
     srtyp_SrMessage message = {};
+    srtyp_SrMessageView message_view = {0U, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, message.message};
     sraty_DiscReason reason = sraty_kDiscReasonUserRequest;
     uint16_t detailed_reason = 0;
     srtyp_SrMessageHeaderUpdate message_header_update = {};
@@ -252,16 +287,21 @@ TEST_F(srmsgTest, srmsgTest017VerifyInitializationCheck)
     EXPECT_THROW(srmsg_CreateConnRespMessage(message_header_create, protocol_version, n_send_max, &message), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateDataMessage(message_header_create, &message_payload, &message), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateRetrDataMessage(message_header_create, &message_payload, &message), std::invalid_argument);
+    EXPECT_THROW(srmsg_AddDataMessagePayload(&payload_view, &message_view), std::invalid_argument);
+    EXPECT_THROW(srmsg_ConvertDataMessage(message_header_create, srtyp_kSrMessageRetrData, &message_view), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateRetrReqMessage(message_header_create, &message), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateRetrRespMessage(message_header_create, &message), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateHeartbeatMessage(message_header_create, &message), std::invalid_argument);
     EXPECT_THROW(srmsg_CreateDiscReqMessage(message_header_create, detailed_reason, reason, &message), std::invalid_argument);
     EXPECT_THROW(srmsg_UpdateMessageHeader(message_header_update, &message), std::invalid_argument);
+    EXPECT_THROW(srmsg_UpdateMessageHeaderBatch(1U, &message_header_update, &message), std::invalid_argument);
     EXPECT_THROW(srmsg_CheckMessage(&message), std::invalid_argument);
     EXPECT_THROW(srmsg_GetMessageHeader(&message, &message_header), std::invalid_argument);
     EXPECT_THROW(srmsg_GetMessageType(&message), std::invalid_argument);
     EXPECT_THROW(srmsg_GetMessageSequenceNumber(&message), std::invalid_argument);
     EXPECT_THROW(srmsg_GetDataMessagePayload(&message, &message_payload), std::invalid_argument);
+    EXPECT_THROW(srmsg_GetNumberOfDataMessagePayloads(&message), std::invalid_argument);
+    EXPECT_THROW(srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view), std::invalid_argument);
     EXPECT_THROW(srmsg_GetConnMessageData(&message, &protocol_version, &n_send_max), std::invalid_argument);
     EXPECT_THROW(srmsg_GetDiscMessageData(&message, &detailed_reason, &reason), std::invalid_argument);
 }
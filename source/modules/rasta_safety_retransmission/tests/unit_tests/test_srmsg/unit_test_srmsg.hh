@@ -73,7 +73,7 @@ using testing::NaggyMock;
 
 extern uint8_t test_payload_data_u8[UT_SRMSG_DATA_LEN_MAX];
 
-extern bool srmsg_initialized;                            ///< initialization state (local variable)
+extern RADEF_THREAD_LOCAL srmsg_InstanceData *srmsg_instance;                ///< data of the selected messages module instance
 
 // -----------------------------------------------------------------------------
 // Test class definiton
@@ -89,7 +89,7 @@ public:
     srmsgTest()
     {
         // reset initialization state
-        srmsg_initialized = false;
+        srmsg_instance->initialized = false;
     }
     ~srmsgTest()
     {
@@ -94,6 +94,50 @@ class DataMsgWithParam :    public srmsgTest,
     bool expect_fatal_error =                       std::get<7>(GetParam());        ///< expect fatal error
 };
 
+/**
+ * @brief Test class for value-parametrized message packing test
+ *
+ * Parameter order:
+ * - message type (srtyp_SrMessageType)
+ * - size of the first payload (uint16_t)
+ * - size of the added payload (uint16_t)
+ * - safety code type (srcty_SafetyCodeType)
+ * - expect payload added (bool)
+ * - size of the message buffer (uint16_t)
+ * .
+ */
+class PackedDataMsgWithParam :  public srmsgTest,
+                                public testing::WithParamInterface<std::tuple<srtyp_SrMessageType, uint16_t, uint16_t, srcty_SafetyCodeType, bool, uint16_t>>
+{
+    public:
+    srtyp_SrMessageType message_type =              std::get<0>(GetParam());        ///< message type
+    uint16_t first_payload_size =                   std::get<1>(GetParam());        ///< size of the first payload
+    uint16_t added_payload_size =                   std::get<2>(GetParam());        ///< size of the added payload
+    srcty_SafetyCodeType safety_code_type =         std::get<3>(GetParam());        ///< safety code type
+    bool expect_payload_added =                     std::get<4>(GetParam());        ///< expect payload added
+    uint16_t buffer_size =                          std::get<5>(GetParam());        ///< size of the message buffer
+};
+
+/**
+ * @brief Test class for value-parametrized data message conversion test
+ *
+ * Parameter order:
+ * - message type of the stored message (srtyp_SrMessageType)
+ * - new message type (srtyp_SrMessageType)
+ * - safety code type (srcty_SafetyCodeType)
+ * - expect fatal error (bool)
+ * .
+ */
+class ConvertDataMsgWithParam : public srmsgTest,
+                                public testing::WithParamInterface<std::tuple<srtyp_SrMessageType, srtyp_SrMessageType, srcty_SafetyCodeType, bool>>
+{
+    public:
+    srtyp_SrMessageType stored_message_type =       std::get<0>(GetParam());        ///< message type of the stored message
+    srtyp_SrMessageType new_message_type =          std::get<1>(GetParam());        ///< new message type
+    srcty_SafetyCodeType safety_code_type =         std::get<2>(GetParam());        ///< safety code type
+    bool expect_fatal_error =                       std::get<3>(GetParam());        ///< expect fatal error
+};
+
 /**
  * @brief Test class for value-parametrized retransmission request/response message test and heartbeat message test
  *
@@ -730,6 +774,265 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX, UT_SRMSG_DATA_LEN_MAX, test_payload_data_u8, srcty_kSafetyCodeTypeLowerMd4, false)
     ));
 
+/**
+ * @test        @ID{srmsgTest021} Verify the addDataMessagePayload function.
+ *
+ * @details     This test verifies the correct behaviour of the addDataMessagePayload function and the reading of packed messages with the
+ *              getNumberOfDataMessagePayloads and getDataMessagePayloadView functions.
+ *
+ * Test steps:
+ * - setup test variables and expected values
+ * - initialize the module with given safety code option
+ * - create a data or retransmitted data message with the first payload
+ * - add the second payload to the message view with the given buffer size and verify the return value
+ * - verify the message size and the message length in the message
+ * - verify the number of packed messages
+ * - verify the size and content of every packed message
+ * - verify that the message check accepts the packed message (only without safety code, since the safety code is calculated before sending)
+ * .
+ *
+ * @testParameter
+ * - Message type: Type of the created message
+ * - First size: Size of the payload used to create the message in bytes
+ * - Added size: Size of the payload added to the message in bytes
+ * - Safety Code Type: Configured Safety code type
+ * - Buffer size: Size of the message buffer in bytes
+ * - Payload added: Indicates if the payload fits into the message
+ * .
+ * | Test Run | Input parameter                                     |||| Test config      | Expected values                  ||
+ * |----------|--------------|------------|------------|-------------|------------------|---------------|------------------|
+ * |          | Message type | First size | Added size | Buffer size | Safety Code Type | Payload added | Test Result      |
+ * | 0        | Data         | 1          | 1          | 1101        | None             | True          | Normal operation |
+ * | 1        | RetrData     | 1          | 1          | 1101        | Lower MD4        | True          | Normal operation |
+ * | 2        | Data         | 1000       | 53         | 1101        | Full MD4         | True          | Normal operation |
+ * | 3        | Data         | 1000       | 54         | 1101        | Full MD4         | False         | Normal operation |
+ * | 4        | Data         | 1055       | 1          | 1101        | None             | False         | Normal operation |
+ * | 5        | Data         | 1          | 1          | 34          | None             | True          | Normal operation |
+ * | 6        | Data         | 1          | 1          | 33          | None             | False         | Normal operation |
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         This is a value-parametrized test case which needs instantiation with defined values.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-623} Create Data Message Function
+ * @verifyReq{RASW-626} Get Data Message Payload Function
+ * @verifyReq{RASW-157} Endian Definition
+ * @verifyReq{RASW-191} Data Message Structure
+ * @verifyReq{RASW-192} Message Length
+ * @verifyReq{RASW-193} Size of Message Data
+ */
+TEST_P(PackedDataMsgWithParam, srmsgTest021VerifyAddDataMessagePayload)
+{
+    uint16_t i = 0;      // loop iterator
+
+    // Expected Values
+    const uint8_t expected_payload_size_bytepos     = 28;               // according to RASW-191
+    const uint8_t expected_payload_bytepos          = 30;               // according to RASW-191
+
+    // test variables
+    srtyp_SrMessage message = {0, {}};
+    srtyp_SrMessagePayload first_payload = {first_payload_size, {}};
+    const uint8_t * added_data_ptr = &test_payload_data_u8[UT_SRMSG_DATA_LEN_MAX - added_payload_size];
+    srtyp_SrMessagePayloadView added_payload = {added_payload_size, added_data_ptr};
+    srtyp_SrMessagePayloadView payload_view = {0, NULL};
+    srtyp_SrMessageHeaderCreate message_header = {1, 2, 3, 4};
+    for (i = 0; i < first_payload_size; i++) {
+        first_payload.payload[i] = test_payload_data_u8[i];
+    }
+
+    // initialize the module
+    srmsg_Init(safety_code_type, {0, 0, 0, 0});        // initialize module with given safety code and MD4 initial values = 0
+    EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+    // create the message with the first payload
+    if (message_type == srtyp_kSrMessageData) {
+        srmsg_CreateDataMessage(message_header, &first_payload, &message);
+    }
+    else {
+        srmsg_CreateRetrDataMessage(message_header, &first_payload, &message);
+    }
+    const uint16_t created_message_size = message.message_size;
+    srtyp_SrMessageView message_view = {message.message_size, buffer_size, message.message};
+
+    // call the function
+    EXPECT_EQ(expect_payload_added, srmsg_AddDataMessagePayload(&added_payload, &message_view));
+    message.message_size = message_view.message_size;
+
+    // verify the message size
+    uint16_t expected_message_size = created_message_size;
+    uint16_t expected_number_of_payloads = 1;
+    if (expect_payload_added) {
+        expected_message_size = created_message_size + 2 + added_payload_size;
+        expected_number_of_payloads = 2;
+    }
+    EXPECT_EQ(expected_message_size, message.message_size);
+    EXPECT_EQ(expected_message_size, getDataFromBuffer_u16(&message.message, expected_message_length_pos));
+    EXPECT_EQ(message_type, getDataFromBuffer_u16(&message.message, expected_message_type_pos));
+    EXPECT_EQ(first_payload_size, getDataFromBuffer_u16(&message.message, expected_payload_size_bytepos));
+
+    // verify the packed messages
+    EXPECT_EQ(expected_number_of_payloads, srmsg_GetNumberOfDataMessagePayloads(&message));
+
+    uint16_t payload_offset = 0U;
+    srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view);
+    EXPECT_EQ(first_payload_size, payload_view.payload_size);
+    EXPECT_EQ(2 + first_payload_size, payload_offset);
+    EXPECT_EQ(&message.message[expected_payload_bytepos], payload_view.payload);
+    for (i = 0; i < first_payload_size; i++) {
+        EXPECT_EQ(first_payload.payload[i], payload_view.payload[i]);
+    }
+
+    if (expect_payload_added) {
+        srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view);
+        EXPECT_EQ(added_payload_size, payload_view.payload_size);
+        EXPECT_EQ(&message.message[expected_payload_bytepos + first_payload_size + 2], payload_view.payload);
+        for (i = 0; i < added_payload_size; i++) {
+            EXPECT_EQ(added_data_ptr[i], payload_view.payload[i]);
+        }
+    }
+
+    // verify the message check of the packed message
+    if (safety_code_type == srcty_kSafetyCodeTypeNone) {
+        EXPECT_EQ(radef_kNoError, srmsg_CheckMessage(&message));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    verifyAddDataMessagePayload,
+    PackedDataMsgWithParam,
+    ::testing::Values(
+        std::make_tuple(srtyp_kSrMessageData, UT_SRMSG_DATA_LEN_MIN, UT_SRMSG_DATA_LEN_MIN, srcty_kSafetyCodeTypeNone, true, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE),
+        std::make_tuple(srtyp_kSrMessageRetrData, UT_SRMSG_DATA_LEN_MIN, UT_SRMSG_DATA_LEN_MIN, srcty_kSafetyCodeTypeLowerMd4, true, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE),
+        std::make_tuple(srtyp_kSrMessageData, 1000, 53, srcty_kSafetyCodeTypeFullMd4, true, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE),
+        std::make_tuple(srtyp_kSrMessageData, 1000, 54, srcty_kSafetyCodeTypeFullMd4, false, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE),
+        std::make_tuple(srtyp_kSrMessageData, UT_SRMSG_DATA_LEN_MAX, UT_SRMSG_DATA_LEN_MIN, srcty_kSafetyCodeTypeNone, false, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE),
+        std::make_tuple(srtyp_kSrMessageData, UT_SRMSG_DATA_LEN_MIN, UT_SRMSG_DATA_LEN_MIN, srcty_kSafetyCodeTypeNone, true, 34),
+        std::make_tuple(srtyp_kSrMessageData, UT_SRMSG_DATA_LEN_MIN, UT_SRMSG_DATA_LEN_MIN, srcty_kSafetyCodeTypeNone, false, 33)
+    ));
+
+/**
+ * @test        @ID{srmsgTest022} Verify the convertDataMessage function.
+ *
+ * @details     This test verifies the correct behaviour of the convertDataMessage function, which overwrites the header of a stored data or
+ *              retransmitted data message without touching the packed application messages.
+ *
+ * Test steps:
+ * - initialize the module with given safety code option
+ * - create a stored message of the given type (with two packed application messages for data and retransmitted data messages)
+ * - set the confirmed sequence number and the time stamp
+ * - call the convertDataMessage function with a new header and the new message type
+ * - verify the message type and all header fields
+ * - verify that the message size and all packed application messages are unchanged
+ * .
+ *
+ * @testParameter
+ * - Stored type: Type of the stored message
+ * - New type: New message type
+ * - Safety Code Type: Configured Safety code type
+ * .
+ * | Test Run | Input parameter        || Test config      | Expected values                              ||
+ * |----------|-------------|----------|------------------|-------------------------|--------------------|
+ * |          | Stored type | New type | Safety Code Type | Exp. Error Code         | Test Result        |
+ * | 0        | Data        | RetrData | None             |                         | Normal operation   |
+ * | 1        | Data        | Data     | Lower MD4        |                         | Normal operation   |
+ * | 2        | RetrData    | RetrData | Full MD4         |                         | Normal operation   |
+ * | 3        | RetrData    | Data     | Full MD4         |                         | Normal operation   |
+ * | 4        | Data        | HB       | Full MD4         | radef_kInvalidParameter | Fatal Error raised |
+ * | 5        | HB          | RetrData | Full MD4         | radef_kInvalidParameter | Fatal Error raised |
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         This is a value-parametrized test case which needs instantiation with defined values.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-157} Endian Definition
+ * @verifyReq{RASW-191} Data Message Structure
+ * @verifyReq{RASW-196} Retransmitted Data Message Structure
+ * @verifyReq{RASW-520} Error Handling
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_P(ConvertDataMsgWithParam, srmsgTest022VerifyConvertDataMessage)
+{
+    // test variables
+    srtyp_SrMessage message = {0, {}};
+    srtyp_SrMessagePayload first_payload = {UT_SRMSG_DATA_LEN_MIN, {0x5A}};
+    const srtyp_SrMessagePayloadView added_payload = {10, test_payload_data_u8};
+    srtyp_SrMessagePayloadView payload_view = {0, NULL};
+    const srtyp_SrMessageHeaderCreate stored_header = {1, 2, 3, 4};
+    const srtyp_SrMessageHeaderCreate new_header = {UINT32_MAX, 0x12345678, 0x9ABCDEF0, UINT32_MAX - 1};
+    const srtyp_SrMessageHeaderUpdate header_update = {5, 6};
+
+    // initialize the module
+    srmsg_Init(safety_code_type, {0, 0, 0, 0});        // initialize module with given safety code and MD4 initial values = 0
+
+    // create the stored message
+    if (stored_message_type == srtyp_kSrMessageData) {
+        srmsg_CreateDataMessage(stored_header, &first_payload, &message);
+    }
+    else if (stored_message_type == srtyp_kSrMessageRetrData) {
+        srmsg_CreateRetrDataMessage(stored_header, &first_payload, &message);
+    }
+    else {
+        srmsg_CreateHeartbeatMessage(stored_header, &message);
+    }
+    if (stored_message_type != srtyp_kSrMessageHb) {
+        srtyp_SrMessageView message_view = {message.message_size, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, message.message};
+        EXPECT_TRUE(srmsg_AddDataMessagePayload(&added_payload, &message_view));
+        message.message_size = message_view.message_size;
+    }
+    srmsg_UpdateMessageHeader(header_update, &message);
+    const srtyp_SrMessage stored_message = message;
+    srtyp_SrMessageView stored_message_view = {message.message_size, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE, message.message};
+
+    if (expect_fatal_error) {
+        EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &srmsgTest::invalidArgumentException));
+        EXPECT_THROW(srmsg_ConvertDataMessage(new_header, new_message_type, &stored_message_view), std::invalid_argument);
+    }
+    else {
+        EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+        srmsg_ConvertDataMessage(new_header, new_message_type, &stored_message_view);
+        EXPECT_EQ(stored_message.message_size, stored_message_view.message_size);
+
+        // verify the header
+        EXPECT_EQ(stored_message.message_size, message.message_size);
+        EXPECT_EQ(stored_message.message_size, getDataFromBuffer_u16(&message.message, expected_message_length_pos));
+        EXPECT_EQ(new_message_type, getDataFromBuffer_u16(&message.message, expected_message_type_pos));
+        EXPECT_EQ(new_header.receiver_id, getDataFromBuffer_u32(&message.message, expected_receiver_id_pos));
+        EXPECT_EQ(new_header.sender_id, getDataFromBuffer_u32(&message.message, expected_sender_id_pos));
+        EXPECT_EQ(new_header.sequence_number, getDataFromBuffer_u32(&message.message, expected_sequence_nbr_pos));
+        EXPECT_EQ(0U, getDataFromBuffer_u32(&message.message, expected_conf_seq_nbr_pos));
+        EXPECT_EQ(0U, getDataFromBuffer_u32(&message.message, expected_timestamp_pos));
+        EXPECT_EQ(new_header.confirmed_time_stamp, getDataFromBuffer_u32(&message.message, expected_conf_timestamp_pos));
+
+        // verify the unchanged packed application messages
+        for (uint16_t i = expected_conf_timestamp_pos + 4; i < message.message_size; i++) {
+            EXPECT_EQ(stored_message.message[i], message.message[i]);
+        }
+        EXPECT_EQ(2U, srmsg_GetNumberOfDataMessagePayloads(&message));
+        uint16_t payload_offset = 0U;
+        srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view);
+        srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view);
+        EXPECT_EQ(added_payload.payload_size, payload_view.payload_size);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    verifyConvertDataMessage,
+    ConvertDataMsgWithParam,
+    ::testing::Values(
+        std::make_tuple(srtyp_kSrMessageData, srtyp_kSrMessageRetrData, srcty_kSafetyCodeTypeNone, false),
+        std::make_tuple(srtyp_kSrMessageData, srtyp_kSrMessageData, srcty_kSafetyCodeTypeLowerMd4, false),
+        std::make_tuple(srtyp_kSrMessageRetrData, srtyp_kSrMessageRetrData, srcty_kSafetyCodeTypeFullMd4, false),
+        std::make_tuple(srtyp_kSrMessageRetrData, srtyp_kSrMessageData, srcty_kSafetyCodeTypeFullMd4, false),
+        std::make_tuple(srtyp_kSrMessageData, srtyp_kSrMessageHb, srcty_kSafetyCodeTypeFullMd4, true),
+        std::make_tuple(srtyp_kSrMessageHb, srtyp_kSrMessageRetrData, srcty_kSafetyCodeTypeFullMd4, true)
+    ));
+
 /**
  * @test        @ID{srmsgTest005} Verify the createRetrReqMessage function.
  *
@@ -351,6 +351,80 @@ TEST_P(GetDataMsgPayloadWithParam, srmsgTest012VerifyGetDataMessagePayload)
     }
 }
 
+/**
+ * @test        @ID{srmsgTest020} Verify the getDataMessagePayloadView function.
+ *
+ * @details     This test verifies the correct behaviour of the getDataMessagePayloadView function. The same test parameters as for srmsgTest012 are used.
+ *
+ * Test steps:
+ * - setup test variables and expected values
+ * - initialize the module (no safety code, md4 initial values set to 0)
+ * - expect a radef_kInvalidParameter when fatal error gets thrown
+ * - create a test message with given test parameter
+ * - verify that the function can only be called for data messages
+ * - verify that the payload size is below the maximum value
+ * - verify that the payload view points to the payload inside the message
+ * - verify that the payload offset is advanced behind the application message
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         This is a value-parametrized test case which needs instantiation with defined values.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-626} Get Data Message Payload Function
+ * @verifyReq{RASW-157} Endian Definition
+ * @verifyReq{RASW-160} General PDU Message Structure
+ * @verifyReq{RASW-161} Message Type
+ * @verifyReq{RASW-191} Data Message Structure
+ * @verifyReq{RASW-196} Retransmitted Data Message Structure
+ * @verifyReq{RASW-192} Message Length
+ * @verifyReq{RASW-193} Size of Message Data
+ */
+TEST_P(GetDataMsgPayloadWithParam, srmsgTest020VerifyGetDataMessagePayloadView)
+{
+    uint16_t i = 0;     // loop iterator
+
+    // Expected Values
+    const uint8_t expected_payload_size_bytepos     = 28;               // according to RASW-191
+    const uint8_t expected_payload_bytepos          = 30;               // according to RASW-191
+
+    // test variables
+    srtyp_SrMessage message = {0, {}};
+    srtyp_SrMessagePayloadView payload_view = {0, NULL};
+    uint16_t payload_offset = 0U;
+    message.message_size = (expected_payload_bytepos + expected_data_size);
+    setDataInBuffer_u16(&message.message,(expected_payload_bytepos + expected_data_size), expected_message_length_pos);
+    setDataInBuffer_u16(&message.message, message_type, expected_message_type_pos);
+    setDataInBuffer_u16(&message.message, expected_data_size, expected_payload_size_bytepos);
+    for (i = 0; i < expected_data_size; i++) {
+        setDataInBuffer_u8(&message.message, test_data_ptr[i], (expected_payload_bytepos + i));
+    }
+
+    // initialize the module
+    srmsg_Init(srcty_kSafetyCodeTypeNone, {0, 0, 0, 0});        // no safety code and MD4 initial values set to zero
+
+    // call the function
+    if (expect_fatal_error) {
+        EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &srmsgTest::invalidArgumentException));
+        EXPECT_THROW(srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view), std::invalid_argument);
+    }
+    else {
+        EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+        srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view);
+
+        // Verify that the view points into the message and the offset is advanced behind the application message
+        EXPECT_EQ(expected_data_size, payload_view.payload_size);
+        EXPECT_EQ(expected_payload_bytepos - expected_payload_size_bytepos + expected_data_size, payload_offset);
+        EXPECT_EQ(&message.message[expected_payload_bytepos], payload_view.payload);
+        for (i = 0; i < expected_data_size; i++) {
+            EXPECT_EQ(test_data_ptr[i], payload_view.payload[i]);
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     verifyGetDataMessagePayload,
     GetDataMsgPayloadWithParam,
@@ -370,6 +444,80 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(srtyp_kSrMessageDiscReq, UT_SRMSG_DATA_LEN_MAX, true, test_payload_data_u8)
     ));
 
+/**
+ * @test        @ID{srmsgTest024} Verify the payload offset of the getDataMessagePayloadView function.
+ *
+ * @details     This test verifies that the getDataMessagePayloadView function walks through all packed application messages of a data message with the
+ *              payload offset kept by the caller and that an offset, where no application message starts, is rejected.
+ *
+ * Test steps:
+ * - initialize the module (lower MD4 safety code, md4 initial values set to 0)
+ * - create a data message with three packed application messages
+ * - get the payload views with the kept payload offset and verify payload size, payload pointer and offset of every application message
+ * - verify that the offset behind the last application message raises a radef_kInvalidParameter fatal error
+ * - verify that an offset inside the payload of an application message raises a radef_kInvalidParameter fatal error
+ * - verify that an offset outside the message raises a radef_kInvalidParameter fatal error
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-626} Get Data Message Payload Function
+ * @verifyReq{RASW-191} Data Message Structure
+ * @verifyReq{RASW-193} Size of Message Data
+ */
+TEST_F(srmsgTest, srmsgTest024VerifyGetDataMessagePayloadViewOffset)
+{
+    const uint8_t expected_payload_size_bytepos     = 28;               // according to RASW-191
+    const uint16_t payload_sizes[]                  = {1, 3, 2};        // payload sizes of the packed application messages
+    const uint16_t number_of_payloads               = 3;                // number of packed application messages
+
+    // test variables
+    srtyp_SrMessage message = {0, {}};
+    srtyp_SrMessagePayloadView payload_view = {0, NULL};
+    uint16_t payload_offset = 0U;
+
+    // create a data message with three packed application messages, every payload byte is 0xFF
+    uint16_t position = expected_payload_size_bytepos;
+    for (uint16_t i = 0; i < number_of_payloads; i++) {
+        setDataInBuffer_u16(&message.message, payload_sizes[i], position);
+        for (uint16_t j = 0; j < payload_sizes[i]; j++) {
+            setDataInBuffer_u8(&message.message, 0xFF, (position + 2 + j));
+        }
+        position = (uint16_t)(position + 2 + payload_sizes[i]);
+    }
+    message.message_size = (uint16_t)(position + UT_SRMSG_SAFETY_CODE_HALF_LEN);
+    setDataInBuffer_u16(&message.message, message.message_size, expected_message_length_pos);
+    setDataInBuffer_u16(&message.message, srtyp_kSrMessageData, expected_message_type_pos);
+
+    // initialize the module
+    srmsg_Init(srcty_kSafetyCodeTypeLowerMd4, {0, 0, 0, 0});
+    ASSERT_EQ(number_of_payloads, srmsg_GetNumberOfDataMessagePayloads(&message));
+
+    // walk through all packed application messages with the kept offset
+    uint16_t expected_offset = 0U;
+    for (uint16_t i = 0; i < number_of_payloads; i++) {
+        srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view);
+        EXPECT_EQ(payload_sizes[i], payload_view.payload_size);
+        EXPECT_EQ(&message.message[expected_payload_size_bytepos + expected_offset + 2], payload_view.payload);
+        expected_offset = (uint16_t)(expected_offset + 2 + payload_sizes[i]);
+        EXPECT_EQ(expected_offset, payload_offset);
+    }
+
+    // offsets, where no application message starts
+    const uint16_t invalid_offsets[] = {payload_offset, 5U, RADEF_MAX_SR_LAYER_PDU_MESSAGE_SIZE};
+    for (uint16_t invalid_offset : invalid_offsets) {
+        payload_offset = invalid_offset;
+        EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &srmsgTest::invalidArgumentException));
+        EXPECT_THROW(srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view), std::invalid_argument);
+        EXPECT_EQ(invalid_offset, payload_offset);
+    }
+}
+
 /**
  * @test        @ID{srmsgTest013} Verify the getConnMessageData function.
  *
@@ -73,6 +73,27 @@ class CheckMessageWithParam :   public srmsgTest,
     radef_RaStaReturnCode return_code =         std::get<6>(GetParam());        ///< expected return value
 };
 
+
+/**
+ * @brief Test class for value-parametrized update message header batch test
+ *
+ * Parameter order:
+ * - number of messages (uint16_t)
+ * - safety code type (srcty_SafetyCodeType)
+ * - expected number of MD4 batch calculations (uint16_t)
+ * - expect fatal error (bool)
+ * .
+ */
+class UpdMsgHeaderBatchWithParam :  public srmsgTest,
+                                    public testing::WithParamInterface<std::tuple<uint16_t, srcty_SafetyCodeType, uint16_t, bool>>
+{
+    public:
+    uint16_t number_of_messages =               std::get<0>(GetParam());        ///< number of messages
+    srcty_SafetyCodeType safety_code_type =     std::get<1>(GetParam());        ///< safety code type
+    uint16_t expected_md4_batches =             std::get<2>(GetParam());        ///< expected number of MD4 batch calculations
+    bool expect_fatal_error =                   std::get<3>(GetParam());        ///< expect a fatal error
+};
+
 // -----------------------------------------------------------------------------
 // Local Type Definitions
 // -----------------------------------------------------------------------------
@@ -295,6 +316,142 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(UINT32_MAX, UINT32_MAX, srcty_kSafetyCodeTypeLowerMd4, false, 0, false)
     ));
 
+/**
+ * @test        @ID{srmsgTest023} Verify the updateMessageHeaderBatch function.
+ *
+ * @details     This test verifies that the updateMessageHeaderBatch function updates the headers of all messages and calculates their safety codes in
+ *              batches of at most 8 messages.
+ *
+ * Test steps:
+ * - initialize the module with given safety code option
+ * - create test messages with different message sizes
+ * - expect a radef_kInvalidParameter when fatal error gets thrown
+ * - expect the MD4 batch calculations with the message data of every message
+ * - call the updateMessageHeaderBatch function with given test parameter
+ * - verify that the header update and the safety code of every message are set
+ * .
+ *
+ * @testParameter
+ * - Nbr messages: Number of messages to update
+ * - Safety Code Type: Configured safety code type
+ * - Nbr MD4 batches: Expected number of MD4 batch calculations
+ * - Expect fatal error: Indicates if a fatal error is expected
+ * .
+ * | Test Run | Input parameter | Test config      | Expected values                                         |||
+ * |----------|-----------------|------------------|-----------------|--------------------|------------------|
+ * |          | Nbr messages    | Safety Code Type | Nbr MD4 batches | Expect fatal error | Test Result      |
+ * | 0        | 0               | Lower MD4        | 0               | True               | Fatal error      |
+ * | 1        | 1               | Lower MD4        | 1               | False              | Normal Operation |
+ * | 2        | 8               | Lower MD4        | 1               | False              | Normal Operation |
+ * | 3        | 9               | Lower MD4        | 2               | False              | Normal Operation |
+ * | 4        | 17              | Full MD4         | 3               | False              | Normal Operation |
+ * | 5        | 9               | None             | 0               | False              | Normal Operation |
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         This is a value-parametrized test case which needs instantiation with defined values.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-630} Update Message Header Function
+ * @verifyReq{RASW-165} Confirmed Sequence Number
+ * @verifyReq{RASW-166} Time Stamp
+ * @verifyReq{RASW-168} Safety Code
+ */
+TEST_P(UpdMsgHeaderBatchWithParam, srmsgTest023VerifyUpdateMessageHeaderBatch)
+{
+    const uint16_t max_messages = 17;                                   // maximum number of messages of the test
+    const uint16_t md4_batch_size = 8;                                  // maximum number of messages per MD4 batch calculation
+    const srcty_Md4InitValue expected_md4_init_value = {0x11223344, 0x55667788, 0x9900AABB, 0xCCDDEEFF};
+
+    uint16_t expected_safety_code_length = UT_SRMSG_SAFETY_CODE_NONE_LEN;
+    if (safety_code_type == srcty_kSafetyCodeTypeLowerMd4) {
+        expected_safety_code_length = UT_SRMSG_SAFETY_CODE_HALF_LEN;
+    }
+    else if (safety_code_type == srcty_kSafetyCodeTypeFullMd4) {
+        expected_safety_code_length = UT_SRMSG_SAFETY_CODE_MAX_LEN;
+    }
+
+    // create test messages with different sizes
+    srtyp_SrMessage messages[max_messages] = {};
+    srtyp_SrMessageHeaderUpdate message_header_updates[max_messages] = {};
+    for (uint16_t i = 0; i < max_messages; i++) {
+        messages[i].message_size = (uint16_t)(UT_SRMSG_HEADER_SIZE + expected_safety_code_length + (i * 3));
+        for (uint16_t j = 0; j < messages[i].message_size; j++) {
+            messages[i].message[j] = (uint8_t)(i + j);
+        }
+        message_header_updates[i].confirmed_sequence_number = 0x10000000U + i;
+        message_header_updates[i].time_stamp = 0x20000000U + i;
+    }
+
+    // initialize the module
+    srmsg_Init(safety_code_type, expected_md4_init_value);
+
+    if (expect_fatal_error) {
+        EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillOnce(Invoke(this, &srmsgTest::invalidArgumentException));
+        EXPECT_THROW(srmsg_UpdateMessageHeaderBatch(number_of_messages, message_header_updates, messages), std::invalid_argument);
+    }
+    else {
+        // Expect MD4 batch calculations, the calculated MD4 of a message is derived from its data size
+        InSequence s;
+        uint16_t remaining_messages = number_of_messages;
+        for (uint16_t batch = 0; batch < expected_md4_batches; batch++) {
+            const uint16_t batch_size = (remaining_messages < md4_batch_size) ? remaining_messages : md4_batch_size;
+            const uint16_t first_message = batch * md4_batch_size;
+            remaining_messages -= batch_size;
+            EXPECT_CALL(srmd4_mock, srmd4_CalculateMd4Batch(_, batch_size, _))
+                .WillOnce(Invoke([&, batch_size, first_message](const srcty_Md4InitValue md4_initial_value, const uint16_t number_of_entries,
+                                                                 const srmd4_Md4BatchEntry * entries) {
+                    EXPECT_EQ(expected_md4_init_value.init_a, md4_initial_value.init_a);
+                    EXPECT_EQ(expected_md4_init_value.init_d, md4_initial_value.init_d);
+                    for (uint16_t entry = 0; entry < number_of_entries; entry++) {
+                        const srtyp_SrMessage & message = messages[first_message + entry];
+                        EXPECT_EQ(message.message_size - expected_safety_code_length, entries[entry].data_size);
+                        EXPECT_EQ(&message.message[0], entries[entry].data_buffer);
+                        // The header update must be set before the safety code is calculated
+                        EXPECT_EQ(message_header_updates[first_message + entry].time_stamp, getDataFromBuffer_u32(&message.message, expected_timestamp_pos));
+                        for (uint16_t i = 0; i < UT_SRMSG_SAFETY_CODE_MAX_LEN; i++) {
+                            entries[entry].calculated_md4->md4[i] = (uint8_t)(entries[entry].data_size + i);
+                        }
+                    }
+                }));
+        }
+        EXPECT_CALL(srmd4_mock, srmd4_CalculateMd4(_, _, _, _)).Times(0);
+        EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+        // call the function
+        srmsg_UpdateMessageHeaderBatch(number_of_messages, message_header_updates, messages);
+
+        // verify the header update and the safety code of every message
+        for (uint16_t i = 0; i < number_of_messages; i++) {
+            const uint16_t data_size = messages[i].message_size - expected_safety_code_length;
+            EXPECT_EQ(message_header_updates[i].confirmed_sequence_number, getDataFromBuffer_u32(&messages[i].message, expected_conf_seq_nbr_pos));
+            EXPECT_EQ(message_header_updates[i].time_stamp, getDataFromBuffer_u32(&messages[i].message, expected_timestamp_pos));
+            EXPECT_EQ((uint8_t)i, getDataFromBuffer_u8(&messages[i].message, expected_message_length_pos));
+            for (uint16_t j = 0; j < expected_safety_code_length; j++) {
+                EXPECT_EQ((uint8_t)(data_size + j), getDataFromBuffer_u8(&messages[i].message, (data_size + j)));
+            }
+        }
+        // messages behind the batch must not be changed
+        for (uint16_t i = number_of_messages; i < max_messages; i++) {
+            EXPECT_EQ((uint8_t)(i + expected_conf_seq_nbr_pos), getDataFromBuffer_u8(&messages[i].message, expected_conf_seq_nbr_pos));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    verifyUpdateMessageHeaderBatch,
+    UpdMsgHeaderBatchWithParam,
+    ::testing::Values(
+        std::make_tuple(0, srcty_kSafetyCodeTypeLowerMd4, 0, true),
+        std::make_tuple(1, srcty_kSafetyCodeTypeLowerMd4, 1, false),
+        std::make_tuple(8, srcty_kSafetyCodeTypeLowerMd4, 1, false),
+        std::make_tuple(9, srcty_kSafetyCodeTypeLowerMd4, 2, false),
+        std::make_tuple(17, srcty_kSafetyCodeTypeFullMd4, 3, false),
+        std::make_tuple(9, srcty_kSafetyCodeTypeNone, 0, false)
+    ));
+
 /**
  * @test        @ID{srmsgTest010} Verify the checkMessage function.
  *
@@ -110,9 +110,6 @@ class InitBufferTestWithParam : public srreceTest,
  */
 TEST_P(InitTestWithParam, srreceTest001VerifyInitFunction)
 {
-    extern uint32_t srrece_number_of_connections;
-    extern uint16_t srrece_n_send_max;
-
     if (expect_fatal_error)
     {
         // call the init function and expect a fatal error
@@ -125,9 +122,9 @@ TEST_P(InitTestWithParam, srreceTest001VerifyInitFunction)
         EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
         EXPECT_NO_THROW(srrece_Init(configured_connections, exp_n_send_max));
 
-        EXPECT_EQ(srrece_number_of_connections, configured_connections);
-        EXPECT_EQ(srrece_n_send_max, exp_n_send_max);
-        EXPECT_TRUE(srrece_initialized);
+        EXPECT_EQ(srrece_instance->number_of_connections, configured_connections);
+        EXPECT_EQ(srrece_instance->n_send_max, exp_n_send_max);
+        EXPECT_TRUE(srrece_instance->initialized);
     }
 }
 
@@ -204,8 +201,8 @@ TEST_P(InitBufferTestWithParam, srreceTest002VerifyInitBufferFunction)
     else
     {
         // add a message to the buffer to increment buffer size
-        EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(connection_id)).Times(1);
-        srrece_AddToBuffer(connection_id, &dummy_payload);
+        EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(&test_instance, connection_id)).Times(1);
+        srrece_AddToBuffer(connection_id, payloadView(dummy_payload));
 
         // verify that the buffer size is set to 1
         EXPECT_EQ(1, srrece_GetUsedBufferEntries(connection_id));
@@ -269,6 +266,7 @@ TEST_F(srreceTest, srreceTest003VerifyInitFunctionCalls)
  *
  * Test steps:
  * - call the AddToBuffer function and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the AddToBuffer function with a payload view without payload pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the ReadFromBuffer function and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * .
  *
@@ -286,7 +284,7 @@ TEST_F(srreceTest, srreceTest003VerifyInitFunctionCalls)
  */
 TEST_F(srreceTest, srreceTest004VerifyNullPointerCheck)
 {
-    uint8_t nbr_of_function_calls = 2;          // number of function calls
+    uint8_t nbr_of_function_calls = 3;          // number of function calls
 
     // Test variables
     uint32_t connection_id_index = UT_SRRECE_MIN_NUM_CONN;
@@ -300,7 +298,10 @@ TEST_F(srreceTest, srreceTest004VerifyNullPointerCheck)
     srrece_Init(UT_SRRECE_MIN_NUM_CONN, UT_SRRECE_NSENDMAX_MIN);
 
     // call the functions
-    EXPECT_THROW(srrece_AddToBuffer(connection_id_index, (srtyp_SrMessagePayload *)NULL), std::invalid_argument);
+    EXPECT_THROW(srrece_AddToBuffer(connection_id_index, (srtyp_SrMessagePayloadView *)NULL), std::invalid_argument);
+    payload_view.payload_size = UT_SRRECE_DATA_LEN_MIN;
+    payload_view.payload = (const uint8_t *)NULL;
+    EXPECT_THROW(srrece_AddToBuffer(UT_SRRECE_MIN_IDX_CONN, &payload_view), std::invalid_argument);
     EXPECT_THROW(srrece_ReadFromBuffer(connection_id_index, (srtyp_SrMessagePayload *)NULL), std::invalid_argument);
 }
 
@@ -349,13 +350,56 @@ TEST_F(srreceTest, srreceTest005VerifyInitializationCheck)
 
     // call the functions without initializing the module
     EXPECT_THROW(srrece_InitBuffer(connection_id_index), std::invalid_argument);
-    EXPECT_THROW(srrece_AddToBuffer(connection_id_index, &message_payload), std::invalid_argument);
+    EXPECT_THROW(srrece_AddToBuffer(connection_id_index, payloadView(message_payload)), std::invalid_argument);
     EXPECT_THROW(srrece_ReadFromBuffer(connection_id_index, &message_payload), std::invalid_argument);
     EXPECT_THROW(srrece_GetFreeBufferEntries(connection_id_index), std::invalid_argument);
     EXPECT_THROW(srrece_GetUsedBufferEntries(connection_id_index), std::invalid_argument);
     EXPECT_THROW(srrece_GetPayloadSizeOfNextMessageToRead(connection_id_index), std::invalid_argument);
 }
 
+/**
+ * @test        @ID{srreceTest014} Verify the GetConnectionMemorySize function.
+ *
+ * @details     This test verifies that the GetConnectionMemorySize function returns the size of the connection memory
+ *              which is allocated by the init function.
+ *
+ * Test steps:
+ * - call the GetConnectionMemorySize function with an invalid number of connections and expect a fatal error
+ * - for the minimum and maximum number of connections:
+ *   - reset the connection memory module
+ *   - call the init function and verify that the allocated connection memory matches the returned size
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-611} Init sr_received_buffer Function
+ */
+TEST_F(srreceTest, srreceTest014VerifyGetConnectionMemorySizeFunction)
+{
+    // invalid number of connections
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(2).WillRepeatedly(Invoke(this, &srreceTest::invalidArgumentException));
+    EXPECT_THROW(srrece_GetConnectionMemorySize(UT_SRRECE_MIN_NUM_CONN - 1), std::invalid_argument);
+    EXPECT_THROW(srrece_GetConnectionMemorySize(UT_SRRECE_MAX_NUM_CONN + 1), std::invalid_argument);
+
+    for (uint32_t configured_connections = UT_SRRECE_MIN_NUM_CONN; configured_connections <= UT_SRRECE_MAX_NUM_CONN; configured_connections++)
+    {
+        // reset the modules
+        srrece_instance->initialized = false;
+        srmem_instance->initialized = false;
+        srmem_Init(connection_memory, sizeof(connection_memory));
+
+        // verify the allocated connection memory
+        srrece_Init(configured_connections, UT_SRRECE_NSENDMAX_MAX);
+        EXPECT_EQ(srrece_GetConnectionMemorySize(configured_connections), srmem_instance->allocated_size);
+        EXPECT_EQ(0U, (srmem_instance->allocated_size % SRATY_CONNECTION_MEMORY_ALIGNMENT));
+    }
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -26,8 +26,12 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "src/srrece_sr_received_buffer.h"
+#include "src/srmem_sr_connection_memory.h"
 #include "rasta_common/raas_rasta_assert.h"
+#include "rasta_common/raslb_rasta_slab.h"
+#include "rasta_safety_retransmission/srcty_sr_config_types.h"
 #include "rasys_mock.hh"
+#include "srins_mock.hh"
 #include "srnot_mock.hh"
 // clang-format on
 
@@ -52,6 +56,7 @@ using testing::Throw;
 #define UT_SRRECE_NSENDMAX_MAX 20       ///< maximum value for nSendMax
 #define UT_SRRECE_DATA_LEN_MIN 1        ///< minimum payload length of a data message
 #define UT_SRRECE_DATA_LEN_MAX 1055     ///< maximum payload length of a data message
+#define UT_SRRECE_CONNECTION_MEMORY_SIZE 65536  ///< size of the connection memory [bytes]
 
 // -----------------------------------------------------------------------------
 // Local Variable Definitions
@@ -59,7 +64,9 @@ using testing::Throw;
 
 extern uint8_t test_payload_data_u8[UT_SRRECE_DATA_LEN_MAX];
 
-extern bool srrece_initialized;                            ///< initialization state (local variable)
+extern RADEF_THREAD_LOCAL srrece_InstanceData *srrece_instance;               ///< data of the selected received buffer module instance
+extern RADEF_THREAD_LOCAL raslb_InstanceData *raslb_instance;                 ///< data of the selected message slab module instance
+extern RADEF_THREAD_LOCAL srmem_InstanceData *srmem_instance;                 ///< data of the selected connection memory module instance
 
 // -----------------------------------------------------------------------------
 // Test class definiton
@@ -75,7 +82,15 @@ public:
     srreceTest()
     {
         // reset initialization state
-        srrece_initialized = false;
+        srrece_instance->initialized = false;
+        raslb_instance->initialized = false;
+        srmem_instance->initialized = false;
+        // initialize message slab module
+        raslb_Init(&srcty_kSlabConfiguration);
+        // initialize connection memory module
+        srmem_Init(connection_memory, sizeof(connection_memory));
+        // the notifications are called with the selected SafRetL instance
+        EXPECT_CALL(srins_mock, srins_GetSelectedInstance()).WillRepeatedly(Return(&test_instance));
     }
     ~srreceTest()
     {
@@ -90,8 +105,26 @@ public:
         throw std::invalid_argument("Invalid argument!");
     }
 
+    /**
+     * @brief Get a read-only view of a message payload
+     * This function sets the payload view of the fixture to the passed message payload and returns a pointer to it.
+     *
+     * @param payload message payload to point to
+     * @return pointer to the payload view
+     */
+    const srtyp_SrMessagePayloadView * payloadView(const srtyp_SrMessagePayload & payload){
+        payload_view.payload_size = payload.payload_size;
+        payload_view.payload = payload.payload;
+        return &payload_view;
+    }
+
+    uint64_t connection_memory[UT_SRRECE_CONNECTION_MEMORY_SIZE / sizeof(uint64_t)];  ///< connection memory for the received buffers
+    srapi_Instance test_instance = {};  ///< SafRetL instance, which is passed to the notifications
+
     StrictMock<rasysMock>   rasys_mock;     ///< mock for the rasta system adapter class
+    NaggyMock<srinsMock>    srins_mock;     ///< mock for the rasta safety and retransmission instances class
     NaggyMock<srnotMock>    srnot_mock;     ///< mock for the rasta safety and retransmission notifications class
+    srtyp_SrMessagePayloadView payload_view;  ///< payload view passed to the AddToBuffer function
 };
 
 #endif  // SOURCE_MODULES_RASTA_SAFETY_RETRANSMISSION_TESTS_UNIT_TESTS_TEST_SRRECE_UNIT_TEST_SRRECE_HH_
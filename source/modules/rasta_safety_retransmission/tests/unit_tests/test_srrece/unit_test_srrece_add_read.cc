@@ -206,14 +206,14 @@ TEST_P(AddToBufferTestWithParam, srreceTest006VerifyAddToBufferFunction)
     }
     else
     {
-        srrece_initialized = true;
+        srrece_instance->initialized = true;
     }
 
     if (error != radef_kNoError)
     {
         // call the addToBuffer function and expect a fatal error
         EXPECT_CALL(rasys_mock, rasys_FatalError(error)).WillOnce(Invoke(this, &srreceTest::invalidArgumentException));
-        EXPECT_THROW(srrece_AddToBuffer(connection_id, &payload), std::invalid_argument);
+        EXPECT_THROW(srrece_AddToBuffer(connection_id, payloadView(payload)), std::invalid_argument);
     }
     else
     {
@@ -222,11 +222,11 @@ TEST_P(AddToBufferTestWithParam, srreceTest006VerifyAddToBufferFunction)
         EXPECT_EQ((n_send_max - exp_buffer_length + 1), srrece_GetFreeBufferEntries(connection_id));
 
         // expect the message received notification to be sent
-        EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(connection_id)).Times(1);
+        EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(&test_instance, connection_id)).Times(1);
 
         // call the AddToBuffer function
         EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
-        EXPECT_NO_THROW(srrece_AddToBuffer(connection_id, &payload));
+        EXPECT_NO_THROW(srrece_AddToBuffer(connection_id, payloadView(payload)));
 
         // verify the buffer length and number of free entries after the add
         EXPECT_EQ(exp_buffer_length, srrece_GetUsedBufferEntries(connection_id));
@@ -349,8 +349,8 @@ TEST_P(ReadFromBufferTestWithParam, srreceTest007VerifyReadFromBufferFunction)
         if (do_add_message)
         {
             // add a message to the buffer
-            EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(connection_id)).Times(1);
-            srrece_AddToBuffer(connection_id, &payload);
+            EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(&test_instance, connection_id)).Times(1);
+            srrece_AddToBuffer(connection_id, payloadView(payload));
 
             // verify the buffer length and number of free entries before the read
             EXPECT_EQ(1, srrece_GetUsedBufferEntries(connection_id));
@@ -450,10 +450,10 @@ TEST_P(CompleteBufferTestWithParam, srreceTest008VerifyCompleteBuffer)
     srrece_Init(UT_SRRECE_MAX_NUM_CONN, UT_SRRECE_NSENDMAX_MAX);
 
     // add the maximum number of messages to the buffer
-    EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(connection_id)).Times(UT_SRRECE_NSENDMAX_MAX);
+    EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(&test_instance, connection_id)).Times(UT_SRRECE_NSENDMAX_MAX);
     for (i = 0; i < UT_SRRECE_NSENDMAX_MAX; i++)
     {
-        srrece_AddToBuffer(connection_id, &(add_payload[i]));
+        srrece_AddToBuffer(connection_id, payloadView(add_payload[i]));
     }
 
     // verify that the buffer is full
@@ -542,29 +542,29 @@ TEST_F(srreceTest, srreceTest009VerifyInterleavedAddRead)
     srrece_Init(UT_SRRECE_MAX_NUM_CONN, n_send_max);
 
     // add messages to the buffer and read them back, interleaved and on both connections
-    EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(connection_id_idx_0)).Times(number_of_adds);
-    EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(connection_id_idx_1)).Times(number_of_adds);
+    EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(&test_instance, connection_id_idx_0)).Times(number_of_adds);
+    EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(&test_instance, connection_id_idx_1)).Times(number_of_adds);
 
-    srrece_AddToBuffer(connection_id_idx_0, &(add_payload0[0]));
-    srrece_AddToBuffer(connection_id_idx_1, &(add_payload1[0]));
-    srrece_AddToBuffer(connection_id_idx_1, &(add_payload1[1]));
-    srrece_AddToBuffer(connection_id_idx_0, &(add_payload0[1]));
-    srrece_AddToBuffer(connection_id_idx_0, &(add_payload0[2]));
+    srrece_AddToBuffer(connection_id_idx_0, payloadView(add_payload0[0]));
+    srrece_AddToBuffer(connection_id_idx_1, payloadView(add_payload1[0]));
+    srrece_AddToBuffer(connection_id_idx_1, payloadView(add_payload1[1]));
+    srrece_AddToBuffer(connection_id_idx_0, payloadView(add_payload0[1]));
+    srrece_AddToBuffer(connection_id_idx_0, payloadView(add_payload0[2]));
 
     EXPECT_EQ(radef_kNoError, srrece_ReadFromBuffer(connection_id_idx_1, &(read_payload1[0])));
     EXPECT_EQ(radef_kNoError, srrece_ReadFromBuffer(connection_id_idx_0, &(read_payload0[0])));
     EXPECT_EQ(radef_kNoError, srrece_ReadFromBuffer(connection_id_idx_0, &(read_payload0[1])));
 
-    srrece_AddToBuffer(connection_id_idx_1, &(add_payload1[2]));
-    srrece_AddToBuffer(connection_id_idx_0, &(add_payload0[3]));
+    srrece_AddToBuffer(connection_id_idx_1, payloadView(add_payload1[2]));
+    srrece_AddToBuffer(connection_id_idx_0, payloadView(add_payload0[3]));
 
     EXPECT_EQ(radef_kNoError, srrece_ReadFromBuffer(connection_id_idx_0, &(read_payload0[2])));
     EXPECT_EQ(radef_kNoError, srrece_ReadFromBuffer(connection_id_idx_1, &(read_payload1[1])));
     EXPECT_EQ(radef_kNoError, srrece_ReadFromBuffer(connection_id_idx_1, &(read_payload1[2])));
 
-    srrece_AddToBuffer(connection_id_idx_0, &(add_payload0[4]));
-    srrece_AddToBuffer(connection_id_idx_1, &(add_payload1[3]));
-    srrece_AddToBuffer(connection_id_idx_1, &(add_payload1[4]));
+    srrece_AddToBuffer(connection_id_idx_0, payloadView(add_payload0[4]));
+    srrece_AddToBuffer(connection_id_idx_1, payloadView(add_payload1[3]));
+    srrece_AddToBuffer(connection_id_idx_1, payloadView(add_payload1[4]));
 
     EXPECT_EQ(radef_kNoError, srrece_ReadFromBuffer(connection_id_idx_0, &(read_payload0[3])));
     EXPECT_EQ(radef_kNoError, srrece_ReadFromBuffer(connection_id_idx_1, &(read_payload1[3])));
@@ -648,8 +648,8 @@ TEST_P(GetNextPayloadSizeTestWithParam, srreceTest012VerifyGetPayloadSizeOfNextM
         if (do_add_message)
         {
             // add a message to the buffer
-            EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(connection_id)).Times(1);
-            srrece_AddToBuffer(connection_id, &payload);
+            EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(&test_instance, connection_id)).Times(1);
+            srrece_AddToBuffer(connection_id, payloadView(payload));
         }
 
         // call the GetPayloadSizeOfNextMessageToRead function
@@ -671,6 +671,96 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(UT_SRRECE_MIN_NUM_CONN, 1, UT_SRRECE_DATA_LEN_MAX, false, true, 0)
     ));
 
+/**
+ * @test        @ID{srreceTest013} Verify the PeekFromBuffer and ReleaseFromBuffer functions.
+ *
+ * @details     This test verifies that a message payload can be accessed in place and is only removed from the buffer when it is released.
+ *
+ * Test steps:
+ * - call the functions without initialization and verify that a fatal error is thrown
+ * - initialize the module
+ * - call the functions with an invalid connection id and a NULL pointer and verify that a fatal error is thrown
+ * - peek and release on an empty buffer and verify that no message is returned
+ * - add two message payloads to the buffer
+ * - peek twice and verify that the view points to the same, unchanged first payload and that the buffer entries are unchanged
+ * - release the first payload and verify the buffer entries
+ * - peek and verify the second payload, then read it with ReadFromBuffer and verify that the buffer is empty
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No preconditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-613} Read from Buffer Function
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srreceTest, srreceTest013VerifyPeekAndReleaseFunctions)
+{
+    const uint32_t connection_id = UT_SRRECE_MAX_IDX_CONN;
+    srtyp_SrMessagePayload first_payload = {UT_SRRECE_DATA_LEN_MAX, {}};
+    srtyp_SrMessagePayload second_payload = {UT_SRRECE_DATA_LEN_MIN, {}};
+    srtyp_SrMessagePayloadView view = {0, nullptr};
+    srtyp_SrMessagePayload read_payload = {0, {}};
+
+    for (uint16_t i = 0; i < UT_SRRECE_DATA_LEN_MAX; i++)
+    {
+        first_payload.payload[i] = test_payload_data_u8[i];
+    }
+    second_payload.payload[0] = test_payload_data_u8[UT_SRRECE_DATA_LEN_MAX - 1];
+
+    // not initialized
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kNotInitialized)).Times(2).WillRepeatedly(Invoke(this, &srreceTest::invalidArgumentException));
+    EXPECT_THROW(srrece_PeekFromBuffer(connection_id, &view), std::invalid_argument);
+    EXPECT_THROW(srrece_ReleaseFromBuffer(connection_id), std::invalid_argument);
+
+    srrece_Init(UT_SRRECE_MAX_NUM_CONN, UT_SRRECE_NSENDMAX_MAX);
+
+    // invalid parameters
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(3).WillRepeatedly(Invoke(this, &srreceTest::invalidArgumentException));
+    EXPECT_THROW(srrece_PeekFromBuffer(UT_SRRECE_MAX_NUM_CONN, &view), std::invalid_argument);
+    EXPECT_THROW(srrece_PeekFromBuffer(connection_id, nullptr), std::invalid_argument);
+    EXPECT_THROW(srrece_ReleaseFromBuffer(UT_SRRECE_MAX_NUM_CONN), std::invalid_argument);
+
+    // empty buffer
+    EXPECT_EQ(radef_kNoMessageReceived, srrece_PeekFromBuffer(connection_id, &view));
+    EXPECT_EQ(radef_kNoMessageReceived, srrece_ReleaseFromBuffer(connection_id));
+
+    // add two payloads
+    EXPECT_CALL(srnot_mock, srnot_MessageReceivedNotification(&test_instance, connection_id)).Times(2);
+    srrece_AddToBuffer(connection_id, payloadView(first_payload));
+    srrece_AddToBuffer(connection_id, payloadView(second_payload));
+
+    // peek does not remove the payload
+    EXPECT_EQ(radef_kNoError, srrece_PeekFromBuffer(connection_id, &view));
+    const uint8_t * const first_view_payload = view.payload;
+    EXPECT_EQ(radef_kNoError, srrece_PeekFromBuffer(connection_id, &view));
+    EXPECT_EQ(first_view_payload, view.payload);
+    ASSERT_EQ(first_payload.payload_size, view.payload_size);
+    for (uint16_t i = 0; i < view.payload_size; i++)
+    {
+        EXPECT_EQ(first_payload.payload[i], view.payload[i]);
+    }
+    EXPECT_EQ(2, srrece_GetUsedBufferEntries(connection_id));
+
+    // release the first payload
+    EXPECT_EQ(radef_kNoError, srrece_ReleaseFromBuffer(connection_id));
+    EXPECT_EQ(1, srrece_GetUsedBufferEntries(connection_id));
+    EXPECT_EQ(UT_SRRECE_NSENDMAX_MAX - 1, srrece_GetFreeBufferEntries(connection_id));
+
+    // peek and read the second payload
+    EXPECT_EQ(radef_kNoError, srrece_PeekFromBuffer(connection_id, &view));
+    ASSERT_EQ(second_payload.payload_size, view.payload_size);
+    EXPECT_EQ(second_payload.payload[0], view.payload[0]);
+    EXPECT_EQ(radef_kNoError, srrece_ReadFromBuffer(connection_id, &read_payload));
+    EXPECT_EQ(second_payload.payload_size, read_payload.payload_size);
+    EXPECT_EQ(second_payload.payload[0], read_payload.payload[0]);
+    EXPECT_EQ(0, srrece_GetUsedBufferEntries(connection_id));
+    EXPECT_EQ(radef_kNoMessageReceived, srrece_PeekFromBuffer(connection_id, &view));
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -116,8 +116,6 @@ class BufferStateTestWithParam :    public srsendTest,
  */
 TEST_P(InitTestWithParam, srsendTest001VerifyInitFunction)
 {
-    extern uint32_t srsend_number_of_connections;
-
     if (expect_fatal_error)
     {
         // call the init function and expect a fatal error
@@ -130,8 +128,8 @@ TEST_P(InitTestWithParam, srsendTest001VerifyInitFunction)
         EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
         EXPECT_NO_THROW(srsend_Init(configured_connections));
 
-        EXPECT_EQ(srsend_number_of_connections, configured_connections);
-        EXPECT_TRUE(srsend_initialized);
+        EXPECT_EQ(srsend_instance->number_of_connections, configured_connections);
+        EXPECT_TRUE(srsend_instance->initialized);
     }
 }
 
@@ -254,6 +252,7 @@ TEST_F(srsendTest, srsendTest003VerifyInitFunctionCalls)
  * - initialize the module
  * - set expectation for the fatal error mock
  * - call the AddToBuffer function with NULL pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - call the AddPayloadToLastMessage function with NULL pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the ReadMessageToSend function with NULL pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * - call the PrepareBufferForRetr function with NULL pointer and verify that a fatal error with error code radef_kInvalidParameter gets thrown
  * .
@@ -273,7 +272,7 @@ TEST_F(srsendTest, srsendTest003VerifyInitFunctionCalls)
  */
 TEST_F(srsendTest, srsendTest004VerifyNullPointerCheck)
 {
-    const uint8_t nbr_of_function_calls = 3;        // number of function calls
+    const uint8_t nbr_of_function_calls = 4;        // number of function calls
 
     // Test variables
     uint32_t connection_id = UT_SRSEND_MIN_NUM_CONN;
@@ -290,6 +289,7 @@ TEST_F(srsendTest, srsendTest004VerifyNullPointerCheck)
 
     // call the functions
     EXPECT_THROW(srsend_AddToBuffer(connection_id, (srtyp_SrMessage *)NULL), std::invalid_argument);
+    EXPECT_THROW(srsend_AddPayloadToLastMessage(connection_id, srcty_kMaxNMaxPacket, (srtyp_SrMessagePayload *)NULL), std::invalid_argument);
     EXPECT_THROW(srsend_ReadMessageToSend(connection_id, (srtyp_SrMessage *)NULL), std::invalid_argument);
     EXPECT_THROW(srsend_PrepareBufferForRetr(connection_id, sequence_number_for_retransmission, create_header, (uint32_t *)NULL), std::invalid_argument);
 }
@@ -303,6 +303,7 @@ TEST_F(srsendTest, srsendTest004VerifyNullPointerCheck)
  * Test steps:
  * - call the InitBuffer function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the AddToBuffer function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
+ * - call the AddPayloadToLastMessage function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the ReadMessageToSend function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the PrepareBufferForRetr function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
  * - call the IsSequenceNumberInBuffer function without prior initialization and verify that a fatal error with error code radef_kNotInitialized gets thrown
@@ -332,13 +333,13 @@ TEST_F(srsendTest, srsendTest004VerifyNullPointerCheck)
  */
 TEST_F(srsendTest, srsendTest005VerifyInitializationCheck)
 {
-    uint8_t nbr_of_function_calls = 9;        // number of function calls
-    extern bool srsend_initialized;
-    srsend_initialized = false;
+    uint8_t nbr_of_function_calls = 10;       // number of function calls
+    srsend_instance->initialized = false;
 
     // Test variables
     uint32_t connection_id_index = 0;
     srtyp_SrMessage message = {};
+    srtyp_SrMessagePayload message_payload = {};
     uint32_t sequence_number = 0;
     srtyp_SrMessageHeaderCreate message_header_create = {};
 
@@ -350,6 +351,7 @@ TEST_F(srsendTest, srsendTest005VerifyInitializationCheck)
     // call the functions without initializing the module
     EXPECT_THROW(srsend_InitBuffer(connection_id_index), std::invalid_argument);
     EXPECT_THROW(srsend_AddToBuffer(connection_id_index, &message), std::invalid_argument);
+    EXPECT_THROW(srsend_AddPayloadToLastMessage(connection_id_index, srcty_kMaxNMaxPacket, &message_payload), std::invalid_argument);
     EXPECT_THROW(srsend_ReadMessageToSend(connection_id_index, &message), std::invalid_argument);
     EXPECT_THROW(srsend_PrepareBufferForRetr(connection_id_index, sequence_number, message_header_create, &sequence_number), std::invalid_argument);
     EXPECT_THROW(srsend_IsSequenceNumberInBuffer(connection_id_index, sequence_number), std::invalid_argument);
@@ -417,6 +419,49 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(UT_SRSEND_MAX_NUM_CONN, 2)
     ));
 
+/**
+ * @test        @ID{srsendTest019} Verify the GetConnectionMemorySize function.
+ *
+ * @details     This test verifies that the GetConnectionMemorySize function returns the size of the connection memory
+ *              which is allocated by the init function.
+ *
+ * Test steps:
+ * - call the GetConnectionMemorySize function with an invalid number of connections and expect a fatal error
+ * - for the minimum and maximum number of connections:
+ *   - reset the connection memory module
+ *   - call the init function and verify that the allocated connection memory matches the returned size
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-600} Init sr_send_buffer Function
+ */
+TEST_F(srsendTest, srsendTest019VerifyGetConnectionMemorySizeFunction)
+{
+    // invalid number of connections
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(2).WillRepeatedly(Invoke(this, &srsendTest::invalidArgumentException));
+    EXPECT_THROW(srsend_GetConnectionMemorySize(UT_SRSEND_MIN_NUM_CONN - 1), std::invalid_argument);
+    EXPECT_THROW(srsend_GetConnectionMemorySize(UT_SRSEND_MAX_NUM_CONN + 1), std::invalid_argument);
+
+    for (uint32_t configured_connections = UT_SRSEND_MIN_NUM_CONN; configured_connections <= UT_SRSEND_MAX_NUM_CONN; configured_connections++)
+    {
+        // reset the modules
+        srsend_instance->initialized = false;
+        srmem_instance->initialized = false;
+        srmem_Init(connection_memory, sizeof(connection_memory));
+
+        // verify the allocated connection memory
+        srsend_Init(configured_connections);
+        EXPECT_EQ(srsend_GetConnectionMemorySize(configured_connections), srmem_instance->allocated_size);
+        EXPECT_EQ(0U, (srmem_instance->allocated_size % SRATY_CONNECTION_MEMORY_ALIGNMENT));
+    }
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
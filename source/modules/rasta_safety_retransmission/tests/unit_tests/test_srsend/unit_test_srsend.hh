@@ -26,6 +26,7 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "src/srsend_sr_send_buffer.h"
+#include "src/srmem_sr_connection_memory.h"
 #include "rasta_common/raas_rasta_assert.h"
 #include "src/srmsg_sr_messages.h"
 #include "rasys_mock.hh"
@@ -53,6 +54,7 @@ using testing::NaggyMock;
 #define UT_SRSEND_NSENDMAX_MAX 20           ///< maximum value for nSendMax
 #define UT_SRSEND_MESSAGE_LEN_MAX 1101      ///< maximum message length (full data message with full MD4)
 #define UT_SRSEND_DATA_LEN_MAX 1055         ///< maximum value for payload data length
+#define UT_SRSEND_CONNECTION_MEMORY_SIZE 65536  ///< size of the connection memory [bytes]
 
 // -----------------------------------------------------------------------------
 // Local Variable Definitions
@@ -60,8 +62,10 @@ using testing::NaggyMock;
 
 extern uint8_t test_message_data_u8[UT_SRSEND_MESSAGE_LEN_MAX];
 
-extern bool srsend_initialized;                         ///< initialization state of the send buffer module
-extern bool srmsg_initialized;                          ///< initialization state of the messages module
+extern RADEF_THREAD_LOCAL srsend_InstanceData *srsend_instance;            ///< data of the selected send buffer module instance
+extern RADEF_THREAD_LOCAL srmsg_InstanceData *srmsg_instance;              ///< data of the selected messages module instance
+extern RADEF_THREAD_LOCAL raslb_InstanceData *raslb_instance;              ///< data of the selected message slab module instance
+extern RADEF_THREAD_LOCAL srmem_InstanceData *srmem_instance;              ///< data of the selected connection memory module instance
 
 // -----------------------------------------------------------------------------
 // Test class definiton
@@ -77,10 +81,16 @@ public:
     srsendTest()
     {
         // reset initialization state
-        srsend_initialized = false;
-        srmsg_initialized = false;
+        srsend_instance->initialized = false;
+        srmsg_instance->initialized = false;
+        raslb_instance->initialized = false;
+        srmem_instance->initialized = false;
         // initialize messages module
         srmsg_Init(srcty_kSafetyCodeTypeFullMd4, {0, 0, 0, 0});
+        // initialize message slab module
+        raslb_Init(&srcty_kSlabConfiguration);
+        // initialize connection memory module
+        srmem_Init(connection_memory, sizeof(connection_memory));
     }
     ~srsendTest()
     {
@@ -115,6 +125,8 @@ public:
         throw std::invalid_argument("Invalid argument!");
     }
 
+    uint64_t connection_memory[UT_SRSEND_CONNECTION_MEMORY_SIZE / sizeof(uint64_t)];  ///< connection memory for the send buffers
+
     StrictMock<rasysMock>   rasys_mock;         ///< mock for the rasta system adapter class
 };
 
@@ -199,7 +199,7 @@ TEST_P(AddToBufferTestWithParam, srsendTest006VerifyAddToBufferFunction)
     }
     else
     {
-        srsend_initialized = true;
+        srsend_instance->initialized = true;
     }
 
     if (error != radef_kNoError)
@@ -354,7 +354,7 @@ TEST_P(ReadMessageToSendTestWithParam, srsendTest007VerifyReadFromBufferFunction
     }
     else
     {
-        srsend_initialized = true;
+        srsend_instance->initialized = true;
     }
 
     if (expect_fatal_error)
@@ -656,6 +656,191 @@ TEST_F(srsendTest, srsendTest009VerifyInterleavedAddRead)
     }
 }
 
+/**
+ * @test        @ID{srsendTest015} Verify the AddPayloadToLastMessage function
+ *
+ * @details     This test verifies that payloads are only packed into the last not yet sent data message of the buffer.
+ *
+ * Test steps:
+ * - initialize the module
+ * - verify that nothing is packed into an empty buffer
+ * - add a data message and verify that packing is only done up to the given maximum number of payloads
+ * - verify that nothing is packed into a message which does not have enough space left
+ * - read the message and verify that nothing is packed into an already sent message
+ * - add a heartbeat message and verify that nothing is packed into a message other than a data message
+ * - verify that the number of messages in the buffer is not changed by packing
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-596} Add to Buffer Function
+ * @verifyReq{RASW-604} Read Message to Send Function
+ */
+TEST_F(srsendTest, srsendTest015VerifyAddPayloadToLastMessage)
+{
+    const uint32_t connection_id = UT_SRSEND_MIN_IDX_CONN;
+    srtyp_SrMessageHeaderCreate message_header = {1, 2, 3, 4};
+    srtyp_SrMessagePayload small_payload = {1, {0x11}};
+    srtyp_SrMessagePayload large_payload = {UT_SRSEND_DATA_LEN_MAX, {}};
+    srtyp_SrMessage message = {};
+    srtyp_SrMessage read_message = {};
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+    // initialize module
+    srsend_Init(UT_SRSEND_MIN_NUM_CONN);
+
+    // nothing to pack into in an empty buffer
+    EXPECT_FALSE(srsend_AddPayloadToLastMessage(connection_id, srcty_kMaxNMaxPacket, &small_payload));
+
+    // pack into the last data message up to the maximum number of payloads
+    srmsg_CreateDataMessage(message_header, &small_payload, &message);
+    srsend_AddToBuffer(connection_id, &message);
+    EXPECT_FALSE(srsend_AddPayloadToLastMessage(connection_id, srcty_kMinNMaxPacket, &small_payload));
+    EXPECT_TRUE(srsend_AddPayloadToLastMessage(connection_id, 2U, &small_payload));
+    EXPECT_FALSE(srsend_AddPayloadToLastMessage(connection_id, 2U, &small_payload));
+    EXPECT_TRUE(srsend_AddPayloadToLastMessage(connection_id, 3U, &small_payload));
+
+    // no space left for the large payload
+    EXPECT_FALSE(srsend_AddPayloadToLastMessage(connection_id, srcty_kMaxNMaxPacket, &large_payload));
+    EXPECT_EQ(1U, srsend_GetUsedBufferEntries(connection_id));
+    EXPECT_EQ(1U, srsend_GetNumberOfMessagesToSend(connection_id));
+
+    // read the packed message
+    EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &read_message));
+    EXPECT_EQ(3U, srmsg_GetNumberOfDataMessagePayloads(&read_message));
+    EXPECT_EQ(message.message_size + (2U * (2U + small_payload.payload_size)), read_message.message_size);
+
+    // nothing to pack into an already sent message
+    EXPECT_FALSE(srsend_AddPayloadToLastMessage(connection_id, srcty_kMaxNMaxPacket, &small_payload));
+
+    // nothing to pack into a heartbeat message
+    srmsg_CreateHeartbeatMessage(message_header, &message);
+    srsend_AddToBuffer(connection_id, &message);
+    EXPECT_FALSE(srsend_AddPayloadToLastMessage(connection_id, srcty_kMaxNMaxPacket, &small_payload));
+    EXPECT_EQ(2U, srsend_GetUsedBufferEntries(connection_id));
+    EXPECT_EQ(1U, srsend_GetNumberOfMessagesToSend(connection_id));
+}
+
+/**
+ * @test        @ID{srsendTest020} Verify the share of the slab chunks per connection
+ *
+ * @details     This test verifies that the free buffer entries of a connection are limited to its share of the slab chunks, so that one connection cannot
+ *              use up the chunks of the other connections.
+ *
+ * Test steps:
+ * - initialize the slab with 20 chunks of maximum message size, which gives a share of 5 chunks per connection for 2 connections
+ * - initialize the module with 2 connections
+ * - verify that both connections have 5 free buffer entries
+ * - add 5 messages to the first connection and verify that it has no free buffer entries left
+ * - verify that the second connection still has 5 free buffer entries
+ * - read and confirm the messages of the first connection and verify that it has 5 free buffer entries again
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-596} Add to Buffer Function
+ * @verifyReq{RASW-598} Get Free Buffer Entries Function
+ */
+TEST_F(srsendTest, srsendTest020VerifyConnectionChunkShare)
+{
+    const uint16_t number_of_chunks = 20;
+    const uint32_t expected_chunk_share = 5;
+    const raslb_SlabConfiguration slab_configuration = {1, {{RADEF_SLAB_LARGE_CHUNK_SIZE, number_of_chunks}}};
+    srtyp_SrMessageHeaderCreate message_header = {1, 2, 3, 4};
+    srtyp_SrMessage message = {};
+    srtyp_SrMessage read_message = {};
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+    // initialize the slab with less chunks and the module
+    raslb_instance->initialized = false;
+    raslb_Init(&slab_configuration);
+    srsend_Init(UT_SRSEND_MAX_NUM_CONN);
+    EXPECT_EQ(expected_chunk_share, srsend_GetFreeBufferEntries(UT_SRSEND_MIN_IDX_CONN));
+    EXPECT_EQ(expected_chunk_share, srsend_GetFreeBufferEntries(UT_SRSEND_MAX_IDX_CONN));
+
+    // use up the share of the first connection
+    for (uint32_t i = 0; i < expected_chunk_share; i++)
+    {
+        message_header.sequence_number = i;
+        srmsg_CreateHeartbeatMessage(message_header, &message);
+        srsend_AddToBuffer(UT_SRSEND_MIN_IDX_CONN, &message);
+    }
+    EXPECT_EQ(0U, srsend_GetFreeBufferEntries(UT_SRSEND_MIN_IDX_CONN));
+    EXPECT_EQ(expected_chunk_share, srsend_GetFreeBufferEntries(UT_SRSEND_MAX_IDX_CONN));
+    EXPECT_EQ((number_of_chunks - expected_chunk_share), raslb_GetNumberOfFreeChunks(RADEF_SLAB_LARGE_CHUNK_SIZE));
+
+    // the share is available again after the messages are confirmed
+    for (uint32_t i = 0; i < expected_chunk_share; i++)
+    {
+        EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(UT_SRSEND_MIN_IDX_CONN, &read_message));
+    }
+    srsend_RemoveFromBuffer(UT_SRSEND_MIN_IDX_CONN, (expected_chunk_share - 1));
+    EXPECT_EQ(expected_chunk_share, srsend_GetFreeBufferEntries(UT_SRSEND_MIN_IDX_CONN));
+    EXPECT_EQ(expected_chunk_share, srsend_GetFreeBufferEntries(UT_SRSEND_MAX_IDX_CONN));
+}
+
+/**
+ * @test        @ID{srsendTest021} Verify the check of the chunk share per connection
+ *
+ * @details     This test verifies that the IsChunkShareSufficient function accepts the default slab configuration and that the init function rejects a
+ *              slab, which gives a connection no chunk, instead of using a share of one chunk.
+ *
+ * Test steps:
+ * - call the IsChunkShareSufficient function with invalid parameters and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * - verify that the chunk share of the default slab configuration is sufficient for all numbers of connections and the full range of n_send_max
+ * - initialize the slab with 1 chunk of maximum message size
+ * - initialize the module with 2 connections and verify that a fatal error with error code radef_kInvalidParameter gets thrown
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-600} Init sr_send_buffer Function
+ * @verifyReq{RASW-520} Error Handling
+ * @verifyReq{RASW-521} Input Parameter Check
+ */
+TEST_F(srsendTest, srsendTest021VerifyConnectionChunkShareCheck)
+{
+    const raslb_SlabConfiguration slab_configuration = {1, {{RADEF_SLAB_LARGE_CHUNK_SIZE, 1}}};
+
+    // invalid parameters
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).WillRepeatedly(Invoke(this, &srsendTest::invalidArgumentException));
+    EXPECT_THROW(srsend_IsChunkShareSufficient(0U, srcty_kMinNSendMax), std::invalid_argument);
+    EXPECT_THROW(srsend_IsChunkShareSufficient(RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS + 1U, srcty_kMinNSendMax), std::invalid_argument);
+    EXPECT_THROW(srsend_IsChunkShareSufficient(UT_SRSEND_MAX_NUM_CONN, srcty_kMinNSendMax - 1U), std::invalid_argument);
+    EXPECT_THROW(srsend_IsChunkShareSufficient(UT_SRSEND_MAX_NUM_CONN, RADEF_MAX_N_SEND_MAX + 1U), std::invalid_argument);
+
+    // the default slab takes full send buffers of all connections
+    for (uint32_t connections = 1U; connections <= RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS; connections++)
+    {
+        for (uint16_t n_send_max = srcty_kMinNSendMax; n_send_max <= RADEF_MAX_N_SEND_MAX; n_send_max++)
+        {
+            EXPECT_TRUE(srsend_IsChunkShareSufficient(connections, n_send_max));
+        }
+    }
+
+    // no chunk for a connection
+    raslb_instance->initialized = false;
+    raslb_Init(&slab_configuration);
+    EXPECT_THROW(srsend_Init(UT_SRSEND_MAX_NUM_CONN), std::invalid_argument);
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -156,6 +156,28 @@ class RemoveFromBufferTestWithParam :   public srsendTest,
     bool expect_fatal_error =           std::get<8>(GetParam());    ///< indicates if a fatal error is expected
 };
 
+/**
+ * @brief Test class for value-parametrized PrepareBufferForRetr test with a full buffer
+ *
+ * Parameter order:
+ * - number of messages to add and remove before the test (uint16_t)
+ * - number of sent messages (uint16_t)
+ * - heartbeat interval of the sent messages (uint16_t)
+ * - add unsent retransmission request (bool)
+ * - expect fatal error (bool)
+ * .
+ */
+class PrepareFullBufferForRetrTestWithParam :   public srsendTest,
+                                                public testing::WithParamInterface<std::tuple<uint16_t, uint16_t, uint16_t, bool, bool>>
+{
+    public:
+    uint16_t n_offset =                 std::get<0>(GetParam());    ///< number of messages to add and remove before the test
+    uint16_t n_sent =                   std::get<1>(GetParam());    ///< number of sent messages
+    uint16_t hb_interval =              std::get<2>(GetParam());    ///< every n-th sent message is a heartbeat (0 = no heartbeats)
+    bool add_retr_req =                 std::get<3>(GetParam());    ///< indicates if an unsent retransmission request is added
+    bool expect_fatal_error =           std::get<4>(GetParam());    ///< indicates if a fatal error is expected
+};
+
 // -----------------------------------------------------------------------------
 // Test cases
 // -----------------------------------------------------------------------------
@@ -768,6 +790,349 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(2, 2, 10, 0, 0, 0, 0, 0, true)
     ));
 
+/**
+ * @test        @ID{srsendTest016} Verify the PrepareBufferForRetr function with packed messages
+ *
+ * @details     This test verifies that all packed messages of a data message are kept when the message is transformed for a retransmission.
+ *
+ * Test steps:
+ * - initialize the module
+ * - add a data message with three packed payloads to the buffer and read it (already sent)
+ * - add a second data message with two packed payloads to the buffer (not yet sent)
+ * - prepare the buffer for the retransmission
+ * - read the retransmission response and verify the message type
+ * - read the retransmitted data message and verify that all three payloads are kept
+ * - read the data message and verify that both payloads are kept
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-603} Prepare Buffer for Retransmission Function
+ */
+TEST_F(srsendTest, srsendTest016PrepareBufferForRetransmissionPackedMessages)
+{
+    const uint32_t connection_id = UT_SRSEND_MIN_IDX_CONN;
+    const uint32_t last_confirmed_sequence_number = 9;
+    srtyp_SrMessageHeaderCreate message_header = {1, 2, (last_confirmed_sequence_number + 1), 4};
+    srtyp_SrMessagePayload payloads[3] = {{1, {0x11}}, {2, {0x21, 0x22}}, {3, {0x31, 0x32, 0x33}}};
+    srtyp_SrMessagePayloadView payload_view = {0, NULL};
+    srtyp_SrMessage message = {};
+    uint32_t new_sequence_number = 0;
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+    // initialize module
+    srsend_Init(UT_SRSEND_MIN_NUM_CONN);
+
+    // add a sent data message with three payloads and an unsent data message with two payloads
+    srmsg_CreateDataMessage(message_header, &payloads[0], &message);
+    srsend_AddToBuffer(connection_id, &message);
+    EXPECT_TRUE(srsend_AddPayloadToLastMessage(connection_id, 3U, &payloads[1]));
+    EXPECT_TRUE(srsend_AddPayloadToLastMessage(connection_id, 3U, &payloads[2]));
+    EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &message));
+
+    ++message_header.sequence_number;
+    srmsg_CreateDataMessage(message_header, &payloads[2], &message);
+    srsend_AddToBuffer(connection_id, &message);
+    EXPECT_TRUE(srsend_AddPayloadToLastMessage(connection_id, 3U, &payloads[0]));
+
+    // prepare the retransmission
+    ++message_header.sequence_number;
+    srsend_PrepareBufferForRetr(connection_id, last_confirmed_sequence_number, message_header, &new_sequence_number);
+    EXPECT_EQ(message_header.sequence_number + 3U, new_sequence_number);
+    EXPECT_EQ(3U, srsend_GetNumberOfMessagesToSend(connection_id));
+
+    // verify the retransmission response
+    EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &message));
+    EXPECT_EQ(srtyp_kSrMessageRetrResp, srmsg_GetMessageType(&message));
+
+    // verify the retransmitted data message
+    EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &message));
+    EXPECT_EQ(srtyp_kSrMessageRetrData, srmsg_GetMessageType(&message));
+    ASSERT_EQ(3U, srmsg_GetNumberOfDataMessagePayloads(&message));
+    uint16_t payload_offset = 0U;
+    for (uint16_t payload_index = 0; payload_index < 3U; payload_index++)
+    {
+        srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view);
+        ASSERT_EQ(payloads[payload_index].payload_size, payload_view.payload_size);
+        for (uint16_t i = 0; i < payload_view.payload_size; i++)
+        {
+            EXPECT_EQ(payloads[payload_index].payload[i], payload_view.payload[i]);
+        }
+    }
+
+    // verify the data message
+    EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &message));
+    EXPECT_EQ(srtyp_kSrMessageData, srmsg_GetMessageType(&message));
+    ASSERT_EQ(2U, srmsg_GetNumberOfDataMessagePayloads(&message));
+    payload_offset = 0U;
+    srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view);
+    EXPECT_EQ(payloads[2].payload_size, payload_view.payload_size);
+    srmsg_GetDataMessagePayloadView(&message, &payload_offset, &payload_view);
+    EXPECT_EQ(payloads[0].payload_size, payload_view.payload_size);
+}
+
+/**
+ * @test        @ID{srsendTest017} Verify the PrepareBufferForRetr function with a full buffer
+ *
+ * @details     This test verifies that the send buffer is rebuilt in place for a retransmission, also when the buffer is almost full and the
+ *              buffer indexes wrap around.
+ *
+ * Test steps:
+ * - initialize the module
+ * - add, read and remove the given number of messages to move the buffer indexes
+ * - add the given number of data and heartbeat messages, every data message with a different payload, and read them (already sent)
+ * - add an unsent retransmission request (if activated)
+ * - call the PrepareBufferForRetr function and verify the new sequence number and the number of messages to send
+ * - read all messages and verify the message types, sequence numbers and payloads
+ * - remove all messages from the buffer, then fill the complete buffer with new messages and verify that they are read in order
+ * .
+ *
+ * @testParameter
+ * - Offset: Number of messages added and removed before the test
+ * - Sent msgs: Number of sent messages in the buffer
+ * - HB interval: Every n-th sent message is a heartbeat (0 = no heartbeats)
+ * - RetrReq: Indicates if an unsent retransmission request is added
+ * .
+ * | Test Run | Test config                                  |||| Expected values                           ||
+ * |----------|--------|-----------|-------------|---------|---------------------------|--------------------|
+ * |          | Offset | Sent msgs | HB interval | RetrReq | Exp. Error Code           | Test Result        |
+ * | 0        | 0      | 18        | 0           | False   |                           | Normal operation   |
+ * | 1        | 15     | 12        | 3           | True    |                           | Normal operation   |
+ * | 2        | 7      | 17        | 0           | True    |                           | Normal operation   |
+ * | 3        | 19     | 18        | 2           | False   |                           | Normal operation   |
+ * | 4        | 3      | 18        | 0           | True    | radef_kSendBufferFull     | Fatal Error raised |
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         This is a value-parametrized test case which needs instantiation with defined values.
+ *              This test case makes use of the srmsg module which needs to be tested separately.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-603} Prepare Buffer for Retransmission Function
+ * @verifyReq{RASW-604} Read Message to Send Function
+ * @verifyReq{RASW-605} Remove from Buffer Function
+ */
+TEST_P(PrepareFullBufferForRetrTestWithParam, srsendTest017PrepareFullBufferForRetransmission)
+{
+    const uint32_t connection_id = UT_SRSEND_MIN_IDX_CONN;
+    const uint32_t last_confirmed_sequence_number = (uint32_t)(n_offset - 1);
+    srtyp_SrMessageHeaderCreate message_header = {1, 2, 0, 4};
+    srtyp_SrMessage read_message = {};
+    uint8_t payload[UT_SRSEND_DATA_LEN_MAX] = {};
+    uint32_t new_sequence_number = 0;
+    uint32_t sequence_number = 0;
+
+    // initialize module
+    srsend_Init(UT_SRSEND_MIN_NUM_CONN);
+
+    // move the buffer indexes
+    for (uint16_t i = 0; i < n_offset; i++)
+    {
+        CreateAndAddMessage(connection_id, sequence_number, srtyp_kSrMessageHb, (uint8_t *)NULL);
+        EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &read_message));
+        ++sequence_number;
+    }
+    srsend_RemoveFromBuffer(connection_id, last_confirmed_sequence_number);
+    EXPECT_EQ(0U, srsend_GetUsedBufferEntries(connection_id));
+
+    // add the sent messages, the first payload byte identifies the data message
+    for (uint16_t i = 0; i < n_sent; i++)
+    {
+        if ((hb_interval != 0) && ((i % hb_interval) == (hb_interval - 1)))
+        {
+            CreateAndAddMessage(connection_id, sequence_number, srtyp_kSrMessageHb, (uint8_t *)NULL);
+        }
+        else
+        {
+            payload[0] = (uint8_t)i;
+            CreateAndAddMessage(connection_id, sequence_number, srtyp_kSrMessageData, payload);
+        }
+        EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &read_message));
+        ++sequence_number;
+    }
+
+    // add the unsent retransmission request
+    if (add_retr_req)
+    {
+        CreateAndAddMessage(connection_id, sequence_number, srtyp_kSrMessageRetrReq, (uint8_t *)NULL);
+        ++sequence_number;
+    }
+
+    message_header.sequence_number = sequence_number;
+    if (expect_fatal_error)
+    {
+        EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kSendBufferFull)).WillOnce(Invoke(this, &srsendTest::invalidArgumentException));
+        EXPECT_THROW(srsend_PrepareBufferForRetr(connection_id, last_confirmed_sequence_number, message_header, &new_sequence_number), std::invalid_argument);
+    }
+    else
+    {
+        EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+        // expected messages: RetrResp, RetrData for every data message, HB and optional RetrReq
+        uint16_t n_data = n_sent;
+        if (hb_interval != 0)
+        {
+            n_data = n_sent - (n_sent / hb_interval);
+        }
+        const uint16_t n_expected = n_data + (add_retr_req ? 3 : 2);
+
+        srsend_PrepareBufferForRetr(connection_id, last_confirmed_sequence_number, message_header, &new_sequence_number);
+        EXPECT_EQ(message_header.sequence_number + n_expected, new_sequence_number);
+        EXPECT_EQ(n_expected, srsend_GetNumberOfMessagesToSend(connection_id));
+        EXPECT_EQ(n_expected, srsend_GetUsedBufferEntries(connection_id));
+
+        // verify the retransmission response
+        sequence_number = message_header.sequence_number;
+        EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &read_message));
+        verifyMessage(&read_message, &message_header, sequence_number++, expected_type_retr_resp, (uint8_t *)NULL);
+
+        // verify the retransmitted data messages
+        for (uint16_t i = 0; i < n_sent; i++)
+        {
+            if ((hb_interval == 0) || ((i % hb_interval) != (hb_interval - 1)))
+            {
+                EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &read_message));
+                verifyMessage(&read_message, &message_header, sequence_number++, expected_type_retr_data, (uint8_t *)NULL);
+                EXPECT_EQ(UT_SRSEND_MESSAGE_LEN_MAX, read_message.message_size);
+                EXPECT_EQ((uint8_t)i, getDataFromBuffer_u8(read_message.message, expected_payload_pos));
+            }
+        }
+
+        // verify the end of the retransmission
+        EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &read_message));
+        verifyMessage(&read_message, &message_header, sequence_number++, expected_type_heartbeat, (uint8_t *)NULL);
+        if (add_retr_req)
+        {
+            EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &read_message));
+            verifyMessage(&read_message, &message_header, sequence_number++, expected_type_retr_req, (uint8_t *)NULL);
+        }
+        EXPECT_EQ(radef_kNoMessageToSend, srsend_ReadMessageToSend(connection_id, &read_message));
+
+        // remove all messages and verify that the complete buffer can be used again
+        srsend_RemoveFromBuffer(connection_id, sequence_number - 1);
+        EXPECT_EQ(RADEF_SEND_BUFFER_SIZE, srsend_GetFreeBufferEntries(connection_id));
+        for (uint16_t i = 0; i < RADEF_SEND_BUFFER_SIZE; i++)
+        {
+            payload[0] = (uint8_t)(UINT8_MAX - i);
+            CreateAndAddMessage(connection_id, sequence_number + i, srtyp_kSrMessageData, payload);
+        }
+        for (uint16_t i = 0; i < RADEF_SEND_BUFFER_SIZE; i++)
+        {
+            EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &read_message));
+            EXPECT_EQ(sequence_number + i, getDataFromBuffer_u32(read_message.message, expected_sequence_nbr_pos));
+            EXPECT_EQ((uint8_t)(UINT8_MAX - i), getDataFromBuffer_u8(read_message.message, expected_payload_pos));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    verifyPrepareFullBufferForRetrFunction,
+    PrepareFullBufferForRetrTestWithParam,
+    ::testing::Values(
+        std::make_tuple(0, 18, 0, false, false),
+        std::make_tuple(15, 12, 3, true, false),
+        std::make_tuple(7, 17, 0, true, false),
+        std::make_tuple(19, 18, 2, false, false),
+        std::make_tuple(3, 18, 0, true, true)
+    ));
+
+/**
+ * @test        @ID{srsendTest018} Verify the sequence number indexing after many buffer wraps
+ *
+ * @details     This test verifies the IsSequenceNumberInBuffer and RemoveFromBuffer functions when the buffer indexes and the sequence numbers wrap around
+ *              several times.
+ *
+ * Test steps:
+ * - initialize the module
+ * - repeat for 10 rounds, starting with a sequence number close to the maximum value:
+ *   - fill the buffer with data messages and read the first 15 of them
+ *   - verify that the first and the last message are found in the buffer and that the sequence numbers in front of and behind the buffer are not found
+ *   - confirm a sequence number older than the oldest message and verify that no message is removed
+ *   - confirm the 10th message and verify that 10 messages are removed
+ *   - confirm the last message and verify that only the 5 remaining sent messages are removed
+ *   - read and confirm the remaining messages and verify that the buffer is empty
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         This test case makes use of the srmsg module which needs to be tested separately.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-602} Is Sequence Number in Buffer Function
+ * @verifyReq{RASW-605} Remove from Buffer Function
+ */
+TEST_F(srsendTest, srsendTest018VerifySequenceNumberIndexingAfterBufferWraps)
+{
+    const uint32_t connection_id = UT_SRSEND_MIN_IDX_CONN;
+    const uint32_t n_rounds = 10;
+    const uint32_t n_read = 15;
+    const uint32_t n_confirm = 10;
+    srtyp_SrMessage read_message = {0, {}};
+    uint32_t first_sequence_number = (UINT32_MAX - 50);
+
+    EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
+
+    // initialize module
+    srsend_Init(UT_SRSEND_MIN_NUM_CONN);
+
+    for (uint32_t round = 0; round < n_rounds; round++)
+    {
+        const uint32_t last_sequence_number = first_sequence_number + UT_SRSEND_NSENDMAX_MAX - 1;
+
+        // fill the buffer and read a part of the messages
+        for (uint32_t i = 0; i < UT_SRSEND_NSENDMAX_MAX; i++)
+        {
+            CreateAndAddMessage(connection_id, (first_sequence_number + i), srtyp_kSrMessageData, NULL);
+        }
+        for (uint32_t i = 0; i < n_read; i++)
+        {
+            EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &read_message));
+        }
+
+        // verify the sequence number lookup
+        EXPECT_EQ(radef_kNoError, srsend_IsSequenceNumberInBuffer(connection_id, first_sequence_number));
+        EXPECT_EQ(radef_kNoError, srsend_IsSequenceNumberInBuffer(connection_id, last_sequence_number));
+        EXPECT_EQ(radef_kInvalidSequenceNumber, srsend_IsSequenceNumberInBuffer(connection_id, (first_sequence_number - 1)));
+        EXPECT_EQ(radef_kInvalidSequenceNumber, srsend_IsSequenceNumberInBuffer(connection_id, (last_sequence_number + 1)));
+
+        // confirm an old sequence number, nothing is removed
+        srsend_RemoveFromBuffer(connection_id, (first_sequence_number - 1));
+        EXPECT_EQ(UT_SRSEND_NSENDMAX_MAX, srsend_GetUsedBufferEntries(connection_id));
+
+        // confirm a part of the sent messages
+        srsend_RemoveFromBuffer(connection_id, (first_sequence_number + n_confirm - 1));
+        EXPECT_EQ((UT_SRSEND_NSENDMAX_MAX - n_confirm), srsend_GetUsedBufferEntries(connection_id));
+        EXPECT_EQ(radef_kInvalidSequenceNumber, srsend_IsSequenceNumberInBuffer(connection_id, first_sequence_number));
+        EXPECT_EQ(radef_kNoError, srsend_IsSequenceNumberInBuffer(connection_id, (first_sequence_number + n_confirm)));
+
+        // confirm the last message, only the sent messages are removed
+        srsend_RemoveFromBuffer(connection_id, last_sequence_number);
+        EXPECT_EQ((UT_SRSEND_NSENDMAX_MAX - n_read), srsend_GetUsedBufferEntries(connection_id));
+        EXPECT_EQ(radef_kNoError, srsend_IsSequenceNumberInBuffer(connection_id, (first_sequence_number + n_read)));
+
+        // read and confirm the remaining messages
+        for (uint32_t i = n_read; i < UT_SRSEND_NSENDMAX_MAX; i++)
+        {
+            EXPECT_EQ(radef_kNoError, srsend_ReadMessageToSend(connection_id, &read_message));
+        }
+        srsend_RemoveFromBuffer(connection_id, last_sequence_number);
+        EXPECT_EQ(0U, srsend_GetUsedBufferEntries(connection_id));
+        EXPECT_EQ(UT_SRSEND_NSENDMAX_MAX, srsend_GetFreeBufferEntries(connection_id));
+
+        first_sequence_number = last_sequence_number + 1;
+    }
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
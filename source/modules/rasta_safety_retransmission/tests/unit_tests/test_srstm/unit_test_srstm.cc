@@ -130,8 +130,6 @@ class ProcessStateMachineTestWithParam :    public srstmTest,
  */
 TEST_P(InitTestWithParam, srstmTest001VerifyInitFunction)
 {
-    extern uint32_t srstm_number_of_connections;
-
     if (expect_fatal_error)
     {
         // call the init function and expect a fatal error
@@ -144,8 +142,8 @@ TEST_P(InitTestWithParam, srstmTest001VerifyInitFunction)
         EXPECT_CALL(rasys_mock, rasys_FatalError(_)).Times(0);
         EXPECT_NO_THROW(srstm_Init(configured_connections));
 
-        EXPECT_EQ(srstm_number_of_connections, configured_connections);
-        EXPECT_TRUE(srstm_initialized);
+        EXPECT_EQ(srstm_instance->number_of_connections, configured_connections);
+        EXPECT_TRUE(srstm_instance->initialized);
     }
 }
 
@@ -275,7 +273,7 @@ TEST_P(GetConnStateTestWithParam, srstmTest004VerifyGetConnectionStateFunction)
     srstm_Init(UT_SRSTM_MAX_NUM_CONN);
 
     // set connection state
-    srstm_connection_states[connection_id] = connection_state;
+    srstm_instance->connection_states[connection_id] = connection_state;
 
     if (expect_fatal_error)
     {
@@ -345,14 +343,12 @@ INSTANTIATE_TEST_SUITE_P(
  */
 TEST_P(ProcessStateMachineTestWithParam, srstmTest011VerifyProcessStateMachineFunction)
 {
-    extern sraty_ConnectionStates srstm_connection_states[RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS];
-
     // initialize the module with given number of connections
     srstm_Init(configured_connections);
 
     if (reset_state_uninitialized)
     {
-        srstm_connection_states[connection_id] = sraty_kConnectionNotInitialized;
+        srstm_instance->connection_states[connection_id] = sraty_kConnectionNotInitialized;
     }
 
     // call the ProcessConnectionStateMachine function and expect a fatal error
@@ -371,6 +367,49 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(UT_SRSTM_MAX_NUM_CONN, 0, srtyp_kConnEventNone, true, radef_kInternalError)
     ));
 
+/**
+ * @test        @ID{srstmTest012} Verify the GetConnectionMemorySize function.
+ *
+ * @details     This test verifies that the GetConnectionMemorySize function returns the size of the connection memory
+ *              which is allocated by the init function.
+ *
+ * Test steps:
+ * - call the GetConnectionMemorySize function with an invalid number of connections and expect a fatal error
+ * - for the minimum and maximum number of connections:
+ *   - reset the connection memory module
+ *   - call the init function and verify that the allocated connection memory matches the returned size
+ * .
+ *
+ * @safetyRel   Yes
+ *
+ * @pre         No pre-conditions for this test case.
+ * @post        No post-conditions for this test case.
+ *
+ * @testMethod  Functional Test
+ *
+ * @verifyReq{RASW-562} Init sr_state_machine Function
+ */
+TEST_F(srstmTest, srstmTest012VerifyGetConnectionMemorySizeFunction)
+{
+    // invalid number of connections
+    EXPECT_CALL(rasys_mock, rasys_FatalError(radef_kInvalidParameter)).Times(2).WillRepeatedly(Invoke(this, &srstmTest::invalidArgumentException));
+    EXPECT_THROW(srstm_GetConnectionMemorySize(UT_SRSTM_MIN_NUM_CONN - 1), std::invalid_argument);
+    EXPECT_THROW(srstm_GetConnectionMemorySize(UT_SRSTM_MAX_NUM_CONN + 1), std::invalid_argument);
+
+    for (uint32_t configured_connections = UT_SRSTM_MIN_NUM_CONN; configured_connections <= UT_SRSTM_MAX_NUM_CONN; configured_connections++)
+    {
+        // reset the modules
+        srstm_instance->initialized = false;
+        srmem_instance->initialized = false;
+        srmem_Init(connection_memory, sizeof(connection_memory));
+
+        // verify the allocated connection memory
+        srstm_Init(configured_connections);
+        EXPECT_EQ(srstm_GetConnectionMemorySize(configured_connections), srmem_instance->allocated_size);
+        EXPECT_EQ(0U, (srmem_instance->allocated_size % SRATY_CONNECTION_MEMORY_ALIGNMENT));
+    }
+}
+
 /** @}*/
 
 // -----------------------------------------------------------------------------
@@ -26,6 +26,7 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include "src/srstm_sr_state_machine.h"
+#include "src/srmem_sr_connection_memory.h"
 #include "src/srcor_sr_core.h"
 #include "rasta_common/raas_rasta_assert.h"
 #include "rasys_mock.hh"
@@ -49,13 +50,14 @@ using testing::Throw;
 #define UT_SRSTM_MAX_NUM_CONN 2         ///< maximum number of rasta connections
 #define UT_SRSTM_MIN_IDX_CONN 0         ///< minimum rasta connection index
 #define UT_SRSTM_MAX_IDX_CONN 1         ///< maximum rasta connection index
+#define UT_SRSTM_CONNECTION_MEMORY_SIZE 1024  ///< size of the connection memory [bytes]
 
 // -----------------------------------------------------------------------------
 // Global Variable Declarations
 // -----------------------------------------------------------------------------
 
-extern bool srstm_initialized;          ///< initialization state (local variable)
-extern sraty_ConnectionStates srstm_connection_states[UT_SRSTM_MAX_NUM_CONN]; ///< connection states (local variable)
+extern RADEF_THREAD_LOCAL srstm_InstanceData *srstm_instance; ///< data of the selected state machine module instance
+extern RADEF_THREAD_LOCAL srmem_InstanceData *srmem_instance; ///< data of the selected connection memory module instance
 
 // -----------------------------------------------------------------------------
 // Test Class Definition
@@ -71,7 +73,10 @@ public:
     srstmTest()
     {
         // reset initialization state
-        srstm_initialized = false;
+        srstm_instance->initialized = false;
+        srmem_instance->initialized = false;
+        // initialize connection memory module
+        srmem_Init(connection_memory, sizeof(connection_memory));
     }
     ~srstmTest()
     {
@@ -86,6 +91,8 @@ public:
         throw std::invalid_argument("Invalid argument!");
     }
 
+    uint64_t connection_memory[UT_SRSTM_CONNECTION_MEMORY_SIZE / sizeof(uint64_t)];  ///< connection memory for the connection states
+
     StrictMock<rasysMock>   rasys_mock;     ///< mock for the rasta system adapter class
     StrictMock<srcorMock>   srcor_mock;     ///< mock for the rasta safety and retransmission core class
 };
@@ -1288,8 +1288,6 @@ INSTANTIATE_TEST_SUITE_P(
 
 void InitModuleAndSetState(uint32_t connection_id, sraty_ConnectionStates state)
 {
-    extern sraty_ConnectionStates srstm_connection_states[RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS];
-
     srstm_Init(UT_SRSTM_MIN_NUM_CONN);
-    srstm_connection_states[connection_id] = state;
+    srstm_instance->connection_states[connection_id] = state;
 }
@@ -0,0 +1,115 @@
+/**
+ * @copyright Copyright (C) 2022, SBB AG, CH-3000 Bern
+ *
+ * @file srcfg_sr_sizing_generator.c
+ *
+ * @author Roland Schenk, CSA Engineering AG, CH-4500 Solothurn
+ *
+ * @version 6a56b6d9a6998494e007e63d764a40fdf63cbbac
+ *
+ * @change{-,Initial version,-,-}
+ *
+ * @brief Generator of the RaSTA SafRetL sizing header.
+ *
+ * This host tool is built together with the SafRetL configuration (srcfg_sr_config.c) and writes the sizing header srcfg_sr_sizing.h. The sizing header
+ * defines the build time dimensions of the SafRetL storage with exactly the values needed by the configuration:
+ *
+ *   srcfg_sr_sizing_generator <output file>
+ *
+ * The tool is compiled with the number of connections limited only by the uint16_t timer ids (65535), so that every configuration the stack can run
+ * with is read.
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+#include <stdint.h>
+#include <stdio.h>
+
+#include "rasta_common/radef_rasta_definitions.h"
+#include "rasta_safety_retransmission/srcty_sr_config_types.h"
+#include "rasta_safety_retransmission_config/srcfg_sr_config.h"
+
+// -----------------------------------------------------------------------------
+// Local Macro Definitions
+// -----------------------------------------------------------------------------
+
+#ifdef RADEF_CONFIGURATION_SIZING
+#error "The sizing generator must not be built with the generated sizing"
+#endif
+
+// -----------------------------------------------------------------------------
+// Local Function Prototypes
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Return the smallest power of two, which is greater or equal than a value.
+ *
+ * @param [in] value Value. Valid range: 1 <= value <= 2^31.
+ * @return Smallest power of two >= value.
+ */
+static uint32_t NextPowerOfTwo(const uint32_t value);
+
+// -----------------------------------------------------------------------------
+// Global Function Implementations
+// -----------------------------------------------------------------------------
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    (void)fprintf(stderr, "usage: %s <output file>\n", argv[0]);
+    return 1;
+  }
+
+  const srcty_SafetyRetransmissionConfiguration* const kConfiguration = &safety_retransmission_configuration;
+  if ((kConfiguration->number_of_connections == 0U) || (kConfiguration->number_of_connections > RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS) ||
+      (kConfiguration->n_send_max == 0U)) {
+    (void)fprintf(stderr, "%s: invalid SafRetL configuration\n", argv[0]);
+    return 1;
+  }
+
+  FILE* const output_file = fopen(argv[1], "w");
+  if (output_file == NULL) {
+    (void)fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[1]);
+    return 1;
+  }
+
+  const uint32_t kNSendMax = kConfiguration->n_send_max;
+
+  (void)fprintf(output_file,
+                "/**\n"
+                " * @file srcfg_sr_sizing.h\n"
+                " *\n"
+                " * @brief Sizing of the RaSTA SafRetL storage for the SafRetL configuration.\n"
+                " *\n"
+                " * This file is generated by srcfg_sr_sizing_generator from srcfg_sr_config.c, do not edit it manually.\n"
+                " */\n"
+                "#ifndef SRCFG_SR_SIZING_H_\n"
+                "#define SRCFG_SR_SIZING_H_\n"
+                "\n");
+  (void)fprintf(output_file, "#ifndef RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS\n#define RADEF_MAX_NUMBER_OF_RASTA_CONNECTIONS (%luU)\n#endif\n\n",
+                (unsigned long)kConfiguration->number_of_connections);
+  (void)fprintf(output_file, "#ifndef RADEF_CONNECTION_INDEX_SIZE\n#define RADEF_CONNECTION_INDEX_SIZE (%luU)\n#endif\n\n",
+                (unsigned long)NextPowerOfTwo(2U * kConfiguration->number_of_connections));
+  (void)fprintf(output_file, "#ifndef RADEF_MAX_N_SEND_MAX\n#define RADEF_MAX_N_SEND_MAX (%luU)\n#endif\n\n", (unsigned long)kNSendMax);
+  (void)fprintf(output_file, "#ifndef RADEF_SEND_BUFFER_INDEX_SIZE\n#define RADEF_SEND_BUFFER_INDEX_SIZE (%luU)\n#endif\n\n",
+                (unsigned long)NextPowerOfTwo(2U * kNSendMax));
+  (void)fprintf(output_file, "#ifndef RADEF_RECEIVED_BUFFER_SIZE\n#define RADEF_RECEIVED_BUFFER_SIZE (%luU)\n#endif\n\n",
+                (unsigned long)NextPowerOfTwo(kNSendMax));
+  (void)fprintf(output_file, "#endif  // SRCFG_SR_SIZING_H_\n");
+
+  return (fclose(output_file) == 0) ? 0 : 1;
+}
+
+// -----------------------------------------------------------------------------
+// Local Function Implementations
+// -----------------------------------------------------------------------------
+
+static uint32_t NextPowerOfTwo(const uint32_t value) {
+  uint32_t power_of_two = 1U;
+
+  while (power_of_two < value) {
+    power_of_two <<= 1U;
+  }
+
+  return power_of_two;
+}